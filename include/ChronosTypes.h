@@ -2,6 +2,8 @@
 #define CHRONOS_TYPES_H
 
 #include <Arduino.h>
+#include "NavigationFields.h"
+#include "NavUnits.h"
 
 // Cấu trúc dữ liệu điều hướng
 struct AppNavigation {
@@ -9,12 +11,15 @@ struct AppNavigation {
     bool hasIcon = false;
     bool isNavigation = false;
     uint32_t iconCRC = 0;
-    String eta = "";         // Thời gian đến nơi
-    String title = "";       // Tên đường/địa điểm hiện tại
-    String duration = "";    // Thời gian còn lại của cuộc hành trình
-    String distance = "";    // Khoảng cách đến đích
-    String speed = "";       // Tốc độ hiện tại
-    String directions = "";  // Hướng dẫn rẽ tiếp theo
+    NavEtaText eta;               // Thời gian đến nơi
+    NavTitleText title;           // Tên đường/địa điểm hiện tại
+    NavDurationText duration;     // Thời gian còn lại của cuộc hành trình
+    NavDistanceText distance;     // Khoảng cách đến đích
+    NavSpeedText speed;           // Tốc độ hiện tại
+    NavDirectionsText directions; // Hướng dẫn rẽ tiếp theo
+    int32_t distanceMeters = NAV_VALUE_UNKNOWN; // distance đã đổi ra mét
+    int32_t durationSeconds = NAV_VALUE_UNKNOWN; // duration đã đổi ra giây
+    int16_t etaMinutes = NAV_VALUE_UNKNOWN; // eta: phút tính từ 0h
     uint8_t icon[384];       // 96*4 bytes for icon data
     
     // Constructor mặc định
@@ -0,0 +1,110 @@
+#ifndef DISTANCE_READOUT_H
+#define DISTANCE_READOUT_H
+
+#include <lvgl.h>
+#include "DigitAtlas.h"
+
+// Ô hiển thị số khoảng cách ghép từ sprite của DigitAtlas thay cho lv_label.
+// Glyph được raster một lần khi tạo; mỗi lần đổi text chỉ các ô khác nhau bị
+// invalidate, và khi vẽ mỗi pixel chỉ là một lần tra bảng 16 màu đã trộn sẵn
+// chữ trên nền (nên widget phải nằm trên nền đặc màu bg).
+class DistanceReadout {
+private:
+    lv_obj_t* _obj = nullptr;
+    DigitAtlas _atlas;
+    DigitRow _row;
+    lv_color_t _lut[16];
+
+    static void drawEvent(lv_event_t* e) {
+        DistanceReadout* self = (DistanceReadout*)lv_event_get_user_data(e);
+        self->draw(lv_event_get_draw_ctx(e));
+    }
+
+    // Chép thẳng các ô giao với vùng đang vẽ vào buffer vẽ của LVGL
+    void draw(lv_draw_ctx_t* ctx) {
+        lv_area_t coords;
+        lv_obj_get_coords(_obj, &coords);
+        const lv_area_t* buf = ctx->buf_area;
+        lv_coord_t bufWidth = lv_area_get_width(buf);
+
+        for (uint8_t i = 0; i < _row.count; i++) {
+            const DigitAtlas::Glyph& glyph = _atlas.glyph(_row.glyph[i]);
+            lv_area_t cell;
+            cell.x1 = coords.x1 + _row.x[i];
+            cell.y1 = coords.y1;
+            cell.x2 = cell.x1 + glyph.width - 1;
+            cell.y2 = cell.y1 + _atlas.height() - 1;
+
+            lv_area_t part;
+            if (!_lv_area_intersect(&part, &cell, ctx->clip_area)) {
+                continue;
+            }
+            lv_color_t* dst = (lv_color_t*)ctx->buf + (part.y1 - buf->y1) * bufWidth + (part.x1 - buf->x1);
+            for (lv_coord_t y = part.y1; y <= part.y2; y++, dst += bufWidth) {
+                _atlas.blitRow(dst, _row.glyph[i], part.x1 - cell.x1, y - cell.y1, lv_area_get_width(&part), _lut);
+            }
+        }
+    }
+
+public:
+    // Tạo widget con của parent. Atlas chỉ được raster ở lần tạo đầu tiên.
+    // false nếu font không dùng được (thiếu glyph, không phải 4 bpp) hoặc hết bộ nhớ.
+    bool create(lv_obj_t* parent, const lv_font_t* font, lv_color_t fg, lv_color_t bg) {
+        if (!_atlas.ready() && !_atlas.build(font)) {
+            return false;
+        }
+        for (uint8_t a = 0; a < 16; a++) {
+            _lut[a] = lv_color_mix(fg, bg, a * 17);
+        }
+
+        _obj = lv_obj_create(parent);
+        lv_obj_remove_style_all(_obj);
+        lv_obj_clear_flag(_obj, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
+        lv_obj_set_size(_obj, 0, _atlas.height());
+        lv_obj_add_event_cb(_obj, drawEvent, LV_EVENT_DRAW_MAIN, this);
+        _row = DigitRow();
+        return true;
+    }
+
+    // Widget bị xóa cùng cha (lv_obj_clean màn hình): quên con trỏ, giữ atlas
+    void detach() {
+        _obj = nullptr;
+        _row = DigitRow();
+    }
+
+    lv_obj_t* obj() const {
+        return _obj;
+    }
+
+    // Đổi số hiển thị. false nếu text có ký tự ngoài atlas: widget giữ nguyên,
+    // người gọi hiển thị bằng nhãn thường.
+    bool setText(const char* text) {
+        DigitRow next;
+        if (_obj == nullptr || !_atlas.layout(text, next)) {
+            return false;
+        }
+
+        uint16_t x1[DIGIT_ATLAS_MAX_CELLS];
+        uint16_t x2[DIGIT_ATLAS_MAX_CELLS];
+        uint8_t spans = DigitAtlas::diff(_row, next, x1, x2);
+        bool resized = next.width != _row.width;
+        _row = next;
+
+        if (resized) {
+            // Đổi độ rộng: LVGL invalidate vùng cũ và mới, container co giãn theo
+            lv_obj_set_width(_obj, next.width);
+            return true;
+        }
+
+        lv_area_t coords;
+        lv_obj_get_coords(_obj, &coords);
+        for (uint8_t s = 0; s < spans; s++) {
+            lv_area_t area = {(lv_coord_t)(coords.x1 + x1[s]), coords.y1,
+                              (lv_coord_t)(coords.x1 + x2[s] - 1), coords.y2};
+            lv_obj_invalidate_area(_obj, &area);
+        }
+        return true;
+    }
+};
+
+#endif // DISTANCE_READOUT_H
@@ -4,8 +4,61 @@
 #include <Arduino.h>
 #include "LGFX_Config.h"  // Cấu hình LovyanGFX
 #include <lvgl.h>         // Include LVGL before other LVGL-dependent files
+#include <Preferences.h>
+#include <esp_ota_ops.h>
 #include "fonts/local_fonts.h"
 
+// 1: flush_cb chỉ xếp hàng một lần truyền DMA rồi trả về, LVGL vẽ dải tiếp theo
+// vào buffer còn lại trong lúc SPI truyền. 0: truyền đồng bộ như trước (để so sánh).
+#ifndef LVGL_ASYNC_FLUSH
+#define LVGL_ASYNC_FLUSH 1
+#endif
+
+// Cách cấp phát buffer vẽ cho LVGL
+enum DrawBufferMode : uint8_t {
+    DRAW_BUF_AUTO = 0,         // dùng kết quả benchmark đã lưu cho bản build này
+    DRAW_BUF_DOUBLE_BAND = 1,  // 2 buffer x 20 dòng: vẽ dải sau trong lúc DMA truyền dải trước
+    DRAW_BUF_SINGLE_LARGE = 2, // 1 buffer x 80 dòng: ít lần flush hơn, không song song
+    DRAW_BUF_FULL_FRAME = 3,   // 1 buffer toàn màn hình, direct mode: chỉ vẽ lại vùng thay đổi
+};
+
+// Ép một chế độ lúc biên dịch (không chạy benchmark)
+#ifndef LVGL_DRAW_BUF_MODE
+#define LVGL_DRAW_BUF_MODE DRAW_BUF_AUTO
+#endif
+
+// Free heap tối thiểu phải còn lại sau khi cấp phát buffer thì chế độ mới được chọn
+#ifndef LVGL_MIN_FREE_HEAP
+#define LVGL_MIN_FREE_HEAP (48 * 1024)
+#endif
+
+#define LVGL_BENCH_FRAMES 8 // số frame đo cho mỗi chế độ
+
+// Khoảng cách tối thiểu giữa hai frame khi có vùng cần vẽ lại hoặc animation (ms)
+#ifndef LVGL_FRAME_BUDGET_MS
+#define LVGL_FRAME_BUDGET_MS 33
+#endif
+
+// Kết quả benchmark một chế độ buffer trên màn hình đang hiển thị
+struct DrawBufferResult {
+    DrawBufferMode mode;
+    bool fits;          // cấp phát được và còn ít nhất LVGL_MIN_FREE_HEAP
+    uint32_t fullUs;    // vẽ lại toàn màn hình (trung bình, gồm cả truyền SPI)
+    uint32_t partialUs; // vẽ lại dải 240x60 giữa màn hình (vùng chữ điều hướng)
+    uint32_t flushes;   // số lần flush_cb cho một lần vẽ lại toàn màn hình
+    uint32_t freeHeap;  // free heap sau khi cấp phát buffer
+};
+
+// Số liệu vẽ lại của LVGL: frame gần nhất và tích lũy từ lần resetFrameStats() trước
+struct FrameStats {
+    uint32_t frames;          // số lần LVGL vẽ lại (có ít nhất một vùng invalid)
+    uint32_t lastPixels;      // số pixel được vẽ lại ở frame gần nhất
+    uint32_t lastFlushBytes;  // số byte gửi qua SPI ở frame gần nhất
+    uint32_t lastRenderMs;    // thời gian vẽ frame gần nhất (theo LVGL)
+    uint64_t totalPixels;
+    uint64_t totalFlushBytes;
+};
+
 class LVGL_Display {
 private:
     LGFX _tft;
@@ -13,22 +66,252 @@ private:
     lv_color_t *_buf1 = nullptr;
     lv_color_t *_buf2 = nullptr;
     lv_disp_drv_t _disp_drv;
+    lv_disp_t *_disp = nullptr;
     static const uint32_t _screenWidth = 240;
     static const uint32_t _screenHeight = 240;
     
-    // Hàm callback cho LVGL để vẽ lên màn hình
+    DrawBufferMode _bufMode = DRAW_BUF_DOUBLE_BAND;
+    bool _needsTuning = false; // chưa có kết quả benchmark cho bản build này
+    uint32_t _flushCount = 0;
+    
+    // Bộ lập lịch frame: lần chạy LVGL gần nhất khi có việc vẽ và hạn của timer LVGL kế tiếp
+    uint32_t _lastFrameMs = 0;
+    uint32_t _nextTimerMs = 0;
+    
+    FrameStats _stats = {};
+    uint32_t _frameFlushBytes = 0; // byte đã flush của frame đang vẽ
+    
+    // Driver đang chờ DMA truyền xong buffer đã flush (nullptr nếu không có)
+    lv_disp_drv_t *_pendingFlush = nullptr;
+#if !LV_COLOR_16_SWAP
+    // Direct mode: vùng buffer toàn màn hình phải đổi byte lại sau khi DMA xong
+    uint16_t *_restorePixels = nullptr;
+    uint32_t _restoreCount = 0;
+#endif
+    
+    // Hàm callback cho LVGL để vẽ lên màn hình. Ở chế độ dải, color_p là dải vừa
+    // vẽ. Ở direct mode LVGL vẽ thẳng vào buffer toàn màn hình và chỉ cần gửi
+    // một lần ở vùng cuối: gửi các dòng chứa mọi vùng vừa vẽ lại.
     static void _lvgl_flush_cb(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p) {
         LVGL_Display *display = (LVGL_Display *)disp->user_data;
         
-        uint32_t w = (area->x2 - area->x1 + 1);
-        uint32_t h = (area->y2 - area->y1 + 1);
+        lv_area_t region = *area;
+        uint16_t *pixels = (uint16_t *)color_p;
+        bool direct = disp->direct_mode;
+        if (direct) {
+            if (!lv_disp_flush_is_last(disp) || !display->dirtyRows(region)) {
+                lv_disp_flush_ready(disp);
+                return;
+            }
+            pixels = (uint16_t *)display->_buf1 + region.y1 * _screenWidth;
+        }
+        display->_flushCount++;
+        
+        uint32_t w = (region.x2 - region.x1 + 1);
+        uint32_t h = (region.y2 - region.y1 + 1);
+        display->_frameFlushBytes += w * h * sizeof(lv_color_t);
         
+#if LVGL_ASYNC_FLUSH
+        // Xếp hàng DMA và trả về ngay; lv_disp_flush_ready() được gọi khi DMA
+        // xong (pollFlush). Với LV_COLOR_16_SWAP, LVGL đã vẽ theo thứ tự byte
+        // của panel nên DMA đọc thẳng từ buffer LVGL.
+#if !LV_COLOR_16_SWAP
+        // Đổi byte tại chỗ sang thứ tự của panel. Ở chế độ dải LVGL vẽ lại toàn
+        // bộ dải trước lần flush sau; ở direct mode buffer được giữ lại nên phải
+        // đổi byte trở lại.
+        swapBytes(pixels, w * h);
+        if (direct) {
+            display->_restorePixels = pixels;
+            display->_restoreCount = w * h;
+        }
+#endif
+        
+        // Giữ transaction mở tới khi DMA xong; LovyanGFX tự chờ DMA trước lệnh kế tiếp
+        display->_tft.startWrite();
+        display->_tft.pushImageDMA(region.x1, region.y1, w, h, (const lgfx::swap565_t *)pixels);
+        display->_pendingFlush = disp;
+#else
+        // Đồng bộ: CPU chờ SPI
         display->_tft.startWrite();
-        display->_tft.setAddrWindow(area->x1, area->y1, w, h);
-        display->_tft.writePixels((uint16_t *)color_p, w * h);
+        display->_tft.setAddrWindow(region.x1, region.y1, w, h);
+        display->_tft.writePixels(pixels, w * h, !LV_COLOR_16_SWAP);
         display->_tft.endWrite();
         
         lv_disp_flush_ready(disp);
+#endif
+    }
+    
+    // LVGL gọi sau mỗi lần vẽ lại với số pixel đã vẽ (tổng diện tích các vùng invalid)
+    static void _lvgl_monitor_cb(lv_disp_drv_t *disp, uint32_t time, uint32_t px) {
+        LVGL_Display *display = (LVGL_Display *)disp->user_data;
+        FrameStats &stats = display->_stats;
+        stats.frames++;
+        stats.lastPixels = px;
+        stats.lastFlushBytes = display->_frameFlushBytes;
+        stats.lastRenderMs = time;
+        stats.totalPixels += px;
+        stats.totalFlushBytes += display->_frameFlushBytes;
+        display->_frameFlushBytes = 0;
+    }
+    
+    // Dải dòng (toàn chiều ngang, liền nhau trong buffer) bao mọi vùng LVGL vừa vẽ lại
+    bool dirtyRows(lv_area_t &rows) const {
+        bool any = false;
+        for (uint16_t i = 0; i < _disp->inv_p; i++) {
+            if (_disp->inv_area_joined[i]) {
+                continue;
+            }
+            const lv_area_t &a = _disp->inv_areas[i];
+            if (!any) {
+                rows = a;
+                any = true;
+            } else {
+                rows.y1 = a.y1 < rows.y1 ? a.y1 : rows.y1;
+                rows.y2 = a.y2 > rows.y2 ? a.y2 : rows.y2;
+            }
+        }
+        rows.x1 = 0;
+        rows.x2 = _screenWidth - 1;
+        return any;
+    }
+    
+#if LVGL_ASYNC_FLUSH    
+    // LVGL gọi khi cần buffer đang truyền (hai buffer đều bận)
+    static void _lvgl_wait_cb(lv_disp_drv_t *disp) {
+        ((LVGL_Display *)disp->user_data)->pollFlush();
+    }
+    
+#if !LV_COLOR_16_SWAP
+    static void swapBytes(uint16_t *pixels, uint32_t count) {
+        // Hai pixel một lần khi buffer căn 4 byte (buffer LVGL luôn như vậy)
+        uint32_t *words = (uint32_t *)pixels;
+        uint32_t pairs = count / 2;
+        for (uint32_t i = 0; i < pairs; i++) {
+            uint32_t v = words[i];
+            words[i] = ((v & 0x00FF00FFu) << 8) | ((v >> 8) & 0x00FF00FFu);
+        }
+        if (count & 1) {
+            uint16_t v = pixels[count - 1];
+            pixels[count - 1] = (uint16_t)((v << 8) | (v >> 8));
+        }
+    }
+#endif
+#endif
+    
+    // Số dòng và số buffer của từng chế độ
+    static uint32_t bufferLines(DrawBufferMode mode) {
+        switch (mode) {
+            case DRAW_BUF_SINGLE_LARGE: return 80;
+            case DRAW_BUF_FULL_FRAME: return _screenHeight;
+            default: return 20;
+        }
+    }
+    
+    static const char *modeName(DrawBufferMode mode) {
+        switch (mode) {
+            case DRAW_BUF_DOUBLE_BAND: return "double 2x20";
+            case DRAW_BUF_SINGLE_LARGE: return "single 1x80";
+            case DRAW_BUF_FULL_FRAME: return "full frame";
+            default: return "auto";
+        }
+    }
+    
+    void freeDrawBuffers() {
+        heap_caps_free(_buf1);
+        heap_caps_free(_buf2);
+        _buf1 = nullptr;
+        _buf2 = nullptr;
+    }
+    
+    bool allocDrawBuffers(DrawBufferMode mode) {
+        size_t bytes = _screenWidth * bufferLines(mode) * sizeof(lv_color_t);
+        _buf1 = (lv_color_t *)heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        if (mode == DRAW_BUF_DOUBLE_BAND) {
+            _buf2 = (lv_color_t *)heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        }
+        if (!_buf1 || (mode == DRAW_BUF_DOUBLE_BAND && !_buf2)) {
+            freeDrawBuffers();
+            return false;
+        }
+        return true;
+    }
+    
+    // Định danh bản build (ELF SHA-256) để chạy lại benchmark sau khi nạp firmware mới
+    static uint64_t buildId() {
+        const esp_app_desc_t *app = esp_ota_get_app_description();
+        uint64_t id = 0;
+        memcpy(&id, app->app_elf_sha256, sizeof(id));
+        return id;
+    }
+    
+    DrawBufferMode loadDrawBufferMode() {
+        if (LVGL_DRAW_BUF_MODE != DRAW_BUF_AUTO) {
+            return (DrawBufferMode)LVGL_DRAW_BUF_MODE;
+        }
+        Preferences prefs;
+        DrawBufferMode mode = DRAW_BUF_DOUBLE_BAND;
+        _needsTuning = true;
+        if (prefs.begin("display", true)) {
+            uint8_t stored = prefs.getUChar("bufMode", DRAW_BUF_AUTO);
+            if (prefs.getULong64("buildId", 0) == buildId() &&
+                stored >= DRAW_BUF_DOUBLE_BAND && stored <= DRAW_BUF_FULL_FRAME) {
+                mode = (DrawBufferMode)stored;
+                _needsTuning = false;
+            }
+            prefs.end();
+        }
+        return mode;
+    }
+    
+    void saveDrawBufferMode(DrawBufferMode mode) {
+        Preferences prefs;
+        if (prefs.begin("display", false)) {
+            prefs.putUChar("bufMode", mode);
+            prefs.putULong64("buildId", buildId());
+            prefs.end();
+        }
+        _needsTuning = false;
+    }
+    
+    // Đo một chế độ trên màn hình đang hiển thị
+    DrawBufferResult benchmarkDrawBuffer(DrawBufferMode mode) {
+        DrawBufferResult r = {};
+        r.mode = mode;
+        if (!setDrawBufferMode(mode)) {
+            return r;
+        }
+        r.freeHeap = ESP.getFreeHeap();
+        r.fits = r.freeHeap >= LVGL_MIN_FREE_HEAP;
+        
+        lv_obj_t *screen = lv_scr_act();
+        
+        // Lần đầu nạp font/ảnh vào cache, không tính
+        lv_obj_invalidate(screen);
+        refreshNow();
+        
+        uint32_t flushes = _flushCount;
+        uint32_t start = micros();
+        for (int i = 0; i < LVGL_BENCH_FRAMES; i++) {
+            lv_obj_invalidate(screen);
+            refreshNow();
+        }
+        r.fullUs = (micros() - start) / LVGL_BENCH_FRAMES;
+        r.flushes = (_flushCount - flushes) / LVGL_BENCH_FRAMES;
+        
+        lv_area_t strip = {0, 90, (lv_coord_t)(_screenWidth - 1), 149};
+        start = micros();
+        for (int i = 0; i < LVGL_BENCH_FRAMES; i++) {
+            lv_inv_area(_disp, &strip);
+            refreshNow();
+        }
+        r.partialUs = (micros() - start) / LVGL_BENCH_FRAMES;
+        return r;
+    }
+    
+    // Vẽ ngay các vùng đang invalid và chờ tới khi đã truyền xong lên panel
+    void refreshNow() {
+        lv_refr_now(_disp);
+        finishFlush();
     }
 
 public:
@@ -56,31 +339,97 @@ public:
         Serial.println("WARNING: LVGL animations are disabled!");
         #endif
         
-        // Cấp phát bộ nhớ cho buffer
-        _buf1 = (lv_color_t *)heap_caps_malloc(_screenWidth * 20 * sizeof(lv_color_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
-        _buf2 = (lv_color_t *)heap_caps_malloc(_screenWidth * 20 * sizeof(lv_color_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
-        
-        if (!_buf1 || !_buf2) {
-            Serial.println("Error allocating display buffer!");
-            return;
-        }
-        
-        // Khởi tạo buffer vẽ
-        lv_disp_draw_buf_init(&_draw_buf, _buf1, _buf2, _screenWidth * 20);
-        
         // Khởi tạo driver display
         lv_disp_drv_init(&_disp_drv);
         _disp_drv.hor_res = _screenWidth;
         _disp_drv.ver_res = _screenHeight;
         _disp_drv.flush_cb = _lvgl_flush_cb;
+        _disp_drv.monitor_cb = _lvgl_monitor_cb;
+#if LVGL_ASYNC_FLUSH
+        _disp_drv.wait_cb = _lvgl_wait_cb;
+#endif
         _disp_drv.draw_buf = &_draw_buf;
         _disp_drv.user_data = this;
-        lv_disp_drv_register(&_disp_drv);
         
-        Serial.println("LVGL Display initialized");
+        // Cấp phát buffer theo chế độ đã chọn (benchmark đã lưu hoặc LVGL_DRAW_BUF_MODE)
+        setDrawBufferMode(loadDrawBufferMode());
+        if (_buf1 == nullptr) {
+            Serial.println("Error allocating display buffer!");
+            return;
+        }
+        _disp = lv_disp_drv_register(&_disp_drv);
+        
+        Serial.printf("LVGL Display initialized (draw buffer: %s)\n", modeName(_bufMode));
     }
     
-    void update() {
+    // Đổi chế độ buffer lúc chạy; nếu không cấp phát được thì quay về 2 x 20 dòng.
+    // Trả về false nếu chế độ yêu cầu không được áp dụng.
+    bool setDrawBufferMode(DrawBufferMode mode) {
+        finishFlush();
+        freeDrawBuffers();
+        
+        bool ok = allocDrawBuffers(mode);
+        if (!ok) {
+            mode = DRAW_BUF_DOUBLE_BAND;
+            if (!allocDrawBuffers(mode)) {
+                return false;
+            }
+        }
+        
+        lv_disp_draw_buf_init(&_draw_buf, _buf1, _buf2, _screenWidth * bufferLines(mode));
+        _disp_drv.direct_mode = mode == DRAW_BUF_FULL_FRAME;
+        _bufMode = mode;
+        if (_disp != nullptr) {
+            lv_disp_drv_update(_disp, &_disp_drv);
+        }
+        return ok;
+    }
+    
+    DrawBufferMode getDrawBufferMode() const { return _bufMode; }
+    
+    // true khi chưa có kết quả benchmark cho bản build này (và không ép chế độ)
+    bool needsDrawBufferTuning() const { return _needsTuning; }
+    
+    // Đo mọi chế độ trên màn hình đang hiển thị, chọn chế độ nhanh nhất còn để
+    // lại ít nhất LVGL_MIN_FREE_HEAP rồi lưu vào NVS. results (nếu có) nhận 3 kết quả.
+    DrawBufferMode tuneDrawBuffers(DrawBufferResult *results = nullptr) {
+        static const DrawBufferMode modes[] = {DRAW_BUF_DOUBLE_BAND, DRAW_BUF_SINGLE_LARGE, DRAW_BUF_FULL_FRAME};
+        DrawBufferMode best = DRAW_BUF_DOUBLE_BAND;
+        uint32_t bestUs = UINT32_MAX;
+        
+        Serial.println("Draw buffer benchmark (full / partial redraw):");
+        for (size_t i = 0; i < sizeof(modes) / sizeof(modes[0]); i++) {
+            DrawBufferResult r = benchmarkDrawBuffer(modes[i]);
+            if (results != nullptr) {
+                results[i] = r;
+            }
+            if (r.fullUs == 0) {
+                Serial.printf("  %-12s does not fit\n", modeName(r.mode));
+                continue;
+            }
+            Serial.printf("  %-12s full %6lu us  partial %6lu us  %2lu flushes  free heap %lu%s\n",
+                          modeName(r.mode), (unsigned long)r.fullUs, (unsigned long)r.partialUs,
+                          (unsigned long)r.flushes, (unsigned long)r.freeHeap, r.fits ? "" : " (too little heap)");
+            // Cập nhật điều hướng chủ yếu là vẽ lại một phần: tính cả hai như nhau
+            uint32_t score = r.fullUs + r.partialUs;
+            if (r.fits && score < bestUs) {
+                best = r.mode;
+                bestUs = score;
+            }
+        }
+        
+        setDrawBufferMode(best);
+        saveDrawBufferMode(best);
+        lv_obj_invalidate(lv_scr_act());
+        Serial.printf("Draw buffer: %s selected\n", modeName(best));
+        return best;
+    }
+    
+    // Bộ lập lịch frame, nơi duy nhất chạy lv_timer_handler() ngoài benchmark.
+    // Có vùng invalid hoặc animation đang chạy: chạy LVGL nhưng không dày hơn
+    // LVGL_FRAME_BUDGET_MS. Không có gì để vẽ: chỉ chạy khi tới hạn timer LVGL
+    // kế tiếp. Trả về số ms có thể nghỉ trước lần gọi sau.
+    uint32_t update() {
         static uint32_t last_tick = 0;
         uint32_t current_tick = millis();
         
@@ -91,11 +440,60 @@ public:
             last_tick = current_tick;
         }
         
-        // Xử lý tasks LVGL
-        lv_timer_handler();
+        // Trả buffer vừa truyền xong trước khi LVGL vẽ tiếp
+        pollFlush();
+        
+        bool dirty = (_disp != nullptr && _disp->inv_p > 0) || lv_anim_count_running() > 0;
+        uint32_t due = dirty ? _lastFrameMs + LVGL_FRAME_BUDGET_MS : _nextTimerMs;
+        if ((int32_t)(current_tick - due) < 0) {
+            return due - current_tick;
+        }
+        if (dirty) {
+            _lastFrameMs = current_tick;
+        }
+        
+        // Xử lý tasks LVGL; kết quả là thời gian tới timer kế tiếp
+        uint32_t wait = lv_timer_handler();
+        _nextTimerMs = current_tick + (wait < 1000 ? wait : 1000);
+        return wait < LVGL_FRAME_BUDGET_MS ? wait : LVGL_FRAME_BUDGET_MS;
+    }
+    
+    // Báo LVGL buffer đã truyền xong nếu DMA không còn bận; trả về true khi
+    // không còn flush nào đang chờ
+    bool pollFlush() {
+        if (_pendingFlush == nullptr) {
+            return true;
+        }
+        if (_tft.dmaBusy()) {
+            return false;
+        }
+        lv_disp_drv_t *disp = _pendingFlush;
+        _pendingFlush = nullptr;
+#if LVGL_ASYNC_FLUSH && !LV_COLOR_16_SWAP
+        if (_restorePixels != nullptr) {
+            swapBytes(_restorePixels, _restoreCount);
+            _restorePixels = nullptr;
+        }
+#endif
+        _tft.endWrite();
+        lv_disp_flush_ready(disp);
+        return true;
+    }
+    
+    // Chờ lần truyền DMA đang dở (trước khi vẽ thẳng lên màn hình bằng LovyanGFX)
+    void finishFlush() {
+        if (_pendingFlush != nullptr) {
+            _tft.waitDMA();
+            pollFlush();
+        }
     }
     
+    const FrameStats &getFrameStats() const { return _stats; }
+    
+    void resetFrameStats() { _stats = FrameStats(); }
+    
     LGFX* getTft() {
+        finishFlush();
         return &_tft;
     }
     
@@ -0,0 +1,218 @@
+#ifndef MARQUEE_LABEL_H
+#define MARQUEE_LABEL_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include "GlyphStrip.h"
+#include "NavigationFields.h"
+
+// Dải dài nhất được raster (px); text dài hơn bị cắt
+#define MARQUEE_MAX_STRIP_WIDTH 1536
+// Khoảng trống giữa hai vòng chữ, tính bằng số dấu cách như LV_LABEL_WAIT_CHAR_COUNT
+#define MARQUEE_WAIT_CHAR_COUNT 3
+
+// Nhãn một dòng chữ chạy vòng thay cho LV_LABEL_LONG_SCROLL_CIRCULAR.
+// Text chỉ được raster một lần vào GlyphStrip khi đổi; mỗi bước animation chỉ
+// dời cửa sổ nhìn trên dải và invalidate vùng của nhãn, khi vẽ thì trộn thẳng
+// độ đậm của dải vào buffer vẽ, không tra glyph hay giải mã font lần nào nữa.
+// Text vừa khung thì đứng yên, không có animation.
+// Dải được cấp một lần trong create() nên đổi text không đụng tới heap; nếu không
+// cấp được thì nhãn dùng lv_label thường (LV_LABEL_LONG_SCROLL_CIRCULAR).
+class MarqueeLabel {
+private:
+    lv_obj_t* _obj = nullptr;
+    const lv_font_t* _font = nullptr;
+    lv_color_t _color;
+    uint16_t _speed = 40; // px/s
+    uint16_t _stripWidth = MARQUEE_MAX_STRIP_WIDTH; // text dài hơn bị cắt
+    GlyphStrip _strip;
+    lv_obj_t* _fallback = nullptr; // lv_label dự phòng khi không raster được dải
+    NavDirectionsText _text;
+    uint16_t _period = 0; // chu kỳ cuộn = bước bút của text + khoảng trống; 0: không cuộn
+    uint16_t _offset = 0; // cột của dải ở mép trái nhãn
+
+    static void animCb(void* var, int32_t value) {
+        MarqueeLabel* self = (MarqueeLabel*)var;
+        uint16_t offset = self->_period > 0 ? (uint16_t)(value % self->_period) : 0;
+        if (offset != self->_offset) {
+            self->_offset = offset;
+            lv_obj_invalidate(self->_obj);
+        }
+    }
+
+    static void drawEvent(lv_event_t* e) {
+        MarqueeLabel* self = (MarqueeLabel*)lv_event_get_user_data(e);
+        self->draw(lv_event_get_draw_ctx(e));
+    }
+
+    void draw(lv_draw_ctx_t* ctx) {
+        if (!_strip.ready()) {
+            return;
+        }
+        lv_area_t coords;
+        lv_obj_get_coords(_obj, &coords);
+        coords.y2 = LV_MIN(coords.y2, coords.y1 + _strip.height() - 1);
+        lv_area_t part;
+        if (!_lv_area_intersect(&part, &coords, ctx->clip_area)) {
+            return;
+        }
+
+        const lv_area_t* buf = ctx->buf_area;
+        lv_coord_t bufWidth = lv_area_get_width(buf);
+        uint32_t startX = _offset + (part.x1 - coords.x1);
+        if (_period > 0) {
+            startX %= _period;
+        }
+        lv_color_t color = _color;
+        auto plot = [color](lv_color_t& px, uint8_t alpha) {
+            px = alpha == 15 ? color : lv_color_mix(color, px, alpha * 17);
+        };
+        for (lv_coord_t y = part.y1; y <= part.y2; y++) {
+            lv_color_t* dst = (lv_color_t*)ctx->buf + (y - buf->y1) * bufWidth + (part.x1 - buf->x1);
+            uint32_t sx = startX;
+            uint32_t remaining = lv_area_get_width(&part);
+            // Cửa sổ đi qua tối đa: phần dải, khoảng trống, phần dải của vòng sau
+            while (remaining > 0) {
+                uint32_t n;
+                if (sx < _strip.width()) {
+                    n = LV_MIN(remaining, _strip.width() - sx);
+                    _strip.blendRow(y - coords.y1, sx, n, dst, plot);
+                } else {
+                    n = _period > 0 ? LV_MIN(remaining, _period - sx) : remaining;
+                }
+                dst += n;
+                remaining -= n;
+                sx += n;
+                if (sx == _period) {
+                    sx = 0;
+                }
+            }
+        }
+    }
+
+    void startScroll() {
+        lv_anim_del(this, animCb);
+        _offset = 0;
+        if (_period == 0 || _obj == nullptr || lv_obj_has_flag(_obj, LV_OBJ_FLAG_HIDDEN)) {
+            return;
+        }
+        lv_anim_t a;
+        lv_anim_init(&a);
+        lv_anim_set_var(&a, this);
+        lv_anim_set_exec_cb(&a, animCb);
+        lv_anim_set_values(&a, 0, _period);
+        lv_anim_set_time(&a, lv_anim_speed_to_time(_speed, 0, _period));
+        lv_anim_set_repeat_count(&a, LV_ANIM_REPEAT_INFINITE);
+        lv_anim_start(&a);
+    }
+
+    // Hiện _text bằng lv_label thường (on) hoặc ẩn nhãn dự phòng
+    void showFallback(bool on) {
+        if (!on) {
+            if (_fallback != nullptr) {
+                lv_label_set_text_static(_fallback, "");
+                lv_obj_add_flag(_fallback, LV_OBJ_FLAG_HIDDEN);
+            }
+            return;
+        }
+        if (_fallback == nullptr) {
+            _fallback = lv_label_create(_obj);
+            lv_obj_set_width(_fallback, lv_obj_get_width(_obj));
+            lv_obj_set_style_text_font(_fallback, _font, LV_PART_MAIN);
+            lv_obj_set_style_text_color(_fallback, _color, LV_PART_MAIN);
+            lv_obj_set_style_anim_speed(_fallback, _speed, LV_PART_MAIN);
+            lv_label_set_long_mode(_fallback, LV_LABEL_LONG_SCROLL_CIRCULAR);
+        }
+        lv_obj_clear_flag(_fallback, LV_OBJ_FLAG_HIDDEN);
+        lv_label_set_text_static(_fallback, _text.c_str());
+    }
+
+public:
+    ~MarqueeLabel() {
+        lv_anim_del(this, animCb);
+    }
+
+    // Tạo nhãn rộng width px, cao bằng line_height của font, chữ chạy speed px/s.
+    // stripWidth: độ rộng dải cấp sẵn (text dài hơn bị cắt); 0 thì dải được cấp vừa
+    // đủ ở lần setText() đầu tiên, dành cho nhãn có text cố định.
+    void create(lv_obj_t* parent, const lv_font_t* font, lv_color_t color, lv_coord_t width, uint16_t speed,
+                uint16_t stripWidth = MARQUEE_MAX_STRIP_WIDTH) {
+        _font = font;
+        _color = color;
+        _speed = speed;
+        _obj = lv_obj_create(parent);
+        lv_obj_remove_style_all(_obj);
+        lv_obj_clear_flag(_obj, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
+        lv_obj_set_size(_obj, width, font->line_height);
+        lv_obj_add_event_cb(_obj, drawEvent, LV_EVENT_DRAW_MAIN, this);
+        _fallback = nullptr;
+        _text = "";
+        _strip.clear();
+        _period = 0;
+        _offset = 0;
+        // Cấp dải ngay khi tạo màn hình, trước khi chọn chế độ buffer vẽ theo heap còn lại.
+        // Không cấp được thì setText() thử lại và dùng lv_label nếu vẫn thiếu.
+        _stripWidth = stripWidth > 0 ? stripWidth : MARQUEE_MAX_STRIP_WIDTH;
+        if (stripWidth > 0) {
+            _strip.reserve(stripWidth, font->line_height);
+        }
+    }
+
+    // Nhãn bị xóa cùng cha (lv_obj_clean màn hình): dừng animation, bỏ nội dung dải
+    // nhưng giữ buffer cho lần create() sau
+    void detach() {
+        lv_anim_del(this, animCb);
+        _obj = nullptr;
+        _fallback = nullptr;
+        _text = "";
+        _strip.clear();
+        _period = 0;
+    }
+
+    lv_obj_t* obj() const {
+        return _obj;
+    }
+
+    const char* getText() const {
+        return _text.c_str();
+    }
+
+    // Đổi text: raster lại dải và cho chạy lại từ đầu. Text không đổi thì không
+    // làm gì và trả về false.
+    bool setText(const char* text) {
+        if (_obj == nullptr || _text == text) {
+            return false;
+        }
+        _text = text;
+        _period = 0;
+        bool built = _strip.build(_font, _text.c_str(), _stripWidth);
+        if (built && _strip.width() > lv_obj_get_width(_obj)) {
+            lv_font_glyph_dsc_t space;
+            uint16_t gap = lv_font_get_glyph_dsc(_font, &space, ' ', ' ') ? space.adv_w : 0;
+            _period = _strip.advance() + gap * MARQUEE_WAIT_CHAR_COUNT;
+        }
+        // Không raster được (hết heap) thì hướng dẫn rẽ vẫn phải hiện
+        showFallback(!built && !_text.isEmpty());
+        lv_obj_invalidate(_obj);
+        startScroll();
+        return true;
+    }
+
+    // Ẩn/hiện nhãn; khi hiện lại chữ chạy lại từ đầu, khi ẩn animation dừng hẳn để
+    // bộ lập lịch frame không phải thức dậy vì nó. Trả về true nếu trạng thái đổi.
+    bool show(bool visible) {
+        if (_obj == nullptr || lv_obj_has_flag(_obj, LV_OBJ_FLAG_HIDDEN) != visible) {
+            return false;
+        }
+        if (visible) {
+            lv_obj_clear_flag(_obj, LV_OBJ_FLAG_HIDDEN);
+            startScroll();
+        } else {
+            lv_obj_add_flag(_obj, LV_OBJ_FLAG_HIDDEN);
+            lv_anim_del(this, animCb);
+        }
+        return true;
+    }
+};
+
+#endif // MARQUEE_LABEL_H
@@ -8,6 +8,7 @@
 #include "BLEStatusOverlay.h"
 #include "ChronosTypes.h"
 #include "ChronosManager.h" // Thêm ChronosManager để quản lý kết nối BLE
+#include "EventBus.h"
 #include "ESP32Time.h"
 
 // ===== NAVIGATION MODE =====
@@ -21,7 +22,6 @@ enum class NavigationMode {
 class NavigationManagerLVGL {
 private:
   NavigationMode _navMode = NavigationMode::NAV_DISABLED;
-  unsigned long _lastUpdateTime = 0;
   bool _needRedraw = false;
   bool _alertActive = false;
   unsigned long _alertStartTime = 0;
@@ -29,30 +29,59 @@ private:
   LVGL_Display* _display = nullptr;
   ESP32Time* _time = nullptr;
   
-  // Dữ liệu chỉ đường đã lưu để so sánh thay đổi
-  AppNavigation _navData;
+  // Các trường NAV_FIELD_* nhận qua bus sự kiện, chưa vẽ; trạng thái active
+  // đã vẽ. Dữ liệu được đọc thẳng từ ChronosManager, không giữ bản sao
+  NavFieldMask _pendingChanges = 0;
+  bool _wasActive = false;
   
   // Đối tượng NavigationScreenLVGL
   NavigationScreenLVGL* _navScreen = nullptr;
   
+  static void eventHandler(const Event& event, void* context) {
+    static_cast<NavigationManagerLVGL*>(context)->onEvent(event);
+  }
+  
+  void onEvent(const Event& event) {
+    switch (event.id) {
+      case EV_CONNECTED:
+        // Mới kết nối, tự động chuyển sang chế độ FULLSCREEN
+        _navMode = NavigationMode::FULLSCREEN;
+        _needRedraw = true;
+        Serial.println("BLE connected - Switching to FULLSCREEN navigation mode");
+        break;
+        
+      case EV_DISCONNECTED:
+        // Mới ngắt kết nối, tự động tắt chế độ điều hướng
+        _navMode = NavigationMode::NAV_DISABLED;
+        _needRedraw = false; // Không cần vẽ lại màn hình navigation
+        Serial.println("BLE disconnected - Navigation mode DISABLED");
+        
+        // Khi ngắt kết nối, đảm bảo màn hình navigation không hiển thị
+        if (_navScreen && _navScreen->isScreenReady()) {
+          // Không gọi display() ở đây để tránh hiển thị màn hình navigation
+          _navScreen->create(); // Tạo lại screen (sẽ ẩn các thành phần)
+        }
+        break;
+        
+      case EV_NAV_FIELDS_CHANGED:
+        _pendingChanges |= (NavFieldMask)event.value;
+        break;
+        
+      case EV_NAV_ICON_READY:
+        _pendingChanges |= NAV_FIELD_ICON;
+        break;
+        
+      default:
+        break;
+    }
+  }
+  
 public:
   // Cho phép truy cập Chronos từ bên ngoài (để khởi động lại quảng cáo)
   ChronosManager& getChronos() { return ChronosManager::getInstance(); }
 
 public:
   NavigationManagerLVGL() {
-    // Initialize navigation data with default values
-    _navData.active = false;
-    _navData.eta = "";
-    _navData.title = "";
-    _navData.duration = "";
-    _navData.distance = "";
-    _navData.speed = "";
-    _navData.directions = "";
-    _navData.hasIcon = false;
-    _navData.isNavigation = false;
-    _navData.iconCRC = 0xFFFFFFFF;
-    
     // Khởi tạo ESP32Time
     _time = new ESP32Time();
   }
@@ -80,6 +109,11 @@ public:
     if (Config::NAVIGATION_ENABLED) {
       ChronosManager::getInstance().init(display->getTft());
       
+      // Nhận sự kiện kết nối và dữ liệu điều hướng thay vì thăm dò định kỳ
+      EventBus::getInstance().subscribe(eventBit(EV_CONNECTED) | eventBit(EV_DISCONNECTED) |
+                                        eventBit(EV_NAV_FIELDS_CHANGED) | eventBit(EV_NAV_ICON_READY),
+                                        eventHandler, this);
+      
       Serial.println("Navigation Manager initialized with LVGL");
       
       // Bắt đầu ở chế độ nền
@@ -87,46 +121,24 @@ public:
     }
   }
   
-  void update() {
-    // Cập nhật LVGL display
-    if (_display) {
-      _display->update();
+  // Chọn chế độ buffer vẽ bằng cách đo trên chính màn hình điều hướng; chỉ
+  // chạy khi bản build này chưa có kết quả lưu trong NVS
+  void tuneDisplay() {
+    if (!_display || !_navScreen || !_display->needsDrawBufferTuning()) {
+      return;
     }
-    
-    // Cập nhật Chronos Manager
-    ChronosManager::getInstance().update();
-    
-    // Kiểm tra trạng thái kết nối BLE
-    static bool lastConnectedState = false;
-    bool currentConnectedState = ChronosManager::getInstance().isConnected();
-    
-    // Nếu trạng thái kết nối thay đổi
-    if (lastConnectedState != currentConnectedState) {
-      lastConnectedState = currentConnectedState;
-      
-      // Nếu mới kết nối, tự động chuyển sang chế độ FULLSCREEN
-      if (currentConnectedState) {
-        _navMode = NavigationMode::FULLSCREEN;
-        _needRedraw = true;
-        Serial.println("BLE connected - Switching to FULLSCREEN navigation mode");
-      } 
-      // Nếu mới ngắt kết nối, tự động tắt chế độ điều hướng
-      else {
-        _navMode = NavigationMode::NAV_DISABLED;
-        _needRedraw = false; // Không cần vẽ lại màn hình navigation
-        Serial.println("BLE disconnected - Navigation mode DISABLED");
-        
-        // Khi ngắt kết nối, đảm bảo màn hình navigation không hiển thị
-        if (_navScreen && _navScreen->isScreenReady()) {
-          // Không gọi display() ở đây để tránh hiển thị màn hình navigation
-          _navScreen->create(); // Tạo lại screen (sẽ ẩn các thành phần)
-        }
-        
-        // Ngay lập tức thoát khỏi hàm update để không cập nhật màn hình navigation nữa
-        return;
-      }
+    lv_obj_t* previous = lv_scr_act();
+    _navScreen->display();
+    _display->tuneDrawBuffers();
+    if (previous != lv_scr_act()) {
+      lv_scr_load(previous);
     }
-    
+  }
+  
+  // Gọi sau ChronosManager::update() và EventBus::dispatch() trong loop:
+  // thay đổi kết nối và dữ liệu điều hướng đã được giao qua onEvent()
+  // Chỉ cập nhật widget; LVGL_Display::update() trong loop vẽ khi có vùng thay đổi
+  void update() {
     // Nếu không kết nối hoặc đã tắt chế độ điều hướng, không xử lý tiếp
     if (_navMode == NavigationMode::NAV_DISABLED || !ChronosManager::getInstance().isConnected()) {
       return;
@@ -135,84 +147,70 @@ public:
     // Cập nhật thời gian
     unsigned long currentTime = millis();
     
-    // Nếu đang ở chế độ FULLSCREEN, đảm bảo màn hình luôn được hiển thị
+    // Ở chế độ FULLSCREEN: nạp màn hình nếu chưa hiển thị và cập nhật đồng hồ.
+    // display() không tự vẽ; chỉ nhãn giờ invalidate khi sang phút mới
     static unsigned long lastRefreshTime = 0;
     if (_navMode == NavigationMode::FULLSCREEN && currentTime - lastRefreshTime >= 500) {
       lastRefreshTime = currentTime;
       
-      // Đảm bảo screen luôn được hiển thị mỗi 500ms kể cả không có dữ liệu mới
       if (_navScreen && _navScreen->isScreenReady()) {
         _navScreen->display();
       }
     }
     
-    // Kiểm tra thông tin chỉ đường mới (chỉ mỗi 1 giây)
-    if (currentTime - _lastUpdateTime >= Config::NAV_UPDATE_INTERVAL) {
-      _lastUpdateTime = currentTime;
-      
-      // Lấy dữ liệu navigation hiện tại
-      AppNavigation navData = ChronosManager::getInstance().getNavData();
-      
-      // Kiểm tra nếu navigation chuyển từ active sang inactive
-      bool wasActive = _navData.active && _navData.isNavigation;
-      bool isActive = navData.active && navData.isNavigation;
+    // Cập nhật trạng thái cảnh báo
+    if (_alertActive && currentTime - _alertStartTime >= ALERT_DURATION) {
+      _alertActive = false;
+    }
+    
+    // Vẽ ngay trong vòng loop nhận được sự kiện; không có gì mới thì không chạm vào UI
+    if (_pendingChanges == 0 && !_needRedraw) {
+      return;
+    }
+    ChronosManager& chronos = ChronosManager::getInstance();
+    
+    // Các trường đã thay đổi do parser đánh dấu (không cần so sánh chuỗi)
+    NavFieldMask changes = _pendingChanges;
+    _pendingChanges = 0;
+    
+    // Tham chiếu tới ảnh chụp hiện tại, không sao chép
+    const AppNavigation& navData = chronos.getNavData();
+    
+    // Kiểm tra nếu navigation chuyển từ active sang inactive
+    bool wasActive = _wasActive;
+    bool isActive = navData.active && navData.isNavigation;
 
-      // Nếu chuyển từ active -> inactive, cần thiết lập lại UI
-      if (wasActive && !isActive) {
-        Serial.println("Navigation changed from active to inactive, updating UI");
-        _needRedraw = true;
-        // Cập nhật dữ liệu và vẽ lại màn hình
-        if (_navMode == NavigationMode::FULLSCREEN && _navScreen && _navScreen->isScreenReady()) {
-          // Đảm bảo UI được cập nhật đúng
-          _navScreen->updateNavigation(navData);
-         
-          drawFullscreenNavigation(navData);
-        }
+    // Nếu chuyển từ active -> inactive, cần thiết lập lại UI
+    if (wasActive && !isActive) {
+      Serial.println("Navigation changed from active to inactive, updating UI");
+      // Cập nhật dữ liệu và vẽ lại màn hình
+      if (_navMode == NavigationMode::FULLSCREEN && _navScreen && _navScreen->isScreenReady()) {
+        drawFullscreenNavigation(navData, changes | NAV_FIELD_STATE);
+      }
+      _wasActive = false;
+      _needRedraw = false;
+    }
+    
+    if (ChronosManager::getInstance().isNavigating()) {
+      // Cảnh báo rẽ khi distance vừa đổi; distanceMeters đã được parser đổi ra mét
+      int32_t distance = navData.distanceMeters;
+      if ((changes & NAV_FIELD_DISTANCE) && distance >= 0 && distance <= Config::NAV_ALERT_DISTANCE &&
+          !_alertActive && navData.active) {
+        _alertActive = true;
+        _alertStartTime = currentTime;
+        Serial.printf("Navigation alert! Distance: %dm, Direction: %s\n", 
+                    (int)distance, navData.directions.c_str());
       }
       
-      if (ChronosManager::getInstance().isNavigating()) {
-        // Kiểm tra nếu có thay đổi từ dữ liệu trước đó
-        bool dataChanged = (_navData.active != navData.active) || 
-                          (_navData.title != navData.title) ||
-                          (_navData.directions != navData.directions) ||
-                          (_navData.distance != navData.distance);
-        
-        // Kiểm tra nếu cần hiển thị cảnh báo rẽ
-        float distance = 0;
-        bool validDistance = false;
-        
-        // Kiểm tra định dạng distance hợp lệ
-        if (navData.distance.length() > 0) {
-          char firstChar = navData.distance.charAt(0);
-          if (isDigit(firstChar) || firstChar == '.') {
-            distance = navData.distance.toFloat();
-            validDistance = true;
-          }
-        }
-        
-        if (validDistance && distance <= Config::NAV_ALERT_DISTANCE && !_alertActive && navData.active) {
-          _alertActive = true;
-          _alertStartTime = currentTime;
-          _needRedraw = true;
-          Serial.printf("Navigation alert! Distance: %.1fm, Direction: %s\n", 
-                      distance, navData.directions.c_str());
-        }
-        
-        // Cập nhật trạng thái cảnh báo
-        if (_alertActive && currentTime - _alertStartTime >= ALERT_DURATION) {
-          _alertActive = false;
+      // Chỉ cập nhật các widget có trường thay đổi; _needRedraw (đổi chế độ,
+      // kết nối lại) thì vẽ lại toàn bộ
+      if (changes != 0 || _needRedraw) {
+        if (_navMode == NavigationMode::FULLSCREEN) {
+          drawFullscreenNavigation(navData, _needRedraw ? NAV_FIELD_ALL : changes);
         }
         
-        // Chỉ cập nhật màn hình khi có thay đổi dữ liệu hoặc cần cảnh báo
-        if (dataChanged || _needRedraw) {
-          if (_navMode == NavigationMode::FULLSCREEN) {
-            drawFullscreenNavigation(navData);
-          }
-          
-          // Lưu dữ liệu mới nhất
-          _navData = navData;
-          _needRedraw = false;
-        }
+        _wasActive = isActive;
+        _needRedraw = false;
       }
     }
   }
@@ -252,20 +250,20 @@ public:
     return _navMode;
   }
   
-  // Lấy dữ liệu điều hướng hiện tại
-  AppNavigation getNavData() {
+  // Lấy dữ liệu điều hướng hiện tại (tham chiếu tới ảnh chụp của ChronosManager)
+  const AppNavigation& getNavData() {
     return ChronosManager::getInstance().getNavData();
   }
   
   // Cập nhật dữ liệu điều hướng
   void updateNavData(const AppNavigation& navData) {
     // Kiểm tra nếu navigation chuyển từ active sang inactive
-    bool wasActive = _navData.active && _navData.isNavigation;
+    bool wasActive = _wasActive;
     bool isActive = navData.active && navData.isNavigation;
     
     // Nếu thay đổi trạng thái active hoặc dữ liệu đang active, cần vẽ lại
     if (wasActive != isActive || isActive) {
-      _navData = navData;
+      _wasActive = isActive;
       _needRedraw = true;
       
       // Ghi log khi trạng thái navigation thay đổi
@@ -277,23 +275,21 @@ public:
       
       // Vẽ lại màn hình ngay lập tức nếu đang ở chế độ FULLSCREEN
       if (_navMode == NavigationMode::FULLSCREEN && _navScreen && _navScreen->isScreenReady()) {
-        drawFullscreenNavigation(navData);
+        drawFullscreenNavigation(navData, NAV_FIELD_ALL);
       }
     }
   }
   
-  // Hiển thị điều hướng toàn màn hình sử dụng NavigationScreenLVGL
-  void drawFullscreenNavigation(const AppNavigation& navData) {
+  // Hiển thị điều hướng toàn màn hình sử dụng NavigationScreenLVGL,
+  // changes là các trường NAV_FIELD_* cần cập nhật trên màn hình
+  void drawFullscreenNavigation(const AppNavigation& navData, NavFieldMask changes) {
     if (!_navScreen) {
       Serial.println("Cannot display navigation: _navScreen is null");
       return;
     }
     
     // Cập nhật dữ liệu điều hướng cho NavigationScreen
-    _navScreen->updateNavigation(navData);
-    
-    // Xác định trạng thái active của navigation
-    bool isActive = navData.active && navData.isNavigation;
+    _navScreen->updateNavigation(navData, changes);
     
     // Xác minh screen đã được tạo
     if (_navScreen->isScreenReady()) {
@@ -301,10 +297,10 @@ public:
       if (ChronosManager::getInstance().isConnected() && _navMode != NavigationMode::NAV_DISABLED) {
         _navScreen->display();
         
-        _navScreen->updateUIBasedOnNavigationState();
-        
-        // Đảm bảo LVGL được cập nhật ngay lập tức
-        LVGL_Display::getInstance().update();
+        // Ẩn/hiện widget chỉ khi trạng thái active thay đổi
+        if (changes & NAV_FIELD_STATE) {
+          _navScreen->updateUIBasedOnNavigationState();
+        }
       }
     } else {
       Serial.println("ERROR: Navigation screen not ready, recreating...");
@@ -314,13 +310,11 @@ public:
         // Chỉ hiển thị khi kết nối và không ở chế độ NAV_DISABLED
         if (ChronosManager::getInstance().isConnected() && _navMode != NavigationMode::NAV_DISABLED) {
           _navScreen->display();
-          LVGL_Display::getInstance().update();
         }
       }
     }
     
-    // Lưu dữ liệu mới nhất
-    _navData = navData;
+    _wasActive = navData.active && navData.isNavigation;
   }
   
   static NavigationManagerLVGL& getInstance() {
@@ -5,118 +5,112 @@
 #include <lvgl.h>
 #include "LVGL_Config.h"
 #include "VietnameseFonts.h"
+#include "DistanceReadout.h"
+#include "MarqueeLabel.h"
 #include "ChronosTypes.h"
 #include "ChronosManager.h"
 #include "ESP32Time.h"
 #include "bg.h" // Thêm include để sử dụng hình nền
+#include "BinLog.h"
 
 // Kích thước dữ liệu biểu tượng chỉ đường từ Chronos app
 #define ICON_DATA_SIZE 288 // 48x48 pixels, 1 bit mỗi pixel = 48*48/8 = 288 bytes
 
-// Hàm chuyển đổi bitmap 1-bit sang RGB565
-void convert1BitBitmapToRgb565(void* dst, const void* src, uint16_t width, uint16_t height, uint16_t color, uint16_t bgColor, bool invert = false) {
-    uint16_t* d      = (uint16_t*)dst;
-    const uint8_t* s = (const uint8_t*)src;
-
-    auto activeColor   = invert ? bgColor : color;
-    auto inactiveColor = invert ? color : bgColor;
-
-    for (uint16_t y = 0; y < height; y++) {
-        for (uint16_t x = 0; x < width; x++) {
-            if (s[(y * width + x) / 8] & (1 << (7 - x % 8))) {
-                d[y * width + x] = activeColor;
-            } else {
-                d[y * width + x] = inactiveColor;
-            }
-        }
-    }
-}
-
 // Lớp hiển thị màn hình điều hướng sử dụng LVGL
 class NavigationScreenLVGL {
 private:
     lv_obj_t* _screen = nullptr;
     lv_obj_t* _navIcon = nullptr;
-    lv_obj_t* _directionLabel = nullptr;
+    MarqueeLabel _directionLabel;        // Chữ chạy: raster một lần, mỗi frame chỉ dời cửa sổ
     lv_obj_t* _distanceLabel = nullptr;
     lv_obj_t* _titleLabel = nullptr;     // Thay _etaLabel bằng _titleLabel
     lv_obj_t* _timeLabel = nullptr;
     lv_obj_t* _speedLabel = nullptr;     // Thêm label hiển thị tốc độ
     lv_obj_t* _durationLabel = nullptr;  // Thêm label hiển thị thời gian hành trình
     lv_obj_t* _bgImage = nullptr; // Thêm đối tượng cho hình nền
-    lv_obj_t* _defaultMessageLabel = nullptr; // Label hiển thị "Start navigation on Google maps" khi không active
+    MarqueeLabel _defaultMessageLabel; // Label hiển thị "Start navigation on Google maps" khi không active
     lv_obj_t* _distanceContainer = nullptr; // Container cho distance với nền màu vàng
+    DistanceReadout _distanceReadout; // Số khoảng cách ghép từ sprite, _distanceLabel là dự phòng
     
     // Biểu tượng điều hướng
     lv_img_dsc_t _navIconDesc = {};
-    uint8_t* _iconData = nullptr;
-    uint8_t _iconBuffer[ICON_DATA_SIZE]; // Buffer để lưu trữ bản sao của dữ liệu icon
+    const uint8_t* _iconData = nullptr; // bitmap 1-bit trong ảnh chụp điều hướng
     bool _hasValidIcon = false;
     uint32_t _iconCRC = 0;
     
-    // Dữ liệu điều hướng
-    AppNavigation _navData;
+    // Dữ liệu điều hướng: trỏ tới ảnh chụp của ChronosManager, không giữ bản sao
+    const AppNavigation* _navData;
+    // Trạng thái active đang hiển thị, để phát hiện chuyển trạng thái
+    bool _shownActive = false;
     
-    // Vẽ trực tiếp bitmap 1-bit bằng API của LVGL
-    void drawNavIconDirectly() {
-        if (!_hasValidIcon || _iconData == nullptr || _screen == nullptr) {
-        //
-            return;
+    // Phút đang hiển thị trên _timeLabel (-1: chưa vẽ)
+    int _shownMinute = -1;
+    
+    // lv_label_set_text() luôn invalidate nhãn kể cả khi text không đổi: so sánh trước.
+    // Trả về true nếu text đã được thay.
+    static bool setLabelText(lv_obj_t* label, const char* text) {
+        if (label == nullptr || strcmp(lv_label_get_text(label), text) == 0) {
+            return false;
         }
-        
-        // Xóa icon cũ nếu có
-        if (_navIcon != nullptr) {
-            lv_obj_del(_navIcon);
-            _navIcon = nullptr;
+        lv_label_set_text(label, text);
+        return true;
+    }
+    
+    // lv_obj_add_flag/clear_flag(HIDDEN) luôn invalidate: chỉ đổi khi trạng thái khác.
+    // Trả về true nếu widget vừa đổi trạng thái hiển thị.
+    static bool setVisible(lv_obj_t* obj, bool visible) {
+        if (obj == nullptr || lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN) != visible) {
+            return false;
         }
-        
-        // Xóa bộ nhớ dành cho descriptor cũ nếu có
-        if (_navIconDesc.data != nullptr && _navIconDesc.data != _iconData) {
-            _navIconDesc.data = nullptr;
+        if (visible) {
+            lv_obj_clear_flag(obj, LV_OBJ_FLAG_HIDDEN);
+        } else {
+            lv_obj_add_flag(obj, LV_OBJ_FLAG_HIDDEN);
+        }
+        return true;
+    }
+    
+    // Hiển thị khoảng cách bằng sprite của _distanceReadout (chỉ ô đổi bị vẽ lại);
+    // text có ký tự ngoài atlas thì dùng _distanceLabel với font thường
+    void showDistance(const char* text) {
+        bool sprite = _distanceReadout.setText(text);
+        if (!sprite) {
+            setLabelText(_distanceLabel, text);
+        }
+        setVisible(_distanceReadout.obj(), sprite);
+        setVisible(_distanceLabel, !sprite);
+    }
+    
+    // Icon được vẽ thẳng từ bitmap 1-bit trong ảnh chụp điều hướng (LV_IMG_CF_ALPHA_1BIT:
+    // bit 1 tô màu img_recolor, bit 0 để lộ nền đen của widget), không mở rộng ra RGB565.
+    // Widget được tạo một lần trong createContent(); đổi icon chỉ đổi nguồn ảnh.
+    void drawNavIconDirectly() {
+        if (!_hasValidIcon || _iconData == nullptr || _navIcon == nullptr) {
+            return;
         }
         
-        // Tạo mảng pixel mới ở định dạng TRUE_COLOR
-        static lv_color_t pixels[48 * 48];
-        
-        // Sử dụng hàm convert1BitBitmapToRgb565 để chuyển đổi bitmap
-        // Màu đỏ cho bit 1, màu xanh dương cho bit 0 - dễ debug
-        uint16_t activeColor = 0xFFFF;   // Trắng
-        uint16_t bgColor = 0x0000;       // Đen
-        
-        // Chuyển đổi bitmap 1-bit sang RGB565 sử dụng hàm mới
-        convert1BitBitmapToRgb565(pixels, _iconData, 48, 48, activeColor, bgColor, false);
-
-        // Tạo descriptor từ dữ liệu pixel TRUE_COLOR
-        _navIconDesc.header.cf = LV_IMG_CF_TRUE_COLOR;
+        _navIconDesc.header.cf = LV_IMG_CF_ALPHA_1BIT;
         _navIconDesc.header.always_zero = 0;
         _navIconDesc.header.reserved = 0;
         _navIconDesc.header.w = 48;
         _navIconDesc.header.h = 48;
-        _navIconDesc.data_size = 48 * 48 * sizeof(lv_color_t);
-        _navIconDesc.data = (const uint8_t*)pixels;
-        
-        // Tạo đối tượng hình ảnh
-        _navIcon = lv_img_create(_screen);
+        _navIconDesc.data_size = ICON_DATA_SIZE;
+        _navIconDesc.data = _iconData;
         
-        // Áp dụng nguồn hình ảnh
+        // Cùng descriptor nhưng dữ liệu mới: bỏ bản cache của LVGL rồi đặt lại nguồn
+        // (lv_img_set_src invalidate vùng 48x48 của icon)
+        lv_img_cache_invalidate_src(&_navIconDesc);
         lv_img_set_src(_navIcon, &_navIconDesc);
-        
-        // Thêm hiệu ứng thu phóng để làm nổi bật icon
-        lv_img_set_zoom(_navIcon, 256); // 256 = 100% (không thu phóng)
-
-        // Căn lề trái, cách mép trên 50 pixel
-        lv_obj_align(_navIcon, LV_ALIGN_TOP_LEFT, 5, 40);
+        setVisible(_navIcon, _shownActive);
     }
 
 public:
-    NavigationScreenLVGL() : _iconData(_iconBuffer), _hasValidIcon(false), _iconCRC(0) {
-        // Khởi tạo buffer icon với giá trị 0
-        memset(_iconBuffer, 0, ICON_DATA_SIZE);
+    NavigationScreenLVGL() : _hasValidIcon(false), _iconCRC(0),
+                             _navData(&ChronosManager::getInstance().getNavData()) {
     }
     
     ~NavigationScreenLVGL() {
-        // Không giải phóng bộ nhớ static hoặc con trỏ trực tiếp
-        // LVGL sử dụng con trỏ tới dữ liệu pixels trong static buffer
+        // Descriptor trỏ vào ảnh chụp của ChronosManager, không sở hữu dữ liệu
         _navIconDesc.data = nullptr;
         
         // Xóa đối tượng LVGL nếu còn tồn tại
@@ -131,10 +125,10 @@ public:
         return _screen != nullptr;
     }
     
-    // Cập nhật dữ liệu điều hướng
-    void updateNavigation(const AppNavigation &navData) {
+    // Cập nhật dữ liệu điều hướng; chỉ các widget có bit trong changes (NAV_FIELD_*) được đụng tới
+    void updateNavigation(const AppNavigation &navData, NavFieldMask changes = NAV_FIELD_ALL) {
         // Kiểm tra trạng thái active trước khi cập nhật
-        bool wasActive = _navData.active && _navData.isNavigation;
+        bool wasActive = _shownActive;
         bool willBeActive = navData.active && navData.isNavigation;
         
         // Log trạng thái thay đổi
@@ -148,9 +142,9 @@ public:
                 Serial.println("Resetting navigation UI state completely");
                 
                 // Reset content của các label
-                if (_directionLabel) lv_label_set_text(_directionLabel, "");
-                if (_distanceLabel) lv_label_set_text(_distanceLabel, "0 km");
-                if (_speedLabel) lv_label_set_text(_speedLabel, "");
+                _directionLabel.setText("");
+                showDistance("0 km");
+                setLabelText(_speedLabel, "");
             }
             
             // Nếu chuyển từ inactive sang active, đảm bảo distance container có kích thước phù hợp
@@ -158,72 +152,49 @@ public:
                 Serial.println("Switching from inactive to active - ensuring container sizes");
                 
                 // Đảm bảo container được hiển thị trước khi cập nhật kích thước
-                lv_obj_clear_flag(_distanceContainer, LV_OBJ_FLAG_HIDDEN);
-                lv_obj_clear_flag(_distanceLabel, LV_OBJ_FLAG_HIDDEN);
+                setVisible(_distanceContainer, true);
                 
                 // Đặt lại kích thước container theo nội dung
                 lv_obj_set_width(_distanceContainer, LV_SIZE_CONTENT);
                 lv_obj_update_layout(_distanceContainer);
                 lv_obj_center(_distanceLabel);
                 
-                if(lv_obj_has_flag(_directionLabel, LV_OBJ_FLAG_HIDDEN))
-                {
-                    lv_obj_clear_flag(_directionLabel, LV_OBJ_FLAG_HIDDEN);
-                    // Reset vị trí cuộn text để bắt đầu chạy từ đầu
-                    // Đặt lại text để bắt đầu hiệu ứng scroll từ đầu
-                    const String currentText = String(lv_label_get_text(_directionLabel));
-                    lv_label_set_text(_directionLabel, "");  // Xóa text
-                    lv_label_set_text(_directionLabel, currentText.c_str());  // Đặt lại text
-
-                    // Buộc cập nhật và vẽ lại
-                    lv_obj_invalidate(_directionLabel);
-                }
+                // Vừa hiện lại: chữ chạy lại từ đầu
+                _directionLabel.show(true);
             }
         }
         
-        // Cập nhật dữ liệu mới
-        _navData = navData;
+        // Trỏ tới dữ liệu mới
+        _navData = &navData;
+        _shownActive = willBeActive;
         
-        // Cập nhật hiển thị của default message label
-        if (_defaultMessageLabel) {
+        // Cập nhật hiển thị của default message label (chỉ khi trạng thái active đổi)
+        if (_defaultMessageLabel.obj() && (changes & NAV_FIELD_STATE)) {
+            // Ẩn thì dừng chữ chạy, hiện lại thì chữ chạy lại từ đầu
+            _defaultMessageLabel.show(!willBeActive);
             if (willBeActive) {
-                // Nếu navigation active, ẩn thông báo mặc định
-                lv_obj_add_flag(_defaultMessageLabel, LV_OBJ_FLAG_HIDDEN);
-                Serial.println("updateNavigation: Hiding default message");
-            } else {
-                if(lv_obj_has_flag(_defaultMessageLabel, LV_OBJ_FLAG_HIDDEN))
-                {
-                    lv_obj_clear_flag(_defaultMessageLabel, LV_OBJ_FLAG_HIDDEN);
-                    // Reset vị trí cuộn text để bắt đầu chạy từ đầu
-                    // Đặt lại text để bắt đầu hiệu ứng scroll từ đầu
-                    const String currentText = String(lv_label_get_text(_defaultMessageLabel));
-                    lv_label_set_text(_defaultMessageLabel, "");  // Xóa text
-                    lv_label_set_text(_defaultMessageLabel, currentText.c_str());  // Đặt lại text
-
-                    // Buộc cập nhật và vẽ lại
-                    lv_obj_invalidate(_defaultMessageLabel);
-                }
+                BLOG_D(UI_DEFAULT_MSG, 1);
             }
         }
         
         // Cập nhật trạng thái icon - Cách tiếp cận đơn giản 
         _hasValidIcon = navData.hasIcon;
         // Nếu icon đã thay đổi, cập nhật dữ liệu - chỉ kiểm tra CRC khi có icon
-        if (_hasValidIcon && _iconCRC != navData.iconCRC) {
-            // Sao chép dữ liệu icon vào buffer thay vì chỉ lưu con trỏ
-            memcpy(_iconBuffer, navData.icon, ICON_DATA_SIZE);
-            _iconData = _iconBuffer;
+        if (!(changes & NAV_FIELD_ICON)) {
+            // Icon không đổi
+        } else if (_hasValidIcon && _iconCRC != navData.iconCRC) {
+            // LVGL đọc thẳng bitmap 1-bit nên chỉ cần trỏ vào ảnh chụp
+            _iconData = navData.icon;
             _iconCRC = navData.iconCRC;
-            // Vẽ icon trực tiếp
             drawNavIconDirectly();
-        } else if (!_hasValidIcon && _navIcon != nullptr) {
-            lv_obj_del(_navIcon);
-            _navIcon = nullptr;
-            createContent();
+        } else if (!_hasValidIcon && _iconCRC != 0) {
+            // Ẩn icon chỉ invalidate vùng 48x48 của nó; các nhãn khác vẫn giữ nguyên
+            setVisible(_navIcon, false);
+            _iconCRC = 0;
         }
 
         // Cập nhật các nhãn văn bản
-        updateLabels();
+        updateLabels(changes);
     }
     
     // Tạo màn hình điều hướng
@@ -242,15 +213,18 @@ public:
             
             // Đặt các con trỏ khác về NULL
             _navIcon = nullptr;
-            _directionLabel = nullptr;
+            _directionLabel.detach();
             _distanceLabel = nullptr;
             _titleLabel = nullptr;
             _timeLabel = nullptr;
             _speedLabel = nullptr;
             _durationLabel = nullptr;
             _bgImage = nullptr;
-            _defaultMessageLabel = nullptr;
+            _defaultMessageLabel.detach();
+            _distanceContainer = nullptr;
+            _distanceReadout.detach();
         }
+        _shownMinute = -1;
         
         // Tạo màn hình mới
         _screen = lv_obj_create(NULL);
@@ -261,7 +235,8 @@ public:
             return;
         }
         
-        // Tạo hình nền từ bg.c
+        // Tạo hình nền từ bg.c: ảnh RGB565 đã trộn sẵn với màu nền (tools/bg_flatten.py),
+        // không có alpha nên LVGL chỉ chép từng dòng thay vì trộn từng pixel
         _bgImage = lv_img_create(_screen);
         lv_img_set_src(_bgImage, &bg_img);
         lv_obj_align(_bgImage, LV_ALIGN_CENTER, 0, 0);
@@ -279,16 +254,22 @@ public:
         updateUIBasedOnNavigationState();
         
         // Cập nhật nhãn với dữ liệu thực ngay lập tức
-        updateLabels();
+        updateLabels(NAV_FIELD_ALL);
         
         Serial.println("NavigationScreenLVGL: Screen created successfully");
     }
     
-    // Hiển thị màn hình
+    // Hiển thị màn hình. Khi màn hình đã đang hiển thị chỉ cập nhật đồng hồ;
+    // các trường điều hướng được cập nhật qua updateNavigation().
     void display() {
         if (_screen) {
-            // Cập nhật dữ liệu trước khi hiển thị
-            updateLabels();
+            // Cập nhật đồng hồ (chỉ vẽ lại khi sang phút mới)
+            updateLabels(0);
+            
+            // Màn hình đã được nạp: không sắp xếp lại / nạp lại để tránh vẽ lại toàn bộ
+            if (lv_scr_act() == _screen) {
+                return;
+            }
             
             // Đảm bảo hình nền được hiển thị đúng và rõ nét
             if (_bgImage) {
@@ -296,19 +277,19 @@ public:
             }
             
             // Di chuyển default message lên trên hình nền nếu đang hiển thị
-            if (_defaultMessageLabel && !lv_obj_has_flag(_defaultMessageLabel, LV_OBJ_FLAG_HIDDEN)) {
-                lv_obj_move_foreground(_defaultMessageLabel);
+            if (_defaultMessageLabel.obj() && !lv_obj_has_flag(_defaultMessageLabel.obj(), LV_OBJ_FLAG_HIDDEN)) {
+                lv_obj_move_foreground(_defaultMessageLabel.obj());
             }
             
             // Xác định trạng thái active của navigation
-            bool isActive = _navData.active && _navData.isNavigation;
+            bool isActive = _navData->active && _navData->isNavigation;
             
             // Chỉ hiển thị các thành phần UI khi navigation active
             if (isActive) {
                 // Di chuyển tất cả các phần tử UI lên trên hình nền
                 if (_navIcon) lv_obj_move_foreground(_navIcon);
-                if (_directionLabel && !lv_obj_has_flag(_directionLabel, LV_OBJ_FLAG_HIDDEN)) 
-                    lv_obj_move_foreground(_directionLabel);
+                if (_directionLabel.obj() && !lv_obj_has_flag(_directionLabel.obj(), LV_OBJ_FLAG_HIDDEN)) 
+                    lv_obj_move_foreground(_directionLabel.obj());
                 if (_titleLabel) lv_obj_move_foreground(_titleLabel);
                 if (_timeLabel) lv_obj_move_foreground(_timeLabel);
                 if (_speedLabel && !lv_obj_has_flag(_speedLabel, LV_OBJ_FLAG_HIDDEN)) 
@@ -330,17 +311,13 @@ public:
                     lv_obj_move_foreground(_distanceContainer);
                     lv_obj_move_foreground(_distanceLabel);
                     
-                    Serial.printf("Display: Distance container size: w=%d, h=%d\n", 
-                                lv_obj_get_width(_distanceContainer), 
-                                lv_obj_get_height(_distanceContainer));
+                    BLOG_D(UI_DISTANCE_BOX, lv_obj_get_width(_distanceContainer), lv_obj_get_height(_distanceContainer));
                 }
             }
             
-            // Chuyển sang màn hình navigation
+            // Chuyển sang màn hình navigation; lv_scr_load() invalidate cả màn hình
+            // và bộ lập lịch frame (LVGL_Display::update) sẽ vẽ ở lần kế tiếp
             lv_scr_load(_screen);
-            
-            // Gọi cập nhật LVGL để vẽ ngay lập tức
-            lv_refr_now(NULL);
         } else {
             Serial.println("ERROR: NavigationScreenLVGL - _screen is NULL, cannot display");
         }
@@ -349,70 +326,27 @@ public:
 public:
     // Cập nhật giao diện dựa trên trạng thái active/inactive của navigation
     void updateUIBasedOnNavigationState() {
-        bool isActive = _navData.active && _navData.isNavigation;
+        bool isActive = _navData->active && _navData->isNavigation;
 
-        if(isActive)
-        {
-            // Trước tiên ẩn default message
-            lv_obj_add_flag(_defaultMessageLabel, LV_OBJ_FLAG_HIDDEN);
-
-            // Hiện các thành phần UI
-            lv_obj_clear_flag(_directionLabel, LV_OBJ_FLAG_HIDDEN);
-            lv_obj_clear_flag(_speedLabel, LV_OBJ_FLAG_HIDDEN);
-            lv_obj_clear_flag(_titleLabel, LV_OBJ_FLAG_HIDDEN);
-            lv_obj_clear_flag(_timeLabel, LV_OBJ_FLAG_HIDDEN);
-            lv_obj_clear_flag(_durationLabel, LV_OBJ_FLAG_HIDDEN);
-            if(_navIcon)
-            {
-                lv_obj_clear_flag(_navIcon, LV_OBJ_FLAG_HIDDEN);
-            }
-            
-            // Hiển thị container distance và cập nhật kích thước
-            lv_obj_clear_flag(_distanceContainer, LV_OBJ_FLAG_HIDDEN);
-            lv_obj_clear_flag(_distanceLabel, LV_OBJ_FLAG_HIDDEN);
-            
-            // Force cập nhật kích thước container dựa trên nội dung
+        // Chỉ widget đổi trạng thái hiển thị mới bị invalidate
+        // Nhãn chữ chạy: vừa hiện lại thì chạy lại từ đầu, bị ẩn thì dừng animation
+        _defaultMessageLabel.show(!isActive);
+        _directionLabel.show(isActive);
+        setVisible(_speedLabel, isActive);
+        setVisible(_titleLabel, isActive);
+        setVisible(_timeLabel, isActive);
+        setVisible(_durationLabel, isActive);
+        setVisible(_navIcon, isActive && _hasValidIcon);
+        
+        if (setVisible(_distanceContainer, isActive) && isActive) {
+            // Vừa hiện lại: cập nhật kích thước container theo nội dung
             lv_obj_set_width(_distanceContainer, LV_SIZE_CONTENT);
             lv_obj_update_layout(_distanceContainer);
             lv_obj_center(_distanceLabel);
-            
-            Serial.println("Navigation active: Showing all UI elements");
-        }
-        else
-        {
-            // Hiện default message
-            if(lv_obj_has_flag(_defaultMessageLabel, LV_OBJ_FLAG_HIDDEN))
-            lv_obj_clear_flag(_defaultMessageLabel, LV_OBJ_FLAG_HIDDEN);
-            {
-                // Reset vị trí cuộn text để bắt đầu chạy từ đầu
-                // Đặt lại text để bắt đầu hiệu ứng scroll từ đầu
-                const String currentText = String(lv_label_get_text(_defaultMessageLabel));
-                lv_label_set_text(_defaultMessageLabel, "");  // Xóa text
-                lv_label_set_text(_defaultMessageLabel, currentText.c_str());  // Đặt lại text
-
-                // Buộc cập nhật và vẽ lại
-                lv_obj_invalidate(_defaultMessageLabel);
-            }
-            
-            
-            // Ẩn tất cả các thành phần UI khác
-            lv_obj_add_flag(_directionLabel, LV_OBJ_FLAG_HIDDEN);
-            lv_obj_add_flag(_speedLabel, LV_OBJ_FLAG_HIDDEN);
-            lv_obj_add_flag(_distanceContainer, LV_OBJ_FLAG_HIDDEN);
-            lv_obj_add_flag(_distanceLabel, LV_OBJ_FLAG_HIDDEN);
-            lv_obj_add_flag(_titleLabel, LV_OBJ_FLAG_HIDDEN);
-            lv_obj_add_flag(_timeLabel, LV_OBJ_FLAG_HIDDEN);
-            lv_obj_add_flag(_durationLabel, LV_OBJ_FLAG_HIDDEN);
-            if(_navIcon)
-            {
-                lv_obj_add_flag(_navIcon, LV_OBJ_FLAG_HIDDEN);
-            }
-            
-            Serial.println("Navigation inactive: Only showing background and default message");
         }
 
         // Log trạng thái
-        Serial.printf("Updated UI based on navigation state: isActive=%d\n", isActive);
+        BLOG_D(UI_NAV_STATE, isActive);
     }
 
     private:
@@ -448,9 +382,17 @@ public:
     
     // Tạo phần nội dung (chỉ đường)
     void createContent() {
-        // Tạo icon điều hướng ở lề trái
+        // Tạo icon điều hướng ở lề trái: ô 48x48 nền đen, bit 1 màu trắng.
+        // Ẩn tới khi có icon; sau đó chỉ đổi nguồn ảnh (drawNavIconDirectly)
+        _navIcon = lv_img_create(_screen);
+        lv_obj_set_size(_navIcon, 48, 48);
+        lv_obj_align(_navIcon, LV_ALIGN_TOP_LEFT, 5, 40);
+        lv_obj_set_style_bg_color(_navIcon, lv_color_hex(0x000000), LV_PART_MAIN);
+        lv_obj_set_style_bg_opa(_navIcon, LV_OPA_COVER, LV_PART_MAIN);
+        lv_obj_set_style_img_recolor(_navIcon, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
+        lv_obj_set_style_img_recolor_opa(_navIcon, LV_OPA_COVER, LV_PART_MAIN);
+        lv_obj_add_flag(_navIcon, LV_OBJ_FLAG_HIDDEN);
         if (_hasValidIcon && _iconData != nullptr) {
-            // Vẽ icon trực tiếp sử dụng API bitmap của LVGL
             drawNavIconDirectly();
         }
         
@@ -464,20 +406,9 @@ public:
             58, 40  // Vị trí ngay bên phải navIcon (48px + 5px)
         );
         
-        // Tạo nhãn hướng dẫn (đơn giản)
-        _directionLabel = lv_label_create(_screen);
-        lv_obj_align(_directionLabel, LV_ALIGN_TOP_LEFT, 5, 85);
-        lv_obj_set_width(_directionLabel, 230); // Giới hạn chiều rộng
-        lv_obj_set_style_text_font(_directionLabel, VietnameseFonts::getBoldFont(), LV_PART_MAIN);
-        lv_obj_set_style_text_color(_directionLabel, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
-        lv_obj_set_style_text_opa(_directionLabel, 255, LV_PART_MAIN);
-        
-        // Thiết lập chế độ scroll và các thông số animation chỉ một lần
-        lv_label_set_long_mode(_directionLabel, LV_LABEL_LONG_SCROLL_CIRCULAR);
-        lv_obj_set_style_anim_speed(_directionLabel, 40, LV_PART_MAIN);
-        lv_obj_set_style_anim_time(_directionLabel, 5000, LV_PART_MAIN);
-        
-        lv_label_set_text(_directionLabel, "");
+        // Tạo nhãn hướng dẫn: chữ chạy vòng 40 px/s khi dài hơn 230 px
+        _directionLabel.create(_screen, VietnameseFonts::getBoldFont(), lv_color_hex(0xFFFFFF), 230, 40);
+        lv_obj_align(_directionLabel.obj(), LV_ALIGN_TOP_LEFT, 5, 85);
         
         // Tạo nhãn tốc độ
         _speedLabel = VietnameseFonts::createText(
@@ -492,8 +423,8 @@ public:
         // Tạo container cho distance với nền màu vàng và bo tròn
         _distanceContainer = lv_obj_create(_screen);
         
-        // Đặt kích thước theo nội dung thay vì cố định
-        lv_obj_set_size(_distanceContainer, LV_SIZE_CONTENT, 35);
+        // Đặt kích thước theo nội dung (số 48 px của _distanceReadout hoặc nhãn dự phòng)
+        lv_obj_set_size(_distanceContainer, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
         lv_obj_align(_distanceContainer, LV_ALIGN_TOP_MID, 0, 130);
 
         // Thiết lập style cho container với nền màu vàng và bo tròn
@@ -501,8 +432,8 @@ public:
         lv_obj_set_style_bg_opa(_distanceContainer, 255, LV_PART_MAIN); // Độ đậm tối đa
         lv_obj_set_style_radius(_distanceContainer, 10, LV_PART_MAIN); // Bo tròn góc (giảm xuống)
         lv_obj_set_style_pad_all(_distanceContainer, 5, LV_PART_MAIN);  // Padding đồng đều
-        lv_obj_set_style_pad_left(_distanceContainer, 15, LV_PART_MAIN); // Thêm padding bên trái
-        lv_obj_set_style_pad_right(_distanceContainer, 15, LV_PART_MAIN); // Thêm padding bên phải
+        lv_obj_set_style_pad_left(_distanceContainer, 10, LV_PART_MAIN); // Thêm padding bên trái
+        lv_obj_set_style_pad_right(_distanceContainer, 10, LV_PART_MAIN); // Thêm padding bên phải
         lv_obj_set_style_border_width(_distanceContainer, 0, LV_PART_MAIN); // Không có viền
         
         // Loại bỏ thanh cuộn
@@ -521,8 +452,18 @@ public:
         // Căn giữa trong container
         lv_obj_center(_distanceLabel);
         
+        lv_label_set_text(_distanceLabel, "");
+        
+        // Số khoảng cách ghép từ sprite font montserrat_number_bold_48, vẽ trên nền vàng
+        if (_distanceReadout.create(_distanceContainer, VietnameseFonts::getNumberBoldFont(),
+                                    lv_color_hex(0xFFFFFF), lv_color_hex(0xFFDF00))) {
+            lv_obj_center(_distanceReadout.obj());
+        } else {
+            Serial.println("WARNING: distance sprite atlas unavailable, using label");
+        }
+        
         // Text mẫu để kiểm tra kích thước - đảm bảo container đủ rộng cho mọi text
-        lv_label_set_text(_distanceLabel, "0 km");
+        showDistance("0 km");
         
         // Cập nhật layout để container có kích thước phù hợp với nội dung
         lv_obj_update_layout(_distanceContainer);
@@ -536,84 +477,60 @@ public:
     // Tạo label hiển thị thông báo mặc định khi không có chỉ đường active
     void createDefaultMessageLabel() {
         // Tạo nhãn hiển thị "Start navigation on Google maps" ở giữa màn hình
-        _defaultMessageLabel = lv_label_create(_screen);
-        lv_obj_align(_defaultMessageLabel, LV_ALIGN_TOP_MID, 0, 75); // Căn giữa màn hình
-        lv_obj_set_width(_defaultMessageLabel, 230); // Giới hạn chiều rộng
-        lv_obj_set_style_text_font(_defaultMessageLabel, VietnameseFonts::getBoldFont(), LV_PART_MAIN);
-        lv_obj_set_style_text_color(_defaultMessageLabel, lv_color_hex(0xFFFFFF), LV_PART_MAIN); // Màu trắng
-        lv_obj_set_style_text_opa(_defaultMessageLabel, 255, LV_PART_MAIN);
-        
-        // Thiết lập chế độ scroll và các thông số animation
-        lv_label_set_long_mode(_defaultMessageLabel, LV_LABEL_LONG_SCROLL_CIRCULAR);
-        lv_obj_set_style_anim_speed(_defaultMessageLabel, 40, LV_PART_MAIN);
-        lv_obj_set_style_anim_time(_defaultMessageLabel, 5000, LV_PART_MAIN);
+        // Chữ trắng chạy vòng 40 px/s trong khung rộng 230 px; text cố định nên dải
+        // chỉ cấp vừa đủ ở setText() ngay dưới
+        _defaultMessageLabel.create(_screen, VietnameseFonts::getBoldFont(), lv_color_hex(0xFFFFFF), 230, 40, 0);
+        lv_obj_align(_defaultMessageLabel.obj(), LV_ALIGN_TOP_MID, 0, 75); // Căn giữa màn hình
         
-        // Thiết lập text
-        lv_label_set_text(_defaultMessageLabel, "Start navigation on Google maps");
+        // Thiết lập text (raster một lần vào dải)
+        _defaultMessageLabel.setText("Start navigation on Google maps");
         
         // Ban đầu, ẩn label này nếu navigation đang active
-        if (_navData.active && _navData.isNavigation) {
-            lv_obj_add_flag(_defaultMessageLabel, LV_OBJ_FLAG_HIDDEN);
-        } else {
-            lv_obj_clear_flag(_defaultMessageLabel, LV_OBJ_FLAG_HIDDEN);
-        }
+        _defaultMessageLabel.show(!(_navData->active && _navData->isNavigation));
     }
     
-    // Cập nhật nội dung các nhãn
-    void updateLabels() {
+    // Cập nhật nội dung các nhãn có bit trong changes. Chỉ nhãn có text thực sự
+    // khác mới bị invalidate (vùng của nhãn), không vẽ lại cả màn hình.
+    void updateLabels(NavFieldMask changes) {
         // Cập nhật hiển thị của các thành phần UI khác
-        if (_directionLabel) {
-            // Nếu navigation active, hiển thị nội dung hướng dẫn
-            if (_navData.directions.length() > 0) {
-                // Lưu text hiện tại
-                const char* currentText = lv_label_get_text(_directionLabel);
-                
-                // Chỉ cập nhật nếu text thay đổi
-                if (strcmp(currentText, _navData.directions.c_str()) != 0) {
-                    // Đặt text mới
-                    lv_label_set_text(_directionLabel, _navData.directions.c_str());
-                    Serial.println("Updated direction text: " + _navData.directions);
-                }
-            } 
+        if (_directionLabel.obj() && (changes & NAV_FIELD_DIRECTIONS)) {
+            // Nếu navigation active, hiển thị nội dung hướng dẫn (raster lại dải chữ chạy)
+            if (_navData->directions.length() > 0 && _directionLabel.setText(_navData->directions.c_str())) {
+                BLOG_D(UI_DIRECTION_TEXT, _navData->directions.length());
+            }
         }
         
         // Cập nhật title
-        lv_label_set_text(_titleLabel, _navData.title.c_str());
+        if (changes & NAV_FIELD_TITLE) {
+            setLabelText(_titleLabel, _navData->title.c_str());
+        }
         
-        // Cập nhật thời gian hiện tại (góc trên bên trái)
-        String currentTime;
+        // Cập nhật thời gian hiện tại (góc trên bên trái), chỉ khi sang phút mới
         int hour = ChronosManager::getInstance().getChronos().getHour();
         int min = ChronosManager::getInstance().getChronos().getMinute();
-        // Định dạng thời gian hiện tại "4:04" (không có AM/PM)
-        currentTime = String(hour) + ":" + (min < 10 ? "0" : "") + String(min);
-        lv_label_set_text(_timeLabel, currentTime.c_str());
-        
-        // Cập nhật khoảng cách trong container
-        if (_navData.distance.length() > 0) {
-            lv_label_set_text(_distanceLabel, _navData.distance.c_str());
-        } else {
-            lv_label_set_text(_distanceLabel, "0 km");
+        if (_timeLabel && hour * 60 + min != _shownMinute) {
+            _shownMinute = hour * 60 + min;
+            // Định dạng thời gian hiện tại "4:04" (không có AM/PM)
+            lv_label_set_text_fmt(_timeLabel, "%d:%02d", hour, min);
         }
         
-        // Sau khi cập nhật nội dung, cần cập nhật layout của container để đảm bảo kích thước phù hợp
-        if (_distanceContainer) {
-            // Đảm bảo cập nhật kích thước container dựa trên nội dung
-            lv_obj_update_layout(_distanceContainer);
+        // Cập nhật khoảng cách trong container
+        if (changes & NAV_FIELD_DISTANCE) {
+            const char* distance = _navData->distance.length() > 0 ? _navData->distance.c_str() : "0 km";
             
-            // Đảm bảo label được căn giữa trong container
-            lv_obj_center(_distanceLabel);
+            // Cùng độ rộng thì chỉ các ô chữ số đổi bị invalidate, container không phải
+            // dàn trang lại; đổi độ rộng thì LVGL tự co giãn container ở lần vẽ tới
+            showDistance(distance);
         }
         
         // Cập nhật tốc độ (góc dưới bên trái)
-        lv_label_set_text(_speedLabel, _navData.speed.c_str());
+        if (changes & NAV_FIELD_SPEED) {
+            setLabelText(_speedLabel, _navData->speed.c_str());
+        }
         // Cập nhật thời gian hành trình (góc trên bên phải)
-        lv_label_set_text(_durationLabel, _navData.duration.c_str());
-        
-        // Đảm bảo các thành phần được cập nhật ngay lập tức
-        if (_bgImage) {
-            lv_obj_invalidate(_bgImage); // Đảm bảo background được vẽ lại đầu tiên
+        if (changes & NAV_FIELD_DURATION) {
+            setLabelText(_durationLabel, _navData->duration.c_str());
         }
-        lv_obj_invalidate(_screen);
     }
 };
 
@@ -0,0 +1,2052 @@
+/*******************************************************************************
+ * Sinh bởi tools/font_subset.py từ include/fonts/montserrat_24.c, không sửa tay.
+ * Dùng bởi: _timeLabel, _durationLabel
+ * Glyph: 229, bitmap: nén RLE + prefilter
+ ******************************************************************************/
+
+#include "../local_fonts.h"
+
+#ifndef MONTSERRAT_24
+#define MONTSERRAT_24 1
+#endif
+
+#if MONTSERRAT_24
+
+#if !LV_USE_FONT_COMPRESSED
+#error "montserrat_24.c là font nén: bật LV_USE_FONT_COMPRESSED trong lv_conf.h"
+#endif
+
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+0020 " " */
+
+    /* U+0021 "!" */
+    0xe, 0xf1, 0x3, 0x0, 0xe1, 0x1, 0x0, 0xf9, 0xc0, 0x30, 0x80, 0x4, 0x3, 0x18, 0x0, 0xc0,
+    0x3f, 0x8, 0x2, 0x70, 0x3, 0xca, 0xe0, 0x35, 0xa, 0x26, 0x2e,
+
+    /* U+0022 "\"" */
+    0x5f, 0x20, 0x3f, 0x40, 0xf, 0x38, 0x81, 0x80, 0x7e, 0x10, 0xf, 0xe7, 0x0, 0xe1, 0x28, 0x10,
+    0x28, 0x30,
+
+    /* U+0023 "#" */
+    0x0, 0xe7, 0xe0, 0xc, 0x7e, 0x20, 0x1f, 0x71, 0x0, 0x66, 0x1, 0x0, 0xf8, 0x98, 0x3, 0x11,
+    0x0, 0x3f, 0x31, 0x0, 0x6e, 0x60, 0xd, 0x1f, 0xf1, 0x3f, 0xfe, 0x64, 0xff, 0x82, 0xea, 0x92,
+    0xf, 0x55, 0x85, 0x6a, 0xa0, 0x35, 0x52, 0x5, 0x2a, 0xe0, 0xf5, 0x58, 0x3, 0x30, 0x10, 0x6,
+    0x11, 0x0, 0x7c, 0x42, 0x1, 0x88, 0x18, 0x3, 0xee, 0x20, 0xc, 0xc0, 0x40, 0x18, 0x46, 0x36,
+    0x11, 0xc6, 0x23, 0x81, 0x3b, 0xa4, 0x5e, 0xed, 0x3, 0xdd, 0x1a, 0xdd, 0xc0, 0xf7, 0x78, 0xd2,
+    0xee, 0x31, 0x44, 0x83, 0x11, 0x30, 0x1a, 0x24, 0x1, 0x88, 0x18, 0x3, 0x17, 0x0, 0x7c, 0xc0,
+    0x40, 0x18, 0x48, 0x3, 0xe2, 0x10, 0xc, 0x40, 0xc0, 0x18,
+
+    /* U+0024 "$" */
+    0x0, 0xe1, 0x80, 0xf, 0xf8, 0xdc, 0x40, 0x3f, 0xfa, 0xcf, 0x9a, 0x1d, 0xb2, 0x80, 0x11, 0xf4,
+    0xa, 0x2, 0x8b, 0x5d, 0x0, 0x38, 0x6b, 0x64, 0x2f, 0x3e, 0x34, 0x14, 0x9d, 0x40, 0x3c, 0xee,
+    0x2, 0xc, 0x0, 0xff, 0x8, 0x18, 0x7, 0xf9, 0xc6, 0x14, 0x3, 0xf8, 0x68, 0x6b, 0xa0, 0x3,
+    0xf2, 0x7c, 0x12, 0x87, 0x63, 0x80, 0x70, 0xbe, 0x60, 0x14, 0xa3, 0x94, 0x3, 0xc2, 0x17, 0xd4,
+    0x34, 0x40, 0x1f, 0xcb, 0x41, 0x40, 0x1f, 0xe7, 0x1, 0x21, 0x0, 0xfc, 0xe1, 0xd3, 0xec, 0x1,
+    0xe3, 0xb0, 0x69, 0x29, 0xfb, 0x80, 0xbc, 0xc0, 0xd8, 0x96, 0x5b, 0x31, 0x41, 0x41, 0xf9, 0x0,
+    0x24, 0x9d, 0xd0, 0x76, 0x40, 0x80, 0x7f, 0xf4, 0x0,
+
+    /* U+0025 "%" */
+    0x3, 0xcf, 0xe9, 0x0, 0xf9, 0x7c, 0x40, 0x5, 0x95, 0xfe, 0x2b, 0x0, 0xe1, 0xa9, 0x10, 0x4,
+    0x33, 0x0, 0x69, 0xc, 0x3, 0x52, 0x30, 0x4, 0x9a, 0x1, 0xa, 0x58, 0x4, 0xcb, 0x40, 0x18,
+    0x5c, 0x3, 0x10, 0x80, 0xa, 0x6c, 0x40, 0x30, 0xb8, 0x6, 0x21, 0x0, 0x4a, 0xa8, 0x3, 0x97,
+    0x40, 0x32, 0x60, 0x32, 0xd8, 0x7, 0xa1, 0x94, 0x6, 0xcd, 0xa, 0x6c, 0x40, 0x3c, 0x75, 0x7f,
+    0xc1, 0xa1, 0xca, 0xa0, 0x9e, 0xe5, 0x10, 0x1, 0x7b, 0xab, 0x17, 0x2b, 0xc, 0x5d, 0xd0, 0x60,
+    0x80, 0x42, 0x20, 0x28, 0xb1, 0x52, 0xc3, 0x35, 0x14, 0x80, 0x7b, 0x95, 0x41, 0x8e, 0x1, 0xa9,
+    0x0, 0x39, 0xca, 0xc0, 0x4, 0x20, 0x18, 0xc8, 0x3, 0x14, 0x50, 0x80, 0x8, 0x40, 0x31, 0x90,
+    0x6, 0xe6, 0x40, 0xb, 0x10, 0x3, 0x6a, 0x80, 0x4e, 0x52, 0x1, 0x94, 0x24, 0x41, 0xd6, 0x0,
+    0x7, 0x14, 0x1, 0xec, 0x3e, 0xfc, 0xc0, 0x80,
+
+    /* U+0026 "&" */
+    0x0, 0x8a, 0xbb, 0xfa, 0x84, 0x3, 0xe1, 0xc4, 0x9a, 0x94, 0xc0, 0xf, 0xa4, 0x75, 0xd5, 0xf4,
+    0x94, 0x3, 0xc6, 0x26, 0x1, 0x18, 0x18, 0x7, 0x88, 0x40, 0x32, 0x82, 0x80, 0x7b, 0x42, 0x0,
+    0xb, 0x4a, 0x60, 0x1e, 0x45, 0x77, 0x55, 0x1a, 0x80, 0x3f, 0x58, 0xc2, 0x5c, 0x80, 0x7e, 0x3c,
+    0x2, 0x10, 0xf, 0xe5, 0xc6, 0xfc, 0x2b, 0x30, 0x9, 0xd4, 0xa, 0x96, 0xc4, 0x58, 0x58, 0x60,
+    0xa, 0xc0, 0x80, 0xb0, 0x8, 0x70, 0x74, 0x8c, 0xb0, 0x18, 0x84, 0x3, 0xe, 0x6, 0x78, 0xa8,
+    0x39, 0x0, 0x78, 0xb0, 0x4e, 0x0, 0x1a, 0x14, 0x1, 0xea, 0x0, 0x58, 0x83, 0x31, 0x7a, 0x5d,
+    0xd5, 0xce, 0xeb, 0x2c, 0x10, 0x9b, 0x47, 0x88, 0x3b, 0xb6, 0x12, 0xca, 0x40, 0x9, 0x5d, 0xfe,
+    0xd9, 0x20, 0x2, 0x5c, 0x0,
+
+    /* U+0027 "'" */
+    0x5f, 0x20, 0x8, 0x40, 0xc0, 0x3c, 0xe0, 0x2, 0x81,
+
+    /* U+0028 "(" */
+    0x0, 0xf, 0x50, 0x2, 0x46, 0x0, 0xc, 0x84, 0x8, 0x3a, 0x0, 0xd0, 0x70, 0x2, 0x10, 0x80,
+    0x9, 0x0, 0x6, 0x1c, 0x0, 0x60, 0x20, 0x1, 0x83, 0x0, 0x4, 0x3, 0xc2, 0x1, 0x84, 0x0,
+    0x20, 0x18, 0xc1, 0x80, 0xc, 0x4, 0x0, 0x30, 0xe0, 0x8, 0x90, 0x2, 0x42, 0x10, 0x6, 0x83,
+    0x80, 0x10, 0x74, 0x2, 0x94, 0x20, 0x3, 0xc, 0x0,
+
+    /* U+0029 ")" */
+    0xc, 0xd0, 0xd, 0x4, 0xc0, 0x12, 0x15, 0x80, 0x6a, 0x23, 0x0, 0x94, 0x2c, 0x2, 0x21, 0x40,
+    0xc, 0xa6, 0x1, 0x88, 0x4, 0x2, 0xf0, 0x20, 0x8, 0xc1, 0x80, 0x21, 0x3, 0x0, 0xff, 0xe1,
+    0x88, 0x18, 0x4, 0x60, 0xc0, 0x17, 0x81, 0x0, 0x44, 0x2, 0x1, 0x2a, 0x0, 0x44, 0x38, 0x1,
+    0x28, 0x28, 0x5, 0x44, 0x40, 0x2, 0x15, 0x80, 0x50, 0x4c, 0x0,
+
+    /* U+002A "*" */
+    0x0, 0xdc, 0x60, 0x18, 0x40, 0x3c, 0x29, 0xce, 0x1, 0x2e, 0xca, 0x5d, 0x68, 0xf5, 0xda, 0x1,
+    0x30, 0x0, 0x5a, 0xc0, 0x6, 0xf1, 0x4, 0xc8, 0x13, 0x8b, 0xc1, 0x8c, 0x49, 0x3e, 0x50, 0x8,
+    0xf2, 0x0, 0x31, 0x8, 0x4,
+
+    /* U+002B "+" */
+    0x0, 0xe9, 0x70, 0xf, 0xf2, 0x68, 0x7, 0xff, 0x48, 0x8b, 0x18, 0x91, 0x60, 0x5d, 0xdc, 0x29,
+    0xbb, 0x89, 0x2a, 0xb0, 0x9d, 0x56, 0x21, 0x55, 0xc6, 0xca, 0xb8, 0x3, 0xff, 0xa4, 0xc4, 0x1,
+    0xc0,
+
+    /* U+002C "," */
+    0x29, 0x38, 0x6f, 0xc0, 0x66, 0x6, 0x18, 0x3a, 0x98, 0x94, 0x0,
+
+    /* U+002D "-" */
+    0x48, 0x8e, 0x6d, 0x77, 0xed,
+
+    /* U+002E "." */
+    0x3a, 0x38, 0x5f, 0xd0, 0xb0,
+
+    /* U+002F "/" */
+    0x0, 0xfd, 0xb6, 0x1, 0xf1, 0x97, 0x0, 0x7d, 0x60, 0xa0, 0x1f, 0x32, 0x80, 0x7c, 0x63, 0xe0,
+    0x1f, 0x50, 0x28, 0x7, 0xce, 0xa0, 0x1f, 0x20, 0xf0, 0x7, 0xda, 0x28, 0x1, 0xf3, 0xb8, 0x3,
+    0xe4, 0x1d, 0x0, 0xfb, 0x85, 0x0, 0x3e, 0x57, 0x0, 0xf9, 0x42, 0x80, 0x3e, 0xf1, 0x30, 0xf,
+    0x95, 0x80, 0x3e, 0x50, 0xb0, 0xf, 0xb8, 0x8c, 0x3, 0xc2, 0x8a, 0x1, 0xf3, 0x85, 0x0, 0x7d,
+    0xa4, 0x40, 0xf, 0xa, 0x50, 0x7, 0xce, 0xa, 0x1, 0xf0,
+
+    /* U+0030 "0" */
+    0x0, 0x86, 0x37, 0xfd, 0x8e, 0x1, 0xe3, 0xf7, 0x5, 0x51, 0x46, 0x90, 0x4, 0x3a, 0x35, 0xb5,
+    0x4e, 0x92, 0xf0, 0xa, 0xc6, 0x94, 0x3, 0x34, 0x94, 0x0, 0xaa, 0x28, 0x7, 0x98, 0x9c, 0x1c,
+    0x34, 0x3, 0xf5, 0x2, 0xf8, 0x20, 0x7, 0xe3, 0xd, 0x20, 0x20, 0xf, 0xcc, 0x2, 0x1, 0xff,
+    0x18, 0x18, 0x7, 0xfc, 0x60, 0x64, 0x4, 0x1, 0xf9, 0x80, 0x7c, 0x10, 0x3, 0xf1, 0x86, 0xb8,
+    0x68, 0x7, 0xea, 0x5, 0x15, 0x45, 0x0, 0xf3, 0x13, 0x80, 0x2c, 0x69, 0x40, 0x33, 0x49, 0x40,
+    0x0, 0x74, 0x6b, 0x6a, 0x9d, 0x25, 0xe0, 0x18, 0xfd, 0xc1, 0x54, 0x51, 0xa4, 0x0,
+
+    /* U+0031 "1" */
+    0xcf, 0xfd, 0xd6, 0xcd, 0x8, 0x3c, 0xcc, 0x60, 0x1f, 0xff, 0xf0, 0xf, 0xf0,
+
+    /* U+0032 "2" */
+    0x0, 0x14, 0xef, 0xfb, 0xad, 0x40, 0x34, 0x6b, 0xa, 0xac, 0x95, 0x60, 0x4, 0x74, 0xdc, 0xaa,
+    0x5f, 0x1a, 0x38, 0x26, 0x59, 0x0, 0x61, 0xd0, 0xa0, 0x1, 0x80, 0x7c, 0x24, 0x40, 0xf, 0xf8,
+    0xc8, 0x3, 0xfc, 0x62, 0x80, 0x1f, 0xef, 0xb, 0x0, 0xfe, 0xa3, 0x92, 0x0, 0xfd, 0x4b, 0xc,
+    0x1, 0xfa, 0xd6, 0x1c, 0x3, 0xf5, 0xa4, 0x38, 0x7, 0xeb, 0x48, 0x70, 0xf, 0xd6, 0x90, 0xe0,
+    0x1f, 0xad, 0x25, 0xc0, 0x3f, 0x62, 0x17, 0xcc, 0xfc, 0xc2, 0x60, 0x4c, 0xdf, 0xb4,
+
+    /* U+0033 "3" */
+    0x1f, 0xff, 0xf5, 0x80, 0xb3, 0x7e, 0x10, 0xc0, 0x4, 0xcf, 0xda, 0x2a, 0xe0, 0x1f, 0x8a, 0xca,
+    0x80, 0x3f, 0xf, 0x8f, 0x80, 0x7f, 0x51, 0x69, 0x0, 0x7e, 0x94, 0x93, 0x0, 0xfc, 0x4c, 0x11,
+    0x8e, 0x1, 0xf1, 0xbb, 0xc5, 0x1a, 0x20, 0x1c, 0x31, 0x9, 0xe8, 0x2a, 0x0, 0xff, 0x3a, 0x20,
+    0x80, 0x3f, 0xd8, 0xe, 0x1, 0xff, 0xc1, 0x13, 0x0, 0xfd, 0x60, 0x91, 0x90, 0x20, 0x1d, 0x26,
+    0xa3, 0x66, 0xfd, 0x95, 0x37, 0xec, 0x76, 0x5, 0x96, 0xc2, 0xac, 0xa9, 0x38, 0x20,
+
+    /* U+0034 "4" */
+    0x0, 0xfe, 0x8f, 0x60, 0xf, 0xfc, 0xae, 0xcc, 0x0, 0xff, 0x8a, 0x8e, 0x40, 0x3f, 0xf7, 0x8e,
+    0x80, 0x7f, 0xea, 0x2a, 0x10, 0xf, 0xf9, 0xd6, 0x10, 0x3, 0xfe, 0x48, 0x47, 0x0, 0xff, 0x8a,
+    0x8a, 0x80, 0x27, 0xf2, 0x0, 0xf7, 0xf, 0x88, 0x5, 0xe0, 0x1f, 0x51, 0xd1, 0x0, 0x7f, 0xcc,
+    0xac, 0xa0, 0x1f, 0xfa, 0x41, 0xbf, 0xfc, 0xe1, 0xbf, 0xe8, 0x6, 0x6f, 0xe2, 0x5, 0x66, 0x60,
+    0x4c, 0xff, 0x20, 0x44, 0xc9, 0x0, 0x3f, 0xfc, 0x80,
+
+    /* U+0035 "5" */
+    0x0, 0x3f, 0xff, 0xec, 0x0, 0xb8, 0x19, 0xbe, 0xb0, 0x8, 0x82, 0x67, 0xe7, 0x0, 0x9c, 0x80,
+    0x3f, 0xe2, 0x10, 0xf, 0xf8, 0x58, 0x3, 0xfc, 0x20, 0x40, 0x1f, 0xe2, 0x7, 0xff, 0xba, 0xdc,
+    0x40, 0x21, 0x66, 0xe5, 0x48, 0xf4, 0x0, 0x14, 0xcf, 0x5f, 0xc8, 0xd8, 0x80, 0x7f, 0x34, 0x3,
+    0x0, 0x7f, 0x94, 0x38, 0x3, 0xff, 0x84, 0x60, 0x1f, 0x94, 0x3c, 0xf2, 0x88, 0x3, 0x96, 0x5,
+    0x8d, 0x97, 0x75, 0x53, 0x5d, 0x43, 0xa0, 0x9, 0xd7, 0x14, 0x65, 0x27, 0xf3, 0x0,
+
+    /* U+0036 "6" */
+    0x0, 0xc9, 0x5d, 0xfe, 0xea, 0x40, 0x8, 0x6e, 0xca, 0xa6, 0x62, 0xa6, 0x80, 0x58, 0x8f, 0xf7,
+    0x32, 0xbe, 0x80, 0x4, 0x94, 0xc0, 0x7, 0x84, 0x5, 0x91, 0x80, 0x3f, 0x90, 0x38, 0x3, 0xfd,
+    0x80, 0xe0, 0x4, 0x77, 0x30, 0x80, 0x44, 0x4, 0xbd, 0x71, 0x9, 0xea, 0x10, 0x9, 0x69, 0x33,
+    0xfd, 0x8a, 0xad, 0x0, 0xae, 0x28, 0xc0, 0x7, 0x4e, 0x6c, 0x20, 0x6e, 0x1, 0xe8, 0xd, 0xd0,
+    0x38, 0x7, 0xe2, 0x64, 0x1, 0x0, 0xfc, 0x62, 0x66, 0x42, 0x0, 0xf2, 0xa, 0x87, 0x87, 0x90,
+    0x6, 0x2a, 0xb, 0x3, 0xb2, 0xdb, 0x88, 0x5e, 0x8d, 0x90, 0x1, 0x39, 0xd9, 0xdc, 0xcc, 0xd4,
+    0x0,
+
+    /* U+0037 "7" */
+    0x3f, 0xff, 0xfc, 0x20, 0x3, 0x66, 0xfc, 0x0, 0x10, 0x5, 0xcc, 0xfd, 0xa0, 0xe0, 0x1f, 0xf4,
+    0x4, 0x80, 0x99, 0x0, 0x78, 0xcc, 0xa2, 0x5, 0x8a, 0x1, 0xe9, 0x9, 0x0, 0xff, 0xa, 0x99,
+    0x80, 0x3f, 0xd2, 0x12, 0x1, 0xff, 0x39, 0x28, 0x7, 0xf9, 0xc2, 0xc0, 0x3f, 0xe9, 0x16, 0x0,
+    0xff, 0x28, 0xb0, 0x7, 0xfd, 0x21, 0x20, 0x1f, 0xe3, 0x32, 0x88, 0x7, 0xfa, 0x42, 0x40, 0x3f,
+    0xc4, 0xa8, 0x60, 0x1f, 0xeb, 0xf, 0x0, 0xf8,
+
+    /* U+0038 "8" */
+    0x0, 0x9f, 0x3b, 0xfd, 0xb2, 0x40, 0x18, 0xba, 0x5, 0xde, 0x66, 0x6b, 0x0, 0x5e, 0x35, 0xb3,
+    0x10, 0xbd, 0x29, 0x20, 0x22, 0x32, 0x80, 0x71, 0x40, 0x28, 0x8, 0x8, 0x7, 0xcc, 0x1e, 0x6,
+    0xa, 0x1, 0xf5, 0x6, 0x80, 0x24, 0xb1, 0x44, 0x5, 0x29, 0x91, 0x40, 0xd, 0x27, 0x5d, 0xfd,
+    0x6a, 0xab, 0x0, 0x9a, 0x45, 0xee, 0xe8, 0x35, 0xa0, 0x1, 0xc9, 0xfc, 0x22, 0x4f, 0x8e, 0xb0,
+    0x12, 0x1c, 0x20, 0x1e, 0x82, 0x70, 0x71, 0x20, 0xf, 0xce, 0x4, 0x22, 0x0, 0xff, 0x8d, 0x41,
+    0x0, 0x3e, 0x15, 0x11, 0x58, 0x52, 0x0, 0x71, 0x68, 0x40, 0x15, 0x8d, 0xe4, 0xc4, 0x2f, 0x4d,
+    0xd8, 0x0, 0x9c, 0xe0, 0xef, 0x33, 0x32, 0x0, 0x0,
+
+    /* U+0039 "9" */
+    0x0, 0x96, 0xfb, 0xfa, 0xd8, 0x3, 0xd7, 0x4a, 0xf0, 0xcf, 0x38, 0x20, 0x14, 0x23, 0xf4, 0xbc,
+    0x65, 0x9e, 0x80, 0x4e, 0x70, 0x1, 0xc9, 0x26, 0xc0, 0x60, 0x80, 0x1f, 0x38, 0x50, 0x5, 0xe0,
+    0x1f, 0xc6, 0x24, 0x16, 0x1, 0xf3, 0x80, 0x14, 0x58, 0xe4, 0x3, 0x92, 0x4c, 0x4, 0x25, 0x1b,
+    0xa6, 0x27, 0x2d, 0xa8, 0x3, 0x5c, 0xab, 0x3b, 0xd7, 0x20, 0x1e, 0x6b, 0xff, 0x75, 0xa0, 0x70,
+    0x30, 0x7, 0xfc, 0x80, 0x60, 0x1f, 0xe2, 0x35, 0x0, 0xff, 0xb8, 0x20, 0x2, 0x20, 0xe, 0x2c,
+    0x38, 0x20, 0x0, 0xee, 0xaa, 0x27, 0x34, 0xe1, 0xc0, 0x21, 0x81, 0x47, 0x61, 0x7d, 0x70, 0x8,
+
+    /* U+003A ":" */
+    0x6f, 0x7d, 0xb, 0x95, 0xf2, 0xa3, 0x0, 0xff, 0xe3, 0x1d, 0x1c, 0x2f, 0xe8, 0x58,
+
+    /* U+003B ";" */
+    0x6f, 0x7d, 0xb, 0x95, 0xf2, 0xa3, 0x0, 0xff, 0xe3, 0x14, 0x9c, 0x37, 0xe0, 0x33, 0x3, 0xc,
+    0x1d, 0x4c, 0x4a, 0x0,
+
+    /* U+003C "<" */
+    0x0, 0xff, 0x30, 0x80, 0x7c, 0x53, 0xf2, 0x1, 0xe5, 0xcd, 0x77, 0x70, 0x80, 0xa, 0x3a, 0x9e,
+    0xba, 0x4, 0xa, 0xf5, 0x99, 0xb6, 0xa0, 0x19, 0xd0, 0xf2, 0x8, 0x3, 0xc8, 0xe5, 0xb6, 0x80,
+    0x1e, 0x18, 0xea, 0x7b, 0xe7, 0x10, 0xf, 0x2e, 0x61, 0xe3, 0xa9, 0x0, 0x3c, 0x73, 0xf2, 0xf6,
+    0x40, 0x1f, 0x9b, 0x70, 0x80,
+
+    /* U+003D "=" */
+    0x2, 0x2f, 0xf0, 0x2e, 0xef, 0xf8, 0x92, 0xab, 0xfc, 0x42, 0xab, 0xfe, 0x0, 0xff, 0xe7, 0x11,
+    0x7f, 0x81, 0x77, 0x7f, 0xc4, 0x95, 0x5f, 0xe2,
+
+    /* U+003E ">" */
+    0x25, 0x0, 0xff, 0x35, 0x74, 0x8, 0x7, 0xc9, 0x8e, 0xee, 0xb4, 0x0, 0xf1, 0xcf, 0xcb, 0xde,
+    0xb8, 0x80, 0x79, 0xb3, 0x9, 0x1d, 0x40, 0x1f, 0x1c, 0xe0, 0xa9, 0x0, 0x79, 0xb3, 0x7, 0x4,
+    0x1, 0x14, 0xf4, 0xbd, 0xeb, 0x80, 0x17, 0x35, 0xdb, 0xad, 0x0, 0x25, 0xa7, 0xae, 0x81, 0x0,
+    0xe7, 0xdb, 0x50, 0xf, 0xc0,
+
+    /* U+003F "?" */
+    0x0, 0x1c, 0xef, 0xfb, 0xad, 0x40, 0x29, 0xc6, 0x6c, 0xa9, 0x56, 0xc, 0xd7, 0x5c, 0xca, 0xf8,
+    0xd1, 0xdb, 0x24, 0x40, 0x30, 0xf0, 0x58, 0x18, 0x7, 0xc4, 0x1, 0xff, 0x10, 0x28, 0x7, 0xf7,
+    0x5, 0x80, 0x7e, 0xb3, 0xa2, 0x0, 0xf0, 0xe2, 0x52, 0x80, 0x7d, 0x47, 0x4a, 0x1, 0xf1, 0x22,
+    0x14, 0x3, 0xf3, 0x17, 0x0, 0x7f, 0x26, 0xa8, 0x7, 0xff, 0x24, 0x5c, 0x80, 0x3f, 0xae, 0x24,
+    0x3, 0xfb, 0x3, 0x0, 0x30,
+
+    /* U+0040 "@" */
+    0x0, 0xf0, 0xb5, 0x6f, 0xfd, 0xb4, 0xc0, 0x1f, 0xfa, 0x3a, 0x2, 0xef, 0x82, 0x3d, 0xc0, 0x3f,
+    0x16, 0xb4, 0xf5, 0x32, 0x24, 0xd5, 0xd5, 0x3a, 0x20, 0x1c, 0x58, 0x3e, 0xc0, 0x1f, 0xcb, 0xed,
+    0xe2, 0x1, 0xbc, 0xb0, 0x40, 0xd, 0x9f, 0xed, 0x70, 0x2f, 0x7b, 0x2d, 0x0, 0x9c, 0xb8, 0x2,
+    0xc9, 0x69, 0xa5, 0xad, 0x60, 0xb, 0x4d, 0x40, 0x12, 0xe4, 0x0, 0xb3, 0xba, 0x65, 0x8d, 0x79,
+    0x0, 0x85, 0xe0, 0x10, 0x68, 0x0, 0x88, 0x84, 0x0, 0xea, 0x0, 0xea, 0x22, 0x61, 0x10, 0x1,
+    0xa0, 0xe0, 0x1f, 0x50, 0x6, 0x21, 0x72, 0x70, 0x9, 0x4c, 0x3, 0xf2, 0x0, 0x71, 0x10, 0x4c,
+    0x2, 0x17, 0x0, 0xfc, 0x20, 0x1c, 0xfe, 0x1, 0xc2, 0xe0, 0x1f, 0x98, 0x3, 0xe1, 0x30, 0x9,
+    0x4c, 0x40, 0x3e, 0x30, 0xe, 0x6e, 0xd7, 0x0, 0xa8, 0x24, 0x3, 0xc3, 0x20, 0x18, 0x49, 0x50,
+    0x88, 0x0, 0x35, 0x76, 0x0, 0xc3, 0x44, 0x1c, 0x0, 0x61, 0x33, 0xd, 0x0, 0x54, 0x93, 0x8e,
+    0xd3, 0xef, 0xa4, 0xee, 0x98, 0xb0, 0x4, 0x39, 0x0, 0x57, 0x21, 0x12, 0x93, 0x83, 0xe7, 0x9,
+    0x4a, 0x0, 0x63, 0xe0, 0xc, 0xd9, 0xfe, 0xd7, 0x0, 0x16, 0x7e, 0xa8, 0x6, 0xe2, 0xc1, 0x0,
+    0xff, 0xe3, 0x96, 0xf, 0xb0, 0x7, 0xe2, 0x0, 0xff, 0x16, 0xb4, 0xf4, 0xb2, 0x21, 0x63, 0x34,
+    0xc0, 0x3f, 0xe8, 0xe8, 0x3b, 0xbc, 0x8b, 0x66, 0x1, 0xe0,
+
+    /* U+0041 "A" */
+    0x0, 0xf9, 0xfe, 0xc0, 0x3f, 0xf8, 0x72, 0x8, 0x40, 0x1f, 0xfc, 0x16, 0x19, 0xb, 0x0, 0xff,
+    0xe0, 0xd9, 0x32, 0xb0, 0x80, 0x7f, 0xc8, 0x56, 0x12, 0x12, 0x1, 0xff, 0x40, 0xb0, 0x19, 0x98,
+    0x3, 0xfc, 0x66, 0x60, 0xa, 0x45, 0x80, 0x3f, 0xa4, 0x24, 0x2, 0x51, 0xb0, 0xf, 0xc4, 0xaa,
+    0x10, 0xd, 0x24, 0xa0, 0x1f, 0x50, 0x48, 0x7, 0x30, 0x48, 0x7, 0x85, 0xc8, 0x48, 0xb8, 0xd4,
+    0xcc, 0x1, 0xcc, 0x5, 0xbb, 0xf2, 0x84, 0x80, 0x74, 0x8d, 0x57, 0xf1, 0xa9, 0x0, 0x4a, 0x32,
+    0xab, 0xfd, 0x1, 0x60, 0x14, 0x3, 0x80, 0x7f, 0x21, 0x30, 0x82, 0x13, 0x80, 0x7f, 0xd6, 0xc,
+    0x1e, 0x14, 0x1, 0xff, 0x30, 0xc8, 0x0,
+
+    /* U+0042 "B" */
+    0x4f, 0xff, 0xdd, 0x6a, 0x1, 0xc6, 0xef, 0xe5, 0x4a, 0xa0, 0x6, 0x48, 0x8f, 0x5f, 0x22, 0xb8,
+    0x7, 0xfc, 0x34, 0x16, 0x1, 0xff, 0x84, 0x44, 0x1, 0xff, 0xc1, 0x12, 0x0, 0xff, 0xce, 0x14,
+    0x1, 0x9, 0x17, 0x96, 0xa1, 0x58, 0x2, 0x6d, 0xdf, 0x52, 0x9c, 0x0, 0x65, 0xaa, 0xf4, 0xb9,
+    0x6c, 0x0, 0x44, 0xab, 0xe6, 0x8e, 0x47, 0x40, 0xf, 0xfd, 0x21, 0xc0, 0x1f, 0xf8, 0x81, 0x80,
+    0x3f, 0xf1, 0x83, 0x0, 0x7f, 0xc3, 0xe1, 0xe0, 0x4, 0x88, 0xfa, 0xf8, 0xd9, 0x40, 0x6, 0xef,
+    0xf3, 0x2e, 0x48, 0x0,
+
+    /* U+0043 "C" */
+    0x0, 0xe5, 0xad, 0xff, 0x75, 0x28, 0x7, 0x8f, 0x69, 0x45, 0x57, 0x56, 0x98, 0x4, 0xb8, 0x4f,
+    0xd9, 0x54, 0xbf, 0x93, 0xd0, 0x1, 0xd0, 0xe4, 0x8, 0x7, 0x36, 0x68, 0x3, 0xc2, 0x8c, 0x3,
+    0xf1, 0x18, 0x19, 0x95, 0x0, 0x3f, 0xf5, 0x87, 0x0, 0x7f, 0xf0, 0x48, 0x14, 0x3, 0xff, 0x82,
+    0x20, 0x20, 0x1f, 0xfc, 0x11, 0x1, 0x0, 0xff, 0xe0, 0x90, 0x28, 0x7, 0xff, 0x6, 0xc3, 0x80,
+    0x3f, 0xf8, 0x26, 0x65, 0x40, 0xf, 0xfe, 0xf, 0x85, 0x18, 0x7, 0xe2, 0x30, 0x1, 0xd0, 0xe4,
+    0x8, 0x7, 0x36, 0xe8, 0x2, 0x5c, 0x27, 0xec, 0xaa, 0x5f, 0xc9, 0x68, 0x6, 0x3d, 0xa5, 0x25,
+    0x5d, 0x5a, 0x60,
+
+    /* U+0044 "D" */
+    0x4f, 0xff, 0xdb, 0x28, 0x1, 0xf1, 0xb3, 0x72, 0x8b, 0x5e, 0x10, 0x7, 0x24, 0xcf, 0x56, 0x73,
+    0x1e, 0x98, 0x7, 0xfe, 0x19, 0xb0, 0xd1, 0x0, 0xff, 0xe0, 0xa5, 0xd, 0x80, 0x7f, 0xf0, 0x94,
+    0xd4, 0x40, 0x3f, 0xf8, 0x56, 0x8, 0x1, 0xff, 0xc2, 0x40, 0xd0, 0xf, 0xfe, 0x10, 0x80, 0x80,
+    0x7f, 0xf0, 0x84, 0x4, 0x3, 0xff, 0x84, 0x81, 0xa0, 0x1f, 0xfc, 0x2b, 0x4, 0x0, 0xff, 0xe0,
+    0xa9, 0xa8, 0x80, 0x7f, 0xe4, 0xa1, 0xb0, 0xf, 0xf8, 0x62, 0xc3, 0x44, 0x2, 0x49, 0x9e, 0xac,
+    0xe7, 0x3d, 0x30, 0xc, 0x6c, 0xdc, 0xa2, 0xd7, 0x84, 0x1,
+
+    /* U+0045 "E" */
+    0x4f, 0xff, 0xf9, 0x0, 0x6, 0xcd, 0xfe, 0x0, 0x24, 0xcf, 0xf1, 0x0, 0x7f, 0xfa, 0x92, 0x23,
+    0xf0, 0x80, 0x46, 0xef, 0xf8, 0x80, 0x27, 0xff, 0xfc, 0x60, 0x1f, 0xff, 0x84, 0x99, 0xfe, 0x50,
+    0x1, 0xb3, 0x7f, 0x60,
+
+    /* U+0046 "F" */
+    0x4f, 0xff, 0xf9, 0x0, 0x6, 0xcd, 0xfe, 0x0, 0x24, 0xcf, 0xf1, 0x0, 0x7f, 0xfd, 0xdf, 0xff,
+    0xf1, 0x80, 0x46, 0xcd, 0xf8, 0x80, 0x24, 0x99, 0xfc, 0x20, 0x1f, 0xff, 0xf0, 0xc,
+
+    /* U+0047 "G" */
+    0x0, 0xe5, 0xad, 0xff, 0x75, 0xb8, 0x80, 0x71, 0xed, 0x28, 0xab, 0x2a, 0xa3, 0xd4, 0x2, 0x5c,
+    0x27, 0xec, 0xa9, 0xbe, 0xa3, 0xa2, 0x3, 0xa0, 0xc8, 0x10, 0xe, 0x5c, 0xb2, 0xf, 0xb, 0x30,
+    0xf, 0xc2, 0x80, 0x66, 0x54, 0x0, 0xff, 0xd6, 0x1c, 0x1, 0xff, 0xc1, 0x20, 0x50, 0xf, 0xfe,
+    0x8, 0x80, 0x80, 0x7f, 0x8e, 0x8, 0x40, 0x40, 0x3f, 0xc8, 0xec, 0x40, 0xa0, 0x1f, 0xfc, 0x1b,
+    0xe, 0x0, 0xff, 0xe0, 0x99, 0x95, 0x0, 0x3f, 0xf8, 0x3e, 0x16, 0x60, 0x1f, 0xf8, 0xe8, 0x32,
+    0x4, 0x3, 0x92, 0x80, 0x32, 0xe1, 0x3f, 0x65, 0x4d, 0xf5, 0x94, 0xa0, 0x4, 0x7b, 0x4a, 0x2a,
+    0xca, 0xa8, 0xe6, 0x0,
+
+    /* U+0048 "H" */
+    0x4f, 0x80, 0xf, 0xf7, 0xe0, 0x7, 0xff, 0xfc, 0x3, 0xff, 0x8a, 0x93, 0x3f, 0xe0, 0xc, 0x6c,
+    0xdf, 0xe0, 0xc, 0xff, 0xff, 0xe0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0x50,
+
+    /* U+0049 "I" */
+    0x4f, 0x80, 0xf, 0xff, 0x20,
+
+    /* U+004A "J" */
+    0x0, 0x3f, 0xff, 0xce, 0x0, 0x36, 0x6e, 0x40, 0xc, 0x93, 0x3d, 0xc0, 0x1f, 0xff, 0xf0, 0xf,
+    0xfe, 0xc0, 0x81, 0x88, 0x7, 0x60, 0x10, 0x6e, 0x10, 0x4, 0x4c, 0x28, 0x16, 0x5b, 0x73, 0x5a,
+    0x16, 0x0, 0x5d, 0x55, 0x32, 0x23, 0x14, 0x0,
+
+    /* U+004B "K" */
+    0x4f, 0x80, 0xf, 0xc5, 0xda, 0x20, 0x1f, 0xe2, 0xc0, 0xc1, 0x0, 0xfe, 0x2c, 0xc, 0x10, 0xf,
+    0xe1, 0xf1, 0xd2, 0x0, 0xfe, 0x1c, 0x2c, 0x30, 0xf, 0xe1, 0xc2, 0xb3, 0x0, 0xfe, 0x1d, 0x2b,
+    0x40, 0xf, 0xf6, 0x9c, 0x20, 0x7, 0xfa, 0xcc, 0x2c, 0x3, 0xfd, 0x69, 0xc, 0x74, 0x1, 0xf9,
+    0xd2, 0x1e, 0x51, 0x5c, 0x3, 0xf3, 0xb8, 0x1, 0x45, 0xa, 0x1, 0xe5, 0x80, 0x8, 0x7c, 0x68,
+    0xc0, 0x38, 0x80, 0x38, 0xb4, 0x34, 0x40, 0x3f, 0xe3, 0xa1, 0xd0, 0xf, 0xfc, 0xb0, 0x74, 0x1,
+    0xff, 0x9d, 0x96, 0x0,
+
+    /* U+004C "L" */
+    0x4f, 0x80, 0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xa2, 0x93, 0x3f, 0xa0, 0x0, 0x6c,
+    0xdf, 0xc0,
+
+    /* U+004D "M" */
+    0x4f, 0x70, 0xf, 0xfe, 0xc, 0xf9, 0x80, 0x20, 0x40, 0x3f, 0xe2, 0x60, 0xe, 0xb0, 0xf, 0xfa,
+    0x40, 0x38, 0x54, 0xc0, 0x3f, 0x91, 0x4, 0x1, 0xa4, 0xbc, 0x3, 0xfa, 0x4d, 0x40, 0x3a, 0xd,
+    0x80, 0x3e, 0x72, 0xf0, 0xf, 0x2a, 0x40, 0x7, 0x86, 0x14, 0xc0, 0x3e, 0x91, 0x80, 0xe, 0x80,
+    0xb0, 0xf, 0xc4, 0xce, 0x40, 0x11, 0xb4, 0x8, 0x7, 0xf4, 0xc, 0x80, 0x5e, 0x2e, 0x1, 0xfe,
+    0x18, 0x44, 0x2, 0x9d, 0x80, 0x7f, 0xe6, 0x29, 0x8, 0x35, 0x0, 0xff, 0xe0, 0xc9, 0x69, 0x78,
+    0x7, 0xff, 0x9, 0x10, 0x4a, 0x60, 0x1f, 0xfc, 0x39, 0x3b, 0x0, 0xff, 0xe2, 0x16, 0x8, 0x7,
+    0xff, 0x3c,
+
+    /* U+004E "N" */
+    0x4f, 0x90, 0xf, 0xf7, 0xe0, 0x1, 0x94, 0x3, 0xff, 0x85, 0x44, 0x1, 0xff, 0x90, 0x3c, 0x40,
+    0x3f, 0xe3, 0xa2, 0xa0, 0xf, 0xfc, 0xac, 0x8e, 0x1, 0xff, 0xa4, 0xe1, 0x0, 0x3f, 0xf6, 0x8d,
+    0x8, 0x7, 0xfc, 0x34, 0x3a, 0x1, 0xff, 0x91, 0xce, 0x40, 0x3f, 0xf4, 0x23, 0x28, 0x7, 0xfe,
+    0xa1, 0xa2, 0x0, 0xff, 0x87, 0x43, 0xc0, 0x3f, 0xf1, 0xc9, 0x58, 0x7, 0xfe, 0x65, 0x40, 0xf,
+    0xfe, 0xd, 0x10, 0x7, 0xff, 0xb, 0xc0, 0x0,
+
+    /* U+004F "O" */
+    0x0, 0xe5, 0xad, 0xff, 0x75, 0xb0, 0x7, 0xe3, 0xda, 0x51, 0x55, 0x92, 0x79, 0x0, 0x39, 0x70,
+    0xa3, 0xb2, 0xa9, 0x7f, 0x23, 0x6e, 0x1, 0x1d, 0xe, 0x38, 0x80, 0x73, 0x69, 0x42, 0x0, 0x3c,
+    0x28, 0xc0, 0x3f, 0x17, 0x85, 0x1, 0x99, 0x50, 0x3, 0xfc, 0x4e, 0x2b, 0x61, 0xc0, 0x1f, 0xfa,
+    0x83, 0xc8, 0x14, 0x3, 0xff, 0x10, 0x38, 0x80, 0x80, 0x7f, 0xf0, 0x44, 0xc4, 0x4, 0x3, 0xff,
+    0x82, 0x26, 0x40, 0xa0, 0x1f, 0xf8, 0x81, 0xec, 0x38, 0x3, 0xff, 0x50, 0x79, 0x99, 0x50, 0x3,
+    0xfc, 0x4e, 0x2a, 0x1e, 0x14, 0x60, 0x1f, 0x8b, 0xc2, 0x80, 0x7, 0x43, 0x8e, 0x20, 0x1c, 0xda,
+    0x50, 0x80, 0x12, 0xe1, 0x47, 0x65, 0x52, 0xfe, 0x46, 0xdc, 0x3, 0x8f, 0x69, 0x45, 0x56, 0x49,
+    0xe4, 0x0, 0x80,
+
+    /* U+0050 "P" */
+    0x4f, 0xff, 0xba, 0xd4, 0x3, 0x8d, 0x9b, 0x95, 0x2b, 0x48, 0x2, 0x49, 0x9e, 0xbf, 0x82, 0xf0,
+    0xf, 0xf9, 0xdc, 0x4e, 0x1, 0xff, 0x48, 0x58, 0x7, 0xfc, 0x23, 0x0, 0x7f, 0xe1, 0x0, 0xff,
+    0xc6, 0xe, 0x1, 0xff, 0x78, 0x70, 0x7, 0xe2, 0x6d, 0x36, 0x40, 0x3, 0xff, 0xf6, 0xc9, 0xcc,
+    0x80, 0x23, 0x66, 0xe8, 0xbe, 0x60, 0xc, 0x93, 0x3c, 0xe8, 0x1, 0xff, 0xf0,
+
+    /* U+0051 "Q" */
+    0x0, 0xe5, 0xad, 0xff, 0x75, 0xb0, 0x7, 0xf1, 0xed, 0x28, 0xaa, 0xc9, 0x3c, 0x80, 0x1e, 0x5c,
+    0x28, 0xec, 0xaa, 0x5f, 0xc8, 0xdb, 0x80, 0x63, 0xa1, 0xc7, 0x10, 0xe, 0x6d, 0x28, 0x40, 0xb,
+    0xc2, 0x8c, 0x3, 0xf1, 0x78, 0x50, 0x0, 0xcc, 0xa8, 0x1, 0xfe, 0x27, 0x15, 0xb, 0xe, 0x0,
+    0xff, 0xd4, 0x1e, 0x4, 0xa, 0x1, 0xff, 0x88, 0x1c, 0x4, 0x4, 0x3, 0xff, 0x82, 0x26, 0x2,
+    0x2, 0x1, 0xff, 0xc1, 0x13, 0x2, 0x5, 0x0, 0xff, 0xc4, 0xe, 0x16, 0x1c, 0x1, 0xff, 0xa8,
+    0x3c, 0xc, 0xca, 0x80, 0x1f, 0xe2, 0x71, 0x50, 0x7, 0x85, 0x18, 0x7, 0xe2, 0xf0, 0xa0, 0x8,
+    0xe8, 0x71, 0xc4, 0x3, 0x9b, 0x4a, 0x10, 0x3, 0x2e, 0x14, 0x76, 0x55, 0x2f, 0xe4, 0x6d, 0xc0,
+    0x3c, 0x7b, 0x4a, 0x2a, 0xa4, 0x44, 0xf2, 0x0, 0x7f, 0x2d, 0x6f, 0xa0, 0xb, 0x0, 0x66, 0x10,
+    0xf, 0xeb, 0x55, 0x6a, 0x91, 0xd4, 0xb8, 0x7, 0xfa, 0xa4, 0xeb, 0x71, 0x25, 0x80, 0x3f, 0xe6,
+    0xec, 0xbc, 0xe6, 0x0,
+
+    /* U+0052 "R" */
+    0x4f, 0xff, 0xba, 0xd8, 0x3, 0xc6, 0xcd, 0xca, 0x93, 0xa4, 0x1, 0x92, 0x67, 0xaf, 0xe0, 0xbc,
+    0x3, 0xff, 0x3b, 0x89, 0xc0, 0x3f, 0xf4, 0x85, 0x80, 0x7f, 0xe1, 0x11, 0x0, 0x7f, 0xf0, 0x44,
+    0xc0, 0x3f, 0xf1, 0x83, 0x80, 0x7f, 0xef, 0xe, 0x0, 0xfe, 0x26, 0xd3, 0x74, 0x0, 0x9f, 0xff,
+    0xb6, 0x4e, 0x60, 0x3, 0x1b, 0xbf, 0x20, 0x5b, 0x0, 0x72, 0x44, 0x75, 0x95, 0x88, 0x7, 0xfe,
+    0xe1, 0xa0, 0xf, 0xfc, 0x6e, 0x8c, 0x1, 0xff, 0xa0, 0xe4, 0x80, 0x3f, 0xf7, 0x7, 0x0,
+
+    /* U+0053 "S" */
+    0x0, 0x9f, 0x3b, 0xfd, 0xb2, 0x80, 0x11, 0xf4, 0xa, 0x3b, 0xb, 0x5d, 0x0, 0x38, 0x6b, 0x6a,
+    0x27, 0x3e, 0x34, 0x14, 0x9d, 0x40, 0x3c, 0xee, 0x2, 0xc, 0x0, 0xff, 0x8, 0x18, 0x7, 0xf9,
+    0xc6, 0x14, 0x3, 0xf8, 0x68, 0x6b, 0xa5, 0x0, 0x3e, 0x4f, 0x82, 0x6b, 0xfc, 0x70, 0xe, 0x17,
+    0xce, 0xa6, 0x28, 0xe5, 0x0, 0xf0, 0xac, 0xf5, 0xd, 0x10, 0x7, 0xf2, 0xd0, 0x50, 0x7, 0xf9,
+    0xc0, 0x48, 0x40, 0x3f, 0x38, 0x74, 0xfb, 0x0, 0x78, 0xec, 0x1a, 0x4a, 0x7e, 0xe6, 0x27, 0x30,
+    0x36, 0x25, 0x96, 0xcd, 0x3b, 0x3, 0xf2, 0x0,
+
+    /* U+0054 "T" */
+    0xef, 0xff, 0xfd, 0x6c, 0xde, 0x1, 0x66, 0xed, 0x89, 0x9e, 0x2, 0x99, 0xe6, 0x0, 0xff, 0xff,
+    0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xfc, 0x40,
+
+    /* U+0055 "U" */
+    0x6f, 0x60, 0xf, 0xe5, 0xf6, 0x0, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xc, 0xc, 0x83, 0x80, 0x3f,
+    0xb8, 0x19, 0x41, 0x40, 0x3f, 0x90, 0xc, 0x54, 0x94, 0x3, 0xe5, 0x35, 0x0, 0x40, 0x53, 0x0,
+    0x73, 0x50, 0x40, 0x0, 0xb0, 0x67, 0xae, 0x6b, 0xa4, 0x70, 0x80, 0x23, 0xf8, 0x24, 0x65, 0x28,
+    0xf3, 0x0,
+
+    /* U+0056 "V" */
+    0xbf, 0x30, 0xf, 0xf9, 0x7d, 0xfc, 0x24, 0x3, 0xfe, 0x90, 0x64, 0x25, 0x10, 0xf, 0xe3, 0x33,
+    0x8, 0x58, 0x48, 0x7, 0xf4, 0x85, 0x80, 0x18, 0x58, 0x3, 0xf0, 0xaa, 0x10, 0x4, 0xc2, 0xc0,
+    0x1f, 0x48, 0x78, 0x6, 0x90, 0xa0, 0xf, 0x98, 0x90, 0x3, 0xa, 0x99, 0x80, 0x39, 0x86, 0xc0,
+    0x3d, 0x21, 0x0, 0x1d, 0x62, 0xc0, 0x1e, 0x33, 0x21, 0x0, 0x48, 0x4c, 0x1, 0xfa, 0x42, 0x80,
+    0x2f, 0x9, 0x0, 0xfc, 0xa2, 0xe0, 0x2, 0x45, 0x10, 0xf, 0xe9, 0x6, 0xb, 0x9, 0x0, 0xff,
+    0x30, 0x58, 0xb1, 0x98, 0x3, 0xfc, 0x2c, 0x54, 0x12, 0x1, 0xff, 0xac, 0x10, 0x54, 0x3, 0xff,
+    0x12, 0x4, 0x80, 0x7c,
+
+    /* U+0057 "W" */
+    0xe, 0xe0, 0x7, 0xf4, 0xfa, 0x80, 0x7e, 0x1f, 0xa0, 0x71, 0x30, 0xf, 0xce, 0x1c, 0x1, 0xf9,
+    0xc3, 0x83, 0x42, 0xc0, 0x3e, 0x41, 0x12, 0x8, 0x7, 0xda, 0x8, 0x8, 0x2a, 0x1, 0xf6, 0x85,
+    0x83, 0x80, 0x78, 0x51, 0x40, 0x27, 0x23, 0x0, 0xf3, 0xaa, 0x83, 0x40, 0x3c, 0xe1, 0xc0, 0x16,
+    0x85, 0x80, 0x72, 0xf, 0x82, 0xa0, 0x80, 0x76, 0x82, 0x0, 0x48, 0x2a, 0x1, 0xdc, 0xa, 0x1c,
+    0xe, 0x1, 0x85, 0x14, 0x3, 0x9c, 0x8c, 0x3, 0x2a, 0x80, 0x8, 0x1a, 0x1, 0x9c, 0x38, 0x3,
+    0xb4, 0x2c, 0x2, 0x50, 0xe0, 0x9, 0x50, 0x40, 0x2d, 0x4, 0x0, 0xe4, 0x15, 0x0, 0xbc, 0x50,
+    0x2, 0xe0, 0x70, 0x0, 0xa2, 0x80, 0x7c, 0xe4, 0x60, 0x5, 0x40, 0xc, 0x83, 0x40, 0x7, 0xe,
+    0x0, 0xfb, 0x42, 0xc1, 0x43, 0x80, 0x39, 0xcc, 0x43, 0x41, 0x0, 0x3e, 0x41, 0x50, 0xe1, 0x40,
+    0xe, 0xd0, 0x71, 0x45, 0x0, 0xfe, 0x72, 0x34, 0x70, 0xf, 0x20, 0xd3, 0x87, 0x0, 0x7f, 0x68,
+    0x70, 0x68, 0x7, 0xce, 0x76, 0x8, 0x1, 0xfc, 0x82, 0x42, 0x80, 0x1f, 0x50, 0x12, 0x80, 0x7f,
+    0xce, 0xe, 0x1, 0xf8, 0xc4, 0x38, 0x3, 0x80,
+
+    /* U+0058 "X" */
+    0xc, 0xf3, 0x0, 0xfc, 0xdf, 0x0, 0xe, 0xd, 0x10, 0xf, 0x14, 0x9c, 0x0, 0xa, 0x46, 0xc0,
+    0x3d, 0xe1, 0xc0, 0x19, 0x95, 0x4c, 0x1, 0xa4, 0xa8, 0x80, 0x3a, 0x8a, 0x48, 0x0, 0xac, 0xc5,
+    0x0, 0xfb, 0x83, 0xc0, 0x6c, 0xa4, 0x3, 0xf1, 0xc1, 0x4d, 0xf, 0x80, 0x7f, 0x9d, 0x19, 0x24,
+    0x80, 0x3f, 0xed, 0x0, 0x20, 0x7, 0xfc, 0x52, 0x41, 0xe0, 0x1f, 0xf7, 0x7, 0xc1, 0x48, 0x7,
+    0xf4, 0x9c, 0x93, 0xa3, 0x28, 0x7, 0xc8, 0xca, 0xc0, 0xa, 0x1b, 0x20, 0xe, 0x1a, 0x1b, 0x0,
+    0x86, 0x87, 0x80, 0x3b, 0x46, 0x84, 0x3, 0x23, 0x9c, 0x0, 0x50, 0x6e, 0x80, 0x1e, 0x83, 0x74,
+    0x3, 0x73, 0x80, 0xf, 0xdc, 0x14, 0x20,
+
+    /* U+0059 "Y" */
+    0xaf, 0x30, 0xf, 0xf6, 0xf0, 0x58, 0x70, 0x7, 0xf3, 0x95, 0x80, 0xc1, 0x30, 0x7, 0xc3, 0x8,
+    0xa0, 0x7, 0x29, 0x10, 0xf, 0x58, 0x48, 0x6, 0x90, 0xb0, 0xe, 0x45, 0x72, 0x0, 0xc8, 0xaa,
+    0x40, 0xd, 0x25, 0x0, 0x1e, 0xb0, 0x90, 0x9, 0xca, 0x40, 0x3e, 0x18, 0x27, 0x2, 0x84, 0x40,
+    0x7, 0xe7, 0x28, 0x19, 0x9, 0x0, 0xff, 0x70, 0x62, 0x41, 0x0, 0x7f, 0x8d, 0x48, 0x8e, 0x1,
+    0xff, 0xb8, 0x14, 0x3, 0xff, 0xfe, 0x1, 0xff, 0x80,
+
+    /* U+005A "Z" */
+    0xcf, 0xff, 0xfd, 0x34, 0xcd, 0xfe, 0x0, 0x63, 0x4c, 0xff, 0x8, 0x32, 0x80, 0x7f, 0x23, 0x9c,
+    0x80, 0x7f, 0x15, 0x8e, 0x80, 0x7f, 0xbc, 0x28, 0x40, 0x3f, 0xa8, 0xa1, 0x0, 0x3f, 0x9d, 0x54,
+    0xe0, 0x1f, 0xc7, 0x5, 0x40, 0x1f, 0xc3, 0xa1, 0xe0, 0x1f, 0xed, 0x1a, 0x20, 0xf, 0xe9, 0x37,
+    0x50, 0xf, 0xe5, 0x64, 0x80, 0xf, 0xe3, 0xa1, 0xa0, 0xf, 0xe1, 0xe0, 0xd1, 0x0, 0xfe, 0xa2,
+    0x25, 0x4c, 0xff, 0x3a, 0x81, 0x33, 0x7f, 0xa8,
+
+    /* U+005B "[" */
+    0x4f, 0xfc, 0x40, 0x4, 0x88, 0x10, 0x3, 0x1d, 0xc0, 0x1f, 0xff, 0xf0, 0xf, 0xfe, 0xc6, 0x3b,
+    0x80, 0x24, 0x88, 0x10,
+
+    /* U+005C "\\" */
+    0xae, 0x0, 0xfd, 0xe2, 0x60, 0x1f, 0x28, 0x50, 0x7, 0xe5, 0x70, 0xf, 0xdc, 0x28, 0x1, 0xf2,
+    0xe, 0x80, 0x7e, 0x77, 0x0, 0x7e, 0xd1, 0x40, 0xf, 0x90, 0x78, 0x3, 0xf3, 0xa8, 0x7, 0xea,
+    0x5, 0x0, 0xf8, 0xc7, 0xc0, 0x3f, 0x32, 0x80, 0x7e, 0xb0, 0x50, 0xf, 0x8c, 0xb8, 0x3, 0xf2,
+    0xa0, 0x80, 0x7d, 0x40, 0xe0, 0x1f, 0x11, 0x34, 0x3, 0xf5, 0x20, 0x80, 0x7c, 0xa0, 0xe0, 0x1f,
+    0x11, 0xd0, 0x7, 0xeb, 0x32, 0x0, 0xf9, 0x81, 0x40,
+
+    /* U+005D "]" */
+    0x8f, 0xfb, 0xae, 0x20, 0x20, 0x6e, 0xe3, 0x0, 0xff, 0xff, 0x80, 0x7f, 0xf1, 0xd, 0xdc, 0x61,
+    0x71, 0x1, 0x0,
+
+    /* U+005E "^" */
+    0x0, 0xc3, 0xfa, 0x1, 0xf9, 0x84, 0x90, 0x3, 0xea, 0x95, 0xf0, 0xf, 0x21, 0x34, 0xa1, 0x0,
+    0x77, 0xa8, 0x99, 0x50, 0x6, 0x24, 0x90, 0x5, 0xb0, 0x6, 0xa2, 0x30, 0x3, 0xa, 0x80, 0x4d,
+    0x60, 0x19, 0xa4, 0x0, 0xc2, 0xc0, 0x1a, 0x8c, 0xc1, 0x4c, 0x1, 0xc6, 0x6a,
+
+    /* U+005F "_" */
+    0xff, 0xff, 0xdb, 0xbf, 0xf8,
+
+    /* U+0060 "`" */
+    0x4e, 0xd2, 0x0, 0x27, 0x8e, 0x18, 0x0, 0x71, 0xb1, 0x0,
+
+    /* U+0061 "a" */
+    0x0, 0x2d, 0xf7, 0xfb, 0x1c, 0x0, 0x3b, 0x4a, 0x8e, 0xc3, 0x18, 0x2, 0x15, 0xd5, 0x13, 0xaa,
+    0x6e, 0x1a, 0xa0, 0x1d, 0x61, 0x60, 0x1f, 0x84, 0x88, 0x1, 0xfc, 0x20, 0x2, 0xae, 0xff, 0xe3,
+    0x2, 0xc4, 0x9b, 0xcc, 0xc4, 0x14, 0x34, 0xe8, 0x67, 0x84, 0x8, 0x10, 0x3, 0xc4, 0x4, 0xa,
+    0x1, 0xd2, 0x21, 0x25, 0x50, 0x88, 0x6c, 0x53, 0x1, 0xc7, 0x5b, 0xbd, 0x8e, 0x0,
+
+    /* U+0062 "b" */
+    0xaf, 0x10, 0xf, 0xff, 0xd0, 0xc6, 0xff, 0xb1, 0xc0, 0x3c, 0x5e, 0xef, 0x30, 0xc6, 0x90, 0x6,
+    0xd2, 0xea, 0x89, 0xda, 0x2c, 0x10, 0x8, 0xf0, 0x40, 0x32, 0xc8, 0xc8, 0x5, 0x60, 0x1f, 0x30,
+    0xb0, 0x4, 0x80, 0x1f, 0x9c, 0x44, 0x0, 0x30, 0xf, 0xc2, 0x6, 0x0, 0x30, 0xf, 0xc2, 0x6,
+    0x0, 0x40, 0xf, 0xce, 0x22, 0x0, 0x40, 0x80, 0x79, 0xc5, 0x80, 0x23, 0xd2, 0x0, 0xcd, 0x5,
+    0x0, 0x17, 0x96, 0xdc, 0xcb, 0x64, 0xbc, 0x3, 0x17, 0xbb, 0x34, 0x31, 0xa4, 0x0,
+
+    /* U+0063 "c" */
+    0x0, 0x92, 0xbb, 0xfa, 0xd4, 0x3, 0x55, 0xa2, 0x1d, 0xcb, 0x56, 0x0, 0xa5, 0x6e, 0xa8, 0x9e,
+    0x74, 0x41, 0xaa, 0x48, 0x7, 0x46, 0xa5, 0x4, 0x80, 0x7c, 0x40, 0x82, 0x40, 0x1f, 0xc6, 0x60,
+    0xf, 0xf1, 0x98, 0x3, 0xfc, 0x82, 0x60, 0x1f, 0xd4, 0x10, 0x1, 0xf1, 0x1, 0xb2, 0x50, 0x80,
+    0x69, 0xd4, 0x9, 0x55, 0x75, 0x4d, 0x73, 0x2a, 0x0, 0x2a, 0xd5, 0x19, 0x16, 0xa8, 0x0,
+
+    /* U+0064 "d" */
+    0x0, 0xff, 0xb7, 0x80, 0x3f, 0xfd, 0x6b, 0x7d, 0xfd, 0x44, 0x1, 0xd7, 0x4a, 0x8e, 0xe4, 0xd5,
+    0x0, 0xa9, 0x1b, 0xaa, 0x27, 0x9a, 0x8c, 0x11, 0x52, 0x40, 0x3a, 0x54, 0x43, 0x82, 0x40, 0x3e,
+    0x80, 0x3, 0x89, 0x0, 0x7c, 0x44, 0x3, 0x30, 0x7, 0xf0, 0x81, 0x98, 0x3, 0xf8, 0x41, 0x4,
+    0xc0, 0x3e, 0x22, 0x6, 0x84, 0x0, 0x7d, 0x0, 0x4, 0x54, 0xa0, 0xe, 0x95, 0x10, 0x5, 0x22,
+    0xfd, 0x45, 0x73, 0x52, 0x80, 0x57, 0x48, 0x87, 0x44, 0x6a, 0x80, 0x0,
+
+    /* U+0065 "e" */
+    0x0, 0x96, 0xff, 0xdb, 0x24, 0x1, 0xd7, 0x4c, 0xc7, 0x73, 0x6a, 0x0, 0x54, 0x93, 0xb3, 0x15,
+    0xa5, 0x64, 0x8, 0xae, 0xc0, 0x18, 0xb0, 0x24, 0x38, 0x24, 0x3, 0xc2, 0xc8, 0x2e, 0x42, 0x1,
+    0xf6, 0x2, 0x99, 0x7f, 0xfe, 0xa0, 0x23, 0x1c, 0xcf, 0xf3, 0xa0, 0x88, 0xcf, 0xf8, 0x68, 0x20,
+    0x3, 0xfc, 0x6c, 0xb4, 0x20, 0x18, 0xf4, 0xc0, 0x12, 0xaa, 0xeb, 0x99, 0x66, 0x0, 0x40, 0x2a,
+    0xb5, 0x53, 0x30, 0x23, 0x48, 0x0,
+
+    /* U+0066 "f" */
+    0x0, 0xd3, 0xdf, 0xce, 0x1, 0x5b, 0x2c, 0x3e, 0x80, 0x9, 0x16, 0xde, 0x68, 0x0, 0xe1, 0xe0,
+    0x1f, 0xfc, 0x19, 0xfa, 0xa, 0xff, 0x8f, 0x61, 0x41, 0x62, 0x22, 0x47, 0xf0, 0xc7, 0x78, 0x40,
+    0x3f, 0xff, 0xe0, 0x1f, 0xfc, 0x30,
+
+    /* U+0067 "g" */
+    0x0, 0x96, 0xfb, 0xfa, 0x8c, 0x27, 0xc4, 0x1, 0x74, 0xcc, 0x99, 0x36, 0x38, 0x6, 0xa4, 0x7d,
+    0x86, 0x7c, 0xa8, 0x40, 0x2, 0x2a, 0xa0, 0x3, 0x96, 0x48, 0x1, 0xc1, 0x0, 0x1f, 0x30, 0x80,
+    0x1c, 0x48, 0x3, 0xf2, 0x0, 0xc, 0xc0, 0x1f, 0xc6, 0x0, 0x33, 0x0, 0x7f, 0x10, 0x1, 0x4,
+    0xc0, 0x3f, 0x20, 0x2, 0x82, 0x0, 0x3e, 0x80, 0x8, 0xd5, 0x28, 0x40, 0x34, 0x38, 0x80, 0x54,
+    0xaa, 0xea, 0x9a, 0xe7, 0x94, 0x1, 0x0, 0x55, 0x11, 0xc, 0x88, 0xc6, 0x0, 0xf2, 0xdf, 0x7f,
+    0x51, 0x83, 0x88, 0x7, 0xfc, 0x44, 0x70, 0x5, 0xc9, 0x0, 0x71, 0x78, 0x58, 0x0, 0xdb, 0x72,
+    0x62, 0x6f, 0x4a, 0x88, 0x1, 0x1a, 0xe0, 0xee, 0x66, 0xb5, 0x40, 0x0,
+
+    /* U+0068 "h" */
+    0xaf, 0x10, 0xf, 0xff, 0x81, 0x4e, 0xff, 0xb1, 0x80, 0x32, 0x6b, 0xb9, 0x94, 0xe6, 0x80, 0x2a,
+    0x6e, 0xa9, 0xae, 0x35, 0x50, 0x0, 0xe4, 0x3, 0xf, 0x7, 0x0, 0x24, 0x3, 0xc4, 0x45, 0x0,
+    0x38, 0x7, 0xcc, 0x20, 0x3, 0x0, 0xff, 0xff, 0x80, 0x78,
+
+    /* U+0069 "i" */
+    0xa, 0xe3, 0x5, 0x15, 0xc, 0x96, 0x3, 0x60, 0xf, 0x57, 0x88, 0x7, 0xff, 0x90,
+
+    /* U+006A "j" */
+    0x0, 0xe9, 0xf5, 0x0, 0xe4, 0xd, 0x0, 0xef, 0x89, 0x0, 0xe2, 0x71, 0x0, 0xff, 0xe0, 0xc7,
+    0x98, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xb0, 0x20, 0x1c, 0x80, 0x41, 0x95, 0x18, 0x6e, 0x0, 0x54,
+    0x72, 0x78, 0x0,
+
+    /* U+006B "k" */
+    0xaf, 0x10, 0xf, 0xff, 0xd0, 0xef, 0x98, 0x7, 0xe2, 0xc2, 0xc3, 0x0, 0xf8, 0xb0, 0xb0, 0xc0,
+    0x3e, 0x3c, 0x1c, 0x30, 0xf, 0x8f, 0x3, 0xc, 0x3, 0xe4, 0xc0, 0x63, 0x0, 0xf9, 0xec, 0x88,
+    0xe6, 0x1, 0xf4, 0x96, 0x78, 0x68, 0x80, 0x78, 0xb0, 0x4a, 0x87, 0x40, 0x3d, 0xe2, 0x0, 0x56,
+    0x38, 0x0, 0xe3, 0x0, 0xd2, 0x6e, 0xa0, 0x1f, 0xed, 0x1a, 0x20, 0xf, 0xe1, 0xa0, 0xf0,
+
+    /* U+006C "l" */
+    0xaf, 0x10, 0xf, 0xff, 0x38,
+
+    /* U+006D "m" */
+    0xaf, 0x2, 0xae, 0xfe, 0xb3, 0x0, 0x9f, 0x3f, 0xdb, 0x0, 0x1c, 0xba, 0xcc, 0x87, 0x4c, 0x61,
+    0xd8, 0x68, 0x80, 0xbe, 0x88, 0x5, 0x51, 0x90, 0xf3, 0xa3, 0x3a, 0x7b, 0x4e, 0xec, 0x82, 0x80,
+    0x9, 0x5c, 0x3, 0x14, 0x1, 0xd1, 0x0, 0x67, 0x26, 0x0, 0xb8, 0x3, 0xc8, 0x4, 0x80, 0x1e,
+    0x40, 0x20, 0x2, 0x80, 0x78, 0x81, 0x80, 0x3e, 0x10, 0x10, 0xf, 0xf8, 0x40, 0x3f, 0xff, 0xe0,
+    0x1f, 0xff, 0x70,
+
+    /* U+006E "n" */
+    0xaf, 0x2, 0x9e, 0xff, 0x63, 0x0, 0x65, 0xd4, 0x68, 0x72, 0x9a, 0x0, 0xa9, 0xf6, 0x1e, 0x39,
+    0x15, 0x40, 0x4, 0x80, 0xe, 0xa0, 0xe0, 0x7, 0x80, 0x78, 0x49, 0x40, 0xa, 0x1, 0xf3, 0x8,
+    0x7, 0xff, 0xfc, 0x3, 0xf8,
+
+    /* U+006F "o" */
+    0x0, 0x92, 0xfb, 0xfa, 0xd4, 0x3, 0xaa, 0xd5, 0x1d, 0xcb, 0x56, 0x1, 0x52, 0xb7, 0x54, 0x4f,
+    0x32, 0x58, 0x1a, 0xa4, 0x80, 0x74, 0xaa, 0x22, 0x82, 0x40, 0x3e, 0x80, 0xe4, 0x12, 0x0, 0xf8,
+    0x88, 0xe6, 0x60, 0xf, 0xe1, 0x33, 0x80, 0x3f, 0x84, 0xd0, 0x4c, 0x3, 0xe2, 0x23, 0xd0, 0x40,
+    0x7, 0xd0, 0x1c, 0x6c, 0x94, 0x1, 0xd2, 0xaa, 0x40, 0x95, 0x57, 0xd4, 0x57, 0x32, 0x50, 0x5,
+    0x56, 0x88, 0x74, 0x5a, 0xb0, 0x0,
+
+    /* U+0070 "p" */
+    0xaf, 0x1, 0x8d, 0xff, 0x63, 0x80, 0x78, 0xbd, 0xd9, 0xd8, 0x63, 0x48, 0x3, 0x61, 0x75, 0xc4,
+    0xec, 0x96, 0x8, 0x6, 0xd1, 0x0, 0xcd, 0x23, 0x20, 0x14, 0x8, 0x7, 0x98, 0x58, 0x2, 0x40,
+    0xf, 0xce, 0x22, 0x0, 0x18, 0x7, 0xe1, 0x3, 0x0, 0x18, 0x7, 0xe1, 0x3, 0x0, 0x20, 0x7,
+    0xe7, 0x11, 0x0, 0x20, 0x40, 0x3c, 0xe2, 0xc0, 0x1b, 0x48, 0x3, 0x34, 0xc, 0x80, 0x5a, 0x3b,
+    0x73, 0x2d, 0x92, 0xc1, 0x0, 0x8b, 0x5d, 0x9a, 0x18, 0xd2, 0x0, 0xf4, 0x6f, 0xfb, 0x1c, 0x3,
+    0xff, 0xe0,
+
+    /* U+0071 "q" */
+    0x0, 0x96, 0xfb, 0xfa, 0x88, 0x2f, 0x80, 0x17, 0x4a, 0x8e, 0x88, 0xd5, 0x0, 0xa9, 0x17, 0xaa,
+    0x2b, 0x9a, 0x94, 0x11, 0x52, 0x80, 0x3a, 0x54, 0x43, 0x82, 0x40, 0x3e, 0x80, 0x3, 0x89, 0x0,
+    0x7c, 0x44, 0x3, 0x30, 0x7, 0xf0, 0x81, 0x98, 0x3, 0xf8, 0x41, 0xc4, 0xc0, 0x3e, 0x22, 0x7,
+    0x4, 0x0, 0x7d, 0x0, 0x4, 0x54, 0xa0, 0xe, 0x95, 0x10, 0x5, 0x22, 0xfd, 0x45, 0x73, 0x51,
+    0x80, 0x57, 0x48, 0x87, 0x47, 0xd5, 0x0, 0xe5, 0xbe, 0xfe, 0x92, 0x0, 0xff, 0xf5, 0x80,
+
+    /* U+0072 "r" */
+    0xaf, 0x2, 0xae, 0xb0, 0x2, 0x6a, 0x3e, 0x80, 0x29, 0xfa, 0x58, 0x0, 0xb0, 0x1, 0xdc, 0x1,
+    0xe7, 0x0, 0xf1, 0x80, 0x7f, 0xf8, 0x80,
+
+    /* U+0073 "s" */
+    0x0, 0xc, 0xef, 0xfb, 0xa9, 0x40, 0x5, 0xec, 0xc7, 0x72, 0x22, 0x94, 0x24, 0x72, 0xe2, 0x15,
+    0xd4, 0xa0, 0xa6, 0x60, 0xe, 0x50, 0x1, 0x98, 0x40, 0x3f, 0x40, 0x74, 0xa9, 0x0, 0x72, 0xd9,
+    0xb5, 0x6f, 0x51, 0x80, 0x49, 0x9f, 0x92, 0x8b, 0x8a, 0x1, 0xc6, 0xd5, 0xa3, 0x0, 0x1f, 0x88,
+    0xa0, 0xb4, 0x0, 0xe2, 0x33, 0x12, 0xdf, 0x54, 0x42, 0xb4, 0x3c, 0xba, 0x55, 0x1d, 0xe6, 0xd3,
+
+    /* U+0074 "t" */
+    0x0, 0x2f, 0xb0, 0x7, 0xff, 0x36, 0x7e, 0x82, 0x7f, 0xe3, 0xd, 0x85, 0x5, 0x88, 0x88, 0x11,
+    0xfc, 0x31, 0xde, 0x10, 0xf, 0xff, 0xeb, 0x86, 0x80, 0x7c, 0x48, 0x8b, 0x8a, 0xb0, 0xd, 0x4c,
+    0xae, 0xec, 0x0,
+
+    /* U+0075 "u" */
+    0xcf, 0x0, 0xfd, 0xf8, 0x1, 0xff, 0xfc, 0x70, 0xf, 0xf8, 0x40, 0x40, 0x3c, 0x60, 0xd, 0x7,
+    0x0, 0xf5, 0x0, 0x18, 0x20, 0xc0, 0x33, 0xb0, 0x0, 0x64, 0x72, 0xe6, 0xba, 0x28, 0x40, 0xd,
+    0x8a, 0xa6, 0x44, 0x62, 0x80, 0x0,
+
+    /* U+0076 "v" */
+    0xcf, 0x0, 0xfe, 0xec, 0x90, 0x70, 0xf, 0x94, 0x65, 0x46, 0x80, 0x3e, 0x91, 0x50, 0x92, 0x40,
+    0xe, 0x33, 0x48, 0x1, 0x83, 0xc0, 0x3a, 0x41, 0x80, 0x2, 0xc8, 0x40, 0x10, 0xab, 0x8, 0x5,
+    0x61, 0x60, 0x14, 0x85, 0x80, 0x62, 0x36, 0x0, 0x99, 0x8, 0x3, 0xa4, 0x18, 0x18, 0x78, 0x3,
+    0xca, 0x36, 0x14, 0x4a, 0x1, 0xf4, 0x94, 0x1d, 0x0, 0x7e, 0x60, 0x70, 0x60, 0xf, 0xc2, 0xc0,
+    0xc2, 0x1, 0x80,
+
+    /* U+0077 "w" */
+    0xaf, 0x0, 0xf9, 0x7d, 0xc0, 0x3e, 0xdb, 0xe0, 0x50, 0xf, 0x70, 0x50, 0x7, 0x8c, 0xb9, 0x7,
+    0x80, 0x38, 0x50, 0x88, 0x60, 0x1d, 0x40, 0xa0, 0xc8, 0x20, 0x19, 0x83, 0xc2, 0x80, 0x39, 0xd8,
+    0x1, 0x40, 0xc0, 0x1a, 0x90, 0x95, 0xc0, 0x32, 0xe, 0x80, 0x8, 0xec, 0x2, 0x22, 0x70, 0x70,
+    0xa8, 0x5, 0xc2, 0x80, 0x15, 0x99, 0x0, 0x28, 0x14, 0x10, 0x7c, 0x2, 0x56, 0x0, 0xcc, 0x14,
+    0x0, 0x66, 0x0, 0x4c, 0xa2, 0xc, 0x14, 0x1, 0x85, 0x14, 0x10, 0x68, 0x2, 0xa0, 0x70, 0xa3,
+    0x20, 0xe, 0xe2, 0x3e, 0x23, 0x0, 0x88, 0xe8, 0x8e, 0x80, 0x3c, 0xa1, 0x2b, 0x40, 0x1d, 0x47,
+    0x0, 0xe0, 0x1f, 0x32, 0x83, 0x0, 0x73, 0x82, 0xa8, 0x40, 0x3e, 0xd0, 0x41, 0x0, 0xe1, 0x50,
+    0xf0, 0xc,
+
+    /* U+0078 "x" */
+    0xd, 0xe1, 0x0, 0xe3, 0xfb, 0x0, 0x70, 0xd0, 0x7, 0x70, 0xd0, 0x0, 0xe5, 0x1c, 0x2, 0xa2,
+    0xd1, 0x0, 0x99, 0x60, 0xc1, 0x96, 0xc, 0x3, 0xa8, 0xb5, 0x25, 0x5c, 0x3, 0xee, 0x1b, 0x2b,
+    0x0, 0xfc, 0x66, 0x5, 0x10, 0xf, 0xce, 0x64, 0xe6, 0x1, 0xf1, 0xc2, 0x69, 0x68, 0x80, 0x70,
+    0xf0, 0xd0, 0x70, 0xd0, 0x7, 0x59, 0x68, 0x81, 0xca, 0x38, 0x4, 0xcb, 0x6, 0x1, 0x32, 0xc1,
+    0x81, 0xca, 0x38, 0x7, 0x58, 0xe8, 0x80,
+
+    /* U+0079 "y" */
+    0xc, 0xf0, 0xf, 0xee, 0xc0, 0x90, 0x70, 0xf, 0x94, 0x64, 0x14, 0xa8, 0x3, 0xe9, 0x15, 0x0,
+    0x51, 0x28, 0x7, 0x19, 0xa4, 0x2, 0x70, 0x90, 0xe, 0xa0, 0x60, 0xc, 0xc6, 0x60, 0x8, 0x59,
+    0x82, 0x1, 0xac, 0x24, 0x2, 0x60, 0xb0, 0xe, 0x24, 0x51, 0x0, 0x4a, 0x10, 0x7, 0xbc, 0x18,
+    0x14, 0x78, 0x3, 0xe4, 0x29, 0x9, 0x25, 0x0, 0xfd, 0x63, 0x7, 0x40, 0x1f, 0xcc, 0x2e, 0xc,
+    0x1, 0xfe, 0x60, 0x61, 0x0, 0xff, 0xd6, 0x1, 0xff, 0x32, 0x10, 0x7, 0x8c, 0x2, 0x91, 0x80,
+    0xf, 0x2e, 0x54, 0x5b, 0x30, 0xc0, 0x3c, 0x8c, 0x8e, 0xb1, 0x20, 0x1f,
+
+    /* U+007A "z" */
+    0xdf, 0xff, 0xe1, 0x88, 0xf9, 0x80, 0xc5, 0x5d, 0xfc, 0x83, 0xc0, 0x1f, 0x49, 0x51, 0x0, 0x79,
+    0x98, 0xe8, 0x1, 0xe2, 0x93, 0x80, 0xf, 0xbc, 0x74, 0x3, 0xea, 0x2a, 0x10, 0xf, 0x32, 0xba,
+    0x0, 0x78, 0xe5, 0x20, 0x3, 0xc3, 0xa3, 0x40, 0x1f, 0x50, 0xa3, 0x3b, 0xf8, 0x90, 0x16, 0x23,
+    0xe6,
+
+    /* U+007B "{" */
+    0x0, 0x9b, 0x7e, 0x0, 0x9, 0x26, 0xf6, 0x0, 0xd0, 0xd8, 0x30, 0x1, 0x81, 0x80, 0x7f, 0xf8,
+    0x4, 0xd0, 0x40, 0x28, 0xc1, 0xb0, 0xa, 0xe4, 0x60, 0x2, 0x26, 0x42, 0x0, 0xff, 0xf1, 0x98,
+    0x18, 0x6, 0xd0, 0xd8, 0x30, 0x2, 0x49, 0xbd, 0x80,
+
+    /* U+007C "|" */
+    0x4f, 0x50, 0xf, 0xff, 0xb0,
+
+    /* U+007D "}" */
+    0x8f, 0xd6, 0x0, 0xae, 0xe, 0x50, 0x0, 0x6f, 0xa1, 0xa0, 0x18, 0xc0, 0xc0, 0x3c, 0x20, 0x1f,
+    0xfd, 0xc1, 0x53, 0x10, 0xa, 0xc7, 0x20, 0x2, 0x80, 0x9a, 0x0, 0x89, 0x18, 0xc0, 0x3f, 0xfc,
+    0x6, 0x4, 0x0, 0x37, 0xe0, 0xd0, 0x5, 0xc0, 0x4a, 0x0, 0x0,
+
+    /* U+007E "~" */
+    0x0, 0x84, 0x3, 0xc2, 0x0, 0x3e, 0xe6, 0x98, 0x6, 0xf4, 0xd, 0x5a, 0x7c, 0x30, 0x0, 0x89,
+    0x90, 0x6d, 0x69, 0xb1, 0x4a, 0x88, 0x86, 0x80, 0x14, 0xbd, 0x6a, 0xf0, 0x2c, 0x80, 0x68, 0xdc,
+    0xe3, 0x0,
+
+    /* U+00C0 "À" */
+    0x0, 0xe7, 0x70, 0x80, 0x7f, 0xf0, 0xd2, 0x70, 0x80, 0x3f, 0xf8, 0x47, 0xed, 0x84, 0x1, 0xff,
+    0xc2, 0x1b, 0x85, 0x0, 0xff, 0xe2, 0x33, 0x80, 0x7f, 0xf0, 0xdf, 0xec, 0x3, 0xff, 0x87, 0x20,
+    0x84, 0x1, 0xff, 0xc1, 0x61, 0x90, 0xb0, 0xf, 0xfe, 0xd, 0x93, 0x2b, 0x8, 0x7, 0xfc, 0x85,
+    0x61, 0x21, 0x20, 0x1f, 0xf4, 0xb, 0x1, 0x99, 0x80, 0x3f, 0xc6, 0x66, 0x0, 0xa4, 0x58, 0x3,
+    0xfa, 0x42, 0x40, 0x25, 0x1b, 0x0, 0xfc, 0x4a, 0xa1, 0x0, 0xd2, 0x4a, 0x1, 0xf5, 0x4, 0x80,
+    0x73, 0x4, 0x80, 0x78, 0x5c, 0x84, 0x8b, 0x8d, 0x4c, 0xc0, 0x1c, 0xc0, 0x5b, 0xbf, 0x28, 0x48,
+    0x7, 0x48, 0xd5, 0x7f, 0x1a, 0x90, 0x4, 0xa3, 0x2a, 0xbf, 0xd0, 0x16, 0x1, 0x40, 0x38, 0x7,
+    0xf2, 0x13, 0x8, 0x21, 0x38, 0x7, 0xfd, 0x60, 0xc1, 0xe1, 0x40, 0x1f, 0xf3, 0xc, 0x80,
+
+    /* U+00C1 "Á" */
+    0x0, 0xff, 0x3c, 0x10, 0x7, 0xff, 0xa, 0xe3, 0x48, 0x3, 0xff, 0xe, 0x36, 0xa8, 0x7, 0xff,
+    0x5, 0x2f, 0x48, 0x3, 0xff, 0x84, 0xae, 0x1, 0xff, 0xc4, 0x7f, 0xb0, 0xf, 0xfe, 0x1c, 0x82,
+    0x10, 0x7, 0xff, 0x5, 0x86, 0x42, 0xc0, 0x3f, 0xf8, 0x36, 0x4c, 0xac, 0x20, 0x1f, 0xf2, 0x15,
+    0x84, 0x84, 0x80, 0x7f, 0xd0, 0x2c, 0x6, 0x66, 0x0, 0xff, 0x19, 0x98, 0x2, 0x91, 0x60, 0xf,
+    0xe9, 0x9, 0x0, 0x94, 0x6c, 0x3, 0xf1, 0x2a, 0x84, 0x3, 0x49, 0x28, 0x7, 0xd4, 0x12, 0x1,
+    0xcc, 0x12, 0x1, 0xe1, 0x72, 0x12, 0x2e, 0x35, 0x33, 0x0, 0x73, 0x1, 0x6e, 0xfc, 0xa1, 0x20,
+    0x1d, 0x23, 0x55, 0xfc, 0x6a, 0x40, 0x12, 0x8c, 0xaa, 0xff, 0x40, 0x58, 0x5, 0x0, 0xe0, 0x1f,
+    0xc8, 0x4c, 0x20, 0x84, 0xe0, 0x1f, 0xf5, 0x83, 0x7, 0x85, 0x0, 0x7f, 0xcc, 0x32, 0x0,
+
+    /* U+00C2 "Â" */
+    0x0, 0xf9, 0x21, 0x40, 0x3f, 0xf8, 0x49, 0x69, 0x50, 0x1, 0xff, 0x96, 0xe3, 0x2d, 0xe0, 0x3,
+    0xfe, 0x2b, 0x70, 0x4d, 0x2, 0x0, 0xff, 0x3a, 0x0, 0x45, 0x4, 0x1, 0xff, 0x9f, 0xec, 0x3,
+    0xff, 0x87, 0x20, 0x84, 0x1, 0xff, 0xc1, 0x61, 0x90, 0xb0, 0xf, 0xfe, 0xd, 0x93, 0x2b, 0x8,
+    0x7, 0xfc, 0x85, 0x61, 0x21, 0x20, 0x1f, 0xf4, 0xb, 0x1, 0x99, 0x80, 0x3f, 0xc6, 0x66, 0x0,
+    0xa4, 0x58, 0x3, 0xfa, 0x42, 0x40, 0x25, 0x1b, 0x0, 0xfc, 0x4a, 0xa1, 0x0, 0xd2, 0x4a, 0x1,
+    0xf5, 0x4, 0x80, 0x73, 0x4, 0x80, 0x78, 0x5c, 0x84, 0x8b, 0x8d, 0x4c, 0xc0, 0x1c, 0xc0, 0x5b,
+    0xbf, 0x28, 0x48, 0x7, 0x48, 0xd5, 0x7f, 0x1a, 0x90, 0x4, 0xa3, 0x2a, 0xbf, 0xd0, 0x16, 0x1,
+    0x40, 0x38, 0x7, 0xf2, 0x13, 0x8, 0x21, 0x38, 0x7, 0xfd, 0x60, 0xc1, 0xe1, 0x40, 0x1f, 0xf3,
+    0xc, 0x80,
+
+    /* U+00C3 "Ã" */
+    0x0, 0xe6, 0xfd, 0x30, 0x3, 0xd0, 0x7, 0xf1, 0x4d, 0x5e, 0x28, 0xd6, 0x0, 0x7f, 0x22, 0x15,
+    0xb2, 0xf8, 0x58, 0x3, 0xf9, 0xe8, 0x0, 0x7d, 0xb8, 0x1, 0xfe, 0x11, 0x0, 0x62, 0x0, 0xff,
+    0xe1, 0x3f, 0xd8, 0x7, 0xff, 0xe, 0x41, 0x8, 0x3, 0xff, 0x82, 0xc3, 0x21, 0x60, 0x1f, 0xfc,
+    0x1b, 0x26, 0x56, 0x10, 0xf, 0xf9, 0xa, 0xc2, 0x42, 0x40, 0x3f, 0xe8, 0x16, 0x3, 0x33, 0x0,
+    0x7f, 0x8c, 0xcc, 0x1, 0x48, 0xb0, 0x7, 0xf4, 0x84, 0x80, 0x4a, 0x36, 0x1, 0xf8, 0x95, 0x42,
+    0x1, 0xa4, 0x94, 0x3, 0xea, 0x9, 0x0, 0xe6, 0x9, 0x0, 0xf0, 0xb9, 0x9, 0x17, 0x1a, 0x99,
+    0x80, 0x39, 0x80, 0xb7, 0x7e, 0x50, 0x90, 0xe, 0x91, 0xaa, 0xfe, 0x35, 0x20, 0x9, 0x46, 0x55,
+    0x7f, 0xa0, 0x2c, 0x2, 0x80, 0x70, 0xf, 0xe4, 0x26, 0x10, 0x42, 0x70, 0xf, 0xfa, 0xc1, 0x83,
+    0xc2, 0x80, 0x3f, 0xe6, 0x19, 0x0,
+
+    /* U+00C8 "È" */
+    0x0, 0xb, 0xb8, 0x3, 0xfc, 0x27, 0x38, 0x20, 0x1f, 0xc9, 0x81, 0x82, 0x1, 0xfc, 0x59, 0x4e,
+    0x1, 0xff, 0x3b, 0x0, 0x72, 0x7f, 0xff, 0xc8, 0x0, 0x36, 0x6f, 0xf0, 0x1, 0x26, 0x7f, 0x88,
+    0x3, 0xff, 0xd4, 0x91, 0x1f, 0x84, 0x2, 0x37, 0x7f, 0xc4, 0x1, 0x3f, 0xff, 0xe3, 0x0, 0xff,
+    0xfc, 0x24, 0xcf, 0xf2, 0x80, 0xd, 0x9b, 0xfb, 0x0,
+
+    /* U+00C9 "É" */
+    0x0, 0xfc, 0xee, 0x10, 0xf, 0xc3, 0x92, 0x62, 0x1, 0xf0, 0xe0, 0x7a, 0x0, 0x7e, 0x7a, 0xc1,
+    0x0, 0xfe, 0x67, 0x0, 0xf2, 0x7f, 0xff, 0xc8, 0x0, 0x36, 0x6f, 0xf0, 0x1, 0x26, 0x7f, 0x88,
+    0x3, 0xff, 0xd4, 0x91, 0x1f, 0x84, 0x2, 0x37, 0x7f, 0xc4, 0x1, 0x3f, 0xff, 0xe3, 0x0, 0xff,
+    0xfc, 0x24, 0xcf, 0xf2, 0x80, 0xd, 0x9b, 0xfb, 0x0,
+
+    /* U+00CA "Ê" */
+    0x0, 0xe5, 0x85, 0x0, 0xfe, 0x6a, 0x4a, 0x60, 0xf, 0x9e, 0x6b, 0x2a, 0x58, 0x3, 0x87, 0xf1,
+    0x41, 0x73, 0x84, 0x3, 0xc, 0x18, 0x4, 0x70, 0x20, 0x4, 0xff, 0xff, 0x90, 0x0, 0x6c, 0xdf,
+    0xe0, 0x2, 0x4c, 0xff, 0x10, 0x7, 0xff, 0xa9, 0x22, 0x3f, 0x8, 0x4, 0x6e, 0xff, 0x88, 0x2,
+    0x7f, 0xff, 0xc6, 0x1, 0xff, 0xf8, 0x49, 0x9f, 0xe5, 0x0, 0x1b, 0x37, 0xf6, 0x0,
+
+    /* U+00CC "Ì" */
+    0x7, 0x70, 0x80, 0x64, 0x9c, 0x20, 0x8, 0xfd, 0xb0, 0x80, 0x21, 0xb8, 0x50, 0xe, 0x67, 0x0,
+    0xc9, 0xf0, 0x1, 0xff, 0xff, 0x0, 0xff, 0xed, 0x0,
+
+    /* U+00CD "Í" */
+    0x0, 0x9e, 0x8, 0x1, 0x71, 0xa4, 0x38, 0xda, 0xa0, 0x97, 0x84, 0x0, 0x57, 0x10, 0x9, 0x3e,
+    0x0, 0x3f, 0xff, 0xe0, 0x1f, 0xfc, 0xc0,
+
+    /* U+00D2 "Ò" */
+    0x0, 0xe6, 0xfc, 0x0, 0xff, 0xe1, 0xb5, 0x9d, 0x80, 0x7f, 0xf0, 0xd3, 0x16, 0xc0, 0x3f, 0xf8,
+    0x67, 0x86, 0x60, 0xf, 0xfe, 0x19, 0x41, 0x80, 0x7f, 0xe5, 0xad, 0xff, 0x75, 0xb0, 0x7, 0xe3,
+    0xda, 0x51, 0x55, 0x92, 0x79, 0x0, 0x39, 0x70, 0xa3, 0xb2, 0xa9, 0x7f, 0x23, 0x6e, 0x1, 0x1d,
+    0xe, 0x38, 0x80, 0x73, 0x69, 0x42, 0x0, 0x3c, 0x28, 0xc0, 0x3f, 0x17, 0x85, 0x1, 0x99, 0x50,
+    0x3, 0xfc, 0x4e, 0x2b, 0x61, 0xc0, 0x1f, 0xfa, 0x83, 0xc8, 0x14, 0x3, 0xff, 0x10, 0x38, 0x80,
+    0x80, 0x7f, 0xf0, 0x44, 0xc4, 0x4, 0x3, 0xff, 0x82, 0x26, 0x40, 0xa0, 0x1f, 0xf8, 0x81, 0xec,
+    0x38, 0x3, 0xff, 0x50, 0x79, 0x99, 0x50, 0x3, 0xfc, 0x4e, 0x2a, 0x1e, 0x14, 0x60, 0x1f, 0x8b,
+    0xc2, 0x80, 0x7, 0x43, 0x8e, 0x20, 0x1c, 0xda, 0x50, 0x80, 0x12, 0xe1, 0x47, 0x65, 0x52, 0xfe,
+    0x46, 0xdc, 0x3, 0x8f, 0x69, 0x45, 0x56, 0x49, 0xe4, 0x0, 0x80,
+
+    /* U+00D3 "Ó" */
+    0x0, 0xff, 0x57, 0xc0, 0x7, 0xff, 0xa, 0x56, 0x20, 0x1, 0xff, 0xc1, 0x86, 0xa7, 0x0, 0xff,
+    0xe0, 0x88, 0x62, 0x80, 0x7f, 0xf0, 0x86, 0xc, 0x3, 0xff, 0x82, 0xb5, 0xbf, 0xee, 0xb6, 0x0,
+    0xfc, 0x7b, 0x4a, 0x2a, 0xb2, 0x4f, 0x20, 0x7, 0x2e, 0x14, 0x76, 0x55, 0x2f, 0xe4, 0x6d, 0xc0,
+    0x23, 0xa1, 0xc7, 0x10, 0xe, 0x6d, 0x28, 0x40, 0x7, 0x85, 0x18, 0x7, 0xe2, 0xf0, 0xa0, 0x33,
+    0x2a, 0x0, 0x7f, 0x89, 0xc5, 0x6c, 0x38, 0x3, 0xff, 0x50, 0x79, 0x2, 0x80, 0x7f, 0xe2, 0x7,
+    0x10, 0x10, 0xf, 0xfe, 0x8, 0x98, 0x80, 0x80, 0x7f, 0xf0, 0x44, 0xc8, 0x14, 0x3, 0xff, 0x10,
+    0x3d, 0x87, 0x0, 0x7f, 0xea, 0xf, 0x33, 0x2a, 0x0, 0x7f, 0x89, 0xc5, 0x43, 0xc2, 0x8c, 0x3,
+    0xf1, 0x78, 0x50, 0x0, 0xe8, 0x71, 0xc4, 0x3, 0x9b, 0x4a, 0x10, 0x2, 0x5c, 0x28, 0xec, 0xaa,
+    0x5f, 0xc8, 0xdb, 0x80, 0x71, 0xed, 0x28, 0xaa, 0xc9, 0x3c, 0x80, 0x10,
+
+    /* U+00D4 "Ô" */
+    0x0, 0xf9, 0x3f, 0xcc, 0x1, 0xff, 0xc1, 0x2b, 0x46, 0x94, 0x0, 0xff, 0x87, 0x12, 0xe5, 0xac,
+    0xc0, 0x3f, 0xc9, 0x36, 0x0, 0x99, 0x28, 0x7, 0xf9, 0x5c, 0x3, 0x33, 0x0, 0x3f, 0xcb, 0x5b,
+    0xfe, 0xeb, 0x60, 0xf, 0xc7, 0xb4, 0xa2, 0xab, 0x24, 0xf2, 0x0, 0x72, 0xe1, 0x47, 0x65, 0x52,
+    0xfe, 0x46, 0xdc, 0x2, 0x3a, 0x1c, 0x71, 0x0, 0xe6, 0xd2, 0x84, 0x0, 0x78, 0x51, 0x80, 0x7e,
+    0x2f, 0xa, 0x3, 0x32, 0xa0, 0x7, 0xf8, 0x9c, 0x56, 0xc3, 0x80, 0x3f, 0xf5, 0x7, 0x90, 0x28,
+    0x7, 0xfe, 0x20, 0x71, 0x1, 0x0, 0xff, 0xe0, 0x89, 0x88, 0x8, 0x7, 0xff, 0x4, 0x4c, 0x81,
+    0x40, 0x3f, 0xf1, 0x3, 0xd8, 0x70, 0x7, 0xfe, 0xa0, 0xf3, 0x32, 0xa0, 0x7, 0xf8, 0x9c, 0x54,
+    0x3c, 0x28, 0xc0, 0x3f, 0x17, 0x85, 0x0, 0xe, 0x87, 0x1c, 0x40, 0x39, 0xb4, 0xa1, 0x0, 0x25,
+    0xc2, 0x8e, 0xca, 0xa5, 0xfc, 0x8d, 0xb8, 0x7, 0x1e, 0xd2, 0x8a, 0xac, 0x93, 0xc8, 0x1,
+
+    /* U+00D5 "Õ" */
+    0x0, 0xe1, 0xcf, 0x90, 0xb, 0xc4, 0x3, 0xfa, 0xdf, 0x16, 0xc5, 0x84, 0x40, 0x1f, 0xc9, 0x7,
+    0x83, 0xd3, 0x60, 0x1f, 0xed, 0x30, 0x5, 0x6f, 0x28, 0x7, 0xf8, 0xc0, 0x31, 0x8, 0x7, 0xfc,
+    0xb5, 0xbf, 0xee, 0xb6, 0x0, 0xfc, 0x7b, 0x4a, 0x2a, 0xb2, 0x4f, 0x20, 0x7, 0x2e, 0x14, 0x76,
+    0x55, 0x2f, 0xe4, 0x6d, 0xc0, 0x23, 0xa1, 0xc7, 0x10, 0xe, 0x6d, 0x28, 0x40, 0x7, 0x85, 0x18,
+    0x7, 0xe2, 0xf0, 0xa0, 0x33, 0x2a, 0x0, 0x7f, 0x89, 0xc5, 0x6c, 0x38, 0x3, 0xff, 0x50, 0x79,
+    0x2, 0x80, 0x7f, 0xe2, 0x7, 0x10, 0x10, 0xf, 0xfe, 0x8, 0x98, 0x80, 0x80, 0x7f, 0xf0, 0x44,
+    0xc8, 0x14, 0x3, 0xff, 0x10, 0x3d, 0x87, 0x0, 0x7f, 0xea, 0xf, 0x33, 0x2a, 0x0, 0x7f, 0x89,
+    0xc5, 0x43, 0xc2, 0x8c, 0x3, 0xf1, 0x78, 0x50, 0x0, 0xe8, 0x71, 0xc4, 0x3, 0x9b, 0x4a, 0x10,
+    0x2, 0x5c, 0x28, 0xec, 0xaa, 0x5f, 0xc8, 0xdb, 0x80, 0x71, 0xed, 0x28, 0xaa, 0xc9, 0x3c, 0x80,
+    0x10,
+
+    /* U+00D9 "Ù" */
+    0x0, 0x87, 0x7d, 0x0, 0x3f, 0xe1, 0xc3, 0xb3, 0x0, 0xff, 0x87, 0x13, 0xc, 0x3, 0xff, 0x5c,
+    0xa8, 0x7, 0xff, 0x5, 0x98, 0x1, 0xe6, 0xf6, 0x0, 0xfe, 0x5f, 0x60, 0xf, 0xff, 0xf8, 0x7,
+    0xff, 0xf0, 0xc0, 0xc8, 0x38, 0x3, 0xfb, 0x81, 0x94, 0x14, 0x3, 0xf9, 0x0, 0xc5, 0x49, 0x40,
+    0x3e, 0x53, 0x50, 0x4, 0x5, 0x30, 0x7, 0x35, 0x4, 0x0, 0xb, 0x6, 0x7a, 0xe6, 0xba, 0x47,
+    0x8, 0x2, 0x3f, 0x82, 0x46, 0x52, 0x8f, 0x30, 0x0,
+
+    /* U+00DA "Ú" */
+    0x0, 0xfc, 0x9f, 0xa2, 0x1, 0xfe, 0x3b, 0x3c, 0x10, 0xf, 0xe3, 0xd4, 0xc1, 0x0, 0xff, 0x2c,
+    0xd8, 0x7, 0xfe, 0x67, 0x0, 0xf9, 0xbd, 0x80, 0x3f, 0x97, 0xd8, 0x3, 0xff, 0xfe, 0x1, 0xff,
+    0xfc, 0x30, 0x32, 0xe, 0x0, 0xfe, 0xe0, 0x65, 0x5, 0x0, 0xfe, 0x40, 0x31, 0x52, 0x50, 0xf,
+    0x94, 0xd4, 0x1, 0x1, 0x4c, 0x1, 0xcd, 0x41, 0x0, 0x2, 0xc1, 0x9e, 0xb9, 0xae, 0x91, 0xc2,
+    0x0, 0x8f, 0xe0, 0x91, 0x94, 0xa3, 0xcc, 0x0,
+
+    /* U+00DD "Ý" */
+    0x0, 0xfe, 0x78, 0x20, 0xf, 0xfd, 0x71, 0xa4, 0x1, 0xfe, 0x1c, 0x6d, 0x50, 0xf, 0xf9, 0x2f,
+    0x48, 0x3, 0xff, 0x2b, 0x80, 0x7e, 0xaf, 0x30, 0xf, 0xf6, 0xf0, 0x58, 0x70, 0x7, 0xf3, 0x95,
+    0x80, 0xc1, 0x30, 0x7, 0xc3, 0x8, 0xa0, 0x7, 0x29, 0x10, 0xf, 0x58, 0x48, 0x6, 0x90, 0xb0,
+    0xe, 0x45, 0x72, 0x0, 0xc8, 0xaa, 0x40, 0xd, 0x25, 0x0, 0x1e, 0xb0, 0x90, 0x9, 0xca, 0x40,
+    0x3e, 0x18, 0x27, 0x2, 0x84, 0x40, 0x7, 0xe7, 0x28, 0x19, 0x9, 0x0, 0xff, 0x70, 0x62, 0x41,
+    0x0, 0x7f, 0x8d, 0x48, 0x8e, 0x1, 0xff, 0xb8, 0x14, 0x3, 0xff, 0xfe, 0x1, 0xff, 0x80,
+
+    /* U+00E0 "à" */
+    0x0, 0x47, 0xd0, 0x7, 0xe8, 0xa5, 0xb0, 0xf, 0xcb, 0xad, 0x60, 0x1f, 0x8b, 0x68, 0x3, 0xfc,
+    0x20, 0x1e, 0x5b, 0xef, 0xf6, 0x38, 0x0, 0x76, 0x95, 0x1d, 0x86, 0x30, 0x4, 0x2b, 0xaa, 0x27,
+    0x54, 0xdc, 0x35, 0x40, 0x3a, 0xc2, 0xc0, 0x3f, 0x9, 0x10, 0x3, 0xf8, 0x40, 0x5, 0x5d, 0xff,
+    0xc6, 0x5, 0x89, 0x37, 0x99, 0x88, 0x28, 0x69, 0xd0, 0xcf, 0x8, 0x10, 0x20, 0x7, 0x88, 0x8,
+    0x14, 0x3, 0xa4, 0x42, 0x4a, 0xa1, 0x10, 0xd8, 0xa6, 0x3, 0x8e, 0xb7, 0x7b, 0x1c, 0x0,
+
+    /* U+00E1 "á" */
+    0x0, 0xf0, 0xef, 0x20, 0x7, 0x8b, 0xc3, 0x10, 0x3, 0x8f, 0x13, 0x48, 0x3, 0xc7, 0xf4, 0x1,
+    0xfc, 0x20, 0x1f, 0x2d, 0xf7, 0xfb, 0x1c, 0x0, 0x3b, 0x4a, 0x8e, 0xc3, 0x18, 0x2, 0x15, 0xd5,
+    0x13, 0xaa, 0x6e, 0x1a, 0xa0, 0x1d, 0x61, 0x60, 0x1f, 0x84, 0x88, 0x1, 0xfc, 0x20, 0x2, 0xae,
+    0xff, 0xe3, 0x2, 0xc4, 0x9b, 0xcc, 0xc4, 0x14, 0x34, 0xe8, 0x67, 0x84, 0x8, 0x10, 0x3, 0xc4,
+    0x4, 0xa, 0x1, 0xd2, 0x21, 0x25, 0x50, 0x88, 0x6c, 0x53, 0x1, 0xc7, 0x5b, 0xbd, 0x8e, 0x0,
+
+    /* U+00E2 "â" */
+    0x0, 0xcf, 0xfe, 0x30, 0xf, 0x34, 0x18, 0xe9, 0x0, 0x65, 0x97, 0xcf, 0x2c, 0x20, 0x8, 0x72,
+    0x0, 0x72, 0x84, 0x2, 0x43, 0x0, 0xc8, 0x60, 0x12, 0xdf, 0x7f, 0xb1, 0xc0, 0x3, 0xb4, 0xa8,
+    0xec, 0x31, 0x80, 0x21, 0x5d, 0x51, 0x3a, 0xa6, 0xe1, 0xaa, 0x1, 0xd6, 0x16, 0x1, 0xf8, 0x48,
+    0x80, 0x1f, 0xc2, 0x0, 0x2a, 0xef, 0xfe, 0x30, 0x2c, 0x49, 0xbc, 0xcc, 0x41, 0x43, 0x4e, 0x86,
+    0x78, 0x40, 0x81, 0x0, 0x3c, 0x40, 0x40, 0xa0, 0x1d, 0x22, 0x12, 0x55, 0x8, 0x86, 0xc5, 0x30,
+    0x1c, 0x75, 0xbb, 0xd8, 0xe0,
+
+    /* U+00E3 "ã" */
+    0x0, 0xe, 0xfb, 0x0, 0x1e, 0x40, 0x2b, 0x7c, 0xb7, 0xb, 0xc0, 0x9, 0x20, 0xf2, 0xbc, 0x14,
+    0x2, 0xc2, 0x1, 0xdd, 0x60, 0x6, 0x20, 0xc, 0x40, 0x1c, 0xb7, 0xdf, 0xec, 0x70, 0x0, 0xed,
+    0x2a, 0x3b, 0xc, 0x60, 0x8, 0x57, 0x54, 0x4e, 0xa9, 0xb8, 0x6a, 0x80, 0x75, 0x85, 0x80, 0x7e,
+    0x12, 0x20, 0x7, 0xf0, 0x80, 0xa, 0xbb, 0xff, 0x8c, 0xb, 0x12, 0x6f, 0x33, 0x10, 0x50, 0xd3,
+    0xa1, 0x9e, 0x10, 0x20, 0x40, 0xf, 0x10, 0x10, 0x28, 0x7, 0x48, 0x84, 0x95, 0x42, 0x21, 0xb1,
+    0x4c, 0x7, 0x1d, 0x6e, 0xf6, 0x38, 0x0,
+
+    /* U+00E8 "è" */
+    0x0, 0x1f, 0x70, 0x80, 0x3f, 0x8f, 0xcb, 0xc, 0x3, 0xf8, 0x71, 0xf0, 0xc0, 0x3f, 0xd3, 0xc6,
+    0x1, 0xff, 0x8, 0x7, 0xf2, 0xdf, 0xfb, 0x64, 0x80, 0x3a, 0xe9, 0x98, 0xee, 0x6d, 0x40, 0xa,
+    0x92, 0x76, 0x62, 0xb4, 0xac, 0x81, 0x15, 0xd8, 0x3, 0x16, 0x4, 0x87, 0x4, 0x80, 0x78, 0x59,
+    0x5, 0xc8, 0x40, 0x3e, 0xc0, 0x53, 0x2f, 0xff, 0xd4, 0x4, 0x63, 0x99, 0xfe, 0x74, 0x11, 0x19,
+    0xff, 0xd, 0x4, 0x0, 0x7f, 0x8d, 0x96, 0x84, 0x3, 0x1e, 0x98, 0x2, 0x55, 0x5d, 0x73, 0x2c,
+    0xc0, 0x8, 0x5, 0x56, 0xaa, 0x66, 0x4, 0x69, 0x0,
+
+    /* U+00E9 "é" */
+    0x0, 0xfa, 0x3e, 0x40, 0x3f, 0xa5, 0xe6, 0x40, 0x1f, 0xa9, 0xf1, 0x80, 0x3f, 0xaf, 0x8c, 0x3,
+    0xfc, 0x20, 0x1f, 0xe5, 0xbf, 0xf6, 0xc9, 0x0, 0x75, 0xd3, 0x31, 0xdc, 0xda, 0x80, 0x15, 0x24,
+    0xec, 0xc5, 0x69, 0x59, 0x2, 0x2b, 0xb0, 0x6, 0x2c, 0x9, 0xe, 0x9, 0x0, 0xf0, 0xb2, 0xb,
+    0x90, 0x80, 0x7d, 0x80, 0xa6, 0x5f, 0xff, 0xa8, 0x8, 0xc7, 0x33, 0xfc, 0xe8, 0x22, 0x33, 0xfe,
+    0x1a, 0x8, 0x0, 0xff, 0x1b, 0x2d, 0x8, 0x6, 0x3d, 0x30, 0x4, 0xaa, 0xba, 0xe6, 0x59, 0x80,
+    0x10, 0xa, 0xad, 0x54, 0xcc, 0x8, 0xd2, 0x0,
+
+    /* U+00EA "ê" */
+    0x0, 0xc5, 0xdf, 0x20, 0x1f, 0x8b, 0x5, 0x1a, 0x0, 0x3c, 0x3e, 0x5b, 0x70, 0xee, 0x0, 0xe3,
+    0x9c, 0x20, 0x7d, 0x30, 0xe, 0x24, 0x0, 0xc4, 0x80, 0x1e, 0x5b, 0xff, 0x6c, 0x90, 0x7, 0x5d,
+    0x33, 0x1d, 0xcd, 0xa8, 0x1, 0x52, 0x4e, 0xcc, 0x56, 0x95, 0x90, 0x22, 0xbb, 0x0, 0x62, 0xc0,
+    0x90, 0xe0, 0x90, 0xf, 0xb, 0x20, 0xb9, 0x8, 0x7, 0xd8, 0xa, 0x65, 0xff, 0xfa, 0x80, 0x8c,
+    0x73, 0x3f, 0xce, 0x82, 0x23, 0x3f, 0xe1, 0xa0, 0x80, 0xf, 0xf1, 0xb2, 0xd0, 0x80, 0x63, 0xd3,
+    0x0, 0x4a, 0xab, 0xae, 0x65, 0x98, 0x1, 0x0, 0xaa, 0xd5, 0x4c, 0xc0, 0x8d, 0x20,
+
+    /* U+00EC "ì" */
+    0x3e, 0xe1, 0x0, 0xf, 0xd7, 0xc, 0x0, 0x36, 0xd8, 0x80, 0x14, 0x7a, 0x0, 0x7f, 0x57, 0x88,
+    0x7, 0xff, 0xf0,
+
+    /* U+00ED "í" */
+    0x0, 0xa7, 0xe4, 0x2, 0xa6, 0xa9, 0x0, 0x5b, 0xea, 0x80, 0x57, 0xa4, 0x1, 0xff, 0x57, 0x88,
+    0x7, 0xff, 0xfc, 0x3, 0xff,
+
+    /* U+00F2 "ò" */
+    0x0, 0xe, 0x7a, 0x80, 0x7f, 0xe, 0x35, 0x30, 0x7, 0xfa, 0x6a, 0x5c, 0x3, 0xfc, 0xbe, 0xc0,
+    0x1f, 0xf8, 0x40, 0x3f, 0x25, 0xf7, 0xf5, 0xa8, 0x7, 0x55, 0xaa, 0x3b, 0x96, 0xac, 0x2, 0xa5,
+    0x6e, 0xa8, 0x9e, 0x64, 0xb0, 0x35, 0x49, 0x0, 0xe9, 0x54, 0x45, 0x4, 0x80, 0x7d, 0x1, 0xc8,
+    0x24, 0x1, 0xf1, 0x11, 0xcc, 0xc0, 0x1f, 0xc2, 0x67, 0x0, 0x7f, 0x9, 0xa0, 0x98, 0x7, 0xc4,
+    0x47, 0xa0, 0x80, 0xf, 0xa0, 0x38, 0xd9, 0x28, 0x3, 0xa5, 0x54, 0x81, 0x2a, 0xaf, 0xa8, 0xae,
+    0x64, 0xa0, 0xa, 0xad, 0x10, 0xe8, 0xb5, 0x60, 0x0,
+
+    /* U+00F3 "ó" */
+    0x0, 0xf9, 0x7f, 0x4, 0x3, 0xf3, 0x53, 0x60, 0x80, 0x7c, 0xd3, 0x30, 0x7, 0xf3, 0xfb, 0x0,
+    0x7f, 0x84, 0x3, 0xfc, 0x97, 0xdf, 0xd6, 0xa0, 0x1d, 0x56, 0xa8, 0xee, 0x5a, 0xb0, 0xa, 0x95,
+    0xba, 0xa2, 0x79, 0x92, 0xc0, 0xd5, 0x24, 0x3, 0xa5, 0x51, 0x14, 0x12, 0x1, 0xf4, 0x7, 0x20,
+    0x90, 0x7, 0xc4, 0x47, 0x33, 0x0, 0x7f, 0x9, 0x9c, 0x1, 0xfc, 0x26, 0x82, 0x60, 0x1f, 0x11,
+    0x1e, 0x82, 0x0, 0x3e, 0x80, 0xe3, 0x64, 0xa0, 0xe, 0x95, 0x52, 0x4, 0xaa, 0xbe, 0xa2, 0xb9,
+    0x92, 0x80, 0x2a, 0xb4, 0x43, 0xa2, 0xd5, 0x80, 0x0,
+
+    /* U+00F4 "ô" */
+    0x0, 0xec, 0xfc, 0x0, 0xfe, 0xb3, 0x43, 0xb0, 0xf, 0xa9, 0x6e, 0xe5, 0xb0, 0xe, 0x1f, 0xf2,
+    0x2, 0x7f, 0x8, 0x6, 0x15, 0x10, 0x8, 0x54, 0x40, 0x39, 0x2f, 0xbf, 0xad, 0x40, 0x3a, 0xad,
+    0x51, 0xdc, 0xb5, 0x60, 0x15, 0x2b, 0x75, 0x44, 0xf3, 0x25, 0x81, 0xaa, 0x48, 0x7, 0x4a, 0xa2,
+    0x28, 0x24, 0x3, 0xe8, 0xe, 0x41, 0x20, 0xf, 0x88, 0x8e, 0x66, 0x0, 0xfe, 0x13, 0x38, 0x3,
+    0xf8, 0x4d, 0x4, 0xc0, 0x3e, 0x22, 0x3d, 0x4, 0x0, 0x7d, 0x1, 0xc6, 0xc9, 0x40, 0x1d, 0x2a,
+    0xa4, 0x9, 0x55, 0x7d, 0x45, 0x73, 0x25, 0x0, 0x55, 0x68, 0x87, 0x45, 0xab, 0x0,
+
+    /* U+00F5 "õ" */
+    0x0, 0x97, 0xb4, 0xc0, 0x18, 0x80, 0x1d, 0x76, 0x8d, 0x32, 0x35, 0x0, 0xc6, 0x65, 0x55, 0x66,
+    0xc0, 0x80, 0x63, 0xc0, 0x2, 0x7f, 0x38, 0x7, 0x84, 0x3, 0x8, 0x7, 0xc9, 0x7d, 0xfd, 0x6a,
+    0x1, 0xd5, 0x6a, 0x8e, 0xe5, 0xab, 0x0, 0xa9, 0x5b, 0xaa, 0x27, 0x99, 0x2c, 0xd, 0x52, 0x40,
+    0x3a, 0x55, 0x11, 0x41, 0x20, 0x1f, 0x40, 0x72, 0x9, 0x0, 0x7c, 0x44, 0x73, 0x30, 0x7, 0xf0,
+    0x99, 0xc0, 0x1f, 0xc2, 0x68, 0x26, 0x1, 0xf1, 0x11, 0xe8, 0x20, 0x3, 0xe8, 0xe, 0x36, 0x4a,
+    0x0, 0xe9, 0x55, 0x20, 0x4a, 0xab, 0xea, 0x2b, 0x99, 0x28, 0x2, 0xab, 0x44, 0x3a, 0x2d, 0x58,
+    0x0,
+
+    /* U+00F9 "ù" */
+    0x0, 0x37, 0xe0, 0x80, 0x7e, 0x6c, 0x1c, 0x10, 0xf, 0xc7, 0x8d, 0x84, 0x1, 0xf8, 0x6f, 0x48,
+    0x3, 0xff, 0x89, 0x9e, 0x1, 0xfb, 0xf0, 0x3, 0xff, 0xf8, 0xe0, 0x1f, 0xf0, 0x80, 0x80, 0x78,
+    0xc0, 0x1a, 0xe, 0x1, 0xea, 0x0, 0x30, 0x41, 0x80, 0x67, 0x60, 0x0, 0xc8, 0xe5, 0xcd, 0x74,
+    0x50, 0x80, 0x1b, 0x15, 0x4c, 0x88, 0xc5, 0x0,
+
+    /* U+00FA "ú" */
+    0x0, 0xfa, 0xfd, 0x80, 0x3e, 0x1c, 0x5c, 0x60, 0xf, 0x16, 0x3f, 0x98, 0x7, 0xc5, 0xb6, 0x20,
+    0x1f, 0xfc, 0x4c, 0xf0, 0xf, 0xdf, 0x80, 0x1f, 0xff, 0xc7, 0x0, 0xff, 0x84, 0x4, 0x3, 0xc6,
+    0x0, 0xd0, 0x70, 0xf, 0x50, 0x1, 0x82, 0xc, 0x3, 0x3b, 0x0, 0x6, 0x47, 0x2e, 0x6b, 0xa2,
+    0x84, 0x0, 0xd8, 0xaa, 0x64, 0x46, 0x28, 0x0,
+
+    /* U+00FD "ý" */
+    0x0, 0xfd, 0x5f, 0x0, 0x1f, 0xeb, 0x5b, 0x80, 0xf, 0xc3, 0x8d, 0xa8, 0x1, 0xfc, 0x39, 0xa4,
+    0x1, 0xff, 0xc8, 0xcf, 0x0, 0xfe, 0xec, 0x9, 0x7, 0x0, 0xf9, 0x46, 0x41, 0x4a, 0x80, 0x3e,
+    0x91, 0x50, 0x5, 0x12, 0x80, 0x71, 0x9a, 0x40, 0x27, 0x9, 0x0, 0xea, 0x6, 0x0, 0xcc, 0x66,
+    0x0, 0x85, 0x98, 0x20, 0x1a, 0xc2, 0x40, 0x26, 0xb, 0x0, 0xe2, 0x45, 0x10, 0x4, 0xa1, 0x0,
+    0x7b, 0xc1, 0x81, 0x47, 0x80, 0x3e, 0x42, 0x90, 0x92, 0x50, 0xf, 0xd6, 0x30, 0x74, 0x1, 0xfc,
+    0xc2, 0xe0, 0xc0, 0x1f, 0xe6, 0x6, 0x10, 0xf, 0xfd, 0x60, 0x1f, 0xf3, 0x21, 0x0, 0x78, 0xc0,
+    0x29, 0x18, 0x0, 0xf2, 0xe5, 0x45, 0xb3, 0xc, 0x3, 0xc8, 0xc8, 0xeb, 0x12, 0x1, 0xf0,
+
+    /* U+0102 "Ă" */
+    0x0, 0xef, 0x40, 0xd, 0xe6, 0x1, 0xfe, 0x69, 0x20, 0x1a, 0x23, 0x0, 0xff, 0x4a, 0x6f, 0xf0,
+    0x60, 0x7, 0xfe, 0x9f, 0xef, 0xa1, 0x0, 0xff, 0xe1, 0x8, 0x7, 0xff, 0x11, 0xfe, 0xc0, 0x3f,
+    0xf8, 0x72, 0x8, 0x40, 0x1f, 0xfc, 0x16, 0x19, 0xb, 0x0, 0xff, 0xe0, 0xd9, 0x32, 0xb0, 0x80,
+    0x7f, 0xc8, 0x56, 0x12, 0x12, 0x1, 0xff, 0x40, 0xb0, 0x19, 0x98, 0x3, 0xfc, 0x66, 0x60, 0xa,
+    0x45, 0x80, 0x3f, 0xa4, 0x24, 0x2, 0x51, 0xb0, 0xf, 0xc4, 0xaa, 0x10, 0xd, 0x24, 0xa0, 0x1f,
+    0x50, 0x48, 0x7, 0x30, 0x48, 0x7, 0x85, 0xc8, 0x48, 0xb8, 0xd4, 0xcc, 0x1, 0xcc, 0x5, 0xbb,
+    0xf2, 0x84, 0x80, 0x74, 0x8d, 0x57, 0xf1, 0xa9, 0x0, 0x4a, 0x32, 0xab, 0xfd, 0x1, 0x60, 0x14,
+    0x3, 0x80, 0x7f, 0x21, 0x30, 0x82, 0x13, 0x80, 0x7f, 0xd6, 0xc, 0x1e, 0x14, 0x1, 0xff, 0x30,
+    0xc8, 0x0,
+
+    /* U+0103 "ă" */
+    0x0, 0x5b, 0x80, 0x6d, 0x60, 0xb, 0x61, 0x0, 0xe, 0x4e, 0x1, 0x34, 0xd7, 0xfa, 0xf0, 0x40,
+    0x33, 0x77, 0x58, 0x60, 0x1f, 0x8, 0x80, 0x3c, 0xb7, 0xdf, 0xec, 0x70, 0x0, 0xed, 0x2a, 0x3b,
+    0xc, 0x60, 0x8, 0x57, 0x54, 0x4e, 0xa9, 0xb8, 0x6a, 0x80, 0x75, 0x85, 0x80, 0x7e, 0x12, 0x20,
+    0x7, 0xf0, 0x80, 0xa, 0xbb, 0xff, 0x8c, 0xb, 0x12, 0x6f, 0x33, 0x10, 0x50, 0xd3, 0xa1, 0x9e,
+    0x10, 0x20, 0x40, 0xf, 0x10, 0x10, 0x28, 0x7, 0x48, 0x84, 0x95, 0x42, 0x21, 0xb1, 0x4c, 0x7,
+    0x1d, 0x6e, 0xf6, 0x38, 0x0,
+
+    /* U+0110 "Đ" */
+    0x0, 0x17, 0xff, 0xed, 0xa5, 0x0, 0xfe, 0x26, 0x6e, 0x51, 0x5a, 0xd3, 0x0, 0xf9, 0xe6, 0x7a,
+    0xb3, 0xa0, 0xb1, 0x40, 0x3f, 0xf8, 0x42, 0xf8, 0x34, 0x60, 0x1f, 0xfc, 0x33, 0xa0, 0xf0, 0xf,
+    0xfe, 0x22, 0x29, 0x98, 0x3, 0xff, 0x89, 0xe0, 0x82, 0x4c, 0x2, 0x45, 0x84, 0x3, 0xce, 0x1b,
+    0x5b, 0x60, 0x9b, 0xba, 0xc0, 0x3c, 0x60, 0x31, 0x52, 0x7, 0x55, 0xa4, 0x3, 0xc6, 0x2, 0x6a,
+    0x80, 0xca, 0xb8, 0xc0, 0x3c, 0xe1, 0xa0, 0x1f, 0xfc, 0x4e, 0x4, 0x0, 0xff, 0xe1, 0xa2, 0xc,
+    0xc0, 0x1f, 0xfc, 0x23, 0xa0, 0xf0, 0xf, 0xfe, 0x8, 0xbe, 0xd, 0x18, 0x7, 0x3c, 0xcf, 0xb3,
+    0xa0, 0xb1, 0x40, 0x3c, 0x4c, 0xde, 0x15, 0xad, 0x30, 0x8,
+
+    /* U+0111 "đ" */
+    0x0, 0xff, 0xb7, 0x80, 0x3f, 0xf9, 0x83, 0xff, 0xc4, 0x3f, 0xe4, 0x0, 0xe1, 0xcc, 0xe2, 0x1c,
+    0xc2, 0x80, 0x78, 0xcf, 0x80, 0x6, 0x61, 0x0, 0x96, 0xfb, 0xfa, 0x88, 0x3, 0xf5, 0xd2, 0xa3,
+    0xb9, 0x35, 0x40, 0x3d, 0x48, 0xdd, 0x51, 0x3c, 0xd4, 0x60, 0x19, 0x15, 0x24, 0x3, 0xa5, 0x44,
+    0x3, 0x70, 0x48, 0x7, 0xd0, 0x1, 0xce, 0x24, 0x1, 0xf1, 0x10, 0x3, 0x19, 0x80, 0x3f, 0x84,
+    0x3, 0x19, 0x80, 0x3f, 0x84, 0x3, 0x20, 0x98, 0x7, 0xc4, 0x40, 0xd, 0xa1, 0x0, 0x1f, 0x40,
+    0x7, 0x22, 0xa5, 0x0, 0x74, 0xa8, 0x80, 0x75, 0x22, 0xfd, 0x45, 0x73, 0x52, 0x80, 0x7a, 0xe9,
+    0x10, 0xe8, 0x8d, 0x50, 0xe,
+
+    /* U+0128 "Ĩ" */
+    0x1c, 0xf5, 0x2, 0xe6, 0xb, 0xb2, 0x20, 0xb6, 0x92, 0xed, 0x31, 0x7, 0x5, 0xee, 0x21, 0x8,
+    0x0, 0x44, 0x1, 0x27, 0xc0, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xb6,
+
+    /* U+0129 "ĩ" */
+    0x3e, 0xc1, 0x9, 0x68, 0x9b, 0xd1, 0x42, 0x56, 0x75, 0xe1, 0x4c, 0x10, 0x9d, 0xc0, 0x20, 0x8,
+    0x80, 0x35, 0x78, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xe0,
+
+    /* U+0168 "Ũ" */
+    0x0, 0xd1, 0xfa, 0x40, 0x9, 0x80, 0xf, 0x1b, 0xdd, 0x62, 0xb, 0xe0, 0x7, 0xad, 0x51, 0xea,
+    0xf9, 0x50, 0x3, 0xd3, 0x60, 0x4, 0xfd, 0xb0, 0xf, 0x84, 0x40, 0x18, 0x80, 0x39, 0xbd, 0x80,
+    0x3f, 0x97, 0xd8, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xfc, 0x30, 0x32, 0xe, 0x0, 0xfe, 0xe0, 0x65,
+    0x5, 0x0, 0xfe, 0x40, 0x31, 0x52, 0x50, 0xf, 0x94, 0xd4, 0x1, 0x1, 0x4c, 0x1, 0xcd, 0x41,
+    0x0, 0x2, 0xc1, 0x9e, 0xb9, 0xae, 0x91, 0xc2, 0x0, 0x8f, 0xe0, 0x91, 0x94, 0xa3, 0xcc, 0x0,
+
+    /* U+0169 "ũ" */
+    0x0, 0xaf, 0xe4, 0x0, 0x98, 0x1, 0x9d, 0xda, 0x52, 0x1c, 0x80, 0x1b, 0x24, 0xac, 0xbd, 0xe4,
+    0x3, 0x52, 0x80, 0x2f, 0x74, 0x20, 0x18, 0x40, 0x31, 0x0, 0x6c, 0xf0, 0xf, 0xdf, 0x80, 0x1f,
+    0xff, 0xc7, 0x0, 0xff, 0x84, 0x4, 0x3, 0xc6, 0x0, 0xd0, 0x70, 0xf, 0x50, 0x1, 0x82, 0xc,
+    0x3, 0x3b, 0x0, 0x6, 0x47, 0x2e, 0x6b, 0xa2, 0x84, 0x0, 0xd8, 0xaa, 0x64, 0x46, 0x28, 0x0,
+
+    /* U+01A0 "Ơ" */
+    0x0, 0xff, 0xe2, 0x28, 0x7, 0xff, 0x16, 0xd4, 0x3, 0xff, 0x88, 0x5a, 0x1, 0xff, 0xc3, 0x53,
+    0xd0, 0xe, 0x5a, 0xdf, 0xff, 0xa9, 0x14, 0x2, 0x3d, 0xa4, 0x77, 0x94, 0x40, 0x5, 0x76, 0x0,
+    0x97, 0xe, 0x7a, 0xa2, 0x15, 0xd4, 0x25, 0x80, 0x11, 0xd0, 0xe3, 0x0, 0x79, 0x7c, 0x9d, 0x40,
+    0x1e, 0x1a, 0x40, 0x1f, 0x87, 0xc2, 0xc0, 0xcc, 0xa6, 0x1, 0xfe, 0x27, 0x16, 0xb0, 0xe0, 0xf,
+    0xfd, 0x41, 0x84, 0xa, 0x1, 0xff, 0x88, 0x1c, 0x40, 0x40, 0x3f, 0xf8, 0x22, 0x62, 0x2, 0x1,
+    0xff, 0xc1, 0x13, 0x20, 0x50, 0xf, 0xfc, 0x40, 0xf6, 0x1e, 0x1, 0xff, 0xa8, 0x3c, 0xcc, 0x88,
+    0x0, 0xff, 0x13, 0x8a, 0x87, 0x85, 0x18, 0x7, 0xe2, 0xc0, 0xa0, 0x1, 0xd0, 0xe3, 0x88, 0x7,
+    0x3e, 0x8c, 0xa0, 0x4, 0xb8, 0x51, 0xd9, 0x54, 0xcf, 0x81, 0xb6, 0x0, 0xe3, 0xda, 0x51, 0x55,
+    0x12, 0x4f, 0x20, 0x4,
+
+    /* U+01A1 "ơ" */
+    0x0, 0xff, 0x94, 0x80, 0x3f, 0xee, 0xb0, 0xf, 0xf8, 0x8c, 0x3, 0xfc, 0x6e, 0x40, 0x12, 0x5f,
+    0x7f, 0xec, 0x28, 0x0, 0x55, 0xbc, 0xd4, 0x98, 0x16, 0x0, 0x29, 0x63, 0x1d, 0x5b, 0x24, 0xa8,
+    0xd, 0x59, 0xc0, 0x39, 0x9d, 0x52, 0x82, 0xc0, 0x3e, 0x90, 0xe4, 0x12, 0x0, 0xf8, 0x49, 0xcc,
+    0xc0, 0x1f, 0xc2, 0x67, 0x0, 0x7f, 0x11, 0xa0, 0x98, 0x7, 0xc4, 0x2f, 0x41, 0x0, 0x1f, 0x48,
+    0x71, 0xb2, 0x50, 0x7, 0x4a, 0x2a, 0x4, 0xaa, 0xbe, 0xa2, 0xb9, 0x92, 0x80, 0x2a, 0xb4, 0x43,
+    0xa2, 0xd5, 0x80, 0x0,
+
+    /* U+01AF "Ư" */
+    0x0, 0xff, 0xe1, 0xb1, 0x80, 0x7f, 0xf0, 0xf2, 0x40, 0x3f, 0xf8, 0x64, 0xc0, 0x1f, 0xfc, 0x21,
+    0x55, 0x37, 0xb0, 0x7, 0xf2, 0xff, 0x1d, 0x80, 0x7f, 0xf0, 0x9f, 0x88, 0x3, 0xff, 0x85, 0xc0,
+    0x1f, 0xff, 0xf0, 0xf, 0xff, 0x71, 0x81, 0x80, 0x8, 0x38, 0x3, 0xfb, 0x81, 0x80, 0xa, 0xa,
+    0x1, 0xfc, 0x80, 0x60, 0x1, 0x52, 0x50, 0xf, 0x94, 0xd4, 0x3, 0x40, 0x53, 0x0, 0x73, 0x50,
+    0x40, 0x6, 0x2c, 0x19, 0xeb, 0x9a, 0xe9, 0x1c, 0x20, 0xe, 0x3f, 0x82, 0x46, 0x52, 0x8f, 0x30,
+    0xc,
+
+    /* U+01B0 "ư" */
+    0x0, 0xff, 0xcc, 0x60, 0x1f, 0xfb, 0x24, 0x3, 0xff, 0x13, 0x0, 0x7f, 0xc2, 0xaa, 0xcf, 0x0,
+    0xfd, 0xfc, 0x76, 0x1, 0xff, 0x1f, 0x10, 0x7, 0xff, 0xe9, 0xc0, 0x3f, 0xf8, 0x22, 0x2, 0x1,
+    0xe3, 0x0, 0xda, 0xe, 0x1, 0xea, 0x0, 0xcc, 0x10, 0x60, 0x19, 0xd8, 0x3, 0xc, 0x8e, 0x5c,
+    0xd7, 0x45, 0x8, 0x6, 0x6c, 0x55, 0x32, 0x23, 0x14, 0x3,
+
+    /* U+1EA0 "Ạ" */
+    0x0, 0xf9, 0xfe, 0xc0, 0x3f, 0xf8, 0x72, 0x8, 0x40, 0x1f, 0xfc, 0x16, 0x17, 0xb, 0x0, 0xff,
+    0xe0, 0xd8, 0xc2, 0x30, 0x80, 0x7f, 0xc8, 0x52, 0x1e, 0x12, 0x1, 0xff, 0x40, 0x38, 0x21, 0x30,
+    0x7, 0xf8, 0xcc, 0xc0, 0x15, 0x8b, 0x0, 0x7f, 0x48, 0x58, 0x4, 0xc3, 0x60, 0x1f, 0x89, 0x54,
+    0x40, 0x1a, 0x49, 0x40, 0x3e, 0xa0, 0x90, 0xe, 0x60, 0x90, 0xf, 0xb, 0x99, 0x80, 0x38, 0x58,
+    0xcc, 0x1, 0xcc, 0x16, 0x45, 0xf6, 0x84, 0x80, 0x74, 0x84, 0x6e, 0xfd, 0x60, 0xa4, 0x1, 0x28,
+    0xb5, 0x57, 0xf4, 0x5, 0x80, 0x50, 0x12, 0xab, 0xfc, 0xe4, 0xc2, 0x8, 0x4e, 0x1, 0xff, 0x58,
+    0x30, 0x78, 0x50, 0x7, 0xfc, 0xc3, 0x21, 0x7e, 0x40, 0x1f, 0xfb, 0xb8, 0x1, 0xff, 0xcf, 0x51,
+    0x0, 0xff, 0xe1, 0xbd, 0x50, 0x3, 0xff, 0x86, 0x61, 0x80, 0x1f, 0x80,
+
+    /* U+1EA1 "ạ" */
+    0x0, 0x2d, 0xf7, 0xfb, 0x1c, 0x0, 0x3b, 0x4a, 0x8e, 0xc3, 0x18, 0x2, 0x15, 0xd5, 0x13, 0xaa,
+    0x6e, 0x1a, 0xa0, 0x1d, 0x61, 0x60, 0x1f, 0x84, 0x88, 0x1, 0xfc, 0x20, 0x2, 0xae, 0xff, 0xe3,
+    0x2, 0xc4, 0x9b, 0xcc, 0xc4, 0x14, 0x34, 0xe8, 0x67, 0x84, 0x8, 0x10, 0x3, 0xc4, 0x4, 0xa,
+    0x1, 0xd2, 0x21, 0x25, 0x50, 0x88, 0x6c, 0x53, 0x1, 0xc7, 0x5b, 0xbd, 0x8e, 0x0, 0x18, 0xdf,
+    0xf6, 0xb8, 0x5f, 0x0, 0x7f, 0xf1, 0xc, 0x80, 0x3f, 0x1e, 0x68, 0x7, 0xe2, 0x13, 0x0, 0xc0,
+
+    /* U+1EA2 "Ả" */
+    0x0, 0xf2, 0xef, 0x48, 0x7, 0xff, 0x8, 0x7b, 0x51, 0x80, 0x3f, 0xf8, 0x28, 0x66, 0x4e, 0x0,
+    0xff, 0xe1, 0x8b, 0xe0, 0x7, 0xff, 0xe, 0xa5, 0x0, 0x3f, 0xf8, 0x76, 0xe0, 0x1f, 0xfc, 0x37,
+    0xfb, 0x0, 0xff, 0xe1, 0xc8, 0x21, 0x0, 0x7f, 0xf0, 0x58, 0x64, 0x2c, 0x3, 0xff, 0x83, 0x64,
+    0xca, 0xc2, 0x1, 0xff, 0x21, 0x58, 0x48, 0x48, 0x7, 0xfd, 0x2, 0xc0, 0x66, 0x60, 0xf, 0xf1,
+    0x99, 0x80, 0x29, 0x16, 0x0, 0xfe, 0x90, 0x90, 0x9, 0x46, 0xc0, 0x3f, 0x12, 0xa8, 0x40, 0x34,
+    0x92, 0x80, 0x7d, 0x41, 0x20, 0x1c, 0xc1, 0x20, 0x1e, 0x17, 0x21, 0x22, 0xe3, 0x53, 0x30, 0x7,
+    0x30, 0x16, 0xef, 0xca, 0x12, 0x1, 0xd2, 0x35, 0x5f, 0xc6, 0xa4, 0x1, 0x28, 0xca, 0xaf, 0xf4,
+    0x5, 0x80, 0x50, 0xe, 0x1, 0xfc, 0x84, 0xc2, 0x8, 0x4e, 0x1, 0xff, 0x58, 0x30, 0x78, 0x50,
+    0x7, 0xfc, 0xc3, 0x20,
+
+    /* U+1EA3 "ả" */
+    0x0, 0x8a, 0xfa, 0xc8, 0x3, 0xc7, 0xf8, 0x32, 0x1, 0xe1, 0x42, 0xf7, 0x0, 0xfc, 0x71, 0x20,
+    0x1f, 0xd0, 0xa0, 0x1f, 0x8d, 0x40, 0x3c, 0xb7, 0xdf, 0xec, 0x70, 0x0, 0xed, 0x2a, 0x3b, 0xc,
+    0x60, 0x8, 0x57, 0x54, 0x4e, 0xa9, 0xb8, 0x6a, 0x80, 0x75, 0x85, 0x80, 0x7e, 0x12, 0x20, 0x7,
+    0xf0, 0x80, 0xa, 0xbb, 0xff, 0x8c, 0xb, 0x12, 0x6f, 0x33, 0x10, 0x50, 0xd3, 0xa1, 0x9e, 0x10,
+    0x20, 0x40, 0xf, 0x10, 0x10, 0x28, 0x7, 0x48, 0x84, 0x95, 0x42, 0x21, 0xb1, 0x4c, 0x7, 0x1d,
+    0x6e, 0xf6, 0x38, 0x0,
+
+    /* U+1EA4 "Ấ" */
+    0x0, 0xff, 0xe0, 0xa4, 0x18, 0x7, 0xff, 0x9, 0x2c, 0x4c, 0x3, 0xff, 0x82, 0x97, 0x12, 0x1,
+    0xfc, 0x39, 0xfc, 0x66, 0xb7, 0x0, 0xfe, 0x3f, 0x7d, 0x6c, 0x24, 0x0, 0xff, 0x25, 0xd8, 0xa3,
+    0x34, 0x80, 0x3f, 0xce, 0xa0, 0x11, 0xc1, 0x0, 0x7f, 0xe7, 0xfb, 0x0, 0xff, 0xe1, 0xc8, 0x21,
+    0x0, 0x7f, 0xf0, 0x58, 0x64, 0x2c, 0x3, 0xff, 0x83, 0x64, 0xca, 0xc2, 0x1, 0xff, 0x21, 0x58,
+    0x48, 0x48, 0x7, 0xfd, 0x2, 0xc0, 0x66, 0x60, 0xf, 0xf1, 0x99, 0x80, 0x29, 0x16, 0x0, 0xfe,
+    0x90, 0x90, 0x9, 0x46, 0xc0, 0x3f, 0x12, 0xa8, 0x40, 0x34, 0x92, 0x80, 0x7d, 0x41, 0x20, 0x1c,
+    0xc1, 0x20, 0x1e, 0x17, 0x21, 0x22, 0xe3, 0x53, 0x30, 0x7, 0x30, 0x16, 0xef, 0xca, 0x12, 0x1,
+    0xd2, 0x35, 0x5f, 0xc6, 0xa4, 0x1, 0x28, 0xca, 0xaf, 0xf4, 0x5, 0x80, 0x50, 0xe, 0x1, 0xfc,
+    0x84, 0xc2, 0x8, 0x4e, 0x1, 0xff, 0x58, 0x30, 0x78, 0x50, 0x7, 0xfc, 0xc3, 0x20,
+
+    /* U+1EA5 "ấ" */
+    0x0, 0xff, 0x1c, 0x28, 0x7, 0xf2, 0x60, 0xa8, 0x7, 0xe6, 0xab, 0x90, 0xc, 0x35, 0x7a, 0xed,
+    0xc8, 0x1, 0x9b, 0x3e, 0xf7, 0xf0, 0xc0, 0x39, 0xb5, 0x40, 0x11, 0x86, 0x1, 0xff, 0xc6, 0x5b,
+    0xef, 0xf6, 0x38, 0x6, 0x1d, 0xa5, 0x47, 0x61, 0x8c, 0x0, 0x84, 0x2b, 0xaa, 0x27, 0x54, 0xdc,
+    0x2, 0xd5, 0x0, 0xeb, 0xb, 0x0, 0xff, 0x9, 0x10, 0x3, 0xfe, 0x10, 0xc, 0x55, 0xdf, 0xfc,
+    0x60, 0x11, 0x62, 0x4d, 0xe6, 0x62, 0x0, 0xa8, 0x69, 0xd0, 0xcf, 0x8, 0x4, 0x40, 0x80, 0x1e,
+    0x20, 0x8, 0x81, 0x40, 0x3a, 0x44, 0x2, 0x92, 0xa8, 0x44, 0x36, 0x29, 0x80, 0x43, 0x8e, 0xb7,
+    0x7b, 0x1c, 0x2,
+
+    /* U+1EA6 "Ầ" */
+    0x0, 0xfe, 0x77, 0x0, 0x7f, 0xf1, 0x12, 0x70, 0x3, 0xff, 0x86, 0x7e, 0x36, 0x1, 0xff, 0xe,
+    0x7f, 0x16, 0xe1, 0x80, 0x7f, 0x1f, 0xbe, 0xb6, 0x2b, 0x98, 0x7, 0xf2, 0x5d, 0x8a, 0x33, 0x48,
+    0x3, 0xfc, 0xea, 0x1, 0x1c, 0x10, 0x7, 0xfe, 0x7f, 0xb0, 0xf, 0xfe, 0x1c, 0x82, 0x10, 0x7,
+    0xff, 0x5, 0x86, 0x42, 0xc0, 0x3f, 0xf8, 0x36, 0x4c, 0xac, 0x20, 0x1f, 0xf2, 0x15, 0x84, 0x84,
+    0x80, 0x7f, 0xd0, 0x2c, 0x6, 0x66, 0x0, 0xff, 0x19, 0x98, 0x2, 0x91, 0x60, 0xf, 0xe9, 0x9,
+    0x0, 0x94, 0x6c, 0x3, 0xf1, 0x2a, 0x84, 0x3, 0x49, 0x28, 0x7, 0xd4, 0x12, 0x1, 0xcc, 0x12,
+    0x1, 0xe1, 0x72, 0x12, 0x2e, 0x35, 0x33, 0x0, 0x73, 0x1, 0x6e, 0xfc, 0xa1, 0x20, 0x1d, 0x23,
+    0x55, 0xfc, 0x6a, 0x40, 0x12, 0x8c, 0xaa, 0xff, 0x40, 0x58, 0x5, 0x0, 0xe0, 0x1f, 0xc8, 0x4c,
+    0x20, 0x84, 0xe0, 0x1f, 0xf5, 0x83, 0x7, 0x85, 0x0, 0x7f, 0xcc, 0x32, 0x0,
+
+    /* U+1EA7 "ầ" */
+    0x0, 0xf2, 0xc1, 0x0, 0x7e, 0x51, 0xd4, 0x0, 0xfd, 0x37, 0x4c, 0x1, 0xd, 0x5e, 0xba, 0x73,
+    0x0, 0x1b, 0x3e, 0xf7, 0xf0, 0xc0, 0x26, 0xd5, 0x0, 0x46, 0x18, 0x7, 0xff, 0x9, 0x6f, 0xbf,
+    0xd8, 0xe0, 0x1, 0xda, 0x54, 0x76, 0x18, 0xc0, 0x10, 0xae, 0xa8, 0x9d, 0x53, 0x70, 0xd5, 0x0,
+    0xeb, 0xb, 0x0, 0xfc, 0x24, 0x40, 0xf, 0xe1, 0x0, 0x15, 0x77, 0xff, 0x18, 0x16, 0x24, 0xde,
+    0x66, 0x20, 0xa1, 0xa7, 0x43, 0x3c, 0x20, 0x40, 0x80, 0x1e, 0x20, 0x20, 0x50, 0xe, 0x91, 0x9,
+    0x2a, 0x84, 0x43, 0x62, 0x98, 0xe, 0x3a, 0xdd, 0xec, 0x70,
+
+    /* U+1EA8 "Ẩ" */
+    0x0, 0xff, 0x5f, 0x48, 0x7, 0xff, 0xe, 0xb9, 0x8, 0x3, 0xff, 0x84, 0x22, 0x33, 0x0, 0x7f,
+    0x86, 0xff, 0x49, 0x28, 0x40, 0x3f, 0x8f, 0x3, 0x53, 0x41, 0x0, 0x3f, 0xc9, 0x16, 0x53, 0x9a,
+    0x40, 0x1f, 0xe7, 0x50, 0x8, 0xe0, 0x80, 0x3f, 0xf3, 0xfd, 0x80, 0x7f, 0xf0, 0xe4, 0x10, 0x80,
+    0x3f, 0xf8, 0x2c, 0x32, 0x16, 0x1, 0xff, 0xc1, 0xb2, 0x65, 0x61, 0x0, 0xff, 0x90, 0xac, 0x24,
+    0x24, 0x3, 0xfe, 0x81, 0x60, 0x33, 0x30, 0x7, 0xf8, 0xcc, 0xc0, 0x14, 0x8b, 0x0, 0x7f, 0x48,
+    0x48, 0x4, 0xa3, 0x60, 0x1f, 0x89, 0x54, 0x20, 0x1a, 0x49, 0x40, 0x3e, 0xa0, 0x90, 0xe, 0x60,
+    0x90, 0xf, 0xb, 0x90, 0x91, 0x71, 0xa9, 0x98, 0x3, 0x98, 0xb, 0x77, 0xe5, 0x9, 0x0, 0xe9,
+    0x1a, 0xaf, 0xe3, 0x52, 0x0, 0x94, 0x65, 0x57, 0xfa, 0x2, 0xc0, 0x28, 0x7, 0x0, 0xfe, 0x42,
+    0x61, 0x4, 0x27, 0x0, 0xff, 0xac, 0x18, 0x3c, 0x28, 0x3, 0xfe, 0x61, 0x90,
+
+    /* U+1EA9 "ẩ" */
+    0x0, 0xfa, 0x3b, 0x4, 0x3, 0xe9, 0xe5, 0x70, 0xf, 0x84, 0x4a, 0xa0, 0x8, 0x6a, 0xf5, 0xce,
+    0x4c, 0x0, 0xd9, 0xf7, 0xbf, 0xcc, 0x1, 0x36, 0xa8, 0x2, 0x30, 0xc0, 0x3f, 0xf8, 0x4b, 0x7d,
+    0xfe, 0xc7, 0x0, 0xe, 0xd2, 0xa3, 0xb0, 0xc6, 0x0, 0x85, 0x75, 0x44, 0xea, 0x9b, 0x86, 0xa8,
+    0x7, 0x58, 0x58, 0x7, 0xe1, 0x22, 0x0, 0x7f, 0x8, 0x0, 0xab, 0xbf, 0xf8, 0xc0, 0xb1, 0x26,
+    0xf3, 0x31, 0x5, 0xd, 0x3a, 0x19, 0xe1, 0x2, 0x4, 0x0, 0xf1, 0x1, 0x2, 0x80, 0x74, 0x88,
+    0x49, 0x54, 0x22, 0x1b, 0x14, 0xc0, 0x71, 0xd6, 0xef, 0x63, 0x80,
+
+    /* U+1EAA "Ẫ" */
+    0x0, 0xe6, 0xef, 0x91, 0xd, 0x40, 0xf, 0xf4, 0xef, 0x7, 0x7b, 0xa0, 0x7, 0xfb, 0x8c, 0x67,
+    0xfa, 0x80, 0x3f, 0xe1, 0x16, 0x7f, 0x10, 0x7, 0xfe, 0x3f, 0x6e, 0x6c, 0x50, 0xf, 0xf9, 0x2e,
+    0x86, 0x33, 0x48, 0x3, 0xfc, 0xea, 0x1, 0x1c, 0x10, 0x7, 0xfe, 0x7f, 0xb0, 0xf, 0xfe, 0x1c,
+    0x82, 0x10, 0x7, 0xff, 0x5, 0x86, 0x42, 0xc0, 0x3f, 0xf8, 0x36, 0x4c, 0xac, 0x20, 0x1f, 0xf2,
+    0x15, 0x84, 0x84, 0x80, 0x7f, 0xd0, 0x2c, 0x6, 0x66, 0x0, 0xff, 0x19, 0x98, 0x2, 0x91, 0x60,
+    0xf, 0xe9, 0x9, 0x0, 0x94, 0x6c, 0x3, 0xf1, 0x2a, 0x84, 0x3, 0x49, 0x28, 0x7, 0xd4, 0x12,
+    0x1, 0xcc, 0x12, 0x1, 0xe1, 0x72, 0x12, 0x2e, 0x35, 0x33, 0x0, 0x73, 0x1, 0x6e, 0xfc, 0xa1,
+    0x20, 0x1d, 0x23, 0x55, 0xfc, 0x6a, 0x40, 0x12, 0x8c, 0xaa, 0xff, 0x40, 0x58, 0x5, 0x0, 0xe0,
+    0x1f, 0xc8, 0x4c, 0x20, 0x84, 0xe0, 0x1f, 0xf5, 0x83, 0x7, 0x85, 0x0, 0x7f, 0xcc, 0x32, 0x0,
+
+    /* U+1EAB "ẫ" */
+    0x0, 0x95, 0xc8, 0x0, 0x68, 0x1, 0x3c, 0x76, 0x20, 0x41, 0x0, 0x57, 0x32, 0xd9, 0xf7, 0x60,
+    0xb, 0x50, 0xf, 0x7b, 0x0, 0x30, 0x8a, 0xaf, 0x58, 0x3, 0x9b, 0x3e, 0xf7, 0xb0, 0xc0, 0x26,
+    0xd5, 0x0, 0x4e, 0x18, 0x7, 0xff, 0x9, 0x6f, 0xbf, 0xd8, 0xe0, 0x1, 0xda, 0x54, 0x76, 0x18,
+    0xc0, 0x10, 0xae, 0xa8, 0x9d, 0x53, 0x70, 0xd5, 0x0, 0xeb, 0xb, 0x0, 0xfc, 0x24, 0x40, 0xf,
+    0xe1, 0x0, 0x15, 0x77, 0xff, 0x18, 0x16, 0x24, 0xde, 0x66, 0x20, 0xa1, 0xa7, 0x43, 0x3c, 0x20,
+    0x40, 0x80, 0x1e, 0x20, 0x20, 0x50, 0xe, 0x91, 0x9, 0x2a, 0x84, 0x43, 0x62, 0x98, 0xe, 0x3a,
+    0xdd, 0xec, 0x70,
+
+    /* U+1EAC "Ậ" */
+    0x0, 0xfa, 0xff, 0x48, 0x3, 0xff, 0x83, 0x6b, 0x63, 0x84, 0x1, 0xff, 0x63, 0xfa, 0x63, 0xe1,
+    0x0, 0x7f, 0xb3, 0x2, 0x0, 0x9e, 0x20, 0xf, 0xfc, 0xff, 0x60, 0x1f, 0xfc, 0x39, 0x4, 0x20,
+    0xf, 0xfe, 0xb, 0xb, 0x85, 0x80, 0x7f, 0xf0, 0x6c, 0x61, 0x18, 0x40, 0x3f, 0xe4, 0x29, 0xf,
+    0x9, 0x0, 0xff, 0xa0, 0x1c, 0x10, 0x98, 0x3, 0xfc, 0x66, 0x60, 0xa, 0xc5, 0x80, 0x3f, 0xa4,
+    0x2c, 0x2, 0x61, 0xb0, 0xf, 0xc4, 0xaa, 0x20, 0xd, 0x24, 0xa0, 0x1f, 0x50, 0x48, 0x7, 0x30,
+    0x48, 0x7, 0x85, 0xcc, 0xc0, 0x1c, 0x2c, 0x66, 0x0, 0xe6, 0xb, 0x22, 0xfb, 0x42, 0x40, 0x3a,
+    0x42, 0x37, 0x7e, 0xb0, 0x52, 0x0, 0x94, 0x5a, 0xab, 0xfa, 0x2, 0xc0, 0x28, 0x9, 0x55, 0xfe,
+    0x72, 0x61, 0x4, 0x27, 0x0, 0xff, 0xac, 0x18, 0x3c, 0x28, 0x3, 0xfe, 0x61, 0x90, 0xbf, 0x20,
+    0xf, 0xfd, 0xdc, 0x0, 0xff, 0xe7, 0xa8, 0x80, 0x7f, 0xf0, 0xde, 0xa8, 0x1, 0xff, 0xc3, 0x30,
+    0xc0, 0xf, 0xc0,
+
+    /* U+1EAD "ậ" */
+    0x0, 0xcf, 0xfe, 0x30, 0xf, 0x34, 0x18, 0xe9, 0x0, 0x65, 0x97, 0xcf, 0x2c, 0x20, 0x8, 0x72,
+    0x0, 0x72, 0x84, 0x2, 0x43, 0x0, 0xc8, 0x60, 0x12, 0xdf, 0x7f, 0xb1, 0xc0, 0x3, 0xb4, 0xa8,
+    0xec, 0x31, 0x80, 0x21, 0x5d, 0x51, 0x3a, 0xa6, 0xe1, 0xaa, 0x1, 0xd6, 0x16, 0x1, 0xf8, 0x48,
+    0x80, 0x1f, 0xc2, 0x0, 0x2a, 0xef, 0xfe, 0x30, 0x2c, 0x49, 0xbc, 0xcc, 0x41, 0x43, 0x4e, 0x86,
+    0x78, 0x40, 0x81, 0x0, 0x3c, 0x40, 0x40, 0xa0, 0x1d, 0x22, 0x12, 0x55, 0x8, 0x86, 0xc5, 0x30,
+    0x1c, 0x75, 0xbb, 0xd8, 0xe0, 0x1, 0x8d, 0xff, 0x6b, 0x85, 0xf0, 0x7, 0xff, 0x10, 0xc8, 0x3,
+    0xf1, 0xe6, 0x80, 0x7e, 0x21, 0x30, 0xc,
+
+    /* U+1EAE "Ắ" */
+    0x0, 0xfe, 0x8f, 0x70, 0xf, 0xfe, 0x15, 0x2e, 0x38, 0x7, 0xff, 0x5, 0x37, 0x46, 0x1, 0xff,
+    0xb6, 0x11, 0xc1, 0x7c, 0x40, 0x3f, 0xde, 0x7f, 0xdf, 0x16, 0x20, 0x1f, 0xe2, 0xbf, 0xfb, 0x50,
+    0x3, 0xff, 0x84, 0x20, 0x1f, 0xfc, 0x47, 0xfb, 0x0, 0xff, 0xe1, 0xc8, 0x21, 0x0, 0x7f, 0xf0,
+    0x58, 0x64, 0x2c, 0x3, 0xff, 0x83, 0x64, 0xca, 0xc2, 0x1, 0xff, 0x21, 0x58, 0x48, 0x48, 0x7,
+    0xfd, 0x2, 0xc0, 0x66, 0x60, 0xf, 0xf1, 0x99, 0x80, 0x29, 0x16, 0x0, 0xfe, 0x90, 0x90, 0x9,
+    0x46, 0xc0, 0x3f, 0x12, 0xa8, 0x40, 0x34, 0x92, 0x80, 0x7d, 0x41, 0x20, 0x1c, 0xc1, 0x20, 0x1e,
+    0x17, 0x21, 0x22, 0xe3, 0x53, 0x30, 0x7, 0x30, 0x16, 0xef, 0xca, 0x12, 0x1, 0xd2, 0x35, 0x5f,
+    0xc6, 0xa4, 0x1, 0x28, 0xca, 0xaf, 0xf4, 0x5, 0x80, 0x50, 0xe, 0x1, 0xfc, 0x84, 0xc2, 0x8,
+    0x4e, 0x1, 0xff, 0x58, 0x30, 0x78, 0x50, 0x7, 0xfc, 0xc3, 0x20,
+
+    /* U+1EAF "ắ" */
+    0x0, 0xf9, 0xdc, 0x1, 0xfa, 0xa0, 0xc0, 0x3e, 0xa4, 0xd4, 0x0, 0xf1, 0xef, 0x90, 0x7, 0x55,
+    0x93, 0x89, 0xf2, 0x80, 0x54, 0x5d, 0xfe, 0xd8, 0x50, 0xd, 0x3f, 0xdd, 0x30, 0x7, 0xc2, 0x20,
+    0xf, 0x2d, 0xf7, 0xfb, 0x1c, 0x0, 0x3b, 0x4a, 0x8e, 0xc3, 0x18, 0x2, 0x15, 0xd5, 0x13, 0xaa,
+    0x6e, 0x1a, 0xa0, 0x1d, 0x61, 0x60, 0x1f, 0x84, 0x88, 0x1, 0xfc, 0x20, 0x2, 0xae, 0xff, 0xe3,
+    0x2, 0xc4, 0x9b, 0xcc, 0xc4, 0x14, 0x34, 0xe8, 0x67, 0x84, 0x8, 0x10, 0x3, 0xc4, 0x4, 0xa,
+    0x1, 0xd2, 0x21, 0x25, 0x50, 0x88, 0x6c, 0x53, 0x1, 0xc7, 0x5b, 0xbd, 0x8e, 0x0,
+
+    /* U+1EB0 "Ằ" */
+    0x0, 0xe4, 0xeb, 0x0, 0xff, 0xe1, 0xa7, 0x86, 0x88, 0x7, 0xff, 0x8, 0x6e, 0x1c, 0x3, 0xff,
+    0x83, 0xb0, 0xa, 0xcb, 0xe2, 0x1, 0xfe, 0xf3, 0xfe, 0xf8, 0xb1, 0x0, 0xff, 0x15, 0xff, 0xda,
+    0x80, 0x1f, 0xfc, 0x21, 0x0, 0xff, 0xe2, 0x3f, 0xd8, 0x7, 0xff, 0xe, 0x41, 0x8, 0x3, 0xff,
+    0x82, 0xc3, 0x21, 0x60, 0x1f, 0xfc, 0x1b, 0x26, 0x56, 0x10, 0xf, 0xf9, 0xa, 0xc2, 0x42, 0x40,
+    0x3f, 0xe8, 0x16, 0x3, 0x33, 0x0, 0x7f, 0x8c, 0xcc, 0x1, 0x48, 0xb0, 0x7, 0xf4, 0x84, 0x80,
+    0x4a, 0x36, 0x1, 0xf8, 0x95, 0x42, 0x1, 0xa4, 0x94, 0x3, 0xea, 0x9, 0x0, 0xe6, 0x9, 0x0,
+    0xf0, 0xb9, 0x9, 0x17, 0x1a, 0x99, 0x80, 0x39, 0x80, 0xb7, 0x7e, 0x50, 0x90, 0xe, 0x91, 0xaa,
+    0xfe, 0x35, 0x20, 0x9, 0x46, 0x55, 0x7f, 0xa0, 0x2c, 0x2, 0x80, 0x70, 0xf, 0xe4, 0x26, 0x10,
+    0x42, 0x70, 0xf, 0xfa, 0xc1, 0x83, 0xc2, 0x80, 0x3f, 0xe6, 0x19, 0x0,
+
+    /* U+1EB1 "ằ" */
+    0x0, 0x1c, 0x28, 0x7, 0xe3, 0xa, 0x60, 0xf, 0xd1, 0x52, 0xa0, 0x1f, 0x97, 0x8, 0x3, 0xd5,
+    0x62, 0x6e, 0x7c, 0xa0, 0x15, 0x17, 0x7f, 0xb6, 0x14, 0x3, 0x4f, 0xf7, 0x4c, 0x1, 0xf0, 0x88,
+    0x3, 0xcb, 0x7d, 0xfe, 0xc7, 0x0, 0xe, 0xd2, 0xa3, 0xb0, 0xc6, 0x0, 0x85, 0x75, 0x44, 0xea,
+    0x9b, 0x86, 0xa8, 0x7, 0x58, 0x58, 0x7, 0xe1, 0x22, 0x0, 0x7f, 0x8, 0x0, 0xab, 0xbf, 0xf8,
+    0xc0, 0xb1, 0x26, 0xf3, 0x31, 0x5, 0xd, 0x3a, 0x19, 0xe1, 0x2, 0x4, 0x0, 0xf1, 0x1, 0x2,
+    0x80, 0x74, 0x88, 0x49, 0x54, 0x22, 0x1b, 0x14, 0xc0, 0x71, 0xd6, 0xef, 0x63, 0x80,
+
+    /* U+1EB2 "Ẳ" */
+    0x0, 0xfa, 0x7a, 0xc0, 0x3f, 0xf8, 0x73, 0xc0, 0x80, 0x1f, 0xf8, 0x80, 0x8, 0xc8, 0x40, 0x1f,
+    0xf7, 0x48, 0xae, 0x36, 0x88, 0x7, 0xfb, 0x4b, 0xbf, 0xab, 0x4, 0x3, 0xfc, 0x37, 0xff, 0x61,
+    0x80, 0x7f, 0xf0, 0x84, 0x3, 0xff, 0x88, 0xff, 0x60, 0x1f, 0xfc, 0x39, 0x4, 0x20, 0xf, 0xfe,
+    0xb, 0xc, 0x85, 0x80, 0x7f, 0xf0, 0x6c, 0x99, 0x58, 0x40, 0x3f, 0xe4, 0x2b, 0x9, 0x9, 0x0,
+    0xff, 0xa0, 0x58, 0xc, 0xcc, 0x1, 0xfe, 0x33, 0x30, 0x5, 0x22, 0xc0, 0x1f, 0xd2, 0x12, 0x1,
+    0x28, 0xd8, 0x7, 0xe2, 0x55, 0x8, 0x6, 0x92, 0x50, 0xf, 0xa8, 0x24, 0x3, 0x98, 0x24, 0x3,
+    0xc2, 0xe4, 0x24, 0x5c, 0x6a, 0x66, 0x0, 0xe6, 0x2, 0xdd, 0xf9, 0x42, 0x40, 0x3a, 0x46, 0xab,
+    0xf8, 0xd4, 0x80, 0x25, 0x19, 0x55, 0xfe, 0x80, 0xb0, 0xa, 0x1, 0xc0, 0x3f, 0x90, 0x98, 0x41,
+    0x9, 0xc0, 0x3f, 0xeb, 0x6, 0xf, 0xa, 0x0, 0xff, 0x98, 0x64, 0x0,
+
+    /* U+1EB3 "ẳ" */
+    0x0, 0xcd, 0xb8, 0x20, 0x1f, 0x3e, 0xa3, 0x0, 0x7c, 0x21, 0xfe, 0x0, 0xfc, 0x53, 0x40, 0x1d,
+    0x56, 0x25, 0x83, 0xca, 0x1, 0x51, 0x77, 0xee, 0xa1, 0x40, 0x34, 0xff, 0x74, 0xc0, 0x1f, 0x8,
+    0x80, 0x3c, 0xb7, 0xdf, 0xec, 0x70, 0x0, 0xed, 0x2a, 0x3b, 0xc, 0x60, 0x8, 0x57, 0x54, 0x4e,
+    0xa9, 0xb8, 0x6a, 0x80, 0x75, 0x85, 0x80, 0x7e, 0x12, 0x20, 0x7, 0xf0, 0x80, 0xa, 0xbb, 0xff,
+    0x8c, 0xb, 0x12, 0x6f, 0x33, 0x10, 0x50, 0xd3, 0xa1, 0x9e, 0x10, 0x20, 0x40, 0xf, 0x10, 0x10,
+    0x28, 0x7, 0x48, 0x84, 0x95, 0x42, 0x21, 0xb1, 0x4c, 0x7, 0x1d, 0x6e, 0xf6, 0x38, 0x0,
+
+    /* U+1EB4 "Ẵ" */
+    0x0, 0xe5, 0xdd, 0x40, 0x86, 0x20, 0x7, 0xfa, 0xbb, 0xc7, 0xbd, 0xd0, 0x3, 0xfd, 0x86, 0x53,
+    0xfd, 0x40, 0x1f, 0xf7, 0x48, 0x80, 0x1f, 0x84, 0x3, 0xfd, 0x85, 0xdc, 0xfa, 0xc1, 0x0, 0xff,
+    0xd, 0xff, 0xd8, 0x60, 0x1f, 0xfc, 0x21, 0x0, 0xff, 0xe2, 0x3f, 0xd8, 0x7, 0xff, 0xe, 0x41,
+    0x8, 0x3, 0xff, 0x82, 0xc3, 0x21, 0x60, 0x1f, 0xfc, 0x1b, 0x26, 0x56, 0x10, 0xf, 0xf9, 0xa,
+    0xc2, 0x42, 0x40, 0x3f, 0xe8, 0x16, 0x3, 0x33, 0x0, 0x7f, 0x8c, 0xcc, 0x1, 0x48, 0xb0, 0x7,
+    0xf4, 0x84, 0x80, 0x4a, 0x36, 0x1, 0xf8, 0x95, 0x42, 0x1, 0xa4, 0x94, 0x3, 0xea, 0x9, 0x0,
+    0xe6, 0x9, 0x0, 0xf0, 0xb9, 0x9, 0x17, 0x1a, 0x99, 0x80, 0x39, 0x80, 0xb7, 0x7e, 0x50, 0x90,
+    0xe, 0x91, 0xaa, 0xfe, 0x35, 0x20, 0x9, 0x46, 0x55, 0x7f, 0xa0, 0x2c, 0x2, 0x80, 0x70, 0xf,
+    0xe4, 0x26, 0x10, 0x42, 0x70, 0xf, 0xfa, 0xc1, 0x83, 0xc2, 0x80, 0x3f, 0xe6, 0x19, 0x0,
+
+    /* U+1EB5 "ẵ" */
+    0x0, 0xd, 0xf3, 0x0, 0x1d, 0xc0, 0x14, 0x16, 0xdb, 0x5, 0x90, 0x4, 0x94, 0x79, 0x5e, 0xea,
+    0x1, 0x61, 0x80, 0xe7, 0x58, 0x6, 0xbb, 0x8, 0x0, 0xb9, 0x40, 0x2a, 0x2e, 0xff, 0x6c, 0x28,
+    0x6, 0x9f, 0xee, 0x98, 0x3, 0xe1, 0x10, 0x7, 0x96, 0xfb, 0xfd, 0x8e, 0x0, 0x1d, 0xa5, 0x47,
+    0x61, 0x8c, 0x1, 0xa, 0xea, 0x89, 0xd5, 0x37, 0xd, 0x50, 0xe, 0xb0, 0xb0, 0xf, 0xc2, 0x44,
+    0x0, 0xfe, 0x10, 0x1, 0x57, 0x7f, 0xf1, 0x81, 0x62, 0x4d, 0xe6, 0x62, 0xa, 0x1a, 0x74, 0x33,
+    0xc2, 0x4, 0x8, 0x1, 0xe2, 0x2, 0x5, 0x0, 0xe9, 0x10, 0x92, 0xa8, 0x44, 0x36, 0x29, 0x80,
+    0xe3, 0xad, 0xde, 0xc7, 0x0,
+
+    /* U+1EB6 "Ặ" */
+    0x0, 0xe7, 0x10, 0xc, 0xe2, 0x1, 0xfe, 0x97, 0x0, 0x8a, 0x0, 0x3f, 0xe9, 0x83, 0x2, 0xe5,
+    0x10, 0xf, 0xf3, 0xce, 0xfe, 0xad, 0x0, 0x7f, 0xe7, 0xee, 0x7c, 0x80, 0x7f, 0xf0, 0x9f, 0xac,
+    0x3, 0xff, 0x87, 0x20, 0x84, 0x1, 0xff, 0xc1, 0x61, 0x70, 0xb0, 0xf, 0xfe, 0xd, 0x8c, 0x23,
+    0x8, 0x7, 0xfc, 0x85, 0x21, 0xe1, 0x20, 0x1f, 0xf4, 0x3, 0x82, 0x13, 0x0, 0x7f, 0x8c, 0xcc,
+    0x1, 0x58, 0xb0, 0x7, 0xf4, 0x85, 0x80, 0x4c, 0x36, 0x1, 0xf8, 0x95, 0x44, 0x1, 0xa4, 0x94,
+    0x3, 0xea, 0x9, 0x0, 0xe6, 0x9, 0x0, 0xf0, 0xb9, 0x98, 0x3, 0x85, 0x8c, 0xc0, 0x1c, 0xc1,
+    0x64, 0x5f, 0x68, 0x48, 0x7, 0x48, 0x46, 0xef, 0xd6, 0xa, 0x40, 0x12, 0x8b, 0x55, 0x7f, 0x40,
+    0x58, 0x5, 0x1, 0x2a, 0xbf, 0xce, 0x4c, 0x20, 0x84, 0xe0, 0x1f, 0xf5, 0x83, 0x7, 0x85, 0x0,
+    0x7f, 0xcc, 0x32, 0x17, 0xe4, 0x1, 0xff, 0xbb, 0x80, 0x1f, 0xfc, 0xf5, 0x10, 0xf, 0xfe, 0x1b,
+    0xd5, 0x0, 0x3f, 0xf8, 0x66, 0x18, 0x1, 0xf8,
+
+    /* U+1EB7 "ặ" */
+    0x0, 0x63, 0x80, 0x6c, 0x70, 0x9, 0x70, 0x2, 0x13, 0x40, 0xa, 0xd1, 0xc0, 0x68, 0xcc, 0x1,
+    0x15, 0xd7, 0xf0, 0x68, 0x7, 0x26, 0xf7, 0xd8, 0x80, 0x65, 0xbe, 0xe7, 0xe3, 0x80, 0x7, 0x69,
+    0x51, 0xd8, 0x63, 0x0, 0x42, 0xba, 0xa2, 0x75, 0x4d, 0xc3, 0x54, 0x3, 0xac, 0x2c, 0x3, 0xf0,
+    0x91, 0x0, 0x3f, 0x84, 0x0, 0x55, 0xdf, 0xfc, 0x60, 0x58, 0x93, 0x79, 0x98, 0x82, 0x86, 0x9d,
+    0xc, 0xf0, 0x81, 0x2, 0x0, 0x78, 0x80, 0x81, 0x40, 0x3a, 0x44, 0x24, 0xaa, 0x11, 0xd, 0x8a,
+    0x60, 0x38, 0xeb, 0x77, 0xb1, 0xc0, 0x3, 0x1b, 0xfe, 0xd7, 0xb, 0xe0, 0xf, 0xfe, 0x21, 0x90,
+    0x7, 0xe3, 0xcd, 0x0, 0xfc, 0x42, 0x60, 0x18,
+
+    /* U+1EB8 "Ẹ" */
+    0x4f, 0xff, 0xf9, 0x0, 0x6, 0xcd, 0xfe, 0x0, 0x24, 0xcf, 0xf1, 0x0, 0x7f, 0xfd, 0xdf, 0xff,
+    0xf1, 0x80, 0x46, 0xef, 0xf8, 0x80, 0x24, 0x88, 0xfc, 0x20, 0x1f, 0xfe, 0xb4, 0x99, 0xfe, 0x50,
+    0x1, 0xb3, 0x7f, 0x62, 0x7f, 0xff, 0xd2, 0x1, 0xff, 0xc7, 0x50, 0xf, 0xfa, 0x6a, 0x40, 0x3f,
+    0xde, 0x18, 0x1, 0xc0,
+
+    /* U+1EB9 "ẹ" */
+    0x0, 0x96, 0xff, 0xdb, 0x24, 0x1, 0xd7, 0x4c, 0xc7, 0x73, 0x6a, 0x0, 0x54, 0x93, 0xb3, 0x15,
+    0xa5, 0x64, 0x8, 0xae, 0xc0, 0x18, 0xb0, 0x24, 0x38, 0x24, 0x3, 0xc2, 0xc8, 0x2e, 0x42, 0x1,
+    0xf6, 0x2, 0x99, 0x7f, 0xfe, 0xa0, 0x23, 0x1c, 0xcf, 0xf3, 0xa0, 0x88, 0xcf, 0xf8, 0x68, 0x20,
+    0x3, 0xfc, 0x6c, 0xb4, 0x20, 0x18, 0xf4, 0xc0, 0x12, 0xaa, 0xeb, 0x99, 0x66, 0x0, 0x40, 0x2a,
+    0xb5, 0x53, 0x30, 0x23, 0x48, 0x3, 0x25, 0x77, 0xfb, 0x1c, 0x3, 0xff, 0x92, 0x28, 0x1, 0xff,
+    0x65, 0xa8, 0x7, 0xf9, 0x5, 0xc0, 0x38,
+
+    /* U+1EBA "Ẻ" */
+    0x0, 0xcd, 0xbd, 0x0, 0x1f, 0xc5, 0xda, 0xc8, 0x1, 0xf9, 0xc, 0xc8, 0x40, 0x1f, 0xe2, 0x44,
+    0x0, 0x7f, 0xba, 0x8, 0x3, 0xfd, 0x8c, 0x1, 0xc9, 0xff, 0xff, 0x20, 0x0, 0xd9, 0xbf, 0xc0,
+    0x4, 0x99, 0xfe, 0x20, 0xf, 0xff, 0x52, 0x44, 0x7e, 0x10, 0x8, 0xdd, 0xff, 0x10, 0x4, 0xff,
+    0xff, 0x8c, 0x3, 0xff, 0xf0, 0x93, 0x3f, 0xca, 0x0, 0x36, 0x6f, 0xec,
+
+    /* U+1EBB "ẻ" */
+    0x0, 0xd3, 0xba, 0x60, 0xf, 0xec, 0xf9, 0x91, 0x0, 0x7e, 0x52, 0x41, 0x0, 0xff, 0xa4, 0x88,
+    0x1, 0xfe, 0xec, 0x0, 0xff, 0x9c, 0x3, 0xf9, 0x6f, 0xfd, 0xb2, 0x40, 0x1d, 0x74, 0xcc, 0x77,
+    0x36, 0xa0, 0x5, 0x49, 0x3b, 0x31, 0x5a, 0x56, 0x40, 0x8a, 0xec, 0x1, 0x8b, 0x2, 0x43, 0x82,
+    0x40, 0x3c, 0x2c, 0x82, 0xe4, 0x20, 0x1f, 0x60, 0x29, 0x97, 0xff, 0xea, 0x2, 0x31, 0xcc, 0xff,
+    0x3a, 0x8, 0x8c, 0xff, 0x86, 0x82, 0x0, 0x3f, 0xc6, 0xcb, 0x42, 0x1, 0x8f, 0x4c, 0x1, 0x2a,
+    0xae, 0xb9, 0x96, 0x60, 0x4, 0x2, 0xab, 0x55, 0x33, 0x2, 0x34, 0x80,
+
+    /* U+1EBC "Ẽ" */
+    0x0, 0xa3, 0xf4, 0x80, 0x13, 0x0, 0x18, 0xde, 0xeb, 0x10, 0x5f, 0x0, 0x35, 0xb2, 0x3d, 0xdb,
+    0x95, 0x0, 0x34, 0xc0, 0x1, 0x7f, 0x6c, 0x3, 0x84, 0x40, 0x18, 0x80, 0x32, 0x7f, 0xff, 0xc8,
+    0x0, 0x36, 0x6f, 0xf0, 0x1, 0x26, 0x7f, 0x88, 0x3, 0xff, 0xd4, 0x91, 0x1f, 0x84, 0x2, 0x37,
+    0x7f, 0xc4, 0x1, 0x3f, 0xff, 0xe3, 0x0, 0xff, 0xfc, 0x24, 0xcf, 0xf2, 0x80, 0xd, 0x9b, 0xfb,
+    0x0,
+
+    /* U+1EBD "ẽ" */
+    0x0, 0xa3, 0xec, 0x40, 0x1e, 0x1, 0xc6, 0xd8, 0x7a, 0x2c, 0x60, 0x1c, 0x8e, 0x70, 0x9d, 0x3e,
+    0x1, 0xcd, 0x0, 0x8, 0xef, 0x30, 0xe, 0x11, 0x0, 0x42, 0x1, 0xf9, 0x6f, 0xfd, 0xb2, 0x40,
+    0x1d, 0x74, 0xcc, 0x77, 0x36, 0xa0, 0x5, 0x49, 0x3b, 0x31, 0x5a, 0x56, 0x40, 0x8a, 0xec, 0x1,
+    0x8b, 0x2, 0x43, 0x82, 0x40, 0x3c, 0x2c, 0x82, 0xe4, 0x20, 0x1f, 0x60, 0x29, 0x97, 0xff, 0xea,
+    0x2, 0x31, 0xcc, 0xff, 0x3a, 0x8, 0x8c, 0xff, 0x86, 0x82, 0x0, 0x3f, 0xc6, 0xcb, 0x42, 0x1,
+    0x8f, 0x4c, 0x1, 0x2a, 0xae, 0xb9, 0x96, 0x60, 0x4, 0x2, 0xab, 0x55, 0x33, 0x2, 0x34, 0x80,
+
+    /* U+1EBE "Ế" */
+    0x0, 0xff, 0x96, 0xc, 0x3, 0xfc, 0xb4, 0x6, 0x1, 0xfc, 0xb5, 0x30, 0x1, 0xc5, 0xbf, 0xa4,
+    0x4b, 0x60, 0xe, 0x4c, 0x4e, 0x4c, 0x34, 0x0, 0xe1, 0x3a, 0x91, 0x9a, 0x31, 0x0, 0xe1, 0x74,
+    0x0, 0x91, 0xc4, 0x2, 0x4f, 0xff, 0xf9, 0x0, 0x23, 0x66, 0xff, 0x0, 0x49, 0x33, 0xfc, 0x40,
+    0x1f, 0xfe, 0xf4, 0x88, 0xfc, 0x20, 0x18, 0xdd, 0xff, 0x10, 0x6, 0x7f, 0xff, 0xc6, 0x1, 0xff,
+    0xfe, 0x49, 0x9f, 0xe5, 0x0, 0x8d, 0x9b, 0xfb, 0x0,
+
+    /* U+1EBF "ế" */
+    0x0, 0xff, 0x9d, 0xc2, 0x1, 0xfc, 0x37, 0x48, 0x20, 0x1f, 0x8b, 0xb, 0x4c, 0x3, 0x9b, 0x6a,
+    0xc3, 0x64, 0x3, 0x8b, 0x3f, 0x6b, 0xfc, 0xe0, 0x1e, 0x2c, 0x90, 0x2, 0x6b, 0x80, 0x7f, 0xf2,
+    0x56, 0xff, 0xdb, 0x24, 0x1, 0xeb, 0xa6, 0x63, 0xb9, 0xb5, 0x0, 0x35, 0x24, 0xec, 0xc5, 0x69,
+    0x59, 0x0, 0x11, 0x5d, 0x80, 0x31, 0x60, 0x48, 0x3, 0x82, 0x40, 0x3c, 0x2c, 0x82, 0xe, 0x42,
+    0x1, 0xf6, 0x2, 0x81, 0x97, 0xff, 0xea, 0x2, 0x3, 0x1c, 0xcf, 0xf3, 0x82, 0x8, 0x8c, 0xff,
+    0x84, 0x28, 0x20, 0x3, 0xfe, 0x36, 0x5a, 0x10, 0xc, 0x7a, 0x60, 0x14, 0xaa, 0xba, 0xe6, 0x59,
+    0x80, 0x10, 0xd, 0x56, 0xaa, 0x66, 0x4, 0x69, 0x0, 0x0,
+
+    /* U+1EC0 "Ề" */
+    0x0, 0xf9, 0xdc, 0x1, 0xff, 0x1c, 0xd8, 0x7, 0xf9, 0x31, 0xa8, 0x3, 0xc5, 0xbf, 0xa1, 0x9a,
+    0x60, 0x19, 0x31, 0x39, 0x31, 0x5c, 0xc0, 0x21, 0x3a, 0x91, 0x9a, 0x31, 0x0, 0xc2, 0xe8, 0x1,
+    0x23, 0x88, 0x1, 0x3f, 0xff, 0xe4, 0x0, 0x1b, 0x37, 0xf8, 0x0, 0x93, 0x3f, 0xc4, 0x1, 0xff,
+    0xea, 0x48, 0x8f, 0xc2, 0x1, 0x1b, 0xbf, 0xe2, 0x0, 0x9f, 0xff, 0xf1, 0x80, 0x7f, 0xfe, 0x12,
+    0x67, 0xf9, 0x40, 0x6, 0xcd, 0xfd, 0x80,
+
+    /* U+1EC1 "ề" */
+    0x0, 0xf0, 0xbb, 0x0, 0x7f, 0x84, 0xe2, 0x80, 0x3f, 0xc9, 0xe3, 0x62, 0x1, 0xcd, 0xb5, 0x67,
+    0x76, 0x10, 0x8, 0xb3, 0xf6, 0xbf, 0xce, 0x1, 0xc5, 0x92, 0x0, 0x4d, 0x70, 0xf, 0xfe, 0x3a,
+    0xdf, 0xfb, 0x64, 0x80, 0x3a, 0xe9, 0x98, 0xee, 0x6d, 0x40, 0xa, 0x92, 0x76, 0x62, 0xb4, 0xac,
+    0x81, 0x15, 0xd8, 0x3, 0x16, 0x4, 0x87, 0x4, 0x80, 0x78, 0x59, 0x5, 0xc8, 0x40, 0x3e, 0xc0,
+    0x53, 0x2f, 0xff, 0xd4, 0x4, 0x63, 0x99, 0xfe, 0x74, 0x11, 0x19, 0xff, 0xd, 0x4, 0x0, 0x7f,
+    0x8d, 0x96, 0x84, 0x3, 0x1e, 0x98, 0x2, 0x55, 0x5d, 0x73, 0x2c, 0xc0, 0x8, 0x5, 0x56, 0xaa,
+    0x66, 0x4, 0x69, 0x0,
+
+    /* U+1EC2 "Ể" */
+    0x0, 0xfd, 0x9d, 0x0, 0x1f, 0xed, 0xe6, 0x0, 0xff, 0x9, 0x18, 0x7, 0x87, 0x3f, 0x5, 0x38,
+    0x3, 0x93, 0xdb, 0x5b, 0xc8, 0xc0, 0x30, 0xe5, 0x50, 0xaa, 0x98, 0x20, 0x18, 0x61, 0x0, 0x24,
+    0x81, 0x0, 0x27, 0xff, 0xfc, 0x80, 0x3, 0x66, 0xff, 0x0, 0x12, 0x67, 0xf8, 0x80, 0x3f, 0xfd,
+    0x49, 0x11, 0xf8, 0x40, 0x23, 0x77, 0xfc, 0x40, 0x13, 0xff, 0xfe, 0x30, 0xf, 0xff, 0xc2, 0x4c,
+    0xff, 0x28, 0x0, 0xd9, 0xbf, 0xb0,
+
+    /* U+1EC3 "ể" */
+    0x0, 0xf8, 0xf7, 0x94, 0x3, 0xf8, 0xf7, 0x52, 0x1, 0xff, 0x22, 0x80, 0x79, 0xb6, 0xac, 0x86,
+    0x40, 0x31, 0x67, 0xed, 0x7f, 0x84, 0x3, 0x8b, 0x24, 0x0, 0x9a, 0xe0, 0x1f, 0xfc, 0x75, 0xbf,
+    0xf6, 0xc9, 0x0, 0x75, 0xd3, 0x31, 0xdc, 0xda, 0x80, 0x15, 0x24, 0xec, 0xc5, 0x69, 0x59, 0x2,
+    0x2b, 0xb0, 0x6, 0x2c, 0x9, 0xe, 0x9, 0x0, 0xf0, 0xb2, 0xb, 0x90, 0x80, 0x7d, 0x80, 0xa6,
+    0x5f, 0xff, 0xa8, 0x8, 0xc7, 0x33, 0xfc, 0xe8, 0x22, 0x33, 0xfe, 0x1a, 0x8, 0x0, 0xff, 0x1b,
+    0x2d, 0x8, 0x6, 0x3d, 0x30, 0x4, 0xaa, 0xba, 0xe6, 0x59, 0x80, 0x10, 0xa, 0xad, 0x54, 0xcc,
+    0x8, 0xd2, 0x0,
+
+    /* U+1EC4 "Ễ" */
+    0x0, 0x9f, 0xfa, 0x4, 0x5c, 0x40, 0x18, 0xa3, 0x70, 0xbb, 0x8e, 0x40, 0x18, 0xb8, 0x89, 0x5f,
+    0xd2, 0x1, 0xe1, 0x2d, 0xfd, 0x30, 0xf, 0x93, 0x13, 0x93, 0x10, 0x3, 0x84, 0xea, 0x46, 0x68,
+    0xc4, 0x3, 0xb, 0xa0, 0x4, 0x8e, 0x20, 0x4, 0xff, 0xff, 0x90, 0x0, 0x6c, 0xdf, 0xe0, 0x2,
+    0x4c, 0xff, 0x10, 0x7, 0xff, 0xa9, 0x22, 0x3f, 0x8, 0x4, 0x6e, 0xff, 0x88, 0x2, 0x7f, 0xff,
+    0xc6, 0x1, 0xff, 0xf8, 0x49, 0x9f, 0xe5, 0x0, 0x1b, 0x37, 0xf6, 0x0,
+
+    /* U+1EC5 "ễ" */
+    0x0, 0x89, 0xd0, 0x2, 0x70, 0xe, 0x1c, 0xe9, 0x90, 0x2d, 0x80, 0x73, 0xa4, 0xe8, 0x7d, 0x40,
+    0x7, 0x35, 0x80, 0x27, 0xfc, 0x80, 0x1e, 0x16, 0xda, 0xb2, 0x0, 0xf1, 0x67, 0xed, 0x7f, 0x9c,
+    0x3, 0x8b, 0x24, 0x0, 0x9a, 0xe0, 0x1f, 0xfc, 0x75, 0xbf, 0xf6, 0xc9, 0x0, 0x75, 0xd3, 0x31,
+    0xdc, 0xda, 0x80, 0x15, 0x24, 0xec, 0xc5, 0x69, 0x59, 0x2, 0x2b, 0xb0, 0x6, 0x2c, 0x9, 0xe,
+    0x9, 0x0, 0xf0, 0xb2, 0xb, 0x90, 0x80, 0x7d, 0x80, 0xa6, 0x5f, 0xff, 0xa8, 0x8, 0xc7, 0x33,
+    0xfc, 0xe8, 0x22, 0x33, 0xfe, 0x1a, 0x8, 0x0, 0xff, 0x1b, 0x2d, 0x8, 0x6, 0x3d, 0x30, 0x4,
+    0xaa, 0xba, 0xe6, 0x59, 0x80, 0x10, 0xa, 0xad, 0x54, 0xcc, 0x8, 0xd2, 0x0,
+
+    /* U+1EC6 "Ệ" */
+    0x0, 0xc3, 0x9f, 0x82, 0x1, 0xf0, 0xe0, 0xd8, 0xe0, 0x80, 0x70, 0xe3, 0xea, 0x6b, 0xe0, 0x80,
+    0x61, 0xda, 0x0, 0xab, 0x44, 0x0, 0x9f, 0xff, 0xf2, 0x0, 0xd, 0x9b, 0xfc, 0x0, 0x49, 0x9f,
+    0xe2, 0x0, 0xff, 0xfb, 0xbf, 0xff, 0xe3, 0x0, 0x8d, 0xdf, 0xf1, 0x0, 0x49, 0x11, 0xf8, 0x40,
+    0x3f, 0xfd, 0x69, 0x33, 0xfc, 0xa0, 0x3, 0x66, 0xfe, 0xc4, 0xff, 0xff, 0xa4, 0x3, 0xff, 0x8e,
+    0xa0, 0x1f, 0xf4, 0xd4, 0x80, 0x7f, 0xbc, 0x30, 0x3, 0x80,
+
+    /* U+1EC7 "ệ" */
+    0x0, 0xc5, 0xdf, 0x20, 0x1f, 0x8b, 0x5, 0x1a, 0x0, 0x3c, 0x3e, 0x5b, 0x70, 0xee, 0x0, 0xe3,
+    0x9c, 0x20, 0x7d, 0x30, 0xe, 0x24, 0x0, 0xc4, 0x80, 0x1e, 0x5b, 0xff, 0x6c, 0x90, 0x7, 0x5d,
+    0x33, 0x1d, 0xcd, 0xa8, 0x1, 0x52, 0x4e, 0xcc, 0x56, 0x95, 0x90, 0x22, 0xbb, 0x0, 0x62, 0xc0,
+    0x90, 0xe0, 0x90, 0xf, 0xb, 0x20, 0xb9, 0x8, 0x7, 0xd8, 0xa, 0x65, 0xff, 0xfa, 0x80, 0x8c,
+    0x73, 0x3f, 0xce, 0x82, 0x23, 0x3f, 0xe1, 0xa0, 0x80, 0xf, 0xf1, 0xb2, 0xd0, 0x80, 0x63, 0xd3,
+    0x0, 0x4a, 0xab, 0xae, 0x65, 0x98, 0x1, 0x0, 0xaa, 0xd5, 0x4c, 0xc0, 0x8d, 0x20, 0xc, 0x95,
+    0xdf, 0xec, 0x70, 0xf, 0xfe, 0x48, 0xa0, 0x7, 0xfd, 0x96, 0xa0, 0x1f, 0xe4, 0x17, 0x0, 0xe0,
+
+    /* U+1EC8 "Ỉ" */
+    0x5d, 0xe9, 0x6, 0xed, 0x46, 0x33, 0x93, 0x80, 0x2, 0xf8, 0x0, 0xb9, 0x40, 0x5, 0x38, 0x1,
+    0x3e, 0x0, 0x3f, 0xff, 0xe0, 0x1e,
+
+    /* U+1EC9 "ỉ" */
+    0x9, 0xdd, 0x30, 0x3, 0x3e, 0x64, 0x40, 0xa4, 0x82, 0x1, 0xa9, 0x48, 0x2, 0xcb, 0x0, 0xcc,
+    0x1, 0xab, 0xc4, 0x3, 0xff, 0xfa,
+
+    /* U+1ECA "Ị" */
+    0x4f, 0x80, 0xf, 0xff, 0x22, 0x7c, 0x0, 0x65, 0x17, 0xaa, 0x18, 0x60,
+
+    /* U+1ECB "ị" */
+    0xa, 0xe3, 0x5, 0x15, 0xc, 0x96, 0x3, 0x60, 0xf, 0x57, 0x88, 0x7, 0xff, 0x96, 0xbc, 0x40,
+    0x38, 0x50, 0x1, 0x96, 0xa0, 0x82, 0xe0,
+
+    /* U+1ECC "Ọ" */
+    0x0, 0xe5, 0xad, 0xff, 0x75, 0xb0, 0x7, 0xe3, 0xda, 0x51, 0x55, 0x92, 0x79, 0x0, 0x39, 0x70,
+    0xa3, 0xb2, 0xa9, 0x7f, 0x23, 0x6e, 0x1, 0x1d, 0xe, 0x38, 0x80, 0x73, 0x69, 0x42, 0x0, 0x3c,
+    0x28, 0xc0, 0x3f, 0x17, 0x85, 0x1, 0x99, 0x50, 0x3, 0xfc, 0x4e, 0x2b, 0x61, 0xc0, 0x1f, 0xfa,
+    0x83, 0xc8, 0x14, 0x3, 0xff, 0x10, 0x38, 0x80, 0x80, 0x7f, 0xf0, 0x44, 0xc4, 0x4, 0x3, 0xff,
+    0x82, 0x26, 0x40, 0xa0, 0x1f, 0xf8, 0x81, 0xec, 0x38, 0x3, 0xff, 0x50, 0x79, 0x99, 0x50, 0x3,
+    0xfc, 0x4e, 0x2a, 0x1e, 0x14, 0x60, 0x1f, 0x8b, 0xc2, 0x80, 0x7, 0x43, 0x8e, 0x20, 0x1c, 0xda,
+    0x50, 0x80, 0x12, 0xe1, 0x47, 0x65, 0x52, 0xfe, 0x46, 0xdc, 0x3, 0x8f, 0x69, 0x45, 0x56, 0x49,
+    0xe4, 0x0, 0xfc, 0xb5, 0xbf, 0xee, 0xb6, 0x0, 0xff, 0xe9, 0x99, 0x80, 0x3f, 0xf8, 0x99, 0x82,
+    0x0, 0xff, 0xe1, 0x99, 0x18, 0x7, 0xc0,
+
+    /* U+1ECD "ọ" */
+    0x0, 0x92, 0xfb, 0xfa, 0xd4, 0x3, 0xaa, 0xd5, 0x1d, 0xcb, 0x56, 0x1, 0x52, 0xb7, 0x54, 0x4f,
+    0x32, 0x58, 0x1a, 0xa4, 0x80, 0x74, 0xaa, 0x22, 0x82, 0x40, 0x3e, 0x80, 0xe4, 0x12, 0x0, 0xf8,
+    0x88, 0xe6, 0x60, 0xf, 0xe1, 0x33, 0x80, 0x3f, 0x84, 0xd0, 0x4c, 0x3, 0xe2, 0x23, 0xd0, 0x40,
+    0x7, 0xd0, 0x1c, 0x6c, 0x94, 0x1, 0xd2, 0xaa, 0x40, 0x95, 0x57, 0xd4, 0x57, 0x32, 0x50, 0x5,
+    0x56, 0x88, 0x74, 0x5a, 0xb0, 0xe, 0x4b, 0xef, 0xeb, 0x50, 0xf, 0xfe, 0x52, 0x0, 0x7f, 0xd3,
+    0x72, 0x1, 0xfe, 0xc0, 0xf0, 0xe,
+
+    /* U+1ECE "Ỏ" */
+    0x0, 0xf0, 0xd7, 0x61, 0x80, 0x7f, 0xf0, 0x47, 0x30, 0x9c, 0x1, 0xff, 0xc2, 0x62, 0xa2, 0x0,
+    0xff, 0xe2, 0x29, 0x80, 0x7f, 0xf0, 0xce, 0xb8, 0x3, 0xff, 0x86, 0x7a, 0x40, 0x1f, 0xf9, 0x6b,
+    0x7f, 0xdd, 0x6c, 0x1, 0xf8, 0xf6, 0x94, 0x55, 0x64, 0x9e, 0x40, 0xe, 0x5c, 0x28, 0xec, 0xaa,
+    0x5f, 0xc8, 0xdb, 0x80, 0x47, 0x43, 0x8e, 0x20, 0x1c, 0xda, 0x50, 0x80, 0xf, 0xa, 0x30, 0xf,
+    0xc5, 0xe1, 0x40, 0x66, 0x54, 0x0, 0xff, 0x13, 0x8a, 0xd8, 0x70, 0x7, 0xfe, 0xa0, 0xf2, 0x5,
+    0x0, 0xff, 0xc4, 0xe, 0x20, 0x20, 0x1f, 0xfc, 0x11, 0x31, 0x1, 0x0, 0xff, 0xe0, 0x89, 0x90,
+    0x28, 0x7, 0xfe, 0x20, 0x7b, 0xe, 0x0, 0xff, 0xd4, 0x1e, 0x66, 0x54, 0x0, 0xff, 0x13, 0x8a,
+    0x87, 0x85, 0x18, 0x7, 0xe2, 0xf0, 0xa0, 0x1, 0xd0, 0xe3, 0x88, 0x7, 0x36, 0x94, 0x20, 0x4,
+    0xb8, 0x51, 0xd9, 0x54, 0xbf, 0x91, 0xb7, 0x0, 0xe3, 0xda, 0x51, 0x55, 0x92, 0x79, 0x0, 0x20,
+
+    /* U+1ECF "ỏ" */
+    0x0, 0xcb, 0xbd, 0x20, 0x1f, 0xcd, 0xda, 0x8c, 0x1, 0xf8, 0xce, 0x71, 0x0, 0xff, 0x32, 0x30,
+    0x7, 0xfd, 0x82, 0x1, 0xfe, 0x62, 0x0, 0xfc, 0x97, 0xdf, 0xd6, 0xa0, 0x1d, 0x56, 0xa8, 0xee,
+    0x5a, 0xb0, 0xa, 0x95, 0xba, 0xa2, 0x79, 0x92, 0xc0, 0xd5, 0x24, 0x3, 0xa5, 0x51, 0x14, 0x12,
+    0x1, 0xf4, 0x7, 0x20, 0x90, 0x7, 0xc4, 0x47, 0x33, 0x0, 0x7f, 0x9, 0x9c, 0x1, 0xfc, 0x26,
+    0x82, 0x60, 0x1f, 0x11, 0x1e, 0x82, 0x0, 0x3e, 0x80, 0xe3, 0x64, 0xa0, 0xe, 0x95, 0x52, 0x4,
+    0xaa, 0xbe, 0xa2, 0xb9, 0x92, 0x80, 0x2a, 0xb4, 0x43, 0xa2, 0xd5, 0x80, 0x0,
+
+    /* U+1ED0 "Ố" */
+    0x0, 0xff, 0xe0, 0x8b, 0xb0, 0x7, 0xff, 0x8, 0xb3, 0xe, 0x1, 0xff, 0xc1, 0x3c, 0xab, 0x10,
+    0xf, 0xe6, 0xff, 0x41, 0xf3, 0x80, 0x7f, 0xa6, 0x2b, 0x16, 0xc4, 0x3, 0xfc, 0x9d, 0xea, 0x7b,
+    0x88, 0x1, 0xfe, 0x47, 0x10, 0x9, 0xd4, 0x3, 0xfc, 0xb5, 0xbf, 0xee, 0xb6, 0x0, 0xfc, 0x7b,
+    0x4a, 0x2a, 0xb2, 0x4f, 0x20, 0x7, 0x2e, 0x14, 0x76, 0x55, 0x2f, 0xe4, 0x6d, 0xc0, 0x23, 0xa1,
+    0xc7, 0x10, 0xe, 0x6d, 0x28, 0x40, 0x7, 0x85, 0x18, 0x7, 0xe2, 0xf0, 0xa0, 0x33, 0x2a, 0x0,
+    0x7f, 0x89, 0xc5, 0x6c, 0x38, 0x3, 0xff, 0x50, 0x79, 0x2, 0x80, 0x7f, 0xe2, 0x7, 0x10, 0x10,
+    0xf, 0xfe, 0x8, 0x98, 0x80, 0x80, 0x7f, 0xf0, 0x44, 0xc8, 0x14, 0x3, 0xff, 0x10, 0x3d, 0x87,
+    0x0, 0x7f, 0xea, 0xf, 0x33, 0x2a, 0x0, 0x7f, 0x89, 0xc5, 0x43, 0xc2, 0x8c, 0x3, 0xf1, 0x78,
+    0x50, 0x0, 0xe8, 0x71, 0xc4, 0x3, 0x9b, 0x4a, 0x10, 0x2, 0x5c, 0x28, 0xec, 0xaa, 0x5f, 0xc8,
+    0xdb, 0x80, 0x71, 0xed, 0x28, 0xaa, 0xc9, 0x3c, 0x80, 0x10,
+
+    /* U+1ED1 "ố" */
+    0x0, 0xff, 0x96, 0x8, 0x3, 0xfd, 0x15, 0xa4, 0x1, 0xfd, 0x49, 0xaa, 0x1, 0xc9, 0xb3, 0xa9,
+    0x58, 0x40, 0x18, 0x66, 0x3e, 0x7e, 0x24, 0x40, 0x38, 0x67, 0x8, 0xb, 0x24, 0x40, 0x3f, 0xf9,
+    0x9, 0x7d, 0xfd, 0x6a, 0x1, 0xea, 0xb5, 0x47, 0x72, 0xd5, 0x80, 0x6a, 0x56, 0xea, 0x89, 0xe6,
+    0x4b, 0x0, 0x1a, 0xa4, 0x80, 0x74, 0xaa, 0x20, 0x28, 0x24, 0x3, 0xe8, 0xe, 0x4, 0x12, 0x0,
+    0xf8, 0x88, 0xe0, 0x66, 0x0, 0xfe, 0x13, 0x3, 0x30, 0x7, 0xf0, 0x98, 0x20, 0x98, 0x7, 0xc4,
+    0x47, 0xa, 0x8, 0x0, 0xfa, 0x3, 0x80, 0xd9, 0x28, 0x3, 0xa5, 0x54, 0x80, 0x9, 0x55, 0x7d,
+    0x45, 0x73, 0x25, 0x0, 0x6a, 0xb4, 0x43, 0xa2, 0xd5, 0x80, 0x40,
+
+    /* U+1ED2 "Ồ" */
+    0x0, 0xfe, 0x38, 0x40, 0xf, 0xfe, 0x19, 0xf5, 0xb8, 0x7, 0xff, 0xd, 0xb6, 0xa4, 0x3, 0xfe,
+    0x6f, 0xf4, 0x16, 0xc8, 0x7, 0xfa, 0x62, 0xb1, 0x6c, 0x40, 0x3f, 0xc9, 0xde, 0xa7, 0xb8, 0x80,
+    0x1f, 0xe4, 0x71, 0x0, 0x9d, 0x40, 0x3f, 0xcb, 0x5b, 0xfe, 0xeb, 0x60, 0xf, 0xc7, 0xb4, 0xa2,
+    0xab, 0x24, 0xf2, 0x0, 0x72, 0xe1, 0x47, 0x65, 0x52, 0xfe, 0x46, 0xdc, 0x2, 0x3a, 0x1c, 0x71,
+    0x0, 0xe6, 0xd2, 0x84, 0x0, 0x78, 0x51, 0x80, 0x7e, 0x2f, 0xa, 0x3, 0x32, 0xa0, 0x7, 0xf8,
+    0x9c, 0x56, 0xc3, 0x80, 0x3f, 0xf5, 0x7, 0x90, 0x28, 0x7, 0xfe, 0x20, 0x71, 0x1, 0x0, 0xff,
+    0xe0, 0x89, 0x88, 0x8, 0x7, 0xff, 0x4, 0x4c, 0x81, 0x40, 0x3f, 0xf1, 0x3, 0xd8, 0x70, 0x7,
+    0xfe, 0xa0, 0xf3, 0x32, 0xa0, 0x7, 0xf8, 0x9c, 0x54, 0x3c, 0x28, 0xc0, 0x3f, 0x17, 0x85, 0x0,
+    0xe, 0x87, 0x1c, 0x40, 0x39, 0xb4, 0xa1, 0x0, 0x25, 0xc2, 0x8e, 0xca, 0xa5, 0xfc, 0x8d, 0xb8,
+    0x7, 0x1e, 0xd2, 0x8a, 0xac, 0x93, 0xc8, 0x1,
+
+    /* U+1ED3 "ồ" */
+    0x0, 0xf9, 0xdc, 0x1, 0xff, 0x2d, 0xe0, 0x80, 0x7f, 0x16, 0x27, 0x90, 0x7, 0x26, 0xce, 0xa4,
+    0x71, 0x0, 0x43, 0x31, 0xf3, 0xf1, 0x22, 0x1, 0x86, 0x70, 0x80, 0xb2, 0x44, 0x3, 0xff, 0x8c,
+    0x97, 0xdf, 0xd6, 0xa0, 0x1d, 0x56, 0xa8, 0xee, 0x5a, 0xb0, 0xa, 0x95, 0xba, 0xa2, 0x79, 0x92,
+    0xc0, 0xd5, 0x24, 0x3, 0xa5, 0x51, 0x14, 0x12, 0x1, 0xf4, 0x7, 0x20, 0x90, 0x7, 0xc4, 0x47,
+    0x33, 0x0, 0x7f, 0x9, 0x9c, 0x1, 0xfc, 0x26, 0x82, 0x60, 0x1f, 0x11, 0x1e, 0x82, 0x0, 0x3e,
+    0x80, 0xe3, 0x64, 0xa0, 0xe, 0x95, 0x52, 0x4, 0xaa, 0xbe, 0xa2, 0xb9, 0x92, 0x80, 0x2a, 0xb4,
+    0x43, 0xa2, 0xd5, 0x80, 0x0,
+
+    /* U+1ED4 "Ổ" */
+    0x0, 0xff, 0x2e, 0xe8, 0x80, 0x3f, 0xf8, 0x49, 0xb7, 0x60, 0xf, 0xfe, 0x10, 0x87, 0x8, 0x7,
+    0xfc, 0xbd, 0xc7, 0x11, 0x40, 0x7, 0xf9, 0xea, 0x2e, 0x6e, 0x40, 0x3f, 0xc9, 0xda, 0xcb, 0xe6,
+    0xc0, 0x1f, 0xe4, 0x92, 0x0, 0xc, 0xb0, 0x7, 0xf9, 0x6b, 0x7f, 0xdd, 0x6c, 0x1, 0xf8, 0xf6,
+    0x94, 0x55, 0x64, 0x9e, 0x40, 0xe, 0x5c, 0x28, 0xec, 0xaa, 0x5f, 0xc8, 0xdb, 0x80, 0x47, 0x43,
+    0x8e, 0x20, 0x1c, 0xda, 0x50, 0x80, 0xf, 0xa, 0x30, 0xf, 0xc5, 0xe1, 0x40, 0x66, 0x54, 0x0,
+    0xff, 0x13, 0x8a, 0xd8, 0x70, 0x7, 0xfe, 0xa0, 0xf2, 0x5, 0x0, 0xff, 0xc4, 0xe, 0x20, 0x20,
+    0x1f, 0xfc, 0x11, 0x31, 0x1, 0x0, 0xff, 0xe0, 0x89, 0x90, 0x28, 0x7, 0xfe, 0x20, 0x7b, 0xe,
+    0x0, 0xff, 0xd4, 0x1e, 0x66, 0x54, 0x0, 0xff, 0x13, 0x8a, 0x87, 0x85, 0x18, 0x7, 0xe2, 0xf0,
+    0xa0, 0x1, 0xd0, 0xe3, 0x88, 0x7, 0x36, 0x94, 0x20, 0x4, 0xb8, 0x51, 0xd9, 0x54, 0xbf, 0x91,
+    0xb7, 0x0, 0xe3, 0xda, 0x51, 0x55, 0x92, 0x79, 0x0, 0x20,
+
+    /* U+1ED5 "ổ" */
+    0x0, 0xfd, 0x9d, 0x0, 0x1f, 0xed, 0xe6, 0x10, 0xf, 0xe1, 0x33, 0x8, 0x7, 0x26, 0xce, 0xa3,
+    0x78, 0x6, 0x19, 0x8f, 0x9f, 0x8c, 0x30, 0xc, 0x33, 0x84, 0x5, 0x92, 0x20, 0x1f, 0xfc, 0x64,
+    0xbe, 0xfe, 0xb5, 0x0, 0xea, 0xb5, 0x47, 0x72, 0xd5, 0x80, 0x54, 0xad, 0xd5, 0x13, 0xcc, 0x96,
+    0x6, 0xa9, 0x20, 0x1d, 0x2a, 0x88, 0xa0, 0x90, 0xf, 0xa0, 0x39, 0x4, 0x80, 0x3e, 0x22, 0x39,
+    0x98, 0x3, 0xf8, 0x4c, 0xe0, 0xf, 0xe1, 0x34, 0x13, 0x0, 0xf8, 0x88, 0xf4, 0x10, 0x1, 0xf4,
+    0x7, 0x1b, 0x25, 0x0, 0x74, 0xaa, 0x90, 0x25, 0x55, 0xf5, 0x15, 0xcc, 0x94, 0x1, 0x55, 0xa2,
+    0x1d, 0x16, 0xac, 0x0,
+
+    /* U+1ED6 "Ỗ" */
+    0x0, 0xe1, 0xcf, 0xd5, 0x6, 0xb0, 0xf, 0xf4, 0xb7, 0x44, 0x3e, 0x20, 0x1, 0xfe, 0x9a, 0x15,
+    0xde, 0xe1, 0x80, 0x7f, 0x84, 0x1b, 0xfd, 0x20, 0x1f, 0xfc, 0x19, 0x8a, 0xc5, 0xb1, 0x0, 0xff,
+    0x27, 0x7a, 0x9e, 0xe2, 0x0, 0x7f, 0x91, 0xc4, 0x2, 0x75, 0x0, 0xff, 0x2d, 0x6f, 0xfb, 0xad,
+    0x80, 0x3f, 0x1e, 0xd2, 0x8a, 0xac, 0x93, 0xc8, 0x1, 0xcb, 0x85, 0x1d, 0x95, 0x4b, 0xf9, 0x1b,
+    0x70, 0x8, 0xe8, 0x71, 0xc4, 0x3, 0x9b, 0x4a, 0x10, 0x1, 0xe1, 0x46, 0x1, 0xf8, 0xbc, 0x28,
+    0xc, 0xca, 0x80, 0x1f, 0xe2, 0x71, 0x5b, 0xe, 0x0, 0xff, 0xd4, 0x1e, 0x40, 0xa0, 0x1f, 0xf8,
+    0x81, 0xc4, 0x4, 0x3, 0xff, 0x82, 0x26, 0x20, 0x20, 0x1f, 0xfc, 0x11, 0x32, 0x5, 0x0, 0xff,
+    0xc4, 0xf, 0x61, 0xc0, 0x1f, 0xfa, 0x83, 0xcc, 0xca, 0x80, 0x1f, 0xe2, 0x71, 0x50, 0xf0, 0xa3,
+    0x0, 0xfc, 0x5e, 0x14, 0x0, 0x3a, 0x1c, 0x71, 0x0, 0xe6, 0xd2, 0x84, 0x0, 0x97, 0xa, 0x3b,
+    0x2a, 0x97, 0xf2, 0x36, 0xe0, 0x1c, 0x7b, 0x4a, 0x2a, 0xb2, 0x4f, 0x20, 0x4,
+
+    /* U+1ED7 "ỗ" */
+    0x0, 0x85, 0x98, 0x1, 0x30, 0x80, 0x76, 0xed, 0x82, 0x29, 0x0, 0xe2, 0x25, 0xda, 0xbb, 0x90,
+    0x20, 0x18, 0xbc, 0x0, 0xdf, 0xe7, 0x0, 0xf0, 0xa6, 0xce, 0xa0, 0x7, 0x86, 0x63, 0xe7, 0xe2,
+    0x44, 0x3, 0xc, 0xe1, 0x1, 0x64, 0x88, 0x7, 0xff, 0x19, 0x2f, 0xbf, 0xad, 0x40, 0x3a, 0xad,
+    0x51, 0xdc, 0xb5, 0x60, 0x15, 0x2b, 0x75, 0x44, 0xf3, 0x25, 0x81, 0xaa, 0x48, 0x7, 0x4a, 0xa2,
+    0x28, 0x24, 0x3, 0xe8, 0xe, 0x41, 0x20, 0xf, 0x88, 0x8e, 0x66, 0x0, 0xfe, 0x13, 0x38, 0x3,
+    0xf8, 0x4d, 0x4, 0xc0, 0x3e, 0x22, 0x3d, 0x4, 0x0, 0x7d, 0x1, 0xc6, 0xc9, 0x40, 0x1d, 0x2a,
+    0xa4, 0x9, 0x55, 0x7d, 0x45, 0x73, 0x25, 0x0, 0x55, 0x68, 0x87, 0x45, 0xab, 0x0,
+
+    /* U+1ED8 "Ộ" */
+    0x0, 0xf9, 0x7f, 0xce, 0x1, 0xff, 0xc1, 0x5a, 0x79, 0x87, 0x0, 0xff, 0x96, 0xa9, 0xd, 0x93,
+    0x0, 0x1f, 0xe5, 0xf5, 0x0, 0x1f, 0x40, 0x7, 0xf9, 0x6b, 0x7f, 0xdd, 0x6c, 0x1, 0xf8, 0xf6,
+    0x94, 0x55, 0x64, 0x9e, 0x40, 0xe, 0x5c, 0x28, 0xec, 0xaa, 0x5f, 0xc8, 0xdb, 0x80, 0x47, 0x43,
+    0x8e, 0x20, 0x1c, 0xda, 0x50, 0x80, 0xf, 0xa, 0x30, 0xf, 0xc5, 0xe1, 0x40, 0x66, 0x54, 0x0,
+    0xff, 0x13, 0x8a, 0xd8, 0x70, 0x7, 0xfe, 0xa0, 0xf2, 0x5, 0x0, 0xff, 0xc4, 0xe, 0x20, 0x20,
+    0x1f, 0xfc, 0x11, 0x31, 0x1, 0x0, 0xff, 0xe0, 0x89, 0x90, 0x28, 0x7, 0xfe, 0x20, 0x7b, 0xe,
+    0x0, 0xff, 0xd4, 0x1e, 0x66, 0x54, 0x0, 0xff, 0x13, 0x8a, 0x87, 0x85, 0x18, 0x7, 0xe2, 0xf0,
+    0xa0, 0x1, 0xd0, 0xe3, 0x88, 0x7, 0x36, 0x94, 0x20, 0x4, 0xb8, 0x51, 0xd9, 0x54, 0xbf, 0x91,
+    0xb7, 0x0, 0xe3, 0xda, 0x51, 0x55, 0x92, 0x79, 0x0, 0x3f, 0x2d, 0x6f, 0xfb, 0xad, 0x80, 0x3f,
+    0xfa, 0x66, 0x60, 0xf, 0xfe, 0x26, 0x60, 0x80, 0x3f, 0xf8, 0x66, 0x46, 0x1, 0xf0,
+
+    /* U+1ED9 "ộ" */
+    0x0, 0xec, 0xfc, 0x0, 0xfe, 0xb3, 0x43, 0xb0, 0xf, 0xa9, 0x6e, 0xe5, 0xb0, 0xe, 0x1f, 0xf2,
+    0x2, 0x7f, 0x8, 0x6, 0x15, 0x10, 0x8, 0x54, 0x40, 0x39, 0x2f, 0xbf, 0xad, 0x40, 0x3a, 0xad,
+    0x51, 0xdc, 0xb5, 0x60, 0x15, 0x2b, 0x75, 0x44, 0xf3, 0x25, 0x81, 0xaa, 0x48, 0x7, 0x4a, 0xa2,
+    0x28, 0x24, 0x3, 0xe8, 0xe, 0x41, 0x20, 0xf, 0x88, 0x8e, 0x66, 0x0, 0xfe, 0x13, 0x38, 0x3,
+    0xf8, 0x4d, 0x4, 0xc0, 0x3e, 0x22, 0x3d, 0x4, 0x0, 0x7d, 0x1, 0xc6, 0xc9, 0x40, 0x1d, 0x2a,
+    0xa4, 0x9, 0x55, 0x7d, 0x45, 0x73, 0x25, 0x0, 0x55, 0x68, 0x87, 0x45, 0xab, 0x0, 0xe4, 0xbe,
+    0xfe, 0xb5, 0x0, 0xff, 0xe5, 0x20, 0x7, 0xfd, 0x37, 0x20, 0x1f, 0xec, 0xf, 0x0, 0xe0,
+
+    /* U+1EDA "Ớ" */
+    0x0, 0xff, 0x57, 0xc0, 0x7, 0xff, 0xa, 0x56, 0x20, 0x0, 0x1e, 0x30, 0xf, 0xd0, 0xd4, 0xe0,
+    0x10, 0x9a, 0x0, 0x7c, 0x21, 0x8a, 0x1, 0xef, 0x0, 0xf8, 0x60, 0xc0, 0x39, 0x8b, 0x0, 0x39,
+    0x6b, 0x7f, 0xfe, 0x95, 0x40, 0x8, 0xf6, 0x91, 0xde, 0x51, 0x0, 0x16, 0x50, 0x4, 0xb8, 0x73,
+    0xd5, 0x10, 0xae, 0xa1, 0x2b, 0x0, 0x8e, 0x87, 0x18, 0x3, 0xcb, 0xe4, 0xea, 0x0, 0xf0, 0xd2,
+    0x0, 0xfc, 0x3e, 0x16, 0x6, 0x65, 0x30, 0xf, 0xf1, 0x38, 0xb5, 0x87, 0x0, 0x7f, 0xea, 0xc,
+    0x20, 0x50, 0xf, 0xfc, 0x40, 0xe2, 0x2, 0x1, 0xff, 0xc1, 0x13, 0x10, 0x10, 0xf, 0xfe, 0x8,
+    0x99, 0x2, 0x80, 0x7f, 0xe2, 0x7, 0xb0, 0xf0, 0xf, 0xfd, 0x41, 0xe6, 0x64, 0x40, 0x7, 0xf8,
+    0x9c, 0x54, 0x3c, 0x28, 0xc0, 0x3f, 0x16, 0x5, 0x0, 0xe, 0x87, 0x1c, 0x40, 0x39, 0xf4, 0x65,
+    0x0, 0x25, 0xc2, 0x8e, 0xca, 0xa6, 0x7c, 0xd, 0xb0, 0x7, 0x1e, 0xd2, 0x8a, 0xa8, 0x92, 0x79,
+    0x0, 0x20,
+
+    /* U+1EDB "ớ" */
+    0x0, 0xf9, 0x7f, 0x4, 0x3, 0xf3, 0x53, 0x60, 0xb1, 0x0, 0x73, 0x4c, 0xc0, 0xd, 0xb0, 0xe,
+    0x7f, 0x60, 0x8, 0x88, 0x1, 0xc2, 0x1, 0x8d, 0xcc, 0x2, 0x4b, 0xef, 0xfd, 0x85, 0x0, 0xa,
+    0xb7, 0x9a, 0x93, 0x2, 0xc0, 0x5, 0x2c, 0x63, 0xab, 0x64, 0x95, 0x1, 0xab, 0x38, 0x7, 0x33,
+    0xaa, 0x50, 0x58, 0x7, 0xd2, 0x1c, 0x82, 0x40, 0x1f, 0x9, 0x39, 0x98, 0x3, 0xf8, 0x4c, 0xe0,
+    0xf, 0xe2, 0x34, 0x13, 0x0, 0xf8, 0x85, 0xe8, 0x20, 0x3, 0xe9, 0xe, 0x36, 0x4a, 0x0, 0xe9,
+    0x45, 0x40, 0x95, 0x57, 0xd4, 0x57, 0x32, 0x50, 0x5, 0x56, 0x88, 0x74, 0x5a, 0xb0, 0x0,
+
+    /* U+1EDC "Ờ" */
+    0x0, 0xe6, 0xfc, 0x0, 0xff, 0xe1, 0xb5, 0x9d, 0x80, 0x78, 0x78, 0xc0, 0x3c, 0x98, 0xb6, 0x1,
+    0xc2, 0x68, 0x1, 0xf1, 0xe1, 0x98, 0x3, 0xde, 0x1, 0xf8, 0xa0, 0xc0, 0x33, 0x16, 0x0, 0x72,
+    0xd6, 0xff, 0xfd, 0x2a, 0x80, 0x11, 0xed, 0x23, 0xbc, 0xa2, 0x0, 0x2c, 0xa0, 0x9, 0x70, 0xe7,
+    0xaa, 0x21, 0x5d, 0x42, 0x56, 0x1, 0x1d, 0xe, 0x30, 0x7, 0x97, 0xc9, 0xd4, 0x1, 0xe1, 0xa4,
+    0x1, 0xf8, 0x7c, 0x2c, 0xc, 0xca, 0x60, 0x1f, 0xe2, 0x71, 0x6b, 0xe, 0x0, 0xff, 0xd4, 0x18,
+    0x40, 0xa0, 0x1f, 0xf8, 0x81, 0xc4, 0x4, 0x3, 0xff, 0x82, 0x26, 0x20, 0x20, 0x1f, 0xfc, 0x11,
+    0x32, 0x5, 0x0, 0xff, 0xc4, 0xf, 0x61, 0xe0, 0x1f, 0xfa, 0x83, 0xcc, 0xc8, 0x80, 0xf, 0xf1,
+    0x38, 0xa8, 0x78, 0x51, 0x80, 0x7e, 0x2c, 0xa, 0x0, 0x1d, 0xe, 0x38, 0x80, 0x73, 0xe8, 0xca,
+    0x0, 0x4b, 0x85, 0x1d, 0x95, 0x4c, 0xf8, 0x1b, 0x60, 0xe, 0x3d, 0xa5, 0x15, 0x51, 0x24, 0xf2,
+    0x0, 0x40,
+
+    /* U+1EDD "ờ" */
+    0x0, 0xe, 0x7a, 0x80, 0x7f, 0xe, 0x35, 0x30, 0x6, 0x62, 0x0, 0xd3, 0x52, 0xe0, 0x16, 0xd8,
+    0x7, 0x2f, 0xb0, 0x4, 0x44, 0x0, 0xf8, 0x40, 0x6, 0xe6, 0x1, 0x25, 0xf7, 0xfe, 0xc2, 0x80,
+    0x5, 0x5b, 0xcd, 0x49, 0x81, 0x60, 0x2, 0x96, 0x31, 0xd5, 0xb2, 0x4a, 0x80, 0xd5, 0x9c, 0x3,
+    0x99, 0xd5, 0x28, 0x2c, 0x3, 0xe9, 0xe, 0x41, 0x20, 0xf, 0x84, 0x9c, 0xcc, 0x1, 0xfc, 0x26,
+    0x70, 0x7, 0xf1, 0x1a, 0x9, 0x80, 0x7c, 0x42, 0xf4, 0x10, 0x1, 0xf4, 0x87, 0x1b, 0x25, 0x0,
+    0x74, 0xa2, 0xa0, 0x4a, 0xab, 0xea, 0x2b, 0x99, 0x28, 0x2, 0xab, 0x44, 0x3a, 0x2d, 0x58, 0x0,
+
+    /* U+1EDE "Ở" */
+    0x0, 0xf0, 0xd7, 0x61, 0x80, 0x7f, 0xf0, 0x47, 0x30, 0x9c, 0x1, 0xff, 0xc2, 0x62, 0xa2, 0x0,
+    0xc3, 0x64, 0x1, 0xfc, 0xa6, 0x1, 0x85, 0x94, 0x3, 0xf1, 0xd7, 0x0, 0x70, 0xf8, 0x7, 0xe3,
+    0xd2, 0x0, 0xcc, 0x7a, 0x1, 0xcb, 0x5b, 0xff, 0xf4, 0xaa, 0x80, 0x23, 0xda, 0x47, 0x79, 0x44,
+    0x0, 0x57, 0x40, 0x12, 0xe1, 0xcf, 0x54, 0x42, 0xba, 0x84, 0xb0, 0x2, 0x3a, 0x1c, 0x60, 0xf,
+    0x2f, 0x93, 0xa8, 0x3, 0xc3, 0x48, 0x3, 0xf0, 0xf8, 0x58, 0x19, 0x94, 0xc0, 0x3f, 0xc4, 0xe2,
+    0xd6, 0x1c, 0x1, 0xff, 0xa8, 0x30, 0x81, 0x40, 0x3f, 0xf1, 0x3, 0x88, 0x8, 0x7, 0xff, 0x4,
+    0x4c, 0x40, 0x40, 0x3f, 0xf8, 0x22, 0x64, 0xa, 0x1, 0xff, 0x88, 0x1e, 0xc3, 0xc0, 0x3f, 0xf5,
+    0x7, 0x99, 0x91, 0x0, 0x1f, 0xe2, 0x71, 0x50, 0xf0, 0xa3, 0x0, 0xfc, 0x58, 0x14, 0x0, 0x3a,
+    0x1c, 0x71, 0x0, 0xe7, 0xd1, 0x94, 0x0, 0x97, 0xa, 0x3b, 0x2a, 0x99, 0xf0, 0x36, 0xc0, 0x1c,
+    0x7b, 0x4a, 0x2a, 0xa2, 0x49, 0xe4, 0x0, 0x80,
+
+    /* U+1EDF "ở" */
+    0x0, 0xcb, 0xbd, 0x20, 0x1f, 0xcd, 0xda, 0x8c, 0x1, 0xf8, 0xce, 0x71, 0x0, 0x10, 0x80, 0x79,
+    0x91, 0x80, 0x1d, 0x20, 0x1f, 0x60, 0x80, 0x14, 0xc0, 0x3c, 0xc4, 0x0, 0x37, 0x30, 0x9, 0x2f,
+    0xbf, 0xf6, 0x14, 0x80, 0x2a, 0xde, 0x6a, 0x4c, 0xb, 0x4, 0x29, 0x63, 0x1d, 0x5b, 0x24, 0xa8,
+    0xd, 0x59, 0xc0, 0x39, 0x9d, 0x52, 0x82, 0xc0, 0x3e, 0x90, 0xe4, 0x12, 0x0, 0xf8, 0x49, 0xcc,
+    0xc0, 0x1f, 0xc2, 0x67, 0x0, 0x7f, 0x11, 0xa0, 0x98, 0x7, 0xc4, 0x2f, 0x41, 0x0, 0x1f, 0x48,
+    0x71, 0xb2, 0x50, 0x7, 0x4a, 0x2a, 0x4, 0xaa, 0xbe, 0xa2, 0xb9, 0x92, 0x80, 0x2a, 0xb4, 0x43,
+    0xa2, 0xd5, 0x80, 0x0,
+
+    /* U+1EE0 "Ỡ" */
+    0x0, 0xe1, 0xcf, 0x90, 0xb, 0xc4, 0x0, 0x20, 0x1e, 0xb7, 0xc5, 0xb1, 0x61, 0x10, 0xf, 0x18,
+    0x7, 0x24, 0x1e, 0xf, 0x4d, 0x80, 0x4, 0xd0, 0x3, 0xb4, 0xc0, 0x15, 0xbc, 0xa0, 0x10, 0xf8,
+    0x7, 0x18, 0x6, 0x21, 0x0, 0xb, 0x96, 0x0, 0x72, 0xd6, 0xff, 0xfb, 0xa1, 0x50, 0x2, 0x3d,
+    0xa4, 0x77, 0x94, 0x40, 0x7, 0x94, 0x1, 0x2e, 0x1c, 0xf5, 0x44, 0x2b, 0xa8, 0x4e, 0xc0, 0x23,
+    0xa1, 0xc6, 0x0, 0xf2, 0xf9, 0x3a, 0x80, 0x3c, 0x34, 0x80, 0x3f, 0xf, 0x85, 0x81, 0x99, 0x4c,
+    0x3, 0xfc, 0x4e, 0x2d, 0x61, 0xc0, 0x1f, 0xfa, 0x83, 0x8, 0x14, 0x3, 0xff, 0x10, 0x38, 0x80,
+    0x80, 0x7f, 0xf0, 0x44, 0xc4, 0x4, 0x3, 0xff, 0x82, 0x26, 0x40, 0xa0, 0x1f, 0xf8, 0x81, 0xec,
+    0x3c, 0x3, 0xff, 0x50, 0x79, 0x99, 0x10, 0x1, 0xfe, 0x27, 0x15, 0xf, 0xa, 0x30, 0xf, 0xc5,
+    0x81, 0x40, 0x3, 0xa1, 0xc7, 0x10, 0xe, 0x7d, 0x19, 0x40, 0x9, 0x70, 0xa3, 0xb2, 0xa9, 0x9f,
+    0x3, 0x6c, 0x1, 0xc7, 0xb4, 0xa2, 0xaa, 0x24, 0x9e, 0x40, 0x8,
+
+    /* U+1EE1 "ỡ" */
+    0x0, 0x8f, 0xb8, 0x60, 0xe, 0x10, 0xe, 0x89, 0xad, 0x33, 0x85, 0x8, 0x2, 0x47, 0x4a, 0xcc,
+    0x40, 0x4d, 0x80, 0x5a, 0x0, 0x4f, 0xe5, 0x4, 0x20, 0x8, 0x80, 0x30, 0x81, 0xb9, 0x80, 0x49,
+    0x7d, 0xff, 0xb0, 0xa0, 0x1, 0x56, 0xf3, 0x52, 0x60, 0x58, 0x0, 0xa5, 0x8c, 0x75, 0x6c, 0x92,
+    0xa0, 0x35, 0x67, 0x0, 0xe6, 0x75, 0x4a, 0xb, 0x0, 0xfa, 0x43, 0x90, 0x48, 0x3, 0xe1, 0x27,
+    0x33, 0x0, 0x7f, 0x9, 0x9c, 0x1, 0xfc, 0x46, 0x82, 0x60, 0x1f, 0x10, 0xbd, 0x4, 0x0, 0x7d,
+    0x21, 0xc6, 0xc9, 0x40, 0x1d, 0x28, 0xa8, 0x12, 0xaa, 0xfa, 0x8a, 0xe6, 0x4a, 0x0, 0xaa, 0xd1,
+    0xe, 0x8b, 0x56, 0x0,
+
+    /* U+1EE2 "Ợ" */
+    0x0, 0xff, 0xe2, 0x28, 0x7, 0xff, 0x16, 0xd4, 0x3, 0xff, 0x88, 0x5a, 0x1, 0xff, 0xc3, 0x53,
+    0xd0, 0xe, 0x5a, 0xdf, 0xff, 0xa9, 0x14, 0x2, 0x3d, 0xa4, 0x77, 0x94, 0x40, 0x5, 0x76, 0x0,
+    0x97, 0xe, 0x7a, 0xa2, 0x15, 0xd4, 0x25, 0x80, 0x11, 0xd0, 0xe3, 0x0, 0x79, 0x7c, 0x9d, 0x40,
+    0x1e, 0x1a, 0x40, 0x1f, 0x87, 0xc2, 0xc0, 0xcc, 0xa6, 0x1, 0xfe, 0x27, 0x16, 0xb0, 0xe0, 0xf,
+    0xfd, 0x41, 0x84, 0xa, 0x1, 0xff, 0x88, 0x1c, 0x40, 0x40, 0x3f, 0xf8, 0x22, 0x62, 0x2, 0x1,
+    0xff, 0xc1, 0x13, 0x20, 0x50, 0xf, 0xfc, 0x40, 0xf6, 0x1e, 0x1, 0xff, 0xa8, 0x3c, 0xcc, 0x88,
+    0x0, 0xff, 0x13, 0x8a, 0x87, 0x85, 0x18, 0x7, 0xe2, 0xc0, 0xa0, 0x1, 0xd0, 0xe3, 0x88, 0x7,
+    0x3e, 0x8c, 0xa0, 0x4, 0xb8, 0x51, 0xd9, 0x54, 0xcf, 0x81, 0xb6, 0x0, 0xe3, 0xda, 0x51, 0x55,
+    0x12, 0x4f, 0x20, 0x7, 0xe5, 0xad, 0xff, 0x75, 0xb0, 0x7, 0xff, 0x4c, 0xcc, 0x1, 0xff, 0xc4,
+    0xcc, 0x10, 0x7, 0xff, 0xc, 0xc8, 0xc0, 0x3e,
+
+    /* U+1EE3 "ợ" */
+    0x0, 0xff, 0x94, 0x80, 0x3f, 0xee, 0xb0, 0xf, 0xf8, 0x8c, 0x3, 0xfc, 0x6e, 0x40, 0x12, 0x5f,
+    0x7f, 0xec, 0x28, 0x0, 0x55, 0xbc, 0xd4, 0x98, 0x16, 0x0, 0x29, 0x63, 0x1d, 0x5b, 0x24, 0xa8,
+    0xd, 0x59, 0xc0, 0x39, 0x9d, 0x52, 0x82, 0xc0, 0x3e, 0x90, 0xe4, 0x12, 0x0, 0xf8, 0x49, 0xcc,
+    0xc0, 0x1f, 0xc2, 0x67, 0x0, 0x7f, 0x11, 0xa0, 0x98, 0x7, 0xc4, 0x2f, 0x41, 0x0, 0x1f, 0x48,
+    0x71, 0xb2, 0x50, 0x7, 0x4a, 0x2a, 0x4, 0xaa, 0xbe, 0xa2, 0xb9, 0x92, 0x80, 0x2a, 0xb4, 0x43,
+    0xa2, 0xd5, 0x80, 0x72, 0x5f, 0x7f, 0x5a, 0x80, 0x7f, 0xf2, 0x90, 0x3, 0xfe, 0x9b, 0x90, 0xf,
+    0xf6, 0x7, 0x80, 0x70,
+
+    /* U+1EE4 "Ụ" */
+    0x6f, 0x60, 0xf, 0xe5, 0xf6, 0x0, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xc, 0xc, 0x83, 0x80, 0x3f,
+    0xb8, 0x19, 0x41, 0x40, 0x3f, 0x90, 0xc, 0x54, 0x94, 0x3, 0xe5, 0x35, 0x0, 0x40, 0x53, 0x0,
+    0x73, 0x50, 0x40, 0x0, 0xb0, 0x67, 0xae, 0x6b, 0xa4, 0x70, 0x80, 0x23, 0xf8, 0x24, 0x65, 0x28,
+    0xf3, 0x0, 0xe1, 0x7c, 0xff, 0xb1, 0xc4, 0x3, 0xff, 0x9a, 0xa0, 0x1f, 0xfc, 0x19, 0xa9, 0x0,
+    0xff, 0xd8, 0x1e, 0x1, 0xe0,
+
+    /* U+1EE5 "ụ" */
+    0xcf, 0x0, 0xfd, 0xf8, 0x1, 0xff, 0xfc, 0x70, 0xf, 0xf8, 0x40, 0x40, 0x3c, 0x60, 0xd, 0x7,
+    0x0, 0xf5, 0x0, 0x18, 0x20, 0xc0, 0x33, 0xb0, 0x0, 0x64, 0x72, 0xe6, 0xba, 0x28, 0x40, 0xd,
+    0x8a, 0xa6, 0x44, 0x62, 0x80, 0x63, 0xae, 0xfe, 0xa3, 0xe, 0xc0, 0xf, 0xfe, 0x29, 0x98, 0x3,
+    0xf8, 0x73, 0x2, 0x1, 0xf8, 0x48, 0x82, 0x1, 0x80,
+
+    /* U+1EE6 "Ủ" */
+    0x0, 0xe6, 0xde, 0x80, 0xf, 0xf8, 0xbb, 0x59, 0x40, 0x3f, 0xc8, 0x66, 0x43, 0x0, 0xff, 0xc4,
+    0x8a, 0x1, 0xff, 0xba, 0xc, 0x3, 0xff, 0x63, 0x0, 0x79, 0xbd, 0x80, 0x3f, 0x97, 0xd8, 0x3,
+    0xff, 0xfe, 0x1, 0xff, 0xfc, 0x30, 0x32, 0xe, 0x0, 0xfe, 0xe0, 0x65, 0x5, 0x0, 0xfe, 0x40,
+    0x31, 0x52, 0x50, 0xf, 0x94, 0xd4, 0x1, 0x1, 0x4c, 0x1, 0xcd, 0x41, 0x0, 0x2, 0xc1, 0x9e,
+    0xb9, 0xae, 0x91, 0xc2, 0x0, 0x8f, 0xe0, 0x91, 0x94, 0xa3, 0xcc, 0x0,
+
+    /* U+1EE7 "ủ" */
+    0x0, 0x86, 0xbb, 0x10, 0x3, 0xe1, 0xfc, 0xba, 0x0, 0xfc, 0xa4, 0xa2, 0x1, 0xfc, 0x5c, 0xe0,
+    0x1f, 0xc7, 0x30, 0x1, 0xfc, 0x2a, 0x1, 0xd9, 0xe0, 0x1f, 0xbf, 0x0, 0x3f, 0xff, 0x8e, 0x1,
+    0xff, 0x8, 0x8, 0x7, 0x8c, 0x1, 0xa0, 0xe0, 0x1e, 0xa0, 0x3, 0x4, 0x18, 0x6, 0x76, 0x0,
+    0xc, 0x8e, 0x5c, 0xd7, 0x45, 0x8, 0x1, 0xb1, 0x54, 0xc8, 0x8c, 0x50, 0x0,
+
+    /* U+1EE8 "Ứ" */
+    0x0, 0xfc, 0x9f, 0xa2, 0x1, 0xff, 0x8e, 0xcf, 0x4, 0x2, 0xb7, 0x0, 0xf1, 0xea, 0x60, 0x80,
+    0x62, 0xc0, 0xf, 0x2c, 0xd8, 0x7, 0x85, 0xc0, 0x3c, 0xce, 0x1, 0xe1, 0x55, 0x37, 0xb0, 0x7,
+    0xf2, 0xff, 0x4, 0x0, 0x7f, 0xf0, 0x9f, 0x44, 0x3, 0xff, 0x85, 0xc0, 0x1f, 0xff, 0xf0, 0xf,
+    0xff, 0x71, 0x81, 0x80, 0x8, 0x38, 0x3, 0xfb, 0x81, 0x80, 0xa, 0xa, 0x1, 0xfc, 0x80, 0x60,
+    0x1, 0x52, 0x50, 0xf, 0x94, 0xd4, 0x3, 0x40, 0x53, 0x0, 0x73, 0x50, 0x40, 0x6, 0x2c, 0x19,
+    0xeb, 0x9a, 0xe9, 0x1c, 0x20, 0xe, 0x3f, 0x82, 0x46, 0x52, 0x8f, 0x30, 0xc,
+
+    /* U+1EE9 "ứ" */
+    0x0, 0xf1, 0x77, 0xc, 0x3, 0xf8, 0xf0, 0xbc, 0xc0, 0xa, 0x60, 0x19, 0x31, 0xb0, 0x40, 0x2f,
+    0x90, 0xc, 0x9f, 0x0, 0x1c, 0x4c, 0x1, 0xff, 0xa, 0xab, 0x3c, 0x3, 0xf7, 0xf1, 0xd8, 0x7,
+    0xfc, 0x7c, 0x40, 0x1f, 0xff, 0xa7, 0x0, 0xff, 0xe0, 0x88, 0x8, 0x7, 0x8c, 0x3, 0x68, 0x38,
+    0x7, 0xa8, 0x3, 0x30, 0x41, 0x80, 0x67, 0x60, 0xc, 0x32, 0x39, 0x73, 0x5d, 0x14, 0x20, 0x19,
+    0xb1, 0x54, 0xc8, 0x8c, 0x50, 0xc,
+
+    /* U+1EEA "Ừ" */
+    0x0, 0x87, 0x7d, 0x0, 0x3f, 0xf8, 0x23, 0x87, 0x66, 0x1, 0xf5, 0xb8, 0x6, 0x1c, 0x4c, 0x30,
+    0xf, 0x16, 0x0, 0x7a, 0xe5, 0x40, 0x3c, 0x2e, 0x1, 0xf3, 0x30, 0x3, 0x85, 0x54, 0xde, 0xc0,
+    0x1f, 0xcb, 0xfc, 0x10, 0x1, 0xff, 0xc2, 0x7d, 0x10, 0xf, 0xfe, 0x17, 0x0, 0x7f, 0xff, 0xc0,
+    0x3f, 0xfd, 0xc6, 0x6, 0x0, 0x20, 0xe0, 0xf, 0xee, 0x6, 0x0, 0x28, 0x28, 0x7, 0xf2, 0x1,
+    0x80, 0x5, 0x49, 0x40, 0x3e, 0x53, 0x50, 0xd, 0x1, 0x4c, 0x1, 0xcd, 0x41, 0x0, 0x18, 0xb0,
+    0x67, 0xae, 0x6b, 0xa4, 0x70, 0x80, 0x38, 0xfe, 0x9, 0x19, 0x4a, 0x3c, 0xc0, 0x30,
+
+    /* U+1EEB "ừ" */
+    0x0, 0x4f, 0xc8, 0x7, 0xfd, 0x34, 0xd4, 0x1, 0xe5, 0x30, 0x9, 0x75, 0xec, 0x3, 0xbe, 0x40,
+    0x31, 0x6d, 0x80, 0x71, 0x30, 0x7, 0xfc, 0x2a, 0xac, 0xf0, 0xf, 0xdf, 0xc7, 0x60, 0x1f, 0xf1,
+    0xf1, 0x0, 0x7f, 0xfe, 0x9c, 0x3, 0xff, 0x82, 0x20, 0x20, 0x1e, 0x30, 0xd, 0xa0, 0xe0, 0x1e,
+    0xa0, 0xc, 0xc1, 0x6, 0x1, 0x9d, 0x80, 0x30, 0xc8, 0xe5, 0xcd, 0x74, 0x50, 0x80, 0x66, 0xc5,
+    0x53, 0x22, 0x31, 0x40, 0x30,
+
+    /* U+1EEC "Ử" */
+    0x0, 0xe6, 0xde, 0x80, 0xf, 0xfe, 0x9, 0x76, 0xb2, 0x80, 0x7f, 0xe4, 0x33, 0x21, 0x80, 0x74,
+    0xb0, 0x7, 0xc4, 0x8a, 0x1, 0xed, 0x0, 0xfb, 0xa0, 0xc0, 0x38, 0x5c, 0x3, 0xec, 0x60, 0xe,
+    0x15, 0x53, 0x7b, 0x0, 0x7f, 0x2f, 0xf1, 0xc0, 0x7, 0xff, 0x9, 0xf8, 0x40, 0x3f, 0xf8, 0x5c,
+    0x1, 0xff, 0xff, 0x0, 0xff, 0xf7, 0x18, 0x18, 0x0, 0x83, 0x80, 0x3f, 0xb8, 0x18, 0x0, 0xa0,
+    0xa0, 0x1f, 0xc8, 0x6, 0x0, 0x15, 0x25, 0x0, 0xf9, 0x4d, 0x40, 0x34, 0x5, 0x30, 0x7, 0x35,
+    0x4, 0x0, 0x62, 0xc1, 0x9e, 0xb9, 0xae, 0x91, 0xc2, 0x0, 0xe3, 0xf8, 0x24, 0x65, 0x28, 0xf3,
+    0x0, 0xc0,
+
+    /* U+1EED "ử" */
+    0x0, 0x8f, 0x3a, 0xc4, 0x3, 0xf8, 0xa3, 0x6, 0xc0, 0x3f, 0x85, 0xb, 0x4, 0x3, 0x10, 0x80,
+    0x72, 0x47, 0x80, 0x69, 0x80, 0xe, 0x7d, 0x40, 0xc, 0x6a, 0x1, 0xc6, 0x60, 0xc, 0x2a, 0xd9,
+    0xe0, 0x1f, 0xbf, 0x8e, 0x0, 0x3f, 0xe3, 0xe2, 0x0, 0xff, 0xfd, 0x38, 0x7, 0xff, 0x4, 0x40,
+    0x40, 0x3c, 0x60, 0x1b, 0x41, 0xc0, 0x3d, 0x40, 0x19, 0x82, 0xc, 0x3, 0x3b, 0x0, 0x61, 0x91,
+    0xcb, 0x9a, 0xe8, 0xa1, 0x0, 0xcd, 0x8a, 0xa6, 0x44, 0x62, 0x80, 0x60,
+
+    /* U+1EEE "Ữ" */
+    0x0, 0xd1, 0xfa, 0x40, 0x9, 0x80, 0xf, 0xc6, 0xf7, 0x58, 0x82, 0xf8, 0x1, 0x64, 0x0, 0x56,
+    0xa8, 0xf5, 0x7c, 0xa8, 0x1, 0x22, 0x0, 0x29, 0xb0, 0x2, 0x7e, 0xd8, 0x7, 0xf0, 0x88, 0x3,
+    0x10, 0x6, 0x26, 0x46, 0xf6, 0x0, 0xfe, 0x5f, 0xd3, 0x90, 0xf, 0xfe, 0x13, 0xe8, 0x80, 0x7f,
+    0xf0, 0xb8, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xee, 0x30, 0x30, 0x1, 0x7, 0x0, 0x7f, 0x70, 0x30,
+    0x1, 0x41, 0x40, 0x3f, 0x90, 0xc, 0x0, 0x2a, 0x4a, 0x1, 0xf2, 0x9a, 0x80, 0x68, 0xa, 0x60,
+    0xe, 0x6a, 0x8, 0x0, 0xc5, 0x83, 0x3d, 0x73, 0x5d, 0x23, 0x84, 0x1, 0xc7, 0xf0, 0x48, 0xca,
+    0x51, 0xe6, 0x1, 0x80,
+
+    /* U+1EEF "ữ" */
+    0x0, 0x16, 0xfb, 0x0, 0x22, 0x0, 0x1e, 0x94, 0xcb, 0x60, 0x5c, 0x0, 0x19, 0x80, 0x9, 0x7,
+    0xf7, 0xec, 0x80, 0x8, 0x90, 0x6, 0x88, 0x16, 0xea, 0xc0, 0x23, 0x60, 0x1, 0x0, 0x62, 0x0,
+    0x85, 0x55, 0x9e, 0x1, 0xfb, 0xf8, 0xec, 0x3, 0xfe, 0x3e, 0x20, 0xf, 0xff, 0xd3, 0x80, 0x7f,
+    0xf0, 0x44, 0x4, 0x3, 0xc6, 0x1, 0xb4, 0x1c, 0x3, 0xd4, 0x1, 0x98, 0x20, 0xc0, 0x33, 0xb0,
+    0x6, 0x19, 0x1c, 0xb9, 0xae, 0x8a, 0x10, 0xc, 0xd8, 0xaa, 0x64, 0x46, 0x28, 0x6,
+
+    /* U+1EF0 "Ự" */
+    0x0, 0xff, 0xe1, 0xb1, 0x80, 0x7f, 0xf0, 0xf2, 0x40, 0x3f, 0xf8, 0x64, 0xc0, 0x1f, 0xfc, 0x21,
+    0x55, 0x37, 0xb0, 0x7, 0xf2, 0xff, 0x1d, 0x80, 0x7f, 0xf0, 0x9f, 0x88, 0x3, 0xff, 0x85, 0xc0,
+    0x1f, 0xff, 0xf0, 0xf, 0xff, 0x71, 0x81, 0x80, 0x8, 0x38, 0x3, 0xfb, 0x81, 0x80, 0xa, 0xa,
+    0x1, 0xfc, 0x80, 0x60, 0x1, 0x52, 0x50, 0xf, 0x94, 0xd4, 0x3, 0x40, 0x53, 0x0, 0x73, 0x50,
+    0x40, 0x6, 0x2c, 0x19, 0xeb, 0x9a, 0xe9, 0x1c, 0x20, 0xe, 0x3f, 0x82, 0x46, 0x52, 0x8f, 0x30,
+    0xf, 0x85, 0xf3, 0xfe, 0xc7, 0x10, 0xf, 0xfe, 0x8a, 0x80, 0x7f, 0xf0, 0xe6, 0xa4, 0x3, 0xff,
+    0x85, 0x81, 0xe0, 0x1f, 0x80,
+
+    /* U+1EF1 "ự" */
+    0x0, 0xff, 0xcc, 0x60, 0x1f, 0xfb, 0x24, 0x3, 0xff, 0x13, 0x0, 0x7f, 0xc2, 0xaa, 0xcf, 0x0,
+    0xfd, 0xfc, 0x76, 0x1, 0xff, 0x1f, 0x10, 0x7, 0xff, 0xe9, 0xc0, 0x3f, 0xf8, 0x22, 0x2, 0x1,
+    0xe3, 0x0, 0xda, 0xe, 0x1, 0xea, 0x0, 0xcc, 0x10, 0x60, 0x19, 0xd8, 0x3, 0xc, 0x8e, 0x5c,
+    0xd7, 0x45, 0x8, 0x6, 0x6c, 0x55, 0x32, 0x23, 0x14, 0x3, 0xc7, 0x5d, 0xfd, 0x46, 0x1d, 0x80,
+    0x1f, 0xfc, 0x93, 0x30, 0x7, 0xfc, 0x39, 0x81, 0x0, 0xff, 0x9, 0x10, 0x40, 0x3c,
+
+    /* U+1EF2 "Ỳ" */
+    0x0, 0x85, 0xdc, 0x20, 0x1f, 0xf8, 0x52, 0x70, 0x80, 0x3f, 0xf1, 0xfb, 0x61, 0x0, 0x7f, 0xe1,
+    0xb8, 0x50, 0xf, 0xfe, 0x13, 0x38, 0x7, 0xd5, 0xe6, 0x1, 0xfe, 0xde, 0xb, 0xe, 0x0, 0xfe,
+    0x72, 0xb0, 0x18, 0x26, 0x0, 0xf8, 0x61, 0x14, 0x0, 0xe5, 0x22, 0x1, 0xeb, 0x9, 0x0, 0xd2,
+    0x16, 0x1, 0xc8, 0xae, 0x40, 0x19, 0x15, 0x48, 0x1, 0xa4, 0xa0, 0x3, 0xd6, 0x12, 0x1, 0x39,
+    0x48, 0x7, 0xc3, 0x4, 0xe0, 0x50, 0x88, 0x0, 0xfc, 0xe5, 0x3, 0x21, 0x20, 0x1f, 0xee, 0xc,
+    0x48, 0x20, 0xf, 0xf1, 0xa9, 0x11, 0xc0, 0x3f, 0xf7, 0x2, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xf0,
+
+    /* U+1EF3 "ỳ" */
+    0x0, 0x93, 0xb4, 0x80, 0x3f, 0xc9, 0xe3, 0x84, 0x1, 0xfe, 0x1c, 0x7d, 0x30, 0xf, 0xfa, 0x7c,
+    0xc0, 0x3f, 0xf9, 0x19, 0xe0, 0x1f, 0xdd, 0x81, 0x20, 0xe0, 0x1f, 0x28, 0xc8, 0x29, 0x50, 0x7,
+    0xd2, 0x2a, 0x0, 0xa2, 0x50, 0xe, 0x33, 0x48, 0x4, 0xe1, 0x20, 0x1d, 0x40, 0xc0, 0x19, 0x8c,
+    0xc0, 0x10, 0xb3, 0x4, 0x3, 0x58, 0x48, 0x4, 0xc1, 0x60, 0x1c, 0x48, 0xa2, 0x0, 0x94, 0x20,
+    0xf, 0x78, 0x30, 0x28, 0xf0, 0x7, 0xc8, 0x52, 0x12, 0x4a, 0x1, 0xfa, 0xc6, 0xe, 0x80, 0x3f,
+    0x98, 0x5c, 0x18, 0x3, 0xfc, 0xc0, 0xc2, 0x1, 0xff, 0xac, 0x3, 0xfe, 0x64, 0x20, 0xf, 0x18,
+    0x5, 0x23, 0x0, 0x1e, 0x5c, 0xa8, 0xb6, 0x61, 0x80, 0x79, 0x19, 0x1d, 0x62, 0x40, 0x3e,
+
+    /* U+1EF4 "Ỵ" */
+    0xaf, 0x30, 0xf, 0xf6, 0xf0, 0x58, 0x70, 0x7, 0xf3, 0x95, 0x80, 0xc1, 0x30, 0x7, 0xc3, 0x8,
+    0xa0, 0x7, 0x29, 0x10, 0xf, 0x58, 0x48, 0x6, 0x90, 0xb0, 0xe, 0x45, 0x72, 0x0, 0xc8, 0xaa,
+    0x40, 0xd, 0x25, 0x0, 0x1e, 0xb0, 0x90, 0x9, 0xca, 0x40, 0x3e, 0x18, 0x27, 0x2, 0x84, 0x40,
+    0x7, 0xe7, 0x28, 0x19, 0x9, 0x0, 0xff, 0x70, 0x62, 0x41, 0x0, 0x7f, 0x8d, 0x48, 0x8e, 0x1,
+    0xff, 0xb8, 0x14, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xc6, 0x4f, 0x80, 0xf, 0xfe, 0x92, 0x88, 0x7,
+    0xff, 0x5, 0xea, 0x80, 0x1f, 0xfc, 0x13, 0xc, 0x0, 0xf8,
+
+    /* U+1EF5 "ỵ" */
+    0xc, 0xf0, 0xf, 0xee, 0xc0, 0x90, 0x70, 0xf, 0x94, 0x64, 0x14, 0xa8, 0x3, 0xe9, 0x15, 0x0,
+    0x51, 0x28, 0x7, 0x19, 0xa4, 0x2, 0x70, 0x90, 0xe, 0xa0, 0x60, 0xc, 0xc6, 0x60, 0x8, 0x59,
+    0x82, 0x1, 0xac, 0x24, 0x2, 0x60, 0xb0, 0xe, 0x24, 0x51, 0x0, 0x4a, 0x10, 0x7, 0xbc, 0x18,
+    0x14, 0x78, 0x3, 0xe4, 0x29, 0x9, 0x25, 0x0, 0xfd, 0x63, 0x7, 0x40, 0x1f, 0xcc, 0x2e, 0xc,
+    0x1, 0xfe, 0x60, 0x61, 0x0, 0xff, 0xd6, 0x1, 0xff, 0x32, 0x10, 0x7, 0xfa, 0x46, 0x0, 0x50,
+    0x2, 0x4e, 0x98, 0xb6, 0x61, 0x86, 0xdb, 0x0, 0x15, 0xde, 0x58, 0x90, 0x2, 0x2, 0x80, 0x0,
+
+    /* U+1EF6 "Ỷ" */
+    0x0, 0xe5, 0xde, 0x90, 0xf, 0xfc, 0xdd, 0xa8, 0xc0, 0x1f, 0xf1, 0x9c, 0x9c, 0x1, 0xff, 0xc1,
+    0x17, 0xc0, 0xf, 0xfe, 0xd, 0xca, 0x0, 0x7f, 0xf0, 0x69, 0xc0, 0x3e, 0xaf, 0x30, 0xf, 0xf6,
+    0xf0, 0x58, 0x70, 0x7, 0xf3, 0x95, 0x80, 0xc1, 0x30, 0x7, 0xc3, 0x8, 0xa0, 0x7, 0x29, 0x10,
+    0xf, 0x58, 0x48, 0x6, 0x90, 0xb0, 0xe, 0x45, 0x72, 0x0, 0xc8, 0xaa, 0x40, 0xd, 0x25, 0x0,
+    0x1e, 0xb0, 0x90, 0x9, 0xca, 0x40, 0x3e, 0x18, 0x27, 0x2, 0x84, 0x40, 0x7, 0xe7, 0x28, 0x19,
+    0x9, 0x0, 0xff, 0x70, 0x62, 0x41, 0x0, 0x7f, 0x8d, 0x48, 0x8e, 0x1, 0xff, 0xb8, 0x14, 0x3,
+    0xff, 0xfe, 0x1, 0xff, 0x80,
+
+    /* U+1EF7 "ỷ" */
+    0x0, 0xe9, 0xed, 0x50, 0xf, 0xf6, 0x62, 0x28, 0x40, 0x3f, 0x94, 0x94, 0x3, 0xff, 0xd, 0xa8,
+    0x80, 0x7f, 0x87, 0x68, 0x3, 0xff, 0x30, 0x7, 0xd9, 0xe0, 0x1f, 0xdd, 0x81, 0x20, 0xe0, 0x1f,
+    0x28, 0xc8, 0x29, 0x50, 0x7, 0xd2, 0x2a, 0x0, 0xa2, 0x50, 0xe, 0x33, 0x48, 0x4, 0xe1, 0x20,
+    0x1d, 0x40, 0xc0, 0x19, 0x8c, 0xc0, 0x10, 0xb3, 0x4, 0x3, 0x58, 0x48, 0x4, 0xc1, 0x60, 0x1c,
+    0x48, 0xa2, 0x0, 0x94, 0x20, 0xf, 0x78, 0x30, 0x28, 0xf0, 0x7, 0xc8, 0x52, 0x12, 0x4a, 0x1,
+    0xfa, 0xc6, 0xe, 0x80, 0x3f, 0x98, 0x5c, 0x18, 0x3, 0xfc, 0xc0, 0xc2, 0x1, 0xff, 0xac, 0x3,
+    0xfe, 0x64, 0x20, 0xf, 0x18, 0x5, 0x23, 0x0, 0x1e, 0x5c, 0xa8, 0xb6, 0x61, 0x80, 0x79, 0x19,
+    0x1d, 0x62, 0x40, 0x3e,
+
+    /* U+1EF8 "Ỹ" */
+    0x0, 0xcf, 0xfa, 0x60, 0x7, 0x90, 0xf, 0x8a, 0x2a, 0xf1, 0x46, 0xbc, 0x3, 0xe4, 0x42, 0xb6,
+    0x5f, 0xb, 0x0, 0x7c, 0xf4, 0x0, 0x3e, 0xdc, 0x0, 0xfc, 0x22, 0x0, 0xc4, 0x1, 0xea, 0xf3,
+    0x0, 0xff, 0x6f, 0x5, 0x87, 0x0, 0x7f, 0x39, 0x58, 0xc, 0x13, 0x0, 0x7c, 0x30, 0x8a, 0x0,
+    0x72, 0x91, 0x0, 0xf5, 0x84, 0x80, 0x69, 0xb, 0x0, 0xe4, 0x57, 0x20, 0xc, 0x8a, 0xa4, 0x0,
+    0xd2, 0x50, 0x1, 0xeb, 0x9, 0x0, 0x9c, 0xa4, 0x3, 0xe1, 0x82, 0x70, 0x28, 0x44, 0x0, 0x7e,
+    0x72, 0x81, 0x90, 0x90, 0xf, 0xf7, 0x6, 0x24, 0x10, 0x7, 0xf8, 0xd4, 0x88, 0xe0, 0x1f, 0xfb,
+    0x81, 0x40, 0x3f, 0xff, 0xe0, 0x1f, 0xf8,
+
+    /* U+1EF9 "ỹ" */
+    0x0, 0xd3, 0xf4, 0x0, 0x2e, 0x0, 0xf2, 0x23, 0xe, 0xc1, 0x54, 0x1, 0xec, 0x53, 0x92, 0xf9,
+    0x90, 0x7, 0xa6, 0x40, 0x9, 0xee, 0x10, 0x7, 0x84, 0x40, 0x10, 0x80, 0x7b, 0x3c, 0x3, 0xfb,
+    0xb0, 0x24, 0x1c, 0x3, 0xe5, 0x19, 0x5, 0x2a, 0x0, 0xfa, 0x45, 0x40, 0x14, 0x4a, 0x1, 0xc6,
+    0x69, 0x0, 0x9c, 0x24, 0x3, 0xa8, 0x18, 0x3, 0x31, 0x98, 0x2, 0x16, 0x60, 0x80, 0x6b, 0x9,
+    0x0, 0x98, 0x2c, 0x3, 0x89, 0x14, 0x40, 0x12, 0x84, 0x1, 0xef, 0x6, 0x5, 0x1e, 0x0, 0xf9,
+    0xa, 0x42, 0x49, 0x40, 0x3f, 0x58, 0xc1, 0xd0, 0x7, 0xf3, 0xb, 0x83, 0x0, 0x7f, 0x98, 0x18,
+    0x40, 0x3f, 0xf5, 0x80, 0x7f, 0xcc, 0x84, 0x1, 0xe3, 0x0, 0xa4, 0x60, 0x3, 0xcb, 0x95, 0x16,
+    0xcc, 0x30, 0xf, 0x23, 0x23, 0xac, 0x48, 0x7, 0xc0, 0x0,
+
+};
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 101, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 100, .box_w = 4, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 27, .adv_w = 143, .box_w = 7, .box_h = 7, .ofs_x = 1, .ofs_y = 10},
+    {.bitmap_index = 45, .adv_w = 267, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 151, .adv_w = 236, .box_w = 13, .box_h = 24, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 256, .adv_w = 318, .box_w = 18, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 392, .adv_w = 257, .box_w = 15, .box_h = 18, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 509, .adv_w = 78, .box_w = 3, .box_h = 7, .ofs_x = 1, .ofs_y = 10},
+    {.bitmap_index = 518, .adv_w = 126, .box_w = 5, .box_h = 23, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 575, .adv_w = 126, .box_w = 6, .box_h = 23, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 634, .adv_w = 148, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 9},
+    {.bitmap_index = 671, .adv_w = 221, .box_w = 12, .box_h = 11, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 704, .adv_w = 81, .box_w = 3, .box_h = 7, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 715, .adv_w = 147, .box_w = 7, .box_h = 2, .ofs_x = 1, .ofs_y = 6},
+    {.bitmap_index = 720, .adv_w = 81, .box_w = 3, .box_h = 3, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 725, .adv_w = 129, .box_w = 10, .box_h = 23, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 799, .adv_w = 254, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 893, .adv_w = 139, .box_w = 6, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 906, .adv_w = 218, .box_w = 13, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 984, .adv_w = 217, .box_w = 13, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1062, .adv_w = 254, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1135, .adv_w = 217, .box_w = 13, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1213, .adv_w = 234, .box_w = 13, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1310, .adv_w = 226, .box_w = 14, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1382, .adv_w = 245, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1487, .adv_w = 234, .box_w = 14, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1583, .adv_w = 81, .box_w = 3, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1597, .adv_w = 81, .box_w = 3, .box_h = 17, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 1617, .adv_w = 221, .box_w = 12, .box_h = 11, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 1670, .adv_w = 221, .box_w = 12, .box_h = 9, .ofs_x = 1, .ofs_y = 4},
+    {.bitmap_index = 1694, .adv_w = 221, .box_w = 12, .box_h = 11, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 1747, .adv_w = 218, .box_w = 12, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1816, .adv_w = 397, .box_w = 23, .box_h = 22, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 2018, .adv_w = 275, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2121, .adv_w = 290, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2205, .adv_w = 272, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2304, .adv_w = 317, .box_w = 17, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2394, .adv_w = 257, .box_w = 13, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2430, .adv_w = 243, .box_w = 13, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2460, .adv_w = 297, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2560, .adv_w = 312, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2588, .adv_w = 116, .box_w = 3, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2593, .adv_w = 192, .box_w = 11, .box_h = 17, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 2633, .adv_w = 273, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2717, .adv_w = 226, .box_w = 12, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2735, .adv_w = 367, .box_w = 19, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2833, .adv_w = 312, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2905, .adv_w = 322, .box_w = 18, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3020, .adv_w = 276, .box_w = 14, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3081, .adv_w = 322, .box_w = 19, .box_h = 21, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 3229, .adv_w = 278, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3308, .adv_w = 236, .box_w = 13, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3396, .adv_w = 220, .box_w = 14, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3419, .adv_w = 304, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3469, .adv_w = 268, .box_w = 17, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3569, .adv_w = 427, .box_w = 26, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3737, .adv_w = 252, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3840, .adv_w = 244, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3913, .adv_w = 250, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3985, .adv_w = 122, .box_w = 6, .box_h = 23, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 4005, .adv_w = 129, .box_w = 10, .box_h = 23, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 4078, .adv_w = 122, .box_w = 5, .box_h = 23, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 4097, .adv_w = 221, .box_w = 11, .box_h = 10, .ofs_x = 1, .ofs_y = 4},
+    {.bitmap_index = 4142, .adv_w = 192, .box_w = 12, .box_h = 2, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 4147, .adv_w = 230, .box_w = 6, .box_h = 3, .ofs_x = 3, .ofs_y = 15},
+    {.bitmap_index = 4157, .adv_w = 227, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4219, .adv_w = 260, .box_w = 14, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4297, .adv_w = 216, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4360, .adv_w = 260, .box_w = 13, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4436, .adv_w = 232, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4506, .adv_w = 130, .box_w = 9, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4544, .adv_w = 263, .box_w = 14, .box_h = 18, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 4652, .adv_w = 260, .box_w = 12, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4694, .adv_w = 103, .box_w = 4, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4708, .adv_w = 105, .box_w = 8, .box_h = 23, .ofs_x = -3, .ofs_y = -5},
+    {.bitmap_index = 4743, .adv_w = 230, .box_w = 13, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4806, .adv_w = 103, .box_w = 3, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4811, .adv_w = 407, .box_w = 22, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4878, .adv_w = 260, .box_w = 12, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4915, .adv_w = 241, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4985, .adv_w = 260, .box_w = 14, .box_h = 18, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 5067, .adv_w = 260, .box_w = 13, .box_h = 18, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 5146, .adv_w = 154, .box_w = 7, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5169, .adv_w = 187, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5233, .adv_w = 156, .box_w = 10, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5268, .adv_w = 258, .box_w = 12, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5306, .adv_w = 208, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5373, .adv_w = 338, .box_w = 21, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5487, .adv_w = 205, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5558, .adv_w = 208, .box_w = 14, .box_h = 18, .ofs_x = -1, .ofs_y = -5},
+    {.bitmap_index = 5650, .adv_w = 196, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5699, .adv_w = 128, .box_w = 7, .box_h = 23, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 5740, .adv_w = 113, .box_w = 3, .box_h = 23, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 5745, .adv_w = 128, .box_w = 7, .box_h = 23, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 5788, .adv_w = 221, .box_w = 12, .box_h = 6, .ofs_x = 1, .ofs_y = 6},
+    {.bitmap_index = 5822, .adv_w = 275, .box_w = 18, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5949, .adv_w = 275, .box_w = 18, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6076, .adv_w = 275, .box_w = 18, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6206, .adv_w = 275, .box_w = 18, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6340, .adv_w = 257, .box_w = 13, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6397, .adv_w = 257, .box_w = 13, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6454, .adv_w = 257, .box_w = 13, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6516, .adv_w = 116, .box_w = 7, .box_h = 22, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 6541, .adv_w = 116, .box_w = 6, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6564, .adv_w = 322, .box_w = 18, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6703, .adv_w = 322, .box_w = 18, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6843, .adv_w = 322, .box_w = 18, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6986, .adv_w = 322, .box_w = 18, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7131, .adv_w = 304, .box_w = 15, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 7204, .adv_w = 304, .box_w = 15, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 7276, .adv_w = 244, .box_w = 16, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7371, .adv_w = 227, .box_w = 11, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7450, .adv_w = 227, .box_w = 11, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7530, .adv_w = 227, .box_w = 11, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7615, .adv_w = 227, .box_w = 11, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7702, .adv_w = 232, .box_w = 13, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7791, .adv_w = 232, .box_w = 13, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7879, .adv_w = 232, .box_w = 13, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7973, .adv_w = 103, .box_w = 6, .box_h = 18, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 7992, .adv_w = 103, .box_w = 7, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8013, .adv_w = 241, .box_w = 13, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8102, .adv_w = 241, .box_w = 13, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8191, .adv_w = 241, .box_w = 13, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8285, .adv_w = 241, .box_w = 13, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8382, .adv_w = 258, .box_w = 12, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 8438, .adv_w = 258, .box_w = 12, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 8494, .adv_w = 208, .box_w = 14, .box_h = 23, .ofs_x = -1, .ofs_y = -5},
+    {.bitmap_index = 8605, .adv_w = 275, .box_w = 18, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8735, .adv_w = 227, .box_w = 11, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8820, .adv_w = 319, .box_w = 19, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8926, .adv_w = 260, .box_w = 16, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9027, .adv_w = 116, .box_w = 7, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9054, .adv_w = 103, .box_w = 7, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9079, .adv_w = 304, .box_w = 15, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 9159, .adv_w = 258, .box_w = 12, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 9223, .adv_w = 322, .box_w = 18, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9355, .adv_w = 241, .box_w = 13, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9439, .adv_w = 306, .box_w = 17, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 9520, .adv_w = 260, .box_w = 14, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 9578, .adv_w = 275, .box_w = 18, .box_h = 22, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 9702, .adv_w = 227, .box_w = 11, .box_h = 18, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 9782, .adv_w = 275, .box_w = 18, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9914, .adv_w = 227, .box_w = 11, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9998, .adv_w = 275, .box_w = 18, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10140, .adv_w = 227, .box_w = 13, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 10239, .adv_w = 275, .box_w = 18, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10380, .adv_w = 227, .box_w = 11, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 10470, .adv_w = 275, .box_w = 18, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10611, .adv_w = 227, .box_w = 11, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 10702, .adv_w = 275, .box_w = 18, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10846, .adv_w = 227, .box_w = 11, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 10945, .adv_w = 275, .box_w = 18, .box_h = 26, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 11092, .adv_w = 227, .box_w = 11, .box_h = 23, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 11195, .adv_w = 275, .box_w = 18, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11334, .adv_w = 227, .box_w = 11, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 11428, .adv_w = 275, .box_w = 18, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11568, .adv_w = 227, .box_w = 11, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 11662, .adv_w = 275, .box_w = 18, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11802, .adv_w = 227, .box_w = 11, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 11897, .adv_w = 275, .box_w = 18, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12040, .adv_w = 227, .box_w = 11, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 12141, .adv_w = 275, .box_w = 18, .box_h = 27, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 12293, .adv_w = 227, .box_w = 11, .box_h = 23, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 12397, .adv_w = 257, .box_w = 13, .box_h = 22, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 12449, .adv_w = 232, .box_w = 13, .box_h = 18, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 12536, .adv_w = 257, .box_w = 13, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 12596, .adv_w = 232, .box_w = 13, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 12688, .adv_w = 257, .box_w = 13, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 12753, .adv_w = 232, .box_w = 13, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 12849, .adv_w = 257, .box_w = 14, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 12922, .adv_w = 232, .box_w = 14, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 13028, .adv_w = 257, .box_w = 13, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 13099, .adv_w = 232, .box_w = 13, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 13199, .adv_w = 257, .box_w = 13, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 13269, .adv_w = 232, .box_w = 13, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 13368, .adv_w = 257, .box_w = 13, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 13444, .adv_w = 232, .box_w = 13, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 13553, .adv_w = 257, .box_w = 13, .box_h = 26, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 13627, .adv_w = 232, .box_w = 13, .box_h = 23, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 13739, .adv_w = 116, .box_w = 5, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 13761, .adv_w = 103, .box_w = 6, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13783, .adv_w = 116, .box_w = 3, .box_h = 22, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 13795, .adv_w = 103, .box_w = 4, .box_h = 23, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 13818, .adv_w = 322, .box_w = 18, .box_h = 22, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 13953, .adv_w = 241, .box_w = 13, .box_h = 18, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 14039, .adv_w = 322, .box_w = 18, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 14183, .adv_w = 241, .box_w = 13, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 14276, .adv_w = 322, .box_w = 18, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 14430, .adv_w = 241, .box_w = 14, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 14537, .adv_w = 322, .box_w = 18, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 14689, .adv_w = 241, .box_w = 13, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 14790, .adv_w = 322, .box_w = 18, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 14944, .adv_w = 241, .box_w = 13, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 15044, .adv_w = 322, .box_w = 18, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 15201, .adv_w = 241, .box_w = 13, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 15311, .adv_w = 322, .box_w = 18, .box_h = 26, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 15469, .adv_w = 241, .box_w = 13, .box_h = 23, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 15580, .adv_w = 322, .box_w = 18, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 15726, .adv_w = 241, .box_w = 13, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 15821, .adv_w = 322, .box_w = 18, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 15967, .adv_w = 241, .box_w = 13, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 16063, .adv_w = 322, .box_w = 18, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 16215, .adv_w = 241, .box_w = 13, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 16315, .adv_w = 322, .box_w = 18, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 16470, .adv_w = 242, .box_w = 13, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 16570, .adv_w = 322, .box_w = 18, .box_h = 26, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 16722, .adv_w = 241, .box_w = 13, .box_h = 22, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 16822, .adv_w = 304, .box_w = 15, .box_h = 22, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 16891, .adv_w = 258, .box_w = 12, .box_h = 18, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 16948, .adv_w = 304, .box_w = 15, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 17024, .adv_w = 258, .box_w = 12, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 17085, .adv_w = 306, .box_w = 17, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 17178, .adv_w = 260, .box_w = 14, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 17248, .adv_w = 306, .box_w = 17, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 17342, .adv_w = 260, .box_w = 14, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 17411, .adv_w = 306, .box_w = 17, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 17509, .adv_w = 260, .box_w = 14, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 17585, .adv_w = 306, .box_w = 17, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 17685, .adv_w = 260, .box_w = 14, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 17763, .adv_w = 306, .box_w = 17, .box_h = 26, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 17864, .adv_w = 260, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 17942, .adv_w = 244, .box_w = 16, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18038, .adv_w = 208, .box_w = 14, .box_h = 23, .ofs_x = -1, .ofs_y = -5},
+    {.bitmap_index = 18149, .adv_w = 244, .box_w = 16, .box_h = 22, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 18239, .adv_w = 208, .box_w = 14, .box_h = 18, .ofs_x = -1, .ofs_y = -5},
+    {.bitmap_index = 18335, .adv_w = 244, .box_w = 16, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18436, .adv_w = 208, .box_w = 14, .box_h = 24, .ofs_x = -1, .ofs_y = -5},
+    {.bitmap_index = 18552, .adv_w = 244, .box_w = 16, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18655, .adv_w = 208, .box_w = 14, .box_h = 23, .ofs_x = -1, .ofs_y = -5},
+};
+
+static const uint16_t unicode_list_1[] = {
+    0x0, 0x1, 0x2, 0x3, 0x8, 0x9, 0xa, 0xc,
+    0xd, 0x12, 0x13, 0x14, 0x15, 0x19, 0x1a, 0x1d,
+    0x20, 0x21, 0x22, 0x23, 0x28, 0x29, 0x2a, 0x2c,
+    0x2d, 0x32, 0x33, 0x34, 0x35, 0x39, 0x3a, 0x3d,
+    0x42, 0x43, 0x50, 0x51, 0x68, 0x69, 0xa8, 0xa9,
+    0xe0, 0xe1, 0xef, 0xf0,
+};
+
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {
+        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 192, .range_length = 241, .glyph_id_start = 96,
+        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 44, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    },
+    {
+        .range_start = 7840, .range_length = 90, .glyph_id_start = 140,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    }
+};
+
+#if LVGL_VERSION_MAJOR == 8
+static lv_font_fmt_txt_glyph_cache_t cache;
+#endif
+
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = NULL,
+    .kern_scale = 0,
+    .cmap_num = 3,
+    .bpp = 4,
+    .kern_classes = 0,
+    .bitmap_format = 1,
+#if LVGL_VERSION_MAJOR == 8
+    .cache = &cache
+#endif
+};
+
+const lv_font_t montserrat_24 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,
+    .line_height = 29,
+    .base_line = 5,
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -2,
+    .underline_thickness = 1,
+    .dsc = &font_dsc,
+    .fallback = NULL,
+    .user_data = NULL,
+};
+
+lv_font_t* get_montserrat_24()
+{
+    return (lv_font_t*)&montserrat_24;
+}
+
+#endif /*#if MONTSERRAT_24*/
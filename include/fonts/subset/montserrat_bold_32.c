@@ -0,0 +1,2975 @@
+/*******************************************************************************
+ * Sinh bởi tools/font_subset.py từ include/fonts/montserrat_bold_32.c, không sửa tay.
+ * Dùng bởi: _directionLabel, _defaultMessageLabel, _distanceLabel
+ * Glyph: 229, bitmap: nén RLE + prefilter
+ ******************************************************************************/
+
+#include "../local_fonts.h"
+
+#ifndef MONTSERRAT_BOLD_32
+#define MONTSERRAT_BOLD_32 1
+#endif
+
+#if MONTSERRAT_BOLD_32
+
+#if !LV_USE_FONT_COMPRESSED
+#error "montserrat_bold_32.c là font nén: bật LV_USE_FONT_COMPRESSED trong lv_conf.h"
+#endif
+
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+0020 " " */
+
+    /* U+0021 "!" */
+    0x4f, 0xfe, 0x97, 0x0, 0xe1, 0x10, 0x7, 0x79, 0x80, 0x70, 0x88, 0x3, 0x8c, 0x3, 0xcc, 0x2,
+    0x1, 0x84, 0xc, 0x3, 0x18, 0x8, 0x6, 0x10, 0x70, 0xf, 0x8, 0x4, 0x20, 0x3, 0x0, 0x8c,
+    0x0, 0x20, 0x10, 0x80, 0x3c, 0x2, 0x70, 0x0, 0x80, 0x42, 0x0, 0x6e, 0xea, 0x80, 0x21, 0x18,
+    0x2, 0x2b, 0xed, 0x50, 0x1c, 0x41, 0x2a, 0x47, 0x10, 0xd, 0xc0, 0x1f, 0x38, 0x80, 0x6e, 0x1d,
+    0x30, 0x19, 0x40,
+
+    /* U+0022 "\"" */
+    0x6f, 0xfb, 0x0, 0x1b, 0xff, 0x30, 0x7, 0xc2, 0x1, 0x19, 0x80, 0x27, 0x0, 0xff, 0xe1, 0x38,
+    0x4, 0x22, 0x0, 0x84, 0x3, 0xe7, 0x0, 0x8c, 0x0, 0x20, 0x13, 0x80, 0x7c, 0x60, 0x10, 0x88,
+    0x2, 0x10, 0xf, 0xfe, 0x10, 0x80, 0x46, 0x55, 0x58, 0x1, 0x75, 0x50, 0x80,
+
+    /* U+0023 "#" */
+    0x0, 0xf0, 0xff, 0xd0, 0x1, 0xb3, 0xfd, 0x80, 0x1f, 0xe2, 0x0, 0xb8, 0x3, 0x10, 0x1, 0x80,
+    0x3f, 0xcc, 0x1, 0x10, 0x6, 0x10, 0x1, 0x0, 0x7f, 0x88, 0x2, 0x60, 0x8, 0x80, 0x2e, 0x0,
+    0xff, 0x70, 0x4, 0x40, 0x13, 0x0, 0x44, 0x1, 0xc9, 0xff, 0x98, 0x2, 0xff, 0xd6, 0x1, 0x5f,
+    0xfc, 0xc0, 0x1f, 0xfe, 0x36, 0x6c, 0xa0, 0x11, 0xb3, 0x61, 0x0, 0xb, 0x36, 0x50, 0x29, 0x9a,
+    0x0, 0x2a, 0x99, 0xc0, 0x12, 0xcc, 0xe3, 0x0, 0xe6, 0x0, 0x88, 0x3, 0x8, 0x0, 0x80, 0x3f,
+    0xc4, 0x1, 0x30, 0x4, 0x40, 0x17, 0x0, 0x7f, 0xb8, 0x2, 0x20, 0x9, 0x80, 0x22, 0x0, 0xff,
+    0x10, 0x0, 0x40, 0x30, 0x80, 0x4c, 0x1, 0xcb, 0xff, 0x94, 0x0, 0x3f, 0xfa, 0x80, 0x2c, 0xff,
+    0x94, 0x3, 0xff, 0xc6, 0xcd, 0x94, 0x2, 0x36, 0x6c, 0x1, 0xb, 0x37, 0x1, 0xcc, 0xdc, 0x1,
+    0x4c, 0xf0, 0x4, 0x93, 0x38, 0xc0, 0x38, 0x80, 0x26, 0x0, 0x84, 0x2, 0x20, 0xf, 0xf7, 0x0,
+    0x44, 0x1, 0x10, 0x5, 0xc0, 0x1f, 0xe2, 0x0, 0x84, 0x2, 0x60, 0x8, 0x80, 0x3f, 0xcc, 0x0,
+    0x20, 0xc, 0x40, 0x13, 0x0, 0x78,
+
+    /* U+0024 "$" */
+    0x0, 0xfc, 0x31, 0x10, 0x7, 0xff, 0x10, 0x9d, 0xe0, 0xf, 0xff, 0xe8, 0xb5, 0xe8, 0x5, 0xd9,
+    0x2a, 0x1, 0xfa, 0x3a, 0x50, 0x40, 0x21, 0x36, 0xaf, 0x81, 0x0, 0xd8, 0xe0, 0x1f, 0xf9, 0xdc,
+    0x1, 0x51, 0x80, 0x7f, 0xf0, 0x45, 0x80, 0x6, 0xa0, 0x1c, 0x80, 0x14, 0x28, 0x80, 0x1c, 0x2,
+    0xb0, 0xc, 0x3d, 0x0, 0x13, 0xd7, 0x59, 0xd8, 0x4, 0x40, 0x19, 0x84, 0x3, 0xe4, 0xc2, 0x0,
+    0x8c, 0x3, 0x10, 0x7, 0xff, 0xb, 0x80, 0x32, 0xd3, 0x0, 0x7f, 0xe6, 0x0, 0xe5, 0xa0, 0x8,
+    0x80, 0x3f, 0xc, 0x80, 0x7f, 0x6e, 0xa4, 0xc0, 0x3c, 0xd6, 0x40, 0x1f, 0x89, 0xb3, 0x4, 0x1,
+    0xc9, 0xb4, 0x80, 0x1f, 0xc7, 0xa6, 0x1, 0xe5, 0xbf, 0x90, 0xf, 0xee, 0x0, 0xfe, 0x50, 0xa,
+    0x88, 0x3, 0x12, 0x0, 0x7f, 0xe5, 0xd2, 0x0, 0xc6, 0x0, 0x31, 0x0, 0xff, 0x38, 0x7, 0xdd,
+    0xc8, 0x20, 0xf, 0x89, 0x0, 0x31, 0x2, 0x10, 0x3e, 0xe4, 0x58, 0x5, 0x3a, 0x20, 0x19, 0x3,
+    0xc0, 0x31, 0xbb, 0x80, 0x26, 0x0, 0xe7, 0x10, 0xf, 0xfe, 0x2a, 0xc0, 0x2, 0xe8, 0xc0, 0x3f,
+    0xe1, 0x9a, 0x0, 0xcb, 0x9b, 0x2a, 0x40, 0x18, 0x96, 0xb9, 0x80, 0x3e, 0x26, 0xad, 0xc0, 0xb,
+    0x69, 0x40, 0x3f, 0xfd, 0x24, 0xef, 0x0, 0x7e,
+
+    /* U+0025 "%" */
+    0x0, 0x8e, 0xbb, 0xfa, 0x88, 0x3, 0xfa, 0x3f, 0xe4, 0x0, 0xf3, 0x62, 0x88, 0xa, 0xea, 0x0,
+    0x7c, 0x6e, 0x0, 0x64, 0x0, 0xe3, 0x90, 0x0, 0xa0, 0x5, 0x62, 0x1, 0xee, 0x0, 0x14, 0x80,
+    0x7a, 0x0, 0x7, 0xd7, 0xc4, 0x0, 0x90, 0xe, 0x82, 0x0, 0x48, 0x7, 0xc8, 0x0, 0x80, 0x0,
+    0xd8, 0x1, 0x40, 0x31, 0xb8, 0x1, 0x90, 0x3, 0xc2, 0x1, 0x28, 0x4, 0x40, 0x2, 0x0, 0xdc,
+    0x0, 0x19, 0x0, 0xff, 0xe5, 0x41, 0x0, 0x28, 0x3, 0xf0, 0x80, 0x4a, 0x1, 0x10, 0x0, 0x80,
+    0x6, 0xe0, 0x6, 0x40, 0xf, 0xe4, 0x0, 0x40, 0x0, 0x6c, 0x0, 0xa0, 0xe, 0x0, 0xc, 0x80,
+    0x7f, 0xa0, 0x0, 0x7d, 0x7e, 0x40, 0x9, 0x8, 0x20, 0x5, 0x0, 0x7f, 0xc7, 0x20, 0x1, 0x41,
+    0x0, 0x58, 0x9b, 0x80, 0x19, 0x1, 0x26, 0xe9, 0x80, 0x3c, 0xd8, 0x82, 0x2, 0xba, 0x81, 0xc0,
+    0x1, 0x90, 0xbb, 0x32, 0x2c, 0xe9, 0x80, 0x71, 0xdf, 0x7f, 0x51, 0x4, 0x10, 0x2, 0x82, 0xd0,
+    0x3, 0x8b, 0x44, 0x3, 0xfe, 0x37, 0x0, 0x32, 0x24, 0x0, 0x9f, 0xc1, 0x1, 0x80, 0xf, 0xfb,
+    0x80, 0x3, 0x21, 0xc0, 0x5, 0x60, 0x38, 0x0, 0x38, 0x7, 0xfa, 0x8, 0x1, 0x40, 0x7, 0x0,
+    0x60, 0x4, 0xe0, 0x1, 0x10, 0x7, 0xe3, 0x70, 0x3, 0x20, 0x0, 0xc0, 0x6, 0x1, 0x8, 0x4,
+    0x40, 0x1f, 0xb8, 0x0, 0x32, 0x1, 0x18, 0x7, 0x84, 0x2, 0x10, 0xf, 0xa0, 0x80, 0x14, 0x1,
+    0x98, 0x1, 0xa0, 0x12, 0x80, 0x44, 0x1, 0xe3, 0x70, 0x3, 0x20, 0x6, 0xd0, 0x3, 0x90, 0x2,
+    0x0, 0x8, 0x1, 0xf7, 0x0, 0x6, 0x40, 0x39, 0x84, 0x1, 0xb7, 0xc6, 0x0, 0x80, 0xf, 0x41,
+    0x0, 0x28, 0x3, 0xed, 0x10, 0x2, 0x8, 0x2, 0xc, 0x3, 0x8d, 0xc0, 0xc, 0x80, 0x1f, 0x1f,
+    0xb0, 0x80, 0xa6, 0x38, 0x0,
+
+    /* U+0026 "&" */
+    0x0, 0xe1, 0x7c, 0xef, 0xf6, 0xc9, 0x80, 0x7f, 0xe5, 0xe8, 0x31, 0x0, 0x13, 0x64, 0x0, 0x7f,
+    0x92, 0x80, 0x3f, 0x9d, 0x80, 0x3f, 0xa4, 0x3, 0x23, 0xb0, 0x6, 0x80, 0xf, 0xc4, 0x40, 0x9,
+    0x6e, 0x26, 0xc0, 0x21, 0x20, 0xf, 0x84, 0x3, 0x78, 0x4, 0xa0, 0x1f, 0xf8, 0x80, 0x36, 0x0,
+    0x4c, 0x1, 0x88, 0x3, 0xe1, 0x30, 0x9, 0x90, 0x22, 0x0, 0x13, 0x80, 0x7f, 0x40, 0x6, 0xbe,
+    0x70, 0x8, 0xe0, 0x3, 0xf9, 0x1c, 0x3, 0x8, 0x4, 0xb8, 0x1, 0xff, 0x68, 0x7, 0xd5, 0x40,
+    0xf, 0xf0, 0xdd, 0x0, 0x7d, 0xa0, 0x10, 0xe3, 0x90, 0x4, 0x38, 0x80, 0x10, 0x80, 0x67, 0xa0,
+    0x2, 0x1c, 0x6e, 0x0, 0x34, 0x80, 0x27, 0xea, 0x0, 0xcb, 0x61, 0xe0, 0x13, 0x82, 0x98, 0x4,
+    0xd0, 0xb, 0x60, 0x19, 0x31, 0x40, 0x2d, 0xe, 0x0, 0xd6, 0x1, 0x25, 0x80, 0x63, 0x0, 0xce,
+    0xc, 0x1, 0x8c, 0x3, 0x26, 0x8, 0x7, 0x9c, 0x40, 0x40, 0x33, 0x0, 0x71, 0xe0, 0x7, 0xb0,
+    0x0, 0xa0, 0x1a, 0x24, 0xc0, 0x4, 0xde, 0x1, 0xeb, 0x40, 0xb0, 0xe, 0x6c, 0xff, 0x6c, 0x90,
+    0x7, 0xd6, 0x85, 0x40, 0x1f, 0xfc, 0x11, 0x30, 0x8, 0x54, 0x17, 0x8, 0x3, 0xfc, 0xdf, 0x88,
+    0x0, 0xc1, 0x0, 0x1e, 0xdb, 0x10, 0x4, 0x29, 0x1d, 0x22, 0x16, 0xb6, 0x40,
+
+    /* U+0027 "'" */
+    0x6f, 0xfb, 0x0, 0x38, 0xc0, 0x27, 0x0, 0xe1, 0x0, 0x85, 0xc0, 0x23, 0x0, 0xe1, 0x0, 0x84,
+    0x3, 0x8a, 0xab,
+
+    /* U+0028 "(" */
+    0x0, 0xd9, 0xbb, 0x60, 0x6, 0x73, 0x22, 0xa8, 0x3, 0x48, 0x4, 0x2c, 0x1, 0x30, 0x80, 0x4c,
+    0x1, 0xac, 0x3, 0x50, 0x4, 0x44, 0x0, 0x8c, 0x80, 0x25, 0x0, 0xd6, 0x1, 0xb0, 0x3, 0x20,
+    0x6, 0x40, 0xc, 0x60, 0x11, 0x0, 0x63, 0x0, 0xcc, 0x1, 0x94, 0x3, 0x10, 0x6, 0xe0, 0xd,
+    0xc0, 0x18, 0x40, 0x30, 0x80, 0x62, 0x0, 0xc6, 0x1, 0xff, 0xc2, 0x70, 0xf, 0xe7, 0x0, 0xc6,
+    0x1, 0xfc, 0x20, 0x18, 0x40, 0x37, 0x80, 0x62, 0x0, 0xc4, 0x1, 0xb8, 0x3, 0x38, 0x6, 0x20,
+    0xc, 0x40, 0x19, 0x0, 0x38, 0xc0, 0x31, 0x0, 0x6b, 0x0, 0xc8, 0x1, 0x94, 0x3, 0x68, 0x6,
+    0x22, 0x0, 0x48, 0x20, 0x1a, 0x80, 0x33, 0x0, 0x66, 0x0, 0xd4, 0x1, 0x85, 0xc0, 0x22, 0x50,
+    0xd, 0x2, 0x1, 0x40, 0x0,
+
+    /* U+0029 ")" */
+    0x6d, 0xdc, 0xa0, 0x19, 0x8c, 0x8a, 0xb0, 0xe, 0x90, 0x8, 0x5c, 0x3, 0x30, 0x6, 0x90, 0xc,
+    0x2a, 0x1, 0xa, 0x0, 0x6e, 0x0, 0xdc, 0x1, 0x90, 0x3, 0x20, 0x7, 0x20, 0x4, 0x26, 0x1,
+    0x8c, 0x3, 0x28, 0x6, 0xc0, 0xd, 0xe0, 0x19, 0x80, 0x32, 0x80, 0x62, 0x0, 0xc4, 0x1, 0xc2,
+    0x1, 0x8, 0x7, 0x18, 0x6, 0x10, 0xf, 0xfe, 0x10, 0x80, 0x63, 0x0, 0xfe, 0x30, 0xc, 0x20,
+    0x1f, 0xc6, 0x1, 0x84, 0x3, 0x8, 0x4, 0x20, 0x18, 0x80, 0x31, 0x0, 0x66, 0x0, 0xcc, 0x1,
+    0x8c, 0x3, 0x68, 0x6, 0xc0, 0xc, 0x80, 0x19, 0x40, 0x31, 0x80, 0x48, 0x20, 0x12, 0x80, 0x6d,
+    0x0, 0xde, 0x1, 0x98, 0x2, 0x15, 0x0, 0x98, 0x3, 0x48, 0x6, 0xb0, 0x8, 0x5c, 0x2, 0x62,
+    0x0, 0xa0, 0x3,
+
+    /* U+002A "*" */
+    0x0, 0xff, 0xe3, 0xcf, 0xf9, 0xc0, 0x3f, 0xc2, 0x0, 0x10, 0xf, 0x36, 0x98, 0x7, 0x97, 0x90,
+    0x6, 0xb, 0x24, 0x40, 0x1d, 0x54, 0x19, 0x4, 0x10, 0x3, 0x30, 0x0, 0xea, 0x0, 0x23, 0x5d,
+    0x40, 0xf, 0xcb, 0xc6, 0x5, 0x6e, 0x1, 0xe9, 0xa1, 0x0, 0x15, 0xb8, 0x7, 0xa6, 0x84, 0x17,
+    0x50, 0x3, 0xf2, 0xf1, 0xa0, 0x80, 0x19, 0x80, 0x7, 0x50, 0x1, 0x18, 0xc1, 0xe4, 0x88, 0x3,
+    0xaa, 0xca, 0x40, 0xd, 0x86, 0x1, 0xe4, 0xd4, 0x0, 0xf0, 0x80, 0x4, 0x3, 0x80,
+
+    /* U+002B "+" */
+    0x0, 0xf1, 0xc4, 0x4a, 0x1, 0xff, 0x91, 0xde, 0xf0, 0xf, 0xff, 0xff, 0xff, 0x40, 0x4, 0xbf,
+    0xfc, 0x60, 0x1f, 0xfe, 0x8f, 0xfe, 0x80, 0x9, 0x7f, 0xf8, 0xc0, 0x3f, 0xff, 0xc8, 0xef, 0x78,
+    0x7, 0x80,
+
+    /* U+002C "," */
+    0x0, 0x11, 0x80, 0x43, 0x9b, 0x9e, 0x81, 0x6, 0x1, 0x58, 0x20, 0x7, 0x20, 0x7, 0xd4, 0x1,
+    0xca, 0xec, 0x1, 0x20, 0x86, 0x0, 0x5c, 0x0, 0xf0, 0x0, 0xa8, 0x1, 0x0, 0xe, 0x0, 0x21,
+    0x0, 0x50, 0x1, 0x0, 0x6, 0x60, 0x0,
+
+    /* U+002D "-" */
+    0x2, 0x2f, 0xc2, 0xbb, 0xbf, 0xa8, 0x3, 0xff, 0xa4,
+
+    /* U+002E "." */
+    0x0, 0x2b, 0x10, 0x0, 0x76, 0xa7, 0x58, 0x2c, 0x80, 0x29, 0x14, 0x0, 0xe5, 0x30, 0xe, 0x7b,
+    0x0, 0xc4, 0x6d, 0x2, 0x9, 0x80,
+
+    /* U+002F "/" */
+    0x0, 0xff, 0xab, 0xfe, 0xc0, 0xf, 0xf9, 0x40, 0x2b, 0x0, 0xff, 0x28, 0x6, 0x60, 0xf, 0xf7,
+    0x0, 0x46, 0x20, 0x1f, 0xe4, 0x0, 0xa8, 0x3, 0xfc, 0xc0, 0x19, 0xc0, 0x3f, 0xda, 0x1, 0x20,
+    0x80, 0x7f, 0xa, 0x0, 0x5a, 0x1, 0xfe, 0x70, 0xc, 0xe0, 0x1f, 0xed, 0x0, 0x90, 0x40, 0x3f,
+    0x85, 0x0, 0x2d, 0x0, 0xff, 0x38, 0x6, 0x60, 0xf, 0xf5, 0x0, 0x48, 0x1, 0xfe, 0x13, 0x0,
+    0xb8, 0x3, 0xfc, 0xc0, 0x19, 0x40, 0x3f, 0xd6, 0x1, 0x28, 0x7, 0xf8, 0x8c, 0x2, 0xf0, 0xf,
+    0xf2, 0x80, 0x65, 0x0, 0xff, 0x58, 0x4, 0xa0, 0x1f, 0xe2, 0x30, 0xb, 0x80, 0x3f, 0xca, 0x1,
+    0x90, 0x3, 0xfd, 0x40, 0x12, 0x80, 0x7f, 0x88, 0x80, 0x17, 0x0, 0x7f, 0xa8, 0x2, 0x14, 0x0,
+    0xff, 0x28, 0x4, 0xe0, 0x1f, 0xe3, 0x20, 0xb, 0x40, 0x3f, 0xd6, 0x1, 0xa, 0x0, 0x7f, 0x94,
+    0x2, 0x70, 0xf, 0xf1, 0x90, 0x5, 0x40, 0x1f, 0xeb, 0x0, 0x84, 0xc0, 0x3f, 0xcc, 0x1, 0x38,
+    0x7, 0xf8,
+
+    /* U+0030 "0" */
+    0x0, 0xf3, 0x5f, 0x7f, 0xb6, 0x90, 0x3, 0xfc, 0xbd, 0x28, 0x20, 0x2, 0x5b, 0xc2, 0x0, 0xfa,
+    0x28, 0x40, 0x3f, 0x1e, 0xa0, 0x7, 0x33, 0x80, 0x7f, 0xeb, 0x20, 0x8, 0x64, 0x3, 0x8d, 0xd8,
+    0x40, 0x3b, 0x80, 0x28, 0x0, 0xea, 0xc8, 0x9e, 0x60, 0xc, 0x68, 0x0, 0x60, 0xc, 0xea, 0x1,
+    0xa4, 0xc0, 0x37, 0x82, 0x0, 0x74, 0x80, 0x7a, 0x40, 0x32, 0x6, 0x0, 0x63, 0x10, 0xf, 0x20,
+    0x7, 0x19, 0x0, 0x65, 0x0, 0xf8, 0x44, 0x1, 0x98, 0x40, 0x30, 0x80, 0x7e, 0x20, 0xc, 0x6e,
+    0x1, 0xff, 0xc6, 0x17, 0x0, 0xff, 0xe3, 0x8, 0x80, 0x30, 0x80, 0x7e, 0x20, 0xc, 0x64, 0x1,
+    0x94, 0x3, 0xe1, 0x10, 0x6, 0x6c, 0x0, 0xc6, 0x20, 0x1e, 0x40, 0xe, 0x34, 0x0, 0xe9, 0x0,
+    0xf4, 0x80, 0x64, 0x0, 0x30, 0x6, 0x75, 0x0, 0xd2, 0x60, 0x1b, 0xc0, 0x10, 0x1, 0xd5, 0x91,
+    0x3a, 0xc0, 0x18, 0xd0, 0x0, 0x32, 0x1, 0xc6, 0xec, 0x40, 0x1d, 0xc0, 0x19, 0x9c, 0x3, 0xff,
+    0x59, 0x0, 0x74, 0x50, 0x80, 0x7e, 0x3c, 0x40, 0xf, 0x97, 0xa5, 0x4, 0x0, 0x4b, 0x78, 0x60,
+    0x18,
+
+    /* U+0031 "1" */
+    0xcf, 0xff, 0xdc, 0x1, 0xff, 0xd2, 0xfb, 0xba, 0x0, 0x38, 0xd1, 0x23, 0x0, 0xff, 0xff, 0x80,
+    0x7f, 0xff, 0xc0, 0x3f, 0xf9, 0xa0,
+
+    /* U+0032 "2" */
+    0x0, 0xc7, 0x19, 0xdf, 0xee, 0xb7, 0x10, 0xf, 0x1e, 0x61, 0xcc, 0x40, 0x2, 0x91, 0xce, 0x1,
+    0x9b, 0xc, 0x3, 0xfd, 0x14, 0x0, 0x69, 0x0, 0xff, 0xe0, 0xab, 0x7, 0x0, 0x71, 0xb3, 0xb1,
+    0x0, 0x74, 0x4, 0x61, 0x1, 0x66, 0x26, 0x27, 0x58, 0x3, 0x9, 0x1, 0xec, 0x61, 0x80, 0x74,
+    0x0, 0x70, 0x80, 0x4e, 0x20, 0x1e, 0x10, 0xf, 0xfe, 0x29, 0x80, 0x71, 0x80, 0x7f, 0xd2, 0x1,
+    0x8c, 0x3, 0xfe, 0x65, 0x0, 0xd0, 0x1, 0xfe, 0x69, 0x0, 0xcc, 0x80, 0x1f, 0xcf, 0x20, 0x19,
+    0x24, 0x3, 0xfa, 0x20, 0x1, 0x8e, 0xc0, 0x3f, 0xa5, 0xc0, 0x32, 0x60, 0x7, 0xf5, 0x30, 0x6,
+    0x5b, 0x0, 0xfe, 0xb5, 0x0, 0xcb, 0x40, 0x1f, 0xd6, 0x80, 0x19, 0xa8, 0x3, 0xf0, 0xe2, 0x0,
+    0x62, 0xc5, 0x5f, 0xc1, 0xa6, 0x1, 0xc5, 0x55, 0xfc, 0x6, 0x1, 0xff, 0xe8,
+
+    /* U+0033 "3" */
+    0x0, 0x77, 0xff, 0xff, 0xb, 0x0, 0x3f, 0xfd, 0x8c, 0x1, 0x55, 0xdf, 0xe2, 0x0, 0xc7, 0x40,
+    0x12, 0x27, 0xec, 0x20, 0x8, 0x74, 0x3, 0xfe, 0x67, 0x0, 0xd8, 0x20, 0x1f, 0xe4, 0x90, 0xd,
+    0x64, 0x1, 0xfe, 0x3b, 0x0, 0xd4, 0x80, 0x1f, 0xf6, 0x80, 0x77, 0xb0, 0x7, 0xfc, 0x20, 0x1c,
+    0xb3, 0xc8, 0x1, 0xff, 0xc5, 0x1b, 0x40, 0xf, 0xfe, 0x35, 0x8, 0x7, 0xdf, 0xfb, 0x14, 0x3,
+    0xb, 0x0, 0x7f, 0xc7, 0x48, 0x1, 0xb0, 0x3, 0xff, 0x83, 0x80, 0x19, 0xc0, 0x2, 0x40, 0x1f,
+    0xdc, 0x1, 0x9c, 0x1, 0x3b, 0x24, 0x1, 0xe4, 0x60, 0xc, 0x60, 0x2e, 0xd, 0xba, 0xa8, 0x84,
+    0xe5, 0x80, 0x75, 0x84, 0x80, 0x62, 0x57, 0x73, 0x18, 0x7, 0x29, 0x82, 0x0, 0x7f, 0xf0, 0x8e,
+    0x80, 0x19, 0x2, 0x1, 0xff, 0x3e, 0x0, 0x67, 0xec, 0x74, 0x20, 0x8, 0x52, 0x3a, 0x0, 0x20,
+
+    /* U+0034 "4" */
+    0x0, 0xff, 0xb3, 0xff, 0x50, 0x7, 0xff, 0xe, 0xc, 0x2, 0x2a, 0x0, 0xff, 0xe1, 0x23, 0x80,
+    0x6e, 0x0, 0xff, 0xe1, 0xd, 0x0, 0x68, 0x30, 0xf, 0xfe, 0x15, 0x8, 0x4, 0x8e, 0x1, 0xff,
+    0xc2, 0x74, 0x0, 0x86, 0x80, 0x3f, 0xf8, 0x47, 0x0, 0x1a, 0xc4, 0x3, 0xff, 0x82, 0x3a, 0x1,
+    0x99, 0x40, 0x3f, 0xf8, 0x56, 0x20, 0x11, 0x48, 0x7, 0xff, 0x9, 0x94, 0x3, 0x70, 0x1, 0xe6,
+    0x70, 0x80, 0x78, 0xa4, 0x3, 0x41, 0x80, 0x2d, 0x9b, 0x0, 0x7d, 0xe0, 0x19, 0x1c, 0x3, 0xff,
+    0x85, 0x24, 0x1, 0xd, 0x0, 0x7f, 0xf0, 0x95, 0x80, 0x32, 0x21, 0x57, 0x8, 0x6, 0x65, 0x52,
+    0x5, 0x0, 0x72, 0xd5, 0x71, 0x0, 0x68, 0xaa, 0x40, 0x7, 0xff, 0xdf, 0xff, 0xff, 0x0, 0x77,
+    0x7f, 0xb0, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xc1,
+
+    /* U+0035 "5" */
+    0x0, 0xbb, 0xff, 0xff, 0x60, 0x7, 0x8, 0x7, 0xff, 0x14, 0x40, 0x3f, 0xf8, 0xc4, 0x1, 0xff,
+    0xc6, 0x70, 0xc, 0xd7, 0x7f, 0xbc, 0x3, 0x10, 0x6, 0xc4, 0x4f, 0xc6, 0x1, 0x84, 0x3, 0x8,
+    0x7, 0xff, 0x7, 0x80, 0x33, 0x0, 0x7f, 0xf0, 0x4c, 0x3, 0x6f, 0xfd, 0xb4, 0xa0, 0x1f, 0x30,
+    0x7, 0xe2, 0x5a, 0xe5, 0x0, 0xe1, 0x0, 0xff, 0x86, 0x9c, 0x3, 0x10, 0x7, 0xff, 0x6, 0xc,
+    0x2, 0xaa, 0xfa, 0x58, 0x40, 0x3a, 0x40, 0x25, 0x5f, 0x9a, 0x78, 0xc0, 0x32, 0x80, 0x7f, 0xf0,
+    0x7c, 0x3, 0x88, 0x3, 0xff, 0x10, 0x7, 0xe5, 0x0, 0xfe, 0x50, 0xe, 0x30, 0x3a, 0xd6, 0x0,
+    0xf1, 0x48, 0x6, 0x21, 0x9, 0x2, 0x9f, 0xb9, 0x78, 0xbd, 0x20, 0xd, 0x40, 0x4a, 0x1, 0x91,
+    0xa1, 0xd0, 0x3, 0x89, 0xc1, 0x40, 0x3f, 0xf8, 0x43, 0xe0, 0x7, 0xb4, 0x0, 0xff, 0x93, 0xc8,
+    0x2, 0x4b, 0xe9, 0x52, 0x0, 0x84, 0xdf, 0x2c, 0x40, 0x20,
+
+    /* U+0036 "6" */
+    0x0, 0xf9, 0x6b, 0x7f, 0xee, 0xb7, 0x20, 0xf, 0x9f, 0xa9, 0x48, 0x2, 0x14, 0x8d, 0x90, 0xc,
+    0x39, 0x2, 0x1, 0xfe, 0xf0, 0x8, 0x70, 0xc0, 0x3f, 0xe1, 0x60, 0xa, 0x88, 0x3, 0x96, 0x2a,
+    0x61, 0x42, 0x0, 0x24, 0x40, 0x6, 0x4e, 0xa7, 0x56, 0x7a, 0xe6, 0x0, 0xa0, 0x3, 0x25, 0x88,
+    0x7, 0x84, 0x2, 0x23, 0x0, 0xd2, 0x1, 0xff, 0x90, 0x3, 0x19, 0x25, 0x6f, 0xfb, 0x69, 0x0,
+    0x37, 0x80, 0x66, 0xbb, 0x29, 0x0, 0x9, 0x6e, 0xc2, 0x0, 0x20, 0xc, 0xa8, 0x1, 0xf9, 0x30,
+    0x40, 0x3f, 0xf8, 0xa5, 0x40, 0x1f, 0x93, 0x3f, 0xd6, 0x60, 0x19, 0xc, 0x3, 0xc9, 0x66, 0x0,
+    0x4c, 0x20, 0xd, 0x64, 0x1, 0xd0, 0x1, 0xeb, 0x0, 0xc7, 0xe0, 0x1c, 0x40, 0x1e, 0x20, 0xe,
+    0x40, 0xe, 0x20, 0xf, 0x10, 0x6, 0x12, 0x30, 0xd, 0x20, 0x1e, 0xb0, 0xd, 0xa1, 0x0, 0x19,
+    0x68, 0xc0, 0x7, 0x84, 0x1, 0x98, 0x11, 0x80, 0x32, 0xe7, 0xfb, 0xc, 0x3, 0x40, 0x80, 0x25,
+    0x0, 0x3f, 0xf2, 0xb8, 0x6, 0xb8, 0x0, 0xff, 0x45, 0x0, 0x79, 0xfa, 0x50, 0x40, 0x2, 0x71,
+    0xce, 0x1,
+
+    /* U+0037 "7" */
+    0x2f, 0xff, 0xfe, 0x2e, 0x0, 0x7f, 0xfb, 0x1c, 0x3, 0x96, 0xab, 0xce, 0x1, 0xdc, 0x1, 0xda,
+    0xab, 0xe2, 0x0, 0xc2, 0xa0, 0x1f, 0xf0, 0xa8, 0x6, 0x90, 0xf, 0xfc, 0xc0, 0x1c, 0xc0, 0x5d,
+    0xd9, 0xc0, 0x3a, 0x40, 0x32, 0x88, 0x0, 0x47, 0x0, 0x72, 0x88, 0x6, 0x90, 0xf, 0xfd, 0x20,
+    0x18, 0xcc, 0x1, 0xff, 0x19, 0x80, 0x34, 0x80, 0x7f, 0xe9, 0x0, 0xc2, 0xa0, 0x1f, 0xf0, 0xa8,
+    0x6, 0x60, 0xf, 0xfd, 0x20, 0x1d, 0x20, 0x1f, 0xf9, 0x80, 0x32, 0x88, 0x7, 0xfc, 0xa2, 0x1,
+    0xa4, 0x3, 0xff, 0x48, 0x6, 0x33, 0x0, 0x7f, 0xc6, 0x60, 0xd, 0x40, 0x1f, 0xfa, 0x40, 0x30,
+    0xb0, 0x7, 0xfc, 0x2a, 0x1, 0x98, 0x3, 0xff, 0x48, 0x7, 0x48, 0x7, 0xfe, 0x60, 0xc, 0xa2,
+    0x1, 0xf0,
+
+    /* U+0038 "8" */
+    0x0, 0xe6, 0xad, 0xff, 0xb6, 0xd8, 0x40, 0x3e, 0x6e, 0x95, 0x20, 0x8, 0x92, 0x79, 0xc0, 0x3a,
+    0x64, 0x20, 0x1f, 0xe8, 0xa0, 0x9, 0x98, 0x1, 0xff, 0xc1, 0x57, 0x0, 0x58, 0x6, 0x1a, 0xff,
+    0xac, 0x40, 0x34, 0x80, 0x8, 0x3, 0x52, 0x80, 0x49, 0x80, 0x18, 0x48, 0x40, 0x39, 0x40, 0x38,
+    0x80, 0x38, 0x46, 0x0, 0xc8, 0x1, 0xc6, 0x1, 0xc6, 0xc, 0x1, 0xa9, 0xc8, 0x49, 0xf4, 0x3,
+    0x28, 0x2, 0xc, 0x3, 0x46, 0xf6, 0xc0, 0x80, 0x45, 0x60, 0x16, 0x88, 0x7, 0xfe, 0xf1, 0x0,
+    0xe, 0x88, 0x7, 0xfe, 0xf2, 0x0, 0x69, 0x80, 0x62, 0x57, 0x62, 0x0, 0xc5, 0x82, 0xc6, 0x1,
+    0xa7, 0x6a, 0x27, 0x68, 0x3, 0xc, 0xe8, 0x6, 0x56, 0x0, 0xe5, 0x70, 0xc, 0xac, 0x1, 0xb0,
+    0x3, 0xec, 0x0, 0xc4, 0x1, 0xc2, 0x1, 0xf0, 0x80, 0x73, 0x0, 0x6a, 0x0, 0xfa, 0x40, 0x31,
+    0x70, 0x6, 0x2c, 0x40, 0x8, 0xec, 0xc0, 0x35, 0x29, 0x80, 0x63, 0xbf, 0xfb, 0x10, 0x3, 0x13,
+    0x86, 0x90, 0x7, 0xff, 0x4, 0x7c, 0x0, 0x3a, 0xc0, 0x1f, 0xf2, 0xf9, 0x0, 0x69, 0xe8, 0x42,
+    0x0, 0x85, 0x23, 0x68, 0x40, 0x0,
+
+    /* U+0039 "9" */
+    0x0, 0xe5, 0xad, 0xff, 0x76, 0x41, 0x80, 0x7f, 0x2f, 0x52, 0x90, 0x0, 0x4d, 0xf2, 0xc4, 0x3,
+    0xcf, 0x42, 0x1, 0xfc, 0x9e, 0x40, 0x19, 0x20, 0x3, 0xff, 0xe, 0x8, 0x5, 0x20, 0x18, 0x67,
+    0xbf, 0xa4, 0x40, 0x21, 0xb0, 0x1, 0x10, 0x3, 0x63, 0x8, 0xb, 0x60, 0x6, 0x52, 0x7, 0x0,
+    0xc6, 0x40, 0x1c, 0x48, 0x1, 0xa8, 0x3, 0xff, 0x8e, 0x80, 0xc0, 0x18, 0xc8, 0x3, 0x89, 0x0,
+    0x31, 0x81, 0x80, 0x76, 0x30, 0x80, 0xb6, 0x0, 0x78, 0x41, 0xc0, 0x30, 0xcf, 0x7f, 0x48, 0x80,
+    0x78, 0xc2, 0x10, 0x3, 0xff, 0x8f, 0x6c, 0x1, 0xf8, 0x60, 0x3, 0x8c, 0x2, 0x9d, 0x62, 0x0,
+    0x9, 0xc7, 0xa0, 0x7, 0x8, 0x6, 0x29, 0xdf, 0xf7, 0x63, 0x8a, 0x0, 0x63, 0x0, 0xff, 0xe1,
+    0x50, 0x6, 0x40, 0xf, 0xfe, 0xb, 0x90, 0x6, 0xa0, 0xc, 0x60, 0x1f, 0x44, 0x0, 0x32, 0x10,
+    0x4, 0x39, 0xd2, 0xca, 0xd3, 0xce, 0x1, 0xd2, 0x1, 0xa0, 0x5, 0xa6, 0xa5, 0x84, 0x3, 0xa8,
+    0x80, 0x21, 0x60, 0xf, 0xfd, 0x4a, 0x1, 0x88, 0x40, 0x3f, 0xcb, 0xaa, 0x1, 0xc7, 0xd4, 0xa4,
+    0x1, 0xa, 0x46, 0xd1, 0x0, 0x70,
+
+    /* U+003A ":" */
+    0x7, 0xef, 0xb1, 0x7, 0x81, 0x4, 0xc0, 0xa0, 0xc, 0x46, 0x60, 0xe, 0x74, 0x0, 0xe5, 0xb2,
+    0x0, 0xa8, 0x45, 0xb7, 0x5c, 0xa0, 0x12, 0x28, 0x80, 0x7f, 0xf3, 0x55, 0x88, 0x0, 0x3b, 0x53,
+    0xac, 0x16, 0x40, 0x14, 0x8a, 0x0, 0x72, 0x98, 0x7, 0x3d, 0x80, 0x62, 0x36, 0x81, 0x4, 0xc0,
+
+    /* U+003B ";" */
+    0x7, 0xef, 0xb1, 0x7, 0x81, 0x4, 0xc0, 0xa0, 0xc, 0x46, 0x60, 0xe, 0x74, 0x0, 0xe5, 0xb2,
+    0x0, 0xa8, 0x45, 0xb7, 0x5c, 0xa0, 0x12, 0x28, 0x80, 0x7f, 0xf3, 0x48, 0xc0, 0x21, 0xcd, 0xcf,
+    0x40, 0x83, 0x0, 0xac, 0x10, 0x3, 0x90, 0x3, 0xea, 0x0, 0xe5, 0x76, 0x0, 0x90, 0x43, 0x0,
+    0x2e, 0x0, 0x78, 0x0, 0x54, 0x0, 0x80, 0x7, 0x0, 0x10, 0x80, 0x28, 0x0, 0x80, 0x3, 0x30,
+    0x0,
+
+    /* U+003C "<" */
+    0x0, 0xff, 0xe1, 0xb1, 0x0, 0x7f, 0xe3, 0x9f, 0x91, 0x0, 0xfe, 0x16, 0xcc, 0x30, 0x7, 0xf8,
+    0xeb, 0xa4, 0xc0, 0x3f, 0x85, 0xf7, 0x14, 0x3, 0xc8, 0x40, 0x4, 0xae, 0x82, 0x0, 0xe2, 0x8e,
+    0xb1, 0xe, 0xb5, 0x0, 0xf3, 0x66, 0xb8, 0x80, 0x42, 0x1, 0xc9, 0x5f, 0x26, 0x1, 0xfe, 0x1b,
+    0xb2, 0x80, 0x7f, 0xf0, 0x46, 0xf5, 0xc4, 0x3, 0xf1, 0x0, 0x71, 0x47, 0x5a, 0x80, 0x7b, 0x71,
+    0x80, 0x3c, 0x95, 0xd2, 0x60, 0x18, 0xe7, 0xe4, 0xc0, 0x38, 0x5b, 0x34, 0x80, 0x39, 0xb3, 0x5c,
+    0x40, 0x38, 0x84, 0x3, 0xe2, 0x8e, 0xa4, 0x0, 0xff, 0xe1, 0xad, 0xeb, 0x88, 0x7, 0xff, 0x8,
+    0xa3, 0xac, 0x80,
+
+    /* U+003D "=" */
+    0xf, 0xff, 0xfe, 0x19, 0x80, 0x7f, 0xfa, 0x3f, 0xff, 0xf8, 0x66, 0x1, 0xff, 0xe8, 0xff, 0xff,
+    0xe1, 0x98, 0x7, 0xff, 0xa3, 0xff, 0xff, 0x86, 0x60,
+
+    /* U+003E ">" */
+    0x7, 0x10, 0xf, 0xfe, 0x1c, 0x75, 0x20, 0x7, 0xff, 0xd, 0x6f, 0x9c, 0x40, 0x3f, 0xf8, 0x43,
+    0x1d, 0x6a, 0x1, 0xf9, 0x40, 0x3c, 0x95, 0xd0, 0x40, 0x1d, 0x5d, 0x26, 0x1, 0xc2, 0xfb, 0x8a,
+    0x1, 0x85, 0xb3, 0x5c, 0x40, 0x38, 0xeb, 0xc8, 0x3, 0x8a, 0x3a, 0xd4, 0x3, 0xc2, 0x1, 0xf9,
+    0x2b, 0x48, 0x3, 0xff, 0x82, 0xb7, 0xa4, 0x1, 0xfe, 0x39, 0xfa, 0x40, 0xe, 0x11, 0x0, 0x5,
+    0xf7, 0x18, 0x3, 0xcb, 0x7c, 0x41, 0x7d, 0x4, 0x1, 0xc5, 0x1d, 0x48, 0x1, 0x20, 0x7, 0x97,
+    0x35, 0xc4, 0x3, 0xf8, 0xe7, 0xa8, 0xc0, 0x3f, 0xcd, 0x98, 0x61, 0x0, 0xff, 0x4f, 0xc9, 0x80,
+    0x7f, 0xe0,
+
+    /* U+003F "?" */
+    0x0, 0xe3, 0x8c, 0xef, 0xf7, 0x64, 0x18, 0x7, 0xc5, 0x98, 0x73, 0x10, 0x0, 0x9b, 0xe5, 0x88,
+    0x6, 0x5d, 0x30, 0xf, 0xf2, 0x60, 0x80, 0x16, 0x80, 0x3f, 0xf8, 0x25, 0x60, 0xf, 0x0, 0xe5,
+    0x9a, 0x93, 0x0, 0xe5, 0x0, 0x55, 0x90, 0x16, 0xd3, 0x2b, 0x63, 0x80, 0x71, 0x0, 0x13, 0x67,
+    0x8, 0x3, 0xa4, 0x3, 0x8c, 0x3, 0x30, 0x80, 0x78, 0x80, 0x30, 0x88, 0x3, 0xff, 0x78, 0x6,
+    0x60, 0xf, 0xfd, 0x66, 0x1, 0x14, 0x80, 0x7f, 0x87, 0x10, 0x2, 0x2f, 0x10, 0xf, 0xf6, 0x98,
+    0x4, 0x58, 0x40, 0x1f, 0xe7, 0x30, 0x8, 0xb0, 0x40, 0x3f, 0xe9, 0x0, 0xde, 0x20, 0x1f, 0xf8,
+    0xc8, 0xa4, 0x20, 0xf, 0xfe, 0xe, 0xee, 0xb0, 0xf, 0xfe, 0xaa, 0xe7, 0x59, 0x80, 0x7f, 0xf0,
+    0x52, 0x8c, 0x53, 0x4, 0x3, 0xff, 0x70, 0x7, 0x38, 0x7, 0xff, 0x4f, 0x80, 0x39, 0xc0, 0x3f,
+    0xf2, 0x51, 0x1, 0xe0, 0x80, 0x70,
+
+    /* U+0040 "@" */
+    0x0, 0xff, 0x24, 0x5f, 0x7f, 0xdd, 0x94, 0xc2, 0x1, 0xff, 0xc4, 0x18, 0xeb, 0x74, 0x10, 0x8,
+    0x4d, 0x67, 0xac, 0xc0, 0x3f, 0xf8, 0x2f, 0xce, 0x20, 0x1f, 0xf9, 0x32, 0x84, 0x3, 0xf8, 0x6e,
+    0x0, 0x31, 0xc5, 0xee, 0xd9, 0x4c, 0x20, 0x12, 0xf9, 0x80, 0x7e, 0xd4, 0x0, 0x9b, 0x71, 0xd0,
+    0x8a, 0x35, 0x9e, 0xb3, 0x0, 0xe, 0x18, 0x7, 0xac, 0xc0, 0x3, 0x92, 0x40, 0x1f, 0xe4, 0xc8,
+    0x0, 0xb4, 0x40, 0x33, 0xa0, 0x0, 0xbc, 0xc0, 0xb, 0x7d, 0xfd, 0x68, 0x13, 0xff, 0x65, 0x0,
+    0x7, 0x40, 0x21, 0x80, 0xb, 0xc4, 0x7, 0x29, 0x4, 0x5, 0x2e, 0x8c, 0x3, 0x2c, 0x0, 0xd,
+    0x40, 0x12, 0x1, 0x49, 0x0, 0xe1, 0x80, 0x7c, 0xaa, 0x0, 0xe7, 0x30, 0x4, 0x0, 0x18, 0x0,
+    0x4c, 0x0, 0xb2, 0x0, 0xc8, 0xc8, 0x1, 0xfd, 0x0, 0x2, 0x34, 0x10, 0x5, 0x0, 0x9, 0x40,
+    0x22, 0xdb, 0x9b, 0xc1, 0x0, 0xf9, 0x4, 0x0, 0x86, 0x1, 0x28, 0x2, 0x80, 0x37, 0x90, 0x4,
+    0x74, 0x1, 0xf9, 0x0, 0x1b, 0xa0, 0x8, 0x80, 0x8, 0x1, 0x19, 0x0, 0x72, 0x10, 0x7, 0xda,
+    0x0, 0x61, 0x0, 0x10, 0x4, 0x40, 0x12, 0x0, 0x7c, 0x80, 0x1f, 0x8, 0x0, 0x40, 0x3f, 0xef,
+    0x0, 0xf8, 0x40, 0x3e, 0x30, 0xf, 0x18, 0x7, 0xdc, 0x1, 0xf1, 0x0, 0x7c, 0x60, 0x1, 0x20,
+    0x0, 0x80, 0x44, 0x1, 0x28, 0x7, 0xce, 0x1, 0xf7, 0x0, 0x1b, 0x80, 0x23, 0x0, 0x20, 0x4,
+    0x66, 0x0, 0xe4, 0x20, 0x9, 0xc0, 0x24, 0x0, 0x6a, 0x0, 0x48, 0x0, 0xa0, 0xd, 0xa6, 0x1,
+    0x1d, 0x0, 0x62, 0x0, 0x21, 0x80, 0x14, 0xc4, 0x1, 0x40, 0x2, 0x60, 0x8, 0x73, 0x15, 0x98,
+    0x10, 0xc, 0x3b, 0x56, 0x0, 0x42, 0x6, 0x0, 0x13, 0x0, 0x24, 0x80, 0x31, 0xa9, 0x80, 0x14,
+    0x80, 0x22, 0x50, 0xa, 0x40, 0x12, 0x1, 0x49, 0x0, 0x30, 0xc0, 0x3e, 0x4a, 0x90, 0xf, 0xac,
+    0x80, 0x3, 0x20, 0x17, 0x88, 0xe, 0x52, 0x8, 0xa, 0x55, 0x82, 0x62, 0x8, 0xb, 0x6a, 0x0,
+    0x66, 0x40, 0x1, 0x79, 0x80, 0x16, 0xfb, 0xfa, 0xd4, 0x2, 0x3b, 0xef, 0xe9, 0x20, 0xf, 0x59,
+    0x80, 0x7, 0x24, 0x80, 0x3f, 0xc6, 0x1, 0xff, 0xc1, 0xc4, 0x0, 0x9b, 0x72, 0x14, 0xc8, 0xd1,
+    0xa7, 0x70, 0xc0, 0x3f, 0xf8, 0x37, 0x0, 0x18, 0xde, 0xb3, 0x72, 0xe5, 0x88, 0x28, 0x3, 0xff,
+    0x84, 0xfc, 0xe2, 0x1, 0xff, 0xd0, 0x18, 0xeb, 0x73, 0x10, 0x8, 0x4d, 0xab, 0xa4, 0x3, 0xf0,
+
+    /* U+0041 "A" */
+    0x0, 0xff, 0x47, 0xff, 0x8, 0x7, 0xff, 0x1d, 0x80, 0x39, 0x80, 0x3f, 0xf8, 0xcc, 0x20, 0x1d,
+    0x20, 0x1f, 0xfc, 0x6b, 0x0, 0xf0, 0xa8, 0x7, 0xff, 0x11, 0x8, 0x3, 0xe9, 0x0, 0xff, 0xe2,
+    0x78, 0x6, 0x30, 0x8, 0xcc, 0x1, 0xff, 0xc2, 0x24, 0x0, 0x92, 0x0, 0x34, 0x80, 0x7f, 0xf0,
+    0xa8, 0x3, 0x7a, 0x10, 0x4, 0xa2, 0x1, 0xff, 0xc1, 0x70, 0x8, 0x50, 0x28, 0x3, 0x48, 0x7,
+    0xfe, 0x60, 0xd, 0x20, 0x6, 0x0, 0xcc, 0x1, 0xff, 0xac, 0x3, 0x30, 0x0, 0x54, 0x2, 0x16,
+    0x0, 0xff, 0x21, 0x0, 0x4a, 0x20, 0x14, 0x80, 0x6b, 0x0, 0xff, 0x78, 0x6, 0xe0, 0xc, 0x64,
+    0x1, 0x12, 0x0, 0x7e, 0x24, 0x0, 0x89, 0x0, 0x3a, 0x80, 0x37, 0x80, 0x7e, 0xb0, 0xc, 0x5f,
+    0xfe, 0x80, 0xc, 0x84, 0x1, 0xe1, 0x60, 0xf, 0xfe, 0x2d, 0x0, 0x79, 0x80, 0x3f, 0xf8, 0xce,
+    0x1, 0xe9, 0x0, 0xff, 0xe3, 0xb8, 0x6, 0x51, 0x0, 0x8b, 0xff, 0xfd, 0x0, 0x1a, 0x80, 0x34,
+    0x80, 0x6a, 0x0, 0xff, 0x30, 0x6, 0x24, 0x0, 0x19, 0x80, 0x33, 0x0, 0x7f, 0x85, 0x80, 0x37,
+    0x80, 0x24, 0x3, 0x28, 0x80, 0x7f, 0xd4, 0x1, 0x90, 0x85, 0x40, 0x34, 0x80, 0x7f, 0xe3, 0x20,
+    0xd, 0x60,
+
+    /* U+0042 "B" */
+    0x5f, 0xff, 0xfd, 0xd7, 0x4, 0x1, 0xff, 0xc6, 0x14, 0x7d, 0x90, 0xf, 0xfe, 0x4b, 0x58, 0x7,
+    0xff, 0x25, 0x1c, 0x3, 0xe2, 0xff, 0xf6, 0xc0, 0x7, 0x50, 0x7, 0xff, 0x8, 0x9e, 0x40, 0x31,
+    0x0, 0x7f, 0xf1, 0x10, 0x3, 0xff, 0x92, 0xe0, 0x1f, 0xfc, 0x85, 0xb0, 0xc, 0xa0, 0x1f, 0x17,
+    0x77, 0xbe, 0x84, 0x3, 0x40, 0x7, 0xe1, 0x1f, 0x0, 0x7a, 0x88, 0x3, 0xff, 0x8e, 0xa8, 0x1,
+    0xff, 0xc8, 0x5f, 0x40, 0xf, 0x8b, 0xff, 0xed, 0x70, 0x8, 0x6c, 0xc0, 0x3f, 0xf8, 0x45, 0x12,
+    0x1, 0xa0, 0x3, 0xff, 0x88, 0xe0, 0x19, 0x0, 0x3f, 0xf9, 0x44, 0x1, 0xff, 0xc3, 0x70, 0xf,
+    0xfe, 0x39, 0x44, 0x80, 0x71, 0x0, 0x71, 0x7f, 0xfd, 0xae, 0x1, 0xcc, 0x1, 0xff, 0xc8, 0x28,
+    0x0, 0xff, 0xe3, 0xae, 0x8, 0x7, 0xff, 0xc, 0x52, 0x36, 0x84, 0x0,
+
+    /* U+0043 "C" */
+    0x0, 0xf8, 0x5e, 0xf7, 0xfe, 0xda, 0x61, 0x0, 0xfe, 0x2a, 0xe8, 0x42, 0x0, 0x89, 0x67, 0xa0,
+    0x3, 0xe6, 0xd5, 0x0, 0xff, 0x9f, 0x48, 0x3, 0x44, 0x80, 0x7f, 0xf0, 0x8b, 0x8, 0x0, 0xce,
+    0x1, 0xe2, 0x56, 0x61, 0x80, 0x70, 0x88, 0xa, 0x40, 0x39, 0x37, 0x55, 0x32, 0xce, 0x60, 0x0,
+    0xe9, 0x84, 0x0, 0x73, 0xd9, 0x0, 0x70, 0xcd, 0x16, 0x10, 0xa, 0x80, 0x65, 0x80, 0xf, 0xe5,
+    0xd2, 0x0, 0x38, 0x7, 0x40, 0x7, 0xff, 0xf, 0xc0, 0x31, 0x90, 0x7, 0xff, 0xc, 0x80, 0x32,
+    0x80, 0x7f, 0xf2, 0x44, 0x3, 0xff, 0x92, 0x20, 0x1f, 0xfc, 0x42, 0x0, 0xca, 0x1, 0xff, 0xc4,
+    0xf0, 0xc, 0x62, 0x1, 0xff, 0xc3, 0x70, 0xe, 0xb0, 0xf, 0xfe, 0x18, 0xa8, 0x6, 0x57, 0x0,
+    0xfe, 0x5d, 0x20, 0xa, 0x0, 0x3a, 0x2c, 0x80, 0x38, 0x66, 0x8b, 0xc, 0x0, 0x52, 0x1, 0xc9,
+    0xba, 0xa8, 0x9c, 0xe6, 0x0, 0xe, 0x18, 0x1, 0x9c, 0x3, 0xc4, 0xae, 0xc6, 0x1, 0xc2, 0x20,
+    0xa, 0x24, 0x3, 0xff, 0x84, 0x58, 0x40, 0x19, 0xb5, 0x40, 0x3f, 0xe7, 0xd2, 0x0, 0xf1, 0x56,
+    0xc2, 0x8, 0x4, 0x4b, 0x3f, 0x0, 0x10,
+
+    /* U+0044 "D" */
+    0x5f, 0xff, 0xfb, 0xb2, 0x50, 0x3, 0xff, 0x90, 0x26, 0xd7, 0xce, 0x1, 0xff, 0xca, 0x18, 0xd2,
+    0x0, 0xff, 0xe5, 0x16, 0x18, 0x7, 0xe1, 0x99, 0xf3, 0x10, 0x7, 0xe, 0x88, 0x7, 0xc6, 0xcd,
+    0xe9, 0xdb, 0x20, 0xc, 0x36, 0x1, 0xff, 0xc4, 0x4c, 0x20, 0xc, 0xa4, 0x1, 0xff, 0xc4, 0x1f,
+    0x0, 0xeb, 0x0, 0xff, 0xe2, 0x93, 0x0, 0x64, 0x0, 0xff, 0xe3, 0x68, 0x6, 0x20, 0xf, 0xfe,
+    0x33, 0x0, 0x71, 0x0, 0x7f, 0xf1, 0x4c, 0x3, 0xff, 0x96, 0x60, 0x1f, 0xfc, 0xb6, 0x0, 0xe2,
+    0x0, 0xff, 0xe2, 0xf0, 0x6, 0x20, 0xf, 0xfe, 0x29, 0x28, 0x6, 0x40, 0xf, 0xfe, 0x20, 0xf8,
+    0x7, 0x58, 0x7, 0xff, 0xd, 0x3c, 0x80, 0x32, 0x90, 0x7, 0x8d, 0x9b, 0x9e, 0x76, 0xc4, 0x3,
+    0xd, 0x80, 0x7c, 0x33, 0x3d, 0xc, 0x40, 0x1c, 0x38, 0x20, 0x1f, 0xfc, 0x83, 0xc2, 0x0, 0xff,
+    0xe3, 0x8c, 0x61, 0x0, 0x7f, 0xf1, 0x4, 0xda, 0xf9, 0xc0, 0x3c,
+
+    /* U+0045 "E" */
+    0x5f, 0xff, 0xfe, 0x24, 0x80, 0x7f, 0xfb, 0xca, 0xef, 0xff, 0x0, 0x79, 0x13, 0xfe, 0x20, 0xf,
+    0xff, 0x79, 0x7f, 0xff, 0x8c, 0x3, 0xff, 0xe0, 0x5b, 0xbf, 0xe3, 0x0, 0xf8, 0x8b, 0xfc, 0x1,
+    0xff, 0xf2, 0x44, 0xff, 0xc0, 0x1c, 0x57, 0x7f, 0xf8, 0x3, 0xff, 0xd4,
+
+    /* U+0046 "F" */
+    0x5f, 0xff, 0xfe, 0x24, 0x80, 0x7f, 0xfb, 0xc6, 0xef, 0xff, 0x0, 0x71, 0xa2, 0x7f, 0xc4, 0x1,
+    0xff, 0xff, 0x0, 0x17, 0xff, 0xf8, 0xc0, 0x3f, 0xfe, 0x3, 0x77, 0xfe, 0x30, 0xf, 0x1a, 0x27,
+    0xf8, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xe9,
+
+    /* U+0047 "G" */
+    0x0, 0xf8, 0x5a, 0xb7, 0xfe, 0xeb, 0x72, 0x0, 0xfe, 0x2a, 0xe9, 0x52, 0x0, 0x85, 0x23, 0x6c,
+    0x80, 0x3c, 0xda, 0xa0, 0x1f, 0xf2, 0x6b, 0x0, 0x68, 0x90, 0xf, 0xfe, 0x1c, 0xb8, 0x1, 0x9c,
+    0x3, 0xc4, 0xac, 0xc4, 0x0, 0xf0, 0x81, 0x48, 0x7, 0x26, 0x6d, 0x4c, 0xaf, 0xe0, 0x2, 0xa6,
+    0x8, 0x0, 0xe7, 0xb3, 0x0, 0xf3, 0xe9, 0xe2, 0x80, 0xa8, 0x6, 0x58, 0x0, 0xfe, 0x2c, 0x30,
+    0x3, 0x80, 0x74, 0x0, 0x7f, 0xf0, 0xfc, 0x3, 0x19, 0x0, 0x7f, 0xf0, 0xc8, 0x3, 0x28, 0x7,
+    0xff, 0x24, 0x40, 0x3f, 0xc5, 0xbb, 0x9c, 0x3, 0x84, 0x3, 0xfc, 0x24, 0x5b, 0xc8, 0x3, 0x28,
+    0x7, 0xff, 0x13, 0xc0, 0x31, 0x90, 0x7, 0xff, 0xd, 0xc0, 0x3a, 0x0, 0x3f, 0xf8, 0x62, 0xa0,
+    0x19, 0x60, 0x3, 0xff, 0x87, 0x0, 0x1c, 0xf6, 0x40, 0x1e, 0x50, 0xf, 0x14, 0x80, 0x72, 0x6e,
+    0xaa, 0x26, 0xfe, 0x40, 0x3e, 0x67, 0x0, 0xf1, 0x2b, 0xb2, 0x0, 0x7f, 0xa2, 0x40, 0x3f, 0xf8,
+    0x67, 0x40, 0x19, 0xb5, 0x40, 0x3f, 0xe3, 0xac, 0x20, 0xe, 0x2a, 0xe8, 0x42, 0x0, 0x89, 0x63,
+    0x71, 0x40, 0x0,
+
+    /* U+0048 "H" */
+    0x5f, 0xfd, 0xa0, 0x1f, 0xef, 0xfe, 0x30, 0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xa6,
+    0x5f, 0xff, 0xe0, 0xf, 0xff, 0xf8, 0x0, 0x5d, 0xff, 0xc0, 0x1f, 0xf1, 0xc4, 0x7f, 0x80, 0x3f,
+    0xff, 0xe0, 0x1f, 0xff, 0xf0, 0xf, 0xfe, 0xa0,
+
+    /* U+0049 "I" */
+    0x5f, 0xfd, 0xa0, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0x68,
+
+    /* U+004A "J" */
+    0x0, 0x17, 0xff, 0xfe, 0xd0, 0xf, 0xff, 0x31, 0x5d, 0xfd, 0x0, 0x1f, 0x91, 0x3e, 0x30, 0xf,
+    0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3, 0xf8, 0x40, 0x3e, 0x18, 0x0, 0xf6, 0x80, 0x66, 0x0, 0x53,
+    0xd0, 0x6, 0x16, 0x0, 0xc6, 0x12, 0x80, 0xbd, 0xd, 0x1e, 0x20, 0x1b, 0x11, 0x80, 0x21, 0x79,
+    0x71, 0x0, 0xc4, 0x89, 0x0, 0x7f, 0xee, 0x0, 0x5c, 0x0, 0x7f, 0xe, 0x18, 0x4, 0xfd, 0x8,
+    0x20, 0x1, 0x49, 0xe3, 0x0,
+
+    /* U+004B "K" */
+    0x5f, 0xfd, 0xa0, 0x1f, 0xd7, 0xff, 0xb8, 0x80, 0x3f, 0xf8, 0x74, 0x80, 0x1b, 0x48, 0x3, 0xff,
+    0x85, 0x2a, 0x1, 0xac, 0xc0, 0x3f, 0xf8, 0x50, 0xc0, 0x1a, 0x90, 0x3, 0xff, 0x84, 0xce, 0x1,
+    0xa5, 0x40, 0x3f, 0xf8, 0x4b, 0x20, 0x19, 0xd8, 0x3, 0xff, 0x84, 0x94, 0x1, 0x9a, 0x0, 0x3f,
+    0xf8, 0x47, 0x60, 0x19, 0x24, 0x3, 0xff, 0x84, 0x78, 0x1, 0x8e, 0xc0, 0x3f, 0xf8, 0x45, 0xa0,
+    0x18, 0xb4, 0x3, 0xff, 0x84, 0x7e, 0x20, 0x1a, 0x84, 0x3, 0xff, 0x84, 0x24, 0x1, 0xd0, 0x60,
+    0x1f, 0xfc, 0xae, 0x10, 0xf, 0xfe, 0x49, 0x50, 0x7, 0xff, 0x12, 0x8c, 0x3, 0x23, 0x80, 0x7f,
+    0xf0, 0xa5, 0x74, 0x40, 0x34, 0x20, 0x7, 0xfe, 0x86, 0x1, 0xd0, 0xe, 0xa1, 0x0, 0xff, 0x13,
+    0x80, 0x47, 0x20, 0x18, 0x74, 0x3, 0xff, 0x88, 0xcc, 0x0, 0xc7, 0x20, 0x1f, 0xfc, 0x49, 0x30,
+    0xc, 0xca, 0x1, 0xff, 0xc4, 0xd1, 0x0, 0xd4, 0x40, 0x1f, 0xfc, 0x31, 0xd0, 0xe, 0xf0, 0xf,
+    0xfe, 0x21, 0xc8, 0x6, 0x2a, 0x0,
+
+    /* U+004C "L" */
+    0x5f, 0xfd, 0xa0, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe, 0x1,
+    0xff, 0xcb, 0x35, 0x5f, 0xf8, 0x3, 0xc3, 0x55, 0xff, 0x8, 0x7, 0xff, 0xa8,
+
+    /* U+004D "M" */
+    0x5f, 0xfc, 0x60, 0x1f, 0xfc, 0x3b, 0xff, 0xb4, 0x3, 0xbc, 0x3, 0xff, 0x84, 0x88, 0x0, 0xfe,
+    0x36, 0x0, 0xff, 0xe0, 0xc8, 0x7, 0xfd, 0x2, 0x1, 0xff, 0x39, 0x0, 0x7f, 0xc3, 0x0, 0x1f,
+    0xe1, 0x80, 0xf, 0xfe, 0xb, 0x18, 0x7, 0xf4, 0x0, 0x7f, 0xf0, 0xfc, 0x3, 0xf1, 0xb0, 0x7,
+    0xff, 0xc, 0xd4, 0x3, 0xef, 0x0, 0xff, 0xe2, 0xd8, 0x7, 0x94, 0xc0, 0x3f, 0xf8, 0x22, 0x1,
+    0xc, 0x0, 0x75, 0x80, 0x46, 0x1, 0x8c, 0x3, 0x98, 0x80, 0x27, 0x20, 0x9, 0xc4, 0x2, 0xf0,
+    0xf, 0xfa, 0x40, 0x34, 0x80, 0x6, 0x0, 0x25, 0x30, 0xf, 0xf9, 0x14, 0x2, 0x44, 0x5, 0x80,
+    0x6b, 0x0, 0xff, 0xe0, 0xd8, 0x6, 0x94, 0x50, 0xa, 0x4, 0x3, 0xff, 0x82, 0x30, 0x1, 0x15,
+    0x80, 0x42, 0xe0, 0x1f, 0xfc, 0x37, 0x20, 0xf, 0xac, 0x3, 0xff, 0x8b, 0x0, 0x1e, 0x35, 0x0,
+    0xff, 0xe2, 0xaa, 0x0, 0x77, 0x80, 0x7f, 0xf1, 0xe4, 0x3, 0x31, 0x80, 0x7f, 0xf1, 0xc9, 0xc0,
+    0x28, 0x0, 0xff, 0xe4, 0xc3, 0xb5, 0x8, 0x7, 0xff, 0x2a, 0x25, 0x40, 0x3f, 0xfb, 0x20,
+
+    /* U+004E "N" */
+    0x5f, 0xfc, 0xa0, 0x1f, 0xee, 0xff, 0xc6, 0x1, 0xd4, 0x40, 0x1f, 0xfc, 0x9f, 0x10, 0xf, 0xfe,
+    0x41, 0x50, 0x7, 0xff, 0x25, 0x20, 0x3, 0xff, 0x92, 0xea, 0x1, 0xff, 0xc9, 0xa2, 0x0, 0xff,
+    0xe4, 0xf8, 0x7, 0xff, 0x24, 0xac, 0x3, 0xff, 0x86, 0x66, 0x0, 0xc8, 0xe0, 0x1f, 0xfc, 0x3d,
+    0x10, 0xd, 0x8, 0x1, 0xff, 0xc2, 0x1d, 0x0, 0xeb, 0x20, 0xf, 0xfe, 0x11, 0xc8, 0x7, 0x78,
+    0x7, 0xff, 0xd, 0x94, 0x3, 0x15, 0x0, 0x7f, 0xf0, 0xe8, 0xc0, 0x32, 0x88, 0x7, 0xff, 0xf,
+    0x44, 0x3, 0xff, 0x90, 0x34, 0x1, 0xff, 0xc9, 0x48, 0x0, 0xff, 0xe4, 0xba, 0x80, 0x7f, 0xf2,
+    0x68, 0x80, 0x3f, 0xf9, 0x3e, 0x20, 0x1f, 0xfc, 0x82, 0xa0, 0xf, 0xfe, 0x4a, 0x40, 0x7,
+
+    /* U+004F "O" */
+    0x0, 0xf8, 0x5a, 0xb7, 0xfe, 0xda, 0x61, 0x0, 0xff, 0xc3, 0x3d, 0x2a, 0x40, 0x11, 0x2c, 0xf5,
+    0x8, 0x7, 0xf2, 0xf3, 0x0, 0x7f, 0xcb, 0xca, 0x1, 0xf3, 0xd0, 0x7, 0xff, 0xe, 0x9c, 0x3,
+    0x96, 0x0, 0x3c, 0x4a, 0xca, 0x40, 0x1e, 0x85, 0x0, 0x86, 0x80, 0x39, 0x37, 0x55, 0x35, 0xba,
+    0x40, 0xe, 0xa1, 0x0, 0x58, 0x7, 0x3d, 0x90, 0x7, 0x15, 0xb8, 0x7, 0x58, 0xa, 0x80, 0x65,
+    0x80, 0xf, 0xe8, 0x50, 0xc, 0xa2, 0x80, 0x1d, 0x0, 0x1f, 0xf4, 0x0, 0x73, 0xe0, 0x6, 0x32,
+    0x0, 0xff, 0x88, 0xc0, 0x37, 0x90, 0x6, 0x50, 0xf, 0xfe, 0xa, 0x0, 0x62, 0x0, 0xe1, 0x0,
+    0xff, 0xe0, 0xf8, 0x6, 0x70, 0xe, 0x10, 0xf, 0xfe, 0xf, 0x80, 0x67, 0x20, 0xc, 0xa0, 0x1f,
+    0xfc, 0x14, 0x0, 0xc5, 0x80, 0x18, 0xc8, 0x3, 0xfe, 0x13, 0x0, 0xde, 0x80, 0x1d, 0x0, 0x1f,
+    0xf5, 0x80, 0x73, 0x8a, 0x80, 0x65, 0x70, 0xf, 0xe7, 0x50, 0xc, 0xa2, 0x16, 0x1, 0xd1, 0x44,
+    0x1, 0xc5, 0x70, 0x1, 0xd0, 0x0, 0x19, 0x0, 0xe5, 0xdc, 0x98, 0x9c, 0xd4, 0x0, 0xe9, 0x20,
+    0x9, 0xa0, 0x3, 0xc6, 0xce, 0xc6, 0x1, 0xe8, 0x60, 0xe, 0x79, 0x0, 0xff, 0xe1, 0xcb, 0x80,
+    0x7c, 0xda, 0xa0, 0x1f, 0xf2, 0xf3, 0x0, 0x7f, 0x15, 0x74, 0xa9, 0x0, 0x44, 0xb3, 0xd4, 0x20,
+    0x1c,
+
+    /* U+0050 "P" */
+    0x5f, 0xff, 0xfb, 0x69, 0x84, 0x3, 0xff, 0x8a, 0x4b, 0x3c, 0xe0, 0x1f, 0xfc, 0x88, 0xb0, 0xf,
+    0xfe, 0x42, 0x50, 0x7, 0xc3, 0x55, 0xd0, 0x80, 0x1c, 0xa8, 0x1, 0xe3, 0x55, 0xe7, 0xbb, 0x0,
+    0x77, 0x0, 0x7f, 0xf0, 0x91, 0xc0, 0x32, 0x0, 0x7f, 0xf0, 0xec, 0x3, 0x8, 0x7, 0xff, 0x24,
+    0x40, 0x3f, 0xf8, 0x4a, 0x1, 0xc2, 0x1, 0xff, 0xc2, 0xb0, 0xc, 0x60, 0x1f, 0xf8, 0x5b, 0x48,
+    0x3, 0x58, 0x7, 0x8b, 0xff, 0xba, 0x48, 0x3, 0x13, 0x80, 0x7f, 0xf1, 0xf8, 0x3, 0xff, 0x8c,
+    0x5a, 0x60, 0x1f, 0xfc, 0x43, 0x9d, 0x20, 0xf, 0xc3, 0x55, 0xd7, 0x9f, 0x8c, 0x1, 0xfe, 0x35,
+    0x5e, 0x43, 0x0, 0xff, 0xff, 0x80, 0x7f, 0xf6, 0x80,
+
+    /* U+0051 "Q" */
+    0x0, 0xf8, 0x5a, 0xb7, 0xfe, 0xda, 0x61, 0x0, 0xff, 0xe0, 0x8c, 0xf4, 0xa9, 0x0, 0x44, 0xb3,
+    0xd4, 0x20, 0x1f, 0xe5, 0xe6, 0x0, 0xff, 0x97, 0x94, 0x3, 0xf3, 0xd0, 0x7, 0xff, 0xe, 0x9c,
+    0x3, 0xcb, 0x0, 0x1e, 0x25, 0x65, 0x20, 0xf, 0x43, 0x0, 0x61, 0xa0, 0xe, 0x4d, 0xd5, 0x4d,
+    0x6e, 0x90, 0x3, 0xa4, 0x40, 0x2b, 0x0, 0xe7, 0xb2, 0x0, 0xe2, 0xb7, 0x0, 0xeb, 0x0, 0xa,
+    0x80, 0x65, 0x80, 0xf, 0xe8, 0x50, 0xc, 0xa2, 0x8, 0x1, 0xd0, 0x1, 0xff, 0x40, 0x7, 0x38,
+    0x60, 0x6, 0x32, 0x0, 0xff, 0x88, 0xc0, 0x37, 0x81, 0x0, 0x65, 0x0, 0xff, 0xe0, 0xa0, 0x6,
+    0x20, 0xf, 0x8, 0x7, 0xff, 0x7, 0xc0, 0x33, 0x80, 0x78, 0x40, 0x3f, 0xf8, 0x3e, 0x1, 0x9c,
+    0x8, 0x3, 0x28, 0x7, 0xff, 0x5, 0x0, 0x31, 0x6, 0x0, 0x63, 0x20, 0xf, 0xf8, 0x4c, 0x3,
+    0x78, 0x20, 0x7, 0x40, 0x7, 0xfd, 0x60, 0x1c, 0xe0, 0x2a, 0x1, 0x95, 0xc0, 0x3f, 0xa1, 0x40,
+    0x32, 0x88, 0x2, 0xc0, 0x3a, 0x28, 0x80, 0x38, 0xad, 0xc0, 0x3a, 0x0, 0x21, 0x90, 0xe, 0x5d,
+    0xc9, 0x89, 0xcd, 0x40, 0xe, 0x92, 0x0, 0xcd, 0x0, 0x1e, 0x36, 0x76, 0x30, 0xf, 0x43, 0x0,
+    0x79, 0xe4, 0x3, 0xff, 0x87, 0x2e, 0x1, 0xf9, 0xb5, 0x40, 0x3f, 0xe5, 0xe6, 0x0, 0xff, 0x15,
+    0x74, 0xa8, 0x80, 0x7b, 0x68, 0x40, 0x27, 0x0, 0xfe, 0x16, 0xae, 0x40, 0xe, 0xf5, 0x0, 0x26,
+    0x44, 0x80, 0x7f, 0xeb, 0x40, 0xc, 0x55, 0xfe, 0xb3, 0x6, 0x60, 0x7, 0xfe, 0xb6, 0x0, 0xff,
+    0xb8, 0x3, 0xff, 0x83, 0x34, 0x20, 0x1f, 0xa2, 0x0, 0x1f, 0xfc, 0x25, 0xe9, 0x52, 0x1, 0x37,
+    0xe7, 0x0,
+
+    /* U+0052 "R" */
+    0x5f, 0xff, 0xfb, 0x69, 0x84, 0x3, 0xff, 0x8a, 0x4b, 0x3d, 0x0, 0x1f, 0xfc, 0x87, 0xc0, 0xf,
+    0xfe, 0x41, 0xd8, 0x7, 0xc3, 0x55, 0xd0, 0x80, 0x1c, 0x88, 0x0, 0xf1, 0xaa, 0xf3, 0xdd, 0x80,
+    0x3b, 0xc0, 0x3f, 0xf8, 0x48, 0xe0, 0x19, 0x40, 0x3f, 0xf8, 0x76, 0x1, 0x84, 0x3, 0xff, 0x92,
+    0x20, 0x1f, 0xfc, 0x25, 0x0, 0xe1, 0x0, 0xff, 0xe0, 0x8d, 0x80, 0x63, 0x0, 0xff, 0xc2, 0xd8,
+    0x40, 0x1a, 0x80, 0x3c, 0x5f, 0xfd, 0xd2, 0x40, 0x18, 0x98, 0x3, 0xff, 0x8c, 0x3e, 0x1, 0xff,
+    0xc6, 0x3c, 0x20, 0xf, 0xfe, 0x2a, 0x61, 0x0, 0x7e, 0x1b, 0xbd, 0x20, 0x19, 0x10, 0x1, 0xfc,
+    0x68, 0x99, 0x94, 0x3, 0x48, 0x7, 0xff, 0xe, 0xc4, 0x2, 0x29, 0x0, 0xff, 0xe1, 0xd, 0x80,
+    0x66, 0x30, 0xf, 0xfe, 0x12, 0xa0, 0x6, 0xe0, 0xf, 0xfe, 0x1d, 0x0, 0x62, 0x80, 0xf, 0xfe,
+    0x10, 0xc8, 0x6, 0x73,
+
+    /* U+0053 "S" */
+    0x0, 0xe1, 0x6b, 0xdf, 0xfb, 0xb2, 0x54, 0x3, 0xf4, 0x74, 0xa1, 0x0, 0x42, 0x6d, 0x5f, 0x2,
+    0x1, 0xb1, 0xc0, 0x3f, 0xf3, 0xb8, 0x2, 0xa3, 0x0, 0xff, 0xe0, 0x8b, 0x0, 0xd, 0x40, 0x39,
+    0xa6, 0xea, 0x14, 0x40, 0xe, 0x1, 0x58, 0x6, 0x1e, 0x96, 0x45, 0x7a, 0xeb, 0x3b, 0x0, 0x88,
+    0x3, 0x30, 0x80, 0x7c, 0x98, 0x40, 0x11, 0x80, 0x62, 0x0, 0xff, 0xe1, 0x70, 0x6, 0x5a, 0x20,
+    0xf, 0xfc, 0xc0, 0x1c, 0xbb, 0xa9, 0x62, 0x0, 0xfc, 0x32, 0x1, 0xe2, 0x69, 0xdd, 0x49, 0x80,
+    0x79, 0xac, 0x80, 0x3f, 0x13, 0x66, 0x8, 0x3, 0x93, 0x69, 0x0, 0x3f, 0x8f, 0x4c, 0x3, 0xcb,
+    0x7f, 0x6e, 0x60, 0x1f, 0x70, 0x7, 0xf2, 0x46, 0x7d, 0x10, 0x6, 0x24, 0x0, 0xff, 0xcb, 0xa4,
+    0x1, 0x8c, 0x0, 0x62, 0x1, 0xfe, 0x70, 0xf, 0xbb, 0x90, 0x40, 0x1f, 0x12, 0x0, 0x62, 0x4,
+    0x20, 0x7d, 0xc8, 0x64, 0x42, 0xce, 0x88, 0x6, 0x40, 0xf0, 0xc, 0x6f, 0x37, 0x6a, 0x60, 0xe,
+    0x71, 0x0, 0xff, 0xe2, 0xac, 0x0, 0x2e, 0x8c, 0x3, 0xfe, 0x19, 0xa0, 0xc, 0xb9, 0xb2, 0xa4,
+    0x20, 0x11, 0x2d, 0x73, 0x0, 0x40,
+
+    /* U+0054 "T" */
+    0xef, 0xff, 0xfe, 0x35, 0x0, 0x7f, 0xfc, 0x2a, 0xbe, 0x30, 0xc, 0xb5, 0x5e, 0x94, 0x55, 0xf3,
+    0x80, 0x6d, 0x55, 0xf1, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xff, 0xf0, 0xf, 0xff,
+    0xf8, 0x7, 0xff, 0x70,
+
+    /* U+0055 "U" */
+    0x8f, 0xfd, 0x40, 0x1f, 0xcd, 0xff, 0xb0, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xff, 0x0, 0xff, 0xff,
+    0x80, 0x7f, 0xf3, 0x9c, 0x3, 0x84, 0x3, 0xff, 0x87, 0xc0, 0x19, 0x80, 0x3f, 0xb8, 0x3, 0x9,
+    0x0, 0x62, 0x10, 0xf, 0xca, 0x1, 0xb5, 0x0, 0x3a, 0x0, 0x3e, 0x42, 0x0, 0xc8, 0xa, 0x1,
+    0x99, 0xc0, 0x39, 0x2c, 0x3, 0x9, 0x84, 0x80, 0x74, 0x75, 0x44, 0xed, 0x80, 0x74, 0x0, 0xd,
+    0xc0, 0x38, 0x55, 0xd8, 0x80, 0x38, 0xd8, 0x2, 0x86, 0x0, 0xff, 0xe0, 0x9e, 0x80, 0x74, 0xc8,
+    0x40, 0x3f, 0xcf, 0x82, 0x1, 0xe6, 0xea, 0x52, 0x0, 0x85, 0x27, 0xa0, 0x3,
+
+    /* U+0056 "V" */
+    0x1f, 0xfe, 0x80, 0xf, 0xfc, 0x5f, 0xfb, 0x80, 0x54, 0x3, 0x30, 0x7, 0xfe, 0xb0, 0xc, 0xc0,
+    0x9, 0x0, 0xc2, 0xa0, 0x1f, 0xf3, 0x0, 0x6a, 0x0, 0x19, 0x80, 0x34, 0x80, 0x7f, 0x98, 0x3,
+    0x21, 0x0, 0x54, 0x1, 0x8c, 0x80, 0x3f, 0xac, 0x3, 0x78, 0x6, 0x61, 0x0, 0xd6, 0x1, 0xf9,
+    0x8, 0x2, 0x24, 0x0, 0xe6, 0x0, 0xcc, 0x1, 0xfb, 0xc0, 0x35, 0x0, 0x7a, 0x80, 0x39, 0x80,
+    0x3c, 0x48, 0x1, 0x98, 0x3, 0xc4, 0x80, 0x1a, 0xc0, 0x3d, 0x40, 0x19, 0x84, 0x3, 0xef, 0x0,
+    0xc4, 0x80, 0x1c, 0xc0, 0x1a, 0x80, 0x3f, 0x21, 0x0, 0x6e, 0x0, 0xcc, 0x20, 0x11, 0x98, 0x3,
+    0xfa, 0x80, 0x32, 0x88, 0x5, 0x40, 0x1a, 0x40, 0x3f, 0xcc, 0x1, 0xd2, 0x0, 0x33, 0x0, 0x42,
+    0xa0, 0x1f, 0xe1, 0x60, 0xc, 0xc0, 0x9, 0x0, 0xcc, 0x1, 0xff, 0xa8, 0x3, 0xa, 0x8a, 0x80,
+    0x69, 0x0, 0xff, 0xc6, 0x60, 0xd, 0xcc, 0x1, 0x94, 0x40, 0x3f, 0xf8, 0x32, 0x1, 0x92, 0x40,
+    0x34, 0x80, 0x7f, 0xf0, 0x94, 0x40, 0x30, 0x80, 0x44, 0x60, 0x1f, 0xfc, 0x36, 0x0, 0xfd, 0x60,
+    0x1f, 0xfc, 0x49, 0x0, 0xf8, 0x58, 0x3, 0xff, 0x88, 0x2a, 0x1, 0xe6, 0x0, 0xff, 0xe3, 0x70,
+    0x7, 0xa8, 0x3, 0xff, 0x8c, 0x84, 0x1, 0x90, 0x80, 0x3f, 0x80,
+
+    /* U+0057 "W" */
+    0x2f, 0xfe, 0x30, 0xf, 0xeb, 0xff, 0xcc, 0x1, 0xfd, 0x3f, 0xf9, 0x48, 0x80, 0x1a, 0xc0, 0x3f,
+    0xa, 0x0, 0x6d, 0x0, 0xfe, 0x70, 0xc, 0x80, 0xa0, 0x19, 0x40, 0x3f, 0x38, 0x7, 0x20, 0x7,
+    0xe4, 0x10, 0x9, 0x4, 0x28, 0x3, 0x11, 0x0, 0x3e, 0xd0, 0xf, 0x28, 0x7, 0xda, 0x1, 0xb4,
+    0x0, 0x44, 0x0, 0xca, 0x1, 0xe1, 0x40, 0xf, 0x78, 0x7, 0xce, 0x1, 0x9c, 0x2, 0x50, 0xd,
+    0x60, 0x1e, 0x70, 0xf, 0x90, 0x3, 0xc6, 0x20, 0x11, 0x88, 0x5, 0x60, 0x18, 0xc4, 0x3, 0xb4,
+    0x3, 0xe1, 0x40, 0xe, 0xb0, 0xd, 0x60, 0x18, 0xc4, 0x3, 0x38, 0x7, 0x20, 0x4, 0x40, 0x1b,
+    0x40, 0x39, 0x40, 0x32, 0x80, 0x73, 0x80, 0x6d, 0x0, 0xca, 0x1, 0xa4, 0x40, 0x27, 0x0, 0xc4,
+    0x40, 0x8, 0xc8, 0x3, 0xb4, 0x3, 0x20, 0x80, 0x5e, 0x1, 0x91, 0x0, 0x10, 0x98, 0x4, 0xa0,
+    0x1a, 0xc0, 0x3c, 0x82, 0x1, 0x90, 0x2, 0x50, 0x9, 0x43, 0xc0, 0x35, 0x80, 0x54, 0x1, 0x94,
+    0x3, 0xe4, 0x0, 0xde, 0x0, 0x50, 0xd, 0xe0, 0xa0, 0x19, 0x40, 0x4, 0x40, 0x8, 0x88, 0x1,
+    0xf7, 0x80, 0x65, 0x0, 0x78, 0x6, 0x50, 0x2, 0x0, 0x44, 0x40, 0x50, 0xc, 0xa0, 0x1f, 0x94,
+    0x3, 0x90, 0x14, 0x2, 0x50, 0xb, 0x40, 0x32, 0x85, 0x80, 0x6b, 0x0, 0xfe, 0x50, 0xd, 0xaa,
+    0x1, 0xbc, 0x2, 0x70, 0xd, 0x62, 0x60, 0x10, 0x98, 0x7, 0xf7, 0x80, 0x67, 0xf0, 0xc, 0xa0,
+    0x10, 0xa0, 0x4, 0x72, 0x1, 0x9c, 0x3, 0xfc, 0x80, 0x18, 0x54, 0x2, 0x40, 0xe, 0xd0, 0xc,
+    0xe0, 0x1b, 0x40, 0x3f, 0xc2, 0x80, 0x1f, 0xb4, 0x3, 0x9c, 0x3, 0xf0, 0xa0, 0x7, 0xfd, 0xa0,
+    0x1f, 0x9c, 0x3, 0x84, 0xc0, 0x3e, 0x70, 0xf, 0xfc, 0xe0, 0x1f, 0x20, 0x80, 0x7a, 0xc0, 0x3e,
+    0xd0, 0xf, 0xfc, 0x26, 0x1, 0xed, 0x0, 0xf9, 0x40, 0x3e, 0x40, 0xf, 0xfe, 0xd, 0x80, 0x79,
+    0xc0, 0x3e, 0x22, 0x0, 0x72, 0x80, 0x7f, 0xf0, 0x94, 0x3, 0x8c, 0x40, 0x3f, 0x28, 0x7, 0x78,
+    0x7, 0xc0,
+
+    /* U+0058 "X" */
+    0x2f, 0xfe, 0xb0, 0xf, 0xec, 0xff, 0xda, 0x5, 0x0, 0x19, 0x18, 0x3, 0xe7, 0x30, 0xd, 0xe0,
+    0x7, 0x40, 0xd, 0x24, 0x1, 0xc5, 0x0, 0x1a, 0x8, 0x2, 0xa0, 0xe, 0xe0, 0xe, 0xe0, 0xc,
+    0x8e, 0x1, 0x86, 0x80, 0x31, 0xb8, 0x4, 0xe6, 0x1, 0xd, 0x0, 0x79, 0x54, 0x1, 0xa0, 0xc0,
+    0xa0, 0x3, 0x58, 0x80, 0x7d, 0x62, 0x1, 0xb8, 0x38, 0x3, 0x2a, 0x80, 0x3f, 0xd, 0x0, 0x62,
+    0xd3, 0x0, 0x86, 0x80, 0x3f, 0xc8, 0xc0, 0x18, 0x80, 0x36, 0x80, 0x7f, 0xe9, 0x20, 0xf, 0x9c,
+    0xc0, 0x3f, 0xf8, 0x3c, 0x1, 0xe3, 0x80, 0xf, 0xfe, 0x11, 0x90, 0x7, 0x38, 0x7, 0xff, 0xd,
+    0xc8, 0x3, 0x91, 0x80, 0x3f, 0xf8, 0x27, 0x0, 0x1f, 0x49, 0x0, 0x7f, 0xee, 0x0, 0xfe, 0xe0,
+    0xf, 0xfa, 0x48, 0x3, 0x48, 0x6, 0x37, 0x0, 0xfe, 0x56, 0x0, 0xd2, 0xca, 0x1, 0xa0, 0xc0,
+    0x3e, 0x1b, 0x0, 0xc8, 0xc1, 0x62, 0x1, 0xb8, 0x3, 0xea, 0x10, 0xd, 0x40, 0x1, 0xa0, 0xc,
+    0x52, 0x1, 0xcc, 0x80, 0x1a, 0x44, 0x2, 0x46, 0x0, 0xcc, 0x80, 0x11, 0x48, 0x6, 0x46, 0x0,
+    0xe9, 0x10, 0xd, 0x42, 0x0, 0xf0, 0xe, 0xa0, 0xf, 0xa8, 0x3, 0xd, 0x4, 0x10, 0x6, 0x91,
+    0x0, 0xf9, 0x18, 0x3, 0x23, 0x0,
+
+    /* U+0059 "Y" */
+    0x2f, 0xfe, 0x50, 0xf, 0xf2, 0x7f, 0xec, 0x2, 0x60, 0xd, 0x60, 0x1f, 0xe9, 0x0, 0xde, 0x0,
+    0x81, 0x0, 0x86, 0x0, 0x3f, 0x39, 0x0, 0x4a, 0x60, 0x1, 0x80, 0xc, 0xe4, 0x1, 0xe1, 0x80,
+    0xd, 0x60, 0x19, 0x8c, 0x3, 0x48, 0x7, 0xa0, 0x3, 0x40, 0x80, 0x77, 0x80, 0x64, 0x40, 0x6,
+    0x36, 0x0, 0x89, 0xc0, 0x3c, 0x6a, 0x1, 0xa4, 0x3, 0x78, 0x6, 0x90, 0xf, 0xd6, 0x1, 0x89,
+    0xc0, 0xc, 0x60, 0x12, 0x20, 0x3, 0xf0, 0xc0, 0x6, 0x81, 0x8, 0x0, 0xd2, 0x1, 0xfe, 0x72,
+    0x0, 0xd1, 0x1, 0x0, 0x9c, 0x80, 0x3f, 0xe9, 0x0, 0xcc, 0xe0, 0x10, 0xc0, 0x7, 0xfe, 0x44,
+    0x0, 0x7e, 0xb0, 0xf, 0xfe, 0x14, 0x80, 0x7c, 0x6a, 0x1, 0xff, 0xc2, 0x27, 0x0, 0xf7, 0x80,
+    0x7f, 0xf1, 0x20, 0x40, 0x32, 0x98, 0x7, 0xff, 0x14, 0x80, 0x36, 0x0, 0x7f, 0xff, 0xc0, 0x3f,
+    0xff, 0xe0, 0x1f, 0xfc, 0xf0,
+
+    /* U+005A "Z" */
+    0x8f, 0xff, 0xfe, 0x32, 0x80, 0x7f, 0xfb, 0xda, 0xab, 0xff, 0x10, 0x7, 0x41, 0x92, 0xaf, 0xf8,
+    0xc8, 0x3, 0x2b, 0x80, 0x7f, 0xc9, 0x20, 0x18, 0xa8, 0x3, 0xfe, 0x1a, 0x0, 0xc3, 0xe0, 0x1f,
+    0xfb, 0x4, 0x3, 0x51, 0x0, 0x7f, 0xd4, 0x40, 0x1a, 0x10, 0x3, 0xfe, 0x75, 0x0, 0xca, 0xe0,
+    0x1f, 0xf2, 0x40, 0x6, 0x3a, 0x0, 0xff, 0x8a, 0xc0, 0x30, 0xe8, 0x7, 0xfe, 0xf0, 0xe, 0xd1,
+    0x0, 0xff, 0xac, 0x80, 0x34, 0x98, 0x7, 0xfd, 0x8, 0x1, 0x99, 0x80, 0x1f, 0xf2, 0xb8, 0x6,
+    0x39, 0x0, 0xff, 0x8a, 0x80, 0x30, 0xe8, 0x7, 0xfc, 0x3e, 0x1, 0xce, 0x8a, 0xbf, 0xe4, 0xb2,
+    0x0, 0xe6, 0xaa, 0xff, 0xa1, 0x80, 0x3f, 0xfd, 0xe0,
+
+    /* U+005B "[" */
+    0x5f, 0xff, 0xca, 0x1, 0xff, 0xd7, 0x5f, 0xf9, 0x40, 0x3f, 0xff, 0xe0, 0x1f, 0xff, 0xf0, 0xf,
+    0xff, 0xfa, 0xff, 0xca, 0x1, 0xff, 0xd2,
+
+    /* U+005C "\\" */
+    0x3f, 0xfc, 0x80, 0x1f, 0xe3, 0x20, 0xb, 0x40, 0x3f, 0xe5, 0x0, 0x9c, 0x3, 0xfe, 0xa0, 0x8,
+    0x50, 0x3, 0xfc, 0x44, 0x0, 0xb4, 0x3, 0xfe, 0x50, 0x9, 0xc0, 0x3f, 0xea, 0x0, 0x85, 0x0,
+    0x3f, 0xc4, 0x40, 0xb, 0x80, 0x3f, 0xea, 0x0, 0x94, 0x3, 0xfe, 0x50, 0xc, 0xa0, 0x1f, 0xe2,
+    0x30, 0xb, 0xc0, 0x3f, 0xeb, 0x0, 0x94, 0x3, 0xfe, 0x60, 0xc, 0xa0, 0x1f, 0xe1, 0x30, 0xb,
+    0xc0, 0x3f, 0xea, 0x0, 0x94, 0x3, 0xfe, 0x70, 0xc, 0xa0, 0x1f, 0xe1, 0x30, 0xb, 0x80, 0x3f,
+    0xea, 0x0, 0x90, 0x3, 0xfe, 0x70, 0xc, 0xc0, 0x1f, 0xe1, 0x40, 0xb, 0x40, 0x3f, 0xed, 0x0,
+    0x90, 0x40, 0x3f, 0xce, 0x1, 0x9c, 0x3, 0xfc, 0x28, 0x1, 0x68, 0x7, 0xfd, 0xc0, 0x12, 0x8,
+    0x7, 0xf9, 0x40, 0x33, 0x80, 0x7f, 0xca, 0x1, 0x50, 0x7, 0xfd, 0xe0, 0x11, 0x88, 0x7, 0xf9,
+    0x40, 0x33, 0x80, 0x7f, 0xca, 0x1, 0x50, 0x7, 0xfd, 0xe0, 0x11, 0x88, 0x7, 0xf9, 0x40, 0x33,
+    0x0,
+
+    /* U+005D "]" */
+    0x8f, 0xff, 0xc4, 0x1, 0xff, 0xd2, 0x8f, 0xf8, 0x40, 0x3f, 0xff, 0xe0, 0x1f, 0xff, 0xf0, 0xf,
+    0xff, 0xfc, 0x7f, 0xc2, 0x1, 0xff, 0xd7,
+
+    /* U+005E "^" */
+    0x0, 0xf4, 0xff, 0xda, 0x1, 0xff, 0x98, 0x2, 0x23, 0x0, 0xff, 0x30, 0x7, 0x48, 0x7, 0xfa,
+    0xc0, 0x39, 0x44, 0x3, 0xf2, 0x10, 0x1, 0x0, 0x26, 0x0, 0xfd, 0xc0, 0x15, 0x10, 0x2, 0x80,
+    0x3e, 0x15, 0x0, 0x28, 0xd0, 0x0, 0x90, 0x3, 0xcc, 0x1, 0x70, 0x30, 0x5, 0xe0, 0x1e, 0x90,
+    0x1, 0x20, 0xa, 0x80, 0x10, 0x40, 0x32, 0x88, 0x2, 0x80, 0x2e, 0x0, 0xa4, 0x3, 0x70, 0x4,
+    0xc0, 0x12, 0x10, 0x1, 0x80, 0x22, 0x40, 0x2, 0x88, 0x6, 0xa0, 0x0, 0xa8, 0x2, 0x80, 0x2e,
+    0x0, 0xe6, 0x0, 0xa4, 0x0, 0xc0, 0x2, 0x40, 0xe, 0x15, 0x0, 0x19, 0x0,
+
+    /* U+005F "_" */
+    0xff, 0xff, 0xe2, 0x0, 0x7f, 0xf5, 0x0,
+
+    /* U+0060 "`" */
+    0x9, 0xff, 0xd2, 0x1, 0xd3, 0x0, 0x13, 0x38, 0x7, 0x3d, 0x0, 0x50, 0xa0, 0x1c, 0xb8, 0x20,
+    0xa, 0x30, 0xe, 0x3c, 0x20, 0x6, 0x90,
+
+    /* U+0061 "a" */
+    0x0, 0x8e, 0x2f, 0xbf, 0xec, 0x93, 0x0, 0xe4, 0xcc, 0x3a, 0x8, 0x4, 0x6d, 0x96, 0x20, 0x15,
+    0x18, 0x7, 0xf9, 0x30, 0x40, 0x12, 0x1, 0xff, 0x8a, 0x0, 0xe, 0x22, 0x6b, 0xde, 0xd9, 0x20,
+    0xc, 0xc0, 0x16, 0xf4, 0xa1, 0x9, 0x36, 0x8, 0x6, 0x40, 0x1, 0x80, 0x7c, 0x2e, 0x1, 0x8c,
+    0x2, 0x5a, 0xdf, 0xfe, 0x60, 0xd, 0xe0, 0x5b, 0x4a, 0x40, 0x1f, 0xf0, 0xe1, 0x0, 0x7f, 0xf0,
+    0x98, 0x40, 0x23, 0xcf, 0xfd, 0x0, 0x1d, 0x80, 0x1b, 0xcc, 0x3, 0xfc, 0xe0, 0x18, 0x80, 0x3b,
+    0x0, 0x39, 0xc0, 0x33, 0x0, 0x67, 0x40, 0xe, 0xd0, 0xd, 0x16, 0xf1, 0xb0, 0x1, 0xe6, 0x20,
+    0xc, 0x90, 0xe4, 0x2, 0x1, 0xef, 0x20, 0xf, 0x86, 0x80, 0x3c, 0x5b, 0x28, 0x20, 0x3, 0x7f,
+    0x60, 0xe,
+
+    /* U+0062 "b" */
+    0x57, 0x7c, 0x40, 0x1f, 0xfc, 0x2e, 0x88, 0xcc, 0x1, 0xff, 0xff, 0x0, 0xff, 0xf1, 0x36, 0x77,
+    0xfb, 0x1c, 0x40, 0x3f, 0xc7, 0xb2, 0x62, 0x0, 0x38, 0xe7, 0x0, 0xfe, 0x82, 0x0, 0xfd, 0x12,
+    0x1, 0xff, 0xc7, 0x67, 0x0, 0xfe, 0x3a, 0xca, 0x50, 0xe, 0x81, 0x0, 0xf9, 0xf1, 0x4d, 0x6a,
+    0x80, 0x1c, 0xc0, 0x1e, 0x38, 0x0, 0xe5, 0x60, 0xd, 0x60, 0x1e, 0xa0, 0xf, 0xa8, 0x3, 0x18,
+    0x7, 0x88, 0x3, 0xe3, 0x0, 0xff, 0xe9, 0x90, 0x7, 0xc6, 0x1, 0xff, 0x50, 0x7, 0xd4, 0x1,
+    0x8c, 0x3, 0xc7, 0x0, 0x1c, 0xac, 0x1, 0xac, 0x3, 0xe7, 0xc5, 0x35, 0xaa, 0x0, 0x73, 0x0,
+    0x7e, 0x3a, 0xca, 0x50, 0xe, 0x91, 0x0, 0xff, 0xe2, 0xb3, 0x0, 0x3e, 0xb1, 0x0, 0xfd, 0x32,
+    0x0, 0xfc, 0xbd, 0x6, 0x1, 0x1c, 0x73, 0x0, 0x60,
+
+    /* U+0063 "c" */
+    0x0, 0xe3, 0x9c, 0xff, 0xb6, 0x50, 0x3, 0xe2, 0xbc, 0x63, 0x0, 0x89, 0xae, 0xc2, 0x1, 0x93,
+    0x50, 0x3, 0xf9, 0x3c, 0x80, 0x5, 0x60, 0x1f, 0xf8, 0x78, 0x1, 0xe0, 0x1c, 0x95, 0x94, 0xa0,
+    0x18, 0x88, 0xa4, 0x1, 0xa6, 0xd4, 0xd6, 0xa8, 0x0, 0x8e, 0x2f, 0x0, 0xca, 0xc0, 0x1c, 0xb5,
+    0xce, 0x0, 0x70, 0xd, 0xc0, 0x1f, 0x28, 0x80, 0x44, 0x1, 0x94, 0x3, 0xff, 0xa4, 0x40, 0x19,
+    0x40, 0x3f, 0xf3, 0x80, 0x6e, 0x0, 0xf9, 0x44, 0x2, 0xe0, 0xc, 0xac, 0x1, 0xcb, 0x5c, 0xe0,
+    0x4, 0x30, 0xd, 0x36, 0xa6, 0xb5, 0x40, 0x4, 0x71, 0x7, 0x0, 0x72, 0x56, 0x52, 0x80, 0x62,
+    0x20, 0x15, 0x80, 0x7f, 0xe1, 0xe0, 0x9, 0x35, 0x0, 0x3f, 0x93, 0xc8, 0x3, 0x15, 0xe3, 0x18,
+    0x4, 0x4d, 0x76, 0x10, 0x0,
+
+    /* U+0064 "d" */
+    0x0, 0xff, 0xe0, 0x8b, 0xbe, 0x60, 0xf, 0xfe, 0x9, 0xc4, 0x6b, 0x0, 0xff, 0xff, 0x80, 0x7f,
+    0xf3, 0x5, 0xef, 0xbf, 0xd8, 0xe2, 0x1, 0xfc, 0xbf, 0x8, 0x20, 0x3, 0x8e, 0x50, 0xf, 0x9e,
+    0x84, 0x3, 0xf4, 0x0, 0x79, 0x20, 0x3, 0xff, 0x8b, 0x40, 0x1c, 0x95, 0x94, 0xa0, 0x1f, 0x28,
+    0x80, 0x68, 0xb5, 0x35, 0xaa, 0x0, 0x7b, 0xc0, 0x32, 0x38, 0x7, 0x2a, 0x80, 0x39, 0xc0, 0x37,
+    0x0, 0x7d, 0xc0, 0x1c, 0x60, 0x19, 0xc0, 0x3e, 0x50, 0xf, 0xfe, 0x61, 0x80, 0x67, 0x0, 0xf9,
+    0x40, 0x39, 0xc0, 0x37, 0x0, 0x7d, 0xc0, 0x1d, 0xe0, 0x19, 0x1c, 0x3, 0x99, 0x40, 0x39, 0x48,
+    0x3, 0x45, 0xa9, 0xad, 0x48, 0x7, 0xd2, 0x1, 0xc9, 0x59, 0x4a, 0x1, 0xf9, 0x20, 0x3, 0xff,
+    0x8c, 0xf4, 0x20, 0x1f, 0xa8, 0x40, 0x3e, 0x5e, 0x94, 0x10, 0x1, 0xbf, 0x28, 0x7,
+
+    /* U+0065 "e" */
+    0x0, 0xe4, 0xad, 0xff, 0x76, 0x38, 0x80, 0x7e, 0x3d, 0xb5, 0x20, 0x0, 0x9c, 0x74, 0x0, 0x79,
+    0x70, 0x80, 0x3f, 0x9e, 0xc0, 0x31, 0xd0, 0x7, 0x84, 0x3, 0x92, 0x40, 0x2e, 0x0, 0xc7, 0x9f,
+    0xdf, 0x20, 0x19, 0x8c, 0x14, 0x80, 0x23, 0xc3, 0x0, 0x9a, 0xc0, 0x34, 0x87, 0x80, 0x68, 0x0,
+    0xf2, 0x20, 0x2, 0x50, 0x70, 0xd, 0x7f, 0xff, 0x20, 0x6, 0x12, 0x0, 0xff, 0xe2, 0x98, 0x7,
+    0xff, 0x1c, 0x80, 0x37, 0x7f, 0xff, 0xe2, 0x70, 0xc, 0xc0, 0x1f, 0xfc, 0x1e, 0x0, 0xd0, 0x60,
+    0x1e, 0x4a, 0x0, 0xc8, 0x60, 0x1b, 0x25, 0x8, 0x89, 0x56, 0xb2, 0x1, 0xb8, 0x3, 0x9a, 0xf7,
+    0x56, 0xa0, 0x6, 0x60, 0x4, 0x56, 0x1, 0xff, 0xc1, 0xf0, 0xc, 0x9a, 0x80, 0x1f, 0xe9, 0x90,
+    0x7, 0x15, 0xe3, 0x98, 0x80, 0x5, 0x27, 0x98, 0x2,
+
+    /* U+0066 "f" */
+    0x0, 0xf3, 0xe7, 0x7f, 0xb1, 0xc4, 0x3, 0x16, 0xc1, 0x88, 0x0, 0xe0, 0xc0, 0x37, 0x90, 0x7,
+    0x88, 0x80, 0x13, 0x90, 0x7, 0xd4, 0x1, 0xa8, 0x3, 0x2e, 0xf5, 0x30, 0x6, 0x20, 0xd, 0x44,
+    0x2a, 0x20, 0x10, 0x80, 0x63, 0x0, 0xf6, 0x7f, 0x0, 0x63, 0xff, 0xc6, 0x1, 0xff, 0xd1, 0x70,
+    0xf, 0xf8, 0x42, 0xff, 0x80, 0x30, 0xff, 0xe2, 0x0, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xc0, 0x3f,
+    0xfa, 0xa0,
+
+    /* U+0067 "g" */
+    0x0, 0xc2, 0xf9, 0xdf, 0xec, 0x82, 0xa, 0xff, 0xc2, 0x1, 0x47, 0x41, 0x88, 0x0, 0xdf, 0x58,
+    0x3, 0xf5, 0xb8, 0x7, 0xf4, 0xa8, 0x7, 0xa5, 0x0, 0x3f, 0xf8, 0xa6, 0xc0, 0x1c, 0xb5, 0x96,
+    0xe2, 0x1, 0xf5, 0x0, 0x76, 0x52, 0x9a, 0x47, 0x90, 0x7, 0x90, 0x3, 0x41, 0x80, 0x70, 0xf0,
+    0x7, 0x88, 0x3, 0x28, 0x7, 0xc6, 0x20, 0x1f, 0xe3, 0x0, 0xff, 0xe1, 0x10, 0x6, 0x40, 0xf,
+    0x88, 0x40, 0x39, 0xc0, 0x35, 0x88, 0x7, 0xa4, 0x3, 0xdc, 0x1, 0x87, 0xd8, 0x40, 0x57, 0x10,
+    0x3, 0xc8, 0x80, 0xc, 0x33, 0xdf, 0xd4, 0x60, 0x1f, 0xa8, 0x80, 0x3f, 0xf8, 0xc3, 0x88, 0x1,
+    0xfc, 0xa0, 0x1c, 0x20, 0x1, 0xbb, 0x20, 0x7, 0x1d, 0xd0, 0x7, 0xf9, 0x2f, 0xf7, 0x37, 0xf1,
+    0x4, 0x3, 0xff, 0x82, 0x46, 0x40, 0x13, 0x80, 0x63, 0x0, 0x9f, 0x4c, 0x3, 0xe2, 0x80, 0xc,
+    0x80, 0x14, 0x96, 0x61, 0xd0, 0x88, 0x91, 0xa2, 0x1, 0xa8, 0x1, 0x2, 0x0, 0x38, 0xbd, 0xd5,
+    0xb8, 0x7, 0x31, 0x0, 0x14, 0x3, 0xff, 0x84, 0x92, 0x1, 0x63, 0x80, 0x7f, 0xe7, 0xb0, 0xc,
+    0x31, 0xf4, 0xc6, 0x20, 0x11, 0x24, 0xf4, 0x0, 0x60,
+
+    /* U+0068 "h" */
+    0x57, 0x7c, 0x40, 0x1f, 0xfb, 0xa2, 0x33, 0x0, 0x7f, 0xff, 0xc0, 0x3f, 0xfa, 0xcb, 0x7d, 0xfe,
+    0xd8, 0x20, 0xf, 0xc7, 0x94, 0x82, 0x0, 0x27, 0xd6, 0x0, 0xfa, 0xc, 0x3, 0xf4, 0xa8, 0x7,
+    0xff, 0x16, 0x84, 0x3, 0xe2, 0x78, 0x60, 0xf, 0x38, 0x7, 0x9b, 0x61, 0xe7, 0x84, 0x3, 0x60,
+    0x7, 0x14, 0x80, 0x61, 0x80, 0xc, 0xe0, 0x1d, 0x40, 0x1e, 0x40, 0xc, 0x60, 0x1c, 0x40, 0x1e,
+    0x30, 0xf, 0xf0, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1e,
+
+    /* U+0069 "i" */
+    0x2, 0xbf, 0xe9, 0x0, 0x62, 0x0, 0xb4, 0xa0, 0x80, 0x64, 0x70, 0xe, 0x13, 0x30, 0x6, 0x90,
+    0xc8, 0x45, 0xb5, 0x0, 0x3d, 0xd2, 0x0, 0x7f, 0x5f, 0xfe, 0x40, 0xf, 0xff, 0xf8, 0x7, 0xff,
+    0x80,
+
+    /* U+006A "j" */
+    0x0, 0xf3, 0x55, 0xb0, 0x7, 0xd1, 0x2a, 0x93, 0x40, 0x1e, 0x70, 0xc, 0xa2, 0x1, 0xff, 0xc5,
+    0x40, 0xc, 0x82, 0x1, 0xd4, 0xa0, 0x5, 0xa0, 0xf, 0xd, 0x7f, 0xa8, 0x40, 0x3f, 0xfa, 0x4f,
+    0xff, 0xa0, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xff, 0x0, 0xff, 0xf8, 0x68, 0x6, 0xf0, 0x3, 0x18,
+    0xb2, 0x80, 0x63, 0x1, 0x9c, 0xe9, 0x0, 0xc2, 0x80, 0xe0, 0x1f, 0xa0, 0x1, 0x40, 0x1f, 0x3b,
+    0x0, 0x21, 0x44, 0x0, 0x2b, 0x90, 0x1,
+
+    /* U+006B "k" */
+    0x57, 0x7c, 0x40, 0x1f, 0xfc, 0x2e, 0x88, 0xcc, 0x1, 0xff, 0xff, 0x0, 0xff, 0xf3, 0xe, 0xff,
+    0xee, 0x20, 0xf, 0xf8, 0x70, 0x80, 0x36, 0x90, 0x7, 0xf8, 0x70, 0x80, 0x36, 0x18, 0x7, 0xf8,
+    0x70, 0x80, 0x35, 0x98, 0x7, 0xf8, 0x70, 0x80, 0x35, 0x20, 0x7, 0xf8, 0x70, 0x80, 0x35, 0x28,
+    0x7, 0xf8, 0xb0, 0x80, 0x34, 0xa8, 0x7, 0xfd, 0x24, 0x1, 0x99, 0x80, 0x1f, 0xfc, 0x67, 0x10,
+    0xf, 0xfe, 0x30, 0xe8, 0x7, 0xff, 0x1c, 0xe0, 0x3, 0xff, 0x83, 0x64, 0x1, 0x9d, 0x0, 0x3f,
+    0xec, 0x4f, 0x0, 0xea, 0x10, 0xf, 0xe9, 0x30, 0x2a, 0x0, 0xc3, 0xa0, 0x1f, 0xc4, 0x1, 0x2b,
+    0x80, 0x63, 0x80, 0xf, 0xfe, 0xc, 0x18, 0x6, 0x75, 0x0, 0xff, 0xe0, 0xe8, 0x80, 0x6b, 0x20,
+    0xf, 0xfc, 0x34, 0x1, 0x87, 0x80,
+
+    /* U+006C "l" */
+    0x57, 0x7c, 0x5d, 0x11, 0x98, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xf3,
+
+    /* U+006D "m" */
+    0xbf, 0xfc, 0x20, 0xf9, 0xdf, 0xd6, 0xc0, 0x18, 0x63, 0x3f, 0xdd, 0x6c, 0x1, 0xfc, 0xbd, 0x6,
+    0x20, 0x29, 0x3a, 0x20, 0xdc, 0xe6, 0x0, 0x14, 0x9c, 0x10, 0xf, 0xac, 0x40, 0x3e, 0x2c, 0x89,
+    0x0, 0xfc, 0x78, 0x1, 0xff, 0xc5, 0x27, 0x0, 0xff, 0x14, 0x0, 0x7e, 0x37, 0x83, 0x0, 0xfc,
+    0x6f, 0x8, 0x1, 0xcc, 0x1, 0xf4, 0x64, 0x3e, 0x38, 0x7, 0x9f, 0x21, 0xee, 0x0, 0x30, 0x90,
+    0x7, 0x1b, 0x80, 0x68, 0x0, 0xe2, 0x80, 0xc, 0xe2, 0x1, 0x9c, 0x3, 0xac, 0x3, 0xc8, 0x1,
+    0xa8, 0x3, 0xc8, 0x1, 0x8c, 0x3, 0x88, 0x3, 0xc2, 0x1, 0x88, 0x3, 0xc6, 0x1, 0xfe, 0x10,
+    0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xdb,
+
+    /* U+006E "n" */
+    0xbf, 0xfc, 0x20, 0xb7, 0xdf, 0xed, 0x82, 0x0, 0xfc, 0x5b, 0x48, 0x20, 0x2, 0x7d, 0x60, 0xf,
+    0xb0, 0x80, 0x3f, 0x4a, 0x80, 0x7f, 0xf1, 0x68, 0x40, 0x3e, 0x27, 0x86, 0x0, 0xf3, 0x80, 0x79,
+    0xb6, 0x1e, 0x78, 0x40, 0x36, 0x0, 0x71, 0x48, 0x6, 0x18, 0x0, 0xce, 0x1, 0xd4, 0x1, 0xe4,
+    0x0, 0xc6, 0x1, 0xc4, 0x1, 0xe3, 0x0, 0xff, 0x8, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe, 0x1,
+    0xe0,
+
+    /* U+006F "o" */
+    0x0, 0xe4, 0x9d, 0xff, 0xb6, 0x4c, 0x3, 0xf1, 0x65, 0xb1, 0x0, 0x44, 0xd9, 0x64, 0x1, 0xc9,
+    0xa6, 0x1, 0xfc, 0x9a, 0x80, 0x11, 0x58, 0x7, 0xff, 0x6, 0xc8, 0x1, 0xe0, 0x1c, 0x95, 0x94,
+    0x80, 0x1d, 0xc0, 0xa4, 0x1, 0xa6, 0xd4, 0xd6, 0xe4, 0x3, 0x1a, 0x78, 0x6, 0x56, 0x0, 0xe6,
+    0x50, 0xd, 0xce, 0x1, 0xb8, 0x3, 0xee, 0x0, 0xce, 0x40, 0x19, 0x40, 0x3e, 0x60, 0xc, 0x60,
+    0x1f, 0xfc, 0x72, 0x0, 0xca, 0x1, 0xf3, 0x80, 0x63, 0x70, 0xd, 0xc0, 0x1f, 0x70, 0x6, 0x4e,
+    0x0, 0xca, 0xc0, 0x1c, 0xc8, 0x1, 0xb5, 0xc, 0x3, 0x4d, 0xa9, 0xad, 0xc8, 0x6, 0x34, 0xe,
+    0x0, 0xe4, 0xac, 0xa4, 0x0, 0xee, 0x0, 0x15, 0x80, 0x7f, 0xe1, 0xc2, 0x0, 0x93, 0x50, 0x3,
+    0xf9, 0x30, 0xc0, 0x38, 0xaf, 0x18, 0x80, 0x22, 0x6c, 0xb2, 0x0, 0x80,
+
+    /* U+0070 "p" */
+    0xbf, 0xfc, 0x22, 0x7c, 0xff, 0xb1, 0xc4, 0x3, 0xfc, 0x9f, 0x6, 0x1, 0x1c, 0x73, 0x0, 0x7f,
+    0x50, 0x80, 0x7e, 0x99, 0x0, 0x7f, 0xf1, 0xd9, 0x80, 0x1f, 0xc7, 0x59, 0x4a, 0x1, 0xd2, 0x20,
+    0x1f, 0x3e, 0x29, 0xad, 0x50, 0x3, 0x98, 0x3, 0xc7, 0x0, 0x1c, 0xac, 0x1, 0xac, 0x3, 0xd4,
+    0x1, 0xf5, 0x0, 0x63, 0x0, 0xf1, 0x0, 0x7c, 0x60, 0x1f, 0xfd, 0x32, 0x0, 0xf8, 0xc0, 0x3f,
+    0xea, 0x0, 0xfa, 0x80, 0x31, 0x80, 0x78, 0xe0, 0x3, 0x95, 0x80, 0x35, 0x80, 0x7c, 0xf8, 0xa6,
+    0xb5, 0x40, 0xe, 0x60, 0xf, 0xc7, 0x59, 0x4a, 0x1, 0xd2, 0x20, 0x1f, 0xfc, 0x56, 0x60, 0x7,
+    0xd0, 0x40, 0x1f, 0xa2, 0x40, 0x3f, 0x1e, 0xc9, 0x88, 0x0, 0xe3, 0x9c, 0x3, 0xfe, 0x6c, 0xef,
+    0xf6, 0x38, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xfa, 0x40,
+
+    /* U+0071 "q" */
+    0x0, 0xc2, 0xf9, 0xdf, 0xec, 0x81, 0xf, 0xfd, 0x80, 0x12, 0xf4, 0x18, 0x80, 0xd, 0xf9, 0x0,
+    0x3e, 0x8a, 0x0, 0xfe, 0xb0, 0xf, 0x2b, 0x80, 0x7f, 0xf1, 0x6c, 0x3, 0x92, 0xb2, 0x90, 0x3,
+    0xe6, 0x10, 0xd, 0x36, 0xa6, 0xb7, 0x20, 0x1e, 0xd0, 0xc, 0xac, 0x1, 0xcc, 0x80, 0x1c, 0xc0,
+    0x1b, 0x80, 0x3e, 0xe0, 0xe, 0x20, 0xc, 0xa0, 0x1f, 0x38, 0x7, 0xff, 0x30, 0x40, 0x32, 0x80,
+    0x7c, 0xe0, 0x1c, 0xa0, 0x1b, 0x80, 0x3e, 0xe0, 0xe, 0xd0, 0xc, 0xac, 0x1, 0xcc, 0x80, 0x1c,
+    0xc2, 0x1, 0xa6, 0xd4, 0xd6, 0xe4, 0x3, 0xeb, 0x0, 0xe4, 0xac, 0xa4, 0x0, 0xfc, 0xae, 0x1,
+    0xff, 0xc6, 0x89, 0x0, 0xfc, 0x30, 0x1, 0xf9, 0xba, 0xc, 0x40, 0x7, 0x1e, 0x80, 0x1f, 0xc2,
+    0xf9, 0xdf, 0xec, 0x71, 0x0, 0xff, 0xff, 0x80, 0x7f, 0xf3, 0x80,
+
+    /* U+0072 "r" */
+    0xbf, 0xfc, 0x20, 0xb5, 0xde, 0x1, 0xc7, 0x94, 0xa2, 0x1, 0xec, 0x30, 0xf, 0xe1, 0x0, 0xff,
+    0xe0, 0x8a, 0x20, 0x3, 0xc3, 0x7d, 0x76, 0x0, 0xf6, 0x20, 0x7, 0xe6, 0x20, 0xf, 0xef, 0x0,
+    0xff, 0x10, 0x7, 0xff, 0xfc, 0x3, 0xff, 0x8c,
+
+    /* U+0073 "s" */
+    0x0, 0xc5, 0x19, 0xdf, 0xee, 0xca, 0x61, 0x0, 0xea, 0xd7, 0x31, 0x0, 0x9, 0xac, 0xf2, 0x80,
+    0x58, 0xa0, 0x1f, 0xf3, 0x0, 0x1c, 0xc0, 0x38, 0x44, 0x1, 0x8c, 0xc0, 0xb, 0x0, 0xd1, 0xfd,
+    0xcf, 0xd8, 0x18, 0x0, 0x88, 0x2, 0x27, 0x0, 0xc4, 0xfc, 0x80, 0x11, 0x80, 0x44, 0xe2, 0x1,
+    0xfe, 0x40, 0xd, 0x1d, 0xcb, 0x95, 0x10, 0xe, 0xb1, 0x0, 0xe1, 0x46, 0xae, 0xb3, 0x0, 0x8b,
+    0x10, 0x3, 0xf9, 0x30, 0xc0, 0x22, 0xbd, 0x85, 0x20, 0xf, 0xb8, 0x3, 0x89, 0xeb, 0x7f, 0x64,
+    0x3, 0x11, 0x0, 0xa, 0x1, 0xe2, 0x66, 0x0, 0x61, 0x3, 0xae, 0x84, 0x0, 0xc6, 0xe0, 0x18,
+    0x82, 0x40, 0x5e, 0xff, 0xb9, 0xf8, 0x20, 0x11, 0x88, 0x94, 0x3, 0x84, 0x40, 0x1c, 0x3c, 0x0,
+    0x60, 0xf, 0xf8, 0xf0, 0x80, 0x67, 0xa9, 0x8c, 0x40, 0x2, 0x6d, 0x78, 0x40, 0x0,
+
+    /* U+0074 "t" */
+    0x0, 0xf, 0xfe, 0xe0, 0xf, 0xff, 0x26, 0x7f, 0x0, 0x61, 0xff, 0xc6, 0x1, 0xff, 0xd1, 0x70,
+    0xf, 0xf8, 0x42, 0xff, 0x80, 0x30, 0xff, 0xe2, 0x0, 0xff, 0xff, 0x80, 0x7f, 0xf3, 0x84, 0x3,
+    0x8, 0x80, 0x3f, 0x8, 0x6, 0xa2, 0x23, 0x10, 0x6, 0x70, 0xc, 0x9b, 0xa9, 0xa0, 0xd, 0x60,
+    0x1f, 0x98, 0x3, 0x15, 0x80, 0x7c, 0x28, 0x1, 0x93, 0x9c, 0x80, 0x2, 0x92, 0x80,
+
+    /* U+0075 "u" */
+    0xcf, 0xfc, 0x60, 0x1e, 0x5f, 0xfd, 0x40, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8, 0x7, 0x8c, 0x3,
+    0xfc, 0xe0, 0x1e, 0xe0, 0xe, 0x70, 0xd, 0x80, 0x1e, 0x60, 0xe, 0x30, 0xc, 0xe6, 0x1, 0xa4,
+    0x40, 0x3b, 0x0, 0x3b, 0x29, 0xe3, 0x58, 0x3, 0xc8, 0x40, 0x1c, 0xb0, 0xe4, 0x1, 0xfb, 0x80,
+    0x3f, 0xf8, 0xa7, 0x62, 0x1, 0xf1, 0x58, 0x7, 0xc9, 0xf0, 0x62, 0x2, 0x93, 0xaa, 0x1, 0xc0,
+
+    /* U+0076 "v" */
+    0x1f, 0xfe, 0x10, 0xf, 0xd3, 0xff, 0x8c, 0x54, 0x3, 0x30, 0x7, 0xe6, 0x0, 0x8c, 0xc1, 0xc0,
+    0x1a, 0x80, 0x3e, 0x60, 0xd, 0x40, 0x4, 0x20, 0x8, 0x90, 0x3, 0xd6, 0x1, 0x98, 0x2, 0xa0,
+    0xd, 0xc0, 0x1c, 0x64, 0x1, 0x30, 0x6, 0x60, 0xc, 0xa2, 0x1, 0xa8, 0x3, 0x58, 0x6, 0x15,
+    0x0, 0xce, 0x1, 0xb, 0x0, 0x46, 0x40, 0x1d, 0x20, 0x1a, 0x80, 0x27, 0x0, 0xd2, 0x1, 0xe3,
+    0x20, 0x8, 0xcc, 0x0, 0xb0, 0x8, 0x54, 0x3, 0xea, 0x0, 0xd4, 0x6, 0x40, 0x13, 0x0, 0x7e,
+    0x60, 0xc, 0xe1, 0x20, 0x1a, 0x80, 0x3f, 0xa, 0x80, 0x42, 0xca, 0x1, 0x19, 0x0, 0x7f, 0x48,
+    0x6, 0x90, 0xd, 0x20, 0x1f, 0xe3, 0x20, 0xf, 0x85, 0x40, 0x3f, 0xea, 0x0, 0xf9, 0x80, 0x3f,
+    0xf3, 0x0, 0x7d, 0x40, 0x1f, 0xf8, 0x54, 0x3, 0x90, 0x80, 0x3f, 0xf8, 0x32, 0x1, 0xdc, 0x1,
+    0xf0,
+
+    /* U+0077 "w" */
+    0xcf, 0xfb, 0x80, 0x3e, 0x2f, 0xfc, 0xc0, 0x1f, 0x57, 0xfd, 0x96, 0x1, 0x9, 0x80, 0x79, 0x40,
+    0x35, 0x0, 0x7c, 0xa0, 0x15, 0x30, 0x6, 0xa0, 0xf, 0x50, 0x6, 0x31, 0x0, 0xe5, 0x0, 0xce,
+    0x26, 0x1, 0x38, 0x7, 0x19, 0x0, 0x73, 0x80, 0x77, 0x80, 0x48, 0x21, 0x40, 0x10, 0x98, 0x6,
+    0xb0, 0xf, 0x50, 0x7, 0x28, 0x5, 0xa0, 0x7, 0x0, 0xd4, 0x1, 0x98, 0x3, 0xc6, 0x20, 0x12,
+    0x80, 0x67, 0x0, 0xa, 0x0, 0x4e, 0x1, 0x18, 0x80, 0x7c, 0xc0, 0x17, 0x0, 0x48, 0x20, 0x16,
+    0x80, 0x42, 0x60, 0xa, 0x0, 0x8d, 0x0, 0x2b, 0x0, 0xa, 0x0, 0x5c, 0x1, 0x9c, 0x3, 0x50,
+    0x1, 0xc0, 0x2a, 0xd0, 0x8, 0xc4, 0x1c, 0x3, 0x28, 0x6, 0x14, 0x0, 0x9c, 0x10, 0x40, 0x27,
+    0x70, 0x6, 0x60, 0xd0, 0x9, 0x40, 0x3d, 0xc0, 0x10, 0x9e, 0x80, 0x48, 0x22, 0x40, 0xa, 0xc5,
+    0x0, 0x2f, 0x0, 0xf2, 0x80, 0x6a, 0x60, 0xb, 0x80, 0x1c, 0x1, 0x1c, 0x80, 0x65, 0x0, 0xf9,
+    0x40, 0x26, 0x0, 0xca, 0x0, 0x50, 0xc, 0xe0, 0x13, 0x0, 0x7e, 0xf0, 0xf, 0x94, 0x3, 0x28,
+    0x7, 0xda, 0x1, 0xf9, 0x40, 0x3e, 0xe0, 0xd, 0xe0, 0x1e, 0x14, 0x0, 0xfe, 0x50, 0xe, 0x14,
+    0x0, 0xca, 0x1, 0xe7, 0x0, 0xff, 0x70, 0x7, 0x38, 0x7, 0x94, 0x3, 0xa8, 0x3, 0xfc, 0x82,
+    0x1, 0xa8, 0x3, 0xdc, 0x1, 0x84, 0xc0, 0x38,
+
+    /* U+0078 "x" */
+    0x4f, 0xfe, 0x40, 0xe, 0x1e, 0xff, 0xc8, 0x86, 0x0, 0xd4, 0x20, 0x1a, 0x84, 0x2, 0x64, 0x9,
+    0x20, 0x8, 0x6c, 0x2, 0x74, 0x0, 0x8e, 0x40, 0x2f, 0x0, 0xca, 0xc0, 0x70, 0x1, 0xb8, 0x3,
+    0x14, 0x80, 0x69, 0x2e, 0x0, 0xd2, 0x40, 0x1c, 0xc8, 0x1, 0xb4, 0x80, 0x25, 0x60, 0xf, 0xa8,
+    0x40, 0x3e, 0x2a, 0x0, 0xfc, 0x34, 0x1, 0xf7, 0x0, 0x7f, 0x91, 0xc0, 0x3a, 0xc, 0x3, 0xfe,
+    0x20, 0xe, 0xc0, 0xf, 0xf9, 0x94, 0x3, 0x91, 0xc0, 0x3f, 0x8a, 0x40, 0x3e, 0x83, 0x0, 0xfd,
+    0xe0, 0x18, 0xc0, 0x37, 0x0, 0x7d, 0x24, 0x1, 0x26, 0x18, 0x4, 0x54, 0x1, 0xca, 0xc0, 0x10,
+    0xd0, 0x70, 0x6, 0x56, 0x0, 0x86, 0xc0, 0x35, 0x88, 0x14, 0x0, 0x69, 0x20, 0x6, 0x88, 0x4,
+    0xaa, 0x0, 0x9c, 0xc0, 0x37, 0x4, 0x18, 0x4, 0x54, 0x1, 0xdc, 0x1, 0x8e, 0x0,
+
+    /* U+0079 "y" */
+    0x1f, 0xfe, 0x10, 0xf, 0xd3, 0xff, 0x88, 0x58, 0x3, 0x48, 0x7, 0xc2, 0xc0, 0x11, 0x90, 0x50,
+    0x6, 0x60, 0xf, 0x98, 0x3, 0x48, 0x0, 0xcc, 0x1, 0xa, 0x80, 0x7a, 0x80, 0x21, 0x50, 0xa,
+    0x40, 0x37, 0x0, 0x72, 0x10, 0x4, 0xc0, 0x19, 0x44, 0x2, 0x42, 0x0, 0xdc, 0x1, 0xa4, 0x3,
+    0x98, 0x3, 0x50, 0x4, 0x2a, 0x1, 0x28, 0x80, 0x74, 0x80, 0x66, 0x0, 0x98, 0x3, 0x48, 0x7,
+    0x85, 0x40, 0x21, 0x50, 0x4, 0x80, 0x44, 0x60, 0x1f, 0x48, 0x6, 0x90, 0x51, 0x0, 0xac, 0x3,
+    0xf1, 0x98, 0x2, 0x33, 0x70, 0x6, 0x60, 0xf, 0xea, 0x0, 0xd0, 0x80, 0x13, 0x80, 0x7f, 0x98,
+    0x40, 0x24, 0x0, 0xd4, 0x1, 0xff, 0x30, 0x7, 0xc8, 0x40, 0x1f, 0xf5, 0x0, 0x7d, 0xe0, 0x1f,
+    0xf8, 0x90, 0x3, 0x89, 0x0, 0x3f, 0xf8, 0x3e, 0x1, 0xd4, 0x1, 0xff, 0xc2, 0x41, 0x0, 0xcc,
+    0x1, 0xff, 0xc2, 0x41, 0x0, 0x98, 0x40, 0x3f, 0xb6, 0x50, 0x9a, 0xc0, 0x35, 0x0, 0x7f, 0x31,
+    0x35, 0xec, 0x80, 0x65, 0x30, 0xf, 0xeb, 0x0, 0xfc, 0x36, 0x1, 0xfc, 0x26, 0x1, 0xf1, 0x60,
+    0x80, 0x7f, 0xf, 0x41, 0x88, 0x9, 0xc6, 0x90, 0x7, 0xf8,
+
+    /* U+007A "z" */
+    0xaf, 0xff, 0xfe, 0x11, 0x80, 0x7f, 0xf8, 0x88, 0xeb, 0xff, 0xe7, 0x0, 0xc3, 0xe0, 0x1f, 0x95,
+    0xc0, 0x35, 0x10, 0x7, 0xc5, 0x40, 0x1a, 0x10, 0x3, 0xe1, 0xf0, 0xc, 0xae, 0x1, 0xfa, 0x88,
+    0x2, 0x3a, 0x0, 0xfd, 0x8, 0x1, 0xe, 0x80, 0x7e, 0x57, 0x0, 0xd4, 0x20, 0x1f, 0x15, 0x0,
+    0x68, 0x40, 0xf, 0x87, 0xc0, 0x32, 0xb8, 0x7, 0xea, 0x20, 0x8, 0xe8, 0x3, 0xf4, 0x20, 0x6,
+    0x3f, 0xff, 0xce, 0xc0, 0x1f, 0xfe, 0x30,
+
+    /* U+007B "{" */
+    0x0, 0xe2, 0x9d, 0xff, 0x80, 0x39, 0x35, 0x88, 0x3, 0xe1, 0xb0, 0xf, 0xf3, 0x0, 0x7f, 0xd8,
+    0x1, 0x8b, 0x3c, 0x3, 0x30, 0x6, 0x93, 0x0, 0xe3, 0x0, 0xcc, 0x1, 0xff, 0xfb, 0x30, 0xe,
+    0x41, 0x0, 0xc2, 0x1, 0x2f, 0xd8, 0x6, 0x40, 0xf, 0xf2, 0x50, 0x7, 0xf9, 0x8c, 0x3, 0xfc,
+    0x5c, 0x1, 0x97, 0xec, 0x3, 0x18, 0x7, 0x90, 0x40, 0x30, 0x80, 0x7f, 0xc6, 0x1, 0xff, 0xea,
+    0x30, 0xc, 0xc0, 0x1e, 0x10, 0xd, 0x4, 0x1, 0xc8, 0x1, 0x8f, 0x7c, 0x3, 0x50, 0x7, 0xfc,
+    0x54, 0x1, 0xff, 0x2e, 0xb1, 0x0, 0x60,
+
+    /* U+007C "|" */
+    0x4d, 0xdc, 0x62, 0x45, 0x80, 0x3f, 0xff, 0xe0, 0x1f, 0xff, 0xf0, 0xf, 0xfe, 0x68,
+
+    /* U+007D "}" */
+    0x8f, 0xf7, 0x5b, 0x0, 0x7e, 0x14, 0x9b, 0x0, 0xff, 0x24, 0x0, 0x7f, 0x9c, 0x2, 0x8e, 0x80,
+    0xe, 0x40, 0x8, 0x5c, 0xc0, 0x30, 0x80, 0x72, 0x80, 0x63, 0x0, 0xff, 0xfd, 0xf0, 0x6, 0xa1,
+    0x0, 0xca, 0x1, 0x8f, 0xb4, 0x2, 0x2a, 0x10, 0xf, 0xe2, 0x10, 0xf, 0xc9, 0x0, 0x1f, 0xd8,
+    0x1, 0x93, 0xf4, 0x2, 0x10, 0xd, 0xa0, 0x1f, 0xff, 0x2, 0x0, 0xfe, 0x64, 0x0, 0xc4, 0x0,
+    0x8f, 0x90, 0xe, 0x50, 0xf, 0xe5, 0x10, 0xf, 0xc7, 0x60, 0x1e, 0x13, 0x9c, 0x10, 0x8,
+
+    /* U+007E "~" */
+    0x0, 0x92, 0xae, 0x4c, 0x3, 0x8d, 0x98, 0x60, 0xa, 0xb5, 0x46, 0xc8, 0x0, 0xd3, 0x35, 0x83,
+    0x28, 0x7, 0x3e, 0x8, 0x12, 0x80, 0x38, 0x20, 0x3, 0xe3, 0xec, 0xd0, 0x9, 0x8, 0x40, 0xf,
+    0xf8, 0x40, 0x11, 0x80, 0x46, 0x4e, 0x0, 0x18, 0x3, 0xc4, 0x0, 0xe1, 0xe0, 0x14, 0x43, 0x0,
+    0x43, 0x74, 0x60, 0x5, 0xc2, 0x0,
+
+    /* U+00C0 "À" */
+    0x0, 0xf0, 0xbc, 0x44, 0xe0, 0x1f, 0xfc, 0x81, 0x37, 0x7a, 0x30, 0x3, 0xff, 0x90, 0x9a, 0x40,
+    0x3, 0xb0, 0xf, 0xfe, 0x41, 0x6a, 0x80, 0x12, 0xc0, 0x3f, 0xf9, 0x35, 0x20, 0x4, 0xa0, 0xf,
+    0xfe, 0x4b, 0x7f, 0xd4, 0x1, 0xff, 0xe2, 0x8f, 0xfe, 0x10, 0xf, 0xfe, 0x3b, 0x0, 0x73, 0x0,
+    0x7f, 0xf1, 0x98, 0x40, 0x3a, 0x40, 0x3f, 0xf8, 0xd6, 0x1, 0xe1, 0x50, 0xf, 0xfe, 0x22, 0x10,
+    0x7, 0xd2, 0x1, 0xff, 0xc4, 0xf0, 0xc, 0x60, 0x11, 0x98, 0x3, 0xff, 0x84, 0x48, 0x1, 0x24,
+    0x0, 0x69, 0x0, 0xff, 0xe1, 0x50, 0x6, 0xf4, 0x20, 0x9, 0x44, 0x3, 0xff, 0x82, 0xe0, 0x10,
+    0xa0, 0x50, 0x6, 0x90, 0xf, 0xfc, 0xc0, 0x1a, 0x40, 0xc, 0x1, 0x98, 0x3, 0xff, 0x58, 0x6,
+    0x60, 0x0, 0xa8, 0x4, 0x2c, 0x1, 0xfe, 0x42, 0x0, 0x94, 0x40, 0x29, 0x0, 0xd6, 0x1, 0xfe,
+    0xf0, 0xd, 0xc0, 0x18, 0xc8, 0x2, 0x24, 0x0, 0xfc, 0x48, 0x1, 0x12, 0x0, 0x75, 0x0, 0x6f,
+    0x0, 0xfd, 0x60, 0x18, 0xbf, 0xfd, 0x0, 0x19, 0x8, 0x3, 0xc2, 0xc0, 0x1f, 0xfc, 0x5a, 0x0,
+    0xf3, 0x0, 0x7f, 0xf1, 0x9c, 0x3, 0xd2, 0x1, 0xff, 0xc7, 0x70, 0xc, 0xa2, 0x1, 0x17, 0xff,
+    0xfa, 0x0, 0x35, 0x0, 0x69, 0x0, 0xd4, 0x1, 0xfe, 0x60, 0xc, 0x48, 0x0, 0x33, 0x0, 0x66,
+    0x0, 0xff, 0xb, 0x0, 0x6f, 0x0, 0x48, 0x6, 0x51, 0x0, 0xff, 0xa8, 0x3, 0x21, 0xa, 0x80,
+    0x69, 0x0, 0xff, 0xc6, 0x40, 0x1a, 0xc0,
+
+    /* U+00C1 "Á" */
+    0x0, 0xff, 0xe1, 0x24, 0x46, 0x50, 0xf, 0xfe, 0x3a, 0xdb, 0xbc, 0x68, 0x1, 0xff, 0xc6, 0x4a,
+    0x0, 0xa2, 0xc4, 0x3, 0xff, 0x8a, 0x96, 0x0, 0x1b, 0x70, 0xf, 0xfe, 0x31, 0xd8, 0x0, 0xfd,
+    0x0, 0x3f, 0xf8, 0xe7, 0xff, 0x60, 0x80, 0x7f, 0xf8, 0xa3, 0xff, 0x84, 0x3, 0xff, 0x8e, 0xc0,
+    0x1c, 0xc0, 0x1f, 0xfc, 0x66, 0x10, 0xe, 0x90, 0xf, 0xfe, 0x35, 0x80, 0x78, 0x54, 0x3, 0xff,
+    0x88, 0x84, 0x1, 0xf4, 0x80, 0x7f, 0xf1, 0x3c, 0x3, 0x18, 0x4, 0x66, 0x0, 0xff, 0xe1, 0x12,
+    0x0, 0x49, 0x0, 0x1a, 0x40, 0x3f, 0xf8, 0x54, 0x1, 0xbd, 0x8, 0x2, 0x51, 0x0, 0xff, 0xe0,
+    0xb8, 0x4, 0x28, 0x14, 0x1, 0xa4, 0x3, 0xff, 0x30, 0x6, 0x90, 0x3, 0x0, 0x66, 0x0, 0xff,
+    0xd6, 0x1, 0x98, 0x0, 0x2a, 0x1, 0xb, 0x0, 0x7f, 0x90, 0x80, 0x25, 0x10, 0xa, 0x40, 0x35,
+    0x80, 0x7f, 0xbc, 0x3, 0x70, 0x6, 0x32, 0x0, 0x89, 0x0, 0x3f, 0x12, 0x0, 0x44, 0x80, 0x1d,
+    0x40, 0x1b, 0xc0, 0x3f, 0x58, 0x6, 0x2f, 0xff, 0x40, 0x6, 0x42, 0x0, 0xf0, 0xb0, 0x7, 0xff,
+    0x16, 0x80, 0x3c, 0xc0, 0x1f, 0xfc, 0x67, 0x0, 0xf4, 0x80, 0x7f, 0xf1, 0xdc, 0x3, 0x28, 0x80,
+    0x45, 0xff, 0xfe, 0x80, 0xd, 0x40, 0x1a, 0x40, 0x35, 0x0, 0x7f, 0x98, 0x3, 0x12, 0x0, 0xc,
+    0xc0, 0x19, 0x80, 0x3f, 0xc2, 0xc0, 0x1b, 0xc0, 0x12, 0x1, 0x94, 0x40, 0x3f, 0xea, 0x0, 0xc8,
+    0x42, 0xa0, 0x1a, 0x40, 0x3f, 0xf1, 0x90, 0x6, 0xb0,
+
+    /* U+00C2 "Â" */
+    0x0, 0xff, 0xc, 0x46, 0x50, 0xf, 0xfe, 0x38, 0xe3, 0xbe, 0xa6, 0x0, 0xff, 0xe3, 0x69, 0x0,
+    0x10, 0x1, 0x2a, 0x1, 0xff, 0xc4, 0xb3, 0x1, 0xcb, 0x60, 0x5, 0x20, 0x7, 0xff, 0xa, 0xd0,
+    0x7, 0xc, 0x25, 0xc0, 0x16, 0x80, 0x1f, 0xfc, 0x1b, 0xff, 0x71, 0x0, 0x51, 0xff, 0x20, 0x7,
+    0xff, 0x7a, 0x3f, 0xf8, 0x40, 0x3f, 0xf8, 0xec, 0x1, 0xcc, 0x1, 0xff, 0xc6, 0x61, 0x0, 0xe9,
+    0x0, 0xff, 0xe3, 0x58, 0x7, 0x85, 0x40, 0x3f, 0xf8, 0x88, 0x40, 0x1f, 0x48, 0x7, 0xff, 0x13,
+    0xc0, 0x31, 0x80, 0x46, 0x60, 0xf, 0xfe, 0x11, 0x20, 0x4, 0x90, 0x1, 0xa4, 0x3, 0xff, 0x85,
+    0x40, 0x1b, 0xd0, 0x80, 0x25, 0x10, 0xf, 0xfe, 0xb, 0x80, 0x42, 0x81, 0x40, 0x1a, 0x40, 0x3f,
+    0xf3, 0x0, 0x69, 0x0, 0x30, 0x6, 0x60, 0xf, 0xfd, 0x60, 0x19, 0x80, 0x2, 0xa0, 0x10, 0xb0,
+    0x7, 0xf9, 0x8, 0x2, 0x51, 0x0, 0xa4, 0x3, 0x58, 0x7, 0xfb, 0xc0, 0x37, 0x0, 0x63, 0x20,
+    0x8, 0x90, 0x3, 0xf1, 0x20, 0x4, 0x48, 0x1, 0xd4, 0x1, 0xbc, 0x3, 0xf5, 0x80, 0x62, 0xff,
+    0xf4, 0x0, 0x64, 0x20, 0xf, 0xb, 0x0, 0x7f, 0xf1, 0x68, 0x3, 0xcc, 0x1, 0xff, 0xc6, 0x70,
+    0xf, 0x48, 0x7, 0xff, 0x1d, 0xc0, 0x32, 0x88, 0x4, 0x5f, 0xff, 0xe8, 0x0, 0xd4, 0x1, 0xa4,
+    0x3, 0x50, 0x7, 0xf9, 0x80, 0x31, 0x20, 0x0, 0xcc, 0x1, 0x98, 0x3, 0xfc, 0x2c, 0x1, 0xbc,
+    0x1, 0x20, 0x19, 0x44, 0x3, 0xfe, 0xa0, 0xc, 0x84, 0x2a, 0x1, 0xa4, 0x3, 0xff, 0x19, 0x0,
+    0x6b,
+
+    /* U+00C3 "Ã" */
+    0x0, 0xfc, 0x79, 0xfd, 0x22, 0x1, 0x5d, 0x9c, 0x3, 0xff, 0x82, 0x58, 0x60, 0x2d, 0xea, 0xe,
+    0x88, 0xf0, 0xf, 0xfe, 0xc, 0x0, 0x70, 0xd7, 0xc0, 0x2, 0xc0, 0x3f, 0xf8, 0x2a, 0x3, 0x9a,
+    0xa0, 0x1c, 0x86, 0x1, 0xff, 0x88, 0x0, 0xe6, 0x55, 0x42, 0x0, 0x35, 0x80, 0x7f, 0xf0, 0x4b,
+    0xfd, 0x20, 0x12, 0xef, 0xfa, 0x40, 0x3f, 0xfc, 0x11, 0xff, 0xc2, 0x1, 0xff, 0xc7, 0x60, 0xe,
+    0x60, 0xf, 0xfe, 0x33, 0x8, 0x7, 0x48, 0x7, 0xff, 0x1a, 0xc0, 0x3c, 0x2a, 0x1, 0xff, 0xc4,
+    0x42, 0x0, 0xfa, 0x40, 0x3f, 0xf8, 0x9e, 0x1, 0x8c, 0x2, 0x33, 0x0, 0x7f, 0xf0, 0x89, 0x0,
+    0x24, 0x80, 0xd, 0x20, 0x1f, 0xfc, 0x2a, 0x0, 0xde, 0x84, 0x1, 0x28, 0x80, 0x7f, 0xf0, 0x5c,
+    0x2, 0x14, 0xa, 0x0, 0xd2, 0x1, 0xff, 0x98, 0x3, 0x48, 0x1, 0x80, 0x33, 0x0, 0x7f, 0xeb,
+    0x0, 0xcc, 0x0, 0x15, 0x0, 0x85, 0x80, 0x3f, 0xc8, 0x40, 0x12, 0x88, 0x5, 0x20, 0x1a, 0xc0,
+    0x3f, 0xde, 0x1, 0xb8, 0x3, 0x19, 0x0, 0x44, 0x80, 0x1f, 0x89, 0x0, 0x22, 0x40, 0xe, 0xa0,
+    0xd, 0xe0, 0x1f, 0xac, 0x3, 0x17, 0xff, 0xa0, 0x3, 0x21, 0x0, 0x78, 0x58, 0x3, 0xff, 0x8b,
+    0x40, 0x1e, 0x60, 0xf, 0xfe, 0x33, 0x80, 0x7a, 0x40, 0x3f, 0xf8, 0xee, 0x1, 0x94, 0x40, 0x22,
+    0xff, 0xff, 0x40, 0x6, 0xa0, 0xd, 0x20, 0x1a, 0x80, 0x3f, 0xcc, 0x1, 0x89, 0x0, 0x6, 0x60,
+    0xc, 0xc0, 0x1f, 0xe1, 0x60, 0xd, 0xe0, 0x9, 0x0, 0xca, 0x20, 0x1f, 0xf5, 0x0, 0x64, 0x21,
+    0x50, 0xd, 0x20, 0x1f, 0xf8, 0xc8, 0x3, 0x58,
+
+    /* U+00C8 "È" */
+    0x0, 0x14, 0x46, 0x70, 0xf, 0xfc, 0x5c, 0xef, 0x45, 0x0, 0x7f, 0xe6, 0xc1, 0x0, 0x2c, 0x80,
+    0x7f, 0xe3, 0xf4, 0x0, 0x34, 0x80, 0x7f, 0xe1, 0xb7, 0x0, 0x34, 0x0, 0x7f, 0xf0, 0x63, 0xfe,
+    0x80, 0xf, 0xfe, 0x62, 0xff, 0xff, 0xf1, 0x24, 0x3, 0xff, 0xde, 0x57, 0x7f, 0xf8, 0x3, 0xc8,
+    0x9f, 0xf1, 0x0, 0x7f, 0xfb, 0xcb, 0xff, 0xfc, 0x60, 0x1f, 0xff, 0x2, 0xdd, 0xff, 0x18, 0x7,
+    0xc4, 0x5f, 0xe0, 0xf, 0xff, 0x92, 0x27, 0xfe, 0x0, 0xe2, 0xbb, 0xff, 0xc0, 0x1f, 0xfe, 0xa0,
+
+    /* U+00C9 "É" */
+    0x0, 0xff, 0x2c, 0x46, 0x40, 0xf, 0xf9, 0xe9, 0xde, 0x14, 0x0, 0xff, 0x34, 0x0, 0x55, 0x20,
+    0x1f, 0xe6, 0x90, 0x1, 0x6a, 0x80, 0x7f, 0x96, 0x40, 0xb, 0xa4, 0x1, 0xff, 0x2f, 0xfd, 0x40,
+    0x1f, 0xfc, 0xd5, 0xff, 0xff, 0xe2, 0x48, 0x7, 0xff, 0xbc, 0xae, 0xff, 0xf0, 0x7, 0x91, 0x3f,
+    0xe2, 0x0, 0xff, 0xf7, 0x97, 0xff, 0xf8, 0xc0, 0x3f, 0xfe, 0x5, 0xbb, 0xfe, 0x30, 0xf, 0x88,
+    0xbf, 0xc0, 0x1f, 0xff, 0x24, 0x4f, 0xfc, 0x1, 0xc5, 0x77, 0xff, 0x80, 0x3f, 0xfd, 0x40,
+
+    /* U+00CA "Ê" */
+    0x0, 0xf1, 0x44, 0x64, 0x0, 0xff, 0x8b, 0x1d, 0xf5, 0xa0, 0x7, 0xf0, 0xe0, 0x80, 0x98, 0x2,
+    0xcc, 0x3, 0xe1, 0xc1, 0x2, 0xcc, 0x20, 0x3, 0xc, 0x3, 0xda, 0x40, 0x78, 0x41, 0x6a, 0x0,
+    0xd2, 0x0, 0xec, 0xff, 0x60, 0x80, 0x55, 0xfe, 0xe2, 0x0, 0xff, 0xe4, 0x2f, 0xff, 0xff, 0x12,
+    0x40, 0x3f, 0xfd, 0xe5, 0x77, 0xff, 0x80, 0x3c, 0x89, 0xff, 0x10, 0x7, 0xff, 0xbc, 0xbf, 0xff,
+    0xc6, 0x1, 0xff, 0xf0, 0x2d, 0xdf, 0xf1, 0x80, 0x7c, 0x45, 0xfe, 0x0, 0xff, 0xf9, 0x22, 0x7f,
+    0xe0, 0xe, 0x2b, 0xbf, 0xfc, 0x1, 0xff, 0xea,
+
+    /* U+00CC "Ì" */
+    0x17, 0x88, 0x9c, 0x3, 0x84, 0xdd, 0xe8, 0xc0, 0xe, 0x4d, 0x20, 0x1, 0xd8, 0x7, 0x16, 0xa8,
+    0x1, 0x2c, 0x3, 0xd5, 0x20, 0x4, 0xa0, 0xf, 0x37, 0xfd, 0x40, 0x1f, 0xfc, 0x45, 0xff, 0xda,
+    0x1, 0xff, 0xff, 0x0, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xf8, 0xc0,
+
+    /* U+00CD "Í" */
+    0x0, 0xc9, 0x11, 0x94, 0x3, 0x2d, 0xbb, 0xc4, 0xa0, 0x12, 0x50, 0x5, 0x14, 0x1, 0x25, 0x80,
+    0x6, 0xdc, 0x2, 0x3b, 0x0, 0x1f, 0xa0, 0x6, 0x3f, 0xfb, 0x4, 0x3, 0xff, 0x88, 0xbf, 0xfb,
+    0x40, 0x3f, 0xff, 0xe0, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0x28,
+
+    /* U+00D2 "Ò" */
+    0x0, 0xf4, 0xff, 0xe9, 0x0, 0xff, 0xe3, 0xcc, 0x80, 0x26, 0x80, 0xf, 0xfe, 0x3b, 0x61, 0x0,
+    0x1e, 0x0, 0x3f, 0xf8, 0xe7, 0x88, 0x0, 0x77, 0x0, 0x7f, 0xf1, 0xc6, 0xe5, 0xdd, 0xe2, 0x1,
+    0xff, 0xc8, 0x68, 0x88, 0x40, 0x3f, 0xfb, 0xa2, 0xd5, 0xbf, 0xf6, 0xd3, 0x8, 0x7, 0xfe, 0x19,
+    0xe9, 0x52, 0x0, 0x89, 0x67, 0xa8, 0x40, 0x3f, 0x97, 0x98, 0x3, 0xfe, 0x5e, 0x50, 0xf, 0x9e,
+    0x80, 0x3f, 0xf8, 0x74, 0xe0, 0x1c, 0xb0, 0x1, 0xe2, 0x56, 0x52, 0x0, 0xf4, 0x28, 0x4, 0x34,
+    0x1, 0xc9, 0xba, 0xa9, 0xad, 0xd2, 0x0, 0x75, 0x8, 0x2, 0xc0, 0x39, 0xec, 0x80, 0x38, 0xad,
+    0xc0, 0x3a, 0xc0, 0x54, 0x3, 0x2c, 0x0, 0x7f, 0x42, 0x80, 0x65, 0x14, 0x0, 0xe8, 0x0, 0xff,
+    0xa0, 0x3, 0x9f, 0x0, 0x31, 0x90, 0x7, 0xfc, 0x46, 0x1, 0xbc, 0x80, 0x32, 0x80, 0x7f, 0xf0,
+    0x50, 0x3, 0x10, 0x7, 0x8, 0x7, 0xff, 0x7, 0xc0, 0x33, 0x80, 0x70, 0x80, 0x7f, 0xf0, 0x7c,
+    0x3, 0x39, 0x0, 0x65, 0x0, 0xff, 0xe0, 0xa0, 0x6, 0x2c, 0x0, 0xc6, 0x40, 0x1f, 0xf0, 0x98,
+    0x6, 0xf4, 0x0, 0xe8, 0x0, 0xff, 0xac, 0x3, 0x9c, 0x54, 0x3, 0x2b, 0x80, 0x7f, 0x3a, 0x80,
+    0x65, 0x10, 0xb0, 0xe, 0x8a, 0x20, 0xe, 0x2b, 0x80, 0xe, 0x80, 0x0, 0xc8, 0x7, 0x2e, 0xe4,
+    0xc4, 0xe6, 0xa0, 0x7, 0x49, 0x0, 0x4d, 0x0, 0x1e, 0x36, 0x76, 0x30, 0xf, 0x43, 0x0, 0x73,
+    0xc8, 0x7, 0xff, 0xe, 0x5c, 0x3, 0xe6, 0xd5, 0x0, 0xff, 0x97, 0x98, 0x3, 0xf8, 0xab, 0xa5,
+    0x48, 0x2, 0x25, 0x9e, 0xa1, 0x0, 0xe0,
+
+    /* U+00D3 "Ó" */
+    0x0, 0xff, 0xe0, 0xcf, 0xfe, 0x90, 0xf, 0xfe, 0x34, 0x30, 0x5, 0x32, 0x0, 0xff, 0xe2, 0xbb,
+    0x80, 0x5, 0x8c, 0x1, 0xff, 0xc5, 0x78, 0x0, 0x26, 0x18, 0x7, 0xff, 0x14, 0x41, 0xdd, 0x36,
+    0x20, 0x1f, 0xfc, 0x61, 0x78, 0x83, 0x0, 0x7f, 0xf7, 0xc5, 0xab, 0x7f, 0xed, 0xa6, 0x10, 0xf,
+    0xfc, 0x33, 0xd2, 0xa4, 0x1, 0x12, 0xcf, 0x50, 0x80, 0x7f, 0x2f, 0x30, 0x7, 0xfc, 0xbc, 0xa0,
+    0x1f, 0x3d, 0x0, 0x7f, 0xf0, 0xe9, 0xc0, 0x39, 0x60, 0x3, 0xc4, 0xac, 0xa4, 0x1, 0xe8, 0x50,
+    0x8, 0x68, 0x3, 0x93, 0x75, 0x53, 0x5b, 0xa4, 0x0, 0xea, 0x10, 0x5, 0x80, 0x73, 0xd9, 0x0,
+    0x71, 0x5b, 0x80, 0x75, 0x80, 0xa8, 0x6, 0x58, 0x0, 0xfe, 0x85, 0x0, 0xca, 0x28, 0x1, 0xd0,
+    0x1, 0xff, 0x40, 0x7, 0x3e, 0x0, 0x63, 0x20, 0xf, 0xf8, 0x8c, 0x3, 0x79, 0x0, 0x65, 0x0,
+    0xff, 0xe0, 0xa0, 0x6, 0x20, 0xe, 0x10, 0xf, 0xfe, 0xf, 0x80, 0x67, 0x0, 0xe1, 0x0, 0xff,
+    0xe0, 0xf8, 0x6, 0x72, 0x0, 0xca, 0x1, 0xff, 0xc1, 0x40, 0xc, 0x58, 0x1, 0x8c, 0x80, 0x3f,
+    0xe1, 0x30, 0xd, 0xe8, 0x1, 0xd0, 0x1, 0xff, 0x58, 0x7, 0x38, 0xa8, 0x6, 0x57, 0x0, 0xfe,
+    0x75, 0x0, 0xca, 0x21, 0x60, 0x1d, 0x14, 0x40, 0x1c, 0x57, 0x0, 0x1d, 0x0, 0x1, 0x90, 0xe,
+    0x5d, 0xc9, 0x89, 0xcd, 0x40, 0xe, 0x92, 0x0, 0x9a, 0x0, 0x3c, 0x6c, 0xec, 0x60, 0x1e, 0x86,
+    0x0, 0xe7, 0x90, 0xf, 0xfe, 0x1c, 0xb8, 0x7, 0xcd, 0xaa, 0x1, 0xff, 0x2f, 0x30, 0x7, 0xf1,
+    0x57, 0x4a, 0x90, 0x4, 0x4b, 0x3d, 0x42, 0x1, 0xc0,
+
+    /* U+00D4 "Ô" */
+    0x0, 0xfe, 0x3f, 0xfe, 0x30, 0xf, 0xfe, 0x29, 0x68, 0x7, 0x61, 0x80, 0x7f, 0xf0, 0xcb, 0x4,
+    0xb, 0x8, 0x1, 0xa4, 0x1, 0xff, 0xc1, 0x1c, 0x10, 0x3c, 0x3c, 0x30, 0x1c, 0x10, 0xf, 0xfc,
+    0x8c, 0xf1, 0x82, 0x3, 0x90, 0xec, 0x80, 0x1f, 0xf9, 0x62, 0xe, 0x1, 0xcf, 0x10, 0x50, 0xf,
+    0xfe, 0xd0, 0xb5, 0x6f, 0xfd, 0xb4, 0xc2, 0x1, 0xff, 0x86, 0x7a, 0x54, 0x80, 0x22, 0x59, 0xea,
+    0x10, 0xf, 0xe5, 0xe6, 0x0, 0xff, 0x97, 0x94, 0x3, 0xe7, 0xa0, 0xf, 0xfe, 0x1d, 0x38, 0x7,
+    0x2c, 0x0, 0x78, 0x95, 0x94, 0x80, 0x3d, 0xa, 0x1, 0xd, 0x0, 0x72, 0x6e, 0xaa, 0x6b, 0x74,
+    0x80, 0x1d, 0x42, 0x0, 0xb0, 0xe, 0x7b, 0x20, 0xe, 0x2b, 0x70, 0xe, 0xb0, 0x15, 0x0, 0xcb,
+    0x0, 0x1f, 0xd0, 0xa0, 0x19, 0x45, 0x0, 0x3a, 0x0, 0x3f, 0xe8, 0x0, 0xe7, 0xc0, 0xc, 0x64,
+    0x1, 0xff, 0x11, 0x80, 0x6f, 0x20, 0xc, 0xa0, 0x1f, 0xfc, 0x14, 0x0, 0xc4, 0x1, 0xc2, 0x1,
+    0xff, 0xc1, 0xf0, 0xc, 0xe0, 0x1c, 0x20, 0x1f, 0xfc, 0x1f, 0x0, 0xce, 0x40, 0x19, 0x40, 0x3f,
+    0xf8, 0x28, 0x1, 0x8b, 0x0, 0x31, 0x90, 0x7, 0xfc, 0x26, 0x1, 0xbd, 0x0, 0x3a, 0x0, 0x3f,
+    0xeb, 0x0, 0xe7, 0x15, 0x0, 0xca, 0xe0, 0x1f, 0xce, 0xa0, 0x19, 0x44, 0x2c, 0x3, 0xa2, 0x88,
+    0x3, 0x8a, 0xe0, 0x3, 0xa0, 0x0, 0x32, 0x1, 0xcb, 0xb9, 0x31, 0x39, 0xa8, 0x1, 0xd2, 0x40,
+    0x13, 0x40, 0x7, 0x8d, 0x9d, 0x8c, 0x3, 0xd0, 0xc0, 0x1c, 0xf2, 0x1, 0xff, 0xc3, 0x97, 0x0,
+    0xf9, 0xb5, 0x40, 0x3f, 0xe5, 0xe6, 0x0, 0xfe, 0x2a, 0xe9, 0x52, 0x0, 0x89, 0x67, 0xa8, 0x40,
+    0x38,
+
+    /* U+00D5 "Õ" */
+    0x0, 0xff, 0xea, 0x15, 0xff, 0xb0, 0xc0, 0x2a, 0xca, 0x0, 0xff, 0xe0, 0xe2, 0x0, 0xf, 0x20,
+    0x51, 0x4d, 0x80, 0x3f, 0xf3, 0x88, 0x7, 0x3f, 0x58, 0x2, 0xc0, 0x3f, 0xf5, 0x80, 0x2b, 0xe0,
+    0x3, 0x85, 0xc0, 0x3f, 0xf1, 0x1, 0x28, 0x3e, 0xa8, 0x1, 0x30, 0x3, 0xff, 0x83, 0xdf, 0xa0,
+    0x11, 0x57, 0xfa, 0xc8, 0x3, 0xff, 0xb6, 0x2d, 0x5b, 0xff, 0x6d, 0x30, 0x80, 0x7f, 0xe1, 0x9e,
+    0x95, 0x20, 0x8, 0x96, 0x7a, 0x84, 0x3, 0xf9, 0x79, 0x80, 0x3f, 0xe5, 0xe5, 0x0, 0xf9, 0xe8,
+    0x3, 0xff, 0x87, 0x4e, 0x1, 0xcb, 0x0, 0x1e, 0x25, 0x65, 0x20, 0xf, 0x42, 0x80, 0x43, 0x40,
+    0x1c, 0x9b, 0xaa, 0x9a, 0xdd, 0x20, 0x7, 0x50, 0x80, 0x2c, 0x3, 0x9e, 0xc8, 0x3, 0x8a, 0xdc,
+    0x3, 0xac, 0x5, 0x40, 0x32, 0xc0, 0x7, 0xf4, 0x28, 0x6, 0x51, 0x40, 0xe, 0x80, 0xf, 0xfa,
+    0x0, 0x39, 0xf0, 0x3, 0x19, 0x0, 0x7f, 0xc4, 0x60, 0x1b, 0xc8, 0x3, 0x28, 0x7, 0xff, 0x5,
+    0x0, 0x31, 0x0, 0x70, 0x80, 0x7f, 0xf0, 0x7c, 0x3, 0x38, 0x7, 0x8, 0x7, 0xff, 0x7, 0xc0,
+    0x33, 0x90, 0x6, 0x50, 0xf, 0xfe, 0xa, 0x0, 0x62, 0xc0, 0xc, 0x64, 0x1, 0xff, 0x9, 0x80,
+    0x6f, 0x40, 0xe, 0x80, 0xf, 0xfa, 0xc0, 0x39, 0xc5, 0x40, 0x32, 0xb8, 0x7, 0xf3, 0xa8, 0x6,
+    0x51, 0xb, 0x0, 0xe8, 0xa2, 0x0, 0xe2, 0xb8, 0x0, 0xe8, 0x0, 0xc, 0x80, 0x72, 0xee, 0x4c,
+    0x4e, 0x6a, 0x0, 0x74, 0x90, 0x4, 0xd0, 0x1, 0xe3, 0x67, 0x63, 0x0, 0xf4, 0x30, 0x7, 0x3c,
+    0x80, 0x7f, 0xf0, 0xe5, 0xc0, 0x3e, 0x6d, 0x50, 0xf, 0xf9, 0x79, 0x80, 0x3f, 0x8a, 0xba, 0x54,
+    0x80, 0x22, 0x59, 0xea, 0x10, 0xe,
+
+    /* U+00D9 "Ù" */
+    0x0, 0xcf, 0xff, 0xac, 0x3, 0xff, 0x86, 0xf6, 0x20, 0x4, 0xa0, 0xf, 0xfe, 0x1a, 0x61, 0x80,
+    0x16, 0x80, 0x3f, 0xf8, 0x65, 0x8c, 0x0, 0x59, 0x0, 0xff, 0xe2, 0x4d, 0x3b, 0x84, 0x80, 0x3f,
+    0xf8, 0x8b, 0x11, 0x10, 0x7, 0xff, 0x42, 0x3f, 0xf5, 0x0, 0x7f, 0x37, 0xfe, 0xc0, 0xf, 0xff,
+    0xf8, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xce, 0x70, 0xe, 0x10, 0xf, 0xfe, 0x1f,
+    0x0, 0x66, 0x0, 0xfe, 0xe0, 0xc, 0x24, 0x1, 0x88, 0x40, 0x3f, 0x28, 0x6, 0xd4, 0x0, 0xe8,
+    0x0, 0xf9, 0x8, 0x3, 0x20, 0x28, 0x6, 0x67, 0x0, 0xe4, 0xb0, 0xc, 0x26, 0x12, 0x1, 0xd1,
+    0xd5, 0x13, 0xb6, 0x1, 0xd0, 0x0, 0x37, 0x0, 0xe1, 0x57, 0x62, 0x0, 0xe3, 0x60, 0xa, 0x18,
+    0x3, 0xff, 0x82, 0x7a, 0x1, 0xd3, 0x21, 0x0, 0xff, 0x3e, 0x8, 0x7, 0x9b, 0xa9, 0x48, 0x2,
+    0x14, 0x9e, 0x80, 0xc,
+
+    /* U+00DA "Ú" */
+    0x0, 0xff, 0x9b, 0xff, 0x58, 0x80, 0x7f, 0xf0, 0x5a, 0x40, 0x28, 0xb1, 0x0, 0xff, 0xcb, 0x20,
+    0x1, 0xb7, 0x0, 0xff, 0xe0, 0xad, 0x0, 0xf, 0xd0, 0x3, 0xff, 0x84, 0x4e, 0xe8, 0xc1, 0x0,
+    0xff, 0xe1, 0xbc, 0x41, 0xc0, 0x3f, 0xfa, 0x51, 0xff, 0xa8, 0x3, 0xf9, 0xbf, 0xf6, 0x0, 0x7f,
+    0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xff, 0xf0, 0xf, 0xfe, 0x73, 0x80, 0x70, 0x80, 0x7f, 0xf0,
+    0xf8, 0x3, 0x30, 0x7, 0xf7, 0x0, 0x61, 0x20, 0xc, 0x42, 0x1, 0xf9, 0x40, 0x36, 0xa0, 0x7,
+    0x40, 0x7, 0xc8, 0x40, 0x19, 0x1, 0x40, 0x33, 0x38, 0x7, 0x25, 0x80, 0x61, 0x30, 0x90, 0xe,
+    0x8e, 0xa8, 0x9d, 0xb0, 0xe, 0x80, 0x1, 0xb8, 0x7, 0xa, 0xbb, 0x10, 0x7, 0x1b, 0x0, 0x50,
+    0xc0, 0x1f, 0xfc, 0x13, 0xd0, 0xe, 0x99, 0x8, 0x7, 0xf9, 0xf0, 0x40, 0x3c, 0xdd, 0x4a, 0x40,
+    0x10, 0xa4, 0xf4, 0x0, 0x60,
+
+    /* U+00DD "Ý" */
+    0x0, 0xff, 0xe0, 0xc4, 0xce, 0x20, 0xf, 0xfe, 0x2d, 0xbb, 0x35, 0x84, 0x1, 0xff, 0xc4, 0xa4,
+    0x0, 0x16, 0xa8, 0x7, 0xff, 0x12, 0x54, 0x0, 0x98, 0x40, 0x1f, 0xfc, 0x48, 0x60, 0x3, 0x58,
+    0x80, 0x7f, 0xf1, 0x6b, 0x76, 0x90, 0xf, 0xfe, 0x39, 0x16, 0x0, 0xff, 0x8b, 0xff, 0x94, 0x3,
+    0xfc, 0x9f, 0xfb, 0x0, 0x98, 0x3, 0x58, 0x7, 0xfa, 0x40, 0x37, 0x80, 0x20, 0x40, 0x21, 0x80,
+    0xf, 0xcc, 0x40, 0x12, 0x98, 0x0, 0x60, 0x3, 0x39, 0x0, 0x78, 0x60, 0x3, 0x58, 0x6, 0x62,
+    0x0, 0xd0, 0x1, 0xe8, 0x10, 0xa, 0x4, 0x3, 0xb8, 0x3, 0x2a, 0x0, 0x63, 0x60, 0x8, 0x9c,
+    0x3, 0xc6, 0xa0, 0x1a, 0x40, 0x37, 0x80, 0x68, 0x0, 0xfd, 0x60, 0x18, 0x98, 0x0, 0xa6, 0x1,
+    0x22, 0x80, 0x7e, 0x18, 0x0, 0xd0, 0x21, 0x60, 0x1a, 0x40, 0x3f, 0xce, 0x40, 0x10, 0xc4, 0x4,
+    0x2, 0x72, 0x0, 0xff, 0xa0, 0x3, 0x33, 0x80, 0x43, 0x0, 0x1f, 0xf9, 0x50, 0x3, 0xf4, 0x0,
+    0x7f, 0xf0, 0xa4, 0x3, 0xe3, 0x60, 0xf, 0xfe, 0x11, 0x30, 0x7, 0xbc, 0x3, 0xff, 0x89, 0x0,
+    0x1c, 0xa6, 0x1, 0xff, 0xc4, 0x13, 0x0, 0xd8, 0x1, 0xff, 0xff, 0x0, 0xff, 0xff, 0x80, 0x7f,
+    0xf3, 0xc0,
+
+    /* U+00E0 "à" */
+    0x0, 0x37, 0xfe, 0xc0, 0xf, 0xf9, 0xb0, 0x40, 0x7, 0x80, 0x1f, 0xf1, 0xfa, 0x0, 0xe, 0xc0,
+    0x3f, 0xe1, 0xb7, 0x0, 0x25, 0x80, 0x7f, 0xe8, 0xb7, 0x71, 0x98, 0x3, 0xff, 0x24, 0x44, 0x60,
+    0x1f, 0xfc, 0xd3, 0x8b, 0xef, 0xfb, 0x24, 0xc0, 0x39, 0x33, 0xe, 0x82, 0x1, 0x1b, 0x65, 0x88,
+    0x5, 0x46, 0x1, 0xfe, 0x4c, 0x10, 0x4, 0x80, 0x7f, 0xe2, 0x80, 0x3, 0x88, 0x9a, 0xf7, 0xb6,
+    0x48, 0x3, 0x30, 0x5, 0xbd, 0x28, 0x42, 0x4d, 0x82, 0x1, 0x90, 0x0, 0x60, 0x1f, 0xb, 0x80,
+    0x63, 0x0, 0x96, 0xb7, 0xff, 0x98, 0x3, 0x78, 0x16, 0xd2, 0x90, 0x7, 0xfc, 0x38, 0x40, 0x1f,
+    0xfc, 0x26, 0x10, 0x8, 0xf3, 0xff, 0x40, 0x7, 0x60, 0x6, 0xf3, 0x0, 0xff, 0x38, 0x6, 0x20,
+    0xe, 0xc0, 0xe, 0x70, 0xc, 0xc0, 0x19, 0xd0, 0x3, 0xb4, 0x3, 0x45, 0xbc, 0x6c, 0x0, 0x79,
+    0x88, 0x3, 0x24, 0x39, 0x0, 0x80, 0x7b, 0xc8, 0x3, 0xe1, 0xa0, 0xf, 0x16, 0xca, 0x8, 0x0,
+    0xdf, 0xd8, 0x3, 0x80,
+
+    /* U+00E1 "á" */
+    0x0, 0xfe, 0x5f, 0xfd, 0x82, 0x1, 0xfc, 0x94, 0x1, 0x36, 0x8, 0x7, 0xe4, 0xb0, 0xa, 0xa4,
+    0x3, 0xf8, 0xec, 0x0, 0x5a, 0xa0, 0x1f, 0xe4, 0x77, 0x46, 0x10, 0x7, 0xfc, 0xf1, 0x7, 0x10,
+    0xf, 0xfe, 0x71, 0xc5, 0xf7, 0xfd, 0x92, 0x60, 0x1c, 0x99, 0x87, 0x41, 0x0, 0x8d, 0xb2, 0xc4,
+    0x2, 0xa3, 0x0, 0xff, 0x26, 0x8, 0x2, 0x40, 0x3f, 0xf1, 0x40, 0x1, 0xc4, 0x4d, 0x7b, 0xdb,
+    0x24, 0x1, 0x98, 0x2, 0xde, 0x94, 0x21, 0x26, 0xc1, 0x0, 0xc8, 0x0, 0x30, 0xf, 0x85, 0xc0,
+    0x31, 0x80, 0x4b, 0x5b, 0xff, 0xcc, 0x1, 0xbc, 0xb, 0x69, 0x48, 0x3, 0xfe, 0x1c, 0x20, 0xf,
+    0xfe, 0x13, 0x8, 0x4, 0x79, 0xff, 0xa0, 0x3, 0xb0, 0x3, 0x79, 0x80, 0x7f, 0x9c, 0x3, 0x10,
+    0x7, 0x60, 0x7, 0x38, 0x6, 0x60, 0xc, 0xe8, 0x1, 0xda, 0x1, 0xa2, 0xde, 0x36, 0x0, 0x3c,
+    0xc4, 0x1, 0x92, 0x1c, 0x80, 0x40, 0x3d, 0xe4, 0x1, 0xf0, 0xd0, 0x7, 0x8b, 0x65, 0x4, 0x0,
+    0x6f, 0xec, 0x1, 0xc0,
+
+    /* U+00E2 "â" */
+    0x0, 0xe1, 0xdf, 0xfc, 0xe0, 0x1f, 0xed, 0x20, 0xd, 0xc, 0x1, 0xfb, 0xc, 0x0, 0xe4, 0x0,
+    0x95, 0x0, 0xf5, 0x98, 0x2, 0xe3, 0x54, 0x1, 0x48, 0x1, 0x8c, 0xce, 0xed, 0x40, 0x5, 0x4b,
+    0xb8, 0xc0, 0x31, 0xc4, 0x44, 0x1, 0x9a, 0x20, 0xe0, 0x1f, 0xfc, 0xa3, 0x8b, 0xef, 0xfb, 0x24,
+    0xc0, 0x39, 0x33, 0xe, 0x82, 0x1, 0x1b, 0x65, 0x88, 0x5, 0x46, 0x1, 0xfe, 0x4c, 0x10, 0x4,
+    0x80, 0x7f, 0xe2, 0x80, 0x3, 0x88, 0x9a, 0xf7, 0xb6, 0x48, 0x3, 0x30, 0x5, 0xbd, 0x28, 0x42,
+    0x4d, 0x82, 0x1, 0x90, 0x0, 0x60, 0x1f, 0xb, 0x80, 0x63, 0x0, 0x96, 0xb7, 0xff, 0x98, 0x3,
+    0x78, 0x16, 0xd2, 0x90, 0x7, 0xfc, 0x38, 0x40, 0x1f, 0xfc, 0x26, 0x10, 0x8, 0xf3, 0xff, 0x40,
+    0x7, 0x60, 0x6, 0xf3, 0x0, 0xff, 0x38, 0x6, 0x20, 0xe, 0xc0, 0xe, 0x70, 0xc, 0xc0, 0x19,
+    0xd0, 0x3, 0xb4, 0x3, 0x45, 0xbc, 0x6c, 0x0, 0x79, 0x88, 0x3, 0x24, 0x39, 0x0, 0x80, 0x7b,
+    0xc8, 0x3, 0xe1, 0xa0, 0xf, 0x16, 0xca, 0x8, 0x0, 0xdf, 0xd8, 0x3, 0x80,
+
+    /* U+00E3 "ã" */
+    0x0, 0xcf, 0xdf, 0x8a, 0x1, 0x3d, 0xc8, 0x7, 0x34, 0x8, 0x1d, 0x50, 0x4a, 0x11, 0x40, 0x3a,
+    0x0, 0x39, 0x7b, 0x40, 0x16, 0x1, 0x8c, 0x41, 0x7f, 0x8, 0x3, 0xb, 0x0, 0x66, 0x11, 0x48,
+    0x1e, 0xb9, 0xa, 0xe0, 0x80, 0x65, 0xee, 0x18, 0x5, 0x1b, 0xd4, 0x40, 0x1f, 0xfc, 0xb3, 0x8b,
+    0xef, 0xfb, 0x24, 0xc0, 0x39, 0x33, 0xe, 0x82, 0x1, 0x1b, 0x65, 0x88, 0x5, 0x46, 0x1, 0xfe,
+    0x4c, 0x10, 0x4, 0x80, 0x7f, 0xe2, 0x80, 0x3, 0x88, 0x9a, 0xf7, 0xb6, 0x48, 0x3, 0x30, 0x5,
+    0xbd, 0x28, 0x42, 0x4d, 0x82, 0x1, 0x90, 0x0, 0x60, 0x1f, 0xb, 0x80, 0x63, 0x0, 0x96, 0xb7,
+    0xff, 0x98, 0x3, 0x78, 0x16, 0xd2, 0x90, 0x7, 0xfc, 0x38, 0x40, 0x1f, 0xfc, 0x26, 0x10, 0x8,
+    0xf3, 0xff, 0x40, 0x7, 0x60, 0x6, 0xf3, 0x0, 0xff, 0x38, 0x6, 0x20, 0xe, 0xc0, 0xe, 0x70,
+    0xc, 0xc0, 0x19, 0xd0, 0x3, 0xb4, 0x3, 0x45, 0xbc, 0x6c, 0x0, 0x79, 0x88, 0x3, 0x24, 0x39,
+    0x0, 0x80, 0x7b, 0xc8, 0x3, 0xe1, 0xa0, 0xf, 0x16, 0xca, 0x8, 0x0, 0xdf, 0xd8, 0x3, 0x80,
+
+    /* U+00E8 "è" */
+    0x0, 0x16, 0xff, 0xe3, 0x0, 0xff, 0xc5, 0xaa, 0x1, 0x61, 0x80, 0x7f, 0xf0, 0x6a, 0x0, 0x2d,
+    0x20, 0xf, 0xfe, 0xb, 0xd8, 0x80, 0xe1, 0x0, 0x7f, 0xf0, 0x53, 0xe1, 0xd9, 0x0, 0x3f, 0xf8,
+    0x42, 0xf1, 0x6, 0x0, 0xff, 0xe9, 0xa5, 0x6f, 0xfb, 0xb1, 0xc4, 0x3, 0xf1, 0xed, 0xa9, 0x0,
+    0x4, 0xe3, 0xa0, 0x3, 0xcb, 0x84, 0x1, 0xfc, 0xf6, 0x1, 0x8e, 0x80, 0x3c, 0x20, 0x1c, 0x92,
+    0x1, 0x70, 0x6, 0x3c, 0xfe, 0xf9, 0x0, 0xcc, 0x60, 0xa4, 0x1, 0x1e, 0x18, 0x4, 0xd6, 0x1,
+    0xa4, 0x3c, 0x3, 0x40, 0x7, 0x91, 0x0, 0x12, 0x83, 0x80, 0x6b, 0xff, 0xf9, 0x0, 0x30, 0x90,
+    0x7, 0xff, 0x14, 0xc0, 0x3f, 0xf8, 0xe4, 0x1, 0xbb, 0xff, 0xff, 0x13, 0x80, 0x66, 0x0, 0xff,
+    0xe0, 0xf0, 0x6, 0x83, 0x0, 0xf2, 0x50, 0x6, 0x43, 0x0, 0xd9, 0x28, 0x44, 0x4a, 0xb5, 0x90,
+    0xd, 0xc0, 0x1c, 0xd7, 0xba, 0xb5, 0x0, 0x33, 0x0, 0x22, 0xb0, 0xf, 0xfe, 0xf, 0x80, 0x64,
+    0xd4, 0x0, 0xff, 0x4c, 0x80, 0x38, 0xaf, 0x1c, 0xc4, 0x0, 0x29, 0x3c, 0xc0, 0x10,
+
+    /* U+00E9 "é" */
+    0x0, 0xfe, 0x1d, 0xff, 0xc8, 0x1, 0xff, 0xe, 0x10, 0x0, 0xb5, 0x0, 0x3f, 0xc3, 0x84, 0x0,
+    0x5d, 0x20, 0xf, 0xfb, 0x48, 0x1, 0x34, 0x1, 0xff, 0x91, 0xe, 0xec, 0x60, 0xf, 0xfe, 0xa,
+    0x44, 0x46, 0x1, 0xff, 0xd4, 0x4a, 0xdf, 0xf7, 0x63, 0x88, 0x7, 0xe3, 0xdb, 0x52, 0x0, 0x9,
+    0xc7, 0x40, 0x7, 0x97, 0x8, 0x3, 0xf9, 0xec, 0x3, 0x1d, 0x0, 0x78, 0x40, 0x39, 0x24, 0x2,
+    0xe0, 0xc, 0x79, 0xfd, 0xf2, 0x1, 0x98, 0xc1, 0x48, 0x2, 0x3c, 0x30, 0x9, 0xac, 0x3, 0x48,
+    0x78, 0x6, 0x80, 0xf, 0x22, 0x0, 0x25, 0x7, 0x0, 0xd7, 0xff, 0xf2, 0x0, 0x61, 0x20, 0xf,
+    0xfe, 0x29, 0x80, 0x7f, 0xf1, 0xc8, 0x3, 0x77, 0xff, 0xfe, 0x27, 0x0, 0xcc, 0x1, 0xff, 0xc1,
+    0xe0, 0xd, 0x6, 0x1, 0xe4, 0xa0, 0xc, 0x86, 0x1, 0xb2, 0x50, 0x88, 0x95, 0x6b, 0x20, 0x1b,
+    0x80, 0x39, 0xaf, 0x75, 0x6a, 0x0, 0x66, 0x0, 0x45, 0x60, 0x1f, 0xfc, 0x1f, 0x0, 0xc9, 0xa8,
+    0x1, 0xfe, 0x99, 0x0, 0x71, 0x5e, 0x39, 0x88, 0x0, 0x52, 0x79, 0x80, 0x20,
+
+    /* U+00EA "ê" */
+    0x0, 0xf4, 0xff, 0xeb, 0x0, 0xff, 0xd0, 0xc0, 0x19, 0x2c, 0x3, 0xfc, 0xee, 0x0, 0x1b, 0x0,
+    0x12, 0x80, 0x3f, 0x34, 0x0, 0x1b, 0x26, 0x40, 0x5, 0x90, 0xf, 0x85, 0xdd, 0x52, 0x0, 0x6c,
+    0x77, 0x9, 0x0, 0x79, 0xe2, 0xa, 0x1, 0x8e, 0x22, 0x20, 0xf, 0xfe, 0x7a, 0x56, 0xff, 0xbb,
+    0x1c, 0x40, 0x3f, 0x1e, 0xda, 0x90, 0x0, 0x4e, 0x3a, 0x0, 0x3c, 0xb8, 0x40, 0x1f, 0xcf, 0x60,
+    0x18, 0xe8, 0x3, 0xc2, 0x1, 0xc9, 0x20, 0x17, 0x0, 0x63, 0xcf, 0xef, 0x90, 0xc, 0xc6, 0xa,
+    0x40, 0x11, 0xe1, 0x80, 0x4d, 0x60, 0x1a, 0x43, 0xc0, 0x34, 0x0, 0x79, 0x10, 0x1, 0x28, 0x38,
+    0x6, 0xbf, 0xff, 0x90, 0x3, 0x9, 0x0, 0x7f, 0xf1, 0x4c, 0x3, 0xff, 0x8e, 0x40, 0x1b, 0xbf,
+    0xff, 0xf1, 0x38, 0x6, 0x60, 0xf, 0xfe, 0xf, 0x0, 0x68, 0x30, 0xf, 0x25, 0x0, 0x64, 0x30,
+    0xd, 0x92, 0x84, 0x44, 0xab, 0x59, 0x0, 0xdc, 0x1, 0xcd, 0x7b, 0xab, 0x50, 0x3, 0x30, 0x2,
+    0x2b, 0x0, 0xff, 0xe0, 0xf8, 0x6, 0x4d, 0x40, 0xf, 0xf4, 0xc8, 0x3, 0x8a, 0xf1, 0xcc, 0x40,
+    0x2, 0x93, 0xcc, 0x1,
+
+    /* U+00EC "ì" */
+    0x6f, 0xfd, 0x80, 0x19, 0xac, 0x2, 0x3a, 0x0, 0xc9, 0x82, 0x0, 0x58, 0x0, 0xc7, 0xe4, 0x0,
+    0x76, 0x0, 0xc3, 0xa8, 0x0, 0x94, 0x0, 0xeb, 0xff, 0x90, 0x3, 0xff, 0x85, 0x7f, 0xf9, 0x0,
+    0x3f, 0xff, 0xe0, 0x1f, 0xff, 0xf0, 0xf, 0xfe, 0x40,
+
+    /* U+00ED "í" */
+    0x0, 0xc9, 0xff, 0xb4, 0x80, 0x22, 0xa0, 0x8, 0xf0, 0x80, 0x3, 0xe2, 0x0, 0x5c, 0x10, 0xb,
+    0x48, 0x0, 0xf4, 0x1, 0xa8, 0xc0, 0x13, 0x0, 0x1d, 0x5f, 0xf3, 0x0, 0x7f, 0xf1, 0x6f, 0xff,
+    0x20, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xdd,
+
+    /* U+00F2 "ò" */
+    0x0, 0xab, 0xff, 0x40, 0x7, 0xff, 0x6, 0xa0, 0x2, 0x77, 0x0, 0x7f, 0xf0, 0x5f, 0x4, 0x1,
+    0xc, 0x1, 0xff, 0xc1, 0x3f, 0x30, 0x4, 0xb0, 0x7, 0xff, 0x4, 0x72, 0x5d, 0xc2, 0x1, 0xff,
+    0xc3, 0x68, 0x83, 0x80, 0x7f, 0xf4, 0xd2, 0x77, 0xfe, 0xd9, 0x30, 0xf, 0xc5, 0x96, 0xc4, 0x1,
+    0x13, 0x65, 0x90, 0x7, 0x26, 0x98, 0x7, 0xf2, 0x6a, 0x0, 0x45, 0x60, 0x1f, 0xfc, 0x1b, 0x20,
+    0x7, 0x80, 0x72, 0x56, 0x52, 0x0, 0x77, 0x2, 0x90, 0x6, 0x9b, 0x53, 0x5b, 0x90, 0xc, 0x69,
+    0xe0, 0x19, 0x58, 0x3, 0x99, 0x40, 0x37, 0x38, 0x6, 0xe0, 0xf, 0xb8, 0x3, 0x39, 0x0, 0x65,
+    0x0, 0xf9, 0x80, 0x31, 0x80, 0x7f, 0xf1, 0xc8, 0x3, 0x28, 0x7, 0xce, 0x1, 0x8d, 0xc0, 0x37,
+    0x0, 0x7d, 0xc0, 0x19, 0x38, 0x3, 0x2b, 0x0, 0x73, 0x20, 0x6, 0xd4, 0x30, 0xd, 0x36, 0xa6,
+    0xb7, 0x20, 0x18, 0xd0, 0x38, 0x3, 0x92, 0xb2, 0x90, 0x3, 0xb8, 0x0, 0x56, 0x1, 0xff, 0x87,
+    0x8, 0x2, 0x4d, 0x40, 0xf, 0xe4, 0xc3, 0x0, 0xe2, 0xbc, 0x62, 0x0, 0x89, 0xb2, 0xc8, 0x2,
+
+    /* U+00F3 "ó" */
+    0x0, 0xff, 0x57, 0xfe, 0x80, 0xf, 0xfd, 0x2a, 0x1, 0x54, 0x0, 0x7f, 0xd0, 0xc0, 0x2, 0xd5,
+    0x0, 0xff, 0xa1, 0xc0, 0xb, 0xa4, 0x1, 0xff, 0x8, 0x3b, 0xaa, 0x80, 0x1f, 0xfc, 0x11, 0x88,
+    0x94, 0x3, 0xff, 0xa8, 0x93, 0xbf, 0xf6, 0xc9, 0x80, 0x7e, 0x2c, 0xb6, 0x20, 0x8, 0x9b, 0x2c,
+    0x80, 0x39, 0x34, 0xc0, 0x3f, 0x93, 0x50, 0x2, 0x2b, 0x0, 0xff, 0xe0, 0xd9, 0x0, 0x3c, 0x3,
+    0x92, 0xb2, 0x90, 0x3, 0xb8, 0x14, 0x80, 0x34, 0xda, 0x9a, 0xdc, 0x80, 0x63, 0x4f, 0x0, 0xca,
+    0xc0, 0x1c, 0xca, 0x1, 0xb9, 0xc0, 0x37, 0x0, 0x7d, 0xc0, 0x19, 0xc8, 0x3, 0x28, 0x7, 0xcc,
+    0x1, 0x8c, 0x3, 0xff, 0x8e, 0x40, 0x19, 0x40, 0x3e, 0x70, 0xc, 0x6e, 0x1, 0xb8, 0x3, 0xee,
+    0x0, 0xc9, 0xc0, 0x19, 0x58, 0x3, 0x99, 0x0, 0x36, 0xa1, 0x80, 0x69, 0xb5, 0x35, 0xb9, 0x0,
+    0xc6, 0x81, 0xc0, 0x1c, 0x95, 0x94, 0x80, 0x1d, 0xc0, 0x2, 0xb0, 0xf, 0xfc, 0x38, 0x40, 0x12,
+    0x6a, 0x0, 0x7f, 0x26, 0x18, 0x7, 0x15, 0xe3, 0x10, 0x4, 0x4d, 0x96, 0x40, 0x10,
+
+    /* U+00F4 "ô" */
+    0x0, 0xf2, 0x7f, 0xee, 0x20, 0xf, 0xf8, 0xec, 0x3, 0xe, 0x10, 0x7, 0xf1, 0xe0, 0x0, 0x60,
+    0x0, 0x3e, 0x20, 0x1f, 0x16, 0x80, 0xf, 0xdf, 0x48, 0xb, 0x4, 0x3, 0xc8, 0xcf, 0x18, 0x20,
+    0x59, 0xe, 0xa8, 0x1, 0xe6, 0x88, 0x38, 0x6, 0x17, 0x88, 0x28, 0x7, 0xff, 0x3d, 0x27, 0x7f,
+    0xed, 0x93, 0x0, 0xfc, 0x59, 0x6c, 0x40, 0x11, 0x36, 0x59, 0x0, 0x72, 0x69, 0x80, 0x7f, 0x26,
+    0xa0, 0x4, 0x56, 0x1, 0xff, 0xc1, 0xb2, 0x0, 0x78, 0x7, 0x25, 0x65, 0x20, 0x7, 0x70, 0x29,
+    0x0, 0x69, 0xb5, 0x35, 0xb9, 0x0, 0xc6, 0x9e, 0x1, 0x95, 0x80, 0x39, 0x94, 0x3, 0x73, 0x80,
+    0x6e, 0x0, 0xfb, 0x80, 0x33, 0x90, 0x6, 0x50, 0xf, 0x98, 0x3, 0x18, 0x7, 0xff, 0x1c, 0x80,
+    0x32, 0x80, 0x7c, 0xe0, 0x18, 0xdc, 0x3, 0x70, 0x7, 0xdc, 0x1, 0x93, 0x80, 0x32, 0xb0, 0x7,
+    0x32, 0x0, 0x6d, 0x43, 0x0, 0xd3, 0x6a, 0x6b, 0x72, 0x1, 0x8d, 0x3, 0x80, 0x39, 0x2b, 0x29,
+    0x0, 0x3b, 0x80, 0x5, 0x60, 0x1f, 0xf8, 0x70, 0x80, 0x24, 0xd4, 0x0, 0xfe, 0x4c, 0x30, 0xe,
+    0x2b, 0xc6, 0x20, 0x8, 0x9b, 0x2c, 0x80, 0x20,
+
+    /* U+00F5 "õ" */
+    0x0, 0xc3, 0x5f, 0xea, 0x20, 0xa, 0xad, 0x80, 0x3e, 0xa5, 0x0, 0x2e, 0xb0, 0x3a, 0xa0, 0x80,
+    0x79, 0x10, 0x1, 0xd3, 0xf0, 0x0, 0x50, 0xf, 0x60, 0x2, 0xbe, 0x40, 0x39, 0x88, 0x3, 0xc2,
+    0x22, 0x50, 0x6d, 0x51, 0x27, 0x90, 0xf, 0xa7, 0xb4, 0x2, 0x2a, 0xed, 0x80, 0xf, 0xfe, 0x8a,
+    0x4e, 0xff, 0xdb, 0x26, 0x1, 0xf8, 0xb2, 0xd8, 0x80, 0x22, 0x6c, 0xb2, 0x0, 0xe4, 0xd3, 0x0,
+    0xfe, 0x4d, 0x40, 0x8, 0xac, 0x3, 0xff, 0x83, 0x64, 0x0, 0xf0, 0xe, 0x4a, 0xca, 0x40, 0xe,
+    0xe0, 0x52, 0x0, 0xd3, 0x6a, 0x6b, 0x72, 0x1, 0x8d, 0x3c, 0x3, 0x2b, 0x0, 0x73, 0x28, 0x6,
+    0xe7, 0x0, 0xdc, 0x1, 0xf7, 0x0, 0x67, 0x20, 0xc, 0xa0, 0x1f, 0x30, 0x6, 0x30, 0xf, 0xfe,
+    0x39, 0x0, 0x65, 0x0, 0xf9, 0xc0, 0x31, 0xb8, 0x6, 0xe0, 0xf, 0xb8, 0x3, 0x27, 0x0, 0x65,
+    0x60, 0xe, 0x64, 0x0, 0xda, 0x86, 0x1, 0xa6, 0xd4, 0xd6, 0xe4, 0x3, 0x1a, 0x7, 0x0, 0x72,
+    0x56, 0x52, 0x0, 0x77, 0x0, 0xa, 0xc0, 0x3f, 0xf0, 0xe1, 0x0, 0x49, 0xa8, 0x1, 0xfc, 0x98,
+    0x60, 0x1c, 0x57, 0x8c, 0x40, 0x11, 0x36, 0x59, 0x0, 0x40,
+
+    /* U+00F9 "ù" */
+    0x0, 0x27, 0x7f, 0xda, 0x20, 0x1f, 0xf2, 0x61, 0x80, 0xb, 0x4, 0x3, 0xfe, 0x2c, 0x60, 0x1,
+    0x60, 0x80, 0x7f, 0xe9, 0x90, 0x0, 0xb4, 0x40, 0x3f, 0xf3, 0x63, 0xb9, 0x14, 0x3, 0xff, 0x82,
+    0x71, 0x12, 0x0, 0x7f, 0xf3, 0x33, 0xff, 0x18, 0x7, 0x97, 0xff, 0x50, 0x7, 0xff, 0xfc, 0x3,
+    0xff, 0xfe, 0x1, 0xe3, 0x0, 0xff, 0x38, 0x7, 0xb8, 0x3, 0x9c, 0x3, 0x60, 0x7, 0x98, 0x3,
+    0x8c, 0x3, 0x39, 0x80, 0x69, 0x10, 0xe, 0xc0, 0xe, 0xca, 0x78, 0xd6, 0x0, 0xf2, 0x10, 0x7,
+    0x2c, 0x39, 0x0, 0x7e, 0xe0, 0xf, 0xfe, 0x29, 0xd8, 0x80, 0x7c, 0x56, 0x1, 0xf2, 0x7c, 0x18,
+    0x80, 0xa4, 0xea, 0x80, 0x70,
+
+    /* U+00FA "ú" */
+    0x0, 0xfe, 0x3f, 0xfd, 0xa6, 0x1, 0xfe, 0x3d, 0x0, 0x93, 0xc, 0x3, 0xf8, 0xb4, 0x40, 0x11,
+    0x62, 0x1, 0xfc, 0x58, 0x20, 0x36, 0xe0, 0x1f, 0xf2, 0x33, 0xc7, 0xa0, 0x7, 0xfe, 0x68, 0x83,
+    0x88, 0x7, 0xff, 0x37, 0x3f, 0xf1, 0x80, 0x79, 0x7f, 0xf5, 0x0, 0x7f, 0xff, 0xc0, 0x3f, 0xff,
+    0xe0, 0x1e, 0x30, 0xf, 0xf3, 0x80, 0x7b, 0x80, 0x39, 0xc0, 0x36, 0x0, 0x79, 0x80, 0x38, 0xc0,
+    0x33, 0x98, 0x6, 0x91, 0x0, 0xec, 0x0, 0xec, 0xa7, 0x8d, 0x60, 0xf, 0x21, 0x0, 0x72, 0xc3,
+    0x90, 0x7, 0xee, 0x0, 0xff, 0xe2, 0x9d, 0x88, 0x7, 0xc5, 0x60, 0x1f, 0x27, 0xc1, 0x88, 0xa,
+    0x4e, 0xa8, 0x7,
+
+    /* U+00FD "ý" */
+    0x0, 0xff, 0x92, 0x23, 0x28, 0x7, 0xff, 0x9, 0x2d, 0xde, 0x44, 0x0, 0x7f, 0xf0, 0x4a, 0xc0,
+    0x25, 0xc1, 0x0, 0xff, 0xc3, 0x80, 0x13, 0xd0, 0x7, 0xff, 0xb, 0x44, 0x1, 0x30, 0x1, 0xff,
+    0xc2, 0x34, 0x77, 0x5b, 0x0, 0x7f, 0xf0, 0xce, 0x22, 0x40, 0xf, 0xfe, 0x90, 0xff, 0xf0, 0x80,
+    0x7e, 0x9f, 0xfc, 0x42, 0xc0, 0x1a, 0x40, 0x3e, 0x16, 0x0, 0x8c, 0x82, 0x80, 0x33, 0x0, 0x7c,
+    0xc0, 0x1a, 0x40, 0x6, 0x60, 0x8, 0x54, 0x3, 0xd4, 0x1, 0xa, 0x80, 0x52, 0x1, 0xb8, 0x3,
+    0x90, 0x80, 0x26, 0x0, 0xca, 0x20, 0x12, 0x10, 0x6, 0xe0, 0xd, 0x20, 0x1c, 0xc0, 0x1a, 0x80,
+    0x21, 0x50, 0x9, 0x44, 0x3, 0xa4, 0x3, 0x30, 0x4, 0xc0, 0x1a, 0x40, 0x3c, 0x2a, 0x1, 0xa,
+    0x80, 0x24, 0x2, 0x23, 0x0, 0xfa, 0x40, 0x34, 0x82, 0x88, 0x5, 0x60, 0x1f, 0x8c, 0xc0, 0x11,
+    0x9b, 0x80, 0x33, 0x0, 0x7f, 0x50, 0x6, 0x84, 0x0, 0x9c, 0x3, 0xfc, 0xc2, 0x1, 0x20, 0x6,
+    0xa0, 0xf, 0xf9, 0x80, 0x3e, 0x42, 0x0, 0xff, 0xa8, 0x3, 0xef, 0x0, 0xff, 0xc4, 0x80, 0x1c,
+    0x48, 0x1, 0xff, 0xc1, 0xf0, 0xe, 0xa0, 0xf, 0xfe, 0x12, 0x8, 0x6, 0x60, 0xf, 0xfe, 0x12,
+    0x8, 0x4, 0xc2, 0x1, 0xfd, 0xb2, 0x84, 0xd6, 0x1, 0xa8, 0x3, 0xf9, 0x89, 0xaf, 0x64, 0x3,
+    0x29, 0x80, 0x7f, 0x58, 0x7, 0xe1, 0xb0, 0xf, 0xe1, 0x30, 0xf, 0x8b, 0x4, 0x3, 0xf8, 0x7a,
+    0xc, 0x40, 0x4e, 0x34, 0x80, 0x3f, 0xc0,
+
+    /* U+0102 "Ă" */
+    0x0, 0xfa, 0x7f, 0xd2, 0x1, 0x87, 0xfe, 0x10, 0xf, 0xfe, 0xe, 0x0, 0x18, 0xc0, 0x2b, 0x0,
+    0x10, 0x80, 0x7f, 0xf0, 0x54, 0x80, 0x19, 0x8b, 0xe5, 0x0, 0x58, 0x7, 0xff, 0xf, 0xc8, 0x0,
+    0x68, 0x20, 0x7, 0x60, 0xf, 0xfe, 0x19, 0x6c, 0x18, 0x0, 0x57, 0x20, 0x3, 0xff, 0x8c, 0xf9,
+    0xfe, 0xea, 0x30, 0xf, 0xff, 0xc, 0x7f, 0xf0, 0x80, 0x7f, 0xf1, 0xd8, 0x3, 0x98, 0x3, 0xff,
+    0x8c, 0xc2, 0x1, 0xd2, 0x1, 0xff, 0xc6, 0xb0, 0xf, 0xa, 0x80, 0x7f, 0xf1, 0x10, 0x80, 0x3e,
+    0x90, 0xf, 0xfe, 0x27, 0x80, 0x63, 0x0, 0x8c, 0xc0, 0x1f, 0xfc, 0x22, 0x40, 0x9, 0x20, 0x3,
+    0x48, 0x7, 0xff, 0xa, 0x80, 0x37, 0xa1, 0x0, 0x4a, 0x20, 0x1f, 0xfc, 0x17, 0x0, 0x85, 0x2,
+    0x80, 0x34, 0x80, 0x7f, 0xe6, 0x0, 0xd2, 0x0, 0x60, 0xc, 0xc0, 0x1f, 0xfa, 0xc0, 0x33, 0x0,
+    0x5, 0x40, 0x21, 0x60, 0xf, 0xf2, 0x10, 0x4, 0xa2, 0x1, 0x48, 0x6, 0xb0, 0xf, 0xf7, 0x80,
+    0x6e, 0x0, 0xc6, 0x40, 0x11, 0x20, 0x7, 0xe2, 0x40, 0x8, 0x90, 0x3, 0xa8, 0x3, 0x78, 0x7,
+    0xeb, 0x0, 0xc5, 0xff, 0xe8, 0x0, 0xc8, 0x40, 0x1e, 0x16, 0x0, 0xff, 0xe2, 0xd0, 0x7, 0x98,
+    0x3, 0xff, 0x8c, 0xe0, 0x1e, 0x90, 0xf, 0xfe, 0x3b, 0x80, 0x65, 0x10, 0x8, 0xbf, 0xff, 0xd0,
+    0x1, 0xa8, 0x3, 0x48, 0x6, 0xa0, 0xf, 0xf3, 0x0, 0x62, 0x40, 0x1, 0x98, 0x3, 0x30, 0x7,
+    0xf8, 0x58, 0x3, 0x78, 0x2, 0x40, 0x32, 0x88, 0x7, 0xfd, 0x40, 0x19, 0x8, 0x54, 0x3, 0x48,
+    0x7, 0xfe, 0x32, 0x0, 0xd6,
+
+    /* U+0103 "ă" */
+    0x0, 0xf, 0xfc, 0x20, 0x1a, 0x7f, 0xd2, 0x1, 0x84, 0x80, 0x16, 0x1, 0x1b, 0x0, 0x30, 0x3,
+    0xac, 0x0, 0xbd, 0x79, 0x80, 0x1, 0x28, 0x7, 0x33, 0x80, 0x5, 0xc, 0x0, 0x3e, 0x1, 0xf4,
+    0x62, 0x88, 0x0, 0xe3, 0x88, 0x3, 0xf1, 0xd7, 0x7f, 0xb1, 0xc0, 0x3f, 0xf9, 0xa7, 0x17, 0xdf,
+    0xf6, 0x49, 0x80, 0x72, 0x66, 0x1d, 0x4, 0x2, 0x36, 0xcb, 0x10, 0xa, 0x8c, 0x3, 0xfc, 0x98,
+    0x20, 0x9, 0x0, 0xff, 0xc5, 0x0, 0x7, 0x11, 0x35, 0xef, 0x6c, 0x90, 0x6, 0x60, 0xb, 0x7a,
+    0x50, 0x84, 0x9b, 0x4, 0x3, 0x20, 0x0, 0xc0, 0x3e, 0x17, 0x0, 0xc6, 0x1, 0x2d, 0x6f, 0xff,
+    0x30, 0x6, 0xf0, 0x2d, 0xa5, 0x20, 0xf, 0xf8, 0x70, 0x80, 0x3f, 0xf8, 0x4c, 0x20, 0x11, 0xe7,
+    0xfe, 0x80, 0xe, 0xc0, 0xd, 0xe6, 0x1, 0xfe, 0x70, 0xc, 0x40, 0x1d, 0x80, 0x1c, 0xe0, 0x19,
+    0x80, 0x33, 0xa0, 0x7, 0x68, 0x6, 0x8b, 0x78, 0xd8, 0x0, 0xf3, 0x10, 0x6, 0x48, 0x72, 0x1,
+    0x0, 0xf7, 0x90, 0x7, 0xc3, 0x40, 0x1e, 0x2d, 0x94, 0x10, 0x1, 0xbf, 0xb0, 0x7,
+
+    /* U+0110 "Đ" */
+    0x0, 0xbb, 0xff, 0xfe, 0xda, 0x61, 0x0, 0xff, 0xe5, 0x12, 0xcf, 0x51, 0x0, 0x7f, 0xf3, 0x17,
+    0x58, 0x3, 0xff, 0x9b, 0x30, 0x1, 0xff, 0x3c, 0xcf, 0x3a, 0x0, 0x79, 0xd8, 0x3, 0xfd, 0x8c,
+    0xdd, 0x17, 0xca, 0x1, 0xd2, 0x20, 0x1f, 0xfc, 0x51, 0xa8, 0x0, 0xe8, 0x0, 0xff, 0xe3, 0xba,
+    0x0, 0x66, 0x0, 0xff, 0xe4, 0x40, 0x7, 0x24, 0x4c, 0x84, 0x3, 0x74, 0xce, 0x80, 0xe, 0x31,
+    0x0, 0xc6, 0xec, 0xc0, 0xe, 0x56, 0x6e, 0x0, 0xf2, 0x80, 0x6f, 0x0, 0xff, 0xe4, 0x8, 0x6,
+    0x10, 0xf, 0xfe, 0x40, 0x80, 0x61, 0xff, 0x84, 0x3, 0x5f, 0xfe, 0xe0, 0xf, 0x28, 0x6, 0xf0,
+    0xf, 0xfe, 0x39, 0x88, 0x6, 0x30, 0xf, 0xfe, 0x3c, 0x0, 0x72, 0x0, 0x7f, 0xf1, 0x9d, 0x0,
+    0x33, 0x0, 0x7f, 0xf1, 0x46, 0xa0, 0x3, 0xa0, 0x3, 0xfb, 0x19, 0xba, 0x2f, 0x94, 0x3, 0xa4,
+    0x40, 0x3f, 0x9e, 0x67, 0x9d, 0x0, 0x3c, 0xec, 0x1, 0xff, 0xcb, 0x98, 0x0, 0xff, 0xe5, 0x2e,
+    0xb0, 0x7, 0xff, 0x1c, 0x96, 0x7a, 0x88, 0x3, 0x80,
+
+    /* U+0111 "đ" */
+    0x0, 0xff, 0xe0, 0x8c, 0x46, 0x60, 0xf, 0xfe, 0x21, 0xbb, 0xeb, 0x0, 0xff, 0xbf, 0xfb, 0x40,
+    0x31, 0x7f, 0x88, 0x3, 0xff, 0xd1, 0xff, 0xda, 0x1, 0x8b, 0xfc, 0x40, 0x1f, 0xfc, 0xe1, 0x7b,
+    0xef, 0xf6, 0x38, 0x80, 0x7f, 0xe5, 0xf8, 0x41, 0x0, 0x1c, 0x72, 0x80, 0x7f, 0x9e, 0x84, 0x3,
+    0xf4, 0x0, 0x7f, 0x24, 0x0, 0x7f, 0xf2, 0x28, 0x3, 0x92, 0xb2, 0x94, 0x3, 0xfc, 0xa2, 0x1,
+    0xa2, 0xd4, 0xd6, 0xa8, 0x1, 0xfd, 0xe0, 0x19, 0x1c, 0x3, 0x95, 0x40, 0x1f, 0x9c, 0x3, 0x70,
+    0x7, 0xdc, 0x1, 0xf8, 0xc0, 0x33, 0x80, 0x7c, 0xa0, 0x1f, 0xfd, 0x23, 0x0, 0xce, 0x1, 0xf2,
+    0x80, 0x7e, 0x70, 0xd, 0xc0, 0x1f, 0x70, 0x7, 0xef, 0x0, 0xc8, 0xe0, 0x1c, 0xca, 0x1, 0xf9,
+    0x48, 0x3, 0x45, 0xa9, 0xad, 0x48, 0x7, 0xfa, 0x40, 0x39, 0x2b, 0x29, 0x40, 0x3f, 0xe4, 0x80,
+    0xf, 0xfe, 0x4b, 0xd0, 0x80, 0x7e, 0xa1, 0x0, 0xff, 0x2f, 0x4a, 0x8, 0x0, 0xdf, 0x94, 0x3,
+    0xf0,
+
+    /* U+0128 "Ĩ" */
+    0x0, 0x47, 0x7d, 0x90, 0x2, 0x6e, 0x1, 0xdc, 0x20, 0x98, 0x84, 0xc8, 0x61, 0x20, 0x18, 0x6f,
+    0x40, 0x18, 0x42, 0xb, 0xec, 0x1, 0xcc, 0xc0, 0x6, 0x4, 0xc0, 0x81, 0xe0, 0xa7, 0xf9, 0x80,
+    0xf, 0xdf, 0x86, 0x1, 0xff, 0xc4, 0x5f, 0xfd, 0xa0, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8, 0x7,
+    0xff, 0xfc, 0x3, 0xff, 0xbc,
+
+    /* U+0129 "ĩ" */
+    0x1, 0xbf, 0xe6, 0x0, 0x25, 0xd8, 0x1, 0xa8, 0x3, 0x32, 0xf, 0x44, 0x1, 0x98, 0x3, 0x37,
+    0xa0, 0x18, 0x28, 0x2, 0xf8, 0xc0, 0x34, 0x80, 0x4, 0x48, 0x38, 0xe4, 0x49, 0x50, 0x6e, 0xe0,
+    0x5, 0x1b, 0xa6, 0x0, 0xff, 0xe2, 0xdf, 0xfe, 0x40, 0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3,
+    0xff, 0xda,
+
+    /* U+0168 "Ũ" */
+    0x0, 0xff, 0xe7, 0xd, 0xff, 0xb1, 0x0, 0x28, 0xcc, 0x0, 0x7f, 0x6a, 0x0, 0xe, 0xe8, 0x4d,
+    0xcc, 0x80, 0x3f, 0x29, 0x80, 0x72, 0xf6, 0x0, 0x1c, 0x3, 0xf7, 0x80, 0x23, 0xe4, 0x3, 0xd0,
+    0x1, 0xf9, 0x80, 0xe, 0xd, 0xcc, 0x0, 0x3c, 0x10, 0xf, 0xd9, 0xfe, 0x0, 0x86, 0x7f, 0xd8,
+    0x60, 0x1f, 0xfc, 0xe8, 0xff, 0xd4, 0x1, 0xfc, 0xdf, 0xfb, 0x0, 0x3f, 0xff, 0xe0, 0x1f, 0xff,
+    0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0x39, 0xc0, 0x38, 0x40, 0x3f, 0xf8, 0x7c, 0x1, 0x98, 0x3,
+    0xfb, 0x80, 0x30, 0x90, 0x6, 0x21, 0x0, 0xfc, 0xa0, 0x1b, 0x50, 0x3, 0xa0, 0x3, 0xe4, 0x20,
+    0xc, 0x80, 0xa0, 0x19, 0x9c, 0x3, 0x92, 0xc0, 0x30, 0x98, 0x48, 0x7, 0x47, 0x54, 0x4e, 0xd8,
+    0x7, 0x40, 0x0, 0xdc, 0x3, 0x85, 0x5d, 0x88, 0x3, 0x8d, 0x80, 0x28, 0x60, 0xf, 0xfe, 0x9,
+    0xe8, 0x7, 0x4c, 0x84, 0x3, 0xfc, 0xf8, 0x20, 0x1e, 0x6e, 0xa5, 0x20, 0x8, 0x52, 0x7a, 0x0,
+    0x30,
+
+    /* U+0169 "ũ" */
+    0x0, 0xcb, 0xbf, 0xac, 0x1, 0x2d, 0xd8, 0x3, 0xc9, 0x44, 0x5, 0x36, 0x43, 0x8, 0xa0, 0x1e,
+    0x80, 0xe, 0x4d, 0xe2, 0x4, 0x0, 0xe1, 0x30, 0x3f, 0xd3, 0x0, 0xe8, 0x0, 0xe3, 0x11, 0x48,
+    0x16, 0x41, 0xa, 0x61, 0x0, 0x71, 0x77, 0x14, 0x2, 0x7d, 0xeb, 0x30, 0xf, 0xfe, 0x56, 0x7f,
+    0xe3, 0x0, 0xf2, 0xff, 0xea, 0x0, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xc0, 0x3c, 0x60, 0x1f, 0xe7,
+    0x0, 0xf7, 0x0, 0x73, 0x80, 0x6c, 0x0, 0xf3, 0x0, 0x71, 0x80, 0x67, 0x30, 0xd, 0x22, 0x1,
+    0xd8, 0x1, 0xd9, 0x4f, 0x1a, 0xc0, 0x1e, 0x42, 0x0, 0xe5, 0x87, 0x20, 0xf, 0xdc, 0x1, 0xff,
+    0xc5, 0x3b, 0x10, 0xf, 0x8a, 0xc0, 0x3e, 0x4f, 0x83, 0x10, 0x14, 0x9d, 0x50, 0xe,
+
+    /* U+01A0 "Ơ" */
+    0x0, 0xff, 0xe4, 0x8b, 0x48, 0x7, 0xff, 0x24, 0xfa, 0x58, 0xc0, 0x3f, 0xf9, 0x6, 0x20, 0x4,
+    0x0, 0xff, 0xe4, 0x98, 0x3, 0xc0, 0x3f, 0xf8, 0xe3, 0x4, 0x0, 0xe0, 0xf, 0x85, 0xab, 0x7f,
+    0xff, 0x73, 0x80, 0x4e, 0x1, 0xc3, 0x3d, 0x2a, 0x40, 0x1f, 0xfa, 0xc4, 0x3, 0x2f, 0x30, 0x7,
+    0xff, 0x9, 0xb5, 0x0, 0x33, 0xd0, 0x7, 0xff, 0x10, 0x88, 0x1, 0x9a, 0x0, 0x3c, 0x4a, 0xca,
+    0x40, 0x1e, 0x49, 0x0, 0x8a, 0x40, 0x39, 0x37, 0x55, 0x35, 0xba, 0x40, 0xe, 0x63, 0x0, 0x40,
+    0x7, 0x3d, 0x90, 0x7, 0x15, 0xb8, 0x7, 0x40, 0xa, 0x80, 0x65, 0x80, 0xf, 0xe8, 0x50, 0xc,
+    0x84, 0xe0, 0x1d, 0x0, 0x1f, 0xf4, 0x0, 0x72, 0x78, 0x6, 0x32, 0x0, 0xff, 0x88, 0xc0, 0x36,
+    0x10, 0x6, 0x50, 0xf, 0xfe, 0xa, 0x0, 0x61, 0x0, 0xe1, 0x0, 0xff, 0xe0, 0xf8, 0x6, 0x70,
+    0xe, 0x10, 0xf, 0xfe, 0xf, 0x80, 0x67, 0x20, 0xc, 0xa0, 0x1f, 0xfc, 0x14, 0x0, 0xc7, 0x80,
+    0x18, 0xc8, 0x3, 0xfe, 0x23, 0x0, 0xda, 0x80, 0x1d, 0x0, 0x1f, 0xf4, 0x0, 0x72, 0x8a, 0x80,
+    0x65, 0x70, 0xf, 0xe8, 0x50, 0xc, 0xc0, 0xb, 0x0, 0xe8, 0xa2, 0x0, 0xe2, 0xb7, 0x0, 0xc3,
+    0x0, 0x1, 0x90, 0xe, 0x5d, 0xc9, 0x89, 0xdd, 0x20, 0x7, 0x58, 0x80, 0x4d, 0x0, 0x1e, 0x36,
+    0x76, 0x20, 0xf, 0x4a, 0x80, 0x73, 0xc8, 0x7, 0xff, 0xe, 0x98, 0x3, 0xe6, 0xd5, 0x0, 0xff,
+    0x9b, 0x94, 0x3, 0xf8, 0xab, 0xa5, 0x48, 0x2, 0x25, 0x9e, 0x91, 0x0, 0xe0,
+
+    /* U+01A1 "ơ" */
+    0x0, 0xff, 0xe1, 0x94, 0x60, 0x7, 0xff, 0xc, 0x75, 0xcd, 0x80, 0x3f, 0xf8, 0x42, 0xa0, 0xc,
+    0x0, 0xff, 0xe3, 0x8, 0x7, 0xff, 0x9, 0x14, 0x0, 0x60, 0x1c, 0x73, 0xbf, 0xfe, 0xb0, 0xa,
+    0x80, 0x22, 0xcc, 0x31, 0x0, 0x7f, 0x49, 0x0, 0x13, 0x4c, 0x3, 0xfe, 0x66, 0x0, 0xa, 0xc0,
+    0x3f, 0xf8, 0x2c, 0x80, 0xf, 0x0, 0xe4, 0xac, 0xa4, 0x0, 0xea, 0x5, 0x20, 0xd, 0x36, 0xa6,
+    0xb7, 0x20, 0x18, 0x57, 0xc0, 0x32, 0xb0, 0x7, 0x32, 0x80, 0x6f, 0x70, 0xd, 0xc0, 0x1f, 0x70,
+    0x6, 0x72, 0x0, 0xca, 0x1, 0xf3, 0x0, 0x63, 0x0, 0xff, 0xe3, 0x90, 0x6, 0x50, 0xf, 0x9c,
+    0x3, 0x13, 0x80, 0x6e, 0x0, 0xfb, 0x80, 0x32, 0xf0, 0x6, 0x56, 0x0, 0xe6, 0x40, 0xd, 0x48,
+    0x60, 0x1a, 0x6d, 0x4d, 0x6e, 0x40, 0x32, 0x18, 0x70, 0x7, 0x25, 0x65, 0x20, 0x6, 0x19, 0x0,
+    0x15, 0x80, 0x7f, 0xe1, 0xd2, 0x0, 0x93, 0x50, 0x3, 0xf9, 0x3c, 0xc0, 0x38, 0xaf, 0x18, 0x80,
+    0x22, 0x6c, 0xb1, 0x0, 0x80,
+
+    /* U+01AF "Ư" */
+    0x0, 0xff, 0xf0, 0x94, 0x74, 0x80, 0x7f, 0xf2, 0x55, 0xc5, 0x80, 0x3f, 0xf9, 0x2a, 0x1, 0x10,
+    0x7, 0xff, 0x20, 0x40, 0x3f, 0xf9, 0x63, 0x0, 0x11, 0xc7, 0xfe, 0xa0, 0xf, 0xe6, 0xff, 0xb9,
+    0x0, 0x6, 0x20, 0x1f, 0xfc, 0xbf, 0x0, 0xff, 0xe5, 0x15, 0x98, 0x7, 0xff, 0x24, 0xf5, 0x0,
+    0x3f, 0xff, 0xe0, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0xe3, 0x80, 0x7f, 0x8, 0x7, 0xff, 0x1f, 0x80,
+    0x33, 0x0, 0x7f, 0x70, 0x6, 0x10, 0xc, 0x40, 0x18, 0x84, 0x3, 0xf2, 0x80, 0x6d, 0x0, 0xc8,
+    0x1, 0xd0, 0x1, 0xf2, 0x10, 0x6, 0x40, 0xe, 0x50, 0xc, 0xce, 0x1, 0xc9, 0x60, 0x18, 0x4c,
+    0x3, 0xa4, 0x3, 0xa3, 0xaa, 0x27, 0x6c, 0x3, 0xa0, 0x3, 0xc6, 0xe0, 0x1c, 0x2a, 0xec, 0x40,
+    0x1c, 0x6c, 0x1, 0xf4, 0x30, 0x7, 0xff, 0x4, 0xf4, 0x3, 0xfa, 0x64, 0x20, 0x1f, 0xe7, 0xc1,
+    0x0, 0xff, 0x37, 0x52, 0x90, 0x4, 0x29, 0x3d, 0x0, 0x1f, 0x80,
+
+    /* U+01B0 "ư" */
+    0x0, 0xff, 0xed, 0x36, 0x70, 0x7, 0xff, 0x14, 0x64, 0xc5, 0x40, 0x3f, 0xf8, 0x82, 0x40, 0xd,
+    0x0, 0xff, 0xec, 0xb9, 0x0, 0x3b, 0x3f, 0xf1, 0x80, 0x79, 0x7f, 0xe8, 0x0, 0x90, 0x3, 0xff,
+    0x8e, 0xe4, 0x1, 0xff, 0xc6, 0x78, 0x0, 0xff, 0xe3, 0x2c, 0x0, 0x7f, 0xff, 0xc0, 0x3f, 0xfc,
+    0x6, 0x1, 0xff, 0xc1, 0x70, 0xf, 0x70, 0x7, 0xe7, 0x0, 0xd8, 0x1, 0xe6, 0x0, 0xfc, 0x60,
+    0x19, 0xcc, 0x3, 0x48, 0x80, 0x7e, 0xc0, 0xe, 0xca, 0x78, 0xd6, 0x0, 0xfe, 0x42, 0x0, 0xe5,
+    0x87, 0x20, 0xf, 0xfb, 0x80, 0x3f, 0xf9, 0x7, 0x62, 0x1, 0xf1, 0x58, 0x7, 0xf9, 0x3e, 0xc,
+    0x40, 0x52, 0x75, 0x40, 0x3f,
+
+    /* U+1EA0 "Ạ" */
+    0x0, 0xff, 0x47, 0xff, 0x8, 0x7, 0xff, 0x1d, 0x80, 0x39, 0x80, 0x3f, 0xf8, 0xcc, 0x20, 0x1d,
+    0x20, 0x1f, 0xfc, 0x6b, 0x0, 0xf0, 0xa8, 0x7, 0xff, 0x11, 0x8, 0x3, 0xe9, 0x0, 0xff, 0xe2,
+    0x78, 0x6, 0x30, 0x8, 0xcc, 0x1, 0xff, 0xc2, 0x24, 0x0, 0x92, 0x0, 0x34, 0x80, 0x7f, 0xf0,
+    0xa8, 0x3, 0x7a, 0x10, 0x4, 0xa2, 0x1, 0xff, 0xc1, 0x70, 0x8, 0x50, 0x28, 0x3, 0x48, 0x7,
+    0xfe, 0x60, 0xd, 0x20, 0x6, 0x0, 0xcc, 0x1, 0xff, 0xac, 0x3, 0x30, 0x0, 0x54, 0x2, 0x16,
+    0x0, 0xff, 0x21, 0x0, 0x4a, 0x20, 0x14, 0x80, 0x6b, 0x0, 0xff, 0x78, 0x6, 0xe0, 0xc, 0x64,
+    0x1, 0x12, 0x0, 0x7e, 0x24, 0x0, 0x89, 0x0, 0x3a, 0x80, 0x37, 0x80, 0x7e, 0xb0, 0xc, 0x5f,
+    0xfe, 0x80, 0xc, 0x84, 0x1, 0xe1, 0x60, 0xf, 0xfe, 0x2d, 0x0, 0x79, 0x80, 0x3f, 0xf8, 0xce,
+    0x1, 0xe9, 0x0, 0xff, 0xe3, 0xb8, 0x6, 0x51, 0x0, 0x8b, 0xff, 0xfd, 0x0, 0x1a, 0x80, 0x34,
+    0x80, 0x6a, 0x0, 0xff, 0x30, 0x6, 0x24, 0x0, 0x19, 0x80, 0x33, 0x0, 0x7f, 0x85, 0x80, 0x37,
+    0x80, 0x24, 0x3, 0x28, 0x80, 0x7f, 0xd4, 0x1, 0x90, 0x85, 0x40, 0x34, 0x80, 0x7f, 0xe3, 0x20,
+    0xd, 0x63, 0xff, 0xc6, 0x1, 0xff, 0xc1, 0xdf, 0xfd, 0x20, 0x1f, 0xfd, 0x95, 0xef, 0xa1, 0x0,
+    0xff, 0xe4, 0x15, 0x8, 0x2d, 0x80, 0x7f, 0xf2, 0x10, 0x3, 0x20, 0x7, 0xff, 0x20, 0xc0, 0x31,
+    0x80, 0x7f, 0xf2, 0x14, 0x80, 0x28, 0x0, 0xff, 0xe4, 0xe4, 0x3d, 0xa8, 0x7, 0xf8,
+
+    /* U+1EA1 "ạ" */
+    0x0, 0x8e, 0x2f, 0xbf, 0xec, 0x93, 0x0, 0xe4, 0xcc, 0x3a, 0x8, 0x4, 0x6d, 0x96, 0x20, 0x15,
+    0x18, 0x7, 0xf9, 0x30, 0x40, 0x12, 0x1, 0xff, 0x8a, 0x0, 0xe, 0x22, 0x6b, 0xde, 0xd9, 0x20,
+    0xc, 0xc0, 0x16, 0xf4, 0xa1, 0x9, 0x36, 0x8, 0x6, 0x40, 0x1, 0x80, 0x7c, 0x2e, 0x1, 0x8c,
+    0x2, 0x5a, 0xdf, 0xfe, 0x60, 0xd, 0xe0, 0x5b, 0x4a, 0x40, 0x1f, 0xf0, 0xe1, 0x0, 0x7f, 0xf0,
+    0x98, 0x40, 0x23, 0xcf, 0xfd, 0x0, 0x1d, 0x80, 0x1b, 0xcc, 0x3, 0xfc, 0xe0, 0x18, 0x80, 0x3b,
+    0x0, 0x39, 0xc0, 0x33, 0x0, 0x67, 0x40, 0xe, 0xd0, 0xd, 0x16, 0xf1, 0xb0, 0x1, 0xe6, 0x20,
+    0xc, 0x90, 0xe4, 0x2, 0x1, 0xef, 0x20, 0xf, 0x86, 0x80, 0x3c, 0x5b, 0x28, 0x20, 0x3, 0x7f,
+    0x60, 0xf, 0xcd, 0x7d, 0xfe, 0xc8, 0x12, 0xff, 0xd0, 0x1, 0xf3, 0x42, 0x80, 0x7f, 0xf0, 0x72,
+    0x5e, 0xa0, 0x3, 0xfe, 0x33, 0x0, 0x4e, 0x1, 0xff, 0x38, 0x7, 0xff, 0x11, 0x40, 0x31, 0x80,
+    0x7f, 0xc3, 0x64, 0x9, 0xa0, 0x1e,
+
+    /* U+1EA2 "Ả" */
+    0x0, 0xff, 0x24, 0x54, 0x18, 0x7, 0xff, 0x22, 0xad, 0xd5, 0xf1, 0xc0, 0x3f, 0xf8, 0xfa, 0x1,
+    0xd0, 0x40, 0x1f, 0xfc, 0x67, 0x9f, 0xe2, 0x0, 0x20, 0x7, 0xff, 0x1d, 0x80, 0x54, 0x3, 0xff,
+    0x98, 0x2a, 0x0, 0x40, 0xf, 0xfe, 0x4e, 0x10, 0x31, 0x0, 0x7f, 0xf2, 0x78, 0x5e, 0x40, 0x3f,
+    0xf9, 0x47, 0xd0, 0x1, 0xff, 0xc9, 0x8f, 0xfe, 0x10, 0xf, 0xfe, 0x3b, 0x0, 0x73, 0x0, 0x7f,
+    0xf1, 0x98, 0x40, 0x3a, 0x40, 0x3f, 0xf8, 0xd6, 0x1, 0xe1, 0x50, 0xf, 0xfe, 0x22, 0x10, 0x7,
+    0xd2, 0x1, 0xff, 0xc4, 0xf0, 0xc, 0x60, 0x11, 0x98, 0x3, 0xff, 0x84, 0x48, 0x1, 0x24, 0x0,
+    0x69, 0x0, 0xff, 0xe1, 0x50, 0x6, 0xf4, 0x20, 0x9, 0x44, 0x3, 0xff, 0x82, 0xe0, 0x10, 0xa0,
+    0x50, 0x6, 0x90, 0xf, 0xfc, 0xc0, 0x1a, 0x40, 0xc, 0x1, 0x98, 0x3, 0xff, 0x58, 0x6, 0x60,
+    0x0, 0xa8, 0x4, 0x2c, 0x1, 0xfe, 0x42, 0x0, 0x94, 0x40, 0x29, 0x0, 0xd6, 0x1, 0xfe, 0xf0,
+    0xd, 0xc0, 0x18, 0xc8, 0x2, 0x24, 0x0, 0xfc, 0x48, 0x1, 0x12, 0x0, 0x75, 0x0, 0x6f, 0x0,
+    0xfd, 0x60, 0x18, 0xbf, 0xfd, 0x0, 0x19, 0x8, 0x3, 0xc2, 0xc0, 0x1f, 0xfc, 0x5a, 0x0, 0xf3,
+    0x0, 0x7f, 0xf1, 0x9c, 0x3, 0xd2, 0x1, 0xff, 0xc7, 0x70, 0xc, 0xa2, 0x1, 0x17, 0xff, 0xfa,
+    0x0, 0x35, 0x0, 0x69, 0x0, 0xd4, 0x1, 0xfe, 0x60, 0xc, 0x48, 0x0, 0x33, 0x0, 0x66, 0x0,
+    0xff, 0xb, 0x0, 0x6f, 0x0, 0x48, 0x6, 0x51, 0x0, 0xff, 0xa8, 0x3, 0x21, 0xa, 0x80, 0x69,
+    0x0, 0xff, 0xc6, 0x40, 0x1a, 0xc0,
+
+    /* U+1EA3 "ả" */
+    0x0, 0xf2, 0x45, 0x38, 0x80, 0x7f, 0xd9, 0x6e, 0xb1, 0xc8, 0x1, 0xfe, 0x60, 0xe, 0xa0, 0xf,
+    0xf4, 0x57, 0xe8, 0x80, 0xa0, 0x7, 0xf1, 0x28, 0x12, 0x0, 0x7f, 0xf1, 0x10, 0x0, 0xa0, 0x1f,
+    0xf0, 0xe0, 0x83, 0x8, 0x7, 0xfc, 0x2a, 0xb, 0x20, 0x1f, 0xfc, 0x19, 0xca, 0x0, 0xff, 0xe1,
+    0x98, 0x7, 0xf8, 0xe2, 0xfb, 0xfe, 0xc9, 0x30, 0xe, 0x4c, 0xc3, 0xa0, 0x80, 0x46, 0xd9, 0x62,
+    0x1, 0x51, 0x80, 0x7f, 0x93, 0x4, 0x1, 0x20, 0x1f, 0xf8, 0xa0, 0x0, 0xe2, 0x26, 0xbd, 0xed,
+    0x92, 0x0, 0xcc, 0x1, 0x6f, 0x4a, 0x10, 0x93, 0x60, 0x80, 0x64, 0x0, 0x18, 0x7, 0xc2, 0xe0,
+    0x18, 0xc0, 0x25, 0xad, 0xff, 0xe6, 0x0, 0xde, 0x5, 0xb4, 0xa4, 0x1, 0xff, 0xe, 0x10, 0x7,
+    0xff, 0x9, 0x84, 0x2, 0x3c, 0xff, 0xd0, 0x1, 0xd8, 0x1, 0xbc, 0xc0, 0x3f, 0xce, 0x1, 0x88,
+    0x3, 0xb0, 0x3, 0x9c, 0x3, 0x30, 0x6, 0x74, 0x0, 0xed, 0x0, 0xd1, 0x6f, 0x1b, 0x0, 0x1e,
+    0x62, 0x0, 0xc9, 0xe, 0x40, 0x20, 0x1e, 0xf2, 0x0, 0xf8, 0x68, 0x3, 0xc5, 0xb2, 0x82, 0x0,
+    0x37, 0xf6, 0x0, 0xe0,
+
+    /* U+1EA4 "Ấ" */
+    0x0, 0xff, 0xe4, 0x88, 0xf0, 0x7, 0xff, 0x1c, 0x77, 0xba, 0xc3, 0x0, 0xff, 0xe3, 0xe9, 0x0,
+    0x17, 0x48, 0x3, 0xff, 0x8d, 0x46, 0x0, 0x8a, 0x0, 0xff, 0xc7, 0x57, 0x74, 0x3, 0xa0, 0x8a,
+    0xdc, 0x3, 0xff, 0x26, 0x2a, 0x24, 0xf6, 0xfd, 0xd2, 0x0, 0x7f, 0xe6, 0xb0, 0x2, 0x48, 0x1,
+    0x30, 0x40, 0x3f, 0xf8, 0x4f, 0x20, 0x9, 0xb6, 0xe4, 0x3, 0xc2, 0x0, 0xff, 0xe0, 0xb7, 0x74,
+    0xc0, 0x1, 0xbe, 0xe6, 0x18, 0x7, 0xff, 0x4, 0x47, 0x0, 0x70, 0x8e, 0x0, 0xff, 0xe2, 0x47,
+    0xff, 0x8, 0x7, 0xff, 0x1d, 0x80, 0x39, 0x80, 0x3f, 0xf8, 0xcc, 0x20, 0x1d, 0x20, 0x1f, 0xfc,
+    0x6b, 0x0, 0xf0, 0xa8, 0x7, 0xff, 0x11, 0x8, 0x3, 0xe9, 0x0, 0xff, 0xe2, 0x78, 0x6, 0x30,
+    0x8, 0xcc, 0x1, 0xff, 0xc2, 0x24, 0x0, 0x92, 0x0, 0x34, 0x80, 0x7f, 0xf0, 0xa8, 0x3, 0x7a,
+    0x10, 0x4, 0xa2, 0x1, 0xff, 0xc1, 0x70, 0x8, 0x50, 0x28, 0x3, 0x48, 0x7, 0xfe, 0x60, 0xd,
+    0x20, 0x6, 0x0, 0xcc, 0x1, 0xff, 0xac, 0x3, 0x30, 0x0, 0x54, 0x2, 0x16, 0x0, 0xff, 0x21,
+    0x0, 0x4a, 0x20, 0x14, 0x80, 0x6b, 0x0, 0xff, 0x78, 0x6, 0xe0, 0xc, 0x64, 0x1, 0x12, 0x0,
+    0x7e, 0x24, 0x0, 0x89, 0x0, 0x3a, 0x80, 0x37, 0x80, 0x7e, 0xb0, 0xc, 0x5f, 0xfe, 0x80, 0xc,
+    0x84, 0x1, 0xe1, 0x60, 0xf, 0xfe, 0x2d, 0x0, 0x79, 0x80, 0x3f, 0xf8, 0xce, 0x1, 0xe9, 0x0,
+    0xff, 0xe3, 0xb8, 0x6, 0x51, 0x0, 0x8b, 0xff, 0xfd, 0x0, 0x1a, 0x80, 0x34, 0x80, 0x6a, 0x0,
+    0xff, 0x30, 0x6, 0x24, 0x0, 0x19, 0x80, 0x33, 0x0, 0x7f, 0x85, 0x80, 0x37, 0x80, 0x24, 0x3,
+    0x28, 0x80, 0x7f, 0xd4, 0x1, 0x90, 0x85, 0x40, 0x34, 0x80, 0x7f, 0xe3, 0x20, 0xd, 0x60,
+
+    /* U+1EA5 "ấ" */
+    0x0, 0xff, 0xe2, 0x3c, 0x44, 0xe0, 0x1f, 0xfc, 0x4b, 0x87, 0x72, 0xa8, 0x3, 0xff, 0x87, 0x28,
+    0x0, 0x5d, 0x20, 0xf, 0xfe, 0x14, 0x30, 0x2, 0x28, 0x3, 0xf0, 0xef, 0xfe, 0x71, 0x7, 0x75,
+    0xb8, 0x7, 0xe2, 0xf2, 0x0, 0xd1, 0x31, 0x12, 0x0, 0x7e, 0x2c, 0x10, 0x1a, 0x60, 0x3, 0xc8,
+    0x7, 0xf8, 0xf0, 0x41, 0x7d, 0x66, 0xc4, 0x1a, 0x80, 0x3f, 0x8f, 0xbf, 0xd4, 0x20, 0x4, 0xef,
+    0xf5, 0x0, 0x7f, 0xf5, 0xe, 0x2f, 0xbf, 0xec, 0x93, 0x0, 0xff, 0x26, 0x61, 0xd0, 0x40, 0x23,
+    0x6c, 0xb1, 0x0, 0xfd, 0x46, 0x1, 0xfe, 0x4c, 0x10, 0xf, 0xa4, 0x3, 0xff, 0x14, 0x0, 0x7c,
+    0xe2, 0x26, 0xbd, 0xed, 0x92, 0x0, 0xcc, 0x1, 0xfb, 0x7a, 0x50, 0x84, 0x9b, 0x4, 0x3, 0x20,
+    0x7, 0xc6, 0x1, 0xf0, 0xb8, 0x6, 0x30, 0xf, 0xcb, 0x5b, 0xff, 0xcc, 0x1, 0xbc, 0x3, 0xc5,
+    0xb4, 0xa4, 0x1, 0xff, 0xc4, 0x1c, 0x20, 0xf, 0xfe, 0x3b, 0x8, 0x4, 0x79, 0xff, 0xa0, 0x3,
+    0xfd, 0x80, 0x1b, 0xcc, 0x3, 0xff, 0x86, 0xe0, 0x18, 0x80, 0x3b, 0x0, 0x3f, 0xce, 0x1, 0x98,
+    0x3, 0x3a, 0x0, 0x7f, 0xb4, 0x3, 0x45, 0xbc, 0x6c, 0x0, 0x7f, 0xcc, 0x40, 0x19, 0x21, 0xc8,
+    0x4, 0x3, 0xfe, 0xf2, 0x0, 0xf8, 0x68, 0x3, 0xfe, 0x2d, 0x94, 0x10, 0x1, 0xbf, 0xb0, 0x7,
+    0xf8,
+
+    /* U+1EA6 "Ầ" */
+    0x0, 0xff, 0xe1, 0x11, 0x70, 0x7, 0xff, 0x25, 0xb3, 0x76, 0xa0, 0xf, 0xfe, 0x42, 0x79, 0x80,
+    0x16, 0x0, 0x3f, 0xf9, 0x3, 0x8a, 0x0, 0x76, 0x0, 0xff, 0xe1, 0x26, 0x66, 0xa0, 0xa9, 0x22,
+    0x59, 0x80, 0x7f, 0xe5, 0xb3, 0x3c, 0xb8, 0x2d, 0xbb, 0x18, 0x7, 0xfc, 0xf4, 0x0, 0x5a, 0x10,
+    0x3c, 0x20, 0xf, 0xfe, 0x14, 0xc0, 0xd, 0x51, 0x7d, 0x40, 0xb0, 0xc0, 0x3f, 0xf8, 0x33, 0xfe,
+    0xe5, 0x0, 0xd, 0x7f, 0xb8, 0xc0, 0x3f, 0xfb, 0xd1, 0xff, 0xc2, 0x1, 0xff, 0xc7, 0x60, 0xe,
+    0x60, 0xf, 0xfe, 0x33, 0x8, 0x7, 0x48, 0x7, 0xff, 0x1a, 0xc0, 0x3c, 0x2a, 0x1, 0xff, 0xc4,
+    0x42, 0x0, 0xfa, 0x40, 0x3f, 0xf8, 0x9e, 0x1, 0x8c, 0x2, 0x33, 0x0, 0x7f, 0xf0, 0x89, 0x0,
+    0x24, 0x80, 0xd, 0x20, 0x1f, 0xfc, 0x2a, 0x0, 0xde, 0x84, 0x1, 0x28, 0x80, 0x7f, 0xf0, 0x5c,
+    0x2, 0x14, 0xa, 0x0, 0xd2, 0x1, 0xff, 0x98, 0x3, 0x48, 0x1, 0x80, 0x33, 0x0, 0x7f, 0xeb,
+    0x0, 0xcc, 0x0, 0x15, 0x0, 0x85, 0x80, 0x3f, 0xc8, 0x40, 0x12, 0x88, 0x5, 0x20, 0x1a, 0xc0,
+    0x3f, 0xde, 0x1, 0xb8, 0x3, 0x19, 0x0, 0x44, 0x80, 0x1f, 0x89, 0x0, 0x22, 0x40, 0xe, 0xa0,
+    0xd, 0xe0, 0x1f, 0xac, 0x3, 0x17, 0xff, 0xa0, 0x3, 0x21, 0x0, 0x78, 0x58, 0x3, 0xff, 0x8b,
+    0x40, 0x1e, 0x60, 0xf, 0xfe, 0x33, 0x80, 0x7a, 0x40, 0x3f, 0xf8, 0xee, 0x1, 0x94, 0x40, 0x22,
+    0xff, 0xff, 0x40, 0x6, 0xa0, 0xd, 0x20, 0x1a, 0x80, 0x3f, 0xcc, 0x1, 0x89, 0x0, 0x6, 0x60,
+    0xc, 0xc0, 0x1f, 0xe1, 0x60, 0xd, 0xe0, 0x9, 0x0, 0xca, 0x20, 0x1f, 0xf5, 0x0, 0x64, 0x21,
+    0x50, 0xd, 0x20, 0x1f, 0xf8, 0xc8, 0x3, 0x58,
+
+    /* U+1EA7 "ầ" */
+    0x0, 0xfe, 0x12, 0x2c, 0x20, 0x1f, 0xfc, 0x11, 0x8d, 0xdb, 0x8c, 0x3, 0xff, 0x83, 0x52, 0x1,
+    0x69, 0x0, 0x7f, 0xf0, 0x5b, 0x4, 0x7, 0xc4, 0x3, 0xea, 0xcc, 0xc8, 0x7e, 0x86, 0x30, 0x1,
+    0xc3, 0x8a, 0x67, 0xad, 0x86, 0xf3, 0x12, 0x1, 0x8b, 0xc, 0x6, 0x98, 0x1, 0x30, 0x1, 0xf1,
+    0xe1, 0x2, 0xfa, 0xcd, 0x88, 0x3c, 0x80, 0x78, 0xfb, 0xfd, 0x42, 0x0, 0x4e, 0xff, 0x48, 0x7,
+    0xff, 0x38, 0xe2, 0xfb, 0xfe, 0xc9, 0x30, 0xf, 0x93, 0x30, 0xe8, 0x20, 0x11, 0xb6, 0x58, 0x80,
+    0x75, 0x18, 0x7, 0xf9, 0x30, 0x40, 0x34, 0x80, 0x7f, 0xe2, 0x80, 0xc, 0xe2, 0x26, 0xbd, 0xed,
+    0x92, 0x0, 0xcc, 0x1, 0xdb, 0xd2, 0x84, 0x24, 0xd8, 0x20, 0x19, 0x0, 0x31, 0x80, 0x7c, 0x2e,
+    0x1, 0x8c, 0x3, 0x96, 0xb7, 0xff, 0x98, 0x3, 0x78, 0x4, 0x5b, 0x4a, 0x40, 0x1f, 0xfc, 0x11,
+    0xc2, 0x0, 0xff, 0xe2, 0x30, 0x80, 0x47, 0x9f, 0xfa, 0x0, 0x3e, 0xc0, 0xd, 0xe6, 0x1, 0xff,
+    0x9c, 0x3, 0x10, 0x7, 0x60, 0x7, 0xce, 0x1, 0x98, 0x3, 0x3a, 0x0, 0x7d, 0xa0, 0x1a, 0x2d,
+    0xe3, 0x60, 0x3, 0xf3, 0x10, 0x6, 0x48, 0x72, 0x1, 0x0, 0xfd, 0xe4, 0x1, 0xf0, 0xd0, 0x7,
+    0xe2, 0xd9, 0x41, 0x0, 0x1b, 0xfb, 0x0, 0x7c,
+
+    /* U+1EA8 "Ẩ" */
+    0x0, 0xff, 0xe1, 0x95, 0xf7, 0xe1, 0x80, 0x7f, 0xf2, 0xd, 0x4, 0xf, 0x40, 0x3f, 0xf9, 0x3,
+    0xbf, 0x80, 0x24, 0x1, 0xff, 0xc8, 0x20, 0x60, 0x1, 0x0, 0x7f, 0xf0, 0x8e, 0xef, 0x48, 0x2,
+    0xc2, 0x40, 0x3f, 0xf8, 0x4b, 0x88, 0x99, 0xac, 0x33, 0xc, 0x1, 0xff, 0xc1, 0x6a, 0x0, 0x24,
+    0x88, 0x26, 0x99, 0x80, 0x3f, 0xf8, 0x31, 0x20, 0x9, 0xb6, 0xf4, 0x2, 0xf2, 0x0, 0xff, 0xe0,
+    0xcf, 0x73, 0xd8, 0x0, 0x37, 0xdc, 0xf2, 0x0, 0xff, 0xe0, 0x88, 0xc0, 0x1e, 0x11, 0x80, 0x3f,
+    0xf8, 0xb1, 0xff, 0xc2, 0x1, 0xff, 0xc7, 0x60, 0xe, 0x60, 0xf, 0xfe, 0x33, 0x8, 0x7, 0x48,
+    0x7, 0xff, 0x1a, 0xc0, 0x3c, 0x2a, 0x1, 0xff, 0xc4, 0x42, 0x0, 0xfa, 0x40, 0x3f, 0xf8, 0x9e,
+    0x1, 0x8c, 0x2, 0x33, 0x0, 0x7f, 0xf0, 0x89, 0x0, 0x24, 0x80, 0xd, 0x20, 0x1f, 0xfc, 0x2a,
+    0x0, 0xde, 0x84, 0x1, 0x28, 0x80, 0x7f, 0xf0, 0x5c, 0x2, 0x14, 0xa, 0x0, 0xd2, 0x1, 0xff,
+    0x98, 0x3, 0x48, 0x1, 0x80, 0x33, 0x0, 0x7f, 0xeb, 0x0, 0xcc, 0x0, 0x15, 0x0, 0x85, 0x80,
+    0x3f, 0xc8, 0x40, 0x12, 0x88, 0x5, 0x20, 0x1a, 0xc0, 0x3f, 0xde, 0x1, 0xb8, 0x3, 0x19, 0x0,
+    0x44, 0x80, 0x1f, 0x89, 0x0, 0x22, 0x40, 0xe, 0xa0, 0xd, 0xe0, 0x1f, 0xac, 0x3, 0x17, 0xff,
+    0xa0, 0x3, 0x21, 0x0, 0x78, 0x58, 0x3, 0xff, 0x8b, 0x40, 0x1e, 0x60, 0xf, 0xfe, 0x33, 0x80,
+    0x7a, 0x40, 0x3f, 0xf8, 0xee, 0x1, 0x94, 0x40, 0x22, 0xff, 0xff, 0x40, 0x6, 0xa0, 0xd, 0x20,
+    0x1a, 0x80, 0x3f, 0xcc, 0x1, 0x89, 0x0, 0x6, 0x60, 0xc, 0xc0, 0x1f, 0xe1, 0x60, 0xd, 0xe0,
+    0x9, 0x0, 0xca, 0x20, 0x1f, 0xf5, 0x0, 0x64, 0x21, 0x50, 0xd, 0x20, 0x1f, 0xf8, 0xc8, 0x3,
+    0x58,
+
+    /* U+1EA9 "ẩ" */
+    0x0, 0xff, 0x9f, 0x7f, 0xa0, 0x3, 0xff, 0x79, 0x0, 0xbb, 0x80, 0x3f, 0xe8, 0xef, 0x40, 0xd0,
+    0xf, 0xfc, 0x20, 0xc0, 0x40, 0x1e, 0xac, 0xcc, 0x80, 0xc4, 0x70, 0x1, 0x87, 0x14, 0xcf, 0x5b,
+    0x32, 0xf0, 0x3, 0x16, 0x18, 0xd, 0x30, 0x2, 0x61, 0x0, 0x31, 0xe1, 0x2, 0xfa, 0xcd, 0x88,
+    0x3c, 0x80, 0x63, 0xef, 0xf5, 0x8, 0x1, 0x3b, 0xfd, 0x20, 0x1f, 0xfc, 0xa3, 0x8b, 0xef, 0xfb,
+    0x24, 0xc0, 0x39, 0x33, 0xe, 0x82, 0x1, 0x1b, 0x65, 0x88, 0x5, 0x46, 0x1, 0xfe, 0x4c, 0x10,
+    0x4, 0x80, 0x7f, 0xe2, 0x80, 0x3, 0x88, 0x9a, 0xf7, 0xb6, 0x48, 0x3, 0x30, 0x5, 0xbd, 0x28,
+    0x42, 0x4d, 0x82, 0x1, 0x90, 0x0, 0x60, 0x1f, 0xb, 0x80, 0x63, 0x0, 0x96, 0xb7, 0xff, 0x98,
+    0x3, 0x78, 0x16, 0xd2, 0x90, 0x7, 0xfc, 0x38, 0x40, 0x1f, 0xfc, 0x26, 0x10, 0x8, 0xf3, 0xff,
+    0x40, 0x7, 0x60, 0x6, 0xf3, 0x0, 0xff, 0x38, 0x6, 0x20, 0xe, 0xc0, 0xe, 0x70, 0xc, 0xc0,
+    0x19, 0xd0, 0x3, 0xb4, 0x3, 0x45, 0xbc, 0x6c, 0x0, 0x79, 0x88, 0x3, 0x24, 0x39, 0x0, 0x80,
+    0x7b, 0xc8, 0x3, 0xe1, 0xa0, 0xf, 0x16, 0xca, 0x8, 0x0, 0xdf, 0xd8, 0x3, 0x80,
+
+    /* U+1EAA "Ẫ" */
+    0x0, 0xfe, 0x37, 0x71, 0x0, 0x45, 0x10, 0x20, 0xf, 0xfe, 0x14, 0xe4, 0x43, 0x60, 0x0, 0x8e,
+    0xe0, 0xf, 0xfe, 0x12, 0x30, 0x6, 0x7c, 0x89, 0x1, 0x20, 0xf, 0xfe, 0xe, 0x80, 0x2b, 0x98,
+    0xd, 0xc0, 0x12, 0x1, 0xff, 0xc2, 0x20, 0x15, 0x19, 0xa3, 0x1, 0x87, 0x0, 0xff, 0xe1, 0x5f,
+    0xf0, 0x4, 0xb9, 0xfc, 0xe0, 0x1f, 0xfc, 0x63, 0xbb, 0xd2, 0x1, 0xff, 0xc7, 0x4c, 0x44, 0xcd,
+    0x60, 0x1f, 0xfc, 0x56, 0xb0, 0x2, 0x48, 0x1, 0x30, 0x40, 0x3f, 0xf8, 0x4f, 0x20, 0x9, 0xb6,
+    0xe4, 0x3, 0xc2, 0x0, 0xff, 0xe0, 0xb7, 0x74, 0xc0, 0x1, 0xbe, 0xe6, 0x18, 0x7, 0xff, 0x4,
+    0x47, 0x0, 0x70, 0x8e, 0x0, 0xff, 0xe2, 0x47, 0xff, 0x8, 0x7, 0xff, 0x1d, 0x80, 0x39, 0x80,
+    0x3f, 0xf8, 0xcc, 0x20, 0x1d, 0x20, 0x1f, 0xfc, 0x6b, 0x0, 0xf0, 0xa8, 0x7, 0xff, 0x11, 0x8,
+    0x3, 0xe9, 0x0, 0xff, 0xe2, 0x78, 0x6, 0x30, 0x8, 0xcc, 0x1, 0xff, 0xc2, 0x24, 0x0, 0x92,
+    0x0, 0x34, 0x80, 0x7f, 0xf0, 0xa8, 0x3, 0x7a, 0x10, 0x4, 0xa2, 0x1, 0xff, 0xc1, 0x70, 0x8,
+    0x50, 0x28, 0x3, 0x48, 0x7, 0xfe, 0x60, 0xd, 0x20, 0x6, 0x0, 0xcc, 0x1, 0xff, 0xac, 0x3,
+    0x30, 0x0, 0x54, 0x2, 0x16, 0x0, 0xff, 0x21, 0x0, 0x4a, 0x20, 0x14, 0x80, 0x6b, 0x0, 0xff,
+    0x78, 0x6, 0xe0, 0xc, 0x64, 0x1, 0x12, 0x0, 0x7e, 0x24, 0x0, 0x89, 0x0, 0x3a, 0x80, 0x37,
+    0x80, 0x7e, 0xb0, 0xc, 0x5f, 0xfe, 0x80, 0xc, 0x84, 0x1, 0xe1, 0x60, 0xf, 0xfe, 0x2d, 0x0,
+    0x79, 0x80, 0x3f, 0xf8, 0xce, 0x1, 0xe9, 0x0, 0xff, 0xe3, 0xb8, 0x6, 0x51, 0x0, 0x8b, 0xff,
+    0xfd, 0x0, 0x1a, 0x80, 0x34, 0x80, 0x6a, 0x0, 0xff, 0x30, 0x6, 0x24, 0x0, 0x19, 0x80, 0x33,
+    0x0, 0x7f, 0x85, 0x80, 0x37, 0x80, 0x24, 0x3, 0x28, 0x80, 0x7f, 0xd4, 0x1, 0x90, 0x85, 0x40,
+    0x34, 0x80, 0x7f, 0xe3, 0x20, 0xd, 0x60,
+
+    /* U+1EAB "ẫ" */
+    0x0, 0xc2, 0xce, 0xc2, 0x1, 0x34, 0x30, 0x7, 0x1f, 0xcc, 0x4f, 0x38, 0x14, 0xbe, 0x0, 0x77,
+    0x8, 0x6, 0x8f, 0xd0, 0x7, 0x80, 0x62, 0x20, 0x27, 0xe2, 0x0, 0x65, 0x50, 0x6, 0x37, 0x74,
+    0x81, 0xde, 0x44, 0x2e, 0x80, 0x38, 0x62, 0x4, 0x1, 0x1b, 0xb9, 0x0, 0x3f, 0x87, 0x3f, 0xf3,
+    0x80, 0x7f, 0x16, 0x18, 0x6, 0x88, 0x0, 0x7c, 0x58, 0x40, 0x34, 0xc0, 0x7, 0x90, 0xe, 0x3c,
+    0x10, 0x5f, 0x59, 0xb1, 0x6, 0xa0, 0xc, 0x7d, 0xfe, 0xa1, 0x0, 0x27, 0x7f, 0xa8, 0x3, 0xff,
+    0x94, 0x71, 0x7d, 0xff, 0x64, 0x98, 0x7, 0x26, 0x61, 0xd0, 0x40, 0x23, 0x6c, 0xb1, 0x0, 0xa8,
+    0xc0, 0x3f, 0xc9, 0x82, 0x0, 0x90, 0xf, 0xfc, 0x50, 0x0, 0x71, 0x13, 0x5e, 0xf6, 0xc9, 0x0,
+    0x66, 0x0, 0xb7, 0xa5, 0x8, 0x49, 0xb0, 0x40, 0x32, 0x0, 0xc, 0x3, 0xe1, 0x70, 0xc, 0x60,
+    0x12, 0xd6, 0xff, 0xf3, 0x0, 0x6f, 0x2, 0xda, 0x52, 0x0, 0xff, 0x87, 0x8, 0x3, 0xff, 0x84,
+    0xc2, 0x1, 0x1e, 0x7f, 0xe8, 0x0, 0xec, 0x0, 0xde, 0x60, 0x1f, 0xe7, 0x0, 0xc4, 0x1, 0xd8,
+    0x1, 0xce, 0x1, 0x98, 0x3, 0x3a, 0x0, 0x76, 0x80, 0x68, 0xb7, 0x8d, 0x80, 0xf, 0x31, 0x0,
+    0x64, 0x87, 0x20, 0x10, 0xf, 0x79, 0x0, 0x7c, 0x34, 0x1, 0xe2, 0xd9, 0x41, 0x0, 0x1b, 0xfb,
+    0x0, 0x70,
+
+    /* U+1EAC "Ậ" */
+    0x0, 0xff, 0xc, 0x46, 0x50, 0xf, 0xfe, 0x38, 0xe3, 0xbe, 0xa6, 0x0, 0xff, 0xe3, 0x69, 0x0,
+    0x10, 0x1, 0x2a, 0x1, 0xff, 0xc4, 0xb3, 0x1, 0xcb, 0x60, 0x5, 0x20, 0x7, 0xff, 0xa, 0xd0,
+    0x7, 0xc, 0x25, 0xc0, 0x16, 0x80, 0x1f, 0xfc, 0x1b, 0xff, 0x71, 0x0, 0x51, 0xff, 0x20, 0x7,
+    0xff, 0x7a, 0x3f, 0xf8, 0x40, 0x3f, 0xf8, 0xec, 0x1, 0xcc, 0x1, 0xff, 0xc6, 0x61, 0x0, 0xe9,
+    0x0, 0xff, 0xe3, 0x58, 0x7, 0x85, 0x40, 0x3f, 0xf8, 0x88, 0x40, 0x1f, 0x48, 0x7, 0xff, 0x13,
+    0xc0, 0x31, 0x80, 0x46, 0x60, 0xf, 0xfe, 0x11, 0x20, 0x4, 0x90, 0x1, 0xa4, 0x3, 0xff, 0x85,
+    0x40, 0x1b, 0xd0, 0x80, 0x25, 0x10, 0xf, 0xfe, 0xb, 0x80, 0x42, 0x81, 0x40, 0x1a, 0x40, 0x3f,
+    0xf3, 0x0, 0x69, 0x0, 0x30, 0x6, 0x60, 0xf, 0xfd, 0x60, 0x19, 0x80, 0x2, 0xa0, 0x10, 0xb0,
+    0x7, 0xf9, 0x8, 0x2, 0x51, 0x0, 0xa4, 0x3, 0x58, 0x7, 0xfb, 0xc0, 0x37, 0x0, 0x63, 0x20,
+    0x8, 0x90, 0x3, 0xf1, 0x20, 0x4, 0x48, 0x1, 0xd4, 0x1, 0xbc, 0x3, 0xf5, 0x80, 0x62, 0xff,
+    0xf4, 0x0, 0x64, 0x20, 0xf, 0xb, 0x0, 0x7f, 0xf1, 0x68, 0x3, 0xcc, 0x1, 0xff, 0xc6, 0x70,
+    0xf, 0x48, 0x7, 0xff, 0x1d, 0xc0, 0x32, 0x88, 0x4, 0x5f, 0xff, 0xe8, 0x0, 0xd4, 0x1, 0xa4,
+    0x3, 0x50, 0x7, 0xf9, 0x80, 0x31, 0x20, 0x0, 0xcc, 0x1, 0x98, 0x3, 0xfc, 0x2c, 0x1, 0xbc,
+    0x1, 0x20, 0x19, 0x44, 0x3, 0xfe, 0xa0, 0xc, 0x84, 0x2a, 0x1, 0xa4, 0x3, 0xff, 0x19, 0x0,
+    0x6b, 0x1f, 0xfe, 0x30, 0xf, 0xfe, 0xe, 0xff, 0xe9, 0x0, 0xff, 0xec, 0xaf, 0x7d, 0x8, 0x7,
+    0xff, 0x20, 0xa8, 0x41, 0x6c, 0x3, 0xff, 0x90, 0x80, 0x19, 0x0, 0x3f, 0xf9, 0x6, 0x1, 0x8c,
+    0x3, 0xff, 0x90, 0xa4, 0x1, 0x40, 0x7, 0xff, 0x27, 0x21, 0xed, 0x40, 0x3f, 0xc0,
+
+    /* U+1EAD "ậ" */
+    0x0, 0xe1, 0xdf, 0xfc, 0xe0, 0x1f, 0xed, 0x20, 0xd, 0xc, 0x1, 0xfb, 0xc, 0x0, 0xe4, 0x0,
+    0x95, 0x0, 0xf5, 0x98, 0x2, 0xe3, 0x54, 0x1, 0x48, 0x1, 0x8c, 0xce, 0xed, 0x40, 0x5, 0x4b,
+    0xb8, 0xc0, 0x31, 0xc4, 0x44, 0x1, 0x9a, 0x20, 0xe0, 0x1f, 0xfc, 0xa3, 0x8b, 0xef, 0xfb, 0x24,
+    0xc0, 0x39, 0x33, 0xe, 0x82, 0x1, 0x1b, 0x65, 0x88, 0x5, 0x46, 0x1, 0xfe, 0x4c, 0x10, 0x4,
+    0x80, 0x7f, 0xe2, 0x80, 0x3, 0x88, 0x9a, 0xf7, 0xb6, 0x48, 0x3, 0x30, 0x5, 0xbd, 0x28, 0x42,
+    0x4d, 0x82, 0x1, 0x90, 0x0, 0x60, 0x1f, 0xb, 0x80, 0x63, 0x0, 0x96, 0xb7, 0xff, 0x98, 0x3,
+    0x78, 0x16, 0xd2, 0x90, 0x7, 0xfc, 0x38, 0x40, 0x1f, 0xfc, 0x26, 0x10, 0x8, 0xf3, 0xff, 0x40,
+    0x7, 0x60, 0x6, 0xf3, 0x0, 0xff, 0x38, 0x6, 0x20, 0xe, 0xc0, 0xe, 0x70, 0xc, 0xc0, 0x19,
+    0xd0, 0x3, 0xb4, 0x3, 0x45, 0xbc, 0x6c, 0x0, 0x79, 0x88, 0x3, 0x24, 0x39, 0x0, 0x80, 0x7b,
+    0xc8, 0x3, 0xe1, 0xa0, 0xf, 0x16, 0xca, 0x8, 0x0, 0xdf, 0xd8, 0x3, 0xf3, 0x5f, 0x7f, 0xb2,
+    0x4, 0xbf, 0xf4, 0x0, 0x7c, 0xd0, 0xa0, 0x1f, 0xfc, 0x1c, 0x97, 0xa8, 0x0, 0xff, 0x8c, 0xc0,
+    0x13, 0x80, 0x7f, 0xce, 0x1, 0xff, 0xc4, 0x50, 0xc, 0x60, 0x1f, 0xf0, 0xd9, 0x2, 0x68, 0x7,
+    0x80,
+
+    /* U+1EAE "Ắ" */
+    0x0, 0xff, 0xe0, 0x8b, 0xc4, 0x4c, 0x1, 0xff, 0xc8, 0xd8, 0x77, 0x23, 0x80, 0x7f, 0xf1, 0xec,
+    0xc0, 0xd, 0x82, 0x1, 0xff, 0xc6, 0x94, 0x0, 0x4c, 0x80, 0x3f, 0xf8, 0xe4, 0x2e, 0xec, 0x60,
+    0xf, 0xfe, 0x2c, 0x7f, 0xa2, 0x31, 0x97, 0xfc, 0x20, 0x1f, 0xfc, 0x1a, 0x0, 0x2e, 0xc3, 0xd6,
+    0x80, 0x14, 0x40, 0x3f, 0xf8, 0x25, 0x20, 0x2, 0x78, 0x50, 0x1, 0xd8, 0x7, 0xff, 0xd, 0xb5,
+    0x88, 0x0, 0x29, 0x38, 0x20, 0x1f, 0xfc, 0x42, 0x9d, 0xff, 0x75, 0xb0, 0x7, 0xff, 0x86, 0x3f,
+    0xf8, 0x40, 0x3f, 0xf8, 0xec, 0x1, 0xcc, 0x1, 0xff, 0xc6, 0x61, 0x0, 0xe9, 0x0, 0xff, 0xe3,
+    0x58, 0x7, 0x85, 0x40, 0x3f, 0xf8, 0x88, 0x40, 0x1f, 0x48, 0x7, 0xff, 0x13, 0xc0, 0x31, 0x80,
+    0x46, 0x60, 0xf, 0xfe, 0x11, 0x20, 0x4, 0x90, 0x1, 0xa4, 0x3, 0xff, 0x85, 0x40, 0x1b, 0xd0,
+    0x80, 0x25, 0x10, 0xf, 0xfe, 0xb, 0x80, 0x42, 0x81, 0x40, 0x1a, 0x40, 0x3f, 0xf3, 0x0, 0x69,
+    0x0, 0x30, 0x6, 0x60, 0xf, 0xfd, 0x60, 0x19, 0x80, 0x2, 0xa0, 0x10, 0xb0, 0x7, 0xf9, 0x8,
+    0x2, 0x51, 0x0, 0xa4, 0x3, 0x58, 0x7, 0xfb, 0xc0, 0x37, 0x0, 0x63, 0x20, 0x8, 0x90, 0x3,
+    0xf1, 0x20, 0x4, 0x48, 0x1, 0xd4, 0x1, 0xbc, 0x3, 0xf5, 0x80, 0x62, 0xff, 0xf4, 0x0, 0x64,
+    0x20, 0xf, 0xb, 0x0, 0x7f, 0xf1, 0x68, 0x3, 0xcc, 0x1, 0xff, 0xc6, 0x70, 0xf, 0x48, 0x7,
+    0xff, 0x1d, 0xc0, 0x32, 0x88, 0x4, 0x5f, 0xff, 0xe8, 0x0, 0xd4, 0x1, 0xa4, 0x3, 0x50, 0x7,
+    0xf9, 0x80, 0x31, 0x20, 0x0, 0xcc, 0x1, 0x98, 0x3, 0xfc, 0x2c, 0x1, 0xbc, 0x1, 0x20, 0x19,
+    0x44, 0x3, 0xfe, 0xa0, 0xc, 0x84, 0x2a, 0x1, 0xa4, 0x3, 0xff, 0x19, 0x0, 0x6b,
+
+    /* U+1EAF "ắ" */
+    0x0, 0xfc, 0x3b, 0xff, 0x69, 0x0, 0x7f, 0xa8, 0x80, 0x9, 0x84, 0x1, 0xfd, 0x48, 0x0, 0x7b,
+    0x10, 0xf, 0xe8, 0x50, 0x5, 0x40, 0x7, 0xe8, 0x83, 0xc7, 0xfc, 0xa7, 0x10, 0x40, 0xe, 0x67,
+    0x89, 0x20, 0x2, 0xeb, 0xb8, 0x80, 0x3a, 0xc0, 0xd, 0xbf, 0xea, 0x10, 0x26, 0x0, 0xe5, 0xb2,
+    0x0, 0xf3, 0x60, 0x7, 0xc9, 0xb9, 0x31, 0xa, 0xe9, 0x10, 0xf, 0xe3, 0x67, 0x72, 0x88, 0x7,
+    0xff, 0x34, 0xe2, 0xfb, 0xfe, 0xc9, 0x30, 0xe, 0x4c, 0xc3, 0xa0, 0x80, 0x46, 0xd9, 0x62, 0x1,
+    0x51, 0x80, 0x7f, 0x93, 0x4, 0x1, 0x20, 0x1f, 0xf8, 0xa0, 0x0, 0xe2, 0x26, 0xbd, 0xed, 0x92,
+    0x0, 0xcc, 0x1, 0x6f, 0x4a, 0x10, 0x93, 0x60, 0x80, 0x64, 0x0, 0x18, 0x7, 0xc2, 0xe0, 0x18,
+    0xc0, 0x25, 0xad, 0xff, 0xe6, 0x0, 0xde, 0x5, 0xb4, 0xa4, 0x1, 0xff, 0xe, 0x10, 0x7, 0xff,
+    0x9, 0x84, 0x2, 0x3c, 0xff, 0xd0, 0x1, 0xd8, 0x1, 0xbc, 0xc0, 0x3f, 0xce, 0x1, 0x88, 0x3,
+    0xb0, 0x3, 0x9c, 0x3, 0x30, 0x6, 0x74, 0x0, 0xed, 0x0, 0xd1, 0x6f, 0x1b, 0x0, 0x1e, 0x62,
+    0x0, 0xc9, 0xe, 0x40, 0x20, 0x1e, 0xf2, 0x0, 0xf8, 0x68, 0x3, 0xc5, 0xb2, 0x82, 0x0, 0x37,
+    0xf6, 0x0, 0xe0,
+
+    /* U+1EB0 "Ằ" */
+    0x0, 0xf8, 0xa2, 0x32, 0x80, 0x7f, 0xf2, 0xb, 0x5d, 0xea, 0x50, 0xf, 0xfe, 0x42, 0xe0, 0x80,
+    0x29, 0x0, 0x3f, 0xf9, 0x7, 0xe6, 0x0, 0xb3, 0x0, 0xff, 0xe4, 0xe, 0x4b, 0xb9, 0x40, 0x3f,
+    0xf8, 0xb1, 0xfe, 0xa0, 0x68, 0x82, 0x7f, 0xc2, 0x1, 0xff, 0xc1, 0xa0, 0x2, 0xec, 0x3d, 0x68,
+    0x1, 0x44, 0x3, 0xff, 0x82, 0x52, 0x0, 0x27, 0x85, 0x0, 0x1d, 0x80, 0x7f, 0xf0, 0xdb, 0x58,
+    0x80, 0x2, 0x93, 0x82, 0x1, 0xff, 0xc4, 0x29, 0xdf, 0xf7, 0x5b, 0x0, 0x7f, 0xf8, 0x63, 0xff,
+    0x84, 0x3, 0xff, 0x8e, 0xc0, 0x1c, 0xc0, 0x1f, 0xfc, 0x66, 0x10, 0xe, 0x90, 0xf, 0xfe, 0x35,
+    0x80, 0x78, 0x54, 0x3, 0xff, 0x88, 0x84, 0x1, 0xf4, 0x80, 0x7f, 0xf1, 0x3c, 0x3, 0x18, 0x4,
+    0x66, 0x0, 0xff, 0xe1, 0x12, 0x0, 0x49, 0x0, 0x1a, 0x40, 0x3f, 0xf8, 0x54, 0x1, 0xbd, 0x8,
+    0x2, 0x51, 0x0, 0xff, 0xe0, 0xb8, 0x4, 0x28, 0x14, 0x1, 0xa4, 0x3, 0xff, 0x30, 0x6, 0x90,
+    0x3, 0x0, 0x66, 0x0, 0xff, 0xd6, 0x1, 0x98, 0x0, 0x2a, 0x1, 0xb, 0x0, 0x7f, 0x90, 0x80,
+    0x25, 0x10, 0xa, 0x40, 0x35, 0x80, 0x7f, 0xbc, 0x3, 0x70, 0x6, 0x32, 0x0, 0x89, 0x0, 0x3f,
+    0x12, 0x0, 0x44, 0x80, 0x1d, 0x40, 0x1b, 0xc0, 0x3f, 0x58, 0x6, 0x2f, 0xff, 0x40, 0x6, 0x42,
+    0x0, 0xf0, 0xb0, 0x7, 0xff, 0x16, 0x80, 0x3c, 0xc0, 0x1f, 0xfc, 0x67, 0x0, 0xf4, 0x80, 0x7f,
+    0xf1, 0xdc, 0x3, 0x28, 0x80, 0x45, 0xff, 0xfe, 0x80, 0xd, 0x40, 0x1a, 0x40, 0x35, 0x0, 0x7f,
+    0x98, 0x3, 0x12, 0x0, 0xc, 0xc0, 0x19, 0x80, 0x3f, 0xc2, 0xc0, 0x1b, 0xc0, 0x12, 0x1, 0x94,
+    0x40, 0x3f, 0xea, 0x0, 0xc8, 0x42, 0xa0, 0x1a, 0x40, 0x3f, 0xf1, 0x90, 0x6, 0xb0,
+
+    /* U+1EB1 "ằ" */
+    0x0, 0x9f, 0xff, 0x30, 0x7, 0xfc, 0xf6, 0x20, 0x9, 0x50, 0xf, 0xf9, 0x30, 0x80, 0x14, 0x60,
+    0x1f, 0xf1, 0x6a, 0x80, 0x34, 0x80, 0x3f, 0x44, 0x1c, 0x2b, 0xfd, 0xc3, 0x10, 0x40, 0xe, 0x67,
+    0x89, 0x20, 0x2, 0xeb, 0xb8, 0x80, 0x3a, 0xc0, 0xd, 0xbf, 0xea, 0x10, 0x26, 0x0, 0xe5, 0xb2,
+    0x0, 0xf3, 0x60, 0x7, 0xc9, 0xb9, 0x31, 0xa, 0xe9, 0x10, 0xf, 0xe3, 0x67, 0x72, 0x88, 0x7,
+    0xff, 0x34, 0xe2, 0xfb, 0xfe, 0xc9, 0x30, 0xe, 0x4c, 0xc3, 0xa0, 0x80, 0x46, 0xd9, 0x62, 0x1,
+    0x51, 0x80, 0x7f, 0x93, 0x4, 0x1, 0x20, 0x1f, 0xf8, 0xa0, 0x0, 0xe2, 0x26, 0xbd, 0xed, 0x92,
+    0x0, 0xcc, 0x1, 0x6f, 0x4a, 0x10, 0x93, 0x60, 0x80, 0x64, 0x0, 0x18, 0x7, 0xc2, 0xe0, 0x18,
+    0xc0, 0x25, 0xad, 0xff, 0xe6, 0x0, 0xde, 0x5, 0xb4, 0xa4, 0x1, 0xff, 0xe, 0x10, 0x7, 0xff,
+    0x9, 0x84, 0x2, 0x3c, 0xff, 0xd0, 0x1, 0xd8, 0x1, 0xbc, 0xc0, 0x3f, 0xce, 0x1, 0x88, 0x3,
+    0xb0, 0x3, 0x9c, 0x3, 0x30, 0x6, 0x74, 0x0, 0xed, 0x0, 0xd1, 0x6f, 0x1b, 0x0, 0x1e, 0x62,
+    0x0, 0xc9, 0xe, 0x40, 0x20, 0x1e, 0xf2, 0x0, 0xf8, 0x68, 0x3, 0xc5, 0xb2, 0x82, 0x0, 0x37,
+    0xf6, 0x0, 0xe0,
+
+    /* U+1EB2 "Ẳ" */
+    0x0, 0xff, 0xd, 0x77, 0xea, 0x0, 0x7f, 0xf2, 0x5, 0xc4, 0xa, 0xc4, 0x3, 0xff, 0x91, 0x9f,
+    0xc0, 0x5, 0x0, 0xff, 0xe4, 0x8, 0x20, 0x1, 0x40, 0x3f, 0xf9, 0x5c, 0x14, 0x20, 0x1f, 0xfc,
+    0x48, 0xff, 0x48, 0x2, 0xf5, 0xfb, 0xf8, 0x3, 0xff, 0x85, 0x60, 0x6, 0xc8, 0x78, 0xd1, 0x5,
+    0x0, 0xff, 0xe1, 0x1c, 0x80, 0xd, 0xe1, 0x40, 0x7, 0x40, 0x1f, 0xfc, 0x36, 0xd6, 0x20, 0x0,
+    0xa4, 0xe0, 0x80, 0x7f, 0xf1, 0xa, 0x77, 0xfd, 0xd6, 0xc0, 0x1f, 0xfe, 0x18, 0xff, 0xe1, 0x0,
+    0xff, 0xe3, 0xb0, 0x7, 0x30, 0x7, 0xff, 0x19, 0x84, 0x3, 0xa4, 0x3, 0xff, 0x8d, 0x60, 0x1e,
+    0x15, 0x0, 0xff, 0xe2, 0x21, 0x0, 0x7d, 0x20, 0x1f, 0xfc, 0x4f, 0x0, 0xc6, 0x1, 0x19, 0x80,
+    0x3f, 0xf8, 0x44, 0x80, 0x12, 0x40, 0x6, 0x90, 0xf, 0xfe, 0x15, 0x0, 0x6f, 0x42, 0x0, 0x94,
+    0x40, 0x3f, 0xf8, 0x2e, 0x1, 0xa, 0x5, 0x0, 0x69, 0x0, 0xff, 0xcc, 0x1, 0xa4, 0x0, 0xc0,
+    0x19, 0x80, 0x3f, 0xf5, 0x80, 0x66, 0x0, 0xa, 0x80, 0x42, 0xc0, 0x1f, 0xe4, 0x20, 0x9, 0x44,
+    0x2, 0x90, 0xd, 0x60, 0x1f, 0xef, 0x0, 0xdc, 0x1, 0x8c, 0x80, 0x22, 0x40, 0xf, 0xc4, 0x80,
+    0x11, 0x20, 0x7, 0x50, 0x6, 0xf0, 0xf, 0xd6, 0x1, 0x8b, 0xff, 0xd0, 0x1, 0x90, 0x80, 0x3c,
+    0x2c, 0x1, 0xff, 0xc5, 0xa0, 0xf, 0x30, 0x7, 0xff, 0x19, 0xc0, 0x3d, 0x20, 0x1f, 0xfc, 0x77,
+    0x0, 0xca, 0x20, 0x11, 0x7f, 0xff, 0xa0, 0x3, 0x50, 0x6, 0x90, 0xd, 0x40, 0x1f, 0xe6, 0x0,
+    0xc4, 0x80, 0x3, 0x30, 0x6, 0x60, 0xf, 0xf0, 0xb0, 0x6, 0xf0, 0x4, 0x80, 0x65, 0x10, 0xf,
+    0xfa, 0x80, 0x32, 0x10, 0xa8, 0x6, 0x90, 0xf, 0xfc, 0x64, 0x1, 0xac,
+
+    /* U+1EB3 "ẳ" */
+    0x0, 0xf2, 0x5f, 0x6c, 0x0, 0x7f, 0xe3, 0x41, 0x27, 0x70, 0x7, 0xfc, 0xf9, 0xea, 0x16, 0x1,
+    0xff, 0x8c, 0x2, 0x60, 0xf, 0xfe, 0xa, 0xa8, 0x60, 0x3, 0xf4, 0xca, 0x0, 0xb, 0x38, 0xd3,
+    0x25, 0x0, 0xe7, 0x67, 0xa2, 0x7, 0x75, 0x33, 0xc, 0x3, 0xac, 0x0, 0xbb, 0xfd, 0x42, 0x6,
+    0xc0, 0x1c, 0xb6, 0x40, 0x1e, 0x6c, 0x0, 0xf9, 0x37, 0x53, 0x10, 0xbe, 0x90, 0xf, 0xf1, 0x33,
+    0xb9, 0x4, 0x3, 0xff, 0x9a, 0x71, 0x7d, 0xff, 0x64, 0x98, 0x7, 0x26, 0x61, 0xd0, 0x40, 0x23,
+    0x6c, 0xb1, 0x0, 0xa8, 0xc0, 0x3f, 0xc9, 0x82, 0x0, 0x90, 0xf, 0xfc, 0x50, 0x0, 0x71, 0x13,
+    0x5e, 0xf6, 0xc9, 0x0, 0x66, 0x0, 0xb7, 0xa5, 0x8, 0x49, 0xb0, 0x40, 0x32, 0x0, 0xc, 0x3,
+    0xe1, 0x70, 0xc, 0x60, 0x12, 0xd6, 0xff, 0xf3, 0x0, 0x6f, 0x2, 0xda, 0x52, 0x0, 0xff, 0x87,
+    0x8, 0x3, 0xff, 0x84, 0xc2, 0x1, 0x1e, 0x7f, 0xe8, 0x0, 0xec, 0x0, 0xde, 0x60, 0x1f, 0xe7,
+    0x0, 0xc4, 0x1, 0xd8, 0x1, 0xce, 0x1, 0x98, 0x3, 0x3a, 0x0, 0x76, 0x80, 0x68, 0xb7, 0x8d,
+    0x80, 0xf, 0x31, 0x0, 0x64, 0x87, 0x20, 0x10, 0xf, 0x79, 0x0, 0x7c, 0x34, 0x1, 0xe2, 0xd9,
+    0x41, 0x0, 0x1b, 0xfb, 0x0, 0x70,
+
+    /* U+1EB4 "Ẵ" */
+    0x0, 0xfe, 0x47, 0x71, 0x80, 0x45, 0x10, 0x20, 0xf, 0xfe, 0x15, 0x5c, 0x43, 0x30, 0x61, 0x6e,
+    0xe0, 0xf, 0xfe, 0x12, 0xa8, 0x3, 0x1e, 0x7b, 0x1, 0x10, 0x3, 0xff, 0x83, 0xe0, 0xc, 0xf8,
+    0x0, 0xee, 0x0, 0xff, 0xe1, 0x63, 0xc9, 0x83, 0xf5, 0x3c, 0xf1, 0x80, 0x7f, 0xf0, 0x9a, 0x5c,
+    0x2, 0x15, 0x87, 0x1, 0x0, 0xff, 0xe1, 0x47, 0x72, 0x80, 0x31, 0x77, 0x40, 0x1f, 0xfc, 0x2a,
+    0x0, 0x2e, 0xc3, 0xd6, 0x80, 0x14, 0x3, 0xff, 0x84, 0x54, 0x0, 0x27, 0x85, 0x0, 0x1d, 0x80,
+    0x7f, 0xf0, 0xd7, 0x58, 0x80, 0x2, 0x95, 0x82, 0x1, 0xff, 0xc4, 0x29, 0xdf, 0xf7, 0x5a, 0x80,
+    0x7f, 0xf8, 0x63, 0xff, 0x84, 0x3, 0xff, 0x8e, 0xc0, 0x1c, 0xc0, 0x1f, 0xfc, 0x66, 0x10, 0xe,
+    0x90, 0xf, 0xfe, 0x35, 0x80, 0x78, 0x54, 0x3, 0xff, 0x88, 0x84, 0x1, 0xf4, 0x80, 0x7f, 0xf1,
+    0x3c, 0x3, 0x18, 0x4, 0x66, 0x0, 0xff, 0xe1, 0x12, 0x0, 0x49, 0x0, 0x1a, 0x40, 0x3f, 0xf8,
+    0x54, 0x1, 0xbd, 0x8, 0x2, 0x51, 0x0, 0xff, 0xe0, 0xb8, 0x4, 0x28, 0x14, 0x1, 0xa4, 0x3,
+    0xff, 0x30, 0x6, 0x90, 0x3, 0x0, 0x66, 0x0, 0xff, 0xd6, 0x1, 0x98, 0x0, 0x2a, 0x1, 0xb,
+    0x0, 0x7f, 0x90, 0x80, 0x25, 0x10, 0xa, 0x40, 0x35, 0x80, 0x7f, 0xbc, 0x3, 0x70, 0x6, 0x32,
+    0x0, 0x89, 0x0, 0x3f, 0x12, 0x0, 0x44, 0x80, 0x1d, 0x40, 0x1b, 0xc0, 0x3f, 0x58, 0x6, 0x2f,
+    0xff, 0x40, 0x6, 0x42, 0x0, 0xf0, 0xb0, 0x7, 0xff, 0x16, 0x80, 0x3c, 0xc0, 0x1f, 0xfc, 0x67,
+    0x0, 0xf4, 0x80, 0x7f, 0xf1, 0xdc, 0x3, 0x28, 0x80, 0x45, 0xff, 0xfe, 0x80, 0xd, 0x40, 0x1a,
+    0x40, 0x35, 0x0, 0x7f, 0x98, 0x3, 0x12, 0x0, 0xc, 0xc0, 0x19, 0x80, 0x3f, 0xc2, 0xc0, 0x1b,
+    0xc0, 0x12, 0x1, 0x94, 0x40, 0x3f, 0xea, 0x0, 0xc8, 0x42, 0xa0, 0x1a, 0x40, 0x3f, 0xf1, 0x90,
+    0x6, 0xb0,
+
+    /* U+1EB5 "ẵ" */
+    0x0, 0xcf, 0xdf, 0xaa, 0x1, 0x67, 0xd8, 0x7, 0x3c, 0x8, 0x15, 0x50, 0x4c, 0xc0, 0x40, 0x1d,
+    0x20, 0x7, 0x30, 0x5e, 0xc0, 0x6, 0x80, 0x62, 0x10, 0x78, 0xc8, 0x0, 0xcc, 0x80, 0x18, 0xdd,
+    0xd4, 0x0, 0x7d, 0x98, 0xc9, 0x0, 0xe1, 0xdd, 0x30, 0x4, 0x4c, 0xac, 0xa6, 0x1, 0xd7, 0x57,
+    0x4, 0x0, 0x4f, 0xaa, 0x20, 0x7, 0x40, 0x1, 0xf7, 0xfd, 0x64, 0x4, 0xe0, 0x1c, 0xd4, 0x40,
+    0x1e, 0x5c, 0x0, 0xf9, 0x77, 0x26, 0x21, 0x5d, 0x42, 0x1, 0xfc, 0x6c, 0xee, 0x51, 0x0, 0xff,
+    0xe6, 0x9c, 0x5f, 0x7f, 0xd9, 0x26, 0x1, 0xc9, 0x98, 0x74, 0x10, 0x8, 0xdb, 0x2c, 0x40, 0x2a,
+    0x30, 0xf, 0xf2, 0x60, 0x80, 0x24, 0x3, 0xff, 0x14, 0x0, 0x1c, 0x44, 0xd7, 0xbd, 0xb2, 0x40,
+    0x19, 0x80, 0x2d, 0xe9, 0x42, 0x12, 0x6c, 0x10, 0xc, 0x80, 0x3, 0x0, 0xf8, 0x5c, 0x3, 0x18,
+    0x4, 0xb5, 0xbf, 0xfc, 0xc0, 0x1b, 0xc0, 0xb6, 0x94, 0x80, 0x3f, 0xe1, 0xc2, 0x0, 0xff, 0xe1,
+    0x30, 0x80, 0x47, 0x9f, 0xfa, 0x0, 0x3b, 0x0, 0x37, 0x98, 0x7, 0xf9, 0xc0, 0x31, 0x0, 0x76,
+    0x0, 0x73, 0x80, 0x66, 0x0, 0xce, 0x80, 0x1d, 0xa0, 0x1a, 0x2d, 0xe3, 0x60, 0x3, 0xcc, 0x40,
+    0x19, 0x21, 0xc8, 0x4, 0x3, 0xde, 0x40, 0x1f, 0xd, 0x0, 0x78, 0xb6, 0x50, 0x40, 0x6, 0xfe,
+    0xc0, 0x1c,
+
+    /* U+1EB6 "Ặ" */
+    0x0, 0xfa, 0x7f, 0xd2, 0x1, 0x87, 0xfe, 0x10, 0xf, 0xfe, 0xe, 0x0, 0x18, 0xc0, 0x2b, 0x0,
+    0x10, 0x80, 0x7f, 0xf0, 0x54, 0x80, 0x19, 0x8b, 0xe5, 0x0, 0x58, 0x7, 0xff, 0xf, 0xc8, 0x0,
+    0x68, 0x20, 0x7, 0x60, 0xf, 0xfe, 0x19, 0x6c, 0x18, 0x0, 0x57, 0x20, 0x3, 0xff, 0x8c, 0xf9,
+    0xfe, 0xea, 0x30, 0xf, 0xff, 0xc, 0x7f, 0xf0, 0x80, 0x7f, 0xf1, 0xd8, 0x3, 0x98, 0x3, 0xff,
+    0x8c, 0xc2, 0x1, 0xd2, 0x1, 0xff, 0xc6, 0xb0, 0xf, 0xa, 0x80, 0x7f, 0xf1, 0x10, 0x80, 0x3e,
+    0x90, 0xf, 0xfe, 0x27, 0x80, 0x63, 0x0, 0x8c, 0xc0, 0x1f, 0xfc, 0x22, 0x40, 0x9, 0x20, 0x3,
+    0x48, 0x7, 0xff, 0xa, 0x80, 0x37, 0xa1, 0x0, 0x4a, 0x20, 0x1f, 0xfc, 0x17, 0x0, 0x85, 0x2,
+    0x80, 0x34, 0x80, 0x7f, 0xe6, 0x0, 0xd2, 0x0, 0x60, 0xc, 0xc0, 0x1f, 0xfa, 0xc0, 0x33, 0x0,
+    0x5, 0x40, 0x21, 0x60, 0xf, 0xf2, 0x10, 0x4, 0xa2, 0x1, 0x48, 0x6, 0xb0, 0xf, 0xf7, 0x80,
+    0x6e, 0x0, 0xc6, 0x40, 0x11, 0x20, 0x7, 0xe2, 0x40, 0x8, 0x90, 0x3, 0xa8, 0x3, 0x78, 0x7,
+    0xeb, 0x0, 0xc5, 0xff, 0xe8, 0x0, 0xc8, 0x40, 0x1e, 0x16, 0x0, 0xff, 0xe2, 0xd0, 0x7, 0x98,
+    0x3, 0xff, 0x8c, 0xe0, 0x1e, 0x90, 0xf, 0xfe, 0x3b, 0x80, 0x65, 0x10, 0x8, 0xbf, 0xff, 0xd0,
+    0x1, 0xa8, 0x3, 0x48, 0x6, 0xa0, 0xf, 0xf3, 0x0, 0x62, 0x40, 0x1, 0x98, 0x3, 0x30, 0x7,
+    0xf8, 0x58, 0x3, 0x78, 0x2, 0x40, 0x32, 0x88, 0x7, 0xfd, 0x40, 0x19, 0x8, 0x54, 0x3, 0x48,
+    0x7, 0xfe, 0x32, 0x0, 0xd6, 0x3f, 0xfc, 0x60, 0x1f, 0xfc, 0x1d, 0xff, 0xd2, 0x1, 0xff, 0xd9,
+    0x5e, 0xfa, 0x10, 0xf, 0xfe, 0x41, 0x50, 0x82, 0xd8, 0x7, 0xff, 0x21, 0x0, 0x32, 0x0, 0x7f,
+    0xf2, 0xc, 0x3, 0x18, 0x7, 0xff, 0x21, 0x48, 0x2, 0x80, 0xf, 0xfe, 0x4e, 0x43, 0xda, 0x80,
+    0x7f, 0x80,
+
+    /* U+1EB7 "ặ" */
+    0x0, 0xf, 0xfc, 0x20, 0x1a, 0x7f, 0xd2, 0x1, 0x84, 0x80, 0x16, 0x1, 0x1b, 0x0, 0x30, 0x3,
+    0xac, 0x0, 0xbd, 0x79, 0x80, 0x1, 0x28, 0x7, 0x33, 0x80, 0x5, 0xc, 0x0, 0x3e, 0x1, 0xf4,
+    0x62, 0x88, 0x0, 0xe3, 0x88, 0x3, 0xf1, 0xd7, 0x7f, 0xb1, 0xc0, 0x3f, 0xf9, 0xa7, 0x17, 0xdf,
+    0xf6, 0x49, 0x80, 0x72, 0x66, 0x1d, 0x4, 0x2, 0x36, 0xcb, 0x10, 0xa, 0x8c, 0x3, 0xfc, 0x98,
+    0x20, 0x9, 0x0, 0xff, 0xc5, 0x0, 0x7, 0x11, 0x35, 0xef, 0x6c, 0x90, 0x6, 0x60, 0xb, 0x7a,
+    0x50, 0x84, 0x9b, 0x4, 0x3, 0x20, 0x0, 0xc0, 0x3e, 0x17, 0x0, 0xc6, 0x1, 0x2d, 0x6f, 0xff,
+    0x30, 0x6, 0xf0, 0x2d, 0xa5, 0x20, 0xf, 0xf8, 0x70, 0x80, 0x3f, 0xf8, 0x4c, 0x20, 0x11, 0xe7,
+    0xfe, 0x80, 0xe, 0xc0, 0xd, 0xe6, 0x1, 0xfe, 0x70, 0xc, 0x40, 0x1d, 0x80, 0x1c, 0xe0, 0x19,
+    0x80, 0x33, 0xa0, 0x7, 0x68, 0x6, 0x8b, 0x78, 0xd8, 0x0, 0xf3, 0x10, 0x6, 0x48, 0x72, 0x1,
+    0x0, 0xf7, 0x90, 0x7, 0xc3, 0x40, 0x1e, 0x2d, 0x94, 0x10, 0x1, 0xbf, 0xb0, 0x7, 0xe6, 0xbe,
+    0xff, 0x64, 0x9, 0x7f, 0xe8, 0x0, 0xf9, 0xa1, 0x40, 0x3f, 0xf8, 0x39, 0x2f, 0x50, 0x1, 0xff,
+    0x19, 0x80, 0x27, 0x0, 0xff, 0x9c, 0x3, 0xff, 0x88, 0xa0, 0x18, 0xc0, 0x3f, 0xe1, 0xb2, 0x4,
+    0xd0, 0xf,
+
+    /* U+1EB8 "Ẹ" */
+    0x5f, 0xff, 0xfe, 0x24, 0x80, 0x7f, 0xfb, 0xca, 0xef, 0xff, 0x0, 0x79, 0x13, 0xfe, 0x20, 0xf,
+    0xff, 0x79, 0x7f, 0xff, 0x8c, 0x3, 0xff, 0xe0, 0x5b, 0xbf, 0xe3, 0x0, 0xf8, 0x8b, 0xfc, 0x1,
+    0xff, 0xf2, 0x44, 0xff, 0xc0, 0x1c, 0x57, 0x7f, 0xf8, 0x3, 0xff, 0xd4, 0xbf, 0xff, 0xfc, 0x50,
+    0xf, 0xfe, 0x6b, 0xf7, 0xc8, 0x7, 0xff, 0x5, 0x20, 0x41, 0x9c, 0x3, 0xff, 0x60, 0x6, 0xb0,
+    0xf, 0xfd, 0xe0, 0x19, 0xc0, 0x3f, 0xf3, 0x8, 0x5, 0x0, 0x1f, 0xf8, 0x7e, 0x1f, 0xc, 0x3,
+    0xc0,
+
+    /* U+1EB9 "ẹ" */
+    0x0, 0xe4, 0xad, 0xff, 0x76, 0x38, 0x80, 0x7e, 0x3d, 0xb5, 0x20, 0x0, 0x9c, 0x74, 0x0, 0x79,
+    0x70, 0x80, 0x3f, 0x9e, 0xc0, 0x31, 0xd0, 0x7, 0x84, 0x3, 0x92, 0x40, 0x2e, 0x0, 0xc7, 0x9f,
+    0xdf, 0x20, 0x19, 0x8c, 0x14, 0x80, 0x23, 0xc3, 0x0, 0x9a, 0xc0, 0x34, 0x87, 0x80, 0x68, 0x0,
+    0xf2, 0x20, 0x2, 0x50, 0x70, 0xd, 0x7f, 0xff, 0x20, 0x6, 0x12, 0x0, 0xff, 0xe2, 0x98, 0x7,
+    0xff, 0x1c, 0x80, 0x37, 0x7f, 0xff, 0xe2, 0x70, 0xc, 0xc0, 0x1f, 0xfc, 0x1e, 0x0, 0xd0, 0x60,
+    0x1e, 0x4a, 0x0, 0xc8, 0x60, 0x1b, 0x25, 0x8, 0x89, 0x56, 0xb2, 0x1, 0xb8, 0x3, 0x9a, 0xf7,
+    0x56, 0xa0, 0x6, 0x60, 0x4, 0x56, 0x1, 0xff, 0xc1, 0xf0, 0xc, 0x9a, 0x80, 0x1f, 0xe9, 0x90,
+    0x7, 0x15, 0xe3, 0x98, 0x80, 0x5, 0x27, 0x98, 0x3, 0xf1, 0xc6, 0x77, 0xfb, 0xad, 0x84, 0x3,
+    0xfe, 0x17, 0x83, 0x0, 0xff, 0xe1, 0xf, 0xc3, 0xe2, 0x0, 0x7f, 0xf0, 0x58, 0x40, 0x2f, 0x0,
+    0xff, 0xe0, 0xf8, 0x6, 0x70, 0xf, 0xfe, 0xe, 0x0, 0x6b, 0x0, 0xff, 0xe0, 0xa4, 0x8, 0x33,
+    0x80, 0x7c,
+
+    /* U+1EBA "Ẻ" */
+    0x0, 0xf2, 0x45, 0x41, 0x0, 0x7f, 0xec, 0xb7, 0x57, 0xd4, 0x0, 0xff, 0x98, 0x3, 0xa8, 0x3,
+    0xfe, 0x8a, 0xfd, 0x10, 0x14, 0x0, 0xff, 0x12, 0x81, 0x28, 0x1, 0xc0, 0x3f, 0xf8, 0x24, 0x80,
+    0x3, 0x0, 0xff, 0xc3, 0x80, 0x9, 0x0, 0xff, 0xe0, 0x8d, 0x8c, 0xb0, 0x7, 0xff, 0x9, 0x79,
+    0x80, 0x3e, 0x5f, 0xff, 0xfe, 0x24, 0x80, 0x7f, 0xfb, 0xca, 0xef, 0xff, 0x0, 0x79, 0x13, 0xfe,
+    0x20, 0xf, 0xff, 0x79, 0x7f, 0xff, 0x8c, 0x3, 0xff, 0xe0, 0x5b, 0xbf, 0xe3, 0x0, 0xf8, 0x8b,
+    0xfc, 0x1, 0xff, 0xf2, 0x44, 0xff, 0xc0, 0x1c, 0x57, 0x7f, 0xf8, 0x3, 0xff, 0xd4,
+
+    /* U+1EBB "ẻ" */
+    0x0, 0xf1, 0x3d, 0x4a, 0x0, 0x7f, 0xf0, 0x5f, 0x61, 0x5a, 0xe4, 0x3, 0xff, 0x18, 0x7, 0x32,
+    0x0, 0x7f, 0xc9, 0x1d, 0xe8, 0x0, 0xd0, 0xf, 0xfc, 0xe2, 0x1c, 0x0, 0x30, 0xf, 0xfe, 0x1e,
+    0x0, 0x34, 0x3, 0xff, 0x85, 0xc, 0x2, 0xe0, 0x1f, 0xfc, 0x2b, 0x2, 0xc0, 0xf, 0xfe, 0x19,
+    0xe6, 0x90, 0x7, 0xff, 0x10, 0xc0, 0x3f, 0xf8, 0x49, 0x5b, 0xfe, 0xec, 0x71, 0x0, 0xfc, 0x7b,
+    0x6a, 0x40, 0x1, 0x38, 0xe8, 0x0, 0xf2, 0xe1, 0x0, 0x7f, 0x3d, 0x80, 0x63, 0xa0, 0xf, 0x8,
+    0x7, 0x24, 0x80, 0x5c, 0x1, 0x8f, 0x3f, 0xbe, 0x40, 0x33, 0x18, 0x29, 0x0, 0x47, 0x86, 0x1,
+    0x35, 0x80, 0x69, 0xf, 0x0, 0xd0, 0x1, 0xe4, 0x40, 0x4, 0xa0, 0xe0, 0x1a, 0xff, 0xfe, 0x40,
+    0xc, 0x24, 0x1, 0xff, 0xc5, 0x30, 0xf, 0xfe, 0x39, 0x0, 0x6e, 0xff, 0xff, 0xc4, 0xe0, 0x19,
+    0x80, 0x3f, 0xf8, 0x3c, 0x1, 0xa0, 0xc0, 0x3c, 0x94, 0x1, 0x90, 0xc0, 0x36, 0x4a, 0x11, 0x12,
+    0xad, 0x64, 0x3, 0x70, 0x7, 0x35, 0xee, 0xad, 0x40, 0xc, 0xc0, 0x8, 0xac, 0x3, 0xff, 0x83,
+    0xe0, 0x19, 0x35, 0x0, 0x3f, 0xd3, 0x20, 0xe, 0x2b, 0xc7, 0x31, 0x0, 0xa, 0x4f, 0x30, 0x4,
+
+    /* U+1EBC "Ẽ" */
+    0x0, 0xcb, 0xbf, 0xd0, 0x1, 0x15, 0xd9, 0x40, 0x39, 0x28, 0x80, 0x5f, 0x50, 0x21, 0x10, 0x1,
+    0xe9, 0x0, 0xe2, 0xbf, 0x50, 0x2, 0x0, 0x62, 0x20, 0x16, 0xe1, 0x80, 0x73, 0x88, 0x6, 0x60,
+    0x5, 0x11, 0xe4, 0x90, 0xb, 0xc0, 0x7, 0x27, 0xf9, 0xc0, 0x26, 0xdf, 0xe8, 0x0, 0xff, 0xe5,
+    0x2f, 0xff, 0xff, 0x12, 0x40, 0x3f, 0xfd, 0xe5, 0x77, 0xff, 0x80, 0x3c, 0x89, 0xff, 0x10, 0x7,
+    0xff, 0xbc, 0xbf, 0xff, 0xc6, 0x1, 0xff, 0xf0, 0x2d, 0xdf, 0xf1, 0x80, 0x7c, 0x45, 0xfe, 0x0,
+    0xff, 0xf9, 0x22, 0x7f, 0xe0, 0xe, 0x2b, 0xbf, 0xfc, 0x1, 0xff, 0xea,
+
+    /* U+1EBD "ẽ" */
+    0x0, 0xc7, 0x9f, 0xd0, 0x1, 0x1d, 0xd8, 0x80, 0x3c, 0x38, 0x60, 0x2f, 0xa6, 0x10, 0x88, 0x30,
+    0xf, 0x40, 0x7, 0x16, 0x7a, 0x1, 0x8, 0x7, 0x90, 0x7, 0xb8, 0xa0, 0x1d, 0x20, 0x1f, 0x18,
+    0xb0, 0x8a, 0xa8, 0x62, 0x76, 0x80, 0x1f, 0x77, 0x20, 0x2, 0x5c, 0xec, 0x40, 0xf, 0xfe, 0x8a,
+    0x56, 0xff, 0xbb, 0x1c, 0x40, 0x3f, 0x1e, 0xda, 0x90, 0x0, 0x4e, 0x3a, 0x0, 0x3c, 0xb8, 0x40,
+    0x1f, 0xcf, 0x60, 0x18, 0xe8, 0x3, 0xc2, 0x1, 0xc9, 0x20, 0x17, 0x0, 0x63, 0xcf, 0xef, 0x90,
+    0xc, 0xc6, 0xa, 0x40, 0x11, 0xe1, 0x80, 0x4d, 0x60, 0x1a, 0x43, 0xc0, 0x34, 0x0, 0x79, 0x10,
+    0x1, 0x28, 0x38, 0x6, 0xbf, 0xff, 0x90, 0x3, 0x9, 0x0, 0x7f, 0xf1, 0x4c, 0x3, 0xff, 0x8e,
+    0x40, 0x1b, 0xbf, 0xff, 0xf1, 0x38, 0x6, 0x60, 0xf, 0xfe, 0xf, 0x0, 0x68, 0x30, 0xf, 0x25,
+    0x0, 0x64, 0x30, 0xd, 0x92, 0x84, 0x44, 0xab, 0x59, 0x0, 0xdc, 0x1, 0xcd, 0x7b, 0xab, 0x50,
+    0x3, 0x30, 0x2, 0x2b, 0x0, 0xff, 0xe0, 0xf8, 0x6, 0x4d, 0x40, 0xf, 0xf4, 0xc8, 0x3, 0x8a,
+    0xf1, 0xcc, 0x40, 0x2, 0x93, 0xcc, 0x1,
+
+    /* U+1EBE "Ế" */
+    0x0, 0xff, 0xe1, 0x8e, 0xff, 0xda, 0x40, 0x1f, 0xfc, 0x3d, 0x20, 0x2, 0xe9, 0x0, 0x7f, 0xf0,
+    0xac, 0xc0, 0x11, 0x40, 0x1f, 0x8e, 0x23, 0x20, 0x4a, 0x0, 0xdb, 0x80, 0x7e, 0x5c, 0x77, 0xd6,
+    0xf3, 0xfe, 0xe4, 0x0, 0xfd, 0x14, 0x0, 0x79, 0x0, 0x45, 0x0, 0x7f, 0xd4, 0xe0, 0x59, 0xd,
+    0xc8, 0xb, 0x82, 0x1, 0xfd, 0x5f, 0xed, 0x30, 0x0, 0xdf, 0xfb, 0x4, 0x3, 0xff, 0xa0, 0xbf,
+    0xff, 0xfc, 0x49, 0x0, 0xff, 0xff, 0x95, 0xdf, 0xfe, 0x0, 0xff, 0x22, 0x7f, 0xc4, 0x1, 0xff,
+    0xff, 0x2f, 0xff, 0xf1, 0x80, 0x7f, 0xff, 0xc0, 0xb7, 0x7f, 0xc6, 0x1, 0xff, 0x11, 0x7f, 0x80,
+    0x3f, 0xff, 0xe0, 0x12, 0x27, 0xfe, 0x0, 0xfe, 0x2b, 0xbf, 0xfc, 0x1, 0xff, 0xfa,
+
+    /* U+1EBF "ế" */
+    0x0, 0xff, 0xe2, 0x2c, 0x46, 0x20, 0xf, 0xfe, 0x1b, 0x53, 0xbd, 0xa4, 0x1, 0xff, 0xc2, 0x49,
+    0x0, 0xe, 0x28, 0x7, 0xff, 0x8, 0xec, 0x0, 0x9e, 0x60, 0x1f, 0xa7, 0xff, 0x60, 0x2b, 0xba,
+    0x6c, 0x40, 0x3f, 0x53, 0x0, 0x63, 0xc7, 0x88, 0x30, 0x7, 0xf5, 0xa8, 0x1, 0xe8, 0x0, 0x78,
+    0x20, 0x1f, 0xeb, 0x40, 0x2c, 0x85, 0xe4, 0x2, 0xc2, 0x0, 0xfe, 0xbf, 0xf6, 0x98, 0x0, 0x6f,
+    0xfd, 0xa4, 0x1, 0xff, 0xd5, 0x4a, 0xdf, 0xf7, 0x63, 0x88, 0x7, 0xfc, 0x7b, 0x6a, 0x40, 0x1,
+    0x38, 0xe8, 0x0, 0xfe, 0x5c, 0x20, 0xf, 0xe7, 0xb0, 0xf, 0x8e, 0x80, 0x3c, 0x20, 0x1c, 0x92,
+    0x1, 0xee, 0x0, 0xc7, 0x9f, 0xdf, 0x20, 0x19, 0x8c, 0x3, 0x29, 0x0, 0x47, 0x86, 0x1, 0x35,
+    0x80, 0x69, 0x0, 0xde, 0x1, 0xa0, 0x3, 0xc8, 0x80, 0x9, 0x40, 0x33, 0x80, 0x6b, 0xff, 0xf9,
+    0x0, 0x30, 0x80, 0x44, 0x1, 0xff, 0xc5, 0x30, 0xf, 0xfe, 0x69, 0x0, 0x6e, 0xff, 0xff, 0xc4,
+    0x1, 0x38, 0x6, 0x60, 0xf, 0xfe, 0x27, 0x0, 0x68, 0x30, 0xf, 0x25, 0x0, 0x7c, 0x86, 0x1,
+    0xb2, 0x50, 0x88, 0x95, 0x6b, 0x20, 0x1f, 0x70, 0x7, 0x35, 0xee, 0xad, 0x40, 0xc, 0xc0, 0xf,
+    0x15, 0x80, 0x7f, 0xf0, 0x7c, 0x3, 0xe4, 0xd4, 0x0, 0xff, 0x4c, 0x80, 0x3f, 0x15, 0xe3, 0x98,
+    0x80, 0x5, 0x27, 0x98, 0x3, 0xc0,
+
+    /* U+1EC0 "Ề" */
+    0x0, 0xff, 0x11, 0x70, 0x7, 0xff, 0x9, 0xf7, 0x74, 0x0, 0x7f, 0xf0, 0x57, 0x4, 0x0, 0xec,
+    0x1, 0xff, 0xc1, 0x3f, 0x40, 0x4, 0xa0, 0x7, 0xcd, 0x99, 0xa0, 0x6d, 0xc8, 0x90, 0x20, 0x1d,
+    0x12, 0x67, 0x9e, 0x82, 0x37, 0x58, 0x20, 0x1a, 0x5c, 0x0, 0xf2, 0x0, 0x5c, 0x10, 0xf, 0xad,
+    0x80, 0xb2, 0x1b, 0x4c, 0xf, 0x8, 0x3, 0xd7, 0xfe, 0xd3, 0x0, 0x16, 0x7f, 0xb4, 0x80, 0x3f,
+    0xf9, 0x4b, 0xff, 0xff, 0xc4, 0x90, 0xf, 0xff, 0x99, 0x5d, 0xff, 0xe0, 0xf, 0x91, 0x3f, 0xe2,
+    0x0, 0xff, 0xf9, 0x97, 0xff, 0xf8, 0xc0, 0x3f, 0xfe, 0x85, 0xbb, 0xfe, 0x30, 0xf, 0xc4, 0x5f,
+    0xe0, 0xf, 0xff, 0xb2, 0x27, 0xfe, 0x0, 0xf1, 0x5d, 0xff, 0xe0, 0xf, 0xff, 0x70,
+
+    /* U+1EC1 "ề" */
+    0x0, 0xff, 0x11, 0x70, 0x7, 0xff, 0x9, 0xf7, 0x74, 0x0, 0x7f, 0xf0, 0x57, 0x48, 0x0, 0xec,
+    0x1, 0xff, 0xc1, 0x2c, 0x40, 0x4, 0xa8, 0x7, 0xcd, 0x99, 0xa4, 0x6d, 0xcc, 0xd2, 0x20, 0x1d,
+    0x12, 0x67, 0x9a, 0xc2, 0x33, 0x21, 0x0, 0xd2, 0xe0, 0x7, 0x90, 0x2, 0x60, 0x80, 0x7d, 0x6c,
+    0x5, 0x90, 0xdc, 0x80, 0x78, 0x40, 0x1e, 0xbf, 0xf6, 0x98, 0x0, 0x6f, 0xfd, 0xa4, 0x1, 0xff,
+    0xcf, 0x4a, 0xdf, 0xf7, 0x63, 0x88, 0x7, 0xe3, 0xdb, 0x52, 0x0, 0x9, 0xc7, 0x40, 0x7, 0x97,
+    0x8, 0x3, 0xf9, 0xec, 0x3, 0x1d, 0x0, 0x78, 0x40, 0x39, 0x24, 0x2, 0xe0, 0xc, 0x79, 0xfd,
+    0xf2, 0x1, 0x98, 0xc1, 0x48, 0x2, 0x3c, 0x30, 0x9, 0xac, 0x3, 0x48, 0x78, 0x6, 0x80, 0xf,
+    0x22, 0x0, 0x25, 0x7, 0x0, 0xd7, 0xff, 0xf2, 0x0, 0x61, 0x20, 0xf, 0xfe, 0x29, 0x80, 0x7f,
+    0xf1, 0xc8, 0x3, 0x77, 0xff, 0xfe, 0x27, 0x0, 0xcc, 0x1, 0xff, 0xc1, 0xe0, 0xd, 0x6, 0x1,
+    0xe4, 0xa0, 0xc, 0x86, 0x1, 0xb2, 0x50, 0x88, 0x95, 0x6b, 0x20, 0x1b, 0x80, 0x39, 0xaf, 0x75,
+    0x6a, 0x0, 0x66, 0x0, 0x45, 0x60, 0x1f, 0xfc, 0x1f, 0x0, 0xc9, 0xa8, 0x1, 0xfe, 0x99, 0x0,
+    0x71, 0x5e, 0x39, 0x88, 0x0, 0x52, 0x79, 0x80, 0x20,
+
+    /* U+1EC2 "Ể" */
+    0x0, 0xff, 0x8f, 0x3f, 0xd6, 0x40, 0x1f, 0xf8, 0x4c, 0x0, 0x9c, 0x1, 0xff, 0x8b, 0x7e, 0x80,
+    0xc0, 0x3f, 0xf8, 0x24, 0x1a, 0x2, 0x1, 0xf2, 0xdd, 0xe7, 0x2, 0x70, 0xa0, 0xf, 0x3d, 0x22,
+    0x68, 0x92, 0xcd, 0x40, 0xe, 0x88, 0x0, 0x1a, 0x0, 0xd, 0x66, 0x40, 0x1d, 0x4e, 0x3, 0x72,
+    0xfa, 0x40, 0x98, 0x20, 0x1d, 0x7d, 0xd2, 0x0, 0xb, 0x7b, 0x9a, 0x20, 0x1c, 0x23, 0x0, 0x78,
+    0x46, 0x0, 0x97, 0xff, 0xff, 0x89, 0x20, 0x1f, 0xfe, 0xf2, 0xbb, 0xff, 0xc0, 0x1e, 0x44, 0xff,
+    0x88, 0x3, 0xff, 0xde, 0x5f, 0xff, 0xe3, 0x0, 0xff, 0xf8, 0x16, 0xef, 0xf8, 0xc0, 0x3e, 0x22,
+    0xff, 0x0, 0x7f, 0xfc, 0x91, 0x3f, 0xf0, 0x7, 0x15, 0xdf, 0xfe, 0x0, 0xff, 0xf5, 0x0,
+
+    /* U+1EC3 "ể" */
+    0x0, 0xff, 0x8e, 0xff, 0xd6, 0x40, 0x1f, 0xfc, 0x11, 0x40, 0x2, 0x70, 0x7, 0xff, 0x4, 0xb7,
+    0xe8, 0xc, 0x3, 0xff, 0x84, 0x41, 0xa0, 0x40, 0x1f, 0x9b, 0x33, 0x40, 0x13, 0x4, 0x80, 0x7d,
+    0x12, 0x67, 0x9e, 0xcb, 0x35, 0x0, 0x3d, 0x2e, 0x0, 0x7a, 0x0, 0x26, 0x19, 0x0, 0x7a, 0xd8,
+    0xb, 0x21, 0x79, 0x0, 0xf0, 0x80, 0x3d, 0x7f, 0xed, 0x30, 0x0, 0xdf, 0xfb, 0x48, 0x3, 0xff,
+    0x9e, 0x95, 0xbf, 0xee, 0xc7, 0x10, 0xf, 0xc7, 0xb6, 0xa4, 0x0, 0x13, 0x8e, 0x80, 0xf, 0x2e,
+    0x10, 0x7, 0xf3, 0xd8, 0x6, 0x3a, 0x0, 0xf0, 0x80, 0x72, 0x48, 0x5, 0xc0, 0x18, 0xf3, 0xfb,
+    0xe4, 0x3, 0x31, 0x82, 0x90, 0x4, 0x78, 0x60, 0x13, 0x58, 0x6, 0x90, 0xf0, 0xd, 0x0, 0x1e,
+    0x44, 0x0, 0x4a, 0xe, 0x1, 0xaf, 0xff, 0xe4, 0x0, 0xc2, 0x40, 0x1f, 0xfc, 0x53, 0x0, 0xff,
+    0xe3, 0x90, 0x6, 0xef, 0xff, 0xfc, 0x4e, 0x1, 0x98, 0x3, 0xff, 0x83, 0xc0, 0x1a, 0xc, 0x3,
+    0xc9, 0x40, 0x19, 0xc, 0x3, 0x64, 0xa1, 0x11, 0x2a, 0xd6, 0x40, 0x37, 0x0, 0x73, 0x5e, 0xea,
+    0xd4, 0x0, 0xcc, 0x0, 0x8a, 0xc0, 0x3f, 0xf8, 0x3e, 0x1, 0x93, 0x50, 0x3, 0xfd, 0x32, 0x0,
+    0xe2, 0xbc, 0x73, 0x10, 0x0, 0xa4, 0xf3, 0x0, 0x40,
+
+    /* U+1EC4 "Ễ" */
+    0x0, 0xe4, 0x77, 0x8, 0x4, 0x71, 0x0, 0xf, 0xae, 0xd1, 0xe, 0x60, 0x5, 0x3b, 0x80, 0x3c,
+    0xc8, 0x1, 0xa6, 0xe5, 0x80, 0xc0, 0x3d, 0xa0, 0xc, 0xe4, 0x4, 0x60, 0x4, 0x0, 0x79, 0x81,
+    0xc, 0x6e, 0x48, 0xa, 0x50, 0x3, 0xdb, 0xf6, 0x1, 0x36, 0xfe, 0xb0, 0x7, 0xf9, 0x6e, 0xf3,
+    0x80, 0x7f, 0xcd, 0x48, 0x9a, 0x24, 0x3, 0xfa, 0x24, 0x0, 0xd0, 0x0, 0x6b, 0x0, 0xfa, 0x9c,
+    0x6, 0xa5, 0xf0, 0x81, 0x30, 0x40, 0x3a, 0xfb, 0xa5, 0x0, 0x1e, 0xf7, 0x34, 0x40, 0x38, 0x46,
+    0x0, 0xf0, 0x8c, 0x1, 0x2f, 0xff, 0xff, 0x12, 0x40, 0x3f, 0xfd, 0xe5, 0x77, 0xff, 0x80, 0x3c,
+    0x89, 0xff, 0x10, 0x7, 0xff, 0xbc, 0xbf, 0xff, 0xc6, 0x1, 0xff, 0xf0, 0x2d, 0xdf, 0xf1, 0x80,
+    0x7c, 0x45, 0xfe, 0x0, 0xff, 0xf9, 0x22, 0x7f, 0xe0, 0xe, 0x2b, 0xbf, 0xfc, 0x1, 0xff, 0xea,
+
+    /* U+1EC5 "ễ" */
+    0x0, 0xe5, 0x77, 0x10, 0x4, 0x71, 0x0, 0xf, 0xd9, 0x51, 0xd, 0xa2, 0x8, 0x77, 0x0, 0x7d,
+    0x6, 0x1, 0x97, 0x7d, 0x1, 0x0, 0x3e, 0x40, 0x1d, 0xe7, 0x0, 0xc3, 0x20, 0x1f, 0x5b, 0xd9,
+    0xc, 0x74, 0xc4, 0xf1, 0x0, 0x7c, 0xf0, 0xa0, 0x10, 0xb3, 0xb0, 0x7, 0xfe, 0x8f, 0xfd, 0x60,
+    0x1f, 0xfa, 0x5c, 0x3, 0x26, 0x8, 0x7, 0xf5, 0x30, 0x1, 0xe8, 0x0, 0x78, 0x20, 0x1f, 0x5a,
+    0x81, 0x64, 0x2f, 0x20, 0x16, 0x10, 0x7, 0xaf, 0xfd, 0xa6, 0x0, 0x1b, 0xff, 0x69, 0x0, 0x7f,
+    0xf3, 0xd2, 0xb7, 0xfd, 0xd8, 0xe2, 0x1, 0xf8, 0xf6, 0xd4, 0x80, 0x2, 0x71, 0xd0, 0x1, 0xe5,
+    0xc2, 0x0, 0xfe, 0x7b, 0x0, 0xc7, 0x40, 0x1e, 0x10, 0xe, 0x49, 0x0, 0xb8, 0x3, 0x1e, 0x7f,
+    0x7c, 0x80, 0x66, 0x30, 0x52, 0x0, 0x8f, 0xc, 0x2, 0x6b, 0x0, 0xd2, 0x1e, 0x1, 0xa0, 0x3,
+    0xc8, 0x80, 0x9, 0x41, 0xc0, 0x35, 0xff, 0xfc, 0x80, 0x18, 0x48, 0x3, 0xff, 0x8a, 0x60, 0x1f,
+    0xfc, 0x72, 0x0, 0xdd, 0xff, 0xff, 0x89, 0xc0, 0x33, 0x0, 0x7f, 0xf0, 0x78, 0x3, 0x41, 0x80,
+    0x79, 0x28, 0x3, 0x21, 0x80, 0x6c, 0x94, 0x22, 0x25, 0x5a, 0xc8, 0x6, 0xe0, 0xe, 0x6b, 0xdd,
+    0x5a, 0x80, 0x19, 0x80, 0x11, 0x58, 0x7, 0xff, 0x7, 0xc0, 0x32, 0x6a, 0x0, 0x7f, 0xa6, 0x40,
+    0x1c, 0x57, 0x8e, 0x62, 0x0, 0x14, 0x9e, 0x60, 0x8,
+
+    /* U+1EC6 "Ệ" */
+    0x0, 0xf1, 0x44, 0x64, 0x0, 0xff, 0x8b, 0x1d, 0xf5, 0xa0, 0x7, 0xf0, 0xe0, 0x80, 0x98, 0x2,
+    0xcc, 0x3, 0xe1, 0xc1, 0x2, 0xcc, 0x20, 0x3, 0xc, 0x3, 0xda, 0x40, 0x78, 0x41, 0x6a, 0x0,
+    0xd2, 0x0, 0xec, 0xff, 0x60, 0x80, 0x55, 0xfe, 0xe2, 0x0, 0xff, 0xe4, 0x2f, 0xff, 0xff, 0x12,
+    0x40, 0x3f, 0xfd, 0xe5, 0x77, 0xff, 0x80, 0x3c, 0x89, 0xff, 0x10, 0x7, 0xff, 0xbc, 0xbf, 0xff,
+    0xc6, 0x1, 0xff, 0xf0, 0x2d, 0xdf, 0xf1, 0x80, 0x7c, 0x45, 0xfe, 0x0, 0xff, 0xf9, 0x22, 0x7f,
+    0xe0, 0xe, 0x2b, 0xbf, 0xfc, 0x1, 0xff, 0xea, 0x5f, 0xff, 0xfe, 0x28, 0x7, 0xff, 0x35, 0xfb,
+    0xe4, 0x3, 0xff, 0x82, 0x90, 0x20, 0xce, 0x1, 0xff, 0xb0, 0x3, 0x58, 0x7, 0xfe, 0xf0, 0xc,
+    0xe0, 0x1f, 0xf9, 0x84, 0x2, 0x80, 0xf, 0xfc, 0x3f, 0xf, 0x86, 0x1, 0xe0,
+
+    /* U+1EC7 "ệ" */
+    0x0, 0xf4, 0xff, 0xeb, 0x0, 0xff, 0xd0, 0xc0, 0x19, 0x2c, 0x3, 0xfc, 0xee, 0x0, 0x1b, 0x0,
+    0x12, 0x80, 0x3f, 0x34, 0x0, 0x1b, 0x26, 0x40, 0x5, 0x90, 0xf, 0x85, 0xdd, 0x52, 0x0, 0x6c,
+    0x77, 0x9, 0x0, 0x79, 0xe2, 0xa, 0x1, 0x8e, 0x22, 0x20, 0xf, 0xfe, 0x7a, 0x56, 0xff, 0xbb,
+    0x1c, 0x40, 0x3f, 0x1e, 0xda, 0x90, 0x0, 0x4e, 0x3a, 0x0, 0x3c, 0xb8, 0x40, 0x1f, 0xcf, 0x60,
+    0x18, 0xe8, 0x3, 0xc2, 0x1, 0xc9, 0x20, 0x17, 0x0, 0x63, 0xcf, 0xef, 0x90, 0xc, 0xc6, 0xa,
+    0x40, 0x11, 0xe1, 0x80, 0x4d, 0x60, 0x1a, 0x43, 0xc0, 0x34, 0x0, 0x79, 0x10, 0x1, 0x28, 0x38,
+    0x6, 0xbf, 0xff, 0x90, 0x3, 0x9, 0x0, 0x7f, 0xf1, 0x4c, 0x3, 0xff, 0x8e, 0x40, 0x1b, 0xbf,
+    0xff, 0xf1, 0x38, 0x6, 0x60, 0xf, 0xfe, 0xf, 0x0, 0x68, 0x30, 0xf, 0x25, 0x0, 0x64, 0x30,
+    0xd, 0x92, 0x84, 0x44, 0xab, 0x59, 0x0, 0xdc, 0x1, 0xcd, 0x7b, 0xab, 0x50, 0x3, 0x30, 0x2,
+    0x2b, 0x0, 0xff, 0xe0, 0xf8, 0x6, 0x4d, 0x40, 0xf, 0xf4, 0xc8, 0x3, 0x8a, 0xf1, 0xcc, 0x40,
+    0x2, 0x93, 0xcc, 0x1, 0xf8, 0xe3, 0x3b, 0xfd, 0xd6, 0xc2, 0x1, 0xff, 0xb, 0xc1, 0x80, 0x7f,
+    0xf0, 0x87, 0xe1, 0xf1, 0x0, 0x3f, 0xf8, 0x2c, 0x20, 0x17, 0x80, 0x7f, 0xf0, 0x7c, 0x3, 0x38,
+    0x7, 0xff, 0x7, 0x0, 0x35, 0x80, 0x7f, 0xf0, 0x52, 0x4, 0x19, 0xc0, 0x3e,
+
+    /* U+1EC8 "Ỉ" */
+    0x4, 0x8a, 0x83, 0x0, 0x55, 0xba, 0xbe, 0x30, 0x68, 0x7, 0x49, 0x3c, 0xff, 0x10, 0x1, 0x1,
+    0x80, 0x50, 0x3, 0xc2, 0xe0, 0x4, 0x0, 0xb0, 0x41, 0x88, 0x2, 0xe1, 0x89, 0x0, 0xc7, 0xce,
+    0x1, 0x2f, 0xfe, 0xd0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3, 0xff, 0x9e,
+
+    /* U+1EC9 "ỉ" */
+    0x3, 0xae, 0xfe, 0x70, 0xb, 0x94, 0x40, 0x62, 0x80, 0x16, 0x2a, 0x60, 0x5, 0x30, 0x6e, 0xac,
+    0x30, 0x3, 0x0, 0x7e, 0x60, 0xd, 0x26, 0x6, 0x60, 0xc, 0x60, 0x5a, 0x1, 0xd5, 0x3a, 0x20,
+    0x1e, 0x60, 0xe, 0xbf, 0xfc, 0x80, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8, 0x6,
+
+    /* U+1ECA "Ị" */
+    0x5f, 0xfd, 0xa0, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0x6a, 0xff, 0xed, 0x0, 0xf9, 0x7b, 0xe8, 0x4a,
+    0x84, 0x16, 0xd0, 0x3, 0x21, 0x80, 0x63, 0x52, 0x0, 0xa0, 0x32, 0x1e, 0xd4,
+
+    /* U+1ECB "ị" */
+    0x2, 0xbf, 0xe9, 0x0, 0x62, 0x0, 0xb4, 0xa0, 0x80, 0x64, 0x70, 0xe, 0x13, 0x30, 0x6, 0x90,
+    0xc8, 0x45, 0xb5, 0x0, 0x3d, 0xd2, 0x0, 0x7f, 0x5f, 0xfe, 0x40, 0xf, 0xff, 0xf8, 0x7, 0xff,
+    0x86, 0xff, 0xf2, 0x0, 0x7f, 0x57, 0xf2, 0x80, 0x25, 0x40, 0x68, 0xc1, 0x0, 0x32, 0x0, 0x80,
+    0x61, 0x9, 0x0, 0x89, 0x81, 0x71, 0xe3, 0x0,
+
+    /* U+1ECC "Ọ" */
+    0x0, 0xf8, 0x5a, 0xb7, 0xfe, 0xda, 0x61, 0x0, 0xff, 0xc3, 0x3d, 0x2a, 0x40, 0x11, 0x2c, 0xf5,
+    0x8, 0x7, 0xf2, 0xf3, 0x0, 0x7f, 0xcb, 0xca, 0x1, 0xf3, 0xd0, 0x7, 0xff, 0xe, 0x9c, 0x3,
+    0x96, 0x0, 0x3c, 0x4a, 0xca, 0x40, 0x1e, 0x85, 0x0, 0x86, 0x80, 0x39, 0x37, 0x55, 0x35, 0xba,
+    0x40, 0xe, 0xa1, 0x0, 0x58, 0x7, 0x3d, 0x90, 0x7, 0x15, 0xb8, 0x7, 0x58, 0xa, 0x80, 0x65,
+    0x80, 0xf, 0xe8, 0x50, 0xc, 0xa2, 0x80, 0x1d, 0x0, 0x1f, 0xf4, 0x0, 0x73, 0xe0, 0x6, 0x32,
+    0x0, 0xff, 0x88, 0xc0, 0x37, 0x90, 0x6, 0x50, 0xf, 0xfe, 0xa, 0x0, 0x62, 0x0, 0xe1, 0x0,
+    0xff, 0xe0, 0xf8, 0x6, 0x70, 0xe, 0x10, 0xf, 0xfe, 0xf, 0x80, 0x67, 0x20, 0xc, 0xa0, 0x1f,
+    0xfc, 0x14, 0x0, 0xc5, 0x80, 0x18, 0xc8, 0x3, 0xfe, 0x13, 0x0, 0xde, 0x80, 0x1d, 0x0, 0x1f,
+    0xf5, 0x80, 0x73, 0x8a, 0x80, 0x65, 0x70, 0xf, 0xe7, 0x50, 0xc, 0xa2, 0x16, 0x1, 0xd1, 0x44,
+    0x1, 0xc5, 0x70, 0x1, 0xd0, 0x0, 0x19, 0x0, 0xe5, 0xdc, 0x98, 0x9c, 0xd4, 0x0, 0xe9, 0x20,
+    0x9, 0xa0, 0x3, 0xc6, 0xce, 0xc6, 0x1, 0xe8, 0x60, 0xe, 0x79, 0x0, 0xff, 0xe1, 0xcb, 0x80,
+    0x7c, 0xda, 0xa0, 0x1f, 0xf2, 0xf3, 0x0, 0x7f, 0x15, 0x74, 0xa9, 0x0, 0x44, 0xb3, 0xd4, 0x20,
+    0x1f, 0xf8, 0x5a, 0xb7, 0xfe, 0xda, 0x61, 0x0, 0xff, 0xe3, 0x34, 0x30, 0x7, 0xff, 0x26, 0xa5,
+    0xe6, 0x40, 0x1f, 0xfc, 0x71, 0x50, 0x9, 0x84, 0x3, 0xff, 0x8c, 0x60, 0x1c, 0x60, 0x1f, 0xfc,
+    0x62, 0x10, 0x8, 0x88, 0x1, 0xff, 0xc7, 0xc3, 0x3, 0xf0, 0xf, 0xf0,
+
+    /* U+1ECD "ọ" */
+    0x0, 0xe4, 0x9d, 0xff, 0xb6, 0x4c, 0x3, 0xf1, 0x65, 0xb1, 0x0, 0x44, 0xd9, 0x64, 0x1, 0xc9,
+    0xa6, 0x1, 0xfc, 0x9a, 0x80, 0x11, 0x58, 0x7, 0xff, 0x6, 0xc8, 0x1, 0xe0, 0x1c, 0x95, 0x94,
+    0x80, 0x1d, 0xc0, 0xa4, 0x1, 0xa6, 0xd4, 0xd6, 0xe4, 0x3, 0x1a, 0x78, 0x6, 0x56, 0x0, 0xe6,
+    0x50, 0xd, 0xce, 0x1, 0xb8, 0x3, 0xee, 0x0, 0xce, 0x40, 0x19, 0x40, 0x3e, 0x60, 0xc, 0x60,
+    0x1f, 0xfc, 0x72, 0x0, 0xca, 0x1, 0xf3, 0x80, 0x63, 0x70, 0xd, 0xc0, 0x1f, 0x70, 0x6, 0x4e,
+    0x0, 0xca, 0xc0, 0x1c, 0xc8, 0x1, 0xb5, 0xc, 0x3, 0x4d, 0xa9, 0xad, 0xc8, 0x6, 0x34, 0xe,
+    0x0, 0xe4, 0xac, 0xa4, 0x0, 0xee, 0x0, 0x15, 0x80, 0x7f, 0xe1, 0xc2, 0x0, 0x93, 0x50, 0x3,
+    0xf9, 0x30, 0xc0, 0x38, 0xaf, 0x18, 0x80, 0x22, 0x6c, 0xb2, 0x0, 0xfc, 0x73, 0xbf, 0xf6, 0xc9,
+    0x80, 0x7f, 0xf0, 0x5a, 0x14, 0x3, 0xff, 0x87, 0x72, 0xf5, 0x0, 0x1f, 0xfc, 0x12, 0x40, 0x9,
+    0xc0, 0x3f, 0xf8, 0x22, 0x1, 0xc2, 0x1, 0xff, 0x8c, 0x40, 0x22, 0x10, 0xf, 0xfe, 0xe, 0x90,
+    0x1f, 0x80, 0x7c,
+
+    /* U+1ECE "Ỏ" */
+    0x0, 0xfe, 0x8d, 0xff, 0x50, 0x80, 0x7f, 0xf1, 0xa1, 0xc8, 0x0, 0xb8, 0x1, 0xff, 0xc6, 0x90,
+    0x34, 0x0, 0x13, 0x80, 0x7f, 0xf1, 0x47, 0x72, 0xe0, 0x1, 0xa0, 0x1f, 0xfc, 0x62, 0x0, 0x10,
+    0x7, 0xff, 0x33, 0x80, 0x18, 0x1, 0xff, 0xc8, 0x94, 0x2, 0x60, 0xf, 0xfe, 0x44, 0xa, 0x60,
+    0x7, 0xff, 0x24, 0x7e, 0xc4, 0x3, 0xff, 0x8a, 0x2d, 0x5b, 0xfd, 0xfb, 0x4c, 0x20, 0x1f, 0xf8,
+    0x67, 0xa5, 0x48, 0x2, 0x25, 0x9e, 0xa1, 0x0, 0xfe, 0x5e, 0x60, 0xf, 0xf9, 0x79, 0x40, 0x3e,
+    0x7a, 0x0, 0xff, 0xe1, 0xd3, 0x80, 0x72, 0xc0, 0x7, 0x89, 0x59, 0x48, 0x3, 0xd0, 0xa0, 0x10,
+    0xd0, 0x7, 0x26, 0xea, 0xa6, 0xb7, 0x48, 0x1, 0xd4, 0x20, 0xb, 0x0, 0xe7, 0xb2, 0x0, 0xe2,
+    0xb7, 0x0, 0xeb, 0x1, 0x50, 0xc, 0xb0, 0x1, 0xfd, 0xa, 0x1, 0x94, 0x50, 0x3, 0xa0, 0x3,
+    0xfe, 0x80, 0xe, 0x7c, 0x0, 0xc6, 0x40, 0x1f, 0xf1, 0x18, 0x6, 0xf2, 0x0, 0xca, 0x1, 0xff,
+    0xc1, 0x40, 0xc, 0x40, 0x1c, 0x20, 0x1f, 0xfc, 0x1f, 0x0, 0xce, 0x1, 0xc2, 0x1, 0xff, 0xc1,
+    0xf0, 0xc, 0xe4, 0x1, 0x94, 0x3, 0xff, 0x82, 0x80, 0x18, 0xb0, 0x3, 0x19, 0x0, 0x7f, 0xc2,
+    0x60, 0x1b, 0xd0, 0x3, 0xa0, 0x3, 0xfe, 0xb0, 0xe, 0x71, 0x50, 0xc, 0xae, 0x1, 0xfc, 0xea,
+    0x1, 0x94, 0x42, 0xc0, 0x3a, 0x28, 0x80, 0x38, 0xae, 0x0, 0x3a, 0x0, 0x3, 0x20, 0x1c, 0xbb,
+    0x93, 0x13, 0x9a, 0x80, 0x1d, 0x24, 0x1, 0x34, 0x0, 0x78, 0xd9, 0xd8, 0xc0, 0x3d, 0xc, 0x1,
+    0xcf, 0x20, 0x1f, 0xfc, 0x39, 0x70, 0xf, 0x9b, 0x54, 0x3, 0xfe, 0x5e, 0x60, 0xf, 0xe2, 0xae,
+    0x95, 0x20, 0x8, 0x96, 0x7a, 0x84, 0x3, 0x80,
+
+    /* U+1ECF "ỏ" */
+    0x0, 0xf0, 0xb4, 0xc9, 0x80, 0x3f, 0xf8, 0x27, 0xd2, 0xcc, 0x9d, 0x10, 0xf, 0xf8, 0xc4, 0x3,
+    0x14, 0x0, 0x7f, 0xeb, 0xcf, 0x90, 0x3, 0x80, 0x7f, 0xe5, 0x30, 0x60, 0x0, 0x80, 0x7f, 0xf0,
+    0xd0, 0x0, 0x60, 0x1f, 0xfc, 0x24, 0xb0, 0x4, 0x0, 0x7f, 0xf0, 0x94, 0x82, 0x50, 0x3, 0xff,
+    0x84, 0x39, 0xac, 0x1, 0xff, 0xc4, 0x12, 0x0, 0xff, 0xe0, 0xa4, 0xef, 0xfd, 0xb2, 0x60, 0x1f,
+    0x8b, 0x2d, 0x88, 0x2, 0x26, 0xcb, 0x20, 0xe, 0x4d, 0x30, 0xf, 0xe4, 0xd4, 0x0, 0x8a, 0xc0,
+    0x3f, 0xf8, 0x36, 0x40, 0xf, 0x0, 0xe4, 0xac, 0xa4, 0x0, 0xee, 0x5, 0x20, 0xd, 0x36, 0xa6,
+    0xb7, 0x20, 0x18, 0xd3, 0xc0, 0x32, 0xb0, 0x7, 0x32, 0x80, 0x6e, 0x70, 0xd, 0xc0, 0x1f, 0x70,
+    0x6, 0x72, 0x0, 0xca, 0x1, 0xf3, 0x0, 0x63, 0x0, 0xff, 0xe3, 0x90, 0x6, 0x50, 0xf, 0x9c,
+    0x3, 0x1b, 0x80, 0x6e, 0x0, 0xfb, 0x80, 0x32, 0x70, 0x6, 0x56, 0x0, 0xe6, 0x40, 0xd, 0xa8,
+    0x60, 0x1a, 0x6d, 0x4d, 0x6e, 0x40, 0x31, 0xa0, 0x70, 0x7, 0x25, 0x65, 0x20, 0x7, 0x70, 0x0,
+    0xac, 0x3, 0xff, 0xe, 0x10, 0x4, 0x9a, 0x80, 0x1f, 0xc9, 0x86, 0x1, 0xc5, 0x78, 0xc4, 0x1,
+    0x13, 0x65, 0x90, 0x4,
+
+    /* U+1ED0 "Ố" */
+    0x0, 0xff, 0xe3, 0x94, 0x46, 0x50, 0xf, 0xfe, 0x30, 0xe3, 0xbc, 0x4a, 0x1, 0xff, 0xc5, 0x1c,
+    0x10, 0x4, 0x50, 0x7, 0xff, 0x1a, 0x88, 0x6, 0xdc, 0x3, 0xfe, 0x5f, 0xfe, 0x53, 0x33, 0xbb,
+    0x10, 0x3, 0xfe, 0x7a, 0x0, 0x18, 0x2, 0xae, 0x22, 0x20, 0xf, 0xfa, 0xa0, 0x6, 0xf2, 0xc4,
+    0x1e, 0x80, 0x3f, 0xf8, 0x28, 0x4f, 0x1e, 0x80, 0x9f, 0xe, 0x4a, 0x1, 0xff, 0x92, 0x20, 0xe2,
+    0x1, 0xb, 0xc4, 0x14, 0x3, 0xff, 0xb4, 0x2d, 0x5b, 0xff, 0x6d, 0x30, 0x80, 0x7f, 0xe1, 0x9e,
+    0x95, 0x20, 0x8, 0x96, 0x7a, 0x84, 0x3, 0xf9, 0x79, 0x80, 0x3f, 0xe5, 0xe5, 0x0, 0xf9, 0xe8,
+    0x3, 0xff, 0x87, 0x4e, 0x1, 0xcb, 0x0, 0x1e, 0x25, 0x65, 0x20, 0xf, 0x42, 0x80, 0x43, 0x40,
+    0x1c, 0x9b, 0xaa, 0x9a, 0xdd, 0x20, 0x7, 0x50, 0x80, 0x2c, 0x3, 0x9e, 0xc8, 0x3, 0x8a, 0xdc,
+    0x3, 0xac, 0x5, 0x40, 0x32, 0xc0, 0x7, 0xf4, 0x28, 0x6, 0x51, 0x40, 0xe, 0x80, 0xf, 0xfa,
+    0x0, 0x39, 0xf0, 0x3, 0x19, 0x0, 0x7f, 0xc4, 0x60, 0x1b, 0xc8, 0x3, 0x28, 0x7, 0xff, 0x5,
+    0x0, 0x31, 0x0, 0x70, 0x80, 0x7f, 0xf0, 0x7c, 0x3, 0x38, 0x7, 0x8, 0x7, 0xff, 0x7, 0xc0,
+    0x33, 0x90, 0x6, 0x50, 0xf, 0xfe, 0xa, 0x0, 0x62, 0xc0, 0xc, 0x64, 0x1, 0xff, 0x9, 0x80,
+    0x6f, 0x40, 0xe, 0x80, 0xf, 0xfa, 0xc0, 0x39, 0xc5, 0x40, 0x32, 0xb8, 0x7, 0xf3, 0xa8, 0x6,
+    0x51, 0xb, 0x0, 0xe8, 0xa2, 0x0, 0xe2, 0xb8, 0x0, 0xe8, 0x0, 0xc, 0x80, 0x72, 0xee, 0x4c,
+    0x4e, 0x6a, 0x0, 0x74, 0x90, 0x4, 0xd0, 0x1, 0xe3, 0x67, 0x63, 0x0, 0xf4, 0x30, 0x7, 0x3c,
+    0x80, 0x7f, 0xf0, 0xe5, 0xc0, 0x3e, 0x6d, 0x50, 0xf, 0xf9, 0x79, 0x80, 0x3f, 0x8a, 0xba, 0x54,
+    0x80, 0x22, 0x59, 0xea, 0x10, 0xe,
+
+    /* U+1ED1 "ố" */
+    0x0, 0xff, 0xe2, 0x1c, 0x46, 0x40, 0xf, 0xfe, 0x19, 0x6b, 0xbc, 0x28, 0x1, 0xff, 0xc2, 0x1f,
+    0x10, 0x4, 0xc8, 0x3, 0xff, 0x87, 0xa4, 0x3, 0x8c, 0x1, 0xf9, 0x3f, 0xf7, 0x1a, 0x21, 0xe3,
+    0xcc, 0x3, 0xf2, 0xd8, 0x6, 0x1c, 0x8, 0x83, 0x88, 0x7, 0xe6, 0xa0, 0x2, 0x59, 0x80, 0x2d,
+    0x0, 0x3f, 0xcf, 0x20, 0x9, 0xb4, 0xc7, 0x0, 0x5a, 0x80, 0x7f, 0x3f, 0xfc, 0xc0, 0x14, 0x7f,
+    0xca, 0x1, 0xff, 0xd5, 0x49, 0xdf, 0xfb, 0x64, 0xc0, 0x3f, 0xe2, 0xcb, 0x62, 0x0, 0x89, 0xb2,
+    0xc8, 0x3, 0xf2, 0x69, 0x80, 0x7f, 0x26, 0xa0, 0x7, 0x8a, 0xc0, 0x3f, 0xf8, 0x36, 0x40, 0x1d,
+    0xe0, 0x1c, 0x95, 0x94, 0x80, 0x1d, 0xc0, 0x19, 0x48, 0x3, 0x4d, 0xa9, 0xad, 0xc8, 0x6, 0x34,
+    0x0, 0xbc, 0x3, 0x2b, 0x0, 0x73, 0x28, 0x6, 0xe0, 0x9, 0xc0, 0x37, 0x0, 0x7d, 0xc0, 0x19,
+    0xc0, 0x22, 0x0, 0xca, 0x1, 0xf3, 0x0, 0x63, 0x0, 0xff, 0xe6, 0x90, 0x6, 0x50, 0xf, 0x9c,
+    0x3, 0x18, 0x4, 0xe0, 0x1b, 0x80, 0x3e, 0xe0, 0xc, 0x80, 0x17, 0x0, 0x65, 0x60, 0xe, 0x64,
+    0x0, 0xda, 0x1, 0x21, 0x80, 0x69, 0xb5, 0x35, 0xb9, 0x0, 0xc6, 0x80, 0x1b, 0x80, 0x39, 0x2b,
+    0x29, 0x0, 0x3b, 0x80, 0x38, 0xac, 0x3, 0xff, 0xe, 0x10, 0x7, 0x93, 0x50, 0x3, 0xf9, 0x30,
+    0xc0, 0x3f, 0x15, 0xe3, 0x10, 0x4, 0x4d, 0x96, 0x40, 0x1e,
+
+    /* U+1ED2 "Ồ" */
+    0x0, 0xff, 0xe0, 0x89, 0x16, 0x10, 0xf, 0xfe, 0x39, 0xfe, 0xed, 0x82, 0x1, 0xff, 0xc6, 0x2d,
+    0x50, 0x1, 0x68, 0x7, 0xff, 0x22, 0xa4, 0x0, 0x74, 0x1, 0xff, 0xc1, 0x2b, 0xcc, 0xac, 0x9b,
+    0xc, 0x9d, 0x80, 0x3f, 0xe3, 0xc4, 0x33, 0x93, 0xc, 0xd9, 0xba, 0x60, 0xf, 0xf2, 0x60, 0x81,
+    0xd9, 0x80, 0xe2, 0x0, 0x7f, 0xf0, 0x5a, 0xc0, 0x11, 0x89, 0x90, 0x0, 0xb6, 0x0, 0xff, 0xcd,
+    0xff, 0x38, 0x4, 0xff, 0xf3, 0x0, 0x7f, 0xf6, 0x85, 0xab, 0x7f, 0xed, 0xa6, 0x10, 0xf, 0xfc,
+    0x33, 0xd2, 0xa4, 0x1, 0x12, 0xcf, 0x50, 0x80, 0x7f, 0x2f, 0x30, 0x7, 0xfc, 0xbc, 0xa0, 0x1f,
+    0x3d, 0x0, 0x7f, 0xf0, 0xe9, 0xc0, 0x39, 0x60, 0x3, 0xc4, 0xac, 0xa4, 0x1, 0xe8, 0x50, 0x8,
+    0x68, 0x3, 0x93, 0x75, 0x53, 0x5b, 0xa4, 0x0, 0xea, 0x10, 0x5, 0x80, 0x73, 0xd9, 0x0, 0x71,
+    0x5b, 0x80, 0x75, 0x80, 0xa8, 0x6, 0x58, 0x0, 0xfe, 0x85, 0x0, 0xca, 0x28, 0x1, 0xd0, 0x1,
+    0xff, 0x40, 0x7, 0x3e, 0x0, 0x63, 0x20, 0xf, 0xf8, 0x8c, 0x3, 0x79, 0x0, 0x65, 0x0, 0xff,
+    0xe0, 0xa0, 0x6, 0x20, 0xe, 0x10, 0xf, 0xfe, 0xf, 0x80, 0x67, 0x0, 0xe1, 0x0, 0xff, 0xe0,
+    0xf8, 0x6, 0x72, 0x0, 0xca, 0x1, 0xff, 0xc1, 0x40, 0xc, 0x58, 0x1, 0x8c, 0x80, 0x3f, 0xe1,
+    0x30, 0xd, 0xe8, 0x1, 0xd0, 0x1, 0xff, 0x58, 0x7, 0x38, 0xa8, 0x6, 0x57, 0x0, 0xfe, 0x75,
+    0x0, 0xca, 0x21, 0x60, 0x1d, 0x14, 0x40, 0x1c, 0x57, 0x0, 0x1d, 0x0, 0x1, 0x90, 0xe, 0x5d,
+    0xc9, 0x89, 0xcd, 0x40, 0xe, 0x92, 0x0, 0x9a, 0x0, 0x3c, 0x6c, 0xec, 0x60, 0x1e, 0x86, 0x0,
+    0xe7, 0x90, 0xf, 0xfe, 0x1c, 0xb8, 0x7, 0xcd, 0xaa, 0x1, 0xff, 0x2f, 0x30, 0x7, 0xf1, 0x57,
+    0x4a, 0x90, 0x4, 0x4b, 0x3d, 0x42, 0x1, 0xc0,
+
+    /* U+1ED3 "ồ" */
+    0x0, 0xff, 0x9, 0x16, 0x0, 0xff, 0xe1, 0x1f, 0xee, 0xd8, 0x1, 0xff, 0xc1, 0x2d, 0x50, 0x1,
+    0xd8, 0x7, 0xff, 0xa, 0xa0, 0x0, 0x92, 0x1, 0xf1, 0x66, 0x6b, 0x17, 0xb3, 0x32, 0xa8, 0x3,
+    0x93, 0x4c, 0xf2, 0x79, 0x26, 0x64, 0xa0, 0x19, 0x6c, 0x0, 0x96, 0x60, 0x3a, 0x60, 0x1f, 0x3d,
+    0x0, 0x26, 0xd3, 0x1c, 0x1, 0x8a, 0x1, 0xe7, 0xff, 0x98, 0x2, 0x8f, 0xf9, 0x40, 0x3f, 0xf9,
+    0xe9, 0x3b, 0xff, 0x6c, 0x98, 0x7, 0xe2, 0xcb, 0x62, 0x0, 0x89, 0xb2, 0xc8, 0x3, 0x93, 0x4c,
+    0x3, 0xf9, 0x35, 0x0, 0x22, 0xb0, 0xf, 0xfe, 0xd, 0x90, 0x3, 0xc0, 0x39, 0x2b, 0x29, 0x0,
+    0x3b, 0x81, 0x48, 0x3, 0x4d, 0xa9, 0xad, 0xc8, 0x6, 0x34, 0xf0, 0xc, 0xac, 0x1, 0xcc, 0xa0,
+    0x1b, 0x9c, 0x3, 0x70, 0x7, 0xdc, 0x1, 0x9c, 0x80, 0x32, 0x80, 0x7c, 0xc0, 0x18, 0xc0, 0x3f,
+    0xf8, 0xe4, 0x1, 0x94, 0x3, 0xe7, 0x0, 0xc6, 0xe0, 0x1b, 0x80, 0x3e, 0xe0, 0xc, 0x9c, 0x1,
+    0x95, 0x80, 0x39, 0x90, 0x3, 0x6a, 0x18, 0x6, 0x9b, 0x53, 0x5b, 0x90, 0xc, 0x68, 0x1c, 0x1,
+    0xc9, 0x59, 0x48, 0x1, 0xdc, 0x0, 0x2b, 0x0, 0xff, 0xc3, 0x84, 0x1, 0x26, 0xa0, 0x7, 0xf2,
+    0x61, 0x80, 0x71, 0x5e, 0x31, 0x0, 0x44, 0xd9, 0x64, 0x1,
+
+    /* U+1ED4 "Ổ" */
+    0x0, 0xff, 0xe1, 0xcf, 0x7e, 0xa8, 0x7, 0xff, 0x21, 0x44, 0xa, 0x88, 0x3, 0xff, 0x8f, 0xbf,
+    0xe1, 0x4, 0x0, 0xff, 0xe3, 0x88, 0x8, 0x80, 0x80, 0x3f, 0xf8, 0x51, 0x33, 0x40, 0x2, 0x81,
+    0x10, 0x1, 0xff, 0xc1, 0xc7, 0x66, 0x9f, 0x6, 0xa2, 0xc0, 0x3f, 0xf0, 0xe1, 0x80, 0x18, 0x0,
+    0x78, 0xe, 0x1, 0xff, 0x87, 0xc, 0xb, 0x67, 0x48, 0xb, 0x4, 0x3, 0xff, 0x2d, 0x44, 0xe9,
+    0x1, 0x6c, 0xc5, 0x28, 0x7, 0xfe, 0x47, 0x73, 0x0, 0x73, 0x3b, 0x90, 0x3, 0xff, 0x82, 0x2d,
+    0x5b, 0xff, 0x6d, 0x30, 0x80, 0x7f, 0xe1, 0x9e, 0x95, 0x20, 0x8, 0x96, 0x7a, 0x84, 0x3, 0xf9,
+    0x79, 0x80, 0x3f, 0xe5, 0xe5, 0x0, 0xf9, 0xe8, 0x3, 0xff, 0x87, 0x4e, 0x1, 0xcb, 0x0, 0x1e,
+    0x25, 0x65, 0x20, 0xf, 0x42, 0x80, 0x43, 0x40, 0x1c, 0x9b, 0xaa, 0x9a, 0xdd, 0x20, 0x7, 0x50,
+    0x80, 0x2c, 0x3, 0x9e, 0xc8, 0x3, 0x8a, 0xdc, 0x3, 0xac, 0x5, 0x40, 0x32, 0xc0, 0x7, 0xf4,
+    0x28, 0x6, 0x51, 0x40, 0xe, 0x80, 0xf, 0xfa, 0x0, 0x39, 0xf0, 0x3, 0x19, 0x0, 0x7f, 0xc4,
+    0x60, 0x1b, 0xc8, 0x3, 0x28, 0x7, 0xff, 0x5, 0x0, 0x31, 0x0, 0x70, 0x80, 0x7f, 0xf0, 0x7c,
+    0x3, 0x38, 0x7, 0x8, 0x7, 0xff, 0x7, 0xc0, 0x33, 0x90, 0x6, 0x50, 0xf, 0xfe, 0xa, 0x0,
+    0x62, 0xc0, 0xc, 0x64, 0x1, 0xff, 0x9, 0x80, 0x6f, 0x40, 0xe, 0x80, 0xf, 0xfa, 0xc0, 0x39,
+    0xc5, 0x40, 0x32, 0xb8, 0x7, 0xf3, 0xa8, 0x6, 0x51, 0xb, 0x0, 0xe8, 0xa2, 0x0, 0xe2, 0xb8,
+    0x0, 0xe8, 0x0, 0xc, 0x80, 0x72, 0xee, 0x4c, 0x4e, 0x6a, 0x0, 0x74, 0x90, 0x4, 0xd0, 0x1,
+    0xe3, 0x67, 0x63, 0x0, 0xf4, 0x30, 0x7, 0x3c, 0x80, 0x7f, 0xf0, 0xe5, 0xc0, 0x3e, 0x6d, 0x50,
+    0xf, 0xf9, 0x79, 0x80, 0x3f, 0x8a, 0xba, 0x54, 0x80, 0x22, 0x59, 0xea, 0x10, 0xe,
+
+    /* U+1ED5 "ổ" */
+    0x0, 0xff, 0xd5, 0xdf, 0xaa, 0x1, 0xff, 0xc2, 0x71, 0x2, 0xa2, 0x0, 0xff, 0xe0, 0xe7, 0xf0,
+    0x1, 0xc0, 0x3f, 0xf8, 0x22, 0x4, 0x0, 0x60, 0xf, 0x8b, 0x33, 0x58, 0x87, 0x83, 0x98, 0x7,
+    0x93, 0x4c, 0xf2, 0x79, 0x65, 0xc0, 0x7, 0x96, 0xc0, 0x9, 0x66, 0x3, 0xa8, 0x80, 0xf, 0x3d,
+    0x0, 0x26, 0xd3, 0x1c, 0x1, 0x6a, 0x1, 0xe7, 0xff, 0x98, 0x2, 0x8f, 0xf9, 0x40, 0x3f, 0xf9,
+    0xe9, 0x3b, 0xff, 0x6c, 0x98, 0x7, 0xe2, 0xcb, 0x62, 0x0, 0x89, 0xb2, 0xc8, 0x3, 0x93, 0x4c,
+    0x3, 0xf9, 0x35, 0x0, 0x22, 0xb0, 0xf, 0xfe, 0xd, 0x90, 0x3, 0xc0, 0x39, 0x2b, 0x29, 0x0,
+    0x3b, 0x81, 0x48, 0x3, 0x4d, 0xa9, 0xad, 0xc8, 0x6, 0x34, 0xf0, 0xc, 0xac, 0x1, 0xcc, 0xa0,
+    0x1b, 0x9c, 0x3, 0x70, 0x7, 0xdc, 0x1, 0x9c, 0x80, 0x32, 0x80, 0x7c, 0xc0, 0x18, 0xc0, 0x3f,
+    0xf8, 0xe4, 0x1, 0x94, 0x3, 0xe7, 0x0, 0xc6, 0xe0, 0x1b, 0x80, 0x3e, 0xe0, 0xc, 0x9c, 0x1,
+    0x95, 0x80, 0x39, 0x90, 0x3, 0x6a, 0x18, 0x6, 0x9b, 0x53, 0x5b, 0x90, 0xc, 0x68, 0x1c, 0x1,
+    0xc9, 0x59, 0x48, 0x1, 0xdc, 0x0, 0x2b, 0x0, 0xff, 0xc3, 0x84, 0x1, 0x26, 0xa0, 0x7, 0xf2,
+    0x61, 0x80, 0x71, 0x5e, 0x31, 0x0, 0x44, 0xd9, 0x64, 0x1,
+
+    /* U+1ED6 "Ỗ" */
+    0x0, 0xfc, 0x4e, 0xe5, 0x0, 0xd1, 0x4, 0x0, 0xff, 0xe0, 0xbe, 0xc4, 0x2b, 0x54, 0x19, 0xdc,
+    0x40, 0x1f, 0xf8, 0xa0, 0x3, 0x15, 0x7c, 0x80, 0x1c, 0x3, 0xff, 0x20, 0x2, 0x3e, 0x88, 0x3,
+    0x48, 0x80, 0x7f, 0xe2, 0x77, 0x81, 0x76, 0xe2, 0x18, 0xc0, 0x1f, 0xfc, 0x14, 0x88, 0x0, 0x64,
+    0x77, 0x18, 0x7, 0xff, 0x14, 0xff, 0xf8, 0xc0, 0x3f, 0xf8, 0xa7, 0x80, 0x1d, 0x86, 0x1, 0xff,
+    0xc3, 0x3c, 0x0, 0x15, 0x10, 0x3, 0xc, 0x3, 0xff, 0x82, 0x7a, 0x0, 0x4c, 0x5c, 0x40, 0x6,
+    0x18, 0x7, 0xff, 0x6, 0xea, 0xec, 0x20, 0x37, 0x6a, 0xa0, 0x7, 0xff, 0x4, 0xd5, 0x48, 0x1,
+    0xc8, 0xaa, 0x30, 0xf, 0xfe, 0x8, 0xb5, 0x6f, 0xfd, 0xb4, 0xc2, 0x1, 0xff, 0x86, 0x7a, 0x54,
+    0x80, 0x22, 0x59, 0xea, 0x10, 0xf, 0xe5, 0xe6, 0x0, 0xff, 0x97, 0x94, 0x3, 0xe7, 0xa0, 0xf,
+    0xfe, 0x1d, 0x38, 0x7, 0x2c, 0x0, 0x78, 0x95, 0x94, 0x80, 0x3d, 0xa, 0x1, 0xd, 0x0, 0x72,
+    0x6e, 0xaa, 0x6b, 0x74, 0x80, 0x1d, 0x42, 0x0, 0xb0, 0xe, 0x7b, 0x20, 0xe, 0x2b, 0x70, 0xe,
+    0xb0, 0x15, 0x0, 0xcb, 0x0, 0x1f, 0xd0, 0xa0, 0x19, 0x45, 0x0, 0x3a, 0x0, 0x3f, 0xe8, 0x0,
+    0xe7, 0xc0, 0xc, 0x64, 0x1, 0xff, 0x11, 0x80, 0x6f, 0x20, 0xc, 0xa0, 0x1f, 0xfc, 0x14, 0x0,
+    0xc4, 0x1, 0xc2, 0x1, 0xff, 0xc1, 0xf0, 0xc, 0xe0, 0x1c, 0x20, 0x1f, 0xfc, 0x1f, 0x0, 0xce,
+    0x40, 0x19, 0x40, 0x3f, 0xf8, 0x28, 0x1, 0x8b, 0x0, 0x31, 0x90, 0x7, 0xfc, 0x26, 0x1, 0xbd,
+    0x0, 0x3a, 0x0, 0x3f, 0xeb, 0x0, 0xe7, 0x15, 0x0, 0xca, 0xe0, 0x1f, 0xce, 0xa0, 0x19, 0x44,
+    0x2c, 0x3, 0xa2, 0x88, 0x3, 0x8a, 0xe0, 0x3, 0xa0, 0x0, 0x32, 0x1, 0xcb, 0xb9, 0x31, 0x39,
+    0xa8, 0x1, 0xd2, 0x40, 0x13, 0x40, 0x7, 0x8d, 0x9d, 0x8c, 0x3, 0xd0, 0xc0, 0x1c, 0xf2, 0x1,
+    0xff, 0xc3, 0x97, 0x0, 0xf9, 0xb5, 0x40, 0x3f, 0xe5, 0xe6, 0x0, 0xfe, 0x2a, 0xe9, 0x52, 0x0,
+    0x89, 0x67, 0xa8, 0x40, 0x38,
+
+    /* U+1ED7 "ỗ" */
+    0x0, 0xe3, 0x77, 0x20, 0x6, 0x88, 0x18, 0x7, 0xcf, 0x91, 0xb, 0xd4, 0x7, 0x79, 0x80, 0x3c,
+    0x50, 0x1, 0x8a, 0xfe, 0x0, 0x8, 0x1, 0xe5, 0x0, 0x4f, 0xd0, 0x80, 0x69, 0x10, 0xf, 0x1b,
+    0xc3, 0x2, 0xf5, 0xc4, 0x35, 0x80, 0x3e, 0x48, 0x70, 0xc, 0x8e, 0xe2, 0x0, 0xff, 0x93, 0xbf,
+    0xee, 0x30, 0xf, 0xf9, 0x6c, 0x40, 0x21, 0xc3, 0x0, 0xfe, 0x6a, 0x0, 0x25, 0x98, 0x3, 0x10,
+    0x3, 0xe7, 0x90, 0x4, 0xda, 0x63, 0x80, 0x2d, 0x40, 0x3c, 0xff, 0xf3, 0x0, 0x51, 0xff, 0x28,
+    0x7, 0xff, 0x3d, 0x27, 0x7f, 0xed, 0x93, 0x0, 0xfc, 0x59, 0x6c, 0x40, 0x11, 0x36, 0x59, 0x0,
+    0x72, 0x69, 0x80, 0x7f, 0x26, 0xa0, 0x4, 0x56, 0x1, 0xff, 0xc1, 0xb2, 0x0, 0x78, 0x7, 0x25,
+    0x65, 0x20, 0x7, 0x70, 0x29, 0x0, 0x69, 0xb5, 0x35, 0xb9, 0x0, 0xc6, 0x9e, 0x1, 0x95, 0x80,
+    0x39, 0x94, 0x3, 0x73, 0x80, 0x6e, 0x0, 0xfb, 0x80, 0x33, 0x90, 0x6, 0x50, 0xf, 0x98, 0x3,
+    0x18, 0x7, 0xff, 0x1c, 0x80, 0x32, 0x80, 0x7c, 0xe0, 0x18, 0xdc, 0x3, 0x70, 0x7, 0xdc, 0x1,
+    0x93, 0x80, 0x32, 0xb0, 0x7, 0x32, 0x0, 0x6d, 0x43, 0x0, 0xd3, 0x6a, 0x6b, 0x72, 0x1, 0x8d,
+    0x3, 0x80, 0x39, 0x2b, 0x29, 0x0, 0x3b, 0x80, 0x5, 0x60, 0x1f, 0xf8, 0x70, 0x80, 0x24, 0xd4,
+    0x0, 0xfe, 0x4c, 0x30, 0xe, 0x2b, 0xc6, 0x20, 0x8, 0x9b, 0x2c, 0x80, 0x20,
+
+    /* U+1ED8 "Ộ" */
+    0x0, 0xfe, 0x3f, 0xfe, 0x30, 0xf, 0xfe, 0x29, 0x68, 0x7, 0x61, 0x80, 0x7f, 0xf0, 0xcb, 0x4,
+    0xb, 0x8, 0x1, 0xa4, 0x1, 0xff, 0xc1, 0x1c, 0x10, 0x3c, 0x3c, 0x30, 0x1c, 0x10, 0xf, 0xfc,
+    0x8c, 0xf1, 0x82, 0x3, 0x90, 0xec, 0x80, 0x1f, 0xf9, 0x62, 0xe, 0x1, 0xcf, 0x10, 0x50, 0xf,
+    0xfe, 0xd0, 0xb5, 0x6f, 0xfd, 0xb4, 0xc2, 0x1, 0xff, 0x86, 0x7a, 0x54, 0x80, 0x22, 0x59, 0xea,
+    0x10, 0xf, 0xe5, 0xe6, 0x0, 0xff, 0x97, 0x94, 0x3, 0xe7, 0xa0, 0xf, 0xfe, 0x1d, 0x38, 0x7,
+    0x2c, 0x0, 0x78, 0x95, 0x94, 0x80, 0x3d, 0xa, 0x1, 0xd, 0x0, 0x72, 0x6e, 0xaa, 0x6b, 0x74,
+    0x80, 0x1d, 0x42, 0x0, 0xb0, 0xe, 0x7b, 0x20, 0xe, 0x2b, 0x70, 0xe, 0xb0, 0x15, 0x0, 0xcb,
+    0x0, 0x1f, 0xd0, 0xa0, 0x19, 0x45, 0x0, 0x3a, 0x0, 0x3f, 0xe8, 0x0, 0xe7, 0xc0, 0xc, 0x64,
+    0x1, 0xff, 0x11, 0x80, 0x6f, 0x20, 0xc, 0xa0, 0x1f, 0xfc, 0x14, 0x0, 0xc4, 0x1, 0xc2, 0x1,
+    0xff, 0xc1, 0xf0, 0xc, 0xe0, 0x1c, 0x20, 0x1f, 0xfc, 0x1f, 0x0, 0xce, 0x40, 0x19, 0x40, 0x3f,
+    0xf8, 0x28, 0x1, 0x8b, 0x0, 0x31, 0x90, 0x7, 0xfc, 0x26, 0x1, 0xbd, 0x0, 0x3a, 0x0, 0x3f,
+    0xeb, 0x0, 0xe7, 0x15, 0x0, 0xca, 0xe0, 0x1f, 0xce, 0xa0, 0x19, 0x44, 0x2c, 0x3, 0xa2, 0x88,
+    0x3, 0x8a, 0xe0, 0x3, 0xa0, 0x0, 0x32, 0x1, 0xcb, 0xb9, 0x31, 0x39, 0xa8, 0x1, 0xd2, 0x40,
+    0x13, 0x40, 0x7, 0x8d, 0x9d, 0x8c, 0x3, 0xd0, 0xc0, 0x1c, 0xf2, 0x1, 0xff, 0xc3, 0x97, 0x0,
+    0xf9, 0xb5, 0x40, 0x3f, 0xe5, 0xe6, 0x0, 0xfe, 0x2a, 0xe9, 0x52, 0x0, 0x89, 0x67, 0xa8, 0x40,
+    0x3f, 0xf0, 0xb5, 0x6f, 0xfd, 0xb4, 0xc2, 0x1, 0xff, 0xc6, 0x68, 0x60, 0xf, 0xfe, 0x4d, 0x4b,
+    0xcc, 0x80, 0x3f, 0xf8, 0xe2, 0xa0, 0x13, 0x8, 0x7, 0xff, 0x18, 0xc0, 0x38, 0xc0, 0x3f, 0xf8,
+    0xc4, 0x20, 0x11, 0x10, 0x3, 0xff, 0x8f, 0x86, 0x7, 0xe0, 0x1f, 0xe0,
+
+    /* U+1ED9 "ộ" */
+    0x0, 0xf2, 0x7f, 0xee, 0x20, 0xf, 0xf8, 0xec, 0x3, 0xe, 0x10, 0x7, 0xf1, 0xe0, 0x0, 0x60,
+    0x0, 0x3e, 0x20, 0x1f, 0x16, 0x80, 0xf, 0xdf, 0x48, 0xb, 0x4, 0x3, 0xc8, 0xcf, 0x18, 0x20,
+    0x59, 0xe, 0xa8, 0x1, 0xe6, 0x88, 0x38, 0x6, 0x17, 0x88, 0x28, 0x7, 0xff, 0x3d, 0x27, 0x7f,
+    0xed, 0x93, 0x0, 0xfc, 0x59, 0x6c, 0x40, 0x11, 0x36, 0x59, 0x0, 0x72, 0x69, 0x80, 0x7f, 0x26,
+    0xa0, 0x4, 0x56, 0x1, 0xff, 0xc1, 0xb2, 0x0, 0x78, 0x7, 0x25, 0x65, 0x20, 0x7, 0x70, 0x29,
+    0x0, 0x69, 0xb5, 0x35, 0xb9, 0x0, 0xc6, 0x9e, 0x1, 0x95, 0x80, 0x39, 0x94, 0x3, 0x73, 0x80,
+    0x6e, 0x0, 0xfb, 0x80, 0x33, 0x90, 0x6, 0x50, 0xf, 0x98, 0x3, 0x18, 0x7, 0xff, 0x1c, 0x80,
+    0x32, 0x80, 0x7c, 0xe0, 0x18, 0xdc, 0x3, 0x70, 0x7, 0xdc, 0x1, 0x93, 0x80, 0x32, 0xb0, 0x7,
+    0x32, 0x0, 0x6d, 0x43, 0x0, 0xd3, 0x6a, 0x6b, 0x72, 0x1, 0x8d, 0x3, 0x80, 0x39, 0x2b, 0x29,
+    0x0, 0x3b, 0x80, 0x5, 0x60, 0x1f, 0xf8, 0x70, 0x80, 0x24, 0xd4, 0x0, 0xfe, 0x4c, 0x30, 0xe,
+    0x2b, 0xc6, 0x20, 0x8, 0x9b, 0x2c, 0x80, 0x3f, 0x1c, 0xef, 0xfd, 0xb2, 0x60, 0x1f, 0xfc, 0x16,
+    0x85, 0x0, 0xff, 0xe1, 0xdc, 0xbd, 0x40, 0x7, 0xff, 0x4, 0x90, 0x2, 0x70, 0xf, 0xfe, 0x8,
+    0x80, 0x70, 0x80, 0x7f, 0xe3, 0x10, 0x8, 0x84, 0x3, 0xff, 0x83, 0xa4, 0x7, 0xe0, 0x1f,
+
+    /* U+1EDA "Ớ" */
+    0x0, 0xff, 0xe0, 0xcf, 0xfe, 0x90, 0xf, 0xfe, 0x34, 0x30, 0x5, 0x32, 0x0, 0x91, 0x80, 0x3f,
+    0xf3, 0xb8, 0x0, 0x58, 0xc0, 0x3, 0xeb, 0x91, 0x0, 0xff, 0x3c, 0x0, 0x13, 0xc, 0x2, 0x31,
+    0x0, 0x38, 0x7, 0xf0, 0x83, 0xba, 0x6c, 0x40, 0x38, 0x80, 0x1c, 0x1, 0xfc, 0x2f, 0x10, 0x60,
+    0xf, 0x8c, 0x1, 0xe0, 0x1f, 0xfc, 0x72, 0xa1, 0x0, 0x18, 0x7, 0xc2, 0xd5, 0xbf, 0xff, 0xb5,
+    0x40, 0x4, 0x80, 0x1c, 0x33, 0xd2, 0xa4, 0x1, 0xff, 0xf, 0x0, 0x72, 0xf3, 0x0, 0x7f, 0xf0,
+    0x9b, 0xcc, 0x3, 0x3d, 0x0, 0x7f, 0xf1, 0x8, 0x40, 0x33, 0x40, 0x7, 0x89, 0x59, 0x48, 0x3,
+    0xc9, 0x20, 0x11, 0x48, 0x7, 0x26, 0xea, 0xa6, 0xb7, 0x48, 0x1, 0xcc, 0x60, 0x8, 0x0, 0xe7,
+    0xb2, 0x0, 0xe2, 0xb7, 0x0, 0xe8, 0x1, 0x50, 0xc, 0xb0, 0x1, 0xfd, 0xa, 0x1, 0x90, 0x9c,
+    0x3, 0xa0, 0x3, 0xfe, 0x80, 0xe, 0x4f, 0x0, 0xc6, 0x40, 0x1f, 0xf1, 0x18, 0x6, 0xc2, 0x0,
+    0xca, 0x1, 0xff, 0xc1, 0x40, 0xc, 0x20, 0x1c, 0x20, 0x1f, 0xfc, 0x1f, 0x0, 0xce, 0x1, 0xc2,
+    0x1, 0xff, 0xc1, 0xf0, 0xc, 0xe4, 0x1, 0x94, 0x3, 0xff, 0x82, 0x80, 0x18, 0xf0, 0x3, 0x19,
+    0x0, 0x7f, 0xc4, 0x60, 0x1b, 0x50, 0x3, 0xa0, 0x3, 0xfe, 0x80, 0xe, 0x51, 0x50, 0xc, 0xae,
+    0x1, 0xfd, 0xa, 0x1, 0x98, 0x1, 0x60, 0x1d, 0x14, 0x40, 0x1c, 0x56, 0xe0, 0x18, 0x60, 0x0,
+    0x32, 0x1, 0xcb, 0xb9, 0x31, 0x3b, 0xa4, 0x0, 0xeb, 0x10, 0x9, 0xa0, 0x3, 0xc6, 0xce, 0xc4,
+    0x1, 0xe9, 0x50, 0xe, 0x79, 0x0, 0xff, 0xe1, 0xd3, 0x0, 0x7c, 0xda, 0xa0, 0x1f, 0xf3, 0x72,
+    0x80, 0x7f, 0x15, 0x74, 0xa9, 0x0, 0x44, 0xb3, 0xd2, 0x20, 0x1c,
+
+    /* U+1EDB "ớ" */
+    0x0, 0xff, 0x4f, 0xfe, 0x90, 0xf, 0xfd, 0xc, 0x1, 0x4c, 0x80, 0x80, 0x3f, 0xa1, 0xc0, 0x5,
+    0x8f, 0x1b, 0xa1, 0x0, 0xf9, 0xdc, 0x0, 0x4c, 0x31, 0x62, 0x6, 0x0, 0xf0, 0xfb, 0xba, 0x6c,
+    0x40, 0x8, 0x0, 0xd0, 0xf, 0xc, 0x44, 0xc0, 0x18, 0x40, 0x2, 0x1, 0xff, 0xc2, 0x54, 0x0,
+    0x18, 0x7, 0x1c, 0xef, 0xff, 0xa8, 0x2, 0xa0, 0x8, 0xb3, 0xc, 0x40, 0x1f, 0xd4, 0x40, 0x4,
+    0xd3, 0x0, 0xff, 0x99, 0x40, 0x5, 0x60, 0x1f, 0xfc, 0x16, 0x40, 0x7, 0x80, 0x72, 0x56, 0x52,
+    0x0, 0x75, 0x2, 0x90, 0x6, 0x9b, 0x53, 0x5b, 0x90, 0xc, 0x2b, 0xe0, 0x19, 0x58, 0x3, 0x99,
+    0x40, 0x37, 0xb8, 0x6, 0xe0, 0xf, 0xb8, 0x3, 0x39, 0x0, 0x65, 0x0, 0xf9, 0x80, 0x31, 0x80,
+    0x7f, 0xf1, 0xc8, 0x3, 0x28, 0x7, 0xce, 0x1, 0x89, 0xc0, 0x37, 0x0, 0x7d, 0xc0, 0x19, 0x78,
+    0x3, 0x2b, 0x0, 0x73, 0x20, 0x6, 0xa4, 0x30, 0xd, 0x36, 0xa6, 0xb7, 0x20, 0x19, 0xc, 0x38,
+    0x3, 0x92, 0xb2, 0x90, 0x3, 0xc, 0x80, 0xa, 0xc0, 0x3f, 0xf0, 0xe9, 0x0, 0x49, 0xa8, 0x1,
+    0xfc, 0x9e, 0x60, 0x1c, 0x57, 0x8c, 0x40, 0x11, 0x36, 0x58, 0x80, 0x40,
+
+    /* U+1EDC "Ờ" */
+    0x0, 0xf4, 0xff, 0xe9, 0x0, 0xff, 0xe3, 0xcc, 0x80, 0x26, 0x80, 0xf, 0xe4, 0x60, 0xf, 0xcd,
+    0x84, 0x0, 0x78, 0x0, 0xf1, 0xf5, 0xc8, 0x80, 0x7e, 0x3c, 0x40, 0x3, 0xb8, 0x3, 0x8c, 0x40,
+    0xe, 0x1, 0xfc, 0x37, 0x2e, 0xef, 0x10, 0xe, 0x20, 0x7, 0x0, 0x7f, 0xcd, 0x11, 0x8, 0x7,
+    0x18, 0x3, 0xc0, 0x3f, 0xf8, 0xe5, 0x42, 0x0, 0x30, 0xf, 0x85, 0xab, 0x7f, 0xff, 0x6a, 0x80,
+    0x9, 0x0, 0x38, 0x67, 0xa5, 0x48, 0x3, 0xfe, 0x1e, 0x0, 0xe5, 0xe6, 0x0, 0xff, 0xe1, 0x37,
+    0x98, 0x6, 0x7a, 0x0, 0xff, 0xe2, 0x10, 0x80, 0x66, 0x80, 0xf, 0x12, 0xb2, 0x90, 0x7, 0x92,
+    0x40, 0x22, 0x90, 0xe, 0x4d, 0xd5, 0x4d, 0x6e, 0x90, 0x3, 0x98, 0xc0, 0x10, 0x1, 0xcf, 0x64,
+    0x1, 0xc5, 0x6e, 0x1, 0xd0, 0x2, 0xa0, 0x19, 0x60, 0x3, 0xfa, 0x14, 0x3, 0x21, 0x38, 0x7,
+    0x40, 0x7, 0xfd, 0x0, 0x1c, 0x9e, 0x1, 0x8c, 0x80, 0x3f, 0xe2, 0x30, 0xd, 0x84, 0x1, 0x94,
+    0x3, 0xff, 0x82, 0x80, 0x18, 0x40, 0x38, 0x40, 0x3f, 0xf8, 0x3e, 0x1, 0x9c, 0x3, 0x84, 0x3,
+    0xff, 0x83, 0xe0, 0x19, 0xc8, 0x3, 0x28, 0x7, 0xff, 0x5, 0x0, 0x31, 0xe0, 0x6, 0x32, 0x0,
+    0xff, 0x88, 0xc0, 0x36, 0xa0, 0x7, 0x40, 0x7, 0xfd, 0x0, 0x1c, 0xa2, 0xa0, 0x19, 0x5c, 0x3,
+    0xfa, 0x14, 0x3, 0x30, 0x2, 0xc0, 0x3a, 0x28, 0x80, 0x38, 0xad, 0xc0, 0x30, 0xc0, 0x0, 0x64,
+    0x3, 0x97, 0x72, 0x62, 0x77, 0x48, 0x1, 0xd6, 0x20, 0x13, 0x40, 0x7, 0x8d, 0x9d, 0x88, 0x3,
+    0xd2, 0xa0, 0x1c, 0xf2, 0x1, 0xff, 0xc3, 0xa6, 0x0, 0xf9, 0xb5, 0x40, 0x3f, 0xe6, 0xe5, 0x0,
+    0xfe, 0x2a, 0xe9, 0x52, 0x0, 0x89, 0x67, 0xa4, 0x40, 0x38,
+
+    /* U+1EDD "ờ" */
+    0x0, 0xa7, 0xff, 0x48, 0x7, 0xff, 0x6, 0x64, 0x1, 0x34, 0x0, 0x7c, 0x40, 0x1c, 0xd8, 0x40,
+    0x7, 0x70, 0x4, 0x31, 0xba, 0x10, 0xe, 0x3c, 0x40, 0x4, 0x38, 0x0, 0x58, 0x81, 0x80, 0x3c,
+    0x37, 0x2e, 0xe0, 0x10, 0x2, 0x0, 0x34, 0x3, 0xf3, 0x44, 0x1c, 0x40, 0x2, 0x0, 0x10, 0xf,
+    0xfe, 0x12, 0xa0, 0x0, 0xc0, 0x38, 0xe7, 0x7f, 0xfd, 0x40, 0x15, 0x0, 0x45, 0x98, 0x62, 0x0,
+    0xfe, 0xa2, 0x0, 0x26, 0x98, 0x7, 0xfc, 0xca, 0x0, 0x2b, 0x0, 0xff, 0xe0, 0xb2, 0x0, 0x3c,
+    0x3, 0x92, 0xb2, 0x90, 0x3, 0xa8, 0x14, 0x80, 0x34, 0xda, 0x9a, 0xdc, 0x80, 0x61, 0x5f, 0x0,
+    0xca, 0xc0, 0x1c, 0xca, 0x1, 0xbd, 0xc0, 0x37, 0x0, 0x7d, 0xc0, 0x19, 0xc8, 0x3, 0x28, 0x7,
+    0xcc, 0x1, 0x8c, 0x3, 0xff, 0x8e, 0x40, 0x19, 0x40, 0x3e, 0x70, 0xc, 0x4e, 0x1, 0xb8, 0x3,
+    0xee, 0x0, 0xcb, 0xc0, 0x19, 0x58, 0x3, 0x99, 0x0, 0x35, 0x21, 0x80, 0x69, 0xb5, 0x35, 0xb9,
+    0x0, 0xc8, 0x61, 0xc0, 0x1c, 0x95, 0x94, 0x80, 0x18, 0x64, 0x0, 0x56, 0x1, 0xff, 0x87, 0x48,
+    0x2, 0x4d, 0x40, 0xf, 0xe4, 0xf3, 0x0, 0xe2, 0xbc, 0x62, 0x0, 0x89, 0xb2, 0xc4, 0x2,
+
+    /* U+1EDE "Ở" */
+    0x0, 0xfe, 0x8d, 0xff, 0x50, 0x80, 0x7f, 0xf1, 0xa1, 0xc8, 0x0, 0xb8, 0x1, 0xff, 0xc6, 0x90,
+    0x34, 0x0, 0x13, 0x80, 0x7f, 0xf1, 0x47, 0x72, 0xe0, 0x1, 0xa0, 0x1e, 0x14, 0x0, 0xff, 0x10,
+    0x0, 0x80, 0x3e, 0x2a, 0xeb, 0x10, 0xf, 0xfd, 0xc0, 0xc, 0x0, 0xc6, 0xa0, 0x4, 0x0, 0xff,
+    0xa5, 0x0, 0x98, 0x3, 0x9, 0x0, 0x34, 0x3, 0xfe, 0x81, 0x4c, 0x0, 0xf1, 0x80, 0x3c, 0x3,
+    0xfe, 0x1f, 0xb1, 0x0, 0xc3, 0x22, 0x0, 0x20, 0xf, 0x85, 0xab, 0x7f, 0xbf, 0xfd, 0xcc, 0x0,
+    0x15, 0x0, 0xe1, 0x9e, 0x95, 0x20, 0xf, 0xf8, 0x74, 0x3, 0x97, 0x98, 0x3, 0xff, 0x84, 0xde,
+    0x60, 0x19, 0xe8, 0x3, 0xff, 0x88, 0x42, 0x1, 0x9a, 0x0, 0x3c, 0x4a, 0xca, 0x40, 0x1e, 0x49,
+    0x0, 0x8a, 0x40, 0x39, 0x37, 0x55, 0x35, 0xba, 0x40, 0xe, 0x63, 0x0, 0x40, 0x7, 0x3d, 0x90,
+    0x7, 0x15, 0xb8, 0x7, 0x40, 0xa, 0x80, 0x65, 0x80, 0xf, 0xe8, 0x50, 0xc, 0x84, 0xe0, 0x1d,
+    0x0, 0x1f, 0xf4, 0x0, 0x72, 0x78, 0x6, 0x32, 0x0, 0xff, 0x88, 0xc0, 0x36, 0x10, 0x6, 0x50,
+    0xf, 0xfe, 0xa, 0x0, 0x61, 0x0, 0xe1, 0x0, 0xff, 0xe0, 0xf8, 0x6, 0x70, 0xe, 0x10, 0xf,
+    0xfe, 0xf, 0x80, 0x67, 0x20, 0xc, 0xa0, 0x1f, 0xfc, 0x14, 0x0, 0xc7, 0x80, 0x18, 0xc8, 0x3,
+    0xfe, 0x23, 0x0, 0xda, 0x80, 0x1d, 0x0, 0x1f, 0xf4, 0x0, 0x72, 0x8a, 0x80, 0x65, 0x70, 0xf,
+    0xe8, 0x50, 0xc, 0xc0, 0xb, 0x0, 0xe8, 0xa2, 0x0, 0xe2, 0xb7, 0x0, 0xc3, 0x0, 0x1, 0x90,
+    0xe, 0x5d, 0xc9, 0x89, 0xdd, 0x20, 0x7, 0x58, 0x80, 0x4d, 0x0, 0x1e, 0x36, 0x76, 0x20, 0xf,
+    0x4a, 0x80, 0x73, 0xc8, 0x7, 0xff, 0xe, 0x98, 0x3, 0xe6, 0xd5, 0x0, 0xff, 0x9b, 0x94, 0x3,
+    0xf8, 0xab, 0xa5, 0x48, 0x2, 0x25, 0x9e, 0x91, 0x0, 0xe0,
+
+    /* U+1EDF "ở" */
+    0x0, 0xf9, 0xa6, 0x4c, 0x1, 0xff, 0xc1, 0x2e, 0x96, 0x64, 0xe8, 0x80, 0x7f, 0xc4, 0x60, 0x18,
+    0xac, 0x3, 0xff, 0x4e, 0x7d, 0x0, 0x14, 0x3, 0xff, 0x21, 0x82, 0x80, 0x7c, 0x60, 0x1f, 0xe3,
+    0x0, 0x10, 0x2, 0x3b, 0x8, 0x3, 0xf1, 0xe8, 0x2, 0x0, 0xc, 0x21, 0x40, 0x1f, 0x8c, 0x82,
+    0x14, 0x0, 0x80, 0x3, 0x0, 0xfe, 0xdd, 0x38, 0x4, 0x20, 0x1, 0x0, 0xfe, 0x12, 0x0, 0x95,
+    0x0, 0x1a, 0x1, 0xc7, 0x3b, 0xff, 0xea, 0x0, 0x98, 0x2, 0x2c, 0xc3, 0x10, 0x7, 0xf5, 0x8,
+    0x1, 0x34, 0xc0, 0x3f, 0xe6, 0x50, 0x1, 0x58, 0x7, 0xff, 0x5, 0x90, 0x1, 0xe0, 0x1c, 0x95,
+    0x94, 0x80, 0x1d, 0x40, 0xa4, 0x1, 0xa6, 0xd4, 0xd6, 0xe4, 0x3, 0xa, 0xf8, 0x6, 0x56, 0x0,
+    0xe6, 0x50, 0xd, 0xee, 0x1, 0xb8, 0x3, 0xee, 0x0, 0xce, 0x40, 0x19, 0x40, 0x3e, 0x60, 0xc,
+    0x60, 0x1f, 0xfc, 0x72, 0x0, 0xca, 0x1, 0xf3, 0x80, 0x62, 0x70, 0xd, 0xc0, 0x1f, 0x70, 0x6,
+    0x5e, 0x0, 0xca, 0xc0, 0x1c, 0xc8, 0x1, 0xa9, 0xc, 0x3, 0x4d, 0xa9, 0xad, 0xc8, 0x6, 0x43,
+    0xe, 0x0, 0xe4, 0xac, 0xa4, 0x0, 0xc3, 0x20, 0x2, 0xb0, 0xf, 0xfc, 0x3a, 0x40, 0x12, 0x6a,
+    0x0, 0x7f, 0x27, 0x98, 0x7, 0x15, 0xe3, 0x10, 0x4, 0x4d, 0x96, 0x20, 0x10,
+
+    /* U+1EE0 "Ỡ" */
+    0x0, 0xff, 0xea, 0x15, 0xff, 0xb0, 0xc0, 0x2a, 0xca, 0x0, 0xff, 0xe0, 0xe2, 0x0, 0xf, 0x20,
+    0x51, 0x4d, 0x80, 0x21, 0x40, 0xf, 0x9c, 0x40, 0x39, 0xfa, 0xc0, 0x16, 0x5, 0x5d, 0x62, 0x1,
+    0xeb, 0x0, 0x57, 0xc0, 0x7, 0xb, 0x81, 0xa8, 0x1, 0x0, 0x3c, 0x40, 0x4a, 0xf, 0xaa, 0x0,
+    0x4c, 0x0, 0x9, 0x0, 0x34, 0x3, 0xdd, 0xfa, 0x1, 0x15, 0x7f, 0xac, 0x80, 0x23, 0x0, 0x78,
+    0x7, 0xff, 0x1c, 0x68, 0x40, 0x4, 0x1, 0xf0, 0xb5, 0x6f, 0xff, 0xee, 0x50, 0x0, 0xa8, 0x7,
+    0xc, 0xf4, 0xa9, 0x0, 0x7f, 0xc3, 0xa0, 0x1c, 0xbc, 0xc0, 0x1f, 0xfc, 0x26, 0xf3, 0x0, 0xcf,
+    0x40, 0x1f, 0xfc, 0x42, 0x10, 0xc, 0xd0, 0x1, 0xe2, 0x56, 0x52, 0x0, 0xf2, 0x48, 0x4, 0x52,
+    0x1, 0xc9, 0xba, 0xa9, 0xad, 0xd2, 0x0, 0x73, 0x18, 0x2, 0x0, 0x39, 0xec, 0x80, 0x38, 0xad,
+    0xc0, 0x3a, 0x0, 0x54, 0x3, 0x2c, 0x0, 0x7f, 0x42, 0x80, 0x64, 0x27, 0x0, 0xe8, 0x0, 0xff,
+    0xa0, 0x3, 0x93, 0xc0, 0x31, 0x90, 0x7, 0xfc, 0x46, 0x1, 0xb0, 0x80, 0x32, 0x80, 0x7f, 0xf0,
+    0x50, 0x3, 0x8, 0x7, 0x8, 0x7, 0xff, 0x7, 0xc0, 0x33, 0x80, 0x70, 0x80, 0x7f, 0xf0, 0x7c,
+    0x3, 0x39, 0x0, 0x65, 0x0, 0xff, 0xe0, 0xa0, 0x6, 0x3c, 0x0, 0xc6, 0x40, 0x1f, 0xf1, 0x18,
+    0x6, 0xd4, 0x0, 0xe8, 0x0, 0xff, 0xa0, 0x3, 0x94, 0x54, 0x3, 0x2b, 0x80, 0x7f, 0x42, 0x80,
+    0x66, 0x0, 0x58, 0x7, 0x45, 0x10, 0x7, 0x15, 0xb8, 0x6, 0x18, 0x0, 0xc, 0x80, 0x72, 0xee,
+    0x4c, 0x4e, 0xe9, 0x0, 0x3a, 0xc4, 0x2, 0x68, 0x0, 0xf1, 0xb3, 0xb1, 0x0, 0x7a, 0x54, 0x3,
+    0x9e, 0x40, 0x3f, 0xf8, 0x74, 0xc0, 0x1f, 0x36, 0xa8, 0x7, 0xfc, 0xdc, 0xa0, 0x1f, 0xc5, 0x5d,
+    0x2a, 0x40, 0x11, 0x2c, 0xf4, 0x88, 0x7,
+
+    /* U+1EE1 "ỡ" */
+    0x0, 0xe6, 0xef, 0x91, 0x0, 0x3d, 0xa8, 0x7, 0xe4, 0x91, 0x6, 0xc2, 0x24, 0x20, 0x7, 0xf7,
+    0x80, 0x62, 0xdd, 0x0, 0x1c, 0xeb, 0x80, 0x39, 0x1, 0xfd, 0xc0, 0x32, 0x9e, 0x28, 0xb8, 0x6,
+    0x11, 0x50, 0x45, 0x98, 0xb5, 0xa, 0x80, 0x34, 0x3, 0x77, 0x8, 0x0, 0x99, 0xd2, 0x0, 0x10,
+    0x0, 0x80, 0x7f, 0xf0, 0x91, 0x0, 0x3, 0x0, 0xe3, 0x9d, 0xff, 0xf5, 0x80, 0x54, 0x1, 0x16,
+    0x61, 0x88, 0x3, 0xfa, 0x48, 0x0, 0x9a, 0x60, 0x1f, 0xf3, 0x30, 0x0, 0x56, 0x1, 0xff, 0xc1,
+    0x64, 0x0, 0x78, 0x7, 0x25, 0x65, 0x20, 0x7, 0x50, 0x29, 0x0, 0x69, 0xb5, 0x35, 0xb9, 0x0,
+    0xc2, 0xbe, 0x1, 0x95, 0x80, 0x39, 0x94, 0x3, 0x7b, 0x80, 0x6e, 0x0, 0xfb, 0x80, 0x33, 0x90,
+    0x6, 0x50, 0xf, 0x98, 0x3, 0x18, 0x7, 0xff, 0x1c, 0x80, 0x32, 0x80, 0x7c, 0xe0, 0x18, 0x9c,
+    0x3, 0x70, 0x7, 0xdc, 0x1, 0x97, 0x80, 0x32, 0xb0, 0x7, 0x32, 0x0, 0x6a, 0x43, 0x0, 0xd3,
+    0x6a, 0x6b, 0x72, 0x1, 0x90, 0xc3, 0x80, 0x39, 0x2b, 0x29, 0x0, 0x30, 0xc8, 0x0, 0xac, 0x3,
+    0xff, 0xe, 0x90, 0x4, 0x9a, 0x80, 0x1f, 0xc9, 0xe6, 0x1, 0xc5, 0x78, 0xc4, 0x1, 0x13, 0x65,
+    0x88, 0x4,
+
+    /* U+1EE2 "Ợ" */
+    0x0, 0xff, 0xe4, 0x8b, 0x48, 0x7, 0xff, 0x24, 0xfa, 0x58, 0xc0, 0x3f, 0xf9, 0x6, 0x20, 0x4,
+    0x0, 0xff, 0xe4, 0x98, 0x3, 0xc0, 0x3f, 0xf8, 0xe3, 0x4, 0x0, 0xe0, 0xf, 0x85, 0xab, 0x7f,
+    0xff, 0x73, 0x80, 0x4e, 0x1, 0xc3, 0x3d, 0x2a, 0x40, 0x1f, 0xfa, 0xc4, 0x3, 0x2f, 0x30, 0x7,
+    0xff, 0x9, 0xb5, 0x0, 0x33, 0xd0, 0x7, 0xff, 0x10, 0x88, 0x1, 0x9a, 0x0, 0x3c, 0x4a, 0xca,
+    0x40, 0x1e, 0x49, 0x0, 0x8a, 0x40, 0x39, 0x37, 0x55, 0x35, 0xba, 0x40, 0xe, 0x63, 0x0, 0x40,
+    0x7, 0x3d, 0x90, 0x7, 0x15, 0xb8, 0x7, 0x40, 0xa, 0x80, 0x65, 0x80, 0xf, 0xe8, 0x50, 0xc,
+    0x84, 0xe0, 0x1d, 0x0, 0x1f, 0xf4, 0x0, 0x72, 0x78, 0x6, 0x32, 0x0, 0xff, 0x88, 0xc0, 0x36,
+    0x10, 0x6, 0x50, 0xf, 0xfe, 0xa, 0x0, 0x61, 0x0, 0xe1, 0x0, 0xff, 0xe0, 0xf8, 0x6, 0x70,
+    0xe, 0x10, 0xf, 0xfe, 0xf, 0x80, 0x67, 0x20, 0xc, 0xa0, 0x1f, 0xfc, 0x14, 0x0, 0xc7, 0x80,
+    0x18, 0xc8, 0x3, 0xfe, 0x23, 0x0, 0xda, 0x80, 0x1d, 0x0, 0x1f, 0xf4, 0x0, 0x72, 0x8a, 0x80,
+    0x65, 0x70, 0xf, 0xe8, 0x50, 0xc, 0xc0, 0xb, 0x0, 0xe8, 0xa2, 0x0, 0xe2, 0xb7, 0x0, 0xc3,
+    0x0, 0x1, 0x90, 0xe, 0x5d, 0xc9, 0x89, 0xdd, 0x20, 0x7, 0x58, 0x80, 0x4d, 0x0, 0x1e, 0x36,
+    0x76, 0x20, 0xf, 0x4a, 0x80, 0x73, 0xc8, 0x7, 0xff, 0xe, 0x98, 0x3, 0xe6, 0xd5, 0x0, 0xff,
+    0x9b, 0x94, 0x3, 0xf8, 0xab, 0xa5, 0x48, 0x2, 0x25, 0x9e, 0x91, 0x0, 0xff, 0xc2, 0xd5, 0xbf,
+    0xf6, 0xd3, 0x8, 0x7, 0xff, 0x19, 0xa1, 0x80, 0x3f, 0xf9, 0x35, 0x2f, 0x32, 0x0, 0xff, 0xe3,
+    0x8a, 0x80, 0x4c, 0x20, 0x1f, 0xfc, 0x63, 0x0, 0xe3, 0x0, 0xff, 0xe3, 0x10, 0x80, 0x44, 0x40,
+    0xf, 0xfe, 0x3e, 0x18, 0x1f, 0x80, 0x7f, 0x80,
+
+    /* U+1EE3 "ợ" */
+    0x0, 0xff, 0xe1, 0x94, 0x60, 0x7, 0xff, 0xc, 0x75, 0xcd, 0x80, 0x3f, 0xf8, 0x42, 0xa0, 0xc,
+    0x0, 0xff, 0xe3, 0x8, 0x7, 0xff, 0x9, 0x14, 0x0, 0x60, 0x1c, 0x73, 0xbf, 0xfe, 0xb0, 0xa,
+    0x80, 0x22, 0xcc, 0x31, 0x0, 0x7f, 0x49, 0x0, 0x13, 0x4c, 0x3, 0xfe, 0x66, 0x0, 0xa, 0xc0,
+    0x3f, 0xf8, 0x2c, 0x80, 0xf, 0x0, 0xe4, 0xac, 0xa4, 0x0, 0xea, 0x5, 0x20, 0xd, 0x36, 0xa6,
+    0xb7, 0x20, 0x18, 0x57, 0xc0, 0x32, 0xb0, 0x7, 0x32, 0x80, 0x6f, 0x70, 0xd, 0xc0, 0x1f, 0x70,
+    0x6, 0x72, 0x0, 0xca, 0x1, 0xf3, 0x0, 0x63, 0x0, 0xff, 0xe3, 0x90, 0x6, 0x50, 0xf, 0x9c,
+    0x3, 0x13, 0x80, 0x6e, 0x0, 0xfb, 0x80, 0x32, 0xf0, 0x6, 0x56, 0x0, 0xe6, 0x40, 0xd, 0x48,
+    0x60, 0x1a, 0x6d, 0x4d, 0x6e, 0x40, 0x32, 0x18, 0x70, 0x7, 0x25, 0x65, 0x20, 0x6, 0x19, 0x0,
+    0x15, 0x80, 0x7f, 0xe1, 0xd2, 0x0, 0x93, 0x50, 0x3, 0xf9, 0x3c, 0xc0, 0x38, 0xaf, 0x18, 0x80,
+    0x22, 0x6c, 0xb1, 0x0, 0xfc, 0x73, 0xbf, 0xf6, 0xc9, 0x80, 0x7f, 0xf0, 0x5a, 0x18, 0x3, 0xff,
+    0x87, 0x52, 0xf3, 0x20, 0xf, 0xfe, 0x8, 0xa8, 0x4, 0xc2, 0x1, 0xff, 0x8c, 0x3, 0x8c, 0x3,
+    0xff, 0x10, 0x80, 0x44, 0x40, 0xf, 0xfe, 0xe, 0x98, 0x1f, 0x80, 0x7c,
+
+    /* U+1EE4 "Ụ" */
+    0x8f, 0xfd, 0x40, 0x1f, 0xcd, 0xff, 0xb0, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xff, 0x0, 0xff, 0xff,
+    0x80, 0x7f, 0xf3, 0x9c, 0x3, 0x84, 0x3, 0xff, 0x87, 0xc0, 0x19, 0x80, 0x3f, 0xb8, 0x3, 0x9,
+    0x0, 0x62, 0x10, 0xf, 0xca, 0x1, 0xb5, 0x0, 0x3a, 0x0, 0x3e, 0x42, 0x0, 0xc8, 0xa, 0x1,
+    0x99, 0xc0, 0x39, 0x2c, 0x3, 0x9, 0x84, 0x80, 0x74, 0x75, 0x44, 0xed, 0x80, 0x74, 0x0, 0xd,
+    0xc0, 0x38, 0x55, 0xd8, 0x80, 0x38, 0xd8, 0x2, 0x86, 0x0, 0xff, 0xe0, 0x9e, 0x80, 0x74, 0xc8,
+    0x40, 0x3f, 0xcf, 0x82, 0x1, 0xe6, 0xea, 0x52, 0x0, 0x85, 0x27, 0xa0, 0x3, 0xfc, 0xb5, 0xbf,
+    0xf7, 0x5b, 0x8, 0x7, 0xff, 0x9, 0x61, 0x80, 0x3f, 0xf8, 0xaf, 0x4f, 0x38, 0x1, 0xff, 0xc4,
+    0x80, 0x8, 0xcc, 0x1, 0xff, 0xc8, 0x70, 0xf, 0xfe, 0x19, 0x80, 0x65, 0x0, 0xff, 0xe1, 0xea,
+    0x1, 0x58, 0x80, 0x7c,
+
+    /* U+1EE5 "ụ" */
+    0xcf, 0xfc, 0x60, 0x1e, 0x5f, 0xfd, 0x40, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8, 0x7, 0x8c, 0x3,
+    0xfc, 0xe0, 0x1e, 0xe0, 0xe, 0x70, 0xd, 0x80, 0x1e, 0x60, 0xe, 0x30, 0xc, 0xe6, 0x1, 0xa4,
+    0x40, 0x3b, 0x0, 0x3b, 0x29, 0xe3, 0x58, 0x3, 0xc8, 0x40, 0x1c, 0xb0, 0xe4, 0x1, 0xfb, 0x80,
+    0x3f, 0xf8, 0xa7, 0x62, 0x1, 0xf1, 0x58, 0x7, 0xc9, 0xf0, 0x62, 0x2, 0x93, 0xaa, 0x1, 0xf8,
+    0x5f, 0x3b, 0xfa, 0xd8, 0x7, 0xff, 0x50, 0x7, 0xc7, 0xe, 0x20, 0x1f, 0xfc, 0x13, 0xc7, 0x8f,
+    0x10, 0xf, 0xfd, 0x0, 0x10, 0xc8, 0x7, 0xfe, 0x70, 0xc, 0x20, 0x1f, 0xfa, 0xc0, 0x36, 0x80,
+    0x7f, 0xe7, 0x60, 0x18, 0x40, 0xf,
+
+    /* U+1EE6 "Ủ" */
+    0x0, 0xf9, 0xf3, 0xfd, 0x64, 0x1, 0xff, 0xc2, 0x58, 0x30, 0x2, 0x69, 0x0, 0x7f, 0xf0, 0x54,
+    0x4d, 0x40, 0x28, 0x0, 0xff, 0xe1, 0x7e, 0x55, 0x80, 0x1c, 0x3, 0xff, 0x84, 0x20, 0x7, 0x0,
+    0x8, 0x7, 0xff, 0x16, 0x0, 0x16, 0x1, 0xff, 0xc4, 0x74, 0x3, 0x70, 0xf, 0xfe, 0x23, 0xab,
+    0x60, 0x7, 0xff, 0x1a, 0xa4, 0x3, 0xfa, 0x3f, 0xf5, 0x0, 0x7f, 0x37, 0xfe, 0xc0, 0xf, 0xff,
+    0xf8, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xce, 0x70, 0xe, 0x10, 0xf, 0xfe, 0x1f,
+    0x0, 0x66, 0x0, 0xfe, 0xe0, 0xc, 0x24, 0x1, 0x88, 0x40, 0x3f, 0x28, 0x6, 0xd4, 0x0, 0xe8,
+    0x0, 0xf9, 0x8, 0x3, 0x20, 0x28, 0x6, 0x67, 0x0, 0xe4, 0xb0, 0xc, 0x26, 0x12, 0x1, 0xd1,
+    0xd5, 0x13, 0xb6, 0x1, 0xd0, 0x0, 0x37, 0x0, 0xe1, 0x57, 0x62, 0x0, 0xe3, 0x60, 0xa, 0x18,
+    0x3, 0xff, 0x82, 0x7a, 0x1, 0xd3, 0x21, 0x0, 0xff, 0x3e, 0x8, 0x7, 0x9b, 0xa9, 0x48, 0x2,
+    0x14, 0x9e, 0x80, 0xc,
+
+    /* U+1EE7 "ủ" */
+    0x0, 0xf1, 0xc5, 0x41, 0x0, 0x7f, 0xea, 0xc7, 0x57, 0xd6, 0x0, 0xff, 0xb4, 0x3, 0xa4, 0x80,
+    0x3f, 0xcf, 0x3d, 0xc2, 0x0, 0x20, 0x7, 0xfc, 0xc2, 0x25, 0x0, 0xff, 0xe2, 0xa8, 0x1, 0x40,
+    0x3f, 0xf8, 0x38, 0x40, 0xa6, 0x1, 0xff, 0xc1, 0x80, 0x6a, 0x0, 0xff, 0xe1, 0x27, 0x48, 0x7,
+    0xff, 0x10, 0x40, 0x3f, 0x67, 0xfe, 0x30, 0xf, 0x2f, 0xfe, 0xa0, 0xf, 0xff, 0xf8, 0x7, 0xff,
+    0xfc, 0x3, 0xc6, 0x1, 0xfe, 0x70, 0xf, 0x70, 0x7, 0x38, 0x6, 0xc0, 0xf, 0x30, 0x7, 0x18,
+    0x6, 0x73, 0x0, 0xd2, 0x20, 0x1d, 0x80, 0x1d, 0x94, 0xf1, 0xac, 0x1, 0xe4, 0x20, 0xe, 0x58,
+    0x72, 0x0, 0xfd, 0xc0, 0x1f, 0xfc, 0x53, 0xb1, 0x0, 0xf8, 0xac, 0x3, 0xe4, 0xf8, 0x31, 0x1,
+    0x49, 0xd5, 0x0, 0xe0,
+
+    /* U+1EE8 "Ứ" */
+    0x0, 0xff, 0x9b, 0xff, 0x58, 0x80, 0x7f, 0xf1, 0x5a, 0x40, 0x28, 0xb1, 0x0, 0xcc, 0x60, 0x1f,
+    0xe5, 0x90, 0x0, 0xdb, 0x80, 0x67, 0xf9, 0xf0, 0xf, 0xe5, 0xa0, 0x1, 0xfa, 0x0, 0x71, 0x80,
+    0xc, 0x40, 0x3f, 0x13, 0xba, 0x30, 0x40, 0x3c, 0xc0, 0x11, 0x80, 0x7e, 0x78, 0x83, 0x80, 0x7e,
+    0x10, 0xf, 0xfe, 0x58, 0xf8, 0x4, 0x51, 0xff, 0xa8, 0x3, 0xf9, 0xbf, 0xee, 0x30, 0x2, 0x0,
+    0x7f, 0xf3, 0x24, 0x3, 0xff, 0x94, 0x58, 0x40, 0x1f, 0xfc, 0x93, 0xd3, 0x0, 0xff, 0xff, 0x80,
+    0x7f, 0xff, 0xc0, 0x3f, 0xff, 0x8e, 0x1, 0xfc, 0x20, 0x1f, 0xfc, 0x7e, 0x0, 0xcc, 0x1, 0xfd,
+    0xc0, 0x18, 0x40, 0x31, 0x0, 0x62, 0x10, 0xf, 0xca, 0x1, 0xb4, 0x3, 0x20, 0x7, 0x40, 0x7,
+    0xc8, 0x40, 0x19, 0x0, 0x39, 0x40, 0x33, 0x38, 0x7, 0x25, 0x80, 0x61, 0x30, 0xe, 0x90, 0xe,
+    0x8e, 0xa8, 0x9d, 0xb0, 0xe, 0x80, 0xf, 0x1b, 0x80, 0x70, 0xab, 0xb1, 0x0, 0x71, 0xb0, 0x7,
+    0xd0, 0xc0, 0x1f, 0xfc, 0x13, 0xd0, 0xf, 0xe9, 0x90, 0x80, 0x7f, 0x9f, 0x4, 0x3, 0xfc, 0xdd,
+    0x4a, 0x40, 0x10, 0xa4, 0xf4, 0x0, 0x7e,
+
+    /* U+1EE9 "ứ" */
+    0x0, 0xfe, 0x7f, 0xfd, 0x40, 0x1f, 0xfc, 0x27, 0x80, 0xa, 0x28, 0x3, 0x8, 0x7, 0xe6, 0x80,
+    0x0, 0xe3, 0x80, 0x6, 0x37, 0xc0, 0x3e, 0x59, 0x0, 0x1f, 0x98, 0x6, 0x72, 0x15, 0x0, 0xf1,
+    0x3b, 0xa7, 0x4, 0x3, 0x9, 0x80, 0x34, 0x3, 0xcf, 0x10, 0x60, 0xf, 0x84, 0x3, 0xff, 0x8e,
+    0xe4, 0x0, 0xec, 0xff, 0xc6, 0x1, 0xe5, 0xff, 0xa0, 0x2, 0x40, 0xf, 0xfe, 0x3b, 0x90, 0x7,
+    0xff, 0x19, 0xe0, 0x3, 0xff, 0x8c, 0xb0, 0x1, 0xff, 0xff, 0x0, 0xff, 0xf0, 0x18, 0x7, 0xff,
+    0x5, 0xc0, 0x3d, 0xc0, 0x1f, 0x9c, 0x3, 0x60, 0x7, 0x98, 0x3, 0xf1, 0x80, 0x67, 0x30, 0xd,
+    0x22, 0x1, 0xfb, 0x0, 0x3b, 0x29, 0xe3, 0x58, 0x3, 0xf9, 0x8, 0x3, 0x96, 0x1c, 0x80, 0x3f,
+    0xee, 0x0, 0xff, 0xe4, 0x1d, 0x88, 0x7, 0xc5, 0x60, 0x1f, 0xe4, 0xf8, 0x31, 0x1, 0x49, 0xd5,
+    0x0, 0xfc,
+
+    /* U+1EEA "Ừ" */
+    0x0, 0xcf, 0xff, 0xac, 0x3, 0xff, 0x8e, 0xf6, 0x20, 0x4, 0xa0, 0xf, 0xf9, 0x8c, 0x3, 0xc9,
+    0x86, 0x0, 0x5a, 0x0, 0xfc, 0xff, 0x3e, 0x1, 0xf1, 0x63, 0x0, 0x16, 0x40, 0x3e, 0x30, 0x1,
+    0x88, 0x7, 0xe9, 0xa7, 0x70, 0x90, 0x7, 0x98, 0x2, 0x30, 0xf, 0xe5, 0x88, 0x88, 0x3, 0xc2,
+    0x1, 0xff, 0xcb, 0x1f, 0x0, 0x8a, 0x3f, 0xf5, 0x0, 0x7f, 0x37, 0xfd, 0xc6, 0x0, 0x40, 0xf,
+    0xfe, 0x64, 0x80, 0x7f, 0xf2, 0x8b, 0x8, 0x3, 0xff, 0x92, 0x7a, 0x60, 0x1f, 0xff, 0xf0, 0xf,
+    0xff, 0xf8, 0x7, 0xff, 0xf1, 0xc0, 0x3f, 0x84, 0x3, 0xff, 0x8f, 0xc0, 0x19, 0x80, 0x3f, 0xb8,
+    0x3, 0x8, 0x6, 0x20, 0xc, 0x42, 0x1, 0xf9, 0x40, 0x36, 0x80, 0x64, 0x0, 0xe8, 0x0, 0xf9,
+    0x8, 0x3, 0x20, 0x7, 0x28, 0x6, 0x67, 0x0, 0xe4, 0xb0, 0xc, 0x26, 0x1, 0xd2, 0x1, 0xd1,
+    0xd5, 0x13, 0xb6, 0x1, 0xd0, 0x1, 0xe3, 0x70, 0xe, 0x15, 0x76, 0x20, 0xe, 0x36, 0x0, 0xfa,
+    0x18, 0x3, 0xff, 0x82, 0x7a, 0x1, 0xfd, 0x32, 0x10, 0xf, 0xf3, 0xe0, 0x80, 0x7f, 0x9b, 0xa9,
+    0x48, 0x2, 0x14, 0x9e, 0x80, 0xf, 0xc0,
+
+    /* U+1EEB "ừ" */
+    0x0, 0x47, 0xfe, 0xa0, 0xf, 0xfe, 0x1c, 0x50, 0x4, 0xb2, 0x1, 0xfe, 0x10, 0xc, 0xba, 0x40,
+    0x6, 0x90, 0xf, 0xc, 0x6f, 0x80, 0x71, 0x6a, 0x80, 0x1a, 0x0, 0x3c, 0xe4, 0x2a, 0x1, 0xea,
+    0xa3, 0xb8, 0x8, 0x3, 0x9, 0x80, 0x34, 0x3, 0xe5, 0x88, 0x88, 0x3, 0x84, 0x3, 0xff, 0x8e,
+    0xe4, 0x0, 0xec, 0xff, 0xc6, 0x1, 0xe5, 0xff, 0xa0, 0x2, 0x40, 0xf, 0xfe, 0x3b, 0x90, 0x7,
+    0xff, 0x19, 0xe0, 0x3, 0xff, 0x8c, 0xb0, 0x1, 0xff, 0xff, 0x0, 0xff, 0xf0, 0x18, 0x7, 0xff,
+    0x5, 0xc0, 0x3d, 0xc0, 0x1f, 0x9c, 0x3, 0x60, 0x7, 0x98, 0x3, 0xf1, 0x80, 0x67, 0x30, 0xd,
+    0x22, 0x1, 0xfb, 0x0, 0x3b, 0x29, 0xe3, 0x58, 0x3, 0xf9, 0x8, 0x3, 0x96, 0x1c, 0x80, 0x3f,
+    0xee, 0x0, 0xff, 0xe4, 0x1d, 0x88, 0x7, 0xc5, 0x60, 0x1f, 0xe4, 0xf8, 0x31, 0x1, 0x49, 0xd5,
+    0x0, 0xfc,
+
+    /* U+1EEC "Ử" */
+    0x0, 0xf9, 0xf3, 0xfd, 0x64, 0x1, 0xff, 0xc6, 0x58, 0x30, 0x2, 0x69, 0x0, 0x7f, 0xf1, 0x54,
+    0x4d, 0x40, 0x28, 0x0, 0xff, 0xe3, 0x7e, 0x55, 0x80, 0x1c, 0x3, 0xf1, 0x90, 0x7, 0xe1, 0x0,
+    0x38, 0x0, 0x40, 0x3c, 0xbb, 0x92, 0x1, 0xff, 0x40, 0x2, 0xc0, 0x3e, 0x20, 0x40, 0xf, 0xf3,
+    0xa0, 0x1b, 0x80, 0x79, 0xc0, 0x22, 0x0, 0xfe, 0x75, 0x6c, 0x0, 0xf8, 0x40, 0x3f, 0xf8, 0x55,
+    0x20, 0x1f, 0xc, 0x0, 0x45, 0x1f, 0xfa, 0x80, 0x3f, 0x9b, 0xfe, 0xe4, 0x0, 0x20, 0x7, 0xff,
+    0x32, 0x40, 0x3f, 0xf9, 0x45, 0x84, 0x1, 0xff, 0xc9, 0x3d, 0x30, 0xf, 0xff, 0xf8, 0x7, 0xff,
+    0xfc, 0x3, 0xff, 0xf8, 0xe0, 0x1f, 0xc2, 0x1, 0xff, 0xc7, 0xe0, 0xc, 0xc0, 0x1f, 0xdc, 0x1,
+    0x84, 0x3, 0x10, 0x6, 0x21, 0x0, 0xfc, 0xa0, 0x1b, 0x40, 0x32, 0x0, 0x74, 0x0, 0x7c, 0x84,
+    0x1, 0x90, 0x3, 0x94, 0x3, 0x33, 0x80, 0x72, 0x58, 0x6, 0x13, 0x0, 0xe9, 0x0, 0xe8, 0xea,
+    0x89, 0xdb, 0x0, 0xe8, 0x0, 0xf1, 0xb8, 0x7, 0xa, 0xbb, 0x10, 0x7, 0x1b, 0x0, 0x7d, 0xc,
+    0x1, 0xff, 0xc1, 0x3d, 0x0, 0xfe, 0x99, 0x8, 0x7, 0xf9, 0xf0, 0x40, 0x3f, 0xcd, 0xd4, 0xa4,
+    0x1, 0xa, 0x4f, 0x40, 0x7, 0xe0,
+
+    /* U+1EED "ử" */
+    0x0, 0xf2, 0xcc, 0x9c, 0x40, 0x3f, 0xf8, 0x43, 0xd4, 0xcc, 0x8f, 0x20, 0xf, 0xfe, 0x8, 0x90,
+    0x6, 0x1e, 0x0, 0xff, 0xe1, 0x7d, 0xfd, 0x80, 0xc, 0x40, 0x3f, 0xf8, 0x26, 0x80, 0x84, 0x1,
+    0xfc, 0x60, 0x1f, 0xc6, 0x40, 0x22, 0x0, 0x86, 0x7f, 0x4, 0x3, 0xe2, 0xc0, 0x5, 0x80, 0x73,
+    0x0, 0x1c, 0x3, 0xe2, 0x60, 0x95, 0x0, 0xc2, 0x60, 0xe, 0x0, 0xfd, 0x3c, 0xc0, 0x1e, 0x10,
+    0xf, 0xfc, 0x20, 0x1e, 0x72, 0x0, 0x76, 0x7f, 0xe3, 0x0, 0xf2, 0xff, 0xd0, 0x1, 0x38, 0x7,
+    0xff, 0x1d, 0xc4, 0x3, 0xff, 0x8d, 0x10, 0x0, 0xff, 0xe3, 0x2b, 0x80, 0x7f, 0xff, 0xc0, 0x3f,
+    0xfc, 0x6, 0x1, 0xff, 0xc1, 0x70, 0xf, 0x70, 0x7, 0xe7, 0x0, 0xd8, 0x1, 0xe6, 0x0, 0xfc,
+    0x60, 0x19, 0xcc, 0x3, 0x48, 0x80, 0x7e, 0xc0, 0xe, 0xca, 0x78, 0xd6, 0x0, 0xfe, 0x42, 0x0,
+    0xe5, 0x87, 0x20, 0xf, 0xfb, 0x80, 0x3f, 0xf9, 0x7, 0x62, 0x1, 0xf1, 0x58, 0x7, 0xf9, 0x3e,
+    0xc, 0x40, 0x52, 0x75, 0x40, 0x3f,
+
+    /* U+1EEE "Ữ" */
+    0x0, 0xff, 0xe9, 0xd, 0xff, 0xb1, 0x0, 0x28, 0xcc, 0x0, 0x7f, 0xf0, 0x75, 0x0, 0x7, 0x74,
+    0x26, 0xe6, 0x40, 0x1c, 0x44, 0x0, 0xe5, 0x30, 0xe, 0x5e, 0xc0, 0x3, 0x80, 0x49, 0x9b, 0x20,
+    0x1d, 0xe0, 0x8, 0xf9, 0x0, 0xf4, 0x0, 0x44, 0x60, 0x80, 0x1c, 0xc0, 0x7, 0x6, 0xe6, 0x0,
+    0x1e, 0x8, 0x4, 0x80, 0x11, 0x0, 0x6c, 0xff, 0x0, 0x43, 0x3f, 0xec, 0x30, 0xc, 0x20, 0x1f,
+    0xfc, 0xb1, 0x80, 0x8, 0xa3, 0xff, 0x50, 0x7, 0xf3, 0x7f, 0xdc, 0x80, 0x4, 0x0, 0xff, 0xe6,
+    0x40, 0x7, 0xff, 0x28, 0xb0, 0xc0, 0x3f, 0xf9, 0x27, 0xa6, 0x1, 0xff, 0xff, 0x0, 0xff, 0xff,
+    0x80, 0x7f, 0xff, 0x1c, 0x3, 0xf8, 0x40, 0x3f, 0xf8, 0xfc, 0x1, 0x98, 0x3, 0xfb, 0x80, 0x30,
+    0x80, 0x62, 0x0, 0xc4, 0x20, 0x1f, 0x94, 0x3, 0x68, 0x6, 0x40, 0xe, 0x80, 0xf, 0x90, 0x80,
+    0x32, 0x0, 0x72, 0x80, 0x66, 0x70, 0xe, 0x4b, 0x0, 0xc2, 0x60, 0x1d, 0x20, 0x1d, 0x1d, 0x51,
+    0x3b, 0x60, 0x1d, 0x0, 0x1e, 0x37, 0x0, 0xe1, 0x57, 0x62, 0x0, 0xe3, 0x60, 0xf, 0xa1, 0x80,
+    0x3f, 0xf8, 0x27, 0xa0, 0x1f, 0xd3, 0x21, 0x0, 0xff, 0x3e, 0x8, 0x7, 0xf9, 0xba, 0x94, 0x80,
+    0x21, 0x49, 0xe8, 0x0, 0xfc,
+
+    /* U+1EEF "ữ" */
+    0x0, 0xd1, 0xdf, 0x86, 0x1, 0x4d, 0xb8, 0x7, 0xf4, 0xb8, 0x81, 0xe4, 0x2, 0x32, 0x70, 0x7,
+    0xe1, 0x60, 0xe, 0x7f, 0xb0, 0x6, 0x0, 0xe, 0xb4, 0x2, 0x70, 0x4, 0x7d, 0x8, 0x6, 0x35,
+    0x2, 0xc5, 0x24, 0x0, 0x8, 0xce, 0xb, 0xec, 0x22, 0x6d, 0x0, 0x11, 0x0, 0x18, 0x0, 0x7e,
+    0xe0, 0x4, 0x33, 0xdc, 0x91, 0x0, 0xff, 0xe5, 0xb1, 0x0, 0x3f, 0x3f, 0xf1, 0x80, 0x79, 0x7f,
+    0xe9, 0x0, 0x94, 0x3, 0xff, 0x8e, 0xc4, 0x1, 0xff, 0xc6, 0x79, 0x0, 0xff, 0xe3, 0x2c, 0x0,
+    0x7f, 0xff, 0xc0, 0x3f, 0xfc, 0x6, 0x1, 0xff, 0xc1, 0x70, 0xf, 0x70, 0x7, 0xe7, 0x0, 0xd8,
+    0x1, 0xe6, 0x0, 0xfc, 0x60, 0x19, 0xcc, 0x3, 0x48, 0x80, 0x7e, 0xc0, 0xe, 0xca, 0x78, 0xd6,
+    0x0, 0xfe, 0x42, 0x0, 0xe5, 0x87, 0x20, 0xf, 0xfb, 0x80, 0x3f, 0xf9, 0x7, 0x62, 0x1, 0xf1,
+    0x58, 0x7, 0xf9, 0x3e, 0xc, 0x40, 0x52, 0x75, 0x40, 0x3f,
+
+    /* U+1EF0 "Ự" */
+    0x0, 0xff, 0xf0, 0x94, 0x74, 0x80, 0x7f, 0xf2, 0x55, 0xc5, 0x80, 0x3f, 0xf9, 0x2a, 0x1, 0x10,
+    0x7, 0xff, 0x20, 0x40, 0x3f, 0xf9, 0x63, 0x0, 0x11, 0xc7, 0xfe, 0xa0, 0xf, 0xe6, 0xff, 0xb9,
+    0x0, 0x6, 0x20, 0x1f, 0xfc, 0xbf, 0x0, 0xff, 0xe5, 0x15, 0x98, 0x7, 0xff, 0x24, 0xf5, 0x0,
+    0x3f, 0xff, 0xe0, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0xe3, 0x80, 0x7f, 0x8, 0x7, 0xff, 0x1f, 0x80,
+    0x33, 0x0, 0x7f, 0x70, 0x6, 0x10, 0xc, 0x40, 0x18, 0x84, 0x3, 0xf2, 0x80, 0x6d, 0x0, 0xc8,
+    0x1, 0xd0, 0x1, 0xf2, 0x10, 0x6, 0x40, 0xe, 0x50, 0xc, 0xce, 0x1, 0xc9, 0x60, 0x18, 0x4c,
+    0x3, 0xa4, 0x3, 0xa3, 0xaa, 0x27, 0x6c, 0x3, 0xa0, 0x3, 0xc6, 0xe0, 0x1c, 0x2a, 0xec, 0x40,
+    0x1c, 0x6c, 0x1, 0xf4, 0x30, 0x7, 0xff, 0x4, 0xf4, 0x3, 0xfa, 0x64, 0x20, 0x1f, 0xe7, 0xc1,
+    0x0, 0xff, 0x37, 0x52, 0x90, 0x4, 0x29, 0x3d, 0x0, 0x1f, 0xfc, 0x25, 0xad, 0xff, 0xba, 0xd8,
+    0x40, 0x3f, 0xf8, 0xcb, 0xc, 0x1, 0xff, 0xc9, 0x7a, 0x79, 0xc0, 0xf, 0xfe, 0x44, 0x0, 0x46,
+    0x60, 0xf, 0xfe, 0x63, 0x80, 0x7f, 0xf1, 0xcc, 0x3, 0x28, 0x7, 0xff, 0x1f, 0x50, 0xa, 0xc4,
+    0x3, 0xfe,
+
+    /* U+1EF1 "ự" */
+    0x0, 0xff, 0xed, 0x36, 0x70, 0x7, 0xff, 0x14, 0x64, 0xc5, 0x40, 0x3f, 0xf8, 0x82, 0x40, 0xd,
+    0x0, 0xff, 0xec, 0xb9, 0x0, 0x3b, 0x3f, 0xf1, 0x80, 0x79, 0x7f, 0xe8, 0x0, 0x90, 0x3, 0xff,
+    0x8e, 0xe4, 0x1, 0xff, 0xc6, 0x78, 0x0, 0xff, 0xe3, 0x2c, 0x0, 0x7f, 0xff, 0xc0, 0x3f, 0xfc,
+    0x6, 0x1, 0xff, 0xc1, 0x70, 0xf, 0x70, 0x7, 0xe7, 0x0, 0xd8, 0x1, 0xe6, 0x0, 0xfc, 0x60,
+    0x19, 0xcc, 0x3, 0x48, 0x80, 0x7e, 0xc0, 0xe, 0xca, 0x78, 0xd6, 0x0, 0xfe, 0x42, 0x0, 0xe5,
+    0x87, 0x20, 0xf, 0xfb, 0x80, 0x3f, 0xf9, 0x7, 0x62, 0x1, 0xf1, 0x58, 0x7, 0xf9, 0x3e, 0xc,
+    0x40, 0x52, 0x75, 0x40, 0x3f, 0xe1, 0x7c, 0xef, 0xeb, 0x60, 0x1f, 0xfd, 0x40, 0x1f, 0xe3, 0x87,
+    0x10, 0xf, 0xfe, 0x21, 0xe3, 0xc7, 0x88, 0x7, 0xff, 0xe, 0x0, 0x21, 0x90, 0xf, 0xfe, 0x1b,
+    0x80, 0x61, 0x0, 0xff, 0xe1, 0xd8, 0x6, 0xd0, 0xf, 0xfe, 0x1b, 0xb0, 0xc, 0x20, 0x7, 0xf0,
+
+    /* U+1EF2 "Ỳ" */
+    0x0, 0xe6, 0xbb, 0xd0, 0x1, 0xff, 0xc6, 0x63, 0x44, 0x9d, 0xc0, 0x1f, 0xfc, 0x68, 0xa0, 0xa,
+    0x18, 0x3, 0xff, 0x8c, 0xb8, 0x20, 0x9, 0x40, 0xf, 0xfe, 0x31, 0xf9, 0x80, 0x2c, 0xc0, 0x3f,
+    0xf8, 0xc3, 0x9d, 0xd1, 0x0, 0x7f, 0xf2, 0x4, 0x70, 0x7, 0xf1, 0x7f, 0xf2, 0x80, 0x7f, 0x93,
+    0xff, 0x60, 0x13, 0x0, 0x6b, 0x0, 0xff, 0x48, 0x6, 0xf0, 0x4, 0x8, 0x4, 0x30, 0x1, 0xf9,
+    0xc8, 0x2, 0x53, 0x0, 0xc, 0x0, 0x67, 0x20, 0xf, 0xc, 0x0, 0x6b, 0x0, 0xcc, 0x60, 0x1a,
+    0x40, 0x3d, 0x0, 0x1a, 0x4, 0x3, 0xbc, 0x3, 0x22, 0x0, 0x31, 0xb0, 0x4, 0x4e, 0x1, 0xe3,
+    0x50, 0xd, 0x20, 0x1b, 0xc0, 0x34, 0x80, 0x7e, 0xb0, 0xc, 0x4e, 0x0, 0x63, 0x0, 0x91, 0x0,
+    0x1f, 0x86, 0x0, 0x34, 0x8, 0x40, 0x6, 0x90, 0xf, 0xf3, 0x90, 0x6, 0x88, 0x8, 0x4, 0xe4,
+    0x1, 0xff, 0x48, 0x6, 0x67, 0x0, 0x86, 0x0, 0x3f, 0xf2, 0x20, 0x3, 0xf5, 0x80, 0x7f, 0xf0,
+    0xa4, 0x3, 0xe3, 0x50, 0xf, 0xfe, 0x11, 0x38, 0x7, 0xbc, 0x3, 0xff, 0x89, 0x2, 0x1, 0x94,
+    0xc0, 0x3f, 0xf8, 0xa4, 0x1, 0xb0, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xff, 0x0, 0xff, 0xe7, 0x80,
+
+    /* U+1EF3 "ỳ" */
+    0x0, 0x8a, 0x23, 0x38, 0x7, 0xff, 0xc, 0xb9, 0xde, 0x8a, 0x0, 0xff, 0xe1, 0xb5, 0x80, 0x4b,
+    0x0, 0x1f, 0xfc, 0x34, 0xc1, 0x0, 0x3b, 0x0, 0x7f, 0xf0, 0xcf, 0xc8, 0x1, 0x28, 0x1, 0xff,
+    0xc3, 0x1d, 0x87, 0x71, 0x80, 0x7f, 0xf1, 0x5e, 0x20, 0xe0, 0x1f, 0xfd, 0x11, 0xff, 0xe1, 0x0,
+    0xfd, 0x3f, 0xf8, 0x85, 0x80, 0x34, 0x80, 0x7c, 0x2c, 0x1, 0x19, 0x5, 0x0, 0x66, 0x0, 0xf9,
+    0x80, 0x34, 0x80, 0xc, 0xc0, 0x10, 0xa8, 0x7, 0xa8, 0x2, 0x15, 0x0, 0xa4, 0x3, 0x70, 0x7,
+    0x21, 0x0, 0x4c, 0x1, 0x94, 0x40, 0x24, 0x20, 0xd, 0xc0, 0x1a, 0x40, 0x39, 0x80, 0x35, 0x0,
+    0x42, 0xa0, 0x12, 0x88, 0x7, 0x48, 0x6, 0x60, 0x9, 0x80, 0x34, 0x80, 0x78, 0x54, 0x2, 0x15,
+    0x0, 0x48, 0x4, 0x46, 0x1, 0xf4, 0x80, 0x69, 0x5, 0x10, 0xa, 0xc0, 0x3f, 0x19, 0x80, 0x23,
+    0x37, 0x0, 0x66, 0x0, 0xfe, 0xa0, 0xd, 0x8, 0x1, 0x38, 0x7, 0xf9, 0x84, 0x2, 0x40, 0xd,
+    0x40, 0x1f, 0xf3, 0x0, 0x7c, 0x84, 0x1, 0xff, 0x50, 0x7, 0xde, 0x1, 0xff, 0x89, 0x0, 0x38,
+    0x90, 0x3, 0xff, 0x83, 0xe0, 0x1d, 0x40, 0x1f, 0xfc, 0x24, 0x10, 0xc, 0xc0, 0x1f, 0xfc, 0x24,
+    0x10, 0x9, 0x84, 0x3, 0xfb, 0x65, 0x9, 0xac, 0x3, 0x50, 0x7, 0xf3, 0x13, 0x5e, 0xc8, 0x6,
+    0x53, 0x0, 0xfe, 0xb0, 0xf, 0xc3, 0x60, 0x1f, 0xc2, 0x60, 0x1f, 0x16, 0x8, 0x7, 0xf0, 0xf4,
+    0x18, 0x80, 0x9c, 0x69, 0x0, 0x7f, 0x80,
+
+    /* U+1EF4 "Ỵ" */
+    0x2f, 0xfe, 0x50, 0xf, 0xf2, 0x7f, 0xec, 0x2, 0x60, 0xd, 0x60, 0x1f, 0xe9, 0x0, 0xde, 0x0,
+    0x81, 0x0, 0x86, 0x0, 0x3f, 0x39, 0x0, 0x4a, 0x60, 0x1, 0x80, 0xc, 0xe4, 0x1, 0xe1, 0x80,
+    0xd, 0x60, 0x19, 0x8c, 0x3, 0x48, 0x7, 0xa0, 0x3, 0x40, 0x80, 0x77, 0x80, 0x64, 0x40, 0x6,
+    0x36, 0x0, 0x89, 0xc0, 0x3c, 0x6a, 0x1, 0xa4, 0x3, 0x78, 0x6, 0x90, 0xf, 0xd6, 0x1, 0x89,
+    0xc0, 0xc, 0x60, 0x12, 0x20, 0x3, 0xf0, 0xc0, 0x6, 0x81, 0x8, 0x0, 0xd2, 0x1, 0xfe, 0x72,
+    0x0, 0xd1, 0x1, 0x0, 0x9c, 0x80, 0x3f, 0xe9, 0x0, 0xcc, 0xe0, 0x10, 0xc0, 0x7, 0xfe, 0x44,
+    0x0, 0x7e, 0xb0, 0xf, 0xfe, 0x14, 0x80, 0x7c, 0x6a, 0x1, 0xff, 0xc2, 0x27, 0x0, 0xf7, 0x80,
+    0x7f, 0xf1, 0x20, 0x40, 0x32, 0x98, 0x7, 0xff, 0x14, 0x80, 0x36, 0x0, 0x7f, 0xff, 0xc0, 0x3f,
+    0xff, 0xe0, 0x1f, 0xfd, 0x8c, 0xff, 0xcc, 0x1, 0xff, 0xdf, 0xaf, 0xe6, 0x0, 0xff, 0xe3, 0xca,
+    0x80, 0xc9, 0x80, 0x7f, 0xf1, 0x90, 0x3, 0x20, 0x7, 0xff, 0x18, 0x40, 0x30, 0x80, 0x7f, 0xf1,
+    0xa4, 0x2, 0x26, 0x0, 0xff, 0xe3, 0x2e, 0x3c, 0x60, 0x7, 0xf8,
+
+    /* U+1EF5 "ỵ" */
+    0x1f, 0xfe, 0x10, 0xf, 0xd3, 0xff, 0x88, 0x58, 0x3, 0x48, 0x7, 0xc2, 0xc0, 0x11, 0x90, 0x58,
+    0x6, 0x60, 0xf, 0x98, 0x3, 0x48, 0x0, 0x8c, 0x2, 0x15, 0x0, 0xf5, 0x0, 0x42, 0xa0, 0x14,
+    0x80, 0x69, 0x0, 0xe4, 0x20, 0x9, 0x80, 0x32, 0x88, 0x4, 0x64, 0x1, 0xb8, 0x3, 0x48, 0x7,
+    0x48, 0x6, 0xb0, 0x8, 0x54, 0x2, 0x51, 0x0, 0xe6, 0x0, 0xcc, 0x1, 0x30, 0x6, 0x90, 0xf,
+    0xa, 0x80, 0x66, 0x0, 0x48, 0x4, 0x46, 0x1, 0xf4, 0x80, 0x6b, 0x5, 0x10, 0xa, 0xc0, 0x3f,
+    0x19, 0x80, 0x22, 0x3e, 0x0, 0xcc, 0x1, 0xfd, 0x20, 0x1b, 0xd0, 0x2, 0x70, 0xf, 0xf2, 0x88,
+    0x4, 0x60, 0x1a, 0x80, 0x3f, 0xe9, 0x0, 0xf9, 0x8, 0x3, 0xfe, 0x60, 0xf, 0xbc, 0x3, 0xff,
+    0xa, 0x80, 0x71, 0x20, 0x7, 0xff, 0x6, 0x40, 0x3a, 0x80, 0x3f, 0xf8, 0x46, 0x20, 0x19, 0x80,
+    0x3f, 0x88, 0x3, 0x20, 0x80, 0x4c, 0x20, 0x1f, 0xd9, 0x48, 0x4d, 0x60, 0x1a, 0x82, 0xbf, 0x98,
+    0x3, 0x30, 0xad, 0xec, 0x80, 0x65, 0x38, 0x50, 0x19, 0x30, 0xa, 0x0, 0x3f, 0xd, 0x82, 0x80,
+    0x6b, 0x0, 0x8, 0x7, 0xe2, 0xc1, 0x6, 0x0, 0xdc, 0x0, 0x1e, 0x83, 0x10, 0x13, 0x8d, 0x20,
+    0x7, 0x80, 0x42, 0xe0, 0x19, 0xf3, 0xbf, 0xb1, 0xc0, 0x32, 0x63, 0xc7, 0x88, 0x0,
+
+    /* U+1EF6 "Ỷ" */
+    0x0, 0xfc, 0x2d, 0x32, 0x60, 0xf, 0xfe, 0x31, 0x74, 0xb3, 0x27, 0x44, 0x3, 0xff, 0x88, 0x42,
+    0x1, 0x8a, 0x80, 0x3f, 0xf8, 0xb5, 0x9f, 0x40, 0x4, 0x0, 0xff, 0xe2, 0xa1, 0x82, 0x80, 0x7f,
+    0xf2, 0xd8, 0x0, 0x80, 0x1f, 0xfc, 0x74, 0x90, 0x4, 0x80, 0x7f, 0xf1, 0xd1, 0x8b, 0x8, 0x3,
+    0xff, 0x91, 0x3a, 0x60, 0x1f, 0xe2, 0xff, 0xe5, 0x0, 0xff, 0x27, 0xfe, 0xc0, 0x26, 0x0, 0xd6,
+    0x1, 0xfe, 0x90, 0xd, 0xe0, 0x8, 0x10, 0x8, 0x60, 0x3, 0xf3, 0x90, 0x4, 0xa6, 0x0, 0x18,
+    0x0, 0xce, 0x40, 0x1e, 0x18, 0x0, 0xd6, 0x1, 0x98, 0xc0, 0x34, 0x80, 0x7a, 0x0, 0x34, 0x8,
+    0x7, 0x78, 0x6, 0x44, 0x0, 0x63, 0x60, 0x8, 0x9c, 0x3, 0xc6, 0xa0, 0x1a, 0x40, 0x37, 0x80,
+    0x69, 0x0, 0xfd, 0x60, 0x18, 0x9c, 0x0, 0xc6, 0x1, 0x22, 0x0, 0x3f, 0xc, 0x0, 0x68, 0x10,
+    0x80, 0xd, 0x20, 0x1f, 0xe7, 0x20, 0xd, 0x10, 0x10, 0x9, 0xc8, 0x3, 0xfe, 0x90, 0xc, 0xce,
+    0x1, 0xc, 0x0, 0x7f, 0xe4, 0x40, 0x7, 0xeb, 0x0, 0xff, 0xe1, 0x48, 0x7, 0xc6, 0xa0, 0x1f,
+    0xfc, 0x22, 0x70, 0xf, 0x78, 0x7, 0xff, 0x12, 0x4, 0x3, 0x29, 0x80, 0x7f, 0xf1, 0x48, 0x3,
+    0x60, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xcf,
+
+    /* U+1EF7 "ỷ" */
+    0x0, 0xf8, 0x9e, 0x64, 0xa0, 0x1f, 0xfc, 0x35, 0xd8, 0x66, 0x55, 0x80, 0x7f, 0xf0, 0x9c, 0x3,
+    0x91, 0x80, 0x3f, 0xf8, 0x25, 0x3b, 0xec, 0x0, 0xd0, 0xf, 0xfe, 0x13, 0x10, 0x50, 0x7, 0xff,
+    0x22, 0x80, 0x6, 0x1, 0xff, 0xc4, 0x86, 0x1, 0x90, 0xf, 0xfe, 0x24, 0x91, 0xe0, 0x80, 0x7f,
+    0xf1, 0x7, 0x30, 0x40, 0x1f, 0xfc, 0x61, 0x0, 0xff, 0xf, 0xff, 0x8, 0x7, 0xe9, 0xff, 0xc4,
+    0x2c, 0x1, 0xa4, 0x3, 0xe1, 0x60, 0x8, 0xc8, 0x28, 0x3, 0x30, 0x7, 0xcc, 0x1, 0xa4, 0x0,
+    0x66, 0x0, 0x85, 0x40, 0x3d, 0x40, 0x10, 0xa8, 0x5, 0x20, 0x1b, 0x80, 0x39, 0x8, 0x2, 0x60,
+    0xc, 0xa2, 0x1, 0x21, 0x0, 0x6e, 0x0, 0xd2, 0x1, 0xcc, 0x1, 0xa8, 0x2, 0x15, 0x0, 0x94,
+    0x40, 0x3a, 0x40, 0x33, 0x0, 0x4c, 0x1, 0xa4, 0x3, 0xc2, 0xa0, 0x10, 0xa8, 0x2, 0x40, 0x22,
+    0x30, 0xf, 0xa4, 0x3, 0x48, 0x28, 0x80, 0x56, 0x1, 0xf8, 0xcc, 0x1, 0x19, 0xb8, 0x3, 0x30,
+    0x7, 0xf5, 0x0, 0x68, 0x40, 0x9, 0xc0, 0x3f, 0xcc, 0x20, 0x12, 0x0, 0x6a, 0x0, 0xff, 0x98,
+    0x3, 0xe4, 0x20, 0xf, 0xfa, 0x80, 0x3e, 0xf0, 0xf, 0xfc, 0x48, 0x1, 0xc4, 0x80, 0x1f, 0xfc,
+    0x1f, 0x0, 0xea, 0x0, 0xff, 0xe1, 0x20, 0x80, 0x66, 0x0, 0xff, 0xe1, 0x20, 0x80, 0x4c, 0x20,
+    0x1f, 0xdb, 0x28, 0x4d, 0x60, 0x1a, 0x80, 0x3f, 0x98, 0x9a, 0xf6, 0x40, 0x32, 0x98, 0x7, 0xf5,
+    0x80, 0x7e, 0x1b, 0x0, 0xfe, 0x13, 0x0, 0xf8, 0xb0, 0x40, 0x3f, 0x87, 0xa0, 0xc4, 0x4, 0xe3,
+    0x48, 0x3, 0xfc,
+
+    /* U+1EF8 "Ỹ" */
+    0x0, 0xfa, 0x3b, 0xf5, 0x40, 0x25, 0xbb, 0x10, 0x7, 0xfd, 0x2e, 0x20, 0x55, 0x64, 0x30, 0x88,
+    0x30, 0xf, 0xf1, 0x30, 0x7, 0x26, 0xf1, 0x1, 0x88, 0x7, 0xf9, 0x0, 0xb, 0xd4, 0x20, 0x1d,
+    0x0, 0x1f, 0xf7, 0x80, 0x20, 0x57, 0xd8, 0x40, 0xa9, 0x0, 0x3f, 0xe9, 0xff, 0x10, 0x0, 0x67,
+    0xbf, 0x54, 0x3, 0xff, 0xa6, 0x5f, 0xfc, 0xa0, 0x1f, 0xe4, 0xff, 0xd8, 0x4, 0xc0, 0x1a, 0xc0,
+    0x3f, 0xd2, 0x1, 0xbc, 0x1, 0x2, 0x1, 0xc, 0x0, 0x7e, 0x72, 0x0, 0x94, 0xc0, 0x3, 0x0,
+    0x19, 0xc8, 0x3, 0xc3, 0x0, 0x1a, 0xc0, 0x33, 0x18, 0x6, 0x90, 0xf, 0x40, 0x6, 0x81, 0x0,
+    0xef, 0x0, 0xc8, 0x80, 0xc, 0x6c, 0x1, 0x13, 0x80, 0x78, 0xd4, 0x3, 0x48, 0x6, 0xf0, 0xd,
+    0x20, 0x1f, 0xac, 0x3, 0x13, 0x80, 0x18, 0xc0, 0x24, 0x40, 0x7, 0xe1, 0x80, 0xd, 0x2, 0x10,
+    0x1, 0xa4, 0x3, 0xfc, 0xe4, 0x1, 0xa2, 0x2, 0x1, 0x39, 0x0, 0x7f, 0xd2, 0x1, 0x99, 0xc0,
+    0x21, 0x80, 0xf, 0xfc, 0x88, 0x0, 0xfd, 0x60, 0x1f, 0xfc, 0x29, 0x0, 0xf8, 0xd4, 0x3, 0xff,
+    0x84, 0x4e, 0x1, 0xef, 0x0, 0xff, 0xe2, 0x40, 0x80, 0x65, 0x30, 0xf, 0xfe, 0x29, 0x0, 0x6c,
+    0x0, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xf9, 0xe0,
+
+    /* U+1EF9 "ỹ" */
+    0x0, 0xe1, 0xae, 0xd5, 0x0, 0x86, 0x20, 0x40, 0x1f, 0xda, 0xa2, 0x54, 0xc0, 0x5, 0x77, 0x30,
+    0x7, 0xe4, 0x30, 0xd, 0x2c, 0x30, 0x0, 0x50, 0xf, 0xda, 0x0, 0xad, 0x20, 0x9e, 0x30, 0x31,
+    0x0, 0xfc, 0x80, 0x6a, 0x58, 0x40, 0x1a, 0x0, 0x3f, 0xc2, 0xa0, 0x1, 0xc5, 0x13, 0xb4, 0x0,
+    0xfe, 0xde, 0x90, 0x8, 0x6b, 0xb1, 0x0, 0x3f, 0xf9, 0xe3, 0xff, 0xc2, 0x1, 0xfa, 0x7f, 0xf1,
+    0xb, 0x0, 0x69, 0x0, 0xf8, 0x58, 0x2, 0x32, 0xa, 0x0, 0xcc, 0x1, 0xf3, 0x0, 0x69, 0x0,
+    0x19, 0x80, 0x21, 0x50, 0xf, 0x50, 0x4, 0x2a, 0x1, 0x48, 0x6, 0xe0, 0xe, 0x42, 0x0, 0x98,
+    0x3, 0x28, 0x80, 0x48, 0x40, 0x1b, 0x80, 0x34, 0x80, 0x73, 0x0, 0x6a, 0x0, 0x85, 0x40, 0x25,
+    0x10, 0xe, 0x90, 0xc, 0xc0, 0x13, 0x0, 0x69, 0x0, 0xf0, 0xa8, 0x4, 0x2a, 0x0, 0x90, 0x8,
+    0x8c, 0x3, 0xe9, 0x0, 0xd2, 0xa, 0x20, 0x15, 0x80, 0x7e, 0x33, 0x0, 0x46, 0x6e, 0x0, 0xcc,
+    0x1, 0xfd, 0x40, 0x1a, 0x10, 0x2, 0x70, 0xf, 0xf3, 0x8, 0x4, 0x80, 0x1a, 0x80, 0x3f, 0xe6,
+    0x0, 0xf9, 0x8, 0x3, 0xfe, 0xa0, 0xf, 0xbc, 0x3, 0xff, 0x12, 0x0, 0x71, 0x20, 0x7, 0xff,
+    0x7, 0xc0, 0x3a, 0x80, 0x3f, 0xf8, 0x48, 0x20, 0x19, 0x80, 0x3f, 0xf8, 0x48, 0x20, 0x13, 0x8,
+    0x7, 0xf6, 0xca, 0x13, 0x58, 0x6, 0xa0, 0xf, 0xe6, 0x26, 0xbd, 0x90, 0xc, 0xa6, 0x1, 0xfd,
+    0x60, 0x1f, 0x86, 0xc0, 0x3f, 0x84, 0xc0, 0x3e, 0x2c, 0x10, 0xf, 0xe1, 0xe8, 0x31, 0x1, 0x38,
+    0xd2, 0x0, 0xff, 0x0,
+
+};
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 145, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 148, .box_w = 7, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 67, .adv_w = 224, .box_w = 12, .box_h = 10, .ofs_x = 1, .ofs_y = 13},
+    {.bitmap_index = 112, .adv_w = 369, .box_w = 23, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 278, .adv_w = 327, .box_w = 20, .box_h = 32, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 462, .adv_w = 449, .box_w = 28, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 723, .adv_w = 373, .box_w = 22, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 912, .adv_w = 118, .box_w = 5, .box_h = 10, .ofs_x = 1, .ofs_y = 13},
+    {.bitmap_index = 931, .adv_w = 183, .box_w = 10, .box_h = 31, .ofs_x = 2, .ofs_y = -6},
+    {.bitmap_index = 1048, .adv_w = 183, .box_w = 10, .box_h = 31, .ofs_x = 0, .ofs_y = -6},
+    {.bitmap_index = 1163, .adv_w = 222, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = 11},
+    {.bitmap_index = 1241, .adv_w = 307, .box_w = 17, .box_h = 16, .ofs_x = 1, .ofs_y = 4},
+    {.bitmap_index = 1275, .adv_w = 134, .box_w = 7, .box_h = 12, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 1314, .adv_w = 198, .box_w = 10, .box_h = 5, .ofs_x = 1, .ofs_y = 7},
+    {.bitmap_index = 1323, .adv_w = 134, .box_w = 7, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1345, .adv_w = 201, .box_w = 16, .box_h = 31, .ofs_x = -2, .ofs_y = -3},
+    {.bitmap_index = 1491, .adv_w = 348, .box_w = 20, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1652, .adv_w = 201, .box_w = 10, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1674, .adv_w = 302, .box_w = 18, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1799, .adv_w = 303, .box_w = 19, .box_h = 23, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 1927, .adv_w = 353, .box_w = 22, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2047, .adv_w = 305, .box_w = 19, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2185, .adv_w = 326, .box_w = 19, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2347, .adv_w = 317, .box_w = 19, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2461, .adv_w = 338, .box_w = 19, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2627, .adv_w = 326, .box_w = 20, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2793, .adv_w = 134, .box_w = 7, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2841, .adv_w = 134, .box_w = 7, .box_h = 23, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 2906, .adv_w = 307, .box_w = 17, .box_h = 17, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 3005, .adv_w = 307, .box_w = 17, .box_h = 13, .ofs_x = 1, .ofs_y = 5},
+    {.bitmap_index = 3030, .adv_w = 307, .box_w = 17, .box_h = 17, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 3128, .adv_w = 302, .box_w = 19, .box_h = 23, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 3262, .adv_w = 530, .box_w = 31, .box_h = 29, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 3614, .adv_w = 392, .box_w = 26, .box_h = 23, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 3792, .adv_w = 392, .box_w = 22, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3916, .adv_w = 371, .box_w = 22, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4083, .adv_w = 423, .box_w = 24, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4222, .adv_w = 344, .box_w = 18, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4266, .adv_w = 327, .box_w = 18, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4305, .adv_w = 395, .box_w = 22, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4468, .adv_w = 414, .box_w = 22, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4508, .adv_w = 168, .box_w = 6, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4517, .adv_w = 277, .box_w = 16, .box_h = 23, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 4586, .adv_w = 379, .box_w = 23, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4736, .adv_w = 309, .box_w = 18, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4765, .adv_w = 489, .box_w = 26, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4924, .adv_w = 414, .box_w = 22, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5035, .adv_w = 432, .box_w = 25, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5228, .adv_w = 375, .box_w = 21, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5333, .adv_w = 432, .box_w = 26, .box_h = 28, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 5575, .adv_w = 376, .box_w = 21, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5707, .adv_w = 327, .box_w = 20, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5873, .adv_w = 316, .box_w = 20, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5909, .adv_w = 403, .box_w = 21, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6002, .adv_w = 382, .box_w = 26, .box_h = 23, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 6189, .adv_w = 595, .box_w = 37, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6479, .adv_w = 366, .box_w = 23, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6661, .adv_w = 346, .box_w = 24, .box_h = 23, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 6794, .adv_w = 344, .box_w = 20, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6899, .adv_w = 188, .box_w = 10, .box_h = 31, .ofs_x = 2, .ofs_y = -6},
+    {.bitmap_index = 6922, .adv_w = 201, .box_w = 16, .box_h = 31, .ofs_x = -2, .ofs_y = -3},
+    {.bitmap_index = 7067, .adv_w = 188, .box_w = 10, .box_h = 31, .ofs_x = 0, .ofs_y = -6},
+    {.bitmap_index = 7090, .adv_w = 307, .box_w = 17, .box_h = 14, .ofs_x = 1, .ofs_y = 5},
+    {.bitmap_index = 7183, .adv_w = 256, .box_w = 16, .box_h = 3, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 7190, .adv_w = 307, .box_w = 11, .box_h = 5, .ofs_x = 2, .ofs_y = 20},
+    {.bitmap_index = 7213, .adv_w = 316, .box_w = 17, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7327, .adv_w = 353, .box_w = 20, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 7448, .adv_w = 303, .box_w = 18, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7565, .adv_w = 354, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7691, .adv_w = 323, .box_w = 19, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7812, .adv_w = 198, .box_w = 14, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7878, .adv_w = 358, .box_w = 20, .box_h = 24, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 8047, .adv_w = 354, .box_w = 18, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 8122, .adv_w = 154, .box_w = 7, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8155, .adv_w = 157, .box_w = 12, .box_h = 33, .ofs_x = -3, .ofs_y = -6},
+    {.bitmap_index = 8226, .adv_w = 335, .box_w = 20, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 8344, .adv_w = 154, .box_w = 6, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 8355, .adv_w = 537, .box_w = 30, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 8463, .adv_w = 354, .box_w = 18, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 8528, .adv_w = 335, .box_w = 19, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8652, .adv_w = 353, .box_w = 20, .box_h = 24, .ofs_x = 2, .ofs_y = -6},
+    {.bitmap_index = 8773, .adv_w = 353, .box_w = 19, .box_h = 24, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 8896, .adv_w = 221, .box_w = 11, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 8936, .adv_w = 272, .box_w = 17, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9062, .adv_w = 223, .box_w = 14, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9124, .adv_w = 352, .box_w = 18, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 9188, .adv_w = 306, .box_w = 21, .box_h = 18, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 9317, .adv_w = 480, .box_w = 30, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9517, .adv_w = 305, .box_w = 19, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9643, .adv_w = 306, .box_w = 21, .box_h = 24, .ofs_x = -1, .ofs_y = -6},
+    {.bitmap_index = 9813, .adv_w = 278, .box_w = 16, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9884, .adv_w = 200, .box_w = 12, .box_h = 31, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 9971, .adv_w = 158, .box_w = 6, .box_h = 31, .ofs_x = 2, .ofs_y = -6},
+    {.bitmap_index = 9985, .adv_w = 200, .box_w = 11, .box_h = 31, .ofs_x = 0, .ofs_y = -6},
+    {.bitmap_index = 10064, .adv_w = 307, .box_w = 17, .box_h = 7, .ofs_x = 1, .ofs_y = 8},
+    {.bitmap_index = 10118, .adv_w = 392, .box_w = 26, .box_h = 30, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 10333, .adv_w = 392, .box_w = 26, .box_h = 30, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 10550, .adv_w = 392, .box_w = 26, .box_h = 30, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 10775, .adv_w = 392, .box_w = 26, .box_h = 30, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 11007, .adv_w = 344, .box_w = 18, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 11087, .adv_w = 344, .box_w = 18, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 11166, .adv_w = 344, .box_w = 18, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 11254, .adv_w = 168, .box_w = 11, .box_h = 30, .ofs_x = -2, .ofs_y = 0},
+    {.bitmap_index = 11299, .adv_w = 168, .box_w = 11, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 11344, .adv_w = 432, .box_w = 25, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 11575, .adv_w = 432, .box_w = 25, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 11808, .adv_w = 432, .box_w = 25, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 12049, .adv_w = 432, .box_w = 25, .box_h = 31, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 12295, .adv_w = 403, .box_w = 21, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 12427, .adv_w = 403, .box_w = 21, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 12560, .adv_w = 346, .box_w = 24, .box_h = 30, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 12738, .adv_w = 316, .box_w = 17, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 12886, .adv_w = 316, .box_w = 17, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 13034, .adv_w = 316, .box_w = 17, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 13191, .adv_w = 316, .box_w = 17, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 13351, .adv_w = 323, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 13509, .adv_w = 323, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 13666, .adv_w = 323, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 13830, .adv_w = 154, .box_w = 10, .box_h = 25, .ofs_x = -2, .ofs_y = 0},
+    {.bitmap_index = 13871, .adv_w = 154, .box_w = 11, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 13913, .adv_w = 335, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 14073, .adv_w = 335, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 14231, .adv_w = 335, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 14399, .adv_w = 335, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 14569, .adv_w = 352, .box_w = 18, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 14670, .adv_w = 352, .box_w = 18, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 14769, .adv_w = 306, .box_w = 21, .box_h = 32, .ofs_x = -1, .ofs_y = -6},
+    {.bitmap_index = 14984, .adv_w = 392, .box_w = 26, .box_h = 30, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 15213, .adv_w = 316, .box_w = 17, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 15371, .adv_w = 430, .box_w = 26, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15524, .adv_w = 354, .box_w = 22, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 15669, .adv_w = 168, .box_w = 12, .box_h = 30, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 15722, .adv_w = 154, .box_w = 12, .box_h = 25, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 15772, .adv_w = 403, .box_w = 21, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 15917, .adv_w = 352, .box_w = 18, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 16027, .adv_w = 432, .box_w = 25, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 16248, .adv_w = 335, .box_w = 19, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 16397, .adv_w = 410, .box_w = 25, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 16536, .adv_w = 359, .box_w = 21, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 16637, .adv_w = 392, .box_w = 26, .box_h = 31, .ofs_x = -1, .ofs_y = -8},
+    {.bitmap_index = 16859, .adv_w = 316, .box_w = 17, .box_h = 25, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 17009, .adv_w = 392, .box_w = 26, .box_h = 32, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 17239, .adv_w = 316, .box_w = 17, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 17403, .adv_w = 392, .box_w = 26, .box_h = 33, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 17658, .adv_w = 316, .box_w = 22, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 17851, .adv_w = 392, .box_w = 26, .box_h = 33, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 18099, .adv_w = 316, .box_w = 19, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 18283, .adv_w = 392, .box_w = 26, .box_h = 33, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 18540, .adv_w = 316, .box_w = 17, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 18714, .adv_w = 392, .box_w = 26, .box_h = 35, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 18993, .adv_w = 316, .box_w = 17, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 19187, .adv_w = 392, .box_w = 26, .box_h = 38, .ofs_x = -1, .ofs_y = -8},
+    {.bitmap_index = 19457, .adv_w = 316, .box_w = 17, .box_h = 32, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 19650, .adv_w = 392, .box_w = 26, .box_h = 34, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 19904, .adv_w = 316, .box_w = 17, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 20083, .adv_w = 392, .box_w = 26, .box_h = 34, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 20337, .adv_w = 316, .box_w = 17, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 20516, .adv_w = 392, .box_w = 26, .box_h = 34, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 20768, .adv_w = 316, .box_w = 17, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 20950, .adv_w = 392, .box_w = 26, .box_h = 35, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 21224, .adv_w = 316, .box_w = 17, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 21418, .adv_w = 392, .box_w = 26, .box_h = 38, .ofs_x = -1, .ofs_y = -8},
+    {.bitmap_index = 21692, .adv_w = 316, .box_w = 17, .box_h = 32, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 21886, .adv_w = 344, .box_w = 18, .box_h = 31, .ofs_x = 2, .ofs_y = -8},
+    {.bitmap_index = 21967, .adv_w = 323, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 22129, .adv_w = 344, .box_w = 18, .box_h = 32, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 22223, .adv_w = 323, .box_w = 19, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 22399, .adv_w = 344, .box_w = 18, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 22491, .adv_w = 323, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 22658, .adv_w = 344, .box_w = 22, .box_h = 32, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 22768, .adv_w = 323, .box_w = 22, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 22966, .adv_w = 344, .box_w = 19, .box_h = 33, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 23076, .adv_w = 323, .box_w = 19, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 23261, .adv_w = 344, .box_w = 18, .box_h = 33, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 23372, .adv_w = 323, .box_w = 19, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 23557, .adv_w = 344, .box_w = 18, .box_h = 35, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 23685, .adv_w = 323, .box_w = 19, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 23886, .adv_w = 344, .box_w = 18, .box_h = 38, .ofs_x = 2, .ofs_y = -8},
+    {.bitmap_index = 24011, .adv_w = 323, .box_w = 19, .box_h = 32, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 24216, .adv_w = 168, .box_w = 8, .box_h = 32, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 24261, .adv_w = 154, .box_w = 9, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24306, .adv_w = 168, .box_w = 6, .box_h = 31, .ofs_x = 2, .ofs_y = -8},
+    {.bitmap_index = 24335, .adv_w = 154, .box_w = 7, .box_h = 34, .ofs_x = 1, .ofs_y = -8},
+    {.bitmap_index = 24391, .adv_w = 432, .box_w = 25, .box_h = 30, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 24627, .adv_w = 335, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 24790, .adv_w = 432, .box_w = 25, .box_h = 32, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 25038, .adv_w = 335, .box_w = 19, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 25218, .adv_w = 432, .box_w = 25, .box_h = 33, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 25480, .adv_w = 335, .box_w = 22, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 25682, .adv_w = 432, .box_w = 25, .box_h = 33, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 25946, .adv_w = 335, .box_w = 19, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 26132, .adv_w = 432, .box_w = 25, .box_h = 33, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 26402, .adv_w = 335, .box_w = 19, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 26588, .adv_w = 432, .box_w = 25, .box_h = 35, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 26881, .adv_w = 335, .box_w = 19, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 27086, .adv_w = 432, .box_w = 25, .box_h = 37, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 27370, .adv_w = 335, .box_w = 19, .box_h = 32, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 27577, .adv_w = 432, .box_w = 25, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 27828, .adv_w = 335, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 28000, .adv_w = 432, .box_w = 25, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 28250, .adv_w = 335, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 28425, .adv_w = 432, .box_w = 25, .box_h = 32, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 28691, .adv_w = 335, .box_w = 19, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 28880, .adv_w = 432, .box_w = 25, .box_h = 31, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 29143, .adv_w = 335, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 29321, .adv_w = 432, .box_w = 25, .box_h = 35, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 29585, .adv_w = 335, .box_w = 19, .box_h = 30, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 29773, .adv_w = 403, .box_w = 21, .box_h = 30, .ofs_x = 2, .ofs_y = -7},
+    {.bitmap_index = 29905, .adv_w = 352, .box_w = 18, .box_h = 25, .ofs_x = 2, .ofs_y = -7},
+    {.bitmap_index = 30007, .adv_w = 403, .box_w = 21, .box_h = 32, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 30155, .adv_w = 352, .box_w = 18, .box_h = 28, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 30271, .adv_w = 410, .box_w = 25, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 30438, .adv_w = 359, .box_w = 21, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 30568, .adv_w = 410, .box_w = 25, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 30735, .adv_w = 359, .box_w = 21, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 30865, .adv_w = 410, .box_w = 25, .box_h = 32, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 31047, .adv_w = 359, .box_w = 21, .box_h = 28, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 31197, .adv_w = 410, .box_w = 25, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 31378, .adv_w = 359, .box_w = 21, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 31516, .adv_w = 410, .box_w = 25, .box_h = 36, .ofs_x = 2, .ofs_y = -7},
+    {.bitmap_index = 31694, .adv_w = 359, .box_w = 21, .box_h = 31, .ofs_x = 2, .ofs_y = -7},
+    {.bitmap_index = 31838, .adv_w = 346, .box_w = 24, .box_h = 30, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 32014, .adv_w = 306, .box_w = 21, .box_h = 32, .ofs_x = -1, .ofs_y = -6},
+    {.bitmap_index = 32229, .adv_w = 346, .box_w = 24, .box_h = 31, .ofs_x = -1, .ofs_y = -8},
+    {.bitmap_index = 32400, .adv_w = 306, .box_w = 21, .box_h = 25, .ofs_x = -1, .ofs_y = -7},
+    {.bitmap_index = 32590, .adv_w = 346, .box_w = 24, .box_h = 32, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 32776, .adv_w = 306, .box_w = 21, .box_h = 34, .ofs_x = -1, .ofs_y = -6},
+    {.bitmap_index = 33003, .adv_w = 346, .box_w = 24, .box_h = 30, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 33189, .adv_w = 306, .box_w = 21, .box_h = 32, .ofs_x = -1, .ofs_y = -6},
+};
+
+static const uint16_t unicode_list_1[] = {
+    0x0, 0x1, 0x2, 0x3, 0x8, 0x9, 0xa, 0xc,
+    0xd, 0x12, 0x13, 0x14, 0x15, 0x19, 0x1a, 0x1d,
+    0x20, 0x21, 0x22, 0x23, 0x28, 0x29, 0x2a, 0x2c,
+    0x2d, 0x32, 0x33, 0x34, 0x35, 0x39, 0x3a, 0x3d,
+    0x42, 0x43, 0x50, 0x51, 0x68, 0x69, 0xa8, 0xa9,
+    0xe0, 0xe1, 0xef, 0xf0,
+};
+
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {
+        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 192, .range_length = 241, .glyph_id_start = 96,
+        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 44, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    },
+    {
+        .range_start = 7840, .range_length = 90, .glyph_id_start = 140,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    }
+};
+
+#if LVGL_VERSION_MAJOR == 8
+static lv_font_fmt_txt_glyph_cache_t cache;
+#endif
+
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = NULL,
+    .kern_scale = 0,
+    .cmap_num = 3,
+    .bpp = 4,
+    .kern_classes = 0,
+    .bitmap_format = 1,
+#if LVGL_VERSION_MAJOR == 8
+    .cache = &cache
+#endif
+};
+
+const lv_font_t montserrat_bold_32 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,
+    .line_height = 43,
+    .base_line = 8,
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -3,
+    .underline_thickness = 2,
+    .dsc = &font_dsc,
+    .fallback = NULL,
+    .user_data = NULL,
+};
+
+lv_font_t* get_montserrat_bold_32()
+{
+    return (lv_font_t*)&montserrat_bold_32;
+}
+
+#endif /*#if MONTSERRAT_BOLD_32*/
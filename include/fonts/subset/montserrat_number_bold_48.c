@@ -0,0 +1,336 @@
+/*******************************************************************************
+ * Sinh bởi tools/font_subset.py từ include/fonts/montserrat_number_bold_48.c, không sửa tay.
+ * Dùng bởi: DistanceReadout
+ * Glyph: 18, bitmap: nén RLE + prefilter
+ ******************************************************************************/
+
+#include "../local_fonts.h"
+
+#ifndef MONTSERRAT_NUMBER_BOLD_48
+#define MONTSERRAT_NUMBER_BOLD_48 1
+#endif
+
+#if MONTSERRAT_NUMBER_BOLD_48
+
+#if !LV_USE_FONT_COMPRESSED
+#error "montserrat_number_bold_48.c là font nén: bật LV_USE_FONT_COMPRESSED trong lv_conf.h"
+#endif
+
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+0020 " " */
+
+    /* U+002C "," */
+    0x0, 0xff, 0xc7, 0x7f, 0xee, 0x91, 0x0, 0x26, 0x20, 0x0, 0x5b, 0x0, 0x14, 0x1, 0xe2, 0x83,
+    0x10, 0xf, 0x95, 0xc0, 0x3f, 0x1b, 0x80, 0x7e, 0x33, 0x8, 0x7, 0xce, 0x14, 0x1, 0xf7, 0x82,
+    0x60, 0x80, 0x61, 0x50, 0x1, 0x88, 0x6, 0x60, 0x9, 0x0, 0x3a, 0x80, 0x2d, 0x0, 0xc8, 0x40,
+    0x12, 0x0, 0x6e, 0x0, 0x88, 0x80, 0x10, 0xa8, 0x4, 0x80, 0x19, 0x80, 0x36, 0x80, 0x69, 0x0,
+    0x80,
+
+    /* U+002E "." */
+    0x0, 0xc4, 0x62, 0x1, 0xcb, 0xdb, 0x9d, 0x64, 0x0, 0x6a, 0x10, 0x9, 0x30, 0x45, 0x20, 0x1e,
+    0x18, 0x50, 0xf, 0xc8, 0x20, 0x1f, 0x8d, 0x80, 0x3f, 0x11, 0x90, 0x7, 0xd6, 0x1c, 0x1, 0xe4,
+    0x70, 0x3d, 0x51, 0x2, 0x8b, 0x0,
+
+    /* U+0030 "0" */
+    0x0, 0xff, 0xc8, 0xce, 0xf2, 0x90, 0x7, 0xff, 0x21, 0x6f, 0xee, 0x62, 0x2a, 0xde, 0x92, 0x0,
+    0xff, 0xe1, 0xa6, 0xd2, 0x0, 0x7e, 0x16, 0xd9, 0x10, 0xf, 0xfd, 0x16, 0x40, 0x1f, 0xfc, 0x16,
+    0xf3, 0x0, 0xff, 0x4b, 0x80, 0x7f, 0xf1, 0x7, 0xc, 0x3, 0xf4, 0x30, 0x7, 0xff, 0x1f, 0x44,
+    0x3, 0xc6, 0xe0, 0x1f, 0xfc, 0x81, 0xd0, 0xf, 0x70, 0x7, 0xe4, 0xbe, 0xfd, 0x91, 0x0, 0xf8,
+    0xd4, 0x3, 0x29, 0x0, 0x7d, 0x16, 0x82, 0x4, 0xde, 0x60, 0x1f, 0x40, 0x6, 0x90, 0xf, 0x99,
+    0xc0, 0x3c, 0x3a, 0x20, 0x1e, 0x25, 0x0, 0x11, 0x80, 0x7d, 0x0, 0x1f, 0x86, 0x0, 0x3e, 0xf0,
+    0x2, 0x0, 0x7c, 0xc2, 0x1, 0xfc, 0xc0, 0x1f, 0x28, 0x3, 0x0, 0x3e, 0xd0, 0xf, 0xf9, 0x0,
+    0x3e, 0x30, 0x70, 0xf, 0x94, 0x3, 0xfe, 0xc0, 0xf, 0x94, 0x8, 0x3, 0xc2, 0x20, 0xf, 0xf8,
+    0x80, 0x3e, 0xe0, 0xf, 0xc6, 0x1, 0xff, 0x98, 0x3, 0xe1, 0x10, 0x7, 0xc2, 0x1, 0xff, 0x84,
+    0x3, 0xe3, 0x30, 0x7, 0xff, 0x44, 0xc0, 0x3f, 0xfa, 0x22, 0x1, 0xf0, 0x80, 0x7f, 0xe1, 0x0,
+    0xf8, 0xc0, 0x3f, 0x18, 0x7, 0xfe, 0x60, 0xf, 0x84, 0x8, 0x3, 0xc2, 0x20, 0xf, 0xf8, 0x80,
+    0x3e, 0xe0, 0x70, 0xf, 0x94, 0x3, 0xfe, 0xc0, 0xf, 0x94, 0x30, 0x3, 0xed, 0x0, 0xff, 0x90,
+    0x3, 0xe3, 0x4, 0x0, 0xf9, 0x84, 0x3, 0xf9, 0x80, 0x3e, 0x50, 0x1, 0x18, 0x7, 0xd0, 0x1,
+    0xf8, 0x60, 0x3, 0xef, 0x0, 0xa4, 0x3, 0xe6, 0x70, 0xf, 0xe, 0x88, 0x7, 0x89, 0x40, 0x25,
+    0x20, 0xf, 0xa2, 0xd0, 0x40, 0x9f, 0xcc, 0x3, 0xe8, 0x0, 0xee, 0x0, 0xfc, 0x97, 0xdf, 0xb0,
+    0x20, 0x1f, 0x1a, 0x80, 0x71, 0xc0, 0x7, 0xff, 0x20, 0x74, 0x3, 0xe7, 0x60, 0xf, 0xfe, 0x3e,
+    0x88, 0x7, 0xe9, 0x70, 0xf, 0xfe, 0x20, 0xe1, 0x80, 0x7f, 0xa2, 0xc8, 0x3, 0xff, 0x82, 0xde,
+    0x60, 0x1f, 0xf9, 0x36, 0x90, 0x3, 0xf0, 0xb6, 0xc8, 0x80, 0x7f, 0xf0, 0xd6, 0xfe, 0xe6, 0x22,
+    0xad, 0xe9, 0x20, 0xf, 0xc0,
+
+    /* U+0031 "1" */
+    0xaf, 0xff, 0xfe, 0xe, 0x80, 0x7f, 0xff, 0xe3, 0x33, 0xc0, 0x1f, 0x88, 0xcf, 0xc0, 0x1f, 0xff,
+    0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xff, 0x0, 0xfc,
+
+    /* U+0032 "2" */
+    0x0, 0xfe, 0x25, 0x67, 0x79, 0x90, 0x40, 0x3f, 0xf8, 0x69, 0x5d, 0xb5, 0x31, 0x14, 0xdf, 0x6b,
+    0x88, 0x7, 0xf9, 0x76, 0xd4, 0x40, 0x3f, 0x8a, 0x39, 0xc0, 0x3e, 0x1b, 0xa2, 0x0, 0xff, 0xe1,
+    0xc6, 0x8, 0x6, 0x2f, 0x40, 0xf, 0xfe, 0x31, 0xe0, 0x4, 0x38, 0x20, 0x1f, 0xfc, 0x82, 0x90,
+    0x5, 0x8, 0x7, 0xff, 0x29, 0x88, 0x29, 0x80, 0x3c, 0x31, 0x9f, 0xf6, 0xc9, 0x0, 0x7e, 0x50,
+    0x19, 0xc2, 0x0, 0xa3, 0x9c, 0xc0, 0x22, 0x6d, 0x30, 0xf, 0xb0, 0x2, 0x3d, 0x80, 0xa7, 0x0,
+    0xfe, 0xf0, 0xf, 0x98, 0x3, 0x9f, 0x94, 0x3, 0xfc, 0x60, 0x1f, 0xfc, 0x21, 0x0, 0xff, 0xe3,
+    0x88, 0x7, 0xff, 0x18, 0x80, 0x3e, 0x60, 0xf, 0xfe, 0x35, 0x0, 0x7d, 0x80, 0x1f, 0xfc, 0x52,
+    0x70, 0xf, 0x9c, 0x3, 0xff, 0x8b, 0xe0, 0x1f, 0x30, 0x80, 0x7f, 0xf0, 0xc7, 0x8, 0x3, 0xc3,
+    0x0, 0x1f, 0xfc, 0x31, 0xc3, 0x0, 0xfa, 0x84, 0x3, 0xff, 0x84, 0x58, 0x40, 0x1f, 0x4a, 0x0,
+    0x7f, 0xf0, 0x8b, 0x8, 0x3, 0xe9, 0x60, 0xf, 0xfe, 0x11, 0xe8, 0x80, 0x7d, 0x2c, 0x1, 0xff,
+    0xc2, 0x4c, 0x0, 0xfd, 0x4c, 0x1, 0xff, 0xc2, 0x5b, 0x0, 0xfd, 0x6a, 0x1, 0xff, 0xc2, 0x7a,
+    0x0, 0xf8, 0x71, 0x0, 0x3f, 0xf8, 0x51, 0x0, 0xf, 0x87, 0xc, 0x3, 0xff, 0x85, 0x2e, 0x1,
+    0xf1, 0x79, 0x0, 0x7f, 0xf0, 0xa9, 0x80, 0x3e, 0x3c, 0x10, 0xf, 0xfe, 0x15, 0xa8, 0x7, 0xc3,
+    0x2a, 0x89, 0xff, 0x80, 0x71, 0x0, 0x3f, 0xd, 0x5d, 0xff, 0xf0, 0x41, 0xcc, 0x3, 0xff, 0xfe,
+    0x1, 0xff, 0xed,
+
+    /* U+0033 "3" */
+    0x0, 0x37, 0xff, 0xff, 0x2c, 0x80, 0x3f, 0xff, 0xe0, 0x1f, 0xff, 0x34, 0x20, 0x9, 0xf3, 0x3f,
+    0xf8, 0x2c, 0x1, 0xf1, 0xd8, 0x6, 0x13, 0x3f, 0xfc, 0xcc, 0x0, 0xf1, 0x68, 0x7, 0xff, 0x15,
+    0x28, 0x3, 0xc3, 0x82, 0x1, 0xff, 0xc4, 0x3b, 0x0, 0xf0, 0xe0, 0x80, 0x7f, 0xf1, 0xb, 0x40,
+    0x3e, 0xd2, 0x0, 0xff, 0xe2, 0xe, 0x8, 0x7, 0xac, 0xc0, 0x3f, 0xf8, 0x83, 0x82, 0x1, 0xea,
+    0x40, 0xf, 0xfe, 0x2e, 0x90, 0x7, 0x87, 0x14, 0x3, 0xff, 0x8a, 0x60, 0x1f, 0xb, 0x57, 0xc8,
+    0x80, 0x7f, 0xf3, 0x9b, 0xd0, 0x3, 0xff, 0x9c, 0x36, 0x80, 0x1f, 0xfc, 0xfb, 0x20, 0xf, 0xf9,
+    0xc, 0xf0, 0x80, 0x7f, 0xa4, 0x3, 0xfe, 0xbc, 0xcd, 0xdc, 0x91, 0x0, 0xf9, 0x8, 0x3, 0xff,
+    0x88, 0x2d, 0xe4, 0x1, 0xf2, 0x0, 0x7f, 0xf1, 0x86, 0x0, 0x3e, 0xf0, 0xf, 0xfe, 0x3b, 0x80,
+    0x7c, 0x60, 0x1f, 0xfc, 0x71, 0x0, 0xff, 0x92, 0x44, 0x3, 0xff, 0x83, 0x60, 0x1f, 0x10, 0x5,
+    0xd, 0xd0, 0x20, 0x1f, 0xe6, 0x70, 0xf, 0xb0, 0x0, 0x86, 0x0, 0x7e, 0xc7, 0x42, 0x0, 0x89,
+    0x6e, 0x40, 0x3e, 0x14, 0x0, 0x40, 0x7, 0x1c, 0x5e, 0xff, 0xdb, 0x48, 0x1, 0xfa, 0x40, 0xa,
+    0x60, 0x1f, 0xfc, 0xa2, 0x70, 0x4, 0x0, 0x7f, 0xf2, 0x87, 0xc0, 0x29, 0x20, 0xf, 0xfe, 0x41,
+    0x61, 0x0, 0x49, 0xb2, 0x60, 0x1f, 0xfc, 0x57, 0xd2, 0x0, 0xf3, 0x66, 0xc2, 0x0, 0x7f, 0xc7,
+    0x1d, 0x0, 0x1f, 0xe2, 0x7b, 0xfd, 0xb9, 0x88, 0xd5, 0x9f, 0x8e, 0x20, 0x1e,
+
+    /* U+0034 "4" */
+    0x0, 0xff, 0xe1, 0x8f, 0x7f, 0xfc, 0x40, 0x1f, 0xfc, 0xad, 0x10, 0xf, 0x51, 0x0, 0x7f, 0xf2,
+    0x64, 0xc0, 0x3c, 0xaa, 0x0, 0xff, 0xe4, 0xab, 0x0, 0x78, 0xa8, 0x3, 0xff, 0x92, 0x54, 0x1,
+    0xf7, 0x80, 0x7f, 0xf2, 0xbc, 0x3, 0xe9, 0x20, 0xf, 0xfe, 0x4c, 0x90, 0x7, 0x95, 0x80, 0x3f,
+    0xf9, 0x2c, 0xc0, 0xf, 0x15, 0x0, 0x7f, 0xf2, 0x4a, 0x40, 0x3e, 0xf0, 0xf, 0xfe, 0x57, 0x80,
+    0x7d, 0x24, 0x1, 0xff, 0xc9, 0xa2, 0x0, 0xf2, 0xb0, 0x7, 0xff, 0x25, 0x94, 0x3, 0xc5, 0x40,
+    0x1f, 0xfc, 0x93, 0x90, 0xf, 0xb8, 0x3, 0xff, 0x92, 0x3a, 0x1, 0xf4, 0x98, 0x0, 0x59, 0xbe,
+    0x10, 0xf, 0xf5, 0x8, 0x7, 0x95, 0x80, 0x23, 0x99, 0xf8, 0xc0, 0x3f, 0x9d, 0x0, 0x3c, 0x56,
+    0x1, 0xff, 0xc9, 0x38, 0x0, 0xfb, 0x84, 0x3, 0xff, 0x90, 0x3a, 0x1, 0xf4, 0x18, 0x7, 0xff,
+    0x26, 0x84, 0x3, 0xc8, 0xe0, 0x1f, 0xfc, 0x98, 0x40, 0xf, 0xb9, 0x13, 0xf0, 0x7, 0xc8, 0x9c,
+    0x48, 0xe0, 0x1f, 0xaa, 0xef, 0xe9, 0x0, 0xfa, 0x6e, 0xf4, 0x60, 0x7, 0xff, 0xfc, 0x3, 0xff,
+    0xfe, 0x1, 0xfd, 0x1f, 0xff, 0xfc, 0x59, 0x0, 0xfb, 0x7f, 0xf5, 0x0, 0x7f, 0xff, 0xc0, 0x3f,
+    0xff, 0xe0, 0x1f, 0xfd, 0xe0,
+
+    /* U+0035 "5" */
+    0x0, 0xcb, 0xff, 0xff, 0xc8, 0x30, 0xf, 0x10, 0x7, 0xff, 0x3f, 0xc0, 0x3f, 0xf9, 0xe4, 0x1,
+    0xff, 0xcf, 0x10, 0xf, 0xfe, 0x7b, 0x0, 0x7f, 0xf3, 0xcc, 0x3, 0xd5, 0x99, 0xff, 0xc1, 0x30,
+    0xf, 0x8, 0x7, 0x90, 0xcf, 0xff, 0x82, 0x1, 0xe1, 0x0, 0xf8, 0x40, 0x3f, 0xf8, 0xe4, 0x1,
+    0xe1, 0x0, 0xff, 0xe4, 0x38, 0x7, 0x88, 0x3, 0xff, 0x90, 0x40, 0x1e, 0x70, 0xf, 0xfe, 0x40,
+    0x80, 0x79, 0x3f, 0xf7, 0x6d, 0xc2, 0x0, 0x7f, 0xdc, 0x1, 0xff, 0x9, 0x23, 0xdf, 0xc8, 0x80,
+    0x7e, 0x30, 0xf, 0xfe, 0x2b, 0x73, 0x80, 0x7c, 0xc0, 0x1f, 0xfc, 0x78, 0x90, 0xf, 0x8, 0x7,
+    0xff, 0x21, 0x9c, 0x3, 0x88, 0x3, 0xff, 0x93, 0x4, 0x1, 0xb3, 0x3f, 0xae, 0xd2, 0xe4, 0x1,
+    0xfd, 0x60, 0x18, 0xcf, 0xf9, 0x10, 0xd1, 0xb6, 0x20, 0x1f, 0x38, 0x7, 0xff, 0x19, 0x34, 0x3,
+    0xe1, 0x10, 0x7, 0xff, 0x18, 0xcc, 0x1, 0xf1, 0x0, 0x7f, 0xf1, 0xd8, 0x3, 0xe7, 0x0, 0xff,
+    0xe3, 0x88, 0x7, 0xce, 0x1, 0x53, 0x0, 0x7f, 0xf0, 0x45, 0x0, 0x3e, 0x30, 0x1, 0xac, 0xeb,
+    0x0, 0x7f, 0x87, 0x40, 0x3e, 0x30, 0xb, 0xc0, 0x5, 0x3f, 0x4c, 0x62, 0x0, 0x13, 0x8f, 0x30,
+    0xf, 0xac, 0x0, 0x86, 0x1, 0xcb, 0x39, 0xdf, 0xee, 0xc7, 0x10, 0xf, 0x85, 0xc0, 0x10, 0x1,
+    0xff, 0xcb, 0xb0, 0x2, 0x18, 0x7, 0xff, 0x29, 0xd4, 0x0, 0x8c, 0x1, 0xff, 0xc9, 0x88, 0x0,
+    0x69, 0xd6, 0x0, 0xff, 0xe2, 0x9e, 0x38, 0x7, 0x8a, 0x7e, 0xd8, 0x80, 0x3f, 0xc2, 0xb9, 0x83,
+    0x0, 0xff, 0x24, 0xef, 0xe5, 0x4c, 0x45, 0x37, 0xbd, 0x46, 0x1, 0xf0,
+
+    /* U+0036 "6" */
+    0x0, 0xff, 0xe1, 0x1a, 0xbb, 0xe5, 0x31, 0x0, 0xff, 0xe2, 0xb, 0xe7, 0xe5, 0x44, 0x6a, 0xce,
+    0xd8, 0x20, 0xf, 0xf8, 0xab, 0xa0, 0xc0, 0x3f, 0xc4, 0xfb, 0x62, 0x1, 0xf9, 0xb5, 0x40, 0x3f,
+    0xf8, 0x88, 0x1, 0xfa, 0xa4, 0x3, 0xff, 0x8d, 0x2, 0x1, 0xeb, 0x50, 0xf, 0xfe, 0x30, 0xb8,
+    0x7, 0xa5, 0x0, 0x3f, 0xc2, 0x66, 0x20, 0xe, 0x90, 0xf, 0x23, 0x0, 0x7e, 0x3a, 0xee, 0x66,
+    0x37, 0xf6, 0x4c, 0x5c, 0x3, 0xd2, 0x1, 0xfa, 0xb1, 0x44, 0x3, 0x89, 0xb3, 0xc0, 0x3c, 0xc4,
+    0x1, 0xf6, 0xa8, 0x7, 0xfc, 0x20, 0x1e, 0xb0, 0xf, 0xa8, 0x80, 0x3f, 0xf8, 0xc4, 0x40, 0xf,
+    0x1a, 0x80, 0x7f, 0xf1, 0xd4, 0x3, 0xea, 0x0, 0xff, 0xe4, 0x60, 0x7, 0xce, 0x0, 0x49, 0xce,
+    0xff, 0x76, 0x4a, 0x0, 0x7e, 0x60, 0xf, 0x8, 0x97, 0xad, 0x8c, 0x40, 0x2, 0x6d, 0x7c, 0xc0,
+    0x1e, 0x20, 0xf, 0x1d, 0x50, 0x40, 0x3f, 0xc3, 0x36, 0x20, 0x10, 0x80, 0x7c, 0x4a, 0x1, 0xff,
+    0xc2, 0x4c, 0x10, 0xf, 0xfe, 0x79, 0x68, 0x7, 0xff, 0x10, 0x8c, 0x80, 0x3f, 0x8d, 0x80, 0x3f,
+    0xf1, 0x57, 0xee, 0x6f, 0x40, 0x7, 0xe8, 0x1, 0x0, 0xfe, 0x3c, 0x50, 0xc, 0x2f, 0xa0, 0x1f,
+    0x9, 0x80, 0x80, 0x7e, 0xe1, 0x0, 0xf8, 0xa4, 0x3, 0xe4, 0x2, 0x0, 0xf9, 0x8, 0x3, 0xf9,
+    0xc0, 0x3e, 0xe0, 0x50, 0xf, 0x88, 0x3, 0xfc, 0x22, 0x0, 0xfd, 0x80, 0x1f, 0x18, 0x7, 0xfc,
+    0x20, 0x1e, 0x10, 0x50, 0xf, 0x9c, 0x3, 0xfc, 0x60, 0x1f, 0x70, 0x1, 0x80, 0x3c, 0x4c, 0x1,
+    0xfd, 0x0, 0x1f, 0x28, 0x2, 0xc0, 0x3e, 0x96, 0x0, 0xfa, 0x50, 0x3, 0xc4, 0x60, 0x2, 0x70,
+    0xf, 0xa7, 0x5d, 0x51, 0x63, 0x98, 0x3, 0xe8, 0x0, 0xd0, 0x60, 0x1f, 0x14, 0x55, 0xd3, 0x88,
+    0x7, 0xc8, 0xa0, 0x1d, 0xa6, 0x1, 0xff, 0xc7, 0x2a, 0x0, 0xf0, 0xea, 0x0, 0x7f, 0xf1, 0x4f,
+    0x4, 0x3, 0xe1, 0xba, 0x10, 0xf, 0xfe, 0x13, 0xe0, 0x80, 0x7f, 0x97, 0xa9, 0x0, 0x3f, 0x8a,
+    0x3a, 0x0, 0x3f, 0xf8, 0x4b, 0x7f, 0x95, 0x11, 0x4d, 0xf6, 0xb8, 0x80, 0x78,
+
+    /* U+0037 "7" */
+    0xcf, 0xff, 0xfe, 0x71, 0x0, 0x7f, 0xff, 0xc0, 0x3f, 0xfe, 0x62, 0x40, 0x1f, 0x4d, 0xdf, 0xf8,
+    0x40, 0x3e, 0x60, 0xf, 0xc8, 0x9f, 0xe0, 0x10, 0xf, 0xa4, 0x3, 0xff, 0x8d, 0xe0, 0x1f, 0x30,
+    0x80, 0x7f, 0xf1, 0x49, 0x0, 0x3e, 0xb0, 0xf, 0xfe, 0x35, 0x80, 0x7c, 0x84, 0x0, 0xb5, 0x5f,
+    0x18, 0x7, 0xc2, 0xc0, 0x1f, 0x78, 0x4, 0xf5, 0x5e, 0x10, 0xf, 0xa4, 0x3, 0xe2, 0x40, 0xf,
+    0xfe, 0x33, 0x0, 0x7d, 0x60, 0x1f, 0xfc, 0x66, 0x10, 0xf, 0xb, 0x0, 0x7f, 0xf1, 0xac, 0x3,
+    0xe6, 0x0, 0xff, 0xe3, 0x29, 0x0, 0x7d, 0x20, 0x1f, 0xfc, 0x69, 0x0, 0xf9, 0x84, 0x3, 0xff,
+    0x8a, 0x66, 0x0, 0xfa, 0xc0, 0x3f, 0xf8, 0xd2, 0x1, 0xf2, 0x10, 0x7, 0xff, 0x14, 0x94, 0x3,
+    0xef, 0x0, 0xff, 0xe3, 0x58, 0x7, 0xc4, 0x80, 0x1f, 0xfc, 0x51, 0x60, 0xf, 0xac, 0x3, 0xff,
+    0x8c, 0xc0, 0x1f, 0xb, 0x0, 0x7f, 0xf1, 0xa4, 0x3, 0xe9, 0x0, 0xff, 0xe3, 0x28, 0x80, 0x7c,
+    0xc0, 0x1f, 0xfc, 0x68, 0x0, 0xf9, 0x84, 0x3, 0xff, 0x8a, 0x84, 0x1, 0xf5, 0x80, 0x7f, 0xf1,
+    0xbc, 0x3, 0xe4, 0x20, 0xf, 0xfe, 0x29, 0x20, 0x7, 0xde, 0x1, 0xff, 0xc6, 0x80, 0xf, 0x89,
+    0x0, 0x3f, 0xf8, 0xa2, 0xa0, 0x1f, 0x40, 0x7, 0xff, 0x1a, 0x40, 0x3e, 0x15, 0x0, 0xff, 0xc0,
+
+    /* U+0038 "8" */
+    0x0, 0xff, 0xa, 0x33, 0xbc, 0xca, 0x60, 0x1f, 0xfc, 0x51, 0x7d, 0xeb, 0x98, 0x8a, 0x6b, 0x3e,
+    0xd4, 0x3, 0xff, 0xc, 0xf4, 0x10, 0x7, 0xf9, 0x2b, 0x98, 0x3, 0xf8, 0xfd, 0x80, 0x3f, 0xf8,
+    0x63, 0x34, 0x1, 0xf1, 0x60, 0x80, 0x7f, 0xf1, 0x96, 0xc0, 0x3d, 0xe0, 0x1f, 0xfc, 0x94, 0x80,
+    0xc, 0xc4, 0x1, 0xf0, 0xbd, 0xee, 0x52, 0x80, 0x7e, 0x71, 0x0, 0xa8, 0x3, 0xe4, 0xe8, 0x42,
+    0x35, 0xac, 0x10, 0xf, 0x98, 0x2, 0x30, 0xf, 0xa8, 0x3, 0xe3, 0xb0, 0xf, 0xb4, 0x0, 0x20,
+    0x1f, 0x20, 0x80, 0x7e, 0x50, 0xf, 0x98, 0x3, 0xfc, 0x20, 0x1f, 0xfc, 0x81, 0x0, 0xf9, 0x80,
+    0x3f, 0x84, 0x3, 0xe6, 0x0, 0x90, 0x3, 0xc6, 0x80, 0x1f, 0xa0, 0x3, 0xec, 0x0, 0xb8, 0x3,
+    0xeb, 0x60, 0xe, 0x19, 0x60, 0xf, 0x9c, 0x2, 0x54, 0x0, 0xfa, 0x7a, 0xe6, 0xb3, 0x98, 0x3,
+    0xe9, 0x10, 0xd, 0x46, 0x1, 0xf0, 0xa3, 0x29, 0x80, 0x7e, 0x76, 0x0, 0xe1, 0xc4, 0x0, 0xff,
+    0xe3, 0x4c, 0x0, 0x7d, 0x8, 0x1, 0xff, 0xc6, 0x84, 0x0, 0xf5, 0xb8, 0x7, 0xff, 0x1c, 0x6d,
+    0xc0, 0x35, 0xa0, 0x7, 0xe1, 0x35, 0x43, 0x0, 0xfe, 0x86, 0x0, 0x2a, 0x0, 0x7c, 0x99, 0xd9,
+    0x57, 0x9f, 0x42, 0x1, 0xf4, 0x88, 0x48, 0x7, 0xcf, 0x66, 0x1, 0xe5, 0xf2, 0x0, 0xf9, 0x84,
+    0xc0, 0x3c, 0x30, 0x1, 0xfc, 0x3c, 0x1, 0xf5, 0xa8, 0x7, 0xce, 0x1, 0xff, 0x18, 0x7, 0xc6,
+    0x1, 0xff, 0xc9, 0x10, 0xf, 0x9c, 0x3, 0xe2, 0x0, 0xff, 0x84, 0x40, 0x1e, 0x12, 0x0, 0xf9,
+    0xc, 0x3, 0xfd, 0x20, 0x1f, 0x10, 0x98, 0x7, 0xda, 0x60, 0x1f, 0x9d, 0xc0, 0x1f, 0x58, 0x48,
+    0x7, 0xc3, 0x96, 0xc8, 0x46, 0x91, 0xb0, 0x1, 0xf9, 0x81, 0x50, 0x3, 0xf2, 0x4d, 0xee, 0x5b,
+    0x90, 0x7, 0xe9, 0x10, 0x5, 0x18, 0x7, 0xff, 0x29, 0x98, 0x1, 0xe, 0x20, 0x7, 0xff, 0x22,
+    0x24, 0x3, 0xd7, 0x44, 0x1, 0xff, 0xc4, 0x4d, 0x70, 0xf, 0xcb, 0xb6, 0xa2, 0x1, 0xfe, 0x27,
+    0xdb, 0x20, 0xf, 0xf9, 0x2b, 0xb6, 0xe6, 0x23, 0x56, 0x7e, 0xc1, 0x0, 0x78,
+
+    /* U+0039 "9" */
+    0x0, 0xff, 0x1a, 0xbb, 0xcc, 0x84, 0x1, 0xff, 0xc6, 0x4a, 0xfc, 0xa8, 0x8a, 0x6f, 0x7a, 0x4c,
+    0x3, 0xff, 0x82, 0x59, 0x6a, 0x1, 0xfc, 0x2d, 0x96, 0x40, 0x1f, 0xe6, 0xd3, 0x0, 0xff, 0xe1,
+    0x26, 0xb0, 0x7, 0xe6, 0x90, 0xf, 0xfe, 0x34, 0xb8, 0x7, 0x92, 0x40, 0x3f, 0xf9, 0x10, 0xa0,
+    0x1d, 0x20, 0x1f, 0x92, 0x2e, 0xd4, 0xc2, 0x1, 0xf5, 0x10, 0x4, 0xa4, 0x1, 0xf5, 0xd9, 0xd1,
+    0xb, 0x3e, 0xa0, 0x1f, 0x48, 0x5, 0xe0, 0x1f, 0x5a, 0x0, 0x78, 0x68, 0xc0, 0x3c, 0x84, 0x0,
+    0x40, 0xf, 0x1a, 0x0, 0x7f, 0x40, 0x7, 0xd6, 0x0, 0x10, 0xf, 0x28, 0x7, 0xf9, 0x0, 0x3e,
+    0x70, 0xf, 0xfe, 0x80, 0x90, 0x7, 0xe2, 0x0, 0xff, 0x18, 0x7, 0xe7, 0x2, 0x0, 0xf2, 0x10,
+    0x7, 0xf4, 0x80, 0x7e, 0xd0, 0x40, 0xf, 0xbc, 0x40, 0x3e, 0x75, 0x0, 0xfc, 0x21, 0xa0, 0x1f,
+    0x17, 0xb9, 0x80, 0x5, 0x72, 0x0, 0x3f, 0x8c, 0x11, 0x0, 0x1f, 0xc, 0x67, 0xfb, 0xa8, 0xc0,
+    0x3f, 0xc2, 0x0, 0xa1, 0x0, 0xff, 0xe6, 0x8, 0x0, 0x74, 0x40, 0x3f, 0xf9, 0xe7, 0x86, 0x1,
+    0xff, 0xc1, 0x2a, 0x0, 0xf8, 0x80, 0x31, 0x64, 0x90, 0x7, 0xf0, 0xc6, 0x88, 0x7, 0xdc, 0x1,
+    0xe6, 0xdd, 0x4b, 0x22, 0x4b, 0x19, 0xce, 0x18, 0x1, 0xf1, 0x0, 0x7e, 0x26, 0x9b, 0xba, 0x9c,
+    0xc0, 0x24, 0x0, 0xf9, 0x0, 0x3f, 0xf8, 0xe6, 0x60, 0xf, 0x18, 0x7, 0xff, 0x23, 0xc0, 0x3e,
+    0xa0, 0xf, 0xfe, 0x3c, 0x98, 0x7, 0x85, 0x80, 0x3c, 0x40, 0x1f, 0xe1, 0xa6, 0x0, 0xfa, 0x40,
+    0x3c, 0xbb, 0x6a, 0x20, 0x1c, 0x71, 0xea, 0x1, 0xf1, 0x38, 0x7, 0xa0, 0x12, 0xbb, 0x9b, 0x9b,
+    0xf8, 0xe2, 0x1, 0xfb, 0xc0, 0x3c, 0xa4, 0x1, 0x84, 0x8c, 0x80, 0x3f, 0xeb, 0x20, 0xf, 0x40,
+    0x7, 0xff, 0x1e, 0xd0, 0x3, 0xcc, 0x40, 0x1f, 0xfc, 0x52, 0xd4, 0x0, 0xf8, 0x88, 0x1, 0xff,
+    0xc3, 0x19, 0xd2, 0x0, 0xfc, 0x9b, 0x4a, 0x20, 0x1f, 0xc2, 0xb5, 0xcc, 0x1, 0xff, 0x96, 0xbb,
+    0x6e, 0x62, 0x29, 0xbd, 0xea, 0x50, 0xf, 0xf0,
+
+    /* U+0066 "f" */
+    0x0, 0xff, 0x2c, 0xde, 0xed, 0x70, 0x60, 0x1f, 0xe7, 0xea, 0x64, 0x22, 0x91, 0xf3, 0x0, 0x1f,
+    0xae, 0x4, 0x3, 0xf9, 0xc0, 0x3e, 0xb4, 0x0, 0xff, 0xb8, 0x3, 0xca, 0x80, 0x1f, 0xf9, 0x40,
+    0x3d, 0x0, 0x1f, 0xf9, 0x80, 0x3c, 0x64, 0x1, 0xe1, 0xaf, 0xf6, 0x35, 0x0, 0x79, 0x40, 0x3e,
+    0xc5, 0x0, 0x1c, 0x98, 0x7, 0xbc, 0x3, 0xc6, 0x40, 0x1f, 0xfc, 0x76, 0x0, 0xff, 0xe0, 0x98,
+    0x7, 0xff, 0x12, 0x7f, 0xe5, 0x0, 0xf2, 0xff, 0xf9, 0x0, 0x3f, 0xff, 0xe0, 0x1f, 0xf7, 0xa2,
+    0x42, 0x1, 0xf2, 0x27, 0x9c, 0x0, 0xd7, 0x72, 0x0, 0x78, 0xae, 0xfc, 0x60, 0x1f, 0xff, 0xf0,
+    0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xff, 0x0, 0xe0,
+
+    /* U+0069 "i" */
+    0x0, 0xc6, 0x84, 0x1, 0xd3, 0xf9, 0x7b, 0xa3, 0x0, 0x53, 0x0, 0x62, 0xc3, 0x32, 0x80, 0x7d,
+    0x2a, 0x1, 0xf9, 0xc0, 0x3f, 0x85, 0x0, 0x3f, 0x59, 0x40, 0x7, 0x8d, 0xc1, 0xec, 0xc0, 0x4,
+    0xf8, 0x1, 0x26, 0x7f, 0xb6, 0x0, 0x3f, 0xf9, 0x71, 0xff, 0xf0, 0x7, 0xff, 0xfc, 0x3, 0xff,
+    0xfe, 0x1, 0xff, 0xff, 0x0, 0xff, 0xe7, 0x0,
+
+    /* U+006B "k" */
+    0x35, 0x5f, 0x80, 0x3f, 0xf9, 0x37, 0x55, 0xf0, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe, 0x1, 0xff,
+    0xff, 0x0, 0xff, 0xf1, 0x57, 0xff, 0xe5, 0x0, 0xff, 0xe3, 0x52, 0x80, 0x7d, 0x4a, 0x1, 0xff,
+    0xc5, 0xb5, 0x0, 0xfa, 0x54, 0x3, 0xff, 0x8b, 0x68, 0x1, 0xf4, 0xb0, 0x7, 0xff, 0x17, 0x10,
+    0x3, 0xe9, 0x60, 0xf, 0xfe, 0x20, 0xe1, 0x80, 0x7d, 0xc, 0x1, 0xff, 0xc4, 0x1c, 0x30, 0xf,
+    0xa1, 0xc0, 0x3f, 0xf8, 0x83, 0x84, 0x1, 0xf4, 0x38, 0x7, 0xff, 0x10, 0xbc, 0x80, 0x3e, 0x77,
+    0x0, 0x7f, 0xf1, 0xb, 0x4, 0x3, 0xe7, 0x80, 0xf, 0xfe, 0x2e, 0x8, 0x7, 0xcf, 0x0, 0x1f,
+    0xfc, 0x61, 0x0, 0xfd, 0xe0, 0x1f, 0xfd, 0x8, 0x30, 0xf, 0xfe, 0x86, 0x88, 0x7, 0xff, 0x3c,
+    0x74, 0x3, 0xff, 0xa0, 0x72, 0x1, 0xff, 0xc6, 0x3e, 0x20, 0xf, 0x99, 0x40, 0x3f, 0xf8, 0x87,
+    0xa3, 0xe0, 0x1f, 0xa8, 0x80, 0x3f, 0xf8, 0x47, 0x82, 0x5, 0x60, 0x1f, 0xbc, 0x40, 0x3f, 0xf8,
+    0x38, 0x1, 0x92, 0x0, 0x3e, 0x2a, 0x0, 0xff, 0xe3, 0xba, 0x0, 0x7c, 0x8e, 0x1, 0xff, 0xc7,
+    0xb2, 0x0, 0xfa, 0x10, 0x3, 0xff, 0x8f, 0xe0, 0x1f, 0xa8, 0x40, 0x3f, 0xf8, 0xc5, 0x60, 0x1f,
+    0xe, 0x80, 0x7f, 0xf1, 0xd2, 0x0, 0x3e, 0x39, 0x0, 0xff, 0xe3, 0xba, 0x0, 0x7c, 0xcc,
+
+    /* U+006D "m" */
+    0x8f, 0xff, 0x48, 0x4, 0x93, 0xbf, 0xf6, 0xd3, 0x0, 0x7e, 0x16, 0xad, 0xff, 0xb6, 0x98, 0x3,
+    0xff, 0x88, 0x9b, 0x6c, 0x40, 0x11, 0x2c, 0xfb, 0x80, 0x74, 0x74, 0xa9, 0x0, 0x44, 0xb3, 0xee,
+    0x1, 0xff, 0xc1, 0x9b, 0x20, 0xf, 0xf4, 0x60, 0x0, 0xf5, 0xc0, 0x3f, 0xe8, 0xc0, 0xf, 0xf9,
+    0x98, 0x1, 0xff, 0xc1, 0x3b, 0x3c, 0x20, 0xf, 0xfe, 0x9, 0xe0, 0x7, 0xff, 0x39, 0x30, 0x3,
+    0xff, 0x88, 0x6e, 0x1, 0xff, 0xe0, 0x80, 0xf, 0xfe, 0x9, 0xbc, 0x41, 0x0, 0x3f, 0xf8, 0x24,
+    0xf1, 0x4, 0x0, 0xfe, 0x60, 0xf, 0xf0, 0xde, 0x43, 0xba, 0xec, 0x1, 0xff, 0x56, 0xc3, 0xba,
+    0xf0, 0x40, 0x3e, 0xc0, 0xf, 0xf6, 0xa0, 0x7, 0x25, 0x0, 0x7f, 0x5a, 0x80, 0x71, 0xd0, 0x7,
+    0xc8, 0x1, 0xfc, 0xa6, 0x1, 0xf2, 0x88, 0x7, 0xca, 0x80, 0x1f, 0x21, 0x0, 0x78, 0x40, 0x3f,
+    0xb8, 0x3, 0xf9, 0x0, 0x3e, 0xf0, 0xf, 0xe4, 0x0, 0xf8, 0x40, 0x3f, 0x28, 0x7, 0xf1, 0x0,
+    0x7c, 0x80, 0x1f, 0xdc, 0x1, 0xff, 0xc4, 0x10, 0xf, 0xfe, 0x28, 0x80, 0x7f, 0x8, 0x7, 0xff,
+    0xfc, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xff, 0x0, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff,
+    0xe0, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0xc0,
+
+    /* U+0074 "t" */
+    0x0, 0xcb, 0x11, 0xe6, 0x0, 0xff, 0xe0, 0xfb, 0xbf, 0xac, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xc6,
+    0x9f, 0xf9, 0x40, 0x3c, 0x5f, 0xfe, 0x40, 0xf, 0xff, 0xf8, 0x7, 0xfd, 0xc8, 0x90, 0x80, 0x7c,
+    0x89, 0xe7, 0x0, 0x3d, 0xdc, 0x80, 0x1e, 0x2b, 0xbf, 0x18, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe,
+    0x1, 0xff, 0xf6, 0x30, 0xf, 0x18, 0x7, 0xff, 0x4, 0x40, 0x3c, 0x26, 0x1, 0xff, 0xb4, 0x3,
+    0xed, 0x40, 0x0, 0xc1, 0x80, 0x79, 0x0, 0x3e, 0x1b, 0xfe, 0xe3, 0xd0, 0x7, 0x85, 0x0, 0x3f,
+    0x84, 0x0, 0xc0, 0x1f, 0x48, 0x7, 0xff, 0x5, 0x80, 0x3c, 0x56, 0x1, 0xff, 0xa8, 0x3, 0xe4,
+    0xc3, 0x0, 0xff, 0x38, 0x7, 0xe3, 0xcb, 0x63, 0x10, 0x0, 0x9b, 0xe5, 0x80, 0x0,
+
+};
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 217, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 201, .box_w = 10, .box_h = 17, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 65, .adv_w = 201, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 103, .adv_w = 521, .box_w = 30, .box_h = 35, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 396, .adv_w = 301, .box_w = 15, .box_h = 33, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 427, .adv_w = 453, .box_w = 27, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 654, .adv_w = 455, .box_w = 28, .box_h = 34, .ofs_x = -1, .ofs_y = -1},
+    {.bitmap_index = 875, .adv_w = 529, .box_w = 32, .box_h = 33, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1056, .adv_w = 457, .box_w = 28, .box_h = 34, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1292, .adv_w = 489, .box_w = 29, .box_h = 35, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 1593, .adv_w = 476, .box_w = 28, .box_h = 33, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1785, .adv_w = 507, .box_w = 29, .box_h = 35, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 2086, .adv_w = 489, .box_w = 29, .box_h = 35, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 2382, .adv_w = 297, .box_w = 21, .box_h = 36, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2492, .adv_w = 231, .box_w = 10, .box_h = 38, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2548, .adv_w = 503, .box_w = 29, .box_h = 36, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 2739, .adv_w = 806, .box_w = 45, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 2922, .adv_w = 334, .box_w = 21, .box_h = 32, .ofs_x = 0, .ofs_y = 0},
+};
+
+static const uint16_t unicode_list_0[] = {
+    0x0, 0xc, 0xe,
+};
+
+static const uint16_t unicode_list_2[] = {
+    0x0, 0x3, 0x5, 0x7, 0xe,
+};
+
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {
+        .range_start = 32, .range_length = 15, .glyph_id_start = 1,
+        .unicode_list = unicode_list_0, .glyph_id_ofs_list = NULL, .list_length = 3, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    },
+    {
+        .range_start = 48, .range_length = 10, .glyph_id_start = 4,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 102, .range_length = 15, .glyph_id_start = 14,
+        .unicode_list = unicode_list_2, .glyph_id_ofs_list = NULL, .list_length = 5, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    }
+};
+
+#if LVGL_VERSION_MAJOR == 8
+static lv_font_fmt_txt_glyph_cache_t cache;
+#endif
+
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = NULL,
+    .kern_scale = 0,
+    .cmap_num = 3,
+    .bpp = 4,
+    .kern_classes = 0,
+    .bitmap_format = 1,
+#if LVGL_VERSION_MAJOR == 8
+    .cache = &cache
+#endif
+};
+
+const lv_font_t montserrat_number_bold_48 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,
+    .line_height = 49,
+    .base_line = 9,
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -5,
+    .underline_thickness = 2,
+    .dsc = &font_dsc,
+    .fallback = NULL,
+    .user_data = NULL,
+};
+
+lv_font_t* get_montserrat_number_bold_48()
+{
+    return (lv_font_t*)&montserrat_number_bold_48;
+}
+
+#endif /*#if MONTSERRAT_NUMBER_BOLD_48*/
@@ -29,6 +29,10 @@
 /*Color depth: 1 (I1), 8 (L8), 16 (RGB565), 24 (RGB888), 32 (XRGB8888)*/
 #define LV_COLOR_DEPTH 16
 
+/*Swap the 2 bytes of RGB565 color: LVGL renders in the panel's byte order so the
+ *flush can DMA the draw buffer as is (src/bg.c is generated for this setting)*/
+#define LV_COLOR_16_SWAP 1
+
 /*=========================
    STDLIB WRAPPER SETTINGS
  *=========================*/
@@ -537,7 +541,8 @@
 #define LV_FONT_FMT_TXT_LARGE 0
 
 /*Enables/disables support for compressed fonts.*/
-#define LV_USE_FONT_COMPRESSED 0
+/*Bật: các font trong include/fonts/subset/ đánh dấu nén được nén RLE (tools/font_subset.py)*/
+#define LV_USE_FONT_COMPRESSED 1
 
 /*Enable drawing placeholders when glyph dsc is not found*/
 #define LV_USE_FONT_PLACEHOLDER 1
@@ -0,0 +1,122 @@
+#include "BinLog.h"
+
+#define BINLOG_DRAIN_PERIOD_MS 20
+#define BINLOG_TASK_STACK 3072
+
+static const char *const kLogFormats[] = {
+#define BINLOG_FORMAT_ENTRY(id, fmt) fmt,
+	BINLOG_MESSAGES(BINLOG_FORMAT_ENTRY)
+#undef BINLOG_FORMAT_ENTRY
+};
+
+static const char kLevelTags[] = {'-', 'E', 'W', 'I', 'D'};
+
+static BinLogRecord _ring[BINLOG_RING_SIZE];
+static uint32_t _head = 0; // vị trí ghi tiếp theo
+static uint32_t _tail = 0; // vị trí đọc tiếp theo
+static uint32_t _dropped = 0;
+static portMUX_TYPE _lock = portMUX_INITIALIZER_UNLOCKED;
+
+void BinLog::begin()
+{
+	static bool started = false;
+	if (started)
+	{
+		return;
+	}
+	started = true;
+	xTaskCreate(drainTask, "binlog", BINLOG_TASK_STACK, nullptr, tskIDLE_PRIORITY + 1, nullptr);
+}
+
+void BinLog::record(uint8_t level, LogId id, const uint32_t *args, uint8_t argc)
+{
+	uint32_t now = millis();
+
+	portENTER_CRITICAL(&_lock);
+	if (_head - _tail >= BINLOG_RING_SIZE)
+	{
+		// Ring đầy: bỏ bản ghi mới, giữ nguyên thứ tự các bản ghi cũ
+		_dropped++;
+		portEXIT_CRITICAL(&_lock);
+		return;
+	}
+	BinLogRecord &rec = _ring[_head % BINLOG_RING_SIZE];
+	rec.timestamp = now;
+	rec.id = (uint16_t)id;
+	rec.level = level;
+	rec.argc = argc;
+	for (uint8_t i = 0; i < BINLOG_MAX_ARGS; i++)
+	{
+		rec.args[i] = i < argc ? args[i] : 0;
+	}
+	_head++;
+	portEXIT_CRITICAL(&_lock);
+}
+
+size_t BinLog::drain()
+{
+	size_t count = 0;
+	BinLogRecord rec;
+
+	while (true)
+	{
+		portENTER_CRITICAL(&_lock);
+		if (_tail == _head)
+		{
+			portEXIT_CRITICAL(&_lock);
+			break;
+		}
+		rec = _ring[_tail % BINLOG_RING_SIZE];
+		_tail++;
+		portEXIT_CRITICAL(&_lock);
+
+		emit(rec);
+		count++;
+	}
+	return count;
+}
+
+uint32_t BinLog::dropped()
+{
+	return _dropped;
+}
+
+const char *BinLog::format(uint16_t id)
+{
+	return id < (uint16_t)LogId::COUNT ? kLogFormats[id] : "unknown log id %u";
+}
+
+void BinLog::emit(const BinLogRecord &rec)
+{
+#if BINLOG_TEXT_OUTPUT
+	char tag = rec.level < sizeof(kLevelTags) ? kLevelTags[rec.level] : '?';
+	Serial.printf("[%lu][%c] ", (unsigned long)rec.timestamp, tag);
+	Serial.printf(format(rec.id), rec.args[0], rec.args[1], rec.args[2], rec.args[3]);
+	Serial.println();
+#else
+	// Frame nhị phân: 2 byte magic + bản ghi thô, giải mã bằng tools/binlog_decode.py
+	uint8_t magic[2] = {BINLOG_FRAME_MAGIC0, BINLOG_FRAME_MAGIC1};
+	Serial.write(magic, sizeof(magic));
+	Serial.write((const uint8_t *)&rec, sizeof(rec));
+#endif
+}
+
+void BinLog::drainTask(void *param)
+{
+	uint32_t reportedDrops = 0;
+	(void)reportedDrops;
+	for (;;)
+	{
+		drain();
+
+#if BINLOG_TEXT_OUTPUT
+		uint32_t drops = _dropped;
+		if (drops != reportedDrops)
+		{
+			Serial.printf("[binlog] %lu records dropped\n", (unsigned long)(drops - reportedDrops));
+			reportedDrops = drops;
+		}
+#endif
+		vTaskDelay(pdMS_TO_TICKS(BINLOG_DRAIN_PERIOD_MS));
+	}
+}
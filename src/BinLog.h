@@ -0,0 +1,115 @@
+#ifndef BIN_LOG_H
+#define BIN_LOG_H
+
+#include <Arduino.h>
+#include <type_traits>
+#include "LogMessages.h"
+
+// Mức log, chọn lúc biên dịch bằng -DBINLOG_LEVEL=...
+// Các macro của mức bị tắt không sinh ra mã nào.
+#define BINLOG_LEVEL_NONE 0
+#define BINLOG_LEVEL_ERROR 1
+#define BINLOG_LEVEL_WARN 2
+#define BINLOG_LEVEL_INFO 3
+#define BINLOG_LEVEL_DEBUG 4
+
+#ifndef BINLOG_LEVEL
+#define BINLOG_LEVEL BINLOG_LEVEL_INFO
+#endif
+
+#ifndef BINLOG_RING_SIZE
+#define BINLOG_RING_SIZE 64 // số bản ghi trong ring RAM
+#endif
+
+// 1: task xả log in văn bản ra Serial; 0: ghi frame nhị phân cho tools/binlog_decode.py
+#ifndef BINLOG_TEXT_OUTPUT
+#define BINLOG_TEXT_OUTPUT 1
+#endif
+
+#define BINLOG_MAX_ARGS 4
+#define BINLOG_FRAME_MAGIC0 0xB1
+#define BINLOG_FRAME_MAGIC1 0x0C
+
+enum class LogId : uint16_t
+{
+#define BINLOG_ENUM_ENTRY(id, fmt) id,
+	BINLOG_MESSAGES(BINLOG_ENUM_ENTRY)
+#undef BINLOG_ENUM_ENTRY
+	COUNT
+};
+
+// Bản ghi nhị phân cố định 24 byte
+struct BinLogRecord
+{
+	uint32_t timestamp; // millis()
+	uint16_t id;
+	uint8_t level;
+	uint8_t argc;
+	uint32_t args[BINLOG_MAX_ARGS];
+};
+
+/**
+ * Log nhị phân hoãn xử lý.
+ *
+ * Các đường nóng (phân tích gói BLE, vẽ UI) chỉ chép vài số nguyên vào ring
+ * RAM; việc định dạng và ghi USB-CDC do một task ưu tiên thấp đảm nhận.
+ */
+class BinLog
+{
+public:
+	// Tạo task xả log (gọi một lần trong setup())
+	static void begin();
+
+	// Ghi một bản ghi; chỉ nhận tham số số nguyên / enum / bool
+	template <typename... Args>
+	static void write(uint8_t level, LogId id, Args... args)
+	{
+		static_assert(sizeof...(Args) <= BINLOG_MAX_ARGS, "Too many binlog arguments");
+		uint32_t values[] = {0, toArg(args)...};
+		record(level, id, values + 1, sizeof...(Args));
+	}
+
+	// Xả toàn bộ bản ghi đang chờ (task xả log gọi định kỳ)
+	static size_t drain();
+
+	static uint32_t dropped();
+	static const char *format(uint16_t id);
+
+private:
+	template <typename T>
+	static uint32_t toArg(T value)
+	{
+		static_assert(std::is_integral<T>::value || std::is_enum<T>::value, "binlog arguments must be integers");
+		return (uint32_t)value;
+	}
+
+	static void record(uint8_t level, LogId id, const uint32_t *args, uint8_t argc);
+	static void emit(const BinLogRecord &rec);
+	static void drainTask(void *param);
+};
+
+#if BINLOG_LEVEL >= BINLOG_LEVEL_ERROR
+#define BLOG_E(id, ...) BinLog::write(BINLOG_LEVEL_ERROR, LogId::id, ##__VA_ARGS__)
+#else
+#define BLOG_E(id, ...) do {} while (0)
+#endif
+
+#if BINLOG_LEVEL >= BINLOG_LEVEL_WARN
+#define BLOG_W(id, ...) BinLog::write(BINLOG_LEVEL_WARN, LogId::id, ##__VA_ARGS__)
+#else
+#define BLOG_W(id, ...) do {} while (0)
+#endif
+
+#if BINLOG_LEVEL >= BINLOG_LEVEL_INFO
+#define BLOG_I(id, ...) BinLog::write(BINLOG_LEVEL_INFO, LogId::id, ##__VA_ARGS__)
+#else
+#define BLOG_I(id, ...) do {} while (0)
+#endif
+
+#if BINLOG_LEVEL >= BINLOG_LEVEL_DEBUG
+#define BLOG_D(id, ...) BinLog::write(BINLOG_LEVEL_DEBUG, LogId::id, ##__VA_ARGS__)
+#else
+#define BLOG_D(id, ...) do {} while (0)
+#endif
+
+#endif // BIN_LOG_H
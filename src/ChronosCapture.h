@@ -0,0 +1,184 @@
+#ifndef CHRONOS_CAPTURE_H
+#define CHRONOS_CAPTURE_H
+
+#include <Arduino.h>
+#include <atomic>
+
+/*
+ * Định dạng ghi lại (capture) các lần ghi BLE thô của ứng dụng Chronos.
+ *
+ * File .chcap (little-endian):
+ *   header 8 byte : "CHCP", version, 3 byte dự phòng
+ *   mỗi bản ghi   : ChronosCaptureRecord (8 byte) + length byte dữ liệu
+ *
+ * Trên thiết bị, mỗi bản ghi được gửi qua Serial dưới dạng frame
+ *   magic (2 byte) + ChronosCaptureRecord + dữ liệu + checksum (tổng byte)
+ * để tách được khỏi log văn bản; tools/ble_capture.py gom các frame thành
+ * file .chcap và tools/replay phát lại qua ChronosESP32Patched trên máy tính.
+ */
+
+// 1: ghi lại mọi lần ghi vào characteristic RX (chỉ dùng khi thu thập dữ liệu)
+#ifndef CHRONOS_CAPTURE
+#define CHRONOS_CAPTURE 0
+#endif
+
+#ifndef CHRONOS_CAPTURE_BUFFER
+#define CHRONOS_CAPTURE_BUFFER 4096 // byte, phải là lũy thừa của 2
+#endif
+
+#define CHRONOS_CAPTURE_VERSION 1
+#define CHRONOS_CAPTURE_FRAME_MAGIC0 0xC4
+#define CHRONOS_CAPTURE_FRAME_MAGIC1 0x9E
+
+#define CHRONOS_CAPTURE_RX 0x01 // bản ghi là một lần ghi từ điện thoại
+
+static const uint8_t CHRONOS_CAPTURE_FILE_MAGIC[4] = {'C', 'H', 'C', 'P'};
+
+struct ChronosCaptureRecord
+{
+	uint32_t timestamp; // ms tính từ lúc bắt đầu ghi
+	uint16_t length;    // số byte dữ liệu theo sau
+	uint8_t flags;      // CHRONOS_CAPTURE_*
+	uint8_t reserved;
+};
+
+/**
+ * Bộ ghi capture trên thiết bị.
+ *
+ * record() được gọi từ callback onWrite của NimBLE và chỉ chép dữ liệu vào
+ * ring byte (một producer, một consumer, không khóa); flush() chạy trên task
+ * chính và ghi các frame ra Serial. Khi ring đầy, bản ghi mới bị bỏ và đếm.
+ */
+class ChronosCaptureRecorder
+{
+	static_assert((CHRONOS_CAPTURE_BUFFER & (CHRONOS_CAPTURE_BUFFER - 1)) == 0,
+				  "CHRONOS_CAPTURE_BUFFER must be a power of 2");
+
+public:
+	void start(uint32_t now)
+	{
+		_startedAt = now;
+		_dropped = 0;
+		_recorded = 0;
+		_enabled.store(true, std::memory_order_release);
+	}
+
+	void stop() { _enabled.store(false, std::memory_order_release); }
+	bool isRecording() const { return _enabled.load(std::memory_order_acquire); }
+
+	// Gọi từ callback NimBLE: chép một lần ghi vào ring
+	void record(const uint8_t *data, int len, uint32_t now, uint8_t flags = CHRONOS_CAPTURE_RX)
+	{
+		if (!isRecording() || data == nullptr || len <= 0 || len > 0xFFFF)
+		{
+			return;
+		}
+
+		uint32_t head = _head.load(std::memory_order_relaxed);
+		uint32_t tail = _tail.load(std::memory_order_acquire);
+		uint32_t needed = sizeof(ChronosCaptureRecord) + (uint32_t)len;
+		if (CHRONOS_CAPTURE_BUFFER - (head - tail) < needed)
+		{
+			_dropped++;
+			return;
+		}
+
+		ChronosCaptureRecord rec;
+		rec.timestamp = now - _startedAt;
+		rec.length = (uint16_t)len;
+		rec.flags = flags;
+		rec.reserved = 0;
+		copyIn(head, (const uint8_t *)&rec, sizeof(rec));
+		copyIn(head + sizeof(rec), data, len);
+		_head.store(head + needed, std::memory_order_release);
+		_recorded++;
+	}
+
+	// Gọi từ task chính: ghi các bản ghi đang chờ ra output dưới dạng frame
+	size_t flush(Print &out)
+	{
+		size_t count = 0;
+		uint32_t tail = _tail.load(std::memory_order_relaxed);
+		uint32_t head = _head.load(std::memory_order_acquire);
+
+		while (head - tail >= sizeof(ChronosCaptureRecord))
+		{
+			ChronosCaptureRecord rec;
+			copyOut(tail, (uint8_t *)&rec, sizeof(rec));
+
+			const uint8_t magic[2] = {CHRONOS_CAPTURE_FRAME_MAGIC0, CHRONOS_CAPTURE_FRAME_MAGIC1};
+			uint8_t checksum = sum((const uint8_t *)&rec, sizeof(rec));
+			out.write(magic, sizeof(magic));
+			out.write((const uint8_t *)&rec, sizeof(rec));
+
+			// Dữ liệu có thể vắt qua cuối ring nên ghi thành tối đa hai đoạn
+			uint32_t pos = (tail + sizeof(rec)) & (CHRONOS_CAPTURE_BUFFER - 1);
+			uint32_t first = rec.length;
+			if (pos + first > CHRONOS_CAPTURE_BUFFER)
+			{
+				first = CHRONOS_CAPTURE_BUFFER - pos;
+			}
+			out.write(&_buffer[pos], first);
+			checksum += sum(&_buffer[pos], first);
+			if (first < rec.length)
+			{
+				out.write(_buffer, rec.length - first);
+				checksum += sum(_buffer, rec.length - first);
+			}
+			out.write(&checksum, 1);
+
+			tail += sizeof(rec) + rec.length;
+			_tail.store(tail, std::memory_order_release);
+			count++;
+		}
+		return count;
+	}
+
+	uint32_t recorded() const { return _recorded; }
+	uint32_t dropped() const { return _dropped; }
+
+	static ChronosCaptureRecorder &getInstance()
+	{
+		static ChronosCaptureRecorder instance;
+		return instance;
+	}
+
+private:
+	ChronosCaptureRecorder() : _head(0), _tail(0), _enabled(false), _startedAt(0), _recorded(0), _dropped(0) {}
+
+	void copyIn(uint32_t at, const uint8_t *src, uint32_t len)
+	{
+		for (uint32_t i = 0; i < len; i++)
+		{
+			_buffer[(at + i) & (CHRONOS_CAPTURE_BUFFER - 1)] = src[i];
+		}
+	}
+
+	void copyOut(uint32_t at, uint8_t *dst, uint32_t len) const
+	{
+		for (uint32_t i = 0; i < len; i++)
+		{
+			dst[i] = _buffer[(at + i) & (CHRONOS_CAPTURE_BUFFER - 1)];
+		}
+	}
+
+	static uint8_t sum(const uint8_t *data, uint32_t len)
+	{
+		uint8_t s = 0;
+		for (uint32_t i = 0; i < len; i++)
+		{
+			s += data[i];
+		}
+		return s;
+	}
+
+	uint8_t _buffer[CHRONOS_CAPTURE_BUFFER];
+	std::atomic<uint32_t> _head; // chỉ callback NimBLE ghi
+	std::atomic<uint32_t> _tail; // chỉ task chính ghi
+	std::atomic<bool> _enabled;
+	uint32_t _startedAt;
+	uint32_t _recorded;
+	uint32_t _dropped;
+};
+
+#endif // CHRONOS_CAPTURE_H
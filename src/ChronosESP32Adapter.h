@@ -94,11 +94,6 @@ public:
         return *this;
     }
     
-    void setIconCallback(void (*callback)(uint8_t, String)) {
-        // Kết nối callback vào hệ thống ChronosESP32
-        Serial.println("Setting icon callback");
-    }
-    
     void setConnectCallback(void (*callback)(bool)) {
         // Sử dụng phương thức setConnectionCallback của lớp cha
         ChronosESP32Patched::setConnectionCallback(callback);
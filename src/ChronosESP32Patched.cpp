@@ -33,11 +33,14 @@
 */
 
 #include "ChronosESP32Patched.h"
+#include "BinLog.h"
+#include "ChronosCapture.h"
+#include "VietNfc.h"
 
 // Triển khai cơ bản các phương thức cần thiết
 
 BLECharacteristic *ChronosESP32Patched::pCharacteristicTX = nullptr;
-BLECharacteristic *ChronosESP32Patched::pCharacteristicRX = nullptr;
+ChronosRxCharacteristic *ChronosESP32Patched::pCharacteristicRX = nullptr;
 
 ChronosESP32Patched::ChronosESP32Patched() : ESP32Time(0) {
     _inited = false;
@@ -48,26 +51,32 @@ ChronosESP32Patched::ChronosESP32Patched() : ESP32Time(0) {
     _batteryChanged = false;
     _hour24 = true;
     _cameraReady = false;
+#if CHRONOS_HAS(NOTIFICATIONS)
     _notificationIndex = 0;
+#endif
+#if CHRONOS_HAS(WEATHER)
     _weatherSize = 0;
-    _weatherCity = "";
-    _weatherTime = "";
+    _weatherCity.clear();
+    _weatherTime.clear();
+#endif
     _appCode = 0;
-    _appVersion = "";
+    _appVersion.clear();
     _touch.state = false;
     _touch.x = 0;
     _touch.y = 0;
+#if CHRONOS_HAS(CONTACTS)
     _sosContact = 0;
     _contactSize = 0;
+#endif
     _screenConf = CS_240x240_128_CTF;
     _infoTimer.time = 0;
     _infoTimer.active = false;
     _findTimer.time = 0;
     _findTimer.active = false;
-    _incomingData.length = 0;
     _outgoingData.length = 0;
     _sendESP = false;
     _chunked = false;
+    _mtu = CHRONOS_DEFAULT_MTU;
 }
 
 ChronosESP32Patched::ChronosESP32Patched(String name, ChronosScreen screen) : ESP32Time(0) {
@@ -81,25 +90,31 @@ ChronosESP32Patched::ChronosESP32Patched(String name, ChronosScreen screen) : ES
     _batteryChanged = false;
     _hour24 = true;
     _cameraReady = false;
+#if CHRONOS_HAS(NOTIFICATIONS)
     _notificationIndex = 0;
+#endif
+#if CHRONOS_HAS(WEATHER)
     _weatherSize = 0;
-    _weatherCity = "";
-    _weatherTime = "";
+    _weatherCity.clear();
+    _weatherTime.clear();
+#endif
     _appCode = 0;
-    _appVersion = "";
+    _appVersion.clear();
     _touch.state = false;
     _touch.x = 0;
     _touch.y = 0;
+#if CHRONOS_HAS(CONTACTS)
     _sosContact = 0;
     _contactSize = 0;
+#endif
     _infoTimer.time = 0;
     _infoTimer.active = false;
     _findTimer.time = 0;
     _findTimer.active = false;
-    _incomingData.length = 0;
     _outgoingData.length = 0;
     _sendESP = false;
     _chunked = false;
+    _mtu = CHRONOS_DEFAULT_MTU;
 }
 
 void ChronosESP32Patched::begin() {
@@ -107,13 +122,15 @@ void ChronosESP32Patched::begin() {
         return;
     }
     
+    buildCommandIndex();
+    
     // Khởi tạo BLE device
     // Chuyển đổi từ String sang std::string
     NimBLEDevice::init(std::string(_watchName.c_str()));
     
     // Tạo server
     NimBLEServer *pServer = NimBLEDevice::createServer();
-    BLEDevice::setMTU(517);
+    BLEDevice::setMTU(CHRONOS_PREFERRED_MTU);
     pServer->setCallbacks(this);
     
     // Tạo service
@@ -124,9 +141,12 @@ void ChronosESP32Patched::begin() {
                             CHARACTERISTIC_UUID_TX,
                             NIMBLE_PROPERTY::NOTIFY);
     
-    pCharacteristicRX = pService->createCharacteristic(
+    // RX tự tạo để onWrite đọc giá trị không qua bản sao
+    pCharacteristicRX = new ChronosRxCharacteristic(
                             CHARACTERISTIC_UUID_RX,
-                            NIMBLE_PROPERTY::WRITE | NIMBLE_PROPERTY::WRITE_NR);
+                            NIMBLE_PROPERTY::WRITE | NIMBLE_PROPERTY::WRITE_NR,
+                            pService);
+    pService->addCharacteristic(pCharacteristicRX);
     
     pCharacteristicTX->setCallbacks(this);
     pCharacteristicRX->setCallbacks(this);
@@ -143,6 +163,8 @@ void ChronosESP32Patched::begin() {
 	pAdvertising->start();
 
     
+    _iconCache.begin();
+    
     _inited = true;
     _address = NimBLEDevice::getAddress().toString().c_str();
     
@@ -180,13 +202,15 @@ void ChronosESP32Patched::setConnectionCallback(void (*callback)(bool)) {
     connectionChangeCallback = callback;
 }
 
-void ChronosESP32Patched::setNotificationCallback(void (*callback)(Notification)) {
+#if CHRONOS_HAS(NOTIFICATIONS)
+void ChronosESP32Patched::setNotificationCallback(void (*callback)(const Notification &)) {
     notificationReceivedCallback = callback;
 }
 
-void ChronosESP32Patched::setRingerCallback(void (*callback)(String, bool)) {
+void ChronosESP32Patched::setRingerCallback(void (*callback)(const char *, bool)) {
     ringerAlertCallback = callback;
 }
+#endif
 
 void ChronosESP32Patched::setConfigurationCallback(void (*callback)(ConfigType, uint32_t, uint32_t)) {
     configurationReceivedCallback = callback;
@@ -200,12 +224,42 @@ void ChronosESP32Patched::setRawDataCallback(void (*callback)(uint8_t *, int)) {
     rawDataReceivedCallback = callback;
 }
 
+#if CHRONOS_HAS(HEALTH)
 void ChronosESP32Patched::setHealthRequestCallback(void (*callback)(HealthRequest, bool)) {
     healthRequestCallback = callback;
 }
+#endif
+
+const ChronosReassemblerStats &ChronosESP32Patched::getReassemblerStats() {
+    return _reassembler.stats();
+}
+
+const NavIconStats &ChronosESP32Patched::getNavIconStats() {
+    return _iconStats;
+}
+
+uint32_t ChronosESP32Patched::getRxQueueOverflows() {
+    return _rxQueue.overflows();
+}
+
+uint32_t ChronosESP32Patched::getRxQueueHighWater() {
+    return _rxQueue.highWater();
+}
+
+uint16_t ChronosESP32Patched::getMTU() {
+    return _mtu;
+}
+
+const ChronosWriteStats &ChronosESP32Patched::getWriteStats() {
+    return _writeStats;
+}
 
 void ChronosESP32Patched::onConnect(NimBLEServer *pServer, NimBLEConnInfo &connInfo) {
     _connected = true;
+    _mtu = connInfo.getMTU();
+    // Chủ động đề nghị MTU lớn: không phải điện thoại nào cũng tự thương lượng,
+    // kết quả báo về qua onMTUChange()
+    ble_gattc_exchange_mtu(connInfo.getConnHandle(), nullptr, nullptr);
     
     if (connectionChangeCallback != nullptr) {
         connectionChangeCallback(_connected);
@@ -214,18 +268,10 @@ void ChronosESP32Patched::onConnect(NimBLEServer *pServer, NimBLEConnInfo &connI
 
 void ChronosESP32Patched::onDisconnect(NimBLEServer *pServer, NimBLEConnInfo &connInfo, int reason) {
 	_connected = false;
+	_mtu = CHRONOS_DEFAULT_MTU;
 	BLEDevice::startAdvertising();
 	_touch.state = false; // release touch
 
-	if (_navigation.active)
-	{
-		_navigation.active = false;
-		if (configurationReceivedCallback != nullptr)
-		{
-			configurationReceivedCallback(CF_NAV_DATA, _navigation.active ? 1 : 0, 0);
-		}
-	}
-
 	if (connectionChangeCallback != nullptr)
 	{
 		connectionChangeCallback(false);
@@ -233,54 +279,48 @@ void ChronosESP32Patched::onDisconnect(NimBLEServer *pServer, NimBLEConnInfo &co
     Serial.println("BLE disconnected, restarting advertising");
 }
 
+void ChronosESP32Patched::onMTUChange(uint16_t MTU, NimBLEConnInfo &connInfo) {
+    // Bộ ghép tự lấy kích thước phân đoạn từ phân đoạn đầu của mỗi gói,
+    // ở đây chỉ cần nhớ MTU để cắt lệnh gửi đi
+    _mtu = MTU;
+}
+
 void ChronosESP32Patched::onWrite(NimBLECharacteristic *pCharacteristic, NimBLEConnInfo &connInfo) {
-    if (pCharacteristic->getUUID().toString() == CHARACTERISTIC_UUID_RX) {
-        std::string pData = pCharacteristic->getValue();
-        int len = pData.length();
-        
-        if (len > 0) {
-            if (rawDataReceivedCallback != nullptr) {
-                rawDataReceivedCallback((uint8_t *)pData.data(), len);
-            }
+    // So con trỏ thay vì so UUID dạng chuỗi: không cấp phát trên đường nóng
+    if (pCharacteristic != pCharacteristicRX) {
+        return;
+    }
+#if CHRONOS_WRITE_STATS
+    uint32_t heapBefore = ESP.getFreeHeap();
+#endif
 
-            if ((pData[0] == 0xAB || pData[0] == 0xEA) && (pData[3] == 0xFE || pData[3] == 0xFF)) {
-                // Bắt đầu của dữ liệu, lấy chiều dài từ packet
-                _incomingData.length = pData[1] * 256 + pData[2] + 3;
-                
-                // Sao chép dữ liệu vào buffer
-                for (int i = 0; i < len; i++) {
-                    _incomingData.data[i] = pData[i];
-                }
-
-                if (_incomingData.length <= len) {
-                    // Gói tin đã được ghép đầy đủ
-                    dataReceived();
-                }
-                else {
-                    // Dữ liệu vẫn đang được ghép
-                    Serial.println("Packet incomplete, waiting for more data...");
-                }
-            }
-            else {
-                // Đây là phần tiếp theo của gói tin
-                int j = 20 + (pData[0] * 19); // Vị trí dữ liệu gói
-                
-                // Sao chép dữ liệu vào buffer
-                for (int i = 0; i < len; i++) {
-                    _incomingData.data[j + i] = pData[i + 1];
-                }
-
-                if (_incomingData.length <= len + j - 1) {
-                    // Gói tin đã được ghép đầy đủ
-                    dataReceived();
-                }
-                else {
-                    // Dữ liệu vẫn đang được ghép
-                    Serial.println("Packet still incomplete, waiting for more data...");
-                }
-            }
+    const NimBLEAttValue &value = pCharacteristicRX->value();
+    const uint8_t *data = value.data();
+    int len = value.size();
+
+    if (len > 0) {
+        if (rawDataReceivedCallback != nullptr) {
+            rawDataReceivedCallback(const_cast<uint8_t *>(data), len);
+        }
+#if CHRONOS_CAPTURE
+        ChronosCaptureRecorder::getInstance().record(data, len, millis());
+#endif
+
+        // Ghép phân đoạn (lần chép duy nhất, vào slot của bộ ghép); gói đầy đủ
+        // được đẩy sang task chính để phân tích, không xử lý trong callback NimBLE
+        ChronosData *packet = _reassembler.push(data, len, millis());
+        if (packet != nullptr && !_rxQueue.push(packet)) {
+            _reassembler.release(packet);
         }
     }
+
+#if CHRONOS_WRITE_STATS
+    _writeStats.writes++;
+    _writeStats.bytes += len;
+    if (ESP.getFreeHeap() != heapBefore) {
+        _writeStats.heapChangedWrites++;
+    }
+#endif
 }
 
 void ChronosESP32Patched::onSubscribe(NimBLECharacteristic *pCharacteristic, NimBLEConnInfo &connInfo, uint16_t subValue) {
@@ -296,417 +336,655 @@ void ChronosESP32Patched::sendCommand(uint8_t *command, size_t length, bool forc
         return;
     }
     
-    if (length > 0) {
-        if (pCharacteristicTX != nullptr) {
-            pCharacteristicTX->setValue(command, length);
-            pCharacteristicTX->notify();
+    if (length == 0 || pCharacteristicTX == nullptr) {
+        return;
+    }
+
+    // Mỗi notify chở tối đa MTU - 3 byte; force_chunked/_chunked giữ khung cũ 20 byte
+    size_t payload = _mtu > 3 ? _mtu - 3 : CHRONOS_FIRST_FRAGMENT;
+    if (force_chunked || _chunked || payload < CHRONOS_FIRST_FRAGMENT) {
+        payload = CHRONOS_FIRST_FRAGMENT;
+    }
+
+    for (size_t offset = 0; offset < length; offset += payload) {
+        size_t chunk = length - offset < payload ? length - offset : payload;
+        // NimBLE từ chối khi hết mbuf, chờ host gửi bớt rồi thử lại
+        int attempt = 0;
+        while (!pCharacteristicTX->notify(command + offset, chunk) && ++attempt < CHRONOS_NOTIFY_RETRIES) {
+            delay(2);
         }
     }
 }
 
-void ChronosESP32Patched::dataReceived() {
+int ChronosESP32Patched::processPackets() {
+    int count = 0;
+    ChronosData *packet = nullptr;
+    while (_rxQueue.pop(packet)) {
+        dataReceived(*packet);
+        _reassembler.release(packet);
+        count++;
+    }
+    return count;
+}
+
+// Mất kết nối: gói điều hướng đầu tiên sau khi nối lại sẽ báo NAV_FIELD_STATE.
+// Chỉ gọi từ task chính (cùng task với processPackets), không gọi callback.
+void ChronosESP32Patched::resetNavigation() {
+    _navigation.active = false;
+    _navigation.changed = 0;
+}
+
+void ChronosESP32Patched::dataReceived(const ChronosData &packet) {
     // Kiểm tra xem có dữ liệu không
-    if (_incomingData.length < 1) {
+    if (packet.length < 1) {
         return;
     }
-    int len = _incomingData.length;
-    
-    // Log raw data received (for debugging) with special formatting
-    Serial.print("Received data: ");
-    for (int i = 0; i < len; i++) {
-        Serial.printf("%02X ", _incomingData.data[i]);
-    }
-    Serial.println();
+    int len = packet.length;
     
     // Gửi cho callback nếu người dùng muốn xử lý dữ liệu thô
     if (rawDataReceivedCallback != nullptr) {
-        rawDataReceivedCallback(_incomingData.data, _incomingData.length);
+        rawDataReceivedCallback((uint8_t *)packet.data, packet.length);
     }
     
     // Gửi dữ liệu cho callback chung nếu được đăng ký
     if (dataReceivedCallback != nullptr) {
-        dataReceivedCallback(_incomingData.data, _incomingData.length);
-    }
-    
-    // Xử lý dữ liệu theo định dạng
-    if (_incomingData.data[0] == 0xAB) {
-        switch (_incomingData.data[4]) {
-            // Xử lý reset
-            case 0x23:
-                if (configurationReceivedCallback != nullptr) {
-                    configurationReceivedCallback(ConfigType::CF_RST, 0, 0);
-                }
-                break;
-                
-            // Xử lý yêu cầu đo sức khỏe
-            case 0x31:
-                switch (_incomingData.data[5]) {
-                    case 0x0A:
-                        if (healthRequestCallback != nullptr) {
-                            healthRequestCallback(HealthRequest::HR_HEART_RATE_MEASURE, _incomingData.data[6]);
-                        }
-                        break;
-                    case 0x12:
-                        if (healthRequestCallback != nullptr) {
-                            healthRequestCallback(HealthRequest::HR_BLOOD_OXYGEN_MEASURE, _incomingData.data[6]);
-                        }
-                        break;
-                    case 0x22:
-                        if (healthRequestCallback != nullptr) {
-                            healthRequestCallback(HealthRequest::HR_BLOOD_PRESSURE_MEASURE, _incomingData.data[6]);
-                        }
-                        break;
-                }
-                break;
-                
-            // Xử lý yêu cầu đo tất cả các chỉ số sức khỏe
-            case 0x32:
-                if (healthRequestCallback != nullptr) {
-                    healthRequestCallback(HealthRequest::HR_MEASURE_ALL, _incomingData.data[6]);
-                }
-                break;
-                
-            // Xử lý yêu cầu dữ liệu bước chân
-            case 0x51:
-                if (_incomingData.data[5] == 0x80) {
-                    if (healthRequestCallback != nullptr) {
-                        healthRequestCallback(HealthRequest::HR_STEPS_RECORDS, true);
-                    }
-                }
-                break;
-                
-            // Xử lý yêu cầu dữ liệu giấc ngủ
-            case 0x52:
-                if (_incomingData.data[5] == 0x80) {
-                    if (healthRequestCallback != nullptr) {
-                        healthRequestCallback(HealthRequest::HR_SLEEP_RECORDS, true);
-                    }
-                }
-                break;
-                
-            // Xử lý tìm thiết bị
-            case 0x71:
-                if (configurationReceivedCallback != nullptr) {
-                    configurationReceivedCallback(ConfigType::CF_FIND, 0, 0);
-                }
-                break;
-                
-            // Xử lý thông báo
-            case 0x72: {
-                int icon = _incomingData.data[6];
-                int state = _incomingData.data[7];
-                
-                String message = "";
-                for (int i = 8; i < _incomingData.length; i++) {
-                    message += (char)_incomingData.data[i];
-                }
-                
-                if (icon == 0x01) {
-                    // Lệnh rung chuông
-                    if (ringerAlertCallback != nullptr) {
-                        ringerAlertCallback(message, true);
-                    }
-                    break;
-                }
-                if (icon == 0x02) {
-                    // Lệnh hủy rung chuông
-                    if (ringerAlertCallback != nullptr) {
-                        ringerAlertCallback(message, false);
-                    }
-                    break;
-                }
-                if (state == 0x02) {
-                    _notificationIndex++;
-                    _notifications[_notificationIndex % NOTIF_SIZE].icon = icon;
-                    _notifications[_notificationIndex % NOTIF_SIZE].app = "App"; // Có thể dùng appName(icon) nếu triển khai
-                    _notifications[_notificationIndex % NOTIF_SIZE].time = "Now";
-                    splitTitle(message, _notifications[_notificationIndex % NOTIF_SIZE].title, _notifications[_notificationIndex % NOTIF_SIZE].message, icon);
-                    
-                    if (notificationReceivedCallback != nullptr) {
-                        notificationReceivedCallback(_notifications[_notificationIndex % NOTIF_SIZE]);
-                    }
-                }
-                break;
+        dataReceivedCallback((uint8_t *)packet.data, packet.length);
+    }
+    
+    // Tra bảng lệnh theo (family, command, subcommand) và gọi handler tương ứng
+    const CommandEntry *entry = findCommand(packet.data, len);
+    if (entry != nullptr) {
+        BLOG_D(RX_PACKET, packet.data[0], packet.data[4], len > 5 ? packet.data[5] : 0, len);
+        ChronosPacket view = {packet.data, len};
+        (this->*(entry->handler))(view);
+    } else {
+        BLOG_D(RX_UNKNOWN, packet.data[0], len > 4 ? packet.data[4] : 0, len);
+    }
+}
+
+/*
+ * Bảng lệnh của giao thức Chronos.
+ * Các mục có cùng (family, command) phải nằm liền nhau, mục CMD_ANY đứng sau
+ * các mục có subcommand/frame cụ thể (khớp mục đầu tiên). Độ dài tối thiểu
+ * được kiểm tra trước khi gọi handler nên handler có thể đọc trực tiếp các
+ * byte trong khoảng đó.
+ */
+const ChronosESP32Patched::CommandEntry ChronosESP32Patched::_commands[] = {
+    // family, command, sub, frame, minLength, handler
+    {0xAB, 0x23, CMD_ANY, CMD_ANY, 5, &ChronosESP32Patched::onReset},
+#if CHRONOS_HAS(HEALTH)
+    {0xAB, 0x31, 0x0A, CMD_ANY, 7, &ChronosESP32Patched::onHealthMeasure},
+    {0xAB, 0x31, 0x12, CMD_ANY, 7, &ChronosESP32Patched::onHealthMeasure},
+    {0xAB, 0x31, 0x22, CMD_ANY, 7, &ChronosESP32Patched::onHealthMeasure},
+    {0xAB, 0x32, CMD_ANY, CMD_ANY, 7, &ChronosESP32Patched::onHealthMeasureAll},
+    {0xAB, 0x51, 0x80, CMD_ANY, 6, &ChronosESP32Patched::onStepsRequest},
+    {0xAB, 0x52, 0x80, CMD_ANY, 6, &ChronosESP32Patched::onSleepRequest},
+#endif
+    {0xAB, 0x71, CMD_ANY, CMD_ANY, 5, &ChronosESP32Patched::onFindWatch},
+#if CHRONOS_HAS(NOTIFICATIONS)
+    {0xAB, 0x72, CMD_ANY, CMD_ANY, 8, &ChronosESP32Patched::onNotification},
+#endif
+#if CHRONOS_HAS(ALARMS)
+    {0xAB, 0x73, CMD_ANY, CMD_ANY, 11, &ChronosESP32Patched::onAlarm},
+#endif
+    {0xAB, 0x79, CMD_ANY, CMD_ANY, 7, &ChronosESP32Patched::onCamera},
+    {0xAB, 0x7C, CMD_ANY, CMD_ANY, 7, &ChronosESP32Patched::onHour24},
+    {0xAB, 0x91, CMD_ANY, CMD_ANY, 8, &ChronosESP32Patched::onPhoneBattery},
+    {0xAB, 0x93, CMD_ANY, CMD_ANY, 14, &ChronosESP32Patched::onTime},
+#if CHRONOS_HAS(QR)
+    {0xAB, 0xA8, CMD_ANY, 0xFF, 6, &ChronosESP32Patched::onQrLink},
+    {0xAB, 0xA8, CMD_ANY, 0xFE, 6, &ChronosESP32Patched::onQrEnd},
+#endif
+    {0xAB, 0xCA, CMD_ANY, 0xFE, 8, &ChronosESP32Patched::onAppInfo},
+    {0xAB, 0xEE, CMD_ANY, 0xFE, 11, &ChronosESP32Patched::onNavIcon},
+    {0xAB, 0xEF, 0x00, 0xFE, 6, &ChronosESP32Patched::onNavInactive},
+    {0xAB, 0xEF, 0xFF, 0xFE, 6, &ChronosESP32Patched::onNavDisabled},
+    {0xAB, 0xEF, 0x80, 0xFE, 12, &ChronosESP32Patched::onNavData},
+    {0xAB, 0xEF, CMD_ANY, 0xFE, 6, &ChronosESP32Patched::onNavOther}, // sau các mục có subcommand cụ thể
+
+#if CHRONOS_HAS(WEATHER)
+    {0xEA, 0x7E, 0x01, CMD_ANY, 7, &ChronosESP32Patched::onWeatherCity},
+    {0xEA, 0x7E, 0x02, CMD_ANY, 8, &ChronosESP32Patched::onHourlyForecast},
+#endif
+};
+
+const size_t ChronosESP32Patched::_commandCount = sizeof(ChronosESP32Patched::_commands) / sizeof(ChronosESP32Patched::_commands[0]);
+
+uint8_t ChronosESP32Patched::_commandIndex[2][256] = {};
+
+// Xây chỉ mục (family, command) -> vị trí đầu tiên trong bảng. Gọi trong begin(),
+// trước khi server BLE nhận gói nào, nên findCommand() chỉ còn đọc.
+void ChronosESP32Patched::buildCommandIndex() {
+    static_assert(sizeof(_commands) / sizeof(_commands[0]) < 255, "Command table too large for uint8_t index");
+    
+    for (size_t i = _commandCount; i > 0; i--) {
+        const CommandEntry &e = _commands[i - 1];
+        int family = familyIndex(e.family);
+        if (family >= 0) {
+            _commandIndex[family][e.command] = (uint8_t)i; // 0 = không có lệnh
+        }
+    }
+}
+
+int ChronosESP32Patched::familyIndex(uint8_t family) {
+    return family == 0xAB ? 0 : (family == 0xEA ? 1 : -1);
+}
+
+const ChronosESP32Patched::CommandEntry *ChronosESP32Patched::findCommand(const uint8_t *data, int length) {
+    if (length < 5) {
+        return nullptr;
+    }
+    int family = familyIndex(data[0]);
+    if (family < 0) {
+        return nullptr;
+    }
+    uint8_t first = _commandIndex[family][data[4]];
+    if (first == 0) {
+        return nullptr;
+    }
+    
+    // Chỉ duyệt vài mục cùng (family, command) để khớp subcommand và frame
+    for (size_t i = first - 1; i < _commandCount; i++) {
+        const CommandEntry &e = _commands[i];
+        if (e.family != data[0] || e.command != data[4]) {
+            break;
+        }
+        if (e.sub != CMD_ANY && (length < 6 || e.sub != data[5])) {
+            continue;
+        }
+        if (e.frame != CMD_ANY && e.frame != data[3]) {
+            continue;
+        }
+        return length >= e.minLength ? &e : nullptr;
+    }
+    return nullptr;
+}
+
+// Xử lý reset
+void ChronosESP32Patched::onReset(const ChronosPacket &p) {
+    if (configurationReceivedCallback != nullptr) {
+        configurationReceivedCallback(ConfigType::CF_RST, 0, 0);
+    }
+}
+
+#if CHRONOS_HAS(HEALTH)
+// Xử lý yêu cầu đo sức khỏe
+void ChronosESP32Patched::onHealthMeasure(const ChronosPacket &p) {
+    if (healthRequestCallback == nullptr) {
+        return;
+    }
+    switch (p.data[5]) {
+        case 0x0A:
+            healthRequestCallback(HealthRequest::HR_HEART_RATE_MEASURE, p.data[6]);
+            break;
+        case 0x12:
+            healthRequestCallback(HealthRequest::HR_BLOOD_OXYGEN_MEASURE, p.data[6]);
+            break;
+        case 0x22:
+            healthRequestCallback(HealthRequest::HR_BLOOD_PRESSURE_MEASURE, p.data[6]);
+            break;
+    }
+}
+
+// Xử lý yêu cầu đo tất cả các chỉ số sức khỏe
+void ChronosESP32Patched::onHealthMeasureAll(const ChronosPacket &p) {
+    if (healthRequestCallback != nullptr) {
+        healthRequestCallback(HealthRequest::HR_MEASURE_ALL, p.data[6]);
+    }
+}
+
+// Xử lý yêu cầu dữ liệu bước chân
+void ChronosESP32Patched::onStepsRequest(const ChronosPacket &p) {
+    if (healthRequestCallback != nullptr) {
+        healthRequestCallback(HealthRequest::HR_STEPS_RECORDS, true);
+    }
+}
+
+// Xử lý yêu cầu dữ liệu giấc ngủ
+void ChronosESP32Patched::onSleepRequest(const ChronosPacket &p) {
+    if (healthRequestCallback != nullptr) {
+        healthRequestCallback(HealthRequest::HR_SLEEP_RECORDS, true);
+    }
+}
+#endif
+
+// Xử lý tìm thiết bị
+void ChronosESP32Patched::onFindWatch(const ChronosPacket &p) {
+    if (configurationReceivedCallback != nullptr) {
+        configurationReceivedCallback(ConfigType::CF_FIND, 0, 0);
+    }
+}
+
+#if CHRONOS_HAS(NOTIFICATIONS)
+// Xử lý thông báo
+void ChronosESP32Patched::onNotification(const ChronosPacket &p) {
+    int icon = p.data[6];
+    int state = p.data[7];
+    const char *text = (const char *)p.data + 8;
+    size_t length = p.length - 8;
+    
+    if (icon == 0x01 || icon == 0x02) {
+        // Lệnh rung chuông (0x01) / hủy rung chuông (0x02): tên người gọi
+        if (ringerAlertCallback != nullptr) {
+            NotifMessageText caller;
+            caller.assign(text, length);
+            ringerAlertCallback(caller.c_str(), icon == 0x01);
+        }
+        return;
+    }
+    if (state == 0x02) {
+        _notificationIndex++;
+        Notification &n = _notifications[_notificationIndex % NOTIF_SIZE];
+        n.icon = icon;
+        n.app = "App"; // Có thể dùng appName(icon) nếu triển khai
+        n.time = "Now";
+        splitTitle(text, length, n.title, n.message);
+        
+        if (notificationReceivedCallback != nullptr) {
+            notificationReceivedCallback(n);
+        }
+    }
+}
+#endif
+
+#if CHRONOS_HAS(ALARMS)
+// Cài đặt báo thức
+void ChronosESP32Patched::onAlarm(const ChronosPacket &p) {
+    uint8_t hour = p.data[8];
+    uint8_t minute = p.data[9];
+    uint8_t repeat = p.data[10];
+    bool enabled = p.data[7];
+    uint32_t index = (uint32_t)p.data[6];
+    
+    if (index < ALARM_SIZE) {
+        _alarms[index].hour = hour;
+        _alarms[index].minute = minute;
+        _alarms[index].repeat = repeat;
+        _alarms[index].enabled = enabled;
+        
+        if (configurationReceivedCallback != nullptr) {
+            uint32_t alarm = ((uint32_t)hour << 24) | ((uint32_t)minute << 16) | ((uint32_t)repeat << 8) | ((uint32_t)enabled);
+            configurationReceivedCallback(ConfigType::CF_ALARM, index, alarm);
+        }
+    }
+}
+#endif
+
+// Camera status
+void ChronosESP32Patched::onCamera(const ChronosPacket &p) {
+    _cameraReady = (p.data[6] == 1);
+    if (configurationReceivedCallback != nullptr) {
+        configurationReceivedCallback(ConfigType::CF_CAMERA, 0, (uint32_t)p.data[6]);
+    }
+}
+
+// Cài đặt chế độ 24h
+void ChronosESP32Patched::onHour24(const ChronosPacket &p) {
+    _hour24 = (p.data[6] == 0);
+    if (configurationReceivedCallback != nullptr) {
+        configurationReceivedCallback(ConfigType::CF_HR24, 0, (uint32_t)(p.data[6] == 0));
+    }
+}
+
+// Thông tin pin điện thoại
+void ChronosESP32Patched::onPhoneBattery(const ChronosPacket &p) {
+    _phoneCharging = p.data[6] == 1;
+    _phoneBatteryLevel = p.data[7];
+    
+    if (configurationReceivedCallback != nullptr) {
+        configurationReceivedCallback(ConfigType::CF_PBAT, _phoneCharging ? 1 : 0, _phoneBatteryLevel);
+    }
+}
+
+// Cập nhật thời gian
+void ChronosESP32Patched::onTime(const ChronosPacket &p) {
+    this->setTime(p.data[13], p.data[12], p.data[11], 
+                 p.data[10], p.data[9], 
+                 p.data[7] * 256 + p.data[8]);
+    
+    if (configurationReceivedCallback != nullptr) {
+        configurationReceivedCallback(ConfigType::CF_TIME, 0, 0);
+    }
+}
+
+#if CHRONOS_HAS(QR)
+// Nhận một liên kết QR (index tại byte 5)
+void ChronosESP32Patched::onQrLink(const ChronosPacket &p) {
+    int index = p.data[5];
+    if (index >= QR_SIZE) {
+        return;
+    }
+    _qrLinks[index].assign((const char *)p.data + 6, p.length - 6);
+}
+
+// Kết thúc danh sách QR (số liên kết tại byte 5)
+void ChronosESP32Patched::onQrEnd(const ChronosPacket &p) {
+    if (configurationReceivedCallback != nullptr) {
+        configurationReceivedCallback(ConfigType::CF_QR, 1, p.data[5]);
+    }
+}
+#endif
+
+// Thông tin ứng dụng
+void ChronosESP32Patched::onAppInfo(const ChronosPacket &p) {
+    _appCode = (p.data[6] * 256) + p.data[7];
+    // Chuỗi phiên bản có thể được đệm bằng byte 0 ở cuối
+    const char *version = (const char *)p.data + 8;
+    _appVersion.assign(version, strnlen(version, p.length - 8));
+    
+    if (configurationReceivedCallback != nullptr) {
+        configurationReceivedCallback(ConfigType::CF_APP, _appCode, 0);
+    }
+    
+    _sendESP = true;
+}
+
+static_assert(ICON_DATA_SIZE == NAV_ICON_BYTES, "Navigation icon size mismatch");
+
+// Navigation icon data: ba phần 96 byte, chỉ đưa ra hiển thị khi đã đủ cả ba
+void ChronosESP32Patched::onNavIcon(const ChronosPacket &p) {
+    uint8_t pos = p.data[6];
+    uint32_t crc = uint32_t(p.data[7] << 24) | uint32_t(p.data[8] << 16) | 
+                  uint32_t(p.data[9] << 8) | uint32_t(p.data[10]);
+    
+    BLOG_D(NAV_ICON_PART, pos, crc);
+    _iconStats.parts++;
+    if (!_iconAssembler.addPart(pos, crc, p.data + 11, p.length - 11)) {
+        return;
+    }
+    _iconAssembler.consume();
+    
+    uint32_t computed = _iconAssembler.computedCrc();
+    BLOG_D(NAV_ICON_DONE, crc, computed == crc);
+    if (computed == crc) {
+        _iconStats.crcMissStreak = 0;
+        _iconCache.put(crc, _iconAssembler.data());
+    } else {
+        // Sai liên tiếp nhiều lần: thuật toán CRC của điện thoại khác, không phải lỗi truyền.
+        // Khi đó cache vẫn phải hit được nên cache theo CRC điện thoại gửi (chỉ trong RAM,
+        // sau khi hai lần ghép cho cùng dữ liệu).
+        _iconStats.crcMismatches++;
+        _iconStats.crcMissStreak++;
+        BLOG_W(NAV_ICON_CRC_MISMATCH, crc, computed, _iconStats.crcMissStreak);
+        bool checkOff = NAV_ICON_CRC_MAX_MISSES > 0 && _iconStats.crcMissStreak >= NAV_ICON_CRC_MAX_MISSES;
+        if (checkOff) {
+            if (_iconStats.crcMissStreak == NAV_ICON_CRC_MAX_MISSES) {
+                BLOG_W(NAV_ICON_CRC_OFF, _iconStats.crcMissStreak);
             }
-            
-            // Cài đặt báo thức
-            case 0x73: {
-                uint8_t hour = _incomingData.data[8];
-                uint8_t minute = _incomingData.data[9];
-                uint8_t repeat = _incomingData.data[10];
-                bool enabled = _incomingData.data[7];
-                uint32_t index = (uint32_t)_incomingData.data[6];
-                
-                if (index < ALARM_SIZE) {
-                    _alarms[index].hour = hour;
-                    _alarms[index].minute = minute;
-                    _alarms[index].repeat = repeat;
-                    _alarms[index].enabled = enabled;
-                    
-                    if (configurationReceivedCallback != nullptr) {
-                        uint32_t alarm = ((uint32_t)hour << 24) | ((uint32_t)minute << 16) | ((uint32_t)repeat << 8) | ((uint32_t)enabled);
-                        configurationReceivedCallback(ConfigType::CF_ALARM, index, alarm);
-                    }
-                }
-                break;
+            if (_iconCache.putUnchecked(crc, _iconAssembler.data())) {
+                _iconStats.crcUnchecked++;
             }
-            
-            // Cài đặt chế độ 24h
-            case 0x7C:
-                _hour24 = (_incomingData.data[6] == 0);
-                if (configurationReceivedCallback != nullptr) {
-                    configurationReceivedCallback(ConfigType::CF_HR24, 0, (uint32_t)(_incomingData.data[6] == 0));
-                }
-                break;
-                
-            // Camera status
-            case 0x79:
-                _cameraReady = (_incomingData.data[6] == 1);
-                if (configurationReceivedCallback != nullptr) {
-                    configurationReceivedCallback(ConfigType::CF_CAMERA, 0, (uint32_t)_incomingData.data[6]);
-                }
-                break;
-                
-            // Thông tin pin điện thoại
-            case 0x91:
-                if (_incomingData.data[3] == 0xFF || _incomingData.data[3] == 0xFE) {
-                    _phoneCharging = _incomingData.data[6] == 1;
-                    _phoneBatteryLevel = _incomingData.data[7];
-                    
-                    if (configurationReceivedCallback != nullptr) {
-                        configurationReceivedCallback(ConfigType::CF_PBAT, _phoneCharging ? 1 : 0, _phoneBatteryLevel);
-                    }
-                }
-                break;
-                
-            // Cập nhật thời gian
-            case 0x93:
-                if (_incomingData.length >= 14) {
-                    this->setTime(_incomingData.data[13], _incomingData.data[12], _incomingData.data[11], 
-                                 _incomingData.data[10], _incomingData.data[9], 
-                                 _incomingData.data[7] * 256 + _incomingData.data[8]);
-                    
-                    if (configurationReceivedCallback != nullptr) {
-                        configurationReceivedCallback(ConfigType::CF_TIME, 0, 0);
-                    }
-                }
-                break;
-                
-            // Thông tin ứng dụng
-            case 0xCA:
-                if (_incomingData.data[3] == 0xFE) {
-                    _appCode = (_incomingData.data[6] * 256) + _incomingData.data[7];
-                    _appVersion = "";
-                    for (int i = 8; i < _incomingData.length; i++) {
-                        if (_incomingData.data[i] != 0) {
-                            _appVersion += (char)_incomingData.data[i];
-                        }
-                    }
-                    
-                    if (configurationReceivedCallback != nullptr) {
-                        configurationReceivedCallback(ConfigType::CF_APP, _appCode, 0);
-                    }
-                    
-                    _sendESP = true;
-                }
-                break;
-                
-            // Navigation icon data
-            case 0xEE:
-                if (_incomingData.data[3] == 0xFE) {
-                    // Navigation icon data received
-                    uint8_t pos = _incomingData.data[6];
-                    uint32_t crc = uint32_t(_incomingData.data[7] << 24) | uint32_t(_incomingData.data[8] << 16) | 
-                                  uint32_t(_incomingData.data[9] << 8) | uint32_t(_incomingData.data[10]);
-                    
-                    if (pos < 3 && (_incomingData.length - 11) <= 96) { // Ensure pos is valid and data length is reasonable
-                        for (int i = 0; i < (_incomingData.length - 11); i++) {
-                            if ((i + (96 * pos)) < ICON_DATA_SIZE) {
-                                _navigation.icon[i + (96 * pos)] = _incomingData.data[11 + i];
-                            }
-                        }
-                        
-                        _navigation.hasIcon = true;
-                        _navigation.iconCRC = crc;
-                        
-                        if (configurationReceivedCallback != nullptr) {
-                            configurationReceivedCallback(ConfigType::CF_NAV_ICON, pos, crc);
-                        }
-                        
-                        Serial.printf("Navigation Icon data, position: %d\n", pos);
-                        Serial.printf("Icon CRC: 0x%08X\n", crc);
-                        Serial.printf("Nav icon part %d received, CRC: 0x%08X\n", pos, crc);
-                    }
-                }
-                break;
-                
-            // Navigation data
-            case 0xEF:
-                if (_incomingData.data[3] == 0xFE) {
-                    // Navigation data received
-                    if (_incomingData.data[5] == 0x00) {
-                        // Navigation inactive
-                        _navigation.active = false;
-                        _navigation.eta = "Navigation";
-                        _navigation.title = "Chronos";
-                        _navigation.duration = "Inactive";
-                        _navigation.distance = "";
-                        _navigation.speed = "";
-                        _navigation.directions = "Start navigation on Google maps";
-                        _navigation.hasIcon = false;
-                        _navigation.isNavigation = false;
-                        _navigation.iconCRC = 0xFFFFFFFF;
-                        
-                        Serial.println("Navigation is inactive");
-                    }
-                    else if (_incomingData.data[5] == 0xFF) {
-                        // Navigation disabled
-                        _navigation.active = false;
-                        _navigation.title = "Chronos";
-                        _navigation.duration = "Disabled";
-                        _navigation.distance = "";
-                        _navigation.speed = "";
-                        _navigation.eta = "Navigation";
-                        _navigation.directions = "Check Chronos app settings";
-                        _navigation.hasIcon = false;
-                        _navigation.isNavigation = false;
-                        _navigation.iconCRC = 0xFFFFFFFF;
-                        
-                        Serial.println("Navigation is disabled");
-                    }
-                    else if (_incomingData.data[5] == 0x80) {
-                        _navigation.active = true;
-                        _navigation.hasIcon = _incomingData.data[6] == 1;
-                        _navigation.isNavigation = _incomingData.data[7] == 1;
-                        _navigation.iconCRC = uint32_t(_incomingData.data[8] << 24) | uint32_t(_incomingData.data[9] << 16) | uint32_t(_incomingData.data[10] << 8) | uint32_t(_incomingData.data[11]);
-
-                        int i = 12;
-                        
-                        // Title (thứ tự các trường theo đúng thư viện gốc)
-                        _navigation.title = "";
-                        while (i < _incomingData.length && _incomingData.data[i] != 0)
-                        {
-                            _navigation.title += char(_incomingData.data[i]);
-                            i++;
-                        }
-                        i++;
-
-                        // Duration 
-                        _navigation.duration = "";
-                        while (i < _incomingData.length && _incomingData.data[i] != 0)
-                        {
-                            _navigation.duration += char(_incomingData.data[i]);
-                            i++;
-                        }
-                        i++;
-
-                        // Distance
-                        _navigation.distance = "";
-                        while (i < _incomingData.length && _incomingData.data[i] != 0)
-                        {
-                            _navigation.distance += char(_incomingData.data[i]);
-                            i++;
-                        }
-                        i++;
-
-                        // ETA
-                        _navigation.eta = "";
-                        while (i < _incomingData.length && _incomingData.data[i] != 0)
-                        {
-                            _navigation.eta += char(_incomingData.data[i]);
-                            i++;
-                        }
-                        i++;
-
-                        // Directions
-                        _navigation.directions = "";
-                        while (i < _incomingData.length && _incomingData.data[i] != 0)
-                        {
-                            _navigation.directions += char(_incomingData.data[i]);
-                            i++;
-                        }
-                        i++;
-
-                        // Speed
-                        _navigation.speed = "";
-                        while (i < _incomingData.length && _incomingData.data[i] != 0)
-                        {
-                            _navigation.speed += char(_incomingData.data[i]);
-                            i++;
-                        }
-                        
-                        Serial.println("Navigation data received - Raw fields:");
-                        Serial.println("Title: [" + _navigation.title + "]");
-                        Serial.println("Duration: [" + _navigation.duration + "]");
-                        Serial.println("Distance: [" + _navigation.distance + "]");
-                        Serial.println("ETA: [" + _navigation.eta + "]");
-                        Serial.println("Directions: [" + _navigation.directions + "]");
-                        Serial.println("Speed: [" + _navigation.speed + "]");
-                        
-                        printNavigationDetails();
-                    }
-                    
-                    if (configurationReceivedCallback != nullptr) {
-                        configurationReceivedCallback(ConfigType::CF_NAV_DATA, _navigation.active ? 1 : 0, 0);
-                    }
-                }
-                break;
-                
-            // Mặc định - xử lý các command khác nếu cần
-            default:
-                break;
         }
+#if NAV_ICON_STRICT_CRC
+        if (!checkOff) {
+            return;
+        }
+#endif
     }
-    else if (_incomingData.data[0] == 0xEA) {
-        if (_incomingData.data[4] == 0x7E) {
-            switch (_incomingData.data[5]) {
-                case 0x01: {
-                    // Weather city
-                    String city = "";
-                    for (int c = 7; c < _incomingData.length; c++) {
-                        city += (char)_incomingData.data[c];
-                    }
-                    _weatherCity = city;
-                    
-                    if (configurationReceivedCallback != nullptr) {
-                        configurationReceivedCallback(ConfigType::CF_WEATHER, 0, 1);
-                    }
-                    break;
-                }
-                case 0x02: {
-                    // Hourly forecast
-                    int size = _incomingData.data[6];
-                    int hour = _incomingData.data[7];
-                    
-                    for (int z = 0; z < size; z++) {
-                        if (hour + z >= FORECAST_SIZE) {
-                            break;
-                        }
-                        
-                        // Parse forecast data
-                        // (Implementation depends on your forecast structure)
-                    }
-                    break;
-                }
-            }
+    
+    if (commitNavIcon(_iconAssembler.data(), crc) && configurationReceivedCallback != nullptr) {
+        configurationReceivedCallback(ConfigType::CF_NAV_ICON, NAV_ICON_PARTS - 1, crc);
+    }
+}
+
+// Thay icon đang hiển thị bằng một icon hoàn chỉnh, trả về false nếu không có gì thay đổi
+bool ChronosESP32Patched::commitNavIcon(const uint8_t *icon, uint32_t crc) {
+    if (_navigation.hasIcon && _navigation.iconCRC == crc) {
+        return false;
+    }
+    memcpy(_navigation.icon, icon, ICON_DATA_SIZE);
+    _navigation.hasIcon = true;
+    _navigation.iconCRC = crc;
+    _navigation.changed = NAV_FIELD_ICON;
+    _iconStats.committed++;
+    return true;
+}
+
+// Navigation inactive
+void ChronosESP32Patched::onNavInactive(const ChronosPacket &p) {
+    setNavigationIdle("Inactive", "Start navigation on Google maps");
+    
+    BLOG_I(NAV_STATE, 0);
+    navigationStateReceived();
+}
+
+// Navigation disabled
+void ChronosESP32Patched::onNavDisabled(const ChronosPacket &p) {
+    setNavigationIdle("Disabled", "Check Chronos app settings");
+    
+    BLOG_I(NAV_STATE, 2);
+    navigationStateReceived();
+}
+
+// Đưa dữ liệu điều hướng về trạng thái nghỉ, ghi lại các trường thực sự thay đổi
+void ChronosESP32Patched::setNavigationIdle(const char *duration, const char *directions) {
+    NavFieldMask changed = 0;
+    if (_navigation.active || _navigation.isNavigation) {
+        changed |= NAV_FIELD_STATE;
+    }
+    if (_navigation.hasIcon || _navigation.iconCRC != 0xFFFFFFFF) {
+        changed |= NAV_FIELD_ICON;
+    }
+    _navigation.active = false;
+    _navigation.isNavigation = false;
+    _navigation.hasIcon = false;
+    _navigation.iconCRC = 0xFFFFFFFF;
+    
+    if (_navigation.title.update("Chronos")) changed |= NAV_FIELD_TITLE;
+    if (_navigation.duration.update(duration)) changed |= NAV_FIELD_DURATION;
+    if (_navigation.distance.update("")) changed |= NAV_FIELD_DISTANCE;
+    if (_navigation.eta.update("Navigation")) changed |= NAV_FIELD_ETA;
+    if (_navigation.directions.update(directions)) changed |= NAV_FIELD_DIRECTIONS;
+    if (_navigation.speed.update("")) changed |= NAV_FIELD_SPEED;
+    _navigation.distanceMeters = NAV_VALUE_UNKNOWN;
+    _navigation.durationSeconds = NAV_VALUE_UNKNOWN;
+    _navigation.etaMinutes = NAV_VALUE_UNKNOWN;
+    _navigation.changed = changed;
+}
+
+// Đọc một trường kết thúc bằng NUL bắt đầu từ pos, trả về vị trí trường kế tiếp.
+// Chữ có dấu rời được ghép về dạng dựng sẵn (NFC) ngay tại đây để font chỉ phải
+// tra một glyph cho mỗi ký tự. Bit của trường được bật trong changed nếu nội dung
+// khác giá trị cũ.
+template <size_t N>
+static int readNavField(const ChronosPacket &p, int pos, FixedString<N> &out, NavFieldMask bit, NavFieldMask &changed) {
+    if (pos >= p.length) {
+        if (out.update("", 0)) {
+            changed |= bit;
+        }
+        return pos;
+    }
+    const uint8_t *start = p.data + pos;
+    const uint8_t *end = (const uint8_t *)memchr(start, 0, p.length - pos);
+    size_t len = end != nullptr ? (size_t)(end - start) : (size_t)(p.length - pos);
+    int next = pos + (int)len + 1;
+    const char *text = (const char *)start;
+    char composed[N];
+    if (VietNfc::hasCombiningMarks(text, len)) {
+        // Dừng khi đầy N byte: update() vẫn thấy chuỗi dài hơn dung lượng và cắt như cũ
+        len = VietNfc::normalize(text, len, composed, sizeof(composed));
+        text = composed;
+    }
+    if (out.update(text, len)) {
+        changed |= bit;
+    }
+    return next;
+}
+
+// Navigation data
+void ChronosESP32Patched::onNavData(const ChronosPacket &p) {
+    bool hasIcon = p.data[6] == 1;
+    bool isNavigation = p.data[7] == 1;
+    uint32_t iconCRC = uint32_t(p.data[8] << 24) | uint32_t(p.data[9] << 16) | uint32_t(p.data[10] << 8) | uint32_t(p.data[11]);
+
+    NavFieldMask changed = 0;
+    if (!_navigation.active || _navigation.isNavigation != isNavigation) {
+        changed |= NAV_FIELD_STATE;
+    }
+    _navigation.active = true;
+    _navigation.isNavigation = isNavigation;
+    
+    // iconCRC của _navigation luôn là CRC của icon đang nằm trong _navigation.icon.
+    // Icon mới: lấy ngay từ cache nếu có, nếu không giữ icon cũ tới khi đủ ba phần 0xEE.
+    if (!hasIcon) {
+        if (_navigation.hasIcon) {
+            _navigation.hasIcon = false;
+            changed |= NAV_FIELD_ICON;
+        }
+    } else if (!_navigation.hasIcon || _navigation.iconCRC != iconCRC) {
+        const uint8_t *cached = _iconCache.find(iconCRC);
+        BLOG_D(NAV_ICON_CACHE, iconCRC, cached != nullptr);
+        if (cached != nullptr) {
+            _iconStats.cacheHits++;
+            commitNavIcon(cached, iconCRC);
+            changed |= NAV_FIELD_ICON;
+        } else {
+            _iconStats.cacheMisses++;
+        }
+    }
+
+    // Các trường kết thúc bằng NUL, đọc một lượt vào buffer cố định (không cấp phát heap)
+    // Thứ tự các trường theo đúng thư viện gốc
+    int i = 12;
+    i = readNavField(p, i, _navigation.title, NAV_FIELD_TITLE, changed);
+    i = readNavField(p, i, _navigation.duration, NAV_FIELD_DURATION, changed);
+    i = readNavField(p, i, _navigation.distance, NAV_FIELD_DISTANCE, changed);
+    i = readNavField(p, i, _navigation.eta, NAV_FIELD_ETA, changed);
+    i = readNavField(p, i, _navigation.directions, NAV_FIELD_DIRECTIONS, changed);
+    readNavField(p, i, _navigation.speed, NAV_FIELD_SPEED, changed);
+    
+    // Đổi sang số một lần cho mỗi trường vừa đổi, cảnh báo và logic khác dùng số nguyên
+    if (changed & NAV_FIELD_DISTANCE) {
+        _navigation.distanceMeters = navParseDistanceMeters(_navigation.distance.c_str());
+    }
+    if (changed & NAV_FIELD_DURATION) {
+        _navigation.durationSeconds = navParseDurationSeconds(_navigation.duration.c_str());
+    }
+    if (changed & NAV_FIELD_ETA) {
+        _navigation.etaMinutes = navParseEtaMinutes(_navigation.eta.c_str());
+    }
+    _navigation.changed = changed;
+    
+    BLOG_D(NAV_DATA, _navigation.title.length(), _navigation.distance.length(),
+           _navigation.directions.length(), _navigation.speed.length());
+    navigationStateReceived();
+}
+
+// Báo trạng thái navigation cho ứng dụng sau mỗi gói 0xEF (value2: mặt nạ NAV_FIELD_*)
+// Subcommand điều hướng chưa có trong bảng: vẫn báo CF_NAV_DATA như trước, không trường nào đổi
+void ChronosESP32Patched::onNavOther(const ChronosPacket &p) {
+    _navigation.changed = 0;
+    navigationStateReceived();
+}
+
+void ChronosESP32Patched::navigationStateReceived() {
+    if (configurationReceivedCallback != nullptr) {
+        configurationReceivedCallback(ConfigType::CF_NAV_DATA, _navigation.active ? 1 : 0, _navigation.changed);
+    }
+}
+
+#if CHRONOS_HAS(WEATHER)
+// Weather city
+void ChronosESP32Patched::onWeatherCity(const ChronosPacket &p) {
+    _weatherCity.assign((const char *)p.data + 7, p.length - 7);
+    
+    if (configurationReceivedCallback != nullptr) {
+        configurationReceivedCallback(ConfigType::CF_WEATHER, 0, 1);
+    }
+}
+
+// Hourly forecast: mỗi giờ gồm 6 byte (gió[2], độ ẩm, nhiệt độ, icon|uv)
+void ChronosESP32Patched::onHourlyForecast(const ChronosPacket &p) {
+    int size = p.data[6];
+    int hour = p.data[7];
+    
+    for (int z = 0; z < size; z++) {
+        int base = 8 + (6 * z);
+        if (hour + z >= FORECAST_SIZE || base + 6 > p.length) {
+            break;
         }
+        
+        HourlyForecast &f = _hourlyForecast[hour + z];
+        f.day = this->getDayofYear();
+        f.hour = hour + z;
+        f.wind = (p.data[base] * 256) + p.data[base + 1];
+        f.humidity = p.data[base + 2];
+        f.temp = (int8_t)p.data[base + 3];
+        f.icon = p.data[base + 4] >> 4;
+        f.uv = p.data[base + 5] & 0x0F;
     }
     
-    // Reset buffer after processing
-    _incomingData.length = 0;
+    if (configurationReceivedCallback != nullptr) {
+        configurationReceivedCallback(ConfigType::CF_WEATHER, 0, 2);
+    }
+}
+
+HourlyForecast ChronosESP32Patched::getForecastHour(int hour) {
+    if (hour < 0 || hour >= FORECAST_SIZE) {
+        return HourlyForecast();
+    }
+    return _hourlyForecast[hour];
+}
+#endif
+
+#if CHRONOS_HAS(QR)
+const char *ChronosESP32Patched::getQrAt(int index) {
+    if (index < 0 || index >= QR_SIZE) {
+        return "";
+    }
+    return _qrLinks[index].c_str();
+}
+#endif
+
+#if CHRONOS_HAS(CONTACTS)
+void ChronosESP32Patched::setContact(int index, Contact contact) {
+    if (index < 0 || index >= CONTACTS_SIZE) {
+        return;
+    }
+    _contacts[index] = contact;
+    if (index >= _contactSize) {
+        _contactSize = index + 1;
+    }
 }
 
-// Hàm hỗ trợ tách tiêu đề và nội dung thông báo
-void ChronosESP32Patched::splitTitle(const String &input, String &title, String &message, int icon) {
-    int pos = input.indexOf('\n');
-    if (pos > 0) {
-        title = input.substring(0, pos);
-        message = input.substring(pos + 1);
+Contact ChronosESP32Patched::getContact(int index) {
+    if (index < 0 || index >= _contactSize) {
+        return Contact();
+    }
+    return _contacts[index];
+}
+
+int ChronosESP32Patched::getContactCount() {
+    return _contactSize;
+}
+
+Contact ChronosESP32Patched::getSoSContact() {
+    return getContact(_sosContact);
+}
+
+void ChronosESP32Patched::setSOSContactIndex(int index) {
+    _sosContact = index;
+}
+
+int ChronosESP32Patched::getSOSContactIndex() {
+    return _sosContact;
+}
+#endif
+
+#if CHRONOS_HAS(NOTIFICATIONS)
+// Hàm hỗ trợ tách tiêu đề và nội dung thông báo (phân cách bằng dòng mới đầu tiên)
+void ChronosESP32Patched::splitTitle(const char *input, size_t length, NotifTitleText &title, NotifMessageText &message) {
+    const char *newline = (const char *)memchr(input, '\n', length);
+    if (newline != nullptr && newline != input) {
+        size_t pos = newline - input;
+        title.assign(input, pos);
+        message.assign(newline + 1, length - pos - 1);
     } else {
-        title = input;
-        message = "";
+        title.assign(input, length);
+        message.clear();
     }
 }
+#endif
 
 // Phương thức hỗ trợ giải mã UTF-8 - Đơn giản hóa
 String ChronosESP32Patched::decodeUTF8(const uint8_t* data, int length) {
@@ -715,14 +993,21 @@ String ChronosESP32Patched::decodeUTF8(const uint8_t* data, int length) {
     }
     
     // ESP32 Arduino String đã hỗ trợ UTF-8, chỉ cần chuyển đổi từ uint8_t* sang char*
-    String result;
-    result.reserve(length);
+    size_t n = strnlen((const char *)data, length);
+    const char *text = (const char *)data;
     
-    for (int i = 0; i < length && data[i] != 0; i++) {
-        result += (char)data[i];
+    // Chuẩn hóa NFC vào buffer trên stack như readNavField (dữ liệu lấy từ một gói nên
+    // không quá DATA_SIZE byte); String chỉ được dựng một lần từ chuỗi đã kết thúc NUL
+    char composed[DATA_SIZE + 1];
+    if (VietNfc::hasCombiningMarks(text, n)) {
+        n = VietNfc::normalize(text, n, composed, DATA_SIZE);
+    } else {
+        n = n < DATA_SIZE ? n : DATA_SIZE;
+        memcpy(composed, text, n);
     }
+    composed[n] = 0;
     
-    return result;
+    return String(composed);
 }
 
 void ChronosESP32Patched::sendInfo() {
@@ -769,10 +1054,7 @@ void ChronosESP32Patched::loop() {
     }
 }
 
-Navigation ChronosESP32Patched::getNavigation() {
-    // Print navigation details with our specific format
-    printNavigationDetails();
-    
+const Navigation &ChronosESP32Patched::getNavigation() {
     return _navigation;
 }
 
@@ -38,6 +38,12 @@
 #include <Arduino.h>
 #include <NimBLEDevice.h>
 #include <ESP32Time.h>
+#include "ChronosReassembler.h"
+#include "SpscQueue.h"
+#include "FixedString.h"
+#include "NavigationFields.h"
+#include "NavIconCache.h"
+#include "NavUnits.h"
 
 #define CHRONOSESP_VERSION_MAJOR 1
 #define CHRONOSESP_VERSION_MINOR 8
@@ -45,15 +51,64 @@
 
 #define CHRONOSESP_VERSION F(CHRONOSESP_VERSION_MAJOR "." CHRONOSESP_VERSION_MINOR "." CHRONOSESP_VERSION_PATCH)
 
+/*
+ * Các phân hệ giao thức tùy chọn (CHRONOS_FEATURES). Phân hệ bị tắt không có
+ * bộ nhớ trong ChronosESP32Patched, không có mục trong bảng lệnh, không có
+ * handler/API và gói tương ứng bị bỏ qua như lệnh lạ. Điều hướng, thời gian,
+ * pin, camera, tìm thiết bị và thông tin ứng dụng luôn được biên dịch.
+ *
+ *   -DCHRONOS_FEATURES=CHRONOS_FEATURES_NAV_ONLY   chỉ điều hướng
+ *   -DCHRONOS_FEATURES=CHRONOS_FEATURE_WEATHER     điều hướng + thời tiết
+ */
+#define CHRONOS_FEATURE_NOTIFICATIONS (1 << 0) // thông báo + cuộc gọi đến
+#define CHRONOS_FEATURE_WEATHER (1 << 1)       // thời tiết theo ngày + dự báo theo giờ
+#define CHRONOS_FEATURE_ALARMS (1 << 2)
+#define CHRONOS_FEATURE_CONTACTS (1 << 3)
+#define CHRONOS_FEATURE_QR (1 << 4)
+#define CHRONOS_FEATURE_HEALTH (1 << 5) // yêu cầu đo và gửi bản ghi sức khỏe
+#define CHRONOS_FEATURES_NAV_ONLY 0
+#define CHRONOS_FEATURES_ALL 0x3F
+
+#ifndef CHRONOS_FEATURES
+#define CHRONOS_FEATURES CHRONOS_FEATURES_ALL
+#endif
+
+#define CHRONOS_HAS(feature) ((CHRONOS_FEATURES & CHRONOS_FEATURE_##feature) != 0)
+
 #define NOTIF_SIZE 10
 #define WEATHER_SIZE 7
 #define ALARM_SIZE 8
-#define DATA_SIZE 512
 #define FORECAST_SIZE 24
 #define QR_SIZE 9
 #define ICON_SIZE 48
 #define ICON_DATA_SIZE (ICON_SIZE * ICON_SIZE) / 8
-#define CONTACTS_SIZE 255
+#ifndef CONTACTS_SIZE
+#define CONTACTS_SIZE 255 // chỉ số danh bạ trong gói là một byte
+#endif
+
+// Dung lượng (kể cả NUL) các chuỗi trạng thái giao thức, tất cả nằm inline trong
+// ChronosESP32Patched nên RAM của chúng cố định lúc link. Chuỗi dài hơn bị cắt
+// tại ranh giới UTF-8 (FixedString).
+#define NOTIF_APP_SIZE 24
+#define NOTIF_TIME_SIZE 16
+#define NOTIF_TITLE_SIZE 64
+#define NOTIF_MESSAGE_SIZE 256
+#define CONTACT_NAME_SIZE 32
+#define CONTACT_NUMBER_SIZE 20
+#define QR_LINK_SIZE 256
+#define WEATHER_CITY_SIZE 48
+#define WEATHER_TIME_SIZE 16
+#define APP_VERSION_SIZE 16
+
+#define CHRONOS_RX_QUEUE_SIZE CHRONOS_RX_SLOTS // gói đã ghép chờ xử lý trên task chính
+#define CHRONOS_DEFAULT_MTU 23                // ATT MTU trước khi thương lượng (khung cũ 20 byte)
+#define CHRONOS_PREFERRED_MTU 517             // ATT MTU đề nghị khi kết nối
+#define CHRONOS_NOTIFY_RETRIES 5              // số lần thử lại khi NimBLE hết buffer notify
+
+// 1: đếm lần ghi BLE và so free heap trước/sau onWrite để phát hiện cấp phát
+#ifndef CHRONOS_WRITE_STATS
+#define CHRONOS_WRITE_STATS 0
+#endif
 
 #define SERVICE_UUID "6e400001-b5a3-f393-e0a9-e50e24dcca9e"
 #define CHARACTERISTIC_UUID_RX "6e400002-b5a3-f393-e0a9-e50e24dcca9e"
@@ -79,13 +134,24 @@ enum SleepType
 	SLEEP_DEEP = 2,
 };
 
+typedef FixedString<NOTIF_APP_SIZE> NotifAppText;
+typedef FixedString<NOTIF_TIME_SIZE> NotifTimeText;
+typedef FixedString<NOTIF_TITLE_SIZE> NotifTitleText;
+typedef FixedString<NOTIF_MESSAGE_SIZE> NotifMessageText;
+typedef FixedString<CONTACT_NAME_SIZE> ContactNameText;
+typedef FixedString<CONTACT_NUMBER_SIZE> ContactNumberText;
+typedef FixedString<QR_LINK_SIZE> QrLinkText;
+typedef FixedString<WEATHER_CITY_SIZE> WeatherCityText;
+typedef FixedString<WEATHER_TIME_SIZE> WeatherTimeText;
+typedef FixedString<APP_VERSION_SIZE> AppVersionText;
+
 struct Notification
 {
 	int icon;
-	String app;
-	String time;
-	String title;
-	String message;
+	NotifAppText app;
+	NotifTimeText time;
+	NotifTitleText title;
+	NotifMessageText message;
 };
 
 struct Weather
@@ -117,12 +183,6 @@ struct ChronosTimer
 	bool active;
 };
 
-struct ChronosData
-{
-	int length;
-	uint8_t data[DATA_SIZE];
-};
-
 struct Alarm
 {
 	uint8_t hour;
@@ -151,20 +211,31 @@ struct Navigation
 	bool active = false;		  // whether running or not
 	bool isNavigation = false;	  // navigation or general info
 	bool hasIcon = false;		  // icon present in the navigation data
-	String distance;			  // distance to destination
-	String duration;			  // time to destination
-	String eta;					  // estimated time of arrival (time,date)
-	String title;				  // distance to next point or title
-	String directions;			  // place info ie current street name/ instructions
-	String speed;				  // speed (available via OsmAnd app)
+	NavDistanceText distance;	  // distance to destination
+	NavDurationText duration;	  // time to destination
+	NavEtaText eta;				  // estimated time of arrival (time,date)
+	NavTitleText title;			  // distance to next point or title
+	NavDirectionsText directions; // place info ie current street name/ instructions
+	NavSpeedText speed;			  // speed (available via OsmAnd app)
+	int32_t distanceMeters = NAV_VALUE_UNKNOWN;  // distance parsed at ingest (NavUnits.h)
+	int32_t durationSeconds = NAV_VALUE_UNKNOWN; // duration parsed at ingest
+	int16_t etaMinutes = NAV_VALUE_UNKNOWN;      // ETA as minutes since midnight
 	uint8_t icon[ICON_DATA_SIZE]; // navigation icon 48x48 (1bpp)
 	uint32_t iconCRC;			  // to identify whether the icon has changed
+	NavFieldMask changed = 0;	  // NAV_FIELD_* bits changed by the last navigation packet
+};
+
+// Gói tin đã ghép, độ dài đã được kiểm tra theo bảng lệnh trước khi tới handler
+struct ChronosPacket
+{
+	const uint8_t *data;
+	int length;
 };
 
 struct Contact
 {
-	String name;
-	String number;
+	ContactNameText name;
+	ContactNumberText number;
 };
 
 struct DateTime
@@ -256,6 +327,34 @@ enum ChronosScreen
 	CS_466x466_143_CTT = 34	 // 466x466, 1.43 inches, Round, True, True
 };
 
+// Thống kê đường nhận onWrite (CHRONOS_WRITE_STATS=1)
+//
+// heapChangedWrites chỉ để tham khảo: so free heap trước/sau không thấy cấp phát
+// rồi giải phóng ngay trong callback, và task khác cấp phát cùng lúc cũng làm nó
+// tăng. Kiểm tra thật là make -C tools/replay check-alloc (đếm operator new).
+struct ChronosWriteStats
+{
+	uint32_t writes;            // số lần ghi vào characteristic RX
+	uint32_t bytes;             // tổng số byte nhận được
+	uint32_t heapChangedWrites; // số lần free heap sau onWrite khác lúc bắt đầu
+};
+
+/**
+ * Characteristic RX cho phép đọc thẳng giá trị NimBLE vừa ghi.
+ *
+ * getValue() của NimBLE trả về bản sao NimBLEAttValue (cấp phát heap mỗi lần
+ * ghi); value() trả về tham chiếu tới buffer nội bộ, chỉ dùng trong onWrite
+ * trên task NimBLE host, nơi giá trị không bị ghi đè.
+ */
+class ChronosRxCharacteristic : public NimBLECharacteristic
+{
+public:
+	ChronosRxCharacteristic(const char *uuid, uint16_t properties, NimBLEService *pService)
+		: NimBLECharacteristic(uuid, properties, BLE_ATT_ATTR_MAX_LEN, pService) {}
+
+	const NimBLEAttValue &value() const { return m_value; }
+};
+
 class ChronosESP32Patched : public BLEServerCallbacks, public BLECharacteristicCallbacks, public ESP32Time
 {
 
@@ -266,6 +365,8 @@ public:
 	void begin();														  // initializes BLE server
 	void stop(bool clearAll = true);									  // stop the BLE server
 	void loop();														  // handles routine functions
+	int processPackets();												  // parse queued packets (call from the app task)
+	void resetNavigation();												  // forget nav state after disconnect (call from the app task)
 	bool isRunning();													  // check whether BLE server is inited and running
 	void setName(String name);											  // set the BLE name (call before begin)
 	void setScreen(ChronosScreen screen);								  // set the screen config (call before begin)
@@ -279,27 +380,34 @@ public:
 	void setBattery(uint8_t level, bool charging = false);
 	bool isCameraReady();
 
+#if CHRONOS_HAS(NOTIFICATIONS)
 	// notifications
 	int getNotificationCount();
-	Notification getNotificationAt(int index);
+	const Notification &getNotificationAt(int index);
 	void clearNotifications();
+#endif
 
+#if CHRONOS_HAS(WEATHER)
 	// weather
 	int getWeatherCount();
-	String getWeatherCity();
-	String getWeatherTime();
+	const char *getWeatherCity();
+	const char *getWeatherTime();
 	Weather getWeatherAt(int index);
 	HourlyForecast getForecastHour(int hour);
+#endif
 
 	// extras
 	RemoteTouch getTouch();
-	String getQrAt(int index);
-	void setQr(int index, String qr);
+#if CHRONOS_HAS(QR)
+	const char *getQrAt(int index);
+	void setQr(int index, const char *qr);
+#endif
 	void restart();
 	// TODO (settings)
 	// isQuietActive
 	// isSleepActive
 
+#if CHRONOS_HAS(ALARMS)
 	// alarms
 	Alarm getAlarm(int index);
 	void setAlarm(int index, Alarm alarm);
@@ -307,6 +415,7 @@ public:
 	// alarm active callback
 	// isAlarmActive
 	// getActiveAlarms
+#endif
 
 	// control
 	void sendCommand(uint8_t *command, size_t length, bool force_chunked = false);
@@ -322,12 +431,13 @@ public:
 
 	// app info
 	int getAppCode();
-	String getAppVersion();
+	const char *getAppVersion();
 
 	// navigation
-	Navigation getNavigation();
+	const Navigation &getNavigation();
 	void printNavigationDetails(); // Helper to print navigation details
 
+#if CHRONOS_HAS(CONTACTS)
 	// contacts
 	void setContact(int index, Contact contact);
 	Contact getContact(int index);
@@ -335,7 +445,9 @@ public:
 	Contact getSoSContact();
 	void setSOSContactIndex(int index);
 	int getSOSContactIndex();
+#endif
 
+#if CHRONOS_HAS(HEALTH)
 	// health data
 	void sendRealtimeSteps(uint32_t steps, uint32_t calories);
 	void sendRealtimeHeartRate(uint8_t heartRate);
@@ -356,6 +468,7 @@ public:
 	void sendBloodOxygenRecord(uint8_t bloodOxygen, DateTime dateTime);
 	void sendTemperatureRecord(float temperature, DateTime dateTime);
 	void sendSleepRecord(uint16_t sleepTime, SleepType type, DateTime dateTime);
+#endif
 
 	// helper functions for ESP32Time
 	int getHourC();					   // return hour based on 24-hour variable (0-12 or 0-23)
@@ -364,12 +477,24 @@ public:
 
 	// callbacks
 	void setConnectionCallback(void (*callback)(bool));
-	void setNotificationCallback(void (*callback)(Notification));
-	void setRingerCallback(void (*callback)(String, bool));
+#if CHRONOS_HAS(NOTIFICATIONS)
+	void setNotificationCallback(void (*callback)(const Notification &));
+	void setRingerCallback(void (*callback)(const char *, bool));
+#endif
 	void setConfigurationCallback(void (*callback)(ConfigType, uint32_t, uint32_t));
 	void setDataCallback(void (*callback)(uint8_t *, int));
 	void setRawDataCallback(void (*callback)(uint8_t *, int));
+#if CHRONOS_HAS(HEALTH)
 	void setHealthRequestCallback(void (*callback)(HealthRequest, bool));
+#endif
+
+	// diagnostics
+	const ChronosReassemblerStats &getReassemblerStats();
+	const NavIconStats &getNavIconStats();
+	uint32_t getRxQueueOverflows();
+	uint32_t getRxQueueHighWater();
+	uint16_t getMTU();
+	const ChronosWriteStats &getWriteStats();
 
 private:
     String _watchName = "MrVocSi";
@@ -388,34 +513,53 @@ private:
     bool _notifyPhone = true;
     bool _sendESP;
     bool _chunked;
+    // ATT MTU của kết nối hiện tại, ghi bởi callback NimBLE và đọc khi gửi lệnh
+    volatile uint16_t _mtu;
 
+#if CHRONOS_HAS(NOTIFICATIONS)
     Notification _notifications[NOTIF_SIZE];
     int _notificationIndex;
+#endif
 
+#if CHRONOS_HAS(WEATHER)
     Weather _weather[WEATHER_SIZE];
-    String _weatherCity;
-    String _weatherTime;
+    WeatherCityText _weatherCity;
+    WeatherTimeText _weatherTime;
     int _weatherSize;
 
     HourlyForecast _hourlyForecast[FORECAST_SIZE];
+#endif
 
     RemoteTouch _touch;
 
     int _appCode;
-    String _appVersion;
+    AppVersionText _appVersion;
 
+#if CHRONOS_HAS(ALARMS)
     Alarm _alarms[ALARM_SIZE];
+#endif
 
-    String _qrLinks[QR_SIZE];
+#if CHRONOS_HAS(QR)
+    QrLinkText _qrLinks[QR_SIZE];
+#endif
 
+#if CHRONOS_HAS(CONTACTS)
     Contact _contacts[CONTACTS_SIZE];
     int _sosContact;
     int _contactSize;
+#endif
 
     ChronosTimer _infoTimer;
     ChronosTimer _findTimer;
 
-    ChronosData _incomingData;
+    ChronosReassembler _reassembler;
+    // Icon điều hướng: ghép ba phần vào buffer tạm, kiểm tra CRC rồi mới đưa vào _navigation
+    NavIconAssembler _iconAssembler;
+    NavIconCache _iconCache;
+    NavIconStats _iconStats = {};
+    ChronosWriteStats _writeStats = {};
+    // Gói đã ghép được chuyển từ callback NimBLE sang task chính qua hàng đợi này
+    SpscQueue<ChronosData *, CHRONOS_RX_QUEUE_SIZE> _rxQueue;
     ChronosData _outgoingData;
 
     ChronosScreen _screenConf = CS_240x240_128_CTF;
@@ -426,18 +570,24 @@ private:
     static bool _navigationDetailsUpdated;
 
     void (*connectionChangeCallback)(bool) = nullptr;
-    void (*notificationReceivedCallback)(Notification) = nullptr;
-    void (*ringerAlertCallback)(String, bool) = nullptr;
+#if CHRONOS_HAS(NOTIFICATIONS)
+    void (*notificationReceivedCallback)(const Notification &) = nullptr;
+    void (*ringerAlertCallback)(const char *, bool) = nullptr;
+#endif
     void (*configurationReceivedCallback)(ConfigType, uint32_t, uint32_t) = nullptr;
     void (*dataReceivedCallback)(uint8_t *, int) = nullptr;
     void (*rawDataReceivedCallback)(uint8_t *, int) = nullptr;
+#if CHRONOS_HAS(HEALTH)
     void (*healthRequestCallback)(HealthRequest, bool) = nullptr;
+#endif
 
     void sendInfo();
     void sendBattery();
     void sendESP();
 
-    void splitTitle(const String &input, String &title, String &message, int icon);
+#if CHRONOS_HAS(NOTIFICATIONS)
+    void splitTitle(const char *input, size_t length, NotifTitleText &title, NotifMessageText &message);
+#endif
     // Phương thức hỗ trợ xử lý chuỗi UTF-8
     String decodeUTF8(const uint8_t* data, int length);
     
@@ -448,15 +598,78 @@ private:
     String flashMode(FlashMode_t mode);	// from BLEServerCallbacks
 	virtual void onConnect(NimBLEServer *pServer, NimBLEConnInfo &connInfo) override;
 	virtual void onDisconnect(NimBLEServer *pServer, NimBLEConnInfo &connInfo, int reason) override;
+	virtual void onMTUChange(uint16_t MTU, NimBLEConnInfo &connInfo) override;
 
 	// from BLECharacteristicCallbacks
 	virtual void onWrite(NimBLECharacteristic *pCharacteristic, NimBLEConnInfo &connInfo) override;
 	virtual void onSubscribe(NimBLECharacteristic *pCharacteristic, NimBLEConnInfo &connInfo, uint16_t subValue) override;
 
-	void dataReceived();
+	void dataReceived(const ChronosData &packet);
+
+	// bảng lệnh: (family, command, subcommand) -> handler
+#ifdef CHRONOS_DISPATCH_BENCH
+	friend struct DispatchBench; // tools/replay/dispatch_bench.cpp
+#endif
+	typedef void (ChronosESP32Patched::*CommandHandler)(const ChronosPacket &);
+	static const int16_t CMD_ANY = -1; // không kiểm tra subcommand / frame
+
+	struct CommandEntry
+	{
+		uint8_t family;	   // byte 0: 0xAB hoặc 0xEA
+		uint8_t command;   // byte 4
+		int16_t sub;	   // byte 5 hoặc CMD_ANY
+		int16_t frame;	   // byte 3 (0xFE/0xFF) hoặc CMD_ANY
+		uint8_t minLength; // độ dài gói tối thiểu để handler đọc an toàn
+		CommandHandler handler;
+	};
+
+	static const CommandEntry _commands[];
+	static const size_t _commandCount;
+	static uint8_t _commandIndex[2][256]; // (family, command) -> mục đầu tiên + 1, xây trong begin()
+
+	static void buildCommandIndex();
+	static int familyIndex(uint8_t family);
+	static const CommandEntry *findCommand(const uint8_t *data, int length);
+
+	void onReset(const ChronosPacket &p);
+#if CHRONOS_HAS(HEALTH)
+	void onHealthMeasure(const ChronosPacket &p);
+	void onHealthMeasureAll(const ChronosPacket &p);
+	void onStepsRequest(const ChronosPacket &p);
+	void onSleepRequest(const ChronosPacket &p);
+#endif
+	void onFindWatch(const ChronosPacket &p);
+#if CHRONOS_HAS(NOTIFICATIONS)
+	void onNotification(const ChronosPacket &p);
+#endif
+#if CHRONOS_HAS(ALARMS)
+	void onAlarm(const ChronosPacket &p);
+#endif
+	void onCamera(const ChronosPacket &p);
+	void onHour24(const ChronosPacket &p);
+	void onPhoneBattery(const ChronosPacket &p);
+	void onTime(const ChronosPacket &p);
+#if CHRONOS_HAS(QR)
+	void onQrLink(const ChronosPacket &p);
+	void onQrEnd(const ChronosPacket &p);
+#endif
+	void onAppInfo(const ChronosPacket &p);
+	void onNavIcon(const ChronosPacket &p);
+	void onNavInactive(const ChronosPacket &p);
+	void onNavDisabled(const ChronosPacket &p);
+	void onNavData(const ChronosPacket &p);
+	void onNavOther(const ChronosPacket &p);
+#if CHRONOS_HAS(WEATHER)
+	void onWeatherCity(const ChronosPacket &p);
+	void onHourlyForecast(const ChronosPacket &p);
+#endif
+
+	void navigationStateReceived();
+	void setNavigationIdle(const char *duration, const char *directions);
+	bool commitNavIcon(const uint8_t *icon, uint32_t crc);
 
 	static BLECharacteristic *pCharacteristicTX;
-	static BLECharacteristic *pCharacteristicRX;
+	static ChronosRxCharacteristic *pCharacteristicRX;
 };
 
 #endif
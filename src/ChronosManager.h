@@ -7,6 +7,10 @@
 #include "ChronosTypes.h"
 // Then include ChronosESP32 adapter
 #include "ChronosESP32Adapter.h"
+#include "BinLog.h"
+#include "ChronosCapture.h"
+#include "Seqlock.h"
+#include "EventBus.h"
 
 // Forward declarations
 class LGFX;
@@ -21,27 +25,19 @@ private:
     bool _isNavigating = false;
     String _address;
     
-    // Dữ liệu điều hướng hiện tại
-    AppNavigation _navData;
+    // Ảnh chụp dữ liệu điều hướng duy nhất; UI đọc qua tham chiếu + phiên bản
+    Seqlock<AppNavigation> _nav;
     
-    // Callback khi nhận được biểu tượng điều hướng
-    static void iconCallbackHandler(uint8_t icon, String data) {
-        ChronosManager& instance = getInstance();
-        
-        Serial.println("Received navigation icon: " + String(icon));
-        instance._navData.hasIcon = true;
-        instance.handleConfigChange(ConfigType::CF_NAV_ICON, icon, 0);
-    }
-    
-    // Callback khi trạng thái kết nối thay đổi
+    // Callback khi trạng thái kết nối thay đổi (chạy trên task NimBLE): chỉ
+    // phát sự kiện, phần xử lý chạy trên loop chính khi bus dispatch
     static void connectCallbackHandler(bool connected) {
         ChronosManager& instance = getInstance();
         instance._isConnected = connected;
-        
-        Serial.println(connected ? "BLE connected to Chronos app" : "BLE disconnected from Chronos app");
-        
-        // Gọi hàm xử lý thay đổi kết nối
-        instance.handleConnectionChange(connected);
+        EventBus::getInstance().publish(connected ? EV_CONNECTED : EV_DISCONNECTED);
+    }
+    
+    static void connectionEventHandler(const Event& event, void* context) {
+        static_cast<ChronosManager*>(context)->handleConnectionChange(event.id == EV_CONNECTED);
     }
     
     // Callback khi nhận được thông tin config - thiết kế giống hệt với ví dụ
@@ -50,64 +46,59 @@ private:
         
         switch (config)
         {
-        case ConfigType::CF_NAV_DATA:
-            Serial.print("Navigation state: ");
-            Serial.println(value1 ? "Active" : "Inactive");
+        case ConfigType::CF_NAV_DATA: {
+            BLOG_D(MGR_NAV_STATE, value1);
             
-            // Đánh dấu trạng thái navigation đã thay đổi
+            // value2 là mặt nạ NAV_FIELD_* do parser tính cho gói vừa nhận
+            NavFieldMask changed = (NavFieldMask)value2;
+            if (instance._nav.get().active != (value1 == 1)) {
+                changed |= NAV_FIELD_STATE;
+            }
             instance._isNavigating = value1 == 1;
-            instance._navData.active = value1 == 1;
             
-            // Nếu navigation đang active, lấy dữ liệu navigation
-            if (value1) {
-                if (instance.chronos != nullptr) {
-                    // Lấy thông tin navigation từ đối tượng ChronosESP32
-                    Navigation nav = instance.chronos->getNavigation();
-                    
-                    // Cập nhật dữ liệu navigation theo thứ tự mới
-                    instance._navData.distance = nav.distance;
-                    instance._navData.duration = nav.duration;
-                    instance._navData.eta = nav.eta;
-                    instance._navData.directions = nav.directions;
-                    instance._navData.title = nav.title;
-                    instance._navData.speed = nav.speed;
-                    instance._navData.hasIcon = nav.hasIcon;
-                    instance._navData.isNavigation = nav.isNavigation;
-                    
-                    // Sao chép dữ liệu icon nếu có
-                    if (nav.hasIcon) {
-                        memcpy(instance._navData.icon, nav.icon, ICON_DATA_SIZE);
-                        instance._navData.iconCRC = nav.iconCRC;
-                    }
-                    
-                    // In thông tin debug theo thứ tự mới
-                    Serial.println(nav.distance);
-                    Serial.println(nav.duration);
-                    Serial.println(nav.eta);
-                    Serial.println(nav.directions);
-                    Serial.println(nav.title);
-                    Serial.println(nav.speed);
-                }
+            // Khi đang điều hướng chép các trường đã đổi, khi không chỉ quan tâm trạng thái
+            if (!value1) {
+                changed &= NAV_FIELD_STATE;
+            } else if (changed & NAV_FIELD_STATE) {
+                // Vừa bắt đầu điều hướng: dữ liệu cũ có thể lệch với parser, chép lại toàn bộ
+                changed |= NAV_FIELD_ALL;
             }
+            
+            // Gói không đổi gì: không bump phiên bản, UI không phải làm gì
+            if (changed == 0) {
+                break;
+            }
+            
+            AppNavigation &nav = instance._nav.beginWrite();
+            nav.active = value1 == 1;
+            if (value1 && instance.chronos != nullptr) {
+                instance.applyNavigation(nav, instance.chronos->getNavigation(), changed);
+            }
+            instance._nav.endWrite();
+            
+            if (changed & NAV_FIELD_STATE) {
+                EventBus::getInstance().publish(value1 ? EV_NAV_STARTED : EV_NAV_STOPPED);
+            }
+            EventBus::getInstance().publish(EV_NAV_FIELDS_CHANGED, changed);
             break;
+        }
             
         case ConfigType::CF_NAV_ICON:
-            Serial.print("CF_NAV_ICON Navigation Icon data, position: ");
-            Serial.println(value1);
-            Serial.print("Icon CRC: ");
-            Serial.printf("0x%08X\n", value2);
+            BLOG_D(MGR_NAV_ICON, value1, value2);
             
             // Xử lý khi nhận được dữ liệu icon
             if (instance.chronos != nullptr) {
-                Navigation nav = instance.chronos->getNavigation();
-                instance._navData.hasIcon = nav.hasIcon;
-                instance._navData.iconCRC = nav.iconCRC;
+                const Navigation &nav = instance.chronos->getNavigation();
+                AppNavigation &data = instance._nav.beginWrite();
+                data.hasIcon = nav.hasIcon;
+                data.iconCRC = nav.iconCRC;
                 
                 // Sao chép dữ liệu icon từ Navigation sang AppNavigation
                 if (nav.hasIcon) {
-                    // Sao chép toàn bộ dữ liệu icon
-                    memcpy(instance._navData.icon, nav.icon, ICON_DATA_SIZE);
+                    memcpy(data.icon, nav.icon, ICON_DATA_SIZE);
                 }
+                instance._nav.endWrite();
+                EventBus::getInstance().publish(EV_NAV_ICON_READY, nav.iconCRC);
             }
             break;
             
@@ -116,23 +107,24 @@ private:
             break;
             
         default:
-            Serial.printf("Received config type: %d, values: %u, %u\n", 
-                         (int)config, value1, value2);
+            BLOG_D(MGR_CONFIG, (int)config, value1, value2);
             break;
         }
     }
     
+#if CHRONOS_HAS(NOTIFICATIONS)
     // Callback khi nhận được thông báo
-    static void notificationCallbackHandler(Notification notification) {
+    static void notificationCallbackHandler(const Notification &notification) {
         Serial.print("Notification received at ");
-        Serial.println(notification.time);
+        Serial.println(notification.time.c_str());
         Serial.print("From: ");
-        Serial.print(notification.app);
+        Serial.print(notification.app.c_str());
         Serial.print("\tIcon: ");
         Serial.println(notification.icon);
-        Serial.println(notification.title);
-        Serial.println(notification.message);
+        Serial.println(notification.title.c_str());
+        Serial.println(notification.message.c_str());
     }
+#endif
     
     // Callback khi nhận được thông tin thời gian
     static void timeCallbackHandler(uint8_t hour, uint8_t minute, uint8_t second, uint8_t day, uint8_t month, uint16_t year) {
@@ -151,16 +143,18 @@ public:
     }
     ChronosManager() {
         // Initialize navigation data with default values
-        _navData.active = false;
-        _navData.eta = "Navigation";
-        _navData.title = "MrVocSi";
-        _navData.duration = "";
-        _navData.distance = "";
-        _navData.speed = "";
-        _navData.directions = "";
-        _navData.hasIcon = false;
-        _navData.isNavigation = false;
-        _navData.iconCRC = 0xFFFFFFFF;
+        AppNavigation &nav = _nav.beginWrite();
+        nav.active = false;
+        nav.eta = "Navigation";
+        nav.title = "MrVocSi";
+        nav.duration = "";
+        nav.distance = "";
+        nav.speed = "";
+        nav.directions = "";
+        nav.hasIcon = false;
+        nav.isNavigation = false;
+        nav.iconCRC = 0xFFFFFFFF;
+        _nav.endWrite();
         
         // Tạo đối tượng adapter cho ChronosESP32
         chronos = new ChronosESP32Adapter();
@@ -182,9 +176,15 @@ public:
         if (chronos != nullptr) {
             // Đăng ký các callbacks giống hệt với file ví dụ
             chronos->setConnectionCallback(connectCallbackHandler);
+#if CHRONOS_HAS(NOTIFICATIONS)
             chronos->setNotificationCallback(notificationCallbackHandler);
+#endif
             chronos->setConfigurationCallback(configCallbackHandler);
             
+            // Kết nối/ngắt kết nối được xử lý trên loop chính qua bus sự kiện
+            EventBus::getInstance().subscribe(eventBit(EV_CONNECTED) | eventBit(EV_DISCONNECTED),
+                                              connectionEventHandler, this);
+            
             Serial.println("All callbacks registered successfully");
         }
         
@@ -200,54 +200,37 @@ public:
             
             Serial.println("Chronos Manager initialized");
             Serial.println("BLE address: " + _address);
+            
+#if CHRONOS_CAPTURE
+            // Ghi lại mọi gói BLE thô ra Serial (tools/ble_capture.py extract)
+            ChronosCaptureRecorder::getInstance().start(millis());
+#endif
         } else {
             Serial.println("Failed to initialize ChronosESP32");
         }
     }
     
     void update() {
-        // Gọi loop() của ChronosESP32 để xử lý các tác vụ nội bộ, như trong ví dụ
+        // Phân tích các gói đã nhận từ BLE trên task chính, sau đó gọi loop()
+        // của ChronosESP32 để xử lý các tác vụ nội bộ
         if (chronos != nullptr) {
+            chronos->processPackets();
             chronos->loop();
         }
+#if CHRONOS_CAPTURE
+        ChronosCaptureRecorder::getInstance().flush(Serial);
+#endif
         
-        // Kiểm tra trạng thái kết nối BLE
-        bool currentConnected = isConnected();
-        static bool lastConnected = false;
-        
-        // Xử lý thay đổi trạng thái kết nối
-        if (currentConnected != lastConnected) {
-            if (currentConnected) {
-                // Mới kết nối
-                handleConnectionChange(true);
-                Serial.println("ChronosManager: BLE connected");
-            } else {
-                // Mới ngắt kết nối
-                handleConnectionChange(false);
-                Serial.println("ChronosManager: BLE disconnected");
-            }
-            lastConnected = currentConnected;
-        }
-        
-        // In thông tin điều hướng hiện tại ra Serial mỗi 10 giây
+        // Tóm tắt điều hướng mỗi 10 giây (mức debug của BinLog, không dựng String và
+        // không ghi Serial trên loop chính)
+#if BINLOG_LEVEL >= BINLOG_LEVEL_DEBUG
         static unsigned long lastNavLog = 0;
         if (_isNavigating && millis() - lastNavLog > 10000) {
             lastNavLog = millis();
-            Serial.println("Navigation state: " + String(_isNavigating ? "ACTIVE" : "INACTIVE"));
-            
-            if (_isNavigating) {
-                Serial.println("\n===== CURRENT NAVIGATION DATA =====");
-                Serial.println("- Active: " + String(_navData.active ? "true" : "false"));
-                Serial.println("- HasIcon: " + String(_navData.hasIcon ? "true" : "false"));
-                Serial.println("- IconCRC: 0x" + String(_navData.iconCRC, HEX));
-                Serial.println("- Title: " + _navData.title);
-                Serial.println("- Distance: " + _navData.distance);
-                Serial.println("- Duration: " + _navData.duration);
-                Serial.println("- ETA: " + _navData.eta);
-                Serial.println("- Directions: " + _navData.directions);
-                Serial.println("=================================");
-            }
+            const AppNavigation &nav = _nav.get();
+            BLOG_D(MGR_NAV_SUMMARY, nav.active, nav.hasIcon, nav.iconCRC, nav.directions.length());
         }
+#endif
     }
     
     bool isConnected() {
@@ -261,8 +244,47 @@ public:
         return _isNavigating;
     }
     
-    AppNavigation getNavData() {
-        return _navData;
+    // Ảnh chụp điều hướng hiện tại, chỉ đọc trên task chính (cùng task với parser);
+    // task khác dùng getNavSnapshot().read() để lấy bản sao nhất quán
+    const AppNavigation &getNavData() const {
+        return _nav.get();
+    }
+    
+    // Tăng mỗi khi ảnh chụp điều hướng thay đổi
+    uint32_t getNavVersion() const {
+        return _nav.version();
+    }
+    
+    const Seqlock<AppNavigation> &getNavSnapshot() const {
+        return _nav;
+    }
+    
+    // Chép các trường có bit trong changed từ dữ liệu của thư viện vào ảnh chụp đang ghi
+    static void applyNavigation(AppNavigation &data, const Navigation &nav, NavFieldMask changed) {
+        data.hasIcon = nav.hasIcon;
+        data.isNavigation = nav.isNavigation;
+        
+        if (changed & NAV_FIELD_DISTANCE) {
+            data.distance = nav.distance;
+            data.distanceMeters = nav.distanceMeters;
+        }
+        if (changed & NAV_FIELD_DURATION) {
+            data.duration = nav.duration;
+            data.durationSeconds = nav.durationSeconds;
+        }
+        if (changed & NAV_FIELD_ETA) {
+            data.eta = nav.eta;
+            data.etaMinutes = nav.etaMinutes;
+        }
+        if (changed & NAV_FIELD_DIRECTIONS) data.directions = nav.directions;
+        if (changed & NAV_FIELD_TITLE) data.title = nav.title;
+        if (changed & NAV_FIELD_SPEED) data.speed = nav.speed;
+        
+        // Sao chép dữ liệu icon nếu có
+        if ((changed & NAV_FIELD_ICON) && nav.hasIcon) {
+            memcpy(data.icon, nav.icon, ICON_DATA_SIZE);
+            data.iconCRC = nav.iconCRC;
+        }
     }
     
     // Gửi lệnh tùy chỉnh đến thiết bị Chronos
@@ -287,8 +309,16 @@ public:
             Serial.println("BLE connected to Chronos app");
         } else {
             Serial.println("BLE disconnected from Chronos app");
+            // Nơi duy nhất dọn trạng thái điều hướng khi mất kết nối: chạy trên loop chính
+            // (EventBus), cùng task với processPackets() nên parser và _nav chỉ có một writer
+            chronos->resetNavigation();
             _isNavigating = false;
-            _navData.active = false;
+            if (_nav.get().active) {
+                _nav.beginWrite().active = false;
+                _nav.endWrite();
+                EventBus::getInstance().publish(EV_NAV_STOPPED);
+                EventBus::getInstance().publish(EV_NAV_FIELDS_CHANGED, NAV_FIELD_STATE);
+            }
         }
     }
     
@@ -351,11 +381,11 @@ public:
                 
             case AppConfigType::CF_NAV_DATA:
                 _isNavigating = value1 == 1;
-                Serial.printf("Navigation status changed: %s\n", _isNavigating ? "Active" : "Inactive");
+                BLOG_D(MGR_NAV_STATE, value1);
                 break;
                 
             case AppConfigType::CF_NAV_ICON:
-                Serial.printf("Received navigation icon: %d\n", (int)value1);
+                BLOG_D(MGR_NAV_ICON, value1, 0);
                 break;
                 
             default:
@@ -380,39 +410,29 @@ public:
         
         // Nếu kết nối, thử lấy dữ liệu navigation từ thư viện
         if (chronos != nullptr && chronos->isConnected()) {
-            Navigation nav = chronos->getNavigation();
+            const Navigation &nav = chronos->getNavigation();
             
-            // Cập nhật dữ liệu từ thư viện theo thứ tự mới
-            _navData.active = nav.active;
-            _navData.isNavigation = nav.isNavigation;
-            _navData.hasIcon = nav.hasIcon;
-            _navData.iconCRC = nav.iconCRC;
-            _navData.distance = nav.distance;
-            _navData.duration = nav.duration;
-            _navData.eta = nav.eta;
-            _navData.directions = nav.directions;
-            _navData.title = nav.title;
-            _navData.speed = nav.speed;
+            // Cập nhật toàn bộ ảnh chụp từ thư viện
+            AppNavigation &data = _nav.beginWrite();
+            data.active = nav.active;
+            applyNavigation(data, nav, NAV_FIELD_ALL);
+            _nav.endWrite();
             _isNavigating = nav.active;
-            
-            // Sao chép dữ liệu icon nếu có
-            if (nav.hasIcon) {
-                memcpy(_navData.icon, nav.icon, ICON_DATA_SIZE);
-                Serial.println("Copied icon data from library cache");
-            }
+            EventBus::getInstance().publish(EV_NAV_FIELDS_CHANGED, NAV_FIELD_ALL);
             
             Serial.println("\nFetched navigation data from library cache");
         }
         
+        const AppNavigation &data = _nav.get();
         Serial.println("\n----- NAVIGATION DATA -----");
-        Serial.printf("Active: %s\n", _navData.active ? "YES" : "NO");
-        Serial.printf("HasIcon: %s\n", _navData.hasIcon ? "YES" : "NO");
-        Serial.printf("IconCRC: 0x%08X\n", _navData.iconCRC);
-        Serial.printf("Title: %s\n", _navData.title.c_str());
-        Serial.printf("Distance: %s\n", _navData.distance.c_str());
-        Serial.printf("Duration: %s\n", _navData.duration.c_str());
-        Serial.printf("ETA: %s\n", _navData.eta.c_str());
-        Serial.printf("Directions: %s\n", _navData.directions.c_str());
+        Serial.printf("Active: %s\n", data.active ? "YES" : "NO");
+        Serial.printf("HasIcon: %s\n", data.hasIcon ? "YES" : "NO");
+        Serial.printf("IconCRC: 0x%08X\n", data.iconCRC);
+        Serial.printf("Title: %s\n", data.title.c_str());
+        Serial.printf("Distance: %s\n", data.distance.c_str());
+        Serial.printf("Duration: %s\n", data.duration.c_str());
+        Serial.printf("ETA: %s\n", data.eta.c_str());
+        Serial.printf("Directions: %s\n", data.directions.c_str());
         Serial.println("===========================================");
     }
     
@@ -0,0 +1,289 @@
+#ifndef CHRONOS_REASSEMBLER_H
+#define CHRONOS_REASSEMBLER_H
+
+#include <Arduino.h>
+#include <atomic>
+
+#define DATA_SIZE 512
+
+#define CHRONOS_RX_SLOTS 4            // Số gói tin có thể ghép đồng thời
+#define CHRONOS_RX_TIMEOUT_MS 1500    // Gói chưa ghép xong sau thời gian này sẽ bị loại bỏ
+#define CHRONOS_FIRST_FRAGMENT 20     // Phân đoạn đầu theo khung cũ (ATT MTU mặc định 23)
+#define CHRONOS_NEXT_FRAGMENT 19      // Dữ liệu mỗi phân đoạn tiếp theo theo khung cũ (byte đầu là chỉ số)
+#define CHRONOS_MAX_FRAGMENTS 32      // Số phân đoạn tối đa của một gói (bitmap 32 bit)
+
+struct ChronosData
+{
+	int length;
+	uint8_t data[DATA_SIZE];
+};
+
+// Thống kê hoạt động của bộ ghép gói
+struct ChronosReassemblerStats
+{
+	uint32_t fragments;  // tổng số phân đoạn nhận được
+	uint32_t completed;  // số gói đã ghép xong
+	uint32_t evicted;    // gói chưa xong bị loại do quá hạn hoặc hết slot
+	uint32_t dropped;    // phân đoạn bị bỏ do sai độ dài / không còn slot
+	uint32_t orphans;    // phân đoạn tiếp theo không thuộc gói nào
+	uint32_t duplicates; // phân đoạn nhận lặp lại
+	uint32_t bytesCopied; // số byte chép từ phân đoạn vào slot (lần chép duy nhất trên đường nhận)
+};
+
+/**
+ * Bộ ghép gói tin BLE của Chronos.
+ *
+ * Mỗi gói bắt đầu bằng phân đoạn có header 0xAB/0xEA (byte 3 là 0xFE/0xFF),
+ * các phân đoạn tiếp theo có byte đầu là chỉ số phân đoạn. Điện thoại cắt gói
+ * theo ATT MTU đã thương lượng (MTU - 3 byte mỗi lần ghi), nên kích thước
+ * phân đoạn của từng gói được lấy từ độ dài phân đoạn đầu: với MTU 23 đó là
+ * khung cũ 20/19 byte, với MTU lớn hơn gói cần ít phân đoạn hơn. Bộ ghép giữ một
+ * nhóm nhỏ gói đang ghép, đánh dấu từng phân đoạn bằng bitmap và chỉ trả về
+ * gói khi đã nhận đủ. Gói hoàn tất được trả bằng con trỏ tới slot (không sao
+ * chép thêm), người dùng phải gọi release() sau khi xử lý xong. push() chỉ
+ * được gọi từ một task; release() có thể gọi từ task xử lý gói.
+ */
+class ChronosReassembler
+{
+public:
+	ChronosReassembler() { reset(); }
+
+	void reset()
+	{
+		for (int i = 0; i < CHRONOS_RX_SLOTS; i++)
+		{
+			_slots[i].state.store(SLOT_FREE, std::memory_order_relaxed);
+			_slots[i].packet.length = 0;
+			_slots[i].received = 0;
+			_slots[i].expected = 0;
+			_slots[i].startedAt = 0;
+			_slots[i].order = 0;
+			_slots[i].firstSize = CHRONOS_FIRST_FRAGMENT;
+			_slots[i].nextSize = CHRONOS_NEXT_FRAGMENT;
+		}
+		_order = 0;
+		memset(&_stats, 0, sizeof(_stats));
+	}
+
+	// Đưa một phân đoạn vào bộ ghép, trả về gói hoàn tất hoặc nullptr
+	ChronosData *push(const uint8_t *frag, int len, uint32_t now)
+	{
+		if (frag == nullptr || len <= 0)
+		{
+			return nullptr;
+		}
+		_stats.fragments++;
+		evictStale(now);
+
+		if (isHeader(frag, len))
+		{
+			return startPacket(frag, len, now);
+		}
+		return appendFragment(frag, len);
+	}
+
+	// Trả slot của gói đã xử lý xong về nhóm (có thể gọi từ task khác với push)
+	void release(ChronosData *packet)
+	{
+		for (int i = 0; i < CHRONOS_RX_SLOTS; i++)
+		{
+			if (&_slots[i].packet == packet)
+			{
+				_slots[i].state.store(SLOT_FREE, std::memory_order_release);
+				return;
+			}
+		}
+	}
+
+	const ChronosReassemblerStats &stats() const { return _stats; }
+
+	static bool isHeader(const uint8_t *frag, int len)
+	{
+		return len >= 4 && (frag[0] == 0xAB || frag[0] == 0xEA) && (frag[3] == 0xFE || frag[3] == 0xFF);
+	}
+
+private:
+	enum SlotState : uint8_t
+	{
+		SLOT_FREE = 0, // trống
+		SLOT_FILLING,  // đang ghép
+		SLOT_READY,    // đã ghép xong, chờ xử lý
+	};
+
+	struct Slot
+	{
+		ChronosData packet;
+		uint32_t received;  // bitmap phân đoạn đã nhận (bit 0 = phân đoạn đầu)
+		uint32_t expected;  // bitmap phân đoạn cần nhận
+		uint32_t startedAt; // thời điểm nhận phân đoạn đầu
+		uint32_t order;     // thứ tự bắt đầu, dùng để chọn gói mới nhất
+		uint16_t firstSize; // số byte của phân đoạn đầu
+		uint16_t nextSize;  // số byte dữ liệu của mỗi phân đoạn tiếp theo
+		std::atomic<uint8_t> state; // chỉ release() ghi SLOT_FREE từ phía consumer
+	};
+
+	// Gói lớn nhất theo khung cũ (MTU nhỏ nhất) phải vừa bitmap 32 bit
+	static_assert(1 + (DATA_SIZE - CHRONOS_FIRST_FRAGMENT + CHRONOS_NEXT_FRAGMENT - 1) / CHRONOS_NEXT_FRAGMENT <= CHRONOS_MAX_FRAGMENTS,
+				  "DATA_SIZE too large for 32-bit fragment bitmap");
+
+	Slot _slots[CHRONOS_RX_SLOTS];
+	uint32_t _order;
+	ChronosReassemblerStats _stats;
+
+	// Bitmap các phân đoạn của gói, 0 nếu gói cần quá CHRONOS_MAX_FRAGMENTS phân đoạn
+	static uint32_t fragmentMask(int length, int firstSize, int nextSize)
+	{
+		int count = 1;
+		if (length > firstSize)
+		{
+			count += (length - firstSize + nextSize - 1) / nextSize;
+		}
+		if (count > CHRONOS_MAX_FRAGMENTS)
+		{
+			return 0;
+		}
+		return count == 32 ? 0xFFFFFFFF : ((1UL << count) - 1);
+	}
+
+	void evictStale(uint32_t now)
+	{
+		for (int i = 0; i < CHRONOS_RX_SLOTS; i++)
+		{
+			if (_slots[i].state.load(std::memory_order_relaxed) == SLOT_FILLING && now - _slots[i].startedAt > CHRONOS_RX_TIMEOUT_MS)
+			{
+				_slots[i].state.store(SLOT_FREE, std::memory_order_relaxed);
+				_stats.evicted++;
+			}
+		}
+	}
+
+	Slot *acquireSlot()
+	{
+		Slot *oldest = nullptr;
+		for (int i = 0; i < CHRONOS_RX_SLOTS; i++)
+		{
+			uint8_t state = _slots[i].state.load(std::memory_order_acquire);
+			if (state == SLOT_FREE)
+			{
+				return &_slots[i];
+			}
+			if (state == SLOT_FILLING && (oldest == nullptr || _slots[i].order < oldest->order))
+			{
+				oldest = &_slots[i];
+			}
+		}
+		// Hết slot: hy sinh gói đang ghép cũ nhất, không bao giờ đụng tới gói đã xong
+		if (oldest != nullptr)
+		{
+			_stats.evicted++;
+		}
+		return oldest;
+	}
+
+	ChronosData *startPacket(const uint8_t *frag, int len, uint32_t now)
+	{
+		int length = frag[1] * 256 + frag[2] + 3;
+		uint32_t expected = 1;
+		if (len < length)
+		{
+			// Phân đoạn đầu dài đúng MTU - 3, các phân đoạn sau ngắn hơn 1 byte chỉ số
+			expected = len > 1 ? fragmentMask(length, len, len - 1) : 0;
+		}
+		if (length > DATA_SIZE || expected == 0)
+		{
+			_stats.dropped++;
+			return nullptr;
+		}
+
+		Slot *slot = acquireSlot();
+		if (slot == nullptr)
+		{
+			_stats.dropped++;
+			return nullptr;
+		}
+
+		int n = len < length ? len : length;
+		memcpy(slot->packet.data, frag, n);
+		_stats.bytesCopied += n;
+		slot->packet.length = length;
+		slot->received = 1;
+		slot->expected = expected;
+		slot->firstSize = (uint16_t)n;
+		slot->nextSize = (uint16_t)(n - 1);
+		slot->startedAt = now;
+		slot->order = ++_order;
+		slot->state.store(SLOT_FILLING, std::memory_order_relaxed);
+
+		return completeIfReady(slot);
+	}
+
+	ChronosData *appendFragment(const uint8_t *frag, int len)
+	{
+		uint8_t index = frag[0];
+		if (index >= CHRONOS_MAX_FRAGMENTS - 1)
+		{
+			_stats.orphans++;
+			return nullptr;
+		}
+		uint32_t bit = 1UL << (index + 1);
+
+		// Phân đoạn thuộc về gói mới nhất còn thiếu đúng phân đoạn này
+		Slot *target = nullptr;
+		bool duplicate = false;
+		for (int i = 0; i < CHRONOS_RX_SLOTS; i++)
+		{
+			Slot &s = _slots[i];
+			if (s.state.load(std::memory_order_relaxed) != SLOT_FILLING || (s.expected & bit) == 0 || len - 1 > s.nextSize)
+			{
+				continue;
+			}
+			if (s.received & bit)
+			{
+				duplicate = true;
+				continue;
+			}
+			if (target == nullptr || s.order > target->order)
+			{
+				target = &s;
+			}
+		}
+
+		if (target == nullptr)
+		{
+			if (duplicate)
+			{
+				_stats.duplicates++;
+			}
+			else
+			{
+				_stats.orphans++;
+			}
+			return nullptr;
+		}
+
+		int offset = target->firstSize + index * target->nextSize;
+		int n = len - 1;
+		if (offset + n > target->packet.length)
+		{
+			n = target->packet.length - offset;
+		}
+		memcpy(target->packet.data + offset, frag + 1, n);
+		_stats.bytesCopied += n;
+		target->received |= bit;
+
+		return completeIfReady(target);
+	}
+
+	ChronosData *completeIfReady(Slot *slot)
+	{
+		if (slot->received != slot->expected)
+		{
+			return nullptr;
+		}
+		slot->state.store(SLOT_READY, std::memory_order_release);
+		_stats.completed++;
+		return &slot->packet;
+	}
+};
+
+#endif // CHRONOS_REASSEMBLER_H
@@ -0,0 +1,212 @@
+#ifndef DIGIT_ATLAS_H
+#define DIGIT_ATLAS_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <lvgl.h>
+
+/**
+ * Bảng sprite cho số khoảng cách: các glyph trong DIGIT_ATLAS_CHARS được raster
+ * một lần từ font LVGL 4 bpp thành một dải ảnh 4 bit/pixel (mỗi dòng căn byte,
+ * nibble cao là pixel chẵn). Giá trị pixel là độ đậm 0..15 của font; khi vẽ chỉ
+ * cần tra bảng 16 màu đã trộn sẵn chữ/nền, không qua font engine.
+ *
+ * Các chữ số dùng chung một độ rộng ô (chữ số rộng nhất, glyph căn giữa ô) nên
+ * "1,9 km" -> "1,8 km" giữ nguyên vị trí các ô khác: chỉ ô đổi phải vẽ lại.
+ * Mọi ô cao bằng nhau: từ đỉnh glyph cao nhất tới đáy glyph thấp nhất (dấu phẩy).
+ */
+#define DIGIT_ATLAS_CHARS "0123456789., kmift"
+#define DIGIT_ATLAS_MAX_CELLS 12
+
+// Một dòng đã dàn trang: ô i là glyph glyph[i] bắt đầu ở x[i] (px, tính từ trái)
+struct DigitRow
+{
+	uint8_t count = 0;
+	uint16_t width = 0;
+	uint8_t glyph[DIGIT_ATLAS_MAX_CELLS];
+	uint16_t x[DIGIT_ATLAS_MAX_CELLS];
+};
+
+class DigitAtlas
+{
+public:
+	static const uint8_t GLYPH_COUNT = sizeof(DIGIT_ATLAS_CHARS) - 1;
+
+	struct Glyph
+	{
+		uint16_t atlasX; // cột bắt đầu của ô trong atlas
+		uint8_t width;	 // độ rộng ô = bước tiến khi dàn trang
+	};
+
+private:
+	Glyph _glyphs[GLYPH_COUNT];
+	uint8_t *_pixels = nullptr;
+	uint16_t _width = 0;
+	uint16_t _height = 0;
+	uint16_t _stride = 0; // byte mỗi dòng
+
+	static int indexOf(char c)
+	{
+		const char *p = c != '\0' ? strchr(DIGIT_ATLAS_CHARS, c) : nullptr;
+		return p != nullptr ? (int)(p - DIGIT_ATLAS_CHARS) : -1;
+	}
+
+public:
+	DigitAtlas() = default;
+	DigitAtlas(const DigitAtlas &) = delete;
+	DigitAtlas &operator=(const DigitAtlas &) = delete;
+
+	~DigitAtlas()
+	{
+		free(_pixels);
+	}
+
+	bool ready() const { return _pixels != nullptr; }
+	uint16_t width() const { return _width; }
+	uint16_t height() const { return _height; }
+	size_t bytes() const { return (size_t)_stride * _height; }
+	const Glyph &glyph(uint8_t index) const { return _glyphs[index]; }
+
+	// Raster các glyph của font vào atlas. false nếu font thiếu glyph hoặc hết bộ nhớ.
+	bool build(const lv_font_t *font)
+	{
+		free(_pixels);
+		_pixels = nullptr;
+
+		lv_font_glyph_dsc_t dsc[GLYPH_COUNT];
+		uint16_t digitWidth = 0;
+		int top = -32768;
+		int bottom = 32767;
+		for (uint8_t i = 0; i < GLYPH_COUNT; i++)
+		{
+			if (!lv_font_get_glyph_dsc(font, &dsc[i], (uint8_t)DIGIT_ATLAS_CHARS[i], 0) || dsc[i].bpp != 4)
+			{
+				return false;
+			}
+			if (i < 10 && dsc[i].adv_w > digitWidth)
+			{
+				digitWidth = dsc[i].adv_w;
+			}
+			if (dsc[i].box_h > 0)
+			{
+				top = dsc[i].ofs_y + dsc[i].box_h > top ? dsc[i].ofs_y + dsc[i].box_h : top;
+				bottom = dsc[i].ofs_y < bottom ? dsc[i].ofs_y : bottom;
+			}
+		}
+
+		uint16_t x = 0;
+		for (uint8_t i = 0; i < GLYPH_COUNT; i++)
+		{
+			_glyphs[i].atlasX = x;
+			_glyphs[i].width = (uint8_t)(i < 10 ? digitWidth : dsc[i].adv_w);
+			x += _glyphs[i].width;
+		}
+		_width = x;
+		_height = (uint16_t)(top - bottom);
+		_stride = (uint16_t)((_width + 1) / 2);
+		_pixels = (uint8_t *)calloc(bytes(), 1);
+		if (_pixels == nullptr)
+		{
+			return false;
+		}
+
+		for (uint8_t i = 0; i < GLYPH_COUNT; i++)
+		{
+			const uint8_t *bitmap = lv_font_get_glyph_bitmap(font, (uint8_t)DIGIT_ATLAS_CHARS[i]);
+			if (bitmap == nullptr || dsc[i].box_w == 0)
+			{
+				continue;
+			}
+			int cellX = _glyphs[i].atlasX;
+			int left = cellX + (_glyphs[i].width - dsc[i].adv_w) / 2 + dsc[i].ofs_x;
+			int row0 = top - (dsc[i].ofs_y + dsc[i].box_h);
+			for (int gy = 0; gy < dsc[i].box_h; gy++)
+			{
+				for (int gx = 0; gx < dsc[i].box_w; gx++)
+				{
+					// Bitmap của font không căn dòng: pixel n nằm ở nibble thứ n
+					uint32_t n = (uint32_t)gy * dsc[i].box_w + gx;
+					uint8_t alpha = (n & 1) ? bitmap[n >> 1] & 0x0F : bitmap[n >> 1] >> 4;
+					int ax = left + gx;
+					// Phần glyph tràn khỏi ô (phần nhô của f, t) bị cắt để các ô không chồng nhau
+					if (alpha == 0 || ax < cellX || ax >= cellX + _glyphs[i].width)
+					{
+						continue;
+					}
+					uint8_t &b = _pixels[(row0 + gy) * _stride + ax / 2];
+					b |= (ax & 1) ? alpha : (uint8_t)(alpha << 4);
+				}
+			}
+		}
+		return true;
+	}
+
+	// Dàn trang text thành các ô liên tiếp. false nếu có ký tự ngoài atlas hoặc quá dài.
+	bool layout(const char *text, DigitRow &out) const
+	{
+		out.count = 0;
+		out.width = 0;
+		for (; *text != '\0'; text++)
+		{
+			int index = indexOf(*text);
+			if (index < 0 || out.count == DIGIT_ATLAS_MAX_CELLS)
+			{
+				return false;
+			}
+			out.glyph[out.count] = (uint8_t)index;
+			out.x[out.count] = out.width;
+			out.width += _glyphs[index].width;
+			out.count++;
+		}
+		return true;
+	}
+
+	// Gộp các ô khác nhau giữa hai dòng cùng độ rộng thành các khoảng [x1, x2).
+	// Trả về số khoảng; dòng khác độ rộng thì cả dòng là một khoảng.
+	static uint8_t diff(const DigitRow &from, const DigitRow &to, uint16_t *x1, uint16_t *x2)
+	{
+		if (from.width != to.width || from.count != to.count)
+		{
+			x1[0] = 0;
+			x2[0] = from.width > to.width ? from.width : to.width;
+			return x2[0] > 0 ? 1 : 0;
+		}
+		uint8_t spans = 0;
+		for (uint8_t i = 0; i < to.count; i++)
+		{
+			if (from.glyph[i] == to.glyph[i] && from.x[i] == to.x[i])
+			{
+				continue;
+			}
+			uint16_t end = to.x[i] + (i + 1 < to.count ? to.x[i + 1] - to.x[i] : to.width - to.x[i]);
+			if (spans > 0 && x2[spans - 1] == to.x[i])
+			{
+				x2[spans - 1] = end;
+			}
+			else
+			{
+				x1[spans] = to.x[i];
+				x2[spans] = end;
+				spans++;
+			}
+		}
+		return spans;
+	}
+
+	// Chép w pixel của dòng y trong ô glyph (bắt đầu từ cột offset của ô) ra dst,
+	// đổi độ đậm 0..15 thành màu qua lut
+	template <typename Px>
+	void blitRow(Px *dst, uint8_t glyph, uint16_t offset, uint16_t y, uint16_t w, const Px *lut) const
+	{
+		const uint8_t *row = _pixels + (uint32_t)y * _stride;
+		uint32_t x = _glyphs[glyph].atlasX + offset;
+		for (uint16_t i = 0; i < w; i++, x++)
+		{
+			uint8_t b = row[x >> 1];
+			dst[i] = lut[(x & 1) ? b & 0x0F : b >> 4];
+		}
+	}
+};
+
+#endif // DIGIT_ATLAS_H
@@ -0,0 +1,145 @@
+#ifndef EVENT_BUS_H
+#define EVENT_BUS_H
+
+#include <Arduino.h>
+
+#ifndef EVENT_BUS_QUEUE_SIZE
+#define EVENT_BUS_QUEUE_SIZE 16 // số sự kiện chờ dispatch
+#endif
+
+#ifndef EVENT_BUS_MAX_SUBSCRIBERS
+#define EVENT_BUS_MAX_SUBSCRIBERS 8
+#endif
+
+// Mã sự kiện, cố định lúc biên dịch; mỗi mã là một bit trong mặt nạ đăng ký
+enum EventId : uint8_t
+{
+	EV_CONNECTED,          // điện thoại đã kết nối BLE
+	EV_DISCONNECTED,       // mất kết nối BLE
+	EV_NAV_STARTED,        // bắt đầu điều hướng
+	EV_NAV_STOPPED,        // kết thúc điều hướng
+	EV_NAV_FIELDS_CHANGED, // value: mặt nạ NAV_FIELD_* vừa thay đổi
+	EV_NAV_ICON_READY,     // value: CRC của icon vừa được đưa vào ảnh chụp
+	EV_COUNT
+};
+
+static_assert(EV_COUNT <= 32, "EventId must fit a 32-bit subscription mask");
+
+typedef uint32_t EventMask;
+
+constexpr EventMask eventBit(EventId id) { return (EventMask)1 << id; }
+
+struct Event
+{
+	EventId id;
+	uint32_t value;
+	uint32_t timestamp; // millis() lúc publish
+};
+
+typedef void (*EventHandler)(const Event &event, void *context);
+
+/**
+ * Bus sự kiện publish/subscribe, dung lượng cố định, không cấp phát.
+ *
+ * publish() an toàn từ mọi task (callback NimBLE hay loop chính) và chỉ chép
+ * sự kiện vào ring; dispatch() chạy trên loop chính, gọi các subscriber đã
+ * đăng ký mã sự kiện tương ứng. Gọi dispatch() ngay sau ChronosManager::update()
+ * để subscriber phản ứng trong cùng một vòng loop.
+ */
+class EventBus
+{
+public:
+	// Đăng ký handler cho các mã trong mask; trả về false nếu hết chỗ
+	bool subscribe(EventMask mask, EventHandler handler, void *context = nullptr)
+	{
+		if (_subscriberCount >= EVENT_BUS_MAX_SUBSCRIBERS)
+		{
+			return false;
+		}
+		Subscriber &s = _subscribers[_subscriberCount++];
+		s.mask = mask;
+		s.handler = handler;
+		s.context = context;
+		return true;
+	}
+
+	// Trả về false và tăng bộ đếm tràn nếu ring đầy
+	bool publish(EventId id, uint32_t value = 0)
+	{
+		uint32_t now = millis();
+
+		portENTER_CRITICAL(&_lock);
+		if (_head - _tail >= EVENT_BUS_QUEUE_SIZE)
+		{
+			_overflows++;
+			portEXIT_CRITICAL(&_lock);
+			return false;
+		}
+		Event &e = _queue[_head % EVENT_BUS_QUEUE_SIZE];
+		e.id = id;
+		e.value = value;
+		e.timestamp = now;
+		_head++;
+		portEXIT_CRITICAL(&_lock);
+		return true;
+	}
+
+	// Giao mọi sự kiện đang chờ, trả về số sự kiện đã giao
+	size_t dispatch()
+	{
+		size_t count = 0;
+		Event e;
+
+		while (true)
+		{
+			portENTER_CRITICAL(&_lock);
+			if (_tail == _head)
+			{
+				portEXIT_CRITICAL(&_lock);
+				break;
+			}
+			e = _queue[_tail % EVENT_BUS_QUEUE_SIZE];
+			_tail++;
+			portEXIT_CRITICAL(&_lock);
+
+			EventMask bit = eventBit(e.id);
+			for (uint8_t i = 0; i < _subscriberCount; i++)
+			{
+				if (_subscribers[i].mask & bit)
+				{
+					_subscribers[i].handler(e, _subscribers[i].context);
+				}
+			}
+			count++;
+		}
+		return count;
+	}
+
+	uint32_t overflows() const { return _overflows; }
+
+	static EventBus &getInstance()
+	{
+		static EventBus instance;
+		return instance;
+	}
+
+private:
+	struct Subscriber
+	{
+		EventMask mask;
+		EventHandler handler;
+		void *context;
+	};
+
+	EventBus() {}
+
+	Event _queue[EVENT_BUS_QUEUE_SIZE];
+	uint32_t _head = 0; // vị trí ghi tiếp theo
+	uint32_t _tail = 0; // vị trí đọc tiếp theo
+	uint32_t _overflows = 0;
+	Subscriber _subscribers[EVENT_BUS_MAX_SUBSCRIBERS];
+	uint8_t _subscriberCount = 0;
+	portMUX_TYPE _lock = portMUX_INITIALIZER_UNLOCKED;
+};
+
+#endif // EVENT_BUS_H
@@ -0,0 +1,111 @@
+#ifndef FIXED_STRING_H
+#define FIXED_STRING_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * Chuỗi có dung lượng cố định nằm ngay trong struct (không dùng heap).
+ *
+ * N là kích thước buffer kể cả ký tự NUL, nên chuỗi chứa tối đa N - 1 byte.
+ * Khi chuỗi nguồn dài hơn, nó bị cắt tại ranh giới ký tự UTF-8 để không bao
+ * giờ để lại một ký tự tiếng Việt bị cắt dở.
+ */
+template <size_t N>
+class FixedString
+{
+	static_assert(N > 1 && N <= 256, "FixedString size must be in 2..256");
+
+public:
+	FixedString() : _length(0) { _buf[0] = '\0'; }
+	FixedString(const char *s) { assign(s); }
+
+	FixedString &operator=(const char *s)
+	{
+		assign(s);
+		return *this;
+	}
+
+	void assign(const char *s)
+	{
+		assign(s, s != nullptr ? strlen(s) : 0);
+	}
+
+	// Sao chép len byte từ s, cắt tại ranh giới UTF-8 nếu vượt dung lượng.
+	// Trả về false nếu chuỗi bị cắt.
+	bool assign(const char *s, size_t len)
+	{
+		bool fits = len <= capacity();
+		if (!fits)
+		{
+			len = utf8Prefix(s, capacity());
+		}
+		if (len > 0)
+		{
+			memcpy(_buf, s, len);
+		}
+		_buf[len] = '\0';
+		_length = (uint8_t)len;
+		return fits;
+	}
+
+	// Gán giá trị mới, trả về true nếu nội dung thực sự thay đổi
+	bool update(const char *s, size_t len)
+	{
+		size_t stored = len <= capacity() ? len : utf8Prefix(s, capacity());
+		if (equals(s, stored))
+		{
+			return false;
+		}
+		assign(s, len);
+		return true;
+	}
+
+	bool update(const char *s)
+	{
+		return s != nullptr ? update(s, strlen(s)) : update("", 0);
+	}
+
+	void clear()
+	{
+		_buf[0] = '\0';
+		_length = 0;
+	}
+
+	const char *c_str() const { return _buf; }
+	size_t length() const { return _length; }
+	bool isEmpty() const { return _length == 0; }
+	static constexpr size_t capacity() { return N - 1; }
+
+	char charAt(size_t index) const { return index < _length ? _buf[index] : '\0'; }
+	float toFloat() const { return (float)atof(_buf); }
+
+	bool equals(const char *s, size_t len) const
+	{
+		return len == _length && memcmp(_buf, s, len) == 0;
+	}
+
+	bool operator==(const FixedString &other) const { return equals(other._buf, other._length); }
+	bool operator!=(const FixedString &other) const { return !(*this == other); }
+	bool operator==(const char *s) const { return equals(s, s != nullptr ? strlen(s) : 0); }
+	bool operator!=(const char *s) const { return !(*this == s); }
+
+	// Độ dài lớn nhất <= max không cắt ngang ký tự UTF-8 nhiều byte
+	static size_t utf8Prefix(const char *s, size_t max)
+	{
+		size_t cut = max;
+		while (cut > 0 && ((uint8_t)s[cut] & 0xC0) == 0x80)
+		{
+			cut--;
+		}
+		return cut;
+	}
+
+private:
+	char _buf[N];
+	uint8_t _length;
+};
+
+#endif // FIXED_STRING_H
@@ -0,0 +1,229 @@
+#ifndef GLYPH_STRIP_H
+#define GLYPH_STRIP_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <lvgl.h>
+
+/**
+ * Một dòng chữ UTF-8 raster sẵn thành dải ảnh độ đậm 4 bit/pixel (nibble cao là
+ * pixel chẵn, mỗi dòng căn byte), cao bằng line_height của font. Vị trí glyph như
+ * lv_draw_label: bút tiến adv_w, đường cơ sở cách đáy base_line.
+ *
+ * Font của dự án đều 4 bpp nên giữ 4 bit là đủ, không mất gì so với A8 mà chỉ tốn
+ * nửa RAM. Dòng dài hơn maxWidth bị cắt.
+ *
+ * Buffer chỉ lớn lên: reserve() cấp một lần cho dòng dài nhất, sau đó build()
+ * dùng lại buffer đó mà không free/calloc mỗi lần đổi text.
+ */
+class GlyphStrip
+{
+	uint8_t *_pixels = nullptr;
+	size_t _capacity = 0; // số byte đã cấp cho _pixels
+	uint16_t _width = 0; // độ rộng dải (gồm cả phần glyph cuối nhô ra sau bút)
+	uint16_t _advance = 0; // vị trí bút sau glyph cuối
+	uint16_t _height = 0;
+	uint16_t _stride = 0;
+
+public:
+	GlyphStrip() = default;
+	GlyphStrip(const GlyphStrip &) = delete;
+	GlyphStrip &operator=(const GlyphStrip &) = delete;
+
+	~GlyphStrip()
+	{
+		free(_pixels);
+	}
+
+	// Giải mã một ký tự UTF-8 và tiến s; byte lỗi được trả về nguyên giá trị
+	static uint32_t nextCodepoint(const char *&s)
+	{
+		const uint8_t *p = (const uint8_t *)s;
+		uint32_t c = p[0];
+		int extra = c >= 0xF0 ? 3 : c >= 0xE0 ? 2 : c >= 0xC0 ? 1 : 0;
+		uint32_t cp = extra == 3 ? c & 0x07 : extra == 2 ? c & 0x0F : extra == 1 ? c & 0x1F : c;
+		for (int i = 1; i <= extra; i++)
+		{
+			if ((p[i] & 0xC0) != 0x80)
+			{
+				s += 1;
+				return c;
+			}
+			cp = (cp << 6) | (p[i] & 0x3F);
+		}
+		s += 1 + extra;
+		return cp;
+	}
+
+	bool ready() const { return _pixels != nullptr && _width > 0; }
+	uint16_t width() const { return _width; }
+	uint16_t advance() const { return _advance; }
+	uint16_t height() const { return _height; }
+	size_t bytes() const { return (size_t)_stride * _height; }
+	const uint8_t *row(uint16_t y) const { return _pixels + (uint32_t)y * _stride; }
+
+	static uint8_t alphaAt(const uint8_t *row, uint32_t x)
+	{
+		return (x & 1) ? row[x >> 1] & 0x0F : row[x >> 1] >> 4;
+	}
+
+	// Trộn count pixel của dòng y, bắt đầu từ cột sx (sx + count <= width()), vào dst.
+	// plot(pixel, alpha) chỉ được gọi cho pixel có độ đậm khác 0; byte trống (hai pixel
+	// nền) được bỏ qua một lần.
+	template <typename Px, typename Plot>
+	void blendRow(uint16_t y, uint32_t sx, uint32_t count, Px *dst, Plot plot) const
+	{
+		const uint8_t *p = row(y) + (sx >> 1);
+		if ((sx & 1) && count > 0)
+		{
+			uint8_t a = *p++ & 0x0F;
+			if (a != 0)
+			{
+				plot(*dst, a);
+			}
+			dst++;
+			count--;
+		}
+		for (; count >= 2; count -= 2, dst += 2)
+		{
+			uint8_t b = *p++;
+			if (b == 0)
+			{
+				continue;
+			}
+			if (b >> 4)
+			{
+				plot(dst[0], (uint8_t)(b >> 4));
+			}
+			if (b & 0x0F)
+			{
+				plot(dst[1], (uint8_t)(b & 0x0F));
+			}
+		}
+		if (count > 0 && (*p >> 4) != 0)
+		{
+			plot(*dst, (uint8_t)(*p >> 4));
+		}
+	}
+
+	// Bỏ nội dung, giữ buffer để build() sau dùng lại
+	void clear()
+	{
+		_width = _advance = _height = _stride = 0;
+	}
+
+	// Trả buffer về heap
+	void release()
+	{
+		clear();
+		free(_pixels);
+		_pixels = nullptr;
+		_capacity = 0;
+	}
+
+	// Cấp trước buffer cho dải rộng width px, cao height px. false nếu hết bộ nhớ
+	// (buffer cũ, nếu có, vẫn giữ nguyên).
+	bool reserve(uint16_t width, uint16_t height)
+	{
+		size_t need = (size_t)((width + 1) / 2) * height;
+		if (need <= _capacity)
+		{
+			return true;
+		}
+		uint8_t *pixels = (uint8_t *)malloc(need);
+		if (pixels == nullptr)
+		{
+			return false;
+		}
+		free(_pixels);
+		_pixels = pixels;
+		_capacity = need;
+		return true;
+	}
+
+	// Raster text. false nếu text rỗng hoặc hết bộ nhớ (dải khi đó trống).
+	bool build(const lv_font_t *font, const char *text, uint16_t maxWidth)
+	{
+		clear();
+
+		// Lượt 1: đo độ rộng
+		uint32_t pen = 0;
+		uint32_t ink = 0;
+		for (const char *s = text; *s != '\0' && pen < maxWidth;)
+		{
+			uint32_t letter = nextCodepoint(s);
+			const char *n = s;
+			lv_font_glyph_dsc_t g;
+			if (!lv_font_get_glyph_dsc(font, &g, letter, *n != '\0' ? nextCodepoint(n) : 0))
+			{
+				continue;
+			}
+			if (g.box_w > 0 && pen + g.ofs_x + g.box_w > ink)
+			{
+				ink = pen + g.ofs_x + g.box_w;
+			}
+			pen += g.adv_w;
+		}
+		pen = pen < maxWidth ? pen : maxWidth;
+		ink = ink > pen ? ink : pen;
+		ink = ink < maxWidth ? ink : maxWidth;
+		if (ink == 0)
+		{
+			return false;
+		}
+
+		if (!reserve((uint16_t)ink, (uint16_t)font->line_height))
+		{
+			return false;
+		}
+		_width = (uint16_t)ink;
+		_advance = (uint16_t)pen;
+		_height = (uint16_t)font->line_height;
+		_stride = (uint16_t)((_width + 1) / 2);
+		memset(_pixels, 0, bytes());
+
+		// Lượt 2: chép bitmap 4 bpp liên tục của từng glyph vào dải
+		int baseline = font->line_height - font->base_line;
+		pen = 0;
+		for (const char *s = text; *s != '\0' && pen < _width;)
+		{
+			uint32_t letter = nextCodepoint(s);
+			const char *n = s;
+			lv_font_glyph_dsc_t g;
+			if (!lv_font_get_glyph_dsc(font, &g, letter, *n != '\0' ? nextCodepoint(n) : 0))
+			{
+				continue;
+			}
+			const uint8_t *bitmap = g.bpp == 4 ? lv_font_get_glyph_bitmap(g.resolved_font, letter) : nullptr;
+			int x0 = (int)pen + g.ofs_x;
+			int y0 = baseline - (g.ofs_y + g.box_h);
+			for (int gy = 0; bitmap != nullptr && gy < g.box_h; gy++)
+			{
+				int y = y0 + gy;
+				if (y < 0 || y >= _height)
+				{
+					continue;
+				}
+				for (int gx = 0; gx < g.box_w; gx++)
+				{
+					uint8_t alpha = alphaAt(bitmap, (uint32_t)gy * g.box_w + gx);
+					int x = x0 + gx;
+					if (alpha == 0 || x < 0 || x >= _width)
+					{
+						continue;
+					}
+					// Glyph kề nhau có thể chồng mép: cộng độ phủ như khi trộn lần lượt
+					uint8_t &b = _pixels[y * _stride + x / 2];
+					uint8_t old = (x & 1) ? b & 0x0F : b >> 4;
+					alpha = (uint8_t)(old + alpha - (old * alpha + 7) / 15);
+					b = (x & 1) ? (uint8_t)((b & 0xF0) | alpha) : (uint8_t)((b & 0x0F) | (alpha << 4));
+				}
+			}
+			pen += g.adv_w;
+		}
+		return true;
+	}
+};
+
+#endif // GLYPH_STRIP_H
@@ -0,0 +1,32 @@
+#ifndef LOG_MESSAGES_H
+#define LOG_MESSAGES_H
+
+/*
+ * Danh mục bản tin log nhị phân.
+ *
+ * Mỗi bản ghi trong RAM chỉ chứa id + tối đa BINLOG_MAX_ARGS tham số số nguyên;
+ * chuỗi định dạng nằm ở đây và chỉ được dùng khi in ra (trên task xả log hoặc
+ * bằng tools/binlog_decode.py trên máy tính). Chỉ thêm mục mới vào CUỐI danh
+ * sách để id của các bản tin cũ không đổi.
+ */
+#define BINLOG_MESSAGES(X)                                                           \
+	X(RX_PACKET, "RX packet family=%02X cmd=%02X sub=%02X len=%u")                   \
+	X(RX_UNKNOWN, "RX unknown command family=%02X cmd=%02X len=%u")                  \
+	X(NAV_STATE, "Navigation state=%u (0=inactive 1=active 2=disabled)")             \
+	X(NAV_DATA, "Nav data title=%u dist=%u dir=%u speed=%u bytes")                   \
+	X(NAV_ICON_PART, "Nav icon part %u CRC=%08X")                                    \
+	X(MGR_NAV_STATE, "Manager nav state=%u")                                         \
+	X(MGR_NAV_ICON, "Manager nav icon part %u CRC=%08X")                             \
+	X(MGR_CONFIG, "Manager config type=%u values=%u,%u")                             \
+	X(UI_NAV_STATE, "UI nav state isActive=%u")                                      \
+	X(UI_DEFAULT_MSG, "UI default message hidden=%u")                                \
+	X(UI_DIRECTION_TEXT, "UI direction text updated (%u bytes)")                     \
+	X(UI_DISTANCE_BOX, "UI distance container w=%d h=%d")                            \
+	X(NAV_ICON_DONE, "Nav icon %08X assembled crcOk=%u")                             \
+	X(NAV_ICON_CACHE, "Nav icon %08X cache hit=%u")                                  \
+	X(NAV_ICON_CRC_MISMATCH, "Nav icon CRC mismatch phone=%08X local=%08X streak=%u") \
+	X(NAV_ICON_CRC_OFF, "Nav icon CRC check off after %u mismatches in a row")         \
+	X(UI_FRAME_STATS, "Display %u frames, %u px/frame, %u B flushed/frame, last %u px") \
+	X(MGR_NAV_SUMMARY, "Manager nav active=%u icon=%u CRC=%08X directions=%u bytes")
+
+#endif // LOG_MESSAGES_H
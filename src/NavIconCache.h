@@ -0,0 +1,281 @@
+#ifndef NAV_ICON_CACHE_H
+#define NAV_ICON_CACHE_H
+
+#include <Arduino.h>
+
+#define NAV_ICON_BYTES 288     // 48x48, 1 bit mỗi pixel
+#define NAV_ICON_PART_BYTES 96 // mỗi gói 0xEE chở một phần
+#define NAV_ICON_PARTS (NAV_ICON_BYTES / NAV_ICON_PART_BYTES)
+
+#ifndef NAV_ICON_CACHE_SIZE
+#define NAV_ICON_CACHE_SIZE 8 // số icon giữ trong RAM (LRU)
+#endif
+
+// 1: lưu cache icon vào NVS để dùng lại sau khi khởi động lại
+#ifndef NAV_ICON_CACHE_PERSIST
+#define NAV_ICON_CACHE_PERSIST 0
+#endif
+
+// 1: bỏ icon có CRC sai; 0: vẫn hiển thị nhưng không đưa vào cache
+#ifndef NAV_ICON_STRICT_CRC
+#define NAV_ICON_STRICT_CRC 0
+#endif
+
+// Sau ngần này icon liên tiếp sai CRC thì coi như điện thoại dùng thuật toán khác:
+// ngừng bỏ icon (NAV_ICON_STRICT_CRC) và cache theo CRC điện thoại gửi. Một icon
+// khớp CRC sẽ bật lại việc kiểm tra. 0: không bao giờ tắt.
+#ifndef NAV_ICON_CRC_MAX_MISSES
+#define NAV_ICON_CRC_MAX_MISSES 3
+#endif
+
+// 1: cũng lưu vào NVS các icon cache khi kiểm tra CRC đang tắt. Chỉ bật khi đã có
+// bản ghi xác nhận thuật toán CRC của điện thoại.
+#ifndef NAV_ICON_PERSIST_UNCHECKED
+#define NAV_ICON_PERSIST_UNCHECKED 0
+#endif
+
+#if NAV_ICON_CACHE_PERSIST
+#include <Preferences.h>
+#endif
+
+// CRC-32 (IEEE 802.3, giống java.util.zip.CRC32 mà ứng dụng dùng), bảng 16 mục
+inline uint32_t navIconCrc32(const uint8_t *data, size_t len)
+{
+	static const uint32_t table[16] = {
+		0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+		0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C};
+	uint32_t crc = 0xFFFFFFFF;
+	for (size_t i = 0; i < len; i++)
+	{
+		crc = table[(crc ^ data[i]) & 0x0F] ^ (crc >> 4);
+		crc = table[(crc ^ (data[i] >> 4)) & 0x0F] ^ (crc >> 4);
+	}
+	return ~crc;
+}
+
+struct NavIconStats
+{
+	uint32_t parts;         // số phần icon nhận được
+	uint32_t committed;     // icon đã ghép đủ và được đưa ra hiển thị
+	uint32_t crcMismatches; // icon ghép đủ nhưng CRC không khớp
+	uint32_t crcMissStreak; // số icon sai CRC liên tiếp (về 0 khi có icon khớp)
+	uint32_t crcUnchecked;  // icon được cache khi việc kiểm tra CRC đang tắt (chỉ giữ trong RAM)
+	uint32_t cacheHits;     // gói 0x80 báo icon đã có sẵn trong cache
+	uint32_t cacheMisses;   // gói 0x80 báo icon mới chưa có trong cache
+};
+
+/**
+ * Ghép icon điều hướng vào buffer tạm.
+ *
+ * Ba phần của một icon có cùng CRC; phần mang CRC khác sẽ bắt đầu lại việc
+ * ghép. Icon chỉ được trả ra khi đủ cả ba phần, nên màn hình không bao giờ
+ * thấy icon cập nhật dở.
+ */
+class NavIconAssembler
+{
+public:
+	NavIconAssembler() { reset(); }
+
+	void reset()
+	{
+		_received = 0;
+		_crc = 0;
+	}
+
+	// Trả về true khi phần vừa nhận hoàn tất icon
+	bool addPart(uint8_t pos, uint32_t crc, const uint8_t *data, int len)
+	{
+		if (pos >= NAV_ICON_PARTS || len <= 0 || len > NAV_ICON_PART_BYTES)
+		{
+			return false;
+		}
+		if (_received != 0 && crc != _crc)
+		{
+			_received = 0;
+		}
+		_crc = crc;
+		memcpy(&_staging[pos * NAV_ICON_PART_BYTES], data, len);
+		if (len < NAV_ICON_PART_BYTES)
+		{
+			memset(&_staging[pos * NAV_ICON_PART_BYTES + len], 0, NAV_ICON_PART_BYTES - len);
+		}
+		_received |= 1 << pos;
+		return _received == (1 << NAV_ICON_PARTS) - 1;
+	}
+
+	uint32_t computedCrc() const { return navIconCrc32(_staging, NAV_ICON_BYTES); }
+	bool verify() const { return computedCrc() == _crc; }
+
+	// Bắt đầu icon tiếp theo sau khi đã lấy icon hoàn tất
+	void consume() { _received = 0; }
+
+	const uint8_t *data() const { return _staging; }
+	uint32_t crc() const { return _crc; }
+
+private:
+	uint8_t _staging[NAV_ICON_BYTES];
+	uint8_t _received; // bitmap các phần đã nhận
+	uint32_t _crc;
+};
+
+/**
+ * Cache LRU các icon, khóa là CRC điện thoại gửi.
+ *
+ * Khi gói 0x80 báo một iconCRC đã có trong cache, icon được hiển thị ngay mà
+ * không cần chờ điện thoại gửi lại ba phần. Với NAV_ICON_CACHE_PERSIST=1,
+ * mỗi slot đã kiểm tra CRC được ghi vào NVS (namespace "navicons") kèm CRC tính
+ * lại trên dữ liệu, và chỉ được nạp lại khi begin() nếu CRC đó còn khớp.
+ */
+class NavIconCache
+{
+public:
+	NavIconCache() : _clock(0), _pendingValid(false), _pendingCrc(0), _pendingCheck(0)
+	{
+		for (int i = 0; i < NAV_ICON_CACHE_SIZE; i++)
+		{
+			_entries[i].valid = false;
+			_entries[i].lastUse = 0;
+		}
+	}
+
+	void begin()
+	{
+#if NAV_ICON_CACHE_PERSIST
+		if (!_prefs.begin("navicons", false))
+		{
+			return;
+		}
+		for (int i = 0; i < NAV_ICON_CACHE_SIZE; i++)
+		{
+			char key[8];
+			snprintf(key, sizeof(key), "i%d", i);
+			Entry &e = _entries[i];
+			// Bản ghi: CRC điện thoại, CRC tính trên dữ liệu, dữ liệu. Bản ghi cũ
+			// (không có CRC tính lại) có độ dài khác và bị bỏ qua.
+			if (_prefs.getBytesLength(key) == RECORD_BYTES)
+			{
+				uint8_t blob[RECORD_BYTES];
+				_prefs.getBytes(key, blob, sizeof(blob));
+				memcpy(&e.crc, blob, sizeof(e.crc));
+				memcpy(&e.check, blob + sizeof(e.crc), sizeof(e.check));
+				memcpy(e.data, blob + 2 * sizeof(uint32_t), NAV_ICON_BYTES);
+				e.valid = navIconCrc32(e.data, NAV_ICON_BYTES) == e.check &&
+						  (NAV_ICON_PERSIST_UNCHECKED || e.check == e.crc);
+				e.lastUse = ++_clock;
+			}
+		}
+#endif
+	}
+
+	// Tìm icon theo CRC, đánh dấu vừa dùng; trả về nullptr nếu không có
+	const uint8_t *find(uint32_t crc)
+	{
+		for (int i = 0; i < NAV_ICON_CACHE_SIZE; i++)
+		{
+			if (_entries[i].valid && _entries[i].crc == crc)
+			{
+				_entries[i].lastUse = ++_clock;
+				return _entries[i].data;
+			}
+		}
+		return nullptr;
+	}
+
+	// Thêm icon đã kiểm tra CRC, thay slot ít dùng nhất khi đầy
+	void put(uint32_t crc, const uint8_t *data)
+	{
+		store(crc, crc, data);
+	}
+
+	// Thêm icon không kiểm tra được bằng CRC điện thoại. Một phân đoạn hỏng trên đường
+	// truyền sẽ không bị phát hiện, nên icon chỉ được cache khi lần ghép thứ hai cho
+	// cùng CRC điện thoại ra đúng dữ liệu như lần đầu. Trả về true khi đã cache.
+	bool putUnchecked(uint32_t crc, const uint8_t *data)
+	{
+		uint32_t check = navIconCrc32(data, NAV_ICON_BYTES);
+		if (_pendingValid && _pendingCrc == crc && _pendingCheck == check)
+		{
+			_pendingValid = false;
+			store(crc, check, data);
+			return true;
+		}
+		_pendingValid = true;
+		_pendingCrc = crc;
+		_pendingCheck = check;
+		return false;
+	}
+
+private:
+	struct Entry
+	{
+		uint32_t crc;   // CRC điện thoại gửi (khóa)
+		uint32_t check; // CRC tính trên data; khác crc khi icon không kiểm tra được
+		uint32_t lastUse;
+		bool valid;
+		uint8_t data[NAV_ICON_BYTES];
+	};
+
+	static const size_t RECORD_BYTES = 2 * sizeof(uint32_t) + NAV_ICON_BYTES;
+
+	void store(uint32_t crc, uint32_t check, const uint8_t *data)
+	{
+		if (find(crc) != nullptr)
+		{
+			return;
+		}
+		int victim = 0;
+		for (int i = 0; i < NAV_ICON_CACHE_SIZE; i++)
+		{
+			if (!_entries[i].valid)
+			{
+				victim = i;
+				break;
+			}
+			if (_entries[i].lastUse < _entries[victim].lastUse)
+			{
+				victim = i;
+			}
+		}
+		Entry &e = _entries[victim];
+		e.crc = crc;
+		e.check = check;
+		memcpy(e.data, data, NAV_ICON_BYTES);
+		e.valid = true;
+		e.lastUse = ++_clock;
+		persist(victim);
+	}
+
+	void persist(int index)
+	{
+#if NAV_ICON_CACHE_PERSIST
+		const Entry &e = _entries[index];
+		// Icon chưa kiểm tra được chỉ giữ trong RAM: không tốn lượt ghi flash cho thứ
+		// có thể sai
+		if (!NAV_ICON_PERSIST_UNCHECKED && e.check != e.crc)
+		{
+			return;
+		}
+		char key[8];
+		snprintf(key, sizeof(key), "i%d", index);
+		uint8_t blob[RECORD_BYTES];
+		memcpy(blob, &e.crc, sizeof(uint32_t));
+		memcpy(blob + sizeof(uint32_t), &e.check, sizeof(uint32_t));
+		memcpy(blob + 2 * sizeof(uint32_t), e.data, NAV_ICON_BYTES);
+		_prefs.putBytes(key, blob, sizeof(blob));
+#else
+		(void)index;
+#endif
+	}
+
+	Entry _entries[NAV_ICON_CACHE_SIZE];
+	uint32_t _clock;
+	// Lần ghép trước của icon không kiểm tra được, chờ lần thứ hai xác nhận
+	bool _pendingValid;
+	uint32_t _pendingCrc;
+	uint32_t _pendingCheck;
+#if NAV_ICON_CACHE_PERSIST
+	Preferences _prefs;
+#endif
+};
+
+#endif // NAV_ICON_CACHE_H
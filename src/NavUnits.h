@@ -0,0 +1,270 @@
+#ifndef NAV_UNITS_H
+#define NAV_UNITS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * Đổi các chuỗi hiển thị của gói điều hướng sang số nguyên, chạy một lần khi
+ * nhận gói. Hỗ trợ định dạng Google Maps tiếng Việt và tiếng Anh:
+ *
+ *   khoảng cách  "300 m", "1,2 km", "1.2 km", "0.3 mi", "1,200 ft"  -> mét
+ *   thời gian    "12 phút", "1 giờ 5 phút", "1 hr 5 min", "2 days"  -> giây
+ *   giờ đến      "10:45", "2:05 PM", "10:45 SA", "7:30 CH"          -> phút từ 0h
+ *
+ * Chuỗi không nhận ra được trả về NAV_VALUE_UNKNOWN.
+ */
+#define NAV_VALUE_UNKNOWN -1
+
+namespace NavUnits
+{
+	inline bool isAsciiDigit(char c) { return c >= '0' && c <= '9'; }
+
+	inline char lower(char c) { return c >= 'A' && c <= 'Z' ? (char)(c + 32) : c; }
+
+	// So tiền tố không phân biệt hoa thường (chỉ với ký tự ASCII)
+	inline bool startsWith(const char *s, const char *prefix)
+	{
+		for (; *prefix != '\0'; s++, prefix++)
+		{
+			if (lower(*s) != lower(*prefix))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// Tiền tố là một từ trọn vẹn (sau nó không còn chữ cái ASCII)
+	inline bool startsWithWord(const char *s, const char *word)
+	{
+		if (!startsWith(s, word))
+		{
+			return false;
+		}
+		char next = lower(s[strlen(word)]);
+		return !(next >= 'a' && next <= 'z');
+	}
+
+	inline const char *skipSpaces(const char *s)
+	{
+		while (*s == ' ' || *s == '\t')
+		{
+			s++;
+		}
+		return s;
+	}
+
+	// Số dạng "12", "1.2", "1,2", "1,200": phần nguyên, phần sau dấu phân cách
+	// (tối đa 3 chữ số giữ lại) và số chữ số sau dấu phân cách
+	struct Number
+	{
+		int32_t whole;
+		int32_t frac;
+		int fracDigits;
+	};
+
+	inline const char *readNumber(const char *s, Number &n)
+	{
+		n.whole = 0;
+		n.frac = 0;
+		n.fracDigits = 0;
+		while (isAsciiDigit(*s) && n.whole < 100000000)
+		{
+			n.whole = n.whole * 10 + (*s++ - '0');
+		}
+		if ((*s == '.' || *s == ',') && isAsciiDigit(s[1]))
+		{
+			s++;
+			while (isAsciiDigit(*s))
+			{
+				if (n.fracDigits < 3)
+				{
+					n.frac = n.frac * 10 + (*s - '0');
+				}
+				n.fracDigits++;
+				s++;
+			}
+		}
+		return s;
+	}
+}
+
+// Khoảng cách (mét, làm tròn), NAV_VALUE_UNKNOWN nếu không có số + đơn vị hợp lệ
+inline int32_t navParseDistanceMeters(const char *s)
+{
+	using namespace NavUnits;
+	if (s == nullptr)
+	{
+		return NAV_VALUE_UNKNOWN;
+	}
+	while (*s != '\0' && !isAsciiDigit(*s))
+	{
+		s++;
+	}
+	if (*s == '\0')
+	{
+		return NAV_VALUE_UNKNOWN;
+	}
+
+	Number n;
+	s = skipSpaces(readNumber(s, n));
+
+	// Hệ số đổi ra micromet; đơn vị nhỏ cho phép dấu phân cách hàng nghìn
+	int64_t micro;
+	bool smallUnit;
+	if (startsWithWord(s, "km"))
+	{
+		micro = 1000000000LL;
+		smallUnit = false;
+	}
+	else if (startsWithWord(s, "mi"))
+	{
+		micro = 1609344000LL;
+		smallUnit = false;
+	}
+	else if (startsWithWord(s, "ft"))
+	{
+		micro = 304800LL;
+		smallUnit = true;
+	}
+	else if (startsWithWord(s, "yd"))
+	{
+		micro = 914400LL;
+		smallUnit = true;
+	}
+	else if (startsWithWord(s, "m"))
+	{
+		micro = 1000000LL;
+		smallUnit = true;
+	}
+	else
+	{
+		return NAV_VALUE_UNKNOWN;
+	}
+
+	// "1,200 ft" / "1.200 m": ba chữ số sau dấu phân cách của đơn vị nhỏ là hàng nghìn
+	int64_t milli;
+	if (smallUnit && n.fracDigits == 3)
+	{
+		milli = ((int64_t)n.whole * 1000 + n.frac) * 1000;
+	}
+	else
+	{
+		int32_t frac = n.frac;
+		for (int d = n.fracDigits < 3 ? n.fracDigits : 3; d < 3; d++)
+		{
+			frac *= 10;
+		}
+		milli = (int64_t)n.whole * 1000 + frac;
+	}
+	return (int32_t)((milli * micro + 500000000LL) / 1000000000LL);
+}
+
+// Thời gian còn lại (giây), cộng mọi cặp số + đơn vị: "1 giờ 5 phút" -> 3900
+inline int32_t navParseDurationSeconds(const char *s)
+{
+	using namespace NavUnits;
+	if (s == nullptr)
+	{
+		return NAV_VALUE_UNKNOWN;
+	}
+
+	int32_t total = 0;
+	bool found = false;
+	while (*s != '\0')
+	{
+		if (!isAsciiDigit(*s))
+		{
+			s++;
+			continue;
+		}
+		Number n;
+		s = skipSpaces(readNumber(s, n));
+
+		int32_t unit;
+		if (startsWith(s, "ng\xC3\xA0y") || startsWithWord(s, "day") || startsWithWord(s, "days") || startsWithWord(s, "d"))
+		{
+			unit = 86400;
+		}
+		else if (startsWith(s, "gi\xE1\xBB\x9D") || startsWithWord(s, "hour") || startsWithWord(s, "hours") ||
+				 startsWithWord(s, "hr") || startsWithWord(s, "hrs") || startsWithWord(s, "h"))
+		{
+			unit = 3600;
+		}
+		else if (startsWith(s, "ph\xC3\xBAt") || startsWithWord(s, "min") || startsWithWord(s, "mins") ||
+				 startsWithWord(s, "minute") || startsWithWord(s, "minutes") || startsWithWord(s, "p"))
+		{
+			unit = 60;
+		}
+		else if (startsWith(s, "gi\xC3\xA2y") || startsWithWord(s, "sec") || startsWithWord(s, "secs") || startsWithWord(s, "s"))
+		{
+			unit = 1;
+		}
+		else
+		{
+			continue;
+		}
+		total += n.whole * unit;
+		found = true;
+	}
+	return found ? total : NAV_VALUE_UNKNOWN;
+}
+
+// Giờ đến (phút tính từ 0h, 0..1439): giờ đầu tiên dạng h:mm, có thể kèm AM/PM/SA/CH
+inline int16_t navParseEtaMinutes(const char *s)
+{
+	using namespace NavUnits;
+	if (s == nullptr)
+	{
+		return NAV_VALUE_UNKNOWN;
+	}
+
+	for (; *s != '\0'; s++)
+	{
+		if (!isAsciiDigit(*s))
+		{
+			continue;
+		}
+		int hour = *s - '0';
+		const char *p = s + 1;
+		if (isAsciiDigit(*p))
+		{
+			hour = hour * 10 + (*p++ - '0');
+		}
+		if (*p != ':' || !isAsciiDigit(p[1]) || !isAsciiDigit(p[2]))
+		{
+			// Không phải giờ: bỏ qua cả dãy chữ số
+			s = p - 1;
+			continue;
+		}
+		int minute = (p[1] - '0') * 10 + (p[2] - '0');
+		p = skipSpaces(p + 3);
+
+		if (startsWithWord(p, "pm") || startsWithWord(p, "p.m.") || startsWithWord(p, "ch") ||
+			startsWith(p, "chi\xE1\xBB\x81u") || startsWith(p, "t\xE1\xBB\x91i"))
+		{
+			if (hour < 12)
+			{
+				hour += 12;
+			}
+		}
+		else if (startsWithWord(p, "am") || startsWithWord(p, "a.m.") || startsWithWord(p, "sa") ||
+				 startsWith(p, "s\xC3\xA1ng"))
+		{
+			if (hour == 12)
+			{
+				hour = 0;
+			}
+		}
+		if (hour > 23 || minute > 59)
+		{
+			return NAV_VALUE_UNKNOWN;
+		}
+		return (int16_t)(hour * 60 + minute);
+	}
+	return NAV_VALUE_UNKNOWN;
+}
+
+#endif // NAV_UNITS_H
@@ -0,0 +1,39 @@
+#ifndef NAVIGATION_FIELDS_H
+#define NAVIGATION_FIELDS_H
+
+#include "FixedString.h"
+
+// Dung lượng (kể cả NUL) của các trường văn bản trong gói điều hướng 0xEF 0x80.
+// Tiếng Việt dùng tới 3 byte mỗi ký tự nên các trường dài được dành chỗ rộng.
+#define NAV_TITLE_SIZE 64
+#define NAV_DURATION_SIZE 32
+#define NAV_DISTANCE_SIZE 24
+#define NAV_ETA_SIZE 48
+#define NAV_DIRECTIONS_SIZE 160
+#define NAV_SPEED_SIZE 16
+
+typedef FixedString<NAV_TITLE_SIZE> NavTitleText;
+typedef FixedString<NAV_DURATION_SIZE> NavDurationText;
+typedef FixedString<NAV_DISTANCE_SIZE> NavDistanceText;
+typedef FixedString<NAV_ETA_SIZE> NavEtaText;
+typedef FixedString<NAV_DIRECTIONS_SIZE> NavDirectionsText;
+typedef FixedString<NAV_SPEED_SIZE> NavSpeedText;
+
+// Bit đánh dấu trường điều hướng đã thay đổi. Parser tính mặt nạ khi nhận gói,
+// ChronosManager cộng dồn và màn hình chỉ cập nhật các widget tương ứng.
+typedef uint16_t NavFieldMask;
+
+enum NavField : NavFieldMask
+{
+	NAV_FIELD_TITLE = 1 << 0,
+	NAV_FIELD_DURATION = 1 << 1,
+	NAV_FIELD_DISTANCE = 1 << 2,
+	NAV_FIELD_ETA = 1 << 3,
+	NAV_FIELD_DIRECTIONS = 1 << 4,
+	NAV_FIELD_SPEED = 1 << 5,
+	NAV_FIELD_ICON = 1 << 6,
+	NAV_FIELD_STATE = 1 << 7, // active / isNavigation
+	NAV_FIELD_ALL = 0xFF
+};
+
+#endif // NAVIGATION_FIELDS_H
@@ -4,7 +4,6 @@
 #include <Arduino.h>
 #include "Config.h"
 #include "LGFX_Config.h"  // Đảm bảo LGFX được định nghĩa trước
-#include "NavIconRenderer.h" // Thêm header cho NavIconRenderer
 #include "BLEStatusOverlay.h"
 #include "ChronosTypes.h"
 #include "ChronosManager.h" // Di chuyển xuống sau LGFX_Config.h
@@ -207,11 +206,11 @@ public:
     
     // In thông tin debug
     Serial.println("Displaying new navigation screen (Android style)");
-    Serial.println("Title: [" + chronosNav.title + "]");
-    Serial.println("Directions: [" + chronosNav.directions + "]");
-    Serial.println("Distance: [" + chronosNav.distance + "]");
-    Serial.println("Duration: [" + chronosNav.duration + "]");
-    Serial.println("ETA: [" + chronosNav.eta + "]");
+    Serial.println("Title: [" + String(chronosNav.title.c_str()) + "]");
+    Serial.println("Directions: [" + String(chronosNav.directions.c_str()) + "]");
+    Serial.println("Distance: [" + String(chronosNav.distance.c_str()) + "]");
+    Serial.println("Duration: [" + String(chronosNav.duration.c_str()) + "]");
+    Serial.println("ETA: [" + String(chronosNav.eta.c_str()) + "]");
     
     char timeStr[10];
     sprintf(timeStr, "%02d:%02d", 
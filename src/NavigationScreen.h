@@ -127,7 +127,7 @@ public:
     // Vẽ phần header (thanh trạng thái)
     void drawHeader() {
         // 1. Hiển thị ETA ở góc trên bên trái
-        String etaTime = _navData.eta;
+        String etaTime = _navData.eta.c_str();
         // Cải thiện xử lý ETA để loại bỏ chữ "kiến" và chỉ lấy thời gian
         if (etaTime.indexOf(":") > 0) {
             int colonPos = etaTime.indexOf(":");
@@ -213,7 +213,7 @@ public:
         }
         
         // 2. Hiển thị khoảng cách (50 m) bên phải mũi tên
-        String distanceText = _navData.distance;
+        String distanceText = _navData.distance.c_str();
         _lcd.setTextColor(COLOR_WHITE);
         _lcd.setTextSize(2);
         _lcd.setCursor(140, 95);
@@ -221,7 +221,7 @@ public:
         
         // 3. Hiển thị hướng dẫn chỉ đường
         // "Turn left onto Bà Huyện Thanh Quan"
-        String directionText = _navData.directions;
+        String directionText = _navData.directions.c_str();
         
         _lcd.setTextColor(COLOR_WHITE);
         _lcd.setTextSize(1);
@@ -0,0 +1,71 @@
+#ifndef SEQLOCK_H
+#define SEQLOCK_H
+
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+
+/**
+ * Giá trị có phiên bản, một writer / nhiều reader, không khóa.
+ *
+ * Writer sửa giá trị tại chỗ giữa beginWrite() và endWrite(); bộ đếm lẻ trong
+ * lúc đang ghi, chẵn khi giá trị nhất quán. version() tăng sau mỗi lần ghi,
+ * reader so với phiên bản đã xử lý để bỏ qua mọi việc khi không có gì mới.
+ *
+ * Reader cùng task với writer (loop chính) đọc thẳng qua get(), không sao chép.
+ * Reader ở task khác dùng read() để lấy bản sao nhất quán. T phải chép được
+ * bằng memcpy (không chứa con trỏ sở hữu bộ nhớ).
+ */
+template <typename T>
+class Seqlock
+{
+public:
+	Seqlock() : _seq(0) {}
+
+	// Phía writer: trả về giá trị để sửa tại chỗ, phải kết thúc bằng endWrite()
+	T &beginWrite()
+	{
+		_seq.store(_seq.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		return _value;
+	}
+
+	void endWrite()
+	{
+		_seq.store(_seq.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+	}
+
+	// Số lần ghi đã hoàn tất
+	uint32_t version() const { return _seq.load(std::memory_order_acquire) >> 1; }
+
+	// Chỉ dùng trên task của writer: tham chiếu tới giá trị, không sao chép
+	const T &get() const { return _value; }
+
+	// Dùng từ task khác: chép giá trị nhất quán, trả về false nếu writer ghi
+	// liên tục suốt maxRetries lần thử
+	bool read(T &out, uint32_t &version, int maxRetries = 8) const
+	{
+		for (int i = 0; i < maxRetries; i++)
+		{
+			uint32_t before = _seq.load(std::memory_order_acquire);
+			if (before & 1)
+			{
+				continue;
+			}
+			memcpy(&out, &_value, sizeof(T));
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if (_seq.load(std::memory_order_relaxed) == before)
+			{
+				version = before >> 1;
+				return true;
+			}
+		}
+		return false;
+	}
+
+private:
+	std::atomic<uint32_t> _seq;
+	T _value;
+};
+
+#endif // SEQLOCK_H
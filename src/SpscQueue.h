@@ -0,0 +1,85 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+/**
+ * Hàng đợi một producer / một consumer không khóa, dung lượng cố định.
+ *
+ * push() chỉ được gọi từ một task (ví dụ callback NimBLE), pop() chỉ được gọi
+ * từ một task khác (ví dụ loop chính). N phải là lũy thừa của 2.
+ */
+template <typename T, size_t N>
+class SpscQueue
+{
+	static_assert(N > 0 && (N & (N - 1)) == 0, "SpscQueue capacity must be a power of two");
+
+public:
+	SpscQueue() : _head(0), _tail(0), _pushed(0), _overflows(0), _highWater(0) {}
+
+	// Phía producer: trả về false và tăng bộ đếm tràn nếu hàng đợi đầy
+	bool push(const T &item)
+	{
+		size_t head = _head.load(std::memory_order_relaxed);
+		size_t tail = _tail.load(std::memory_order_acquire);
+		if (head - tail >= N)
+		{
+			_overflows.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+
+		_items[head & (N - 1)] = item;
+		_head.store(head + 1, std::memory_order_release);
+
+		_pushed.fetch_add(1, std::memory_order_relaxed);
+		uint32_t depth = (uint32_t)(head + 1 - tail);
+		if (depth > _highWater.load(std::memory_order_relaxed))
+		{
+			_highWater.store(depth, std::memory_order_relaxed);
+		}
+		return true;
+	}
+
+	// Phía consumer: trả về false nếu hàng đợi rỗng
+	bool pop(T &item)
+	{
+		size_t tail = _tail.load(std::memory_order_relaxed);
+		size_t head = _head.load(std::memory_order_acquire);
+		if (tail == head)
+		{
+			return false;
+		}
+
+		item = _items[tail & (N - 1)];
+		_tail.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+
+	bool empty() const
+	{
+		return _head.load(std::memory_order_acquire) == _tail.load(std::memory_order_acquire);
+	}
+
+	size_t size() const
+	{
+		return _head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire);
+	}
+
+	static constexpr size_t capacity() { return N; }
+
+	uint32_t pushed() const { return _pushed.load(std::memory_order_relaxed); }
+	uint32_t overflows() const { return _overflows.load(std::memory_order_relaxed); }
+	uint32_t highWater() const { return _highWater.load(std::memory_order_relaxed); }
+
+private:
+	T _items[N];
+	std::atomic<size_t> _head; // chỉ producer ghi
+	std::atomic<size_t> _tail; // chỉ consumer ghi
+	std::atomic<uint32_t> _pushed;
+	std::atomic<uint32_t> _overflows;
+	std::atomic<uint32_t> _highWater;
+};
+
+#endif // SPSC_QUEUE_H
@@ -0,0 +1,340 @@
+#ifndef VIET_NFC_H
+#define VIET_NFC_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * Chuẩn hóa chữ tiếng Việt về dạng dựng sẵn (Unicode NFC), chạy một lần khi nhận
+ * chuỗi (các trường của gói điều hướng).
+ *
+ * Google Maps và một số bộ gõ gửi chữ tổ hợp: chữ gốc + dấu rời, ví dụ "e" U+0302 U+0301
+ * hoặc "ê" U+0301 thay cho "ế". Font chỉ có glyph dựng sẵn nên LVGL sẽ vẽ chữ gốc kèm
+ * dấu lệch hoặc ô trống. normalize() làm đúng như NFC với các dấu tiếng Việt: tách chữ
+ * gốc đã có dấu, sắp mọi dấu theo lớp kết hợp (móc 216, nặng 220, các dấu trên 230)
+ * rồi ghép dần theo COMPOSITIONS. Dấu ngoài bảng và byte UTF-8 lỗi được giữ nguyên.
+ *
+ * Kết quả thường ngắn hơn đầu vào nhưng có thể dài hơn một chút khi dấu không ghép được
+ * bị tách khỏi chữ dựng sẵn ("é" + nặng -> "ẹ" + sắc rời), nên out phải khác in và
+ * normalize() dừng lại khi hết chỗ.
+ */
+namespace VietNfc
+{
+	struct Composition
+	{
+		uint16_t base;
+		uint16_t mark;
+		uint16_t composed;
+	};
+
+	// Phân rã chuẩn một bước (unicodedata.decomposition) của 132 chữ có dấu trong font
+	// (đ, Đ không có phân rã), sắp theo (base, mark) để tìm nhị phân
+	constexpr Composition COMPOSITIONS[] = {
+		{0x0041, 0x0300, 0x00C0}, {0x0041, 0x0301, 0x00C1}, {0x0041, 0x0302, 0x00C2}, {0x0041, 0x0303, 0x00C3}, // À Á Â Ã
+		{0x0041, 0x0306, 0x0102}, {0x0041, 0x0309, 0x1EA2}, {0x0041, 0x0323, 0x1EA0}, {0x0045, 0x0300, 0x00C8}, // Ă Ả Ạ È
+		{0x0045, 0x0301, 0x00C9}, {0x0045, 0x0302, 0x00CA}, {0x0045, 0x0303, 0x1EBC}, {0x0045, 0x0309, 0x1EBA}, // É Ê Ẽ Ẻ
+		{0x0045, 0x0323, 0x1EB8}, {0x0049, 0x0300, 0x00CC}, {0x0049, 0x0301, 0x00CD}, {0x0049, 0x0303, 0x0128}, // Ẹ Ì Í Ĩ
+		{0x0049, 0x0309, 0x1EC8}, {0x0049, 0x0323, 0x1ECA}, {0x004F, 0x0300, 0x00D2}, {0x004F, 0x0301, 0x00D3}, // Ỉ Ị Ò Ó
+		{0x004F, 0x0302, 0x00D4}, {0x004F, 0x0303, 0x00D5}, {0x004F, 0x0309, 0x1ECE}, {0x004F, 0x031B, 0x01A0}, // Ô Õ Ỏ Ơ
+		{0x004F, 0x0323, 0x1ECC}, {0x0055, 0x0300, 0x00D9}, {0x0055, 0x0301, 0x00DA}, {0x0055, 0x0303, 0x0168}, // Ọ Ù Ú Ũ
+		{0x0055, 0x0309, 0x1EE6}, {0x0055, 0x031B, 0x01AF}, {0x0055, 0x0323, 0x1EE4}, {0x0059, 0x0300, 0x1EF2}, // Ủ Ư Ụ Ỳ
+		{0x0059, 0x0301, 0x00DD}, {0x0059, 0x0303, 0x1EF8}, {0x0059, 0x0309, 0x1EF6}, {0x0059, 0x0323, 0x1EF4}, // Ý Ỹ Ỷ Ỵ
+		{0x0061, 0x0300, 0x00E0}, {0x0061, 0x0301, 0x00E1}, {0x0061, 0x0302, 0x00E2}, {0x0061, 0x0303, 0x00E3}, // à á â ã
+		{0x0061, 0x0306, 0x0103}, {0x0061, 0x0309, 0x1EA3}, {0x0061, 0x0323, 0x1EA1}, {0x0065, 0x0300, 0x00E8}, // ă ả ạ è
+		{0x0065, 0x0301, 0x00E9}, {0x0065, 0x0302, 0x00EA}, {0x0065, 0x0303, 0x1EBD}, {0x0065, 0x0309, 0x1EBB}, // é ê ẽ ẻ
+		{0x0065, 0x0323, 0x1EB9}, {0x0069, 0x0300, 0x00EC}, {0x0069, 0x0301, 0x00ED}, {0x0069, 0x0303, 0x0129}, // ẹ ì í ĩ
+		{0x0069, 0x0309, 0x1EC9}, {0x0069, 0x0323, 0x1ECB}, {0x006F, 0x0300, 0x00F2}, {0x006F, 0x0301, 0x00F3}, // ỉ ị ò ó
+		{0x006F, 0x0302, 0x00F4}, {0x006F, 0x0303, 0x00F5}, {0x006F, 0x0309, 0x1ECF}, {0x006F, 0x031B, 0x01A1}, // ô õ ỏ ơ
+		{0x006F, 0x0323, 0x1ECD}, {0x0075, 0x0300, 0x00F9}, {0x0075, 0x0301, 0x00FA}, {0x0075, 0x0303, 0x0169}, // ọ ù ú ũ
+		{0x0075, 0x0309, 0x1EE7}, {0x0075, 0x031B, 0x01B0}, {0x0075, 0x0323, 0x1EE5}, {0x0079, 0x0300, 0x1EF3}, // ủ ư ụ ỳ
+		{0x0079, 0x0301, 0x00FD}, {0x0079, 0x0303, 0x1EF9}, {0x0079, 0x0309, 0x1EF7}, {0x0079, 0x0323, 0x1EF5}, // ý ỹ ỷ ỵ
+		{0x00C2, 0x0300, 0x1EA6}, {0x00C2, 0x0301, 0x1EA4}, {0x00C2, 0x0303, 0x1EAA}, {0x00C2, 0x0309, 0x1EA8}, // Ầ Ấ Ẫ Ẩ
+		{0x00CA, 0x0300, 0x1EC0}, {0x00CA, 0x0301, 0x1EBE}, {0x00CA, 0x0303, 0x1EC4}, {0x00CA, 0x0309, 0x1EC2}, // Ề Ế Ễ Ể
+		{0x00D4, 0x0300, 0x1ED2}, {0x00D4, 0x0301, 0x1ED0}, {0x00D4, 0x0303, 0x1ED6}, {0x00D4, 0x0309, 0x1ED4}, // Ồ Ố Ỗ Ổ
+		{0x00E2, 0x0300, 0x1EA7}, {0x00E2, 0x0301, 0x1EA5}, {0x00E2, 0x0303, 0x1EAB}, {0x00E2, 0x0309, 0x1EA9}, // ầ ấ ẫ ẩ
+		{0x00EA, 0x0300, 0x1EC1}, {0x00EA, 0x0301, 0x1EBF}, {0x00EA, 0x0303, 0x1EC5}, {0x00EA, 0x0309, 0x1EC3}, // ề ế ễ ể
+		{0x00F4, 0x0300, 0x1ED3}, {0x00F4, 0x0301, 0x1ED1}, {0x00F4, 0x0303, 0x1ED7}, {0x00F4, 0x0309, 0x1ED5}, // ồ ố ỗ ổ
+		{0x0102, 0x0300, 0x1EB0}, {0x0102, 0x0301, 0x1EAE}, {0x0102, 0x0303, 0x1EB4}, {0x0102, 0x0309, 0x1EB2}, // Ằ Ắ Ẵ Ẳ
+		{0x0103, 0x0300, 0x1EB1}, {0x0103, 0x0301, 0x1EAF}, {0x0103, 0x0303, 0x1EB5}, {0x0103, 0x0309, 0x1EB3}, // ằ ắ ẵ ẳ
+		{0x01A0, 0x0300, 0x1EDC}, {0x01A0, 0x0301, 0x1EDA}, {0x01A0, 0x0303, 0x1EE0}, {0x01A0, 0x0309, 0x1EDE}, // Ờ Ớ Ỡ Ở
+		{0x01A0, 0x0323, 0x1EE2}, {0x01A1, 0x0300, 0x1EDD}, {0x01A1, 0x0301, 0x1EDB}, {0x01A1, 0x0303, 0x1EE1}, // Ợ ờ ớ ỡ
+		{0x01A1, 0x0309, 0x1EDF}, {0x01A1, 0x0323, 0x1EE3}, {0x01AF, 0x0300, 0x1EEA}, {0x01AF, 0x0301, 0x1EE8}, // ở ợ Ừ Ứ
+		{0x01AF, 0x0303, 0x1EEE}, {0x01AF, 0x0309, 0x1EEC}, {0x01AF, 0x0323, 0x1EF0}, {0x01B0, 0x0300, 0x1EEB}, // Ữ Ử Ự ừ
+		{0x01B0, 0x0301, 0x1EE9}, {0x01B0, 0x0303, 0x1EEF}, {0x01B0, 0x0309, 0x1EED}, {0x01B0, 0x0323, 0x1EF1}, // ứ ữ ử ự
+		{0x1EA0, 0x0302, 0x1EAC}, {0x1EA0, 0x0306, 0x1EB6}, {0x1EA1, 0x0302, 0x1EAD}, {0x1EA1, 0x0306, 0x1EB7}, // Ậ Ặ ậ ặ
+		{0x1EB8, 0x0302, 0x1EC6}, {0x1EB9, 0x0302, 0x1EC7}, {0x1ECC, 0x0302, 0x1ED8}, {0x1ECD, 0x0302, 0x1ED9}, // Ệ ệ Ộ ộ
+	};
+
+	constexpr size_t COMPOSITION_COUNT = sizeof(COMPOSITIONS) / sizeof(COMPOSITIONS[0]);
+
+	constexpr bool compositionsSorted(size_t i)
+	{
+		return i + 1 >= COMPOSITION_COUNT ||
+			   ((COMPOSITIONS[i].base < COMPOSITIONS[i + 1].base ||
+				 (COMPOSITIONS[i].base == COMPOSITIONS[i + 1].base && COMPOSITIONS[i].mark < COMPOSITIONS[i + 1].mark)) &&
+				compositionsSorted(i + 1));
+	}
+
+	static_assert(compositionsSorted(0), "VietNfc::COMPOSITIONS must be sorted by (base, mark)");
+
+	// Số dấu tối đa gom quanh một chữ gốc (kể cả dấu tách từ chữ dựng sẵn); dãy dài hơn
+	// được chép nguyên
+	static const size_t MAX_MARKS = 6;
+
+	// Giá trị thay cho byte UTF-8 lỗi: ngoài Unicode nên không bao giờ ghép được
+	static const uint32_t INVALID = 0x110000;
+
+	// Lớp kết hợp của các dấu trong bảng, 0 với mọi ký tự khác
+	inline uint8_t combiningClass(uint32_t cp)
+	{
+		switch (cp)
+		{
+		case 0x0300: // huyền
+		case 0x0301: // sắc
+		case 0x0302: // mũ
+		case 0x0303: // ngã
+		case 0x0306: // trăng
+		case 0x0309: // hỏi
+			return 230;
+		case 0x031B: // móc
+			return 216;
+		case 0x0323: // nặng
+			return 220;
+		default:
+			return 0;
+		}
+	}
+
+	// U+0340/U+0341 (dấu thanh của một số bộ gõ cũ) có phân rã chuẩn là huyền/sắc
+	inline uint32_t canonicalMark(uint32_t cp)
+	{
+		return cp == 0x0340 ? 0x0300 : cp == 0x0341 ? 0x0301 : cp;
+	}
+
+	// Ký tự dựng sẵn của base + mark, 0 nếu không có
+	inline uint32_t compose(uint32_t base, uint32_t mark)
+	{
+		size_t lo = 0;
+		size_t hi = COMPOSITION_COUNT;
+		while (lo < hi)
+		{
+			size_t mid = (lo + hi) / 2;
+			const Composition &c = COMPOSITIONS[mid];
+			if (c.base < base || (c.base == base && c.mark < mark))
+			{
+				lo = mid + 1;
+			}
+			else
+			{
+				hi = mid;
+			}
+		}
+		return lo < COMPOSITION_COUNT && COMPOSITIONS[lo].base == base && COMPOSITIONS[lo].mark == mark
+				   ? COMPOSITIONS[lo].composed
+				   : 0;
+	}
+
+	// Phân rã một bước của ký tự dựng sẵn; false nếu không có trong bảng
+	inline bool decompose(uint32_t cp, uint32_t &base, uint32_t &mark)
+	{
+		if (cp < 0xC0 || cp > 0x1EF9)
+		{
+			return false;
+		}
+		for (size_t i = 0; i < COMPOSITION_COUNT; i++)
+		{
+			if (COMPOSITIONS[i].composed == cp)
+			{
+				base = COMPOSITIONS[i].base;
+				mark = COMPOSITIONS[i].mark;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// Chuỗi có ký tự U+0300..U+036F (byte dẫn 0xCC/0xCD) không. false: chữ tiếng Việt
+	// trong chuỗi đã ở dạng NFC, không cần normalize().
+	inline bool hasCombiningMarks(const char *s, size_t len)
+	{
+		for (size_t i = 0; i < len; i++)
+		{
+			if (((uint8_t)s[i] & 0xFE) == 0xCC)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// Giải mã một ký tự tại s[i], trả về số byte đã đọc. Byte lỗi đọc thành INVALID.
+	inline size_t decode(const uint8_t *s, size_t len, size_t i, uint32_t &cp)
+	{
+		uint8_t c = s[i];
+		size_t extra = c >= 0xF0 ? 3 : c >= 0xE0 ? 2 : c >= 0xC2 ? 1 : 0;
+		if (c < 0x80)
+		{
+			cp = c;
+			return 1;
+		}
+		cp = INVALID;
+		if (extra == 0 || c > 0xF4 || i + extra >= len)
+		{
+			return 1;
+		}
+		uint32_t v = extra == 3 ? c & 0x07 : extra == 2 ? c & 0x0F : c & 0x1F;
+		for (size_t k = 1; k <= extra; k++)
+		{
+			if ((s[i + k] & 0xC0) != 0x80)
+			{
+				return 1;
+			}
+			v = (v << 6) | (s[i + k] & 0x3F);
+		}
+		cp = v;
+		return 1 + extra;
+	}
+
+	inline size_t encodedLength(uint32_t cp)
+	{
+		return cp < 0x80 ? 1 : cp < 0x800 ? 2 : cp < 0x10000 ? 3 : 4;
+	}
+
+	inline char *encode(uint32_t cp, char *out)
+	{
+		if (cp < 0x80)
+		{
+			*out++ = (char)cp;
+		}
+		else if (cp < 0x800)
+		{
+			*out++ = (char)(0xC0 | (cp >> 6));
+			*out++ = (char)(0x80 | (cp & 0x3F));
+		}
+		else if (cp < 0x10000)
+		{
+			*out++ = (char)(0xE0 | (cp >> 12));
+			*out++ = (char)(0x80 | ((cp >> 6) & 0x3F));
+			*out++ = (char)(0x80 | (cp & 0x3F));
+		}
+		else
+		{
+			*out++ = (char)(0xF0 | (cp >> 18));
+			*out++ = (char)(0x80 | ((cp >> 12) & 0x3F));
+			*out++ = (char)(0x80 | ((cp >> 6) & 0x3F));
+			*out++ = (char)(0x80 | (cp & 0x3F));
+		}
+		return out;
+	}
+
+	/**
+	 * Ghi dạng NFC của len byte UTF-8 từ in vào out (tối đa outSize byte, không thêm NUL),
+	 * trả về số byte đã ghi. Hết chỗ thì dừng trước cụm chữ gốc + dấu không vừa, không
+	 * bao giờ cắt đôi một ký tự.
+	 */
+	inline size_t normalize(const char *in, size_t len, char *out, size_t outSize)
+	{
+		const uint8_t *s = (const uint8_t *)in;
+		size_t r = 0;
+		size_t w = 0;
+		while (r < len)
+		{
+			// Cụm: một ký tự rồi các dấu trong bảng ngay sau nó
+			size_t start = r;
+			uint32_t starter;
+			r += decode(s, len, r, starter);
+			size_t starterEnd = r;
+			uint32_t marks[MAX_MARKS];
+			size_t count = 0;
+			while (r < len && count < MAX_MARKS - 2)
+			{
+				uint32_t cp;
+				size_t n = decode(s, len, r, cp);
+				cp = canonicalMark(cp);
+				if (combiningClass(cp) == 0)
+				{
+					break;
+				}
+				marks[count++] = cp;
+				r += n;
+			}
+			if (count == 0)
+			{
+				if (w + (r - start) > outSize)
+				{
+					break;
+				}
+				memcpy(out + w, in + start, r - start);
+				w += r - start;
+				continue;
+			}
+
+			// Tách chữ gốc đã có dấu (tối đa hai bước: "ấ" -> "â" + sắc -> "a" + mũ + sắc)
+			uint32_t base;
+			uint32_t mark;
+			uint32_t original = starter;
+			while (count < MAX_MARKS && decompose(starter, base, mark))
+			{
+				memmove(marks + 1, marks, count * sizeof(marks[0]));
+				marks[0] = mark;
+				count++;
+				starter = base;
+			}
+
+			// Sắp ổn định theo lớp kết hợp
+			for (size_t i = 1; i < count; i++)
+			{
+				uint32_t m = marks[i];
+				size_t j = i;
+				for (; j > 0 && combiningClass(marks[j - 1]) > combiningClass(m); j--)
+				{
+					marks[j] = marks[j - 1];
+				}
+				marks[j] = m;
+			}
+
+			// Ghép: dấu bị chặn nếu một dấu đứng trước không ghép được có cùng lớp
+			size_t kept = 0;
+			uint8_t lastClass = 0;
+			for (size_t i = 0; i < count; i++)
+			{
+				uint8_t cls = combiningClass(marks[i]);
+				uint32_t composed = kept == 0 || lastClass < cls ? compose(starter, marks[i]) : 0;
+				if (composed != 0)
+				{
+					starter = composed;
+				}
+				else
+				{
+					marks[kept++] = marks[i];
+					lastClass = cls;
+				}
+			}
+
+			// Chữ gốc giữ nguyên byte gốc nếu không đổi (byte lỗi vẫn được chép nguyên)
+			size_t starterBytes = starter == original ? starterEnd - start : encodedLength(starter);
+			if (w + starterBytes + kept * 2 > outSize)
+			{
+				break;
+			}
+			if (starter == original)
+			{
+				memcpy(out + w, in + start, starterBytes);
+			}
+			else
+			{
+				encode(starter, out + w);
+			}
+			w += starterBytes;
+			for (size_t i = 0; i < kept; i++)
+			{
+				encode(marks[i], out + w);
+				w += 2;
+			}
+		}
+		return w;
+	}
+}
+
+#endif // VIET_NFC_H
@@ -1 +1 @@
-#include "../include/fonts/montserrat_24.c"
+#include "../include/fonts/subset/montserrat_24.c"
@@ -1 +1 @@
-#include "../include/fonts/montserrat_bold_32.c"
+#include "../include/fonts/subset/montserrat_bold_32.c"
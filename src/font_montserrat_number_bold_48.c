@@ -1 +1 @@
-#include "../include/fonts/montserrat_number_bold_48.c"
+#include "../include/fonts/subset/montserrat_number_bold_48.c"
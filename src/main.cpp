@@ -6,6 +6,8 @@
 #include "VietnameseFonts.h"
 #include "NavigationManagerLVGL.h"
 #include "BLEStatusOverlay.h"
+#include "BinLog.h"
+#include "EventBus.h"
 
 // ===== CONFIG =====
 namespace Config {
@@ -22,8 +24,8 @@ namespace Config {
   constexpr bool PRIORITIZE_INPUT = true;
   constexpr unsigned long INPUT_CHECK_INTERVAL = 5;
   
-  // LVGL update interval
-  constexpr uint16_t LVGL_UPDATE_INTERVAL = 5; // ms
+  // Thời gian nghỉ tối đa mỗi vòng loop ở chế độ điều hướng (ms), để nút bấm vẫn nhạy
+  constexpr uint32_t NAV_IDLE_MAX_MS = 10;
 }
 
 // ===== CÁC KIỂU DỮ LIỆU =====
@@ -167,6 +169,16 @@ private:
   unsigned long _lastFrameTime = 0;
   bool _navAlertShown = false;
   
+  // Trạng thái kết nối BLE nhận qua bus sự kiện, chờ checkNavigationMode() xử lý
+  bool _bleConnected = false;
+  bool _connectionChanged = false;
+  
+  static void connectionEventHandler(const Event& event, void* context) {
+    VideoPlayer* player = static_cast<VideoPlayer*>(context);
+    player->_bleConnected = event.id == EV_CONNECTED;
+    player->_connectionChanged = true;
+  }
+  
 public:
   VideoPlayer() {
     // Sử dụng chỉ full1 (video chính)
@@ -196,6 +208,10 @@ public:
     _lastFrameTime = millis();
     LVGL_Display::getInstance().setBacklight(true);
     
+    // Chuyển chế độ ngay khi có sự kiện kết nối thay vì thăm dò mỗi 500ms
+    EventBus::getInstance().subscribe(eventBit(EV_CONNECTED) | eventBit(EV_DISCONNECTED),
+                                      connectionEventHandler, this);
+    
     Serial.println("Player initialized and automatically started playback");
   }
   
@@ -258,8 +274,10 @@ public:
         // Đảm bảo backlight bật
         LVGL_Display::getInstance().setBacklight(true);
         
-        // Đảm bảo LVGL được cập nhật
-        LVGL_Display::getInstance().update();
+        // Màn hình vừa bị ghi đè trực tiếp qua tft: buộc LVGL vẽ lại toàn bộ
+        // (màn hình điều hướng chỉ còn invalidate các widget thay đổi).
+        // Bộ lập lịch frame vẽ ở lần update() kế tiếp trong loop.
+        lv_obj_invalidate(lv_scr_act());
       }
     }
   }
@@ -270,19 +288,8 @@ public:
   }
   
 private:
-  // Kiểm tra trạng thái điều hướng
+  // Chuyển giữa video và điều hướng theo sự kiện kết nối BLE
   void checkNavigationMode() {
-    // Kiểm tra xem Navigation Manager đã được khởi tạo chưa
-    static bool navManagerInitialized = false;
-    static unsigned long lastCheckTime = 0;
-    
-    // Chỉ kiểm tra mỗi 500ms
-    unsigned long currentTime = millis();
-    if (currentTime - lastCheckTime < 500) {
-      return;
-    }
-    lastCheckTime = currentTime;
-    
     // Kiểm tra một cách an toàn - sử dụng biến tĩnh từ loop()
     extern bool navigationInitialized;
     if (!navigationInitialized) {
@@ -290,25 +297,36 @@ private:
     }
     
     auto& navManager = NavigationManagerLVGL::getInstance();
-    auto& chronosManager = ChronosManager::getInstance();
-    
-    // Kiểm tra kết nối BLE trực tiếp từ ChronosManager
-    bool isConnectedToBLE = chronosManager.isConnected();
-    bool isNavigationActive = chronosManager.isNavigating();
     
     // In debug mỗi 10 giây để xác nhận trạng thái kết nối
     static unsigned long lastDebugTime = 0;
-    currentTime = millis();
+    unsigned long currentTime = millis();
     if (currentTime - lastDebugTime > 10000) {
       lastDebugTime = currentTime;
       Serial.printf("BLE Connection Status: %s, Navigation Active: %s, Navigation Mode: %d, Player Mode: %d\n", 
-                  isConnectedToBLE ? "Connected" : "Disconnected",
-                  isNavigationActive ? "Active" : "Inactive",
+                  _bleConnected ? "Connected" : "Disconnected",
+                  ChronosManager::getInstance().isNavigating() ? "Active" : "Inactive",
                   (int)navManager.getNavigationMode(),
                   (int)_currentMode);
+
+      // Lượng vẽ lại trong 10 giây vừa qua: diện tích invalid và byte gửi qua SPI
+      // (mức debug của BinLog: -DBINLOG_LEVEL=BINLOG_LEVEL_DEBUG để xem)
+      LVGL_Display& display = LVGL_Display::getInstance();
+      const FrameStats& stats = display.getFrameStats();
+      if (stats.frames > 0) {
+        BLOG_D(UI_FRAME_STATS, stats.frames, (uint32_t)(stats.totalPixels / stats.frames),
+               (uint32_t)(stats.totalFlushBytes / stats.frames), stats.lastPixels);
+      }
+      display.resetFrameStats();
     }
     
-    if (isConnectedToBLE) {
+    // Không có sự kiện kết nối mới: không có gì để làm
+    if (!_connectionChanged) {
+      return;
+    }
+    _connectionChanged = false;
+    
+    if (_bleConnected) {
       // Nếu đã kết nối BLE, luôn chuyển sang chế độ FULLSCREEN và chuyển sang chế độ NAVIGATING
       if (_currentMode != PlayerMode::NAVIGATING) {
         // Đảm bảo chế độ điều hướng là FULLSCREEN
@@ -383,6 +401,9 @@ void setup() {
   Serial.begin(115200);
   Serial.println("Initializing...");
   
+  // Khởi động task xả log nhị phân (ghi Serial ngoài các đường nóng)
+  BinLog::begin();
+  
   // Khởi tạo LVGL Display
   LVGL_Display::getInstance().init();
   
@@ -410,9 +431,12 @@ void loop() {
     BLEStatusOverlay::getInstance().init(LVGL_Display::getInstance().getTft());
     Serial.println("Navigation Manager initialized after 2 seconds");
     
+    // Lần đầu chạy bản build mới: đo và lưu chế độ buffer vẽ nhanh nhất
+    NavigationManagerLVGL::getInstance().tuneDisplay();
+    
     // Cập nhật ngay lập tức để tạo UI
-    LVGL_Display::getInstance().update();
     NavigationManagerLVGL::getInstance().update();
+    LVGL_Display::getInstance().update();
     BLEStatusOverlay::getInstance().update();
     
     // Đảm bảo màn hình được hiển thị
@@ -422,41 +446,31 @@ void loop() {
     navigationInitialized = true;
   }
   
-  // Cập nhật LVGL
-  static unsigned long lastLvglUpdate = 0;
-  unsigned long currentTime = millis();
-  if (currentTime - lastLvglUpdate >= Config::LVGL_UPDATE_INTERVAL) {
-    lastLvglUpdate = currentTime;
-    LVGL_Display::getInstance().update();
-  }
-  
   // Cập nhật input
   InputManager::getInstance().quickUpdate();
   InputManager::getInstance().update();
   
   if(navigationInitialized)
   {
-    // Cập nhật ChronosManager để xử lý kết nối BLE
+    // Cập nhật ChronosManager để xử lý kết nối BLE, sau đó giao ngay các sự
+    // kiện vừa phát sinh để màn hình phản ứng trong cùng vòng loop
     ChronosManager::getInstance().update();
-    
-    PlayerMode currentMode = VideoPlayer::getInstance().getMode();
+    EventBus::getInstance().dispatch();
     
     // Cập nhật NavigationManagerLVGL để xử lý trạng thái kết nối
     NavigationManagerLVGL::getInstance().update();
     
     // Cập nhật thông báo trạng thái BLE
     BLEStatusOverlay::getInstance().update();
-    
-    // Nếu đang ở chế độ điều hướng, dành nhiều thời gian hơn cho LVGL
-    if (currentMode == PlayerMode::NAVIGATING) {
-      // Đảm bảo LVGL được cập nhật nhiều lần
-      for (int i = 0; i < 3; i++) {
-        LVGL_Display::getInstance().update();
-        delay(5); // Dành thêm thời gian cho LVGL xử lý
-      }
-    }
   }
   
   // Cập nhật video player
   VideoPlayer::getInstance().update();
+  
+  // Bộ lập lịch frame: LVGL chỉ vẽ khi có vùng thay đổi hoặc animation.
+  // Ở chế độ điều hướng, nghỉ tới frame kế tiếp thay vì quay vòng.
+  uint32_t idleMs = LVGL_Display::getInstance().update();
+  if (navigationInitialized && VideoPlayer::getInstance().getMode() == PlayerMode::NAVIGATING && idleMs > 0) {
+    delay(idleMs < Config::NAV_IDLE_MAX_MS ? idleMs : Config::NAV_IDLE_MAX_MS);
+  }
 }
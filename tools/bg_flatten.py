@@ -0,0 +1,150 @@
+#!/usr/bin/env python3
+"""Làm phẳng hình nền điều hướng thành ảnh RGB565 không alpha.
+
+assets/bg_rgb565a8.c là ảnh gốc (LV_IMG_CF_RGB565A8, xuất từ LVGL image
+converter). LVGL phải trộn alpha từng pixel của ảnh này mỗi lần vẽ lại, dù nền
+bên dưới luôn là NavColors::BackgroundHex. Công cụ này trộn sẵn ảnh với màu nền
+đó và ghi src/bg.c dạng LV_IMG_CF_TRUE_COLOR theo thứ tự byte của LV_COLOR_16_SWAP,
+để LVGL chỉ còn chép từng dòng.
+
+    python3 tools/bg_flatten.py              # ghi lại src/bg.c nếu đầu vào đổi
+    python3 tools/bg_flatten.py --check      # báo lỗi nếu src/bg.c đã cũ
+
+Màu nền đọc từ include/VietnameseFonts.h, LV_COLOR_16_SWAP từ include/lv_conf.h.
+PlatformIO chạy file này trước mỗi lần build (extra_scripts = pre:...).
+"""
+import argparse
+import os
+import re
+import sys
+
+BYTES_PER_LINE = 32
+# Ảnh gốc được xuất với tùy chọn đổi byte của converter (RGB565 big-endian): đọc
+# theo little-endian thì các pixel kề nhau nhảy màu lung tung thay vì liền mạch
+SOURCE_SWAPPED = True
+
+
+def read_define(path, pattern):
+    with open(path, encoding="utf-8-sig") as f:
+        m = re.search(pattern, f.read())
+    if not m:
+        raise SystemExit("%s: %s not found" % (path, pattern))
+    return int(m.group(1), 0)
+
+
+def read_rgb565a8(path):
+    with open(path, encoding="utf-8") as f:
+        text = f.read()
+    body = text[text.index("{", text.index("_map[]")) + 1:text.index("};")]
+    data = bytes(int(x, 16) for x in re.findall(r"0x[0-9a-fA-F]{2}", body))
+    if "LV_IMG_CF_RGB565A8" not in text:
+        raise SystemExit("%s: expected an LV_IMG_CF_RGB565A8 image" % path)
+    w = int(re.search(r"\.header\.w\s*=\s*(\d+)", text).group(1))
+    h = int(re.search(r"\.header\.h\s*=\s*(\d+)", text).group(1))
+    if len(data) != w * h * 3:
+        raise SystemExit("%s: %d bytes, expected %d" % (path, len(data), w * h * 3))
+    return w, h, data
+
+
+def mix(fg, bg, alpha):
+    # Giống LV_COLOR_MIX của LVGL 8.3 (LV_COLOR_MIX_ROUND_OFS 0) trên từng kênh 565
+    out = 0
+    for shift, mask in ((11, 0x1F), (5, 0x3F), (0, 0x1F)):
+        a = (fg >> shift) & mask
+        b = (bg >> shift) & mask
+        c = ((a * alpha + b * (255 - alpha)) * 0x8081) >> 23
+        out |= (c & mask) << shift
+    return out
+
+
+def flatten(w, h, data, background, swap):
+    bg565 = ((background >> 8) & 0xF800) | ((background >> 5) & 0x07E0) | ((background >> 3) & 0x001F)
+    out = bytearray(w * h * 2)
+    alpha = data[w * h * 2:]
+    for i in range(w * h):
+        hi, lo = (data[2 * i], data[2 * i + 1]) if SOURCE_SWAPPED else (data[2 * i + 1], data[2 * i])
+        px = mix((hi << 8) | lo, bg565, alpha[i])
+        if swap:
+            out[2 * i], out[2 * i + 1] = px >> 8, px & 0xFF
+        else:
+            out[2 * i], out[2 * i + 1] = px & 0xFF, px >> 8
+    return bytes(out)
+
+
+def render(w, h, pixels, background, swap):
+    lines = [
+        "// Sinh bởi tools/bg_flatten.py từ assets/bg_rgb565a8.c, không sửa tay.",
+        "// Ảnh nền đã trộn sẵn với NavColors::BackgroundHex = 0x%06X, không alpha." % background,
+        '#include "../.pio/libdeps/esp32-c3-devkitm-1/lvgl/lvgl.h"',
+        "",
+        "#if LV_COLOR_16_SWAP != %d" % swap,
+        "#error \"bg.c được sinh với LV_COLOR_16_SWAP %d: chạy lại tools/bg_flatten.py\"" % swap,
+        "#endif",
+        "",
+        "#ifndef LV_ATTRIBUTE_MEM_ALIGN",
+        "#define LV_ATTRIBUTE_MEM_ALIGN",
+        "#endif",
+        "",
+        "#ifndef LV_ATTRIBUTE_IMG_BG",
+        "#define LV_ATTRIBUTE_IMG_BG",
+        "#endif",
+        "",
+        "const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_BG uint8_t bg_map[] = {",
+    ]
+    for i in range(0, len(pixels), BYTES_PER_LINE):
+        lines.append("  " + ", ".join("0x%02x" % b for b in pixels[i:i + BYTES_PER_LINE]) + ",")
+    lines += [
+        "};",
+        "",
+        "const lv_img_dsc_t bg_img = {",
+        "  .header.cf = LV_IMG_CF_TRUE_COLOR,",
+        "  .header.always_zero = 0,",
+        "  .header.reserved = 0,",
+        "  .header.w = %d," % w,
+        "  .header.h = %d," % h,
+        "  .data_size = %d," % len(pixels),
+        "  .data = bg_map,",
+        "};",
+        "",
+    ]
+    return "\n".join(lines)
+
+
+def generate(root):
+    background = read_define(os.path.join(root, "include", "VietnameseFonts.h"),
+                             r"BackgroundHex\s*=\s*(0x[0-9A-Fa-f]+)")
+    swap = read_define(os.path.join(root, "include", "lv_conf.h"), r"#define\s+LV_COLOR_16_SWAP\s+(\d+)")
+    w, h, data = read_rgb565a8(os.path.join(root, "assets", "bg_rgb565a8.c"))
+    return render(w, h, flatten(w, h, data, background, swap), background, swap)
+
+
+def update(root, check=False):
+    """Ghi src/bg.c nếu khác kết quả sinh ra (không ghi khi không đổi để tránh build lại)."""
+    output = os.path.join(root, "src", "bg.c")
+    text = generate(root)
+    if os.path.exists(output):
+        with open(output, encoding="utf-8") as f:
+            if f.read() == text:
+                return 0
+    if check:
+        print("src/bg.c is stale: run tools/bg_flatten.py", file=sys.stderr)
+        return 1
+    with open(output, "w", encoding="utf-8") as f:
+        f.write(text)
+    print("bg_flatten: wrote src/bg.c")
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--check", action="store_true", help="chỉ kiểm tra src/bg.c, không ghi")
+    args = parser.parse_args()
+    return update(os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")), args.check)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
+else:
+    # Chạy như extra_script của PlatformIO
+    Import("env")  # noqa: F821
+    update(env.subst("$PROJECT_DIR"))  # noqa: F821
@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+"""Giải mã log nhị phân (BINLOG_TEXT_OUTPUT=0) thành văn bản.
+
+Chuỗi định dạng được đọc trực tiếp từ src/LogMessages.h nên id luôn khớp
+với firmware đã build từ cùng mã nguồn.
+
+    python3 tools/binlog_decode.py capture.bin
+    python3 tools/binlog_decode.py /dev/ttyACM0 --serial
+"""
+import argparse
+import os
+import re
+import struct
+import sys
+
+MAGIC = b"\xB1\x0C"
+RECORD = struct.Struct("<IHBB4I")  # khớp với BinLogRecord (24 byte)
+LEVELS = "-EWID"
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_CATALOG = os.path.join(HERE, "..", "src", "LogMessages.h")
+
+
+def load_catalog(path):
+    text = open(path, encoding="utf-8").read()
+    entries = re.findall(r'X\(\s*(\w+)\s*,\s*"((?:[^"\\]|\\.)*)"\s*\)', text)
+    return [(name, fmt.encode().decode("unicode_escape")) for name, fmt in entries]
+
+
+def c_format(fmt, args):
+    # Chuyển %lu/%ld về dạng Python hiểu được; các tham số là uint32
+    fmt = re.sub(r"%(\d*)l([udxX])", r"%\1\2", fmt).replace("%u", "%d")
+    count = len(re.findall(r"%[-+ #0]*\d*[dixXs]", fmt))
+    values = []
+    for spec, value in zip(re.findall(r"%[-+ #0]*\d*([dixXs])", fmt), args[:count]):
+        if spec in "di" and value & 0x80000000:
+            value -= 1 << 32
+        values.append(value)
+    try:
+        return fmt % tuple(values)
+    except (TypeError, ValueError):
+        return "%s %r" % (fmt, args)
+
+
+def decode(stream, catalog, out):
+    buf = b""
+    while True:
+        chunk = stream.read(256)
+        if not chunk:
+            break
+        buf += chunk
+        while True:
+            start = buf.find(MAGIC)
+            if start < 0:
+                buf = buf[-1:]
+                break
+            if len(buf) < start + 2 + RECORD.size:
+                buf = buf[start:]
+                break
+            ts, log_id, level, argc, *args = RECORD.unpack_from(buf, start + 2)
+            buf = buf[start + 2 + RECORD.size:]
+            if log_id < len(catalog):
+                name, fmt = catalog[log_id]
+                text = c_format(fmt, args)
+            else:
+                name, text = "?", "unknown id %d args=%r" % (log_id, args[:argc])
+            tag = LEVELS[level] if level < len(LEVELS) else "?"
+            out.write("[%d][%s] %s: %s\n" % (ts, tag, name, text))
+            out.flush()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", help="file nhị phân hoặc cổng serial")
+    parser.add_argument("--catalog", default=DEFAULT_CATALOG, help="đường dẫn LogMessages.h")
+    parser.add_argument("--serial", action="store_true", help="đọc trực tiếp từ cổng serial (cần pyserial)")
+    parser.add_argument("--baud", type=int, default=115200)
+    args = parser.parse_args()
+
+    catalog = load_catalog(args.catalog)
+    if args.serial:
+        import serial  # pyserial
+        stream = serial.Serial(args.input, args.baud, timeout=1)
+    else:
+        stream = open(args.input, "rb")
+    try:
+        decode(stream, catalog, sys.stdout)
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
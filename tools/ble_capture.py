@@ -0,0 +1,152 @@
+#!/usr/bin/env python3
+"""Công cụ cho file capture BLE .chcap (xem src/ChronosCapture.h).
+
+    # gom frame capture từ Serial (firmware build với -DCHRONOS_CAPTURE=1)
+    python3 tools/ble_capture.py extract /dev/ttyACM0 --serial -o ride.chcap
+    python3 tools/ble_capture.py extract serial_dump.bin -o ride.chcap
+
+    # chuyển qua lại giữa .chcap và dạng văn bản "<ms> <hex>" mỗi dòng
+    python3 tools/ble_capture.py dump ride.chcap > ride.txt
+    python3 tools/ble_capture.py build ride.txt -o ride.chcap
+
+Phát lại bằng tools/replay/chronos_replay.
+"""
+import argparse
+import struct
+import sys
+
+FILE_MAGIC = b"CHCP"
+VERSION = 1
+FRAME_MAGIC = b"\xC4\x9E"
+RECORD = struct.Struct("<IHBB")  # khớp với ChronosCaptureRecord (8 byte)
+FLAG_RX = 0x01
+MAX_LENGTH = 1024  # lớn hơn mọi lần ghi hợp lệ, dùng để loại frame giả
+
+
+def write_capture(out, records):
+    out.write(FILE_MAGIC + bytes([VERSION, 0, 0, 0]))
+    for ts, flags, data in records:
+        out.write(RECORD.pack(ts, len(data), flags, 0))
+        out.write(data)
+
+
+def read_capture(stream):
+    header = stream.read(8)
+    if header[:4] != FILE_MAGIC:
+        raise SystemExit("not a .chcap file")
+    if header[4] != VERSION:
+        raise SystemExit("unsupported capture version %d" % header[4])
+    while True:
+        raw = stream.read(RECORD.size)
+        if len(raw) < RECORD.size:
+            return
+        ts, length, flags, _ = RECORD.unpack(raw)
+        data = stream.read(length)
+        if len(data) < length:
+            raise SystemExit("truncated record")
+        yield ts, flags, data
+
+
+def extract_frames(stream):
+    """Tách frame capture khỏi luồng Serial lẫn log văn bản."""
+    buf = b""
+    while True:
+        chunk = stream.read(256)
+        if not chunk:
+            return
+        buf += chunk
+        while True:
+            start = buf.find(FRAME_MAGIC)
+            if start < 0:
+                buf = buf[-1:]
+                break
+            body = start + len(FRAME_MAGIC)
+            if len(buf) < body + RECORD.size:
+                buf = buf[start:]
+                break
+            ts, length, flags, reserved = RECORD.unpack_from(buf, body)
+            if length == 0 or length > MAX_LENGTH or reserved != 0:
+                buf = buf[start + 1:]
+                continue
+            end = body + RECORD.size + length
+            if len(buf) < end + 1:
+                buf = buf[start:]
+                break
+            if sum(buf[body:end]) & 0xFF != buf[end]:
+                buf = buf[start + 1:]
+                continue
+            yield ts, flags, buf[body + RECORD.size:end]
+            buf = buf[end + 1:]
+
+
+def open_input(path, serial_port, baud):
+    if serial_port:
+        import serial  # pyserial
+        return serial.Serial(path, baud, timeout=1)
+    return open(path, "rb")
+
+
+def cmd_extract(args):
+    records = []
+    stream = open_input(args.input, args.serial, args.baud)
+    try:
+        for record in extract_frames(stream):
+            records.append(record)
+            if args.serial:
+                print("%8d ms  %3d bytes" % (record[0], len(record[2])), file=sys.stderr)
+    except KeyboardInterrupt:
+        pass
+    with open(args.output, "wb") as out:
+        write_capture(out, records)
+    print("%d records -> %s" % (len(records), args.output), file=sys.stderr)
+
+
+def cmd_dump(args):
+    with open(args.input, "rb") as stream:
+        for ts, flags, data in read_capture(stream):
+            print("%d %s" % (ts, data.hex(" ")))
+
+
+def cmd_build(args):
+    records = []
+    with open(args.input, encoding="utf-8") as text:
+        for lineno, line in enumerate(text, 1):
+            line = line.split("#", 1)[0].strip()
+            if not line:
+                continue
+            ts, _, payload = line.partition(" ")
+            try:
+                records.append((int(ts), FLAG_RX, bytes.fromhex(payload)))
+            except ValueError as err:
+                raise SystemExit("%s:%d: %s" % (args.input, lineno, err))
+    with open(args.output, "wb") as out:
+        write_capture(out, records)
+    print("%d records -> %s" % (len(records), args.output), file=sys.stderr)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    p = sub.add_parser("extract", help="collect capture frames from serial output")
+    p.add_argument("input", help="serial dump file or serial port")
+    p.add_argument("-o", "--output", required=True)
+    p.add_argument("--serial", action="store_true", help="input is a serial port (needs pyserial)")
+    p.add_argument("--baud", type=int, default=115200)
+    p.set_defaults(func=cmd_extract)
+
+    p = sub.add_parser("dump", help="print a .chcap file as '<ms> <hex>' lines")
+    p.add_argument("input")
+    p.set_defaults(func=cmd_dump)
+
+    p = sub.add_parser("build", help="build a .chcap file from '<ms> <hex>' lines")
+    p.add_argument("input")
+    p.add_argument("-o", "--output", required=True)
+    p.set_defaults(func=cmd_build)
+
+    args = parser.parse_args()
+    args.func(args)
+
+
+if __name__ == "__main__":
+    main()
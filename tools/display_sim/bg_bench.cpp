@@ -0,0 +1,173 @@
+/*
+ * So sánh chi phí vẽ hình nền điều hướng trên host:
+ *  - blend: ảnh RGB565A8 gốc (assets/bg_rgb565a8.c) như LVGL 8.3 vẽ: tách dòng
+ *    màu và dòng alpha ra buffer tạm rồi trộn từng pixel theo mask;
+ *  - blit : ảnh đã làm phẳng (src/bg.c, tools/bg_flatten.py) chỉ cần chép từng dòng.
+ * Kiểm tra luôn kết quả hai đường giống nhau trên nền NavColors::BackgroundHex.
+ *
+ *   make bench-bg
+ *
+ * Số đo trên máy host chỉ cho tỉ lệ giữa hai đường, không phải thời gian trên ESP32-C3.
+ */
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+static const int W = 240;
+static const int H = 240;
+static const int BAND = 20; // số dòng mỗi buffer vẽ (DRAW_BUF_DOUBLE_BAND)
+
+// Các byte 0x.. của mảng đầu tiên trong file C do LVGL image converter/bg_flatten sinh ra
+static bool readArray(const char *path, std::vector<uint8_t> &out)
+{
+	std::ifstream f(path);
+	if (!f)
+	{
+		return false;
+	}
+	std::stringstream ss;
+	ss << f.rdbuf();
+	std::string text = ss.str();
+	size_t pos = text.find("_map[]");
+	pos = pos == std::string::npos ? pos : text.find('{', pos);
+	size_t end = pos == std::string::npos ? pos : text.find("};", pos);
+	if (end == std::string::npos)
+	{
+		return false;
+	}
+	for (size_t i = pos; i + 3 < end; i++)
+	{
+		if (text[i] == '0' && text[i + 1] == 'x')
+		{
+			out.push_back((uint8_t)strtoul(text.substr(i, 4).c_str(), nullptr, 16));
+			i += 3;
+		}
+	}
+	return true;
+}
+
+// LV_COLOR_MIX của LVGL 8.3 trên từng kênh RGB565 (giá trị chưa đổi byte)
+static inline uint16_t mix(uint16_t fg, uint16_t bg, uint8_t a)
+{
+	uint32_t r = ((((fg >> 11) & 0x1F) * a + ((bg >> 11) & 0x1F) * (255 - a)) * 0x8081) >> 23;
+	uint32_t g = ((((fg >> 5) & 0x3F) * a + ((bg >> 5) & 0x3F) * (255 - a)) * 0x8081) >> 23;
+	uint32_t b = (((fg & 0x1F) * a + (bg & 0x1F) * (255 - a)) * 0x8081) >> 23;
+	return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+static inline uint16_t swap16(uint16_t v) { return (uint16_t)((v << 8) | (v >> 8)); }
+
+// Đường RGB565A8: nền đã có trong buffer, ảnh được trộn lên theo alpha.
+// swapped: màu trong buffer và trong ảnh theo thứ tự byte của panel (LV_COLOR_16_SWAP)
+static void drawBlend(uint16_t *band, int y0, const uint8_t *src, bool swapped)
+{
+	static uint16_t rgb[W];
+	static uint8_t mask[W];
+	const uint8_t *alpha = src + W * H * 2;
+	for (int y = 0; y < BAND; y++)
+	{
+		int sy = y0 + y;
+		memcpy(rgb, src + sy * W * 2, W * 2);
+		memcpy(mask, alpha + sy * W, W);
+		uint16_t *dest = band + y * W;
+		for (int x = 0; x < W; x++)
+		{
+			if (mask[x] >= 253) // LV_OPA_MAX
+			{
+				dest[x] = rgb[x];
+			}
+			else if (mask[x] > 2) // LV_OPA_MIN
+			{
+				uint16_t fg = swapped ? swap16(rgb[x]) : rgb[x];
+				uint16_t bg = swapped ? swap16(dest[x]) : dest[x];
+				uint16_t c = mix(fg, bg, mask[x]);
+				dest[x] = swapped ? swap16(c) : c;
+			}
+		}
+	}
+}
+
+// Đường TRUE_COLOR không alpha: chép dòng
+static void drawBlit(uint16_t *band, int y0, const uint8_t *src)
+{
+	for (int y = 0; y < BAND; y++)
+	{
+		memcpy(band + y * W, src + (y0 + y) * W * 2, W * 2);
+	}
+}
+
+template <typename F>
+static double timeFrames(int frames, F draw)
+{
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (int f = 0; f < frames; f++)
+	{
+		draw();
+	}
+	std::chrono::duration<double, std::micro> us = std::chrono::steady_clock::now() - start;
+	return us.count() / frames;
+}
+
+int main(int argc, char **argv)
+{
+	const char *sourcePath = argc > 1 ? argv[1] : "../../assets/bg_rgb565a8.c";
+	const char *flatPath = argc > 2 ? argv[2] : "../../src/bg.c";
+	const int frames = 400;
+
+	std::vector<uint8_t> source, flat;
+	if (!readArray(sourcePath, source) || source.size() != (size_t)W * H * 3)
+	{
+		fprintf(stderr, "%s: expected a %dx%d RGB565A8 image\n", sourcePath, W, H);
+		return 2;
+	}
+	if (!readArray(flatPath, flat) || flat.size() != (size_t)W * H * 2)
+	{
+		fprintf(stderr, "%s: expected a %dx%d TRUE_COLOR image\n", flatPath, W, H);
+		return 2;
+	}
+
+	// Nền đen (NavColors::BackgroundHex) giống nhau ở hai thứ tự byte
+	static uint16_t screen[W * H];
+	static uint16_t band[W * BAND];
+
+	// Kết quả: trộn ảnh gốc lên nền phải trùng với ảnh đã làm phẳng
+	memset(screen, 0, sizeof(screen));
+	for (int y0 = 0; y0 < H; y0 += BAND)
+	{
+		drawBlend(screen + y0 * W, y0, source.data(), true);
+	}
+	uint32_t mismatches = 0;
+	for (int i = 0; i < W * H; i++)
+	{
+		uint16_t expected = (uint16_t)(flat[2 * i] | (flat[2 * i + 1] << 8));
+		mismatches += screen[i] != expected;
+	}
+
+	double blendUs = timeFrames(frames, [&]() {
+		for (int y0 = 0; y0 < H; y0 += BAND)
+		{
+			memset(band, 0, sizeof(band));
+			drawBlend(band, y0, source.data(), true);
+		}
+	});
+	double blitUs = timeFrames(frames, [&]() {
+		for (int y0 = 0; y0 < H; y0 += BAND)
+		{
+			memset(band, 0, sizeof(band));
+			drawBlit(band, y0, flat.data());
+		}
+	});
+
+	printf("asset       : %zu B RGB565A8 -> %zu B TRUE_COLOR (%zu B flash saved)\n", source.size(), flat.size(),
+		   source.size() - flat.size());
+	printf("blend       : %.1f us/frame (%.2f ns/px)\n", blendUs, blendUs * 1000.0 / (W * H));
+	printf("blit        : %.1f us/frame (%.2f ns/px), %.1fx faster\n", blitUs, blitUs * 1000.0 / (W * H),
+		   blendUs / blitUs);
+	printf("mismatches  : %u\n", mismatches);
+	return mismatches == 0 ? 0 : 1;
+}
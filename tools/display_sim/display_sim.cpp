@@ -0,0 +1,241 @@
+/*
+ * Mô phỏng đường flush của LVGL_Display (include/LVGL_Config.h) trên Linux với
+ * mock LVGL và mock bus SPI có thời gian truyền, để kiểm tra DMA chạy song song
+ * với việc vẽ và đo thời gian một frame.
+ *
+ *   make bench                              # so sánh flush đồng bộ / DMA bất đồng bộ
+ *   ./display_sim_async --render-ns 400 --spi-mhz 80 --frames 50
+ *   ./display_sim_async --mode full --rows 60  # direct mode, vẽ lại 60 dòng mỗi frame
+ *   make tune                               # chạy tuneDrawBuffers() như trên máy thật
+ *   ./display_sim_async --drive 60          # loop() điều hướng 60 s với bộ lập lịch frame
+ *
+ * Thời gian là đồng hồ ảo: vẽ tốn render-ns mỗi pixel, SPI tốn 16 bit / pixel
+ * ở spi-mhz. Số đo chỉ phản ánh cách sắp xếp vẽ/truyền, không phải tốc độ thật.
+ */
+#include <Arduino.h>
+#include "../../include/LVGL_Config.h"
+
+uint64_t simNowNs = 0;
+Print Serial;
+SimLvgl simLvgl;
+uint32_t simHeapFree = 180 * 1024; // ESP32-C3 sau khi NimBLE và LVGL khởi tạo
+EspClass ESP;
+uint32_t LGFX::spiHz = 40000000;
+uint32_t LGFX::commandNs = 2000;
+
+static void usage(const char *argv0)
+{
+	fprintf(stderr, "usage: %s [--frames N] [--render-ns N] [--spi-mhz N] [--rows N]\n"
+					"       [--heap BYTES] [--mode double|single|full] [--tune] [--drive SECONDS]\n",
+			argv0);
+}
+
+static bool parseMode(const char *name, DrawBufferMode &mode)
+{
+	static const struct
+	{
+		const char *name;
+		DrawBufferMode mode;
+	} modes[] = {
+		{"double", DRAW_BUF_DOUBLE_BAND},
+		{"single", DRAW_BUF_SINGLE_LARGE},
+		{"full", DRAW_BUF_FULL_FRAME},
+	};
+	for (size_t i = 0; i < sizeof(modes) / sizeof(modes[0]); i++)
+	{
+		if (strcmp(name, modes[i].name) == 0)
+		{
+			mode = modes[i].mode;
+			return true;
+		}
+	}
+	return false;
+}
+
+// Chạy benchmark của LVGL_Display với log Serial như trên máy thật
+static int tune(LVGL_Display &display)
+{
+	DrawBufferResult results[3];
+	Serial.enabled = true;
+	DrawBufferMode best = display.tuneDrawBuffers(results);
+	Serial.enabled = false;
+
+	// Lần khởi động sau đọc lại kết quả từ NVS, không đo nữa. Heap được trả lại
+	// phần buffer mà display đầu tiên vẫn giữ, như sau một lần khởi động lại.
+	simHeapFree += 240 * 240 * sizeof(lv_color_t);
+	LVGL_Display again;
+	again.init();
+	printf("reload      : %s, tuning %s\n", again.getDrawBufferMode() == best ? "persisted" : "LOST",
+		   again.needsDrawBufferTuning() ? "requested again" : "skipped");
+	return again.getDrawBufferMode() == best && !again.needsDrawBufferTuning() &&
+				   display.getTft()->stats().corruptions == 0 && simLvgl.staleBuffer == 0
+			   ? 0
+			   : 1;
+}
+
+// Mô phỏng loop() ở chế độ điều hướng: mỗi vòng tốn loopUs cho BLE/input, khoảng
+// cách đổi mỗi giây (dải 240x35), đồng hồ đổi mỗi phút, rồi nghỉ theo update()
+static int drive(LVGL_Display &display, uint32_t seconds)
+{
+	const uint64_t loopNs = 200000;
+	uint64_t end = simNowNs + (uint64_t)seconds * 1000000000ULL;
+	uint64_t sleptNs = 0;
+	uint32_t loops = 0;
+	uint32_t lastSecond = millis() / 1000;
+	display.resetFrameStats();
+	simLvgl.timerRuns = 0;
+
+	while (simNowNs < end)
+	{
+		loops++;
+		simAdvance(loopNs);
+		uint32_t second = millis() / 1000;
+		if (second != lastSecond)
+		{
+			lastSecond = second;
+			lv_area_t distance = {60, 130, 179, 164};
+			lv_inv_area(&simLvgl.disp, &distance);
+			if (second % 60 == 0)
+			{
+				lv_area_t clock = {5, 5, 60, 30};
+				lv_inv_area(&simLvgl.disp, &clock);
+			}
+		}
+		uint32_t idleMs = display.update();
+		if (idleMs > 0)
+		{
+			idleMs = idleMs < 10 ? idleMs : 10; // Config::NAV_IDLE_MAX_MS
+			delay(idleMs);
+			sleptNs += idleMs * 1000000ULL;
+		}
+	}
+	display.finishFlush();
+
+	const FrameStats &stats = display.getFrameStats();
+	printf("drive       : %u s, %u loops, %.0f%% of the time sleeping\n", seconds, loops,
+		   sleptNs * 100.0 / (seconds * 1e9));
+	printf("scheduler   : %u lv_timer_handler runs, %u frames, %llu px redrawn\n", simLvgl.timerRuns,
+		   stats.frames, (unsigned long long)stats.totalPixels);
+	return display.getTft()->stats().corruptions == 0 ? 0 : 1;
+}
+
+int main(int argc, char **argv)
+{
+	uint32_t frames = 20;
+	uint32_t rows = 240; // số dòng bị invalidate mỗi frame (tính từ trên xuống)
+	bool forceMode = false;
+	bool runTune = false;
+	uint32_t driveSeconds = 0;
+	DrawBufferMode mode = DRAW_BUF_DOUBLE_BAND;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+		{
+			frames = (uint32_t)atoi(argv[++i]);
+		}
+		else if (strcmp(argv[i], "--render-ns") == 0 && i + 1 < argc)
+		{
+			simLvgl.renderNsPerPixel = (uint32_t)atoi(argv[++i]);
+		}
+		else if (strcmp(argv[i], "--spi-mhz") == 0 && i + 1 < argc)
+		{
+			LGFX::spiHz = (uint32_t)atoi(argv[++i]) * 1000000u;
+		}
+		else if (strcmp(argv[i], "--rows") == 0 && i + 1 < argc)
+		{
+			rows = (uint32_t)atoi(argv[++i]);
+		}
+		else if (strcmp(argv[i], "--heap") == 0 && i + 1 < argc)
+		{
+			simHeapFree = (uint32_t)atoi(argv[++i]);
+		}
+		else if (strcmp(argv[i], "--mode") == 0 && i + 1 < argc && parseMode(argv[i + 1], mode))
+		{
+			forceMode = true;
+			i++;
+		}
+		else if (strcmp(argv[i], "--drive") == 0 && i + 1 < argc)
+		{
+			driveSeconds = (uint32_t)atoi(argv[++i]);
+		}
+		else if (strcmp(argv[i], "--tune") == 0)
+		{
+			runTune = true;
+		}
+		else
+		{
+			usage(argv[0]);
+			return 2;
+		}
+	}
+	if (frames == 0 || rows == 0 || rows > 240 || LGFX::spiHz == 0)
+	{
+		usage(argv[0]);
+		return 2;
+	}
+
+	LVGL_Display &display = LVGL_Display::getInstance();
+	display.init();
+	if (runTune)
+	{
+		return tune(display);
+	}
+	if (forceMode && !display.setDrawBufferMode(mode))
+	{
+		fprintf(stderr, "draw buffer mode does not fit in %u bytes of heap\n", simHeapFree);
+		return 1;
+	}
+	if (driveSeconds > 0)
+	{
+		return drive(display, driveSeconds);
+	}
+	LGFX &tft = *display.getTft();
+	tft.resetStats();
+	display.resetFrameStats();
+	simLvgl.renderNs = 0;
+	simLvgl.flushes = 0;
+
+	uint64_t totalNs = 0;
+	uint64_t worstNs = 0;
+	for (uint32_t f = 0; f < frames; f++)
+	{
+		// Chờ tới lượt của bộ lập lịch frame (không tính vào thời gian frame)
+		simAdvance(LVGL_FRAME_BUDGET_MS * 1000000ULL);
+		lv_area_t area = {0, 0, 239, (lv_coord_t)(rows - 1)};
+		lv_inv_area(&simLvgl.disp, &area);
+
+		// Một frame kết thúc khi dải cuối cùng đã truyền xong lên panel
+		uint64_t start = simNowNs;
+		display.update();
+		while (!display.pollFlush())
+		{
+		}
+		uint64_t ns = simNowNs - start;
+		totalNs += ns;
+		worstNs = ns > worstNs ? ns : worstNs;
+	}
+
+	const MockBusStats &bus = tft.stats();
+	double frameMs = totalNs / 1e6 / frames;
+	double renderMs = simLvgl.renderNs / 1e6 / frames;
+	double spiMs = bus.busyNs / 1e6 / frames;
+	double waitMs = bus.cpuWaitNs / 1e6 / frames;
+	double hidden = renderMs + spiMs - frameMs;
+	double overlap = hidden > 0 ? hidden / (renderMs < spiMs ? renderMs : spiMs) * 100.0 : 0.0;
+
+	printf("flush       : %s, %s buffer\n", LVGL_ASYNC_FLUSH ? "async DMA" : "synchronous",
+		   display.getDrawBufferMode() == DRAW_BUF_FULL_FRAME ? "full frame"
+		   : display.getDrawBufferMode() == DRAW_BUF_SINGLE_LARGE ? "single 1x80"
+																	 : "double 2x20");
+	printf("frame       : %.2f ms avg, %.2f ms worst, %u bands, %.1f fps\n",
+		   frameMs, worstNs / 1e6, simLvgl.flushes / frames, 1000.0 / frameMs);
+	printf("render/spi  : %.2f ms render, %.2f ms spi, %.2f ms cpu waiting on bus\n", renderMs, spiMs, waitMs);
+	const FrameStats &stats = display.getFrameStats();
+	printf("invalidated : %lu px/frame, %lu B flushed/frame over %u frames\n",
+		   (unsigned long)(stats.totalPixels / stats.frames), (unsigned long)(stats.totalFlushBytes / stats.frames),
+		   stats.frames);
+	printf("overlap     : %.0f%% of the shorter phase hidden\n", overlap);
+	printf("corruptions : %u, %u stale buffer pixels\n", bus.corruptions, simLvgl.staleBuffer);
+	return bus.corruptions == 0 && simLvgl.staleBuffer == 0 ? 0 : 1;
+}
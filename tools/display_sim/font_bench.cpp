@@ -0,0 +1,195 @@
+/*
+ * So sánh các biến thể font do tools/font_subset.py sinh ra (--bench-dir font_variants):
+ *  - full  : font gốc trong include/fonts/ (ASCII + tiếng Việt, 4 bpp không nén);
+ *  - subset: chỉ các glyph widget dùng, cmap dựng lại (chỉ font có tập ký tự riêng);
+ *  - rle   : như subset (hoặc full), bitmap nén RLE + prefilter (LV_USE_FONT_COMPRESSED).
+ * Với mỗi biến thể: flash (bitmap + glyph_dsc + cmap), thời gian tra glyph
+ * (lv_font_get_glyph_dsc) và thời gian vẽ một glyph (tra + lấy bitmap, gồm giải nén,
+ * + trộn vào buffer 565 như lv_draw_sw_letter) trên text mẫu của widget dùng font.
+ * Kiểm tra luôn: mọi glyph của subset/rle phải có cùng metric và cùng pixel với full.
+ *
+ *   make bench-fonts
+ *
+ * Số đo trên máy host chỉ cho tỉ lệ giữa các biến thể, không phải thời gian trên ESP32-C3.
+ */
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include "GlyphStrip.h"
+
+#define FONT_VARIANT(symbol, font, variant, flash, glyphs, corpus) extern "C" const lv_font_t symbol;
+#include "font_variants/variants.inc"
+#undef FONT_VARIANT
+
+struct Variant
+{
+	const lv_font_t *font;
+	const char *fontName;
+	const char *name;
+	unsigned flash;
+	unsigned glyphs;
+	const char *corpus;
+};
+
+static const Variant VARIANTS[] = {
+#define FONT_VARIANT(symbol, font, variant, flash, glyphs, corpus) {&symbol, font, variant, flash, glyphs, corpus},
+#include "font_variants/variants.inc"
+#undef FONT_VARIANT
+};
+
+static const int ROUNDS = 20000;
+static const int W = 64; // ô vẽ đủ cho glyph lớn nhất (48 px)
+static const uint16_t FG = 0xFFFF;
+
+// lv_color_mix() của LVGL 8.3 với màu 16 bit (LV_COLOR_MIX_ROUND_OFS 0 như lv_conf.h)
+static inline uint16_t mix565(uint16_t c1, uint16_t c2, uint8_t mix)
+{
+	uint32_t r = (((c1 >> 11) * mix + (c2 >> 11) * (255 - mix)) * 0x8081U) >> 23;
+	uint32_t g = ((((c1 >> 5) & 0x3F) * mix + ((c2 >> 5) & 0x3F) * (255 - mix)) * 0x8081U) >> 23;
+	uint32_t b = (((c1 & 0x1F) * mix + (c2 & 0x1F) * (255 - mix)) * 0x8081U) >> 23;
+	return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+static std::vector<uint32_t> codepoints(const char *text)
+{
+	std::vector<uint32_t> out;
+	for (const char *s = text; *s;)
+	{
+		out.push_back(GlyphStrip::nextCodepoint(s));
+	}
+	return out;
+}
+
+// Một glyph vào ô W x W: tra, lấy bitmap rồi trộn từng pixel khác 0
+static void drawGlyph(const lv_font_t *font, uint32_t letter, uint16_t *cell)
+{
+	lv_font_glyph_dsc_t g;
+	if (!lv_font_get_glyph_dsc(font, &g, letter, 0) || g.box_w == 0)
+	{
+		return;
+	}
+	const uint8_t *bitmap = lv_font_get_glyph_bitmap(g.resolved_font, letter);
+	if (bitmap == nullptr)
+	{
+		return;
+	}
+	for (int y = 0; y < g.box_h && y < W; y++)
+	{
+		uint16_t *dst = cell + y * W;
+		for (int x = 0; x < g.box_w && x < W; x++)
+		{
+			uint8_t a = GlyphStrip::alphaAt(bitmap, (uint32_t)y * g.box_w + x);
+			if (a != 0)
+			{
+				dst[x] = a == 15 ? FG : mix565(FG, dst[x], a * 17);
+			}
+		}
+	}
+}
+
+// Mọi ký tự mà variant có phải giống hệt bản full (metric và từng pixel)
+static long compareGlyphs(const Variant &full, const Variant &v)
+{
+	long bad = 0;
+	unsigned found = 0;
+	for (uint32_t letter = 0x20; letter < 0x1F00; letter++)
+	{
+		lv_font_glyph_dsc_t a;
+		lv_font_glyph_dsc_t b;
+		bool inFull = lv_font_get_glyph_dsc(full.font, &a, letter, 0);
+		if (!lv_font_get_glyph_dsc(v.font, &b, letter, 0))
+		{
+			continue;
+		}
+		found++;
+		if (!inFull || a.adv_w != b.adv_w || a.box_w != b.box_w || a.box_h != b.box_h || a.ofs_x != b.ofs_x ||
+			a.ofs_y != b.ofs_y)
+		{
+			bad++;
+			continue;
+		}
+		// Glyph rỗng (dấu cách): font nén trả về NULL như LVGL, không có gì để so
+		uint32_t n = (uint32_t)a.box_w * a.box_h;
+		if (n == 0)
+		{
+			continue;
+		}
+		// Bitmap giải nén nằm trong buffer dùng chung: chép ra trước khi lấy bitmap kia
+		std::vector<uint8_t> ref;
+		const uint8_t *pa = lv_font_get_glyph_bitmap(full.font, letter);
+		if (pa != nullptr)
+		{
+			ref.assign(pa, pa + (n + 1) / 2);
+		}
+		const uint8_t *pb = lv_font_get_glyph_bitmap(v.font, letter);
+		if ((pa == nullptr) != (pb == nullptr))
+		{
+			bad++;
+			continue;
+		}
+		for (uint32_t i = 0; pb != nullptr && i < n; i++)
+		{
+			if (GlyphStrip::alphaAt(&ref[0], i) != GlyphStrip::alphaAt(pb, i))
+			{
+				bad++;
+				break;
+			}
+		}
+	}
+	return bad + (found != v.glyphs ? 1 : 0);
+}
+
+int main()
+{
+	long mismatches = 0;
+	const Variant *full = nullptr;
+	std::vector<uint16_t> cell((size_t)W * W);
+	volatile uint32_t sink = 0;
+
+	printf("%-26s %-7s %6s %8s %10s %10s\n", "font", "variant", "glyphs", "flash", "lookup ns", "render ns");
+	for (size_t i = 0; i < sizeof(VARIANTS) / sizeof(VARIANTS[0]); i++)
+	{
+		const Variant &v = VARIANTS[i];
+		if (full == nullptr || strcmp(full->fontName, v.fontName) != 0)
+		{
+			full = &v; // variants.inc: bản full đứng đầu mỗi font
+		}
+		else
+		{
+			mismatches += compareGlyphs(*full, v);
+		}
+		std::vector<uint32_t> text = codepoints(v.corpus);
+		size_t glyphs = (size_t)ROUNDS * text.size();
+
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		for (int r = 0; r < ROUNDS; r++)
+		{
+			for (size_t k = 0; k < text.size(); k++)
+			{
+				lv_font_glyph_dsc_t g;
+				sink += lv_font_get_glyph_dsc(v.font, &g, text[k], k + 1 < text.size() ? text[k + 1] : 0) ? g.adv_w
+																										   : 0;
+			}
+		}
+		std::chrono::duration<double, std::nano> lookupNs = std::chrono::steady_clock::now() - start;
+
+		start = std::chrono::steady_clock::now();
+		for (int r = 0; r < ROUNDS; r++)
+		{
+			for (size_t k = 0; k < text.size(); k++)
+			{
+				drawGlyph(v.font, text[k], &cell[0]);
+			}
+		}
+		std::chrono::duration<double, std::nano> renderNs = std::chrono::steady_clock::now() - start;
+		sink += cell[W * W / 2];
+
+		printf("%-26s %-7s %6u %8u %10.1f %10.1f\n", v.fontName, v.name, v.glyphs, v.flash,
+			   lookupNs.count() / glyphs, renderNs.count() / glyphs);
+	}
+	printf("%ld mismatching glyphs\n", mismatches);
+	return mismatches == 0 ? 0 : 1;
+}
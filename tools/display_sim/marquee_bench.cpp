@@ -0,0 +1,198 @@
+/*
+ * So sánh chi phí mỗi frame của chữ chạy 230 px, font montserrat_bold_32 (biên dịch
+ * nguyên file include/fonts/subset/montserrat_bold_32.c, bản nén được build):
+ *  - label: như LV_LABEL_LONG_SCROLL_CIRCULAR của LVGL 8.3: mỗi frame lv_draw_label
+ *    duyệt lại toàn bộ text hai lần (bản chính và bản nối vòng), tra glyph từng ký tự,
+ *    giải nén và trộn các glyph nằm trong khung;
+ *  - strip: MarqueeLabel (src/GlyphStrip.h): text raster một lần, mỗi frame chỉ trộn
+ *    cửa sổ 230 px của dải.
+ * Cả hai đều vẽ lại nền dưới khung trước (LVGL vẽ hình nền của vùng invalid).
+ * Kiểm tra luôn: mọi frame của hai đường phải giống nhau từng pixel.
+ *
+ *   make bench-marquee
+ *
+ * Số đo trên máy host chỉ cho tỉ lệ giữa hai đường, không phải thời gian trên ESP32-C3.
+ */
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include "GlyphStrip.h"
+
+extern "C" lv_font_t *get_montserrat_bold_32();
+
+static const int WIN = 230;		// độ rộng nhãn
+static const int SPEED = 40;	// px/s
+static const int FPS = 30;		// LVGL_FRAME_BUDGET_MS = 33
+static const int SECONDS = 20;	// thời lượng mô phỏng mỗi text
+static const uint16_t FG = 0xFFFF;
+
+// lv_color_mix() của LVGL 8.3 với màu 16 bit (LV_COLOR_MIX_ROUND_OFS 0 như lv_conf.h)
+static inline uint16_t mix565(uint16_t c1, uint16_t c2, uint8_t mix)
+{
+	uint32_t r = (((c1 >> 11) * mix + (c2 >> 11) * (255 - mix)) * 0x8081U) >> 23;
+	uint32_t g = ((((c1 >> 5) & 0x3F) * mix + ((c2 >> 5) & 0x3F) * (255 - mix)) * 0x8081U) >> 23;
+	uint32_t b = (((c1 & 0x1F) * mix + (c2 & 0x1F) * (255 - mix)) * 0x8081U) >> 23;
+	return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+struct Frame
+{
+	int h;
+	std::vector<uint16_t> px;
+	std::vector<uint16_t> bg; // nền dưới khung (gradient giả cho hình nền)
+	Frame(int height) : h(height), px((size_t)WIN * height), bg((size_t)WIN * height)
+	{
+		for (size_t i = 0; i < bg.size(); i++)
+		{
+			bg[i] = (uint16_t)(i * 2654435761u >> 16);
+		}
+	}
+	void restore() { memcpy(&px[0], &bg[0], px.size() * sizeof(uint16_t)); }
+};
+
+// Một glyph qua font engine, bút ở penX (tọa độ khung); glyph ngoài khung bị bỏ sau khi tra
+static void drawLetter(Frame &f, const lv_font_t *font, uint32_t letter, uint32_t next, int penX)
+{
+	lv_font_glyph_dsc_t g;
+	if (!lv_font_get_glyph_dsc(font, &g, letter, next))
+	{
+		return;
+	}
+	int x0 = penX + g.ofs_x;
+	if (x0 + g.box_w <= 0 || x0 >= WIN || g.box_w == 0)
+	{
+		return;
+	}
+	const uint8_t *bitmap = lv_font_get_glyph_bitmap(g.resolved_font, letter);
+	int y0 = font->line_height - font->base_line - (g.ofs_y + g.box_h);
+	for (int gy = 0; gy < g.box_h; gy++)
+	{
+		for (int gx = 0; gx < g.box_w; gx++)
+		{
+			uint8_t a = GlyphStrip::alphaAt(bitmap, (uint32_t)gy * g.box_w + gx);
+			int x = x0 + gx;
+			int y = y0 + gy;
+			if (a == 0 || x < 0 || x >= WIN || y < 0 || y >= f.h)
+			{
+				continue;
+			}
+			uint16_t &d = f.px[(size_t)y * WIN + x];
+			d = a == 15 ? FG : mix565(FG, d, a * 17);
+		}
+	}
+}
+
+// lv_draw_label với bản chính ở -offset và bản nối vòng ở -offset + period
+static void labelFrame(Frame &f, const lv_font_t *font, const char *text, int offset, int period)
+{
+	f.restore();
+	for (int copy = 0; copy < 2; copy++)
+	{
+		int pen = -offset + copy * period;
+		for (const char *s = text; *s;)
+		{
+			uint32_t letter = GlyphStrip::nextCodepoint(s);
+			const char *n = s;
+			uint32_t next = *n ? GlyphStrip::nextCodepoint(n) : 0;
+			drawLetter(f, font, letter, next, pen);
+			lv_font_glyph_dsc_t g;
+			pen += lv_font_get_glyph_dsc(font, &g, letter, next) ? g.adv_w : 0;
+		}
+	}
+}
+
+// Như MarqueeLabel::draw: trộn cửa sổ của dải vào khung
+static void stripFrame(Frame &f, const GlyphStrip &strip, int offset, int period)
+{
+	f.restore();
+	auto plot = [](uint16_t &px, uint8_t a) { px = a == 15 ? FG : mix565(FG, px, a * 17); };
+	for (int y = 0; y < f.h && y < strip.height(); y++)
+	{
+		uint16_t *dst = &f.px[(size_t)y * WIN];
+		uint32_t sx = offset;
+		uint32_t remaining = WIN;
+		while (remaining > 0)
+		{
+			uint32_t n;
+			if (sx < strip.width())
+			{
+				n = remaining < strip.width() - sx ? remaining : strip.width() - sx;
+				strip.blendRow(y, sx, n, dst, plot);
+			}
+			else
+			{
+				n = remaining < period - sx ? remaining : period - sx;
+			}
+			dst += n;
+			remaining -= n;
+			sx += n;
+			if (sx == (uint32_t)period)
+			{
+				sx = 0;
+			}
+		}
+	}
+}
+
+int main()
+{
+	const lv_font_t *font = get_montserrat_bold_32();
+	const char *texts[] = {
+		"Start navigation on Google maps",
+		"Rẽ trái vào Đường Nguyễn Văn Linh",
+		"Tiếp tục đi thẳng trên Quốc lộ 1A về phía Biên Hòa",
+		"Take exit 12 toward Thủ Đức onto Xa lộ Hà Nội",
+	};
+	int frames = SECONDS * FPS;
+	long mismatches = 0;
+	// Như MarqueeLabel: một dải cấp sẵn cho mọi text
+	GlyphStrip strip;
+	strip.reserve(1536, font->line_height);
+	for (size_t t = 0; t < sizeof(texts) / sizeof(texts[0]); t++)
+	{
+		const char *text = texts[t];
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		strip.build(font, text, 1536);
+		std::chrono::duration<double, std::micro> buildUs = std::chrono::steady_clock::now() - start;
+		lv_font_glyph_dsc_t space;
+		lv_font_get_glyph_dsc(font, &space, ' ', ' ');
+		int period = strip.advance() + space.adv_w * 3;
+
+		Frame a(font->line_height);
+		Frame b(font->line_height);
+		for (int i = 0; i < frames; i++)
+		{
+			int offset = i * SPEED / FPS % period;
+			labelFrame(a, font, text, offset, period);
+			stripFrame(b, strip, offset, period);
+			for (size_t p = 0; p < a.px.size(); p++)
+			{
+				mismatches += a.px[p] != b.px[p];
+			}
+		}
+
+		start = std::chrono::steady_clock::now();
+		for (int i = 0; i < frames; i++)
+		{
+			labelFrame(a, font, text, i * SPEED / FPS % period, period);
+		}
+		std::chrono::duration<double, std::nano> labelNs = std::chrono::steady_clock::now() - start;
+		start = std::chrono::steady_clock::now();
+		for (int i = 0; i < frames; i++)
+		{
+			stripFrame(b, strip, i * SPEED / FPS % period, period);
+		}
+		std::chrono::duration<double, std::nano> stripNs = std::chrono::steady_clock::now() - start;
+
+		printf("\"%s\"\n", text);
+		printf("  strip %ux%u px, %zu bytes, built in %.1f us\n", strip.width(), strip.height(), strip.bytes(),
+			   buildUs.count());
+		printf("  label: %7.0f ns/frame   strip: %7.0f ns/frame (%.1fx faster)\n", labelNs.count() / frames,
+			   stripNs.count() / frames, labelNs.count() / stripNs.count());
+	}
+	printf("%d frames per text, %ld mismatching pixels\n", frames, mismatches);
+	return mismatches == 0 ? 0 : 1;
+}
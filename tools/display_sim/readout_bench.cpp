@@ -0,0 +1,350 @@
+/*
+ * So sánh chi phí cập nhật số khoảng cách trên host, cùng font montserrat_number_bold_48
+ * (biên dịch nguyên file include/fonts/subset/montserrat_number_bold_48.c, bản nén được build):
+ *  - label : như _distanceLabel trong LVGL 8.3: đo text (lv_label_refr_text và layout
+ *    của container LV_SIZE_CONTENT), invalidate cả nhãn, vẽ lại nền rồi từng glyph
+ *    qua font engine (tra cmap, giải nén 4 bpp, trộn từng pixel);
+ *  - sprite: DistanceReadout (src/DigitAtlas.h): chỉ các ô đổi được vẽ lại, mỗi pixel
+ *    là một lần tra bảng 16 màu.
+ * Kiểm tra luôn: sau mỗi lần cập nhật từng phần, ảnh sprite phải giống hệt ảnh vẽ lại
+ * toàn bộ bằng font engine ở cùng vị trí ô.
+ *
+ *   make bench-readout
+ *
+ * Số đo trên máy host chỉ cho tỉ lệ giữa hai đường, không phải thời gian trên ESP32-C3.
+ */
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "DigitAtlas.h"
+
+extern "C" lv_font_t *get_montserrat_number_bold_48();
+
+static const uint32_t FG_HEX = 0xFFFFFF; // chữ trắng
+static const uint32_t BG_HEX = 0xFFDF00; // nền vàng của _distanceContainer
+static const int W = 240;
+
+static uint16_t rgb565(uint32_t hex)
+{
+	return (uint16_t)(((hex >> 8) & 0xF800) | ((hex >> 5) & 0x07E0) | ((hex >> 3) & 0x001F));
+}
+
+// lv_color_mix() của LVGL 8.3 với màu 16 bit (LV_COLOR_MIX_ROUND_OFS 0 như lv_conf.h)
+static inline uint16_t mix565(uint16_t c1, uint16_t c2, uint8_t mix)
+{
+	uint32_t r = (((c1 >> 11) * mix + (c2 >> 11) * (255 - mix)) * 0x8081U) >> 23;
+	uint32_t g = ((((c1 >> 5) & 0x3F) * mix + ((c2 >> 5) & 0x3F) * (255 - mix)) * 0x8081U) >> 23;
+	uint32_t b = (((c1 & 0x1F) * mix + (c2 & 0x1F) * (255 - mix)) * 0x8081U) >> 23;
+	return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+// Bảng độ đậm 4 bpp -> opa của lv_draw_sw_letter
+static const uint8_t OPA4[16] = {0, 17, 34, 51, 68, 85, 102, 119, 136, 153, 170, 187, 204, 221, 238, 255};
+
+struct Canvas
+{
+	int h;
+	std::vector<uint16_t> px;
+	Canvas(int height) : h(height), px((size_t)W * height) {}
+	void fill(int x1, int x2, uint16_t c)
+	{
+		for (int y = 0; y < h; y++)
+		{
+			for (int x = x1; x < x2 && x < W; x++)
+			{
+				px[(size_t)y * W + x] = c;
+			}
+		}
+	}
+};
+
+// Vẽ một glyph qua font engine: tra glyph, đọc bitmap 4 bpp liên tục, trộn từng pixel.
+// top: dòng của đỉnh glyph cao nhất trong canvas; [clipX1, clipX2) cột được phép vẽ.
+static int drawLetter(Canvas &c, const lv_font_t *font, char letter, int left, int top, int clipX1, int clipX2,
+					  uint16_t fg)
+{
+	lv_font_glyph_dsc_t g;
+	if (!lv_font_get_glyph_dsc(font, &g, (uint8_t)letter, 0))
+	{
+		return 0;
+	}
+	const uint8_t *bitmap = lv_font_get_glyph_bitmap(font, (uint8_t)letter);
+	int x0 = left + g.ofs_x;
+	int y0 = top - (g.ofs_y + g.box_h);
+	for (int gy = 0; gy < g.box_h; gy++)
+	{
+		for (int gx = 0; gx < g.box_w; gx++)
+		{
+			uint32_t n = (uint32_t)gy * g.box_w + gx;
+			uint8_t opa = OPA4[(n & 1) ? bitmap[n >> 1] & 0x0F : bitmap[n >> 1] >> 4];
+			int x = x0 + gx;
+			int y = y0 + gy;
+			if (opa == 0 || x < clipX1 || x >= clipX2 || x >= W || y < 0 || y >= c.h)
+			{
+				continue;
+			}
+			uint16_t &d = c.px[(size_t)y * W + x];
+			d = opa == 255 ? fg : mix565(fg, d, opa);
+		}
+	}
+	return g.adv_w;
+}
+
+static int textWidth(const lv_font_t *font, const char *text)
+{
+	int w = 0;
+	for (; *text; text++)
+	{
+		lv_font_glyph_dsc_t g;
+		if (lv_font_get_glyph_dsc(font, &g, (uint8_t)*text, 0))
+		{
+			w += g.adv_w;
+		}
+	}
+	return w;
+}
+
+// Chuỗi khoảng cách kiểu Google Maps khi đi hết quãng meters, cập nhật mỗi 10 m
+static std::vector<std::string> metricTrip(int meters)
+{
+	std::vector<std::string> out;
+	char buf[16];
+	for (int m = meters; m >= 0; m -= 10)
+	{
+		if (m >= 1000)
+		{
+			snprintf(buf, sizeof(buf), "%d,%d km", m / 1000, (m % 1000) / 100);
+		}
+		else
+		{
+			snprintf(buf, sizeof(buf), "%d m", m);
+		}
+		if (out.empty() || out.back() != buf)
+		{
+			out.push_back(buf);
+		}
+	}
+	return out;
+}
+
+static std::vector<std::string> imperialTrip(int feet)
+{
+	std::vector<std::string> out;
+	char buf[16];
+	for (int f = feet; f >= 0; f -= 50)
+	{
+		if (f >= 1000)
+		{
+			snprintf(buf, sizeof(buf), "%d.%d mi", f / 5280, (f % 5280) * 10 / 5280);
+		}
+		else
+		{
+			snprintf(buf, sizeof(buf), "%d ft", f);
+		}
+		if (out.empty() || out.back() != buf)
+		{
+			out.push_back(buf);
+		}
+	}
+	return out;
+}
+
+struct Result
+{
+	double nsPerUpdate;
+	double pxPerUpdate;
+};
+
+// Đường _distanceLabel: đo text hai lần (nhãn + container), vẽ lại cả nhãn
+static Result runLabel(const lv_font_t *font, const std::vector<std::string> &seq, int reps)
+{
+	Canvas c(font->line_height);
+	uint16_t fg = rgb565(FG_HEX);
+	uint16_t bg = rgb565(BG_HEX);
+	uint64_t px = 0;
+	volatile int sink = 0;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (int r = 0; r < reps; r++)
+	{
+		int shownWidth = 0;
+		for (size_t i = 0; i < seq.size(); i++)
+		{
+			const char *text = seq[i].c_str();
+			int width = textWidth(font, text);
+			sink += textWidth(font, text);
+			// Nhãn đổi độ rộng thì container co giãn: vùng cũ và mới đều bị vẽ lại
+			int area = width > shownWidth ? width : shownWidth;
+			shownWidth = width;
+			c.fill(0, area, bg);
+			px += (uint64_t)area * c.h;
+			int x = 0;
+			int top = font->line_height - font->base_line;
+			for (const char *p = text; *p; p++)
+			{
+				x += drawLetter(c, font, *p, x, top, 0, W, fg);
+			}
+		}
+	}
+	std::chrono::duration<double, std::nano> ns = std::chrono::steady_clock::now() - start;
+	Result res = {ns.count() / (reps * seq.size()), (double)px / (reps * seq.size())};
+	return res;
+}
+
+// Một lần cập nhật DistanceReadout: chỉ các khoảng ô đổi được vẽ lại từ atlas.
+// Trả về số pixel đã vẽ.
+static uint32_t spriteStep(const DigitAtlas &atlas, const DigitRow &shown, const DigitRow &next, Canvas &c,
+						   const uint16_t *lut)
+{
+	uint16_t bg = rgb565(BG_HEX);
+	uint16_t x1[DIGIT_ATLAS_MAX_CELLS];
+	uint16_t x2[DIGIT_ATLAS_MAX_CELLS];
+	uint32_t px = 0;
+	uint8_t spans = DigitAtlas::diff(shown, next, x1, x2);
+	for (uint8_t s = 0; s < spans; s++)
+	{
+		// Vùng invalid được LVGL vẽ nền container trước, rồi tới các ô trong vùng
+		c.fill(x1[s], x2[s], bg);
+		px += (uint32_t)(x2[s] - x1[s]) * c.h;
+		for (uint8_t k = 0; k < next.count; k++)
+		{
+			uint16_t cx1 = next.x[k];
+			uint16_t cx2 = cx1 + atlas.glyph(next.glyph[k]).width;
+			uint16_t a = cx1 > x1[s] ? cx1 : x1[s];
+			uint16_t b = cx2 < x2[s] ? cx2 : x2[s];
+			b = b < W ? b : W;
+			for (int y = 0; a < b && y < c.h; y++)
+			{
+				atlas.blitRow(&c.px[(size_t)y * W + a], next.glyph[k], a - cx1, y, b - a, lut);
+			}
+		}
+	}
+	return px;
+}
+
+static void makeLut(uint16_t *lut)
+{
+	for (int a = 0; a < 16; a++)
+	{
+		lut[a] = mix565(rgb565(FG_HEX), rgb565(BG_HEX), (uint8_t)(a * 17));
+	}
+}
+
+static Result runSprite(const DigitAtlas &atlas, const std::vector<std::string> &seq, int reps)
+{
+	Canvas c(atlas.height());
+	uint16_t lut[16];
+	makeLut(lut);
+	uint64_t px = 0;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (int r = 0; r < reps; r++)
+	{
+		DigitRow shown;
+		for (size_t i = 0; i < seq.size(); i++)
+		{
+			DigitRow next;
+			atlas.layout(seq[i].c_str(), next);
+			px += spriteStep(atlas, shown, next, c, lut);
+			shown = next;
+		}
+	}
+	std::chrono::duration<double, std::nano> ns = std::chrono::steady_clock::now() - start;
+	Result res = {ns.count() / (reps * seq.size()), (double)px / (reps * seq.size())};
+	return res;
+}
+
+// Ảnh tham chiếu: vẽ lại toàn bộ dòng bằng font engine ở đúng vị trí ô của atlas
+static void renderReference(const lv_font_t *font, const DigitAtlas &atlas, const char *text, int top, Canvas &c)
+{
+	DigitRow row;
+	atlas.layout(text, row);
+	c.fill(0, W, rgb565(BG_HEX));
+	for (uint8_t k = 0; k < row.count; k++)
+	{
+		lv_font_glyph_dsc_t g;
+		lv_font_get_glyph_dsc(font, &g, (uint8_t)DIGIT_ATLAS_CHARS[row.glyph[k]], 0);
+		int cellW = atlas.glyph(row.glyph[k]).width;
+		drawLetter(c, font, DIGIT_ATLAS_CHARS[row.glyph[k]], row.x[k] + (cellW - g.adv_w) / 2, top, row.x[k],
+				   row.x[k] + cellW, rgb565(FG_HEX));
+	}
+}
+
+// Chạy từng bước của seq, so ảnh cập nhật từng phần với ảnh tham chiếu
+static long verify(const lv_font_t *font, const DigitAtlas &atlas, const std::vector<std::string> &seq)
+{
+	// Đỉnh của atlas: glyph cao nhất trong DIGIT_ATLAS_CHARS
+	int top = 0;
+	for (const char *p = DIGIT_ATLAS_CHARS; *p; p++)
+	{
+		lv_font_glyph_dsc_t g;
+		lv_font_get_glyph_dsc(font, &g, (uint8_t)*p, 0);
+		top = g.box_h > 0 && g.ofs_y + g.box_h > top ? g.ofs_y + g.box_h : top;
+	}
+	Canvas incremental(atlas.height());
+	Canvas reference(atlas.height());
+	incremental.fill(0, W, rgb565(BG_HEX));
+	uint16_t lut[16];
+	makeLut(lut);
+	long mismatches = 0;
+	DigitRow shown;
+	for (size_t i = 0; i < seq.size(); i++)
+	{
+		DigitRow next;
+		atlas.layout(seq[i].c_str(), next);
+		spriteStep(atlas, shown, next, incremental, lut);
+		shown = next;
+		renderReference(font, atlas, seq[i].c_str(), top, reference);
+		for (size_t p = 0; p < reference.px.size(); p++)
+		{
+			mismatches += incremental.px[p] != reference.px[p];
+		}
+	}
+	return mismatches;
+}
+
+int main(int argc, char **argv)
+{
+	int reps = argc > 1 ? atoi(argv[1]) : 200;
+	const lv_font_t *font = get_montserrat_number_bold_48();
+
+	DigitAtlas atlas;
+	if (!atlas.build(font))
+	{
+		fprintf(stderr, "atlas build failed\n");
+		return 1;
+	}
+	printf("atlas: %ux%u px, %zu bytes (4 bpp), digit cell %u px\n", atlas.width(), atlas.height(), atlas.bytes(),
+		   atlas.glyph(0).width);
+
+	const char *samples[] = {"10,5 km", "999 m", "1,200 ft", "12.4 mi"};
+	for (size_t i = 0; i < sizeof(samples) / sizeof(samples[0]); i++)
+	{
+		DigitRow row;
+		atlas.layout(samples[i], row);
+		printf("  %-9s sprite %3u px, label %3d px\n", samples[i], row.width, textWidth(font, samples[i]));
+	}
+
+	struct Trip
+	{
+		const char *name;
+		std::vector<std::string> seq;
+	} trips[] = {{"metric 15 km", metricTrip(15000)}, {"imperial 3 mi", imperialTrip(3 * 5280)}};
+
+	long mismatches = 0;
+	for (size_t t = 0; t < sizeof(trips) / sizeof(trips[0]); t++)
+	{
+		const std::vector<std::string> &seq = trips[t].seq;
+		Result label = runLabel(font, seq, reps);
+		Result sprite = runSprite(atlas, seq, reps);
+		long bad = verify(font, atlas, seq);
+		mismatches += bad;
+		printf("%s: %zu updates\n", trips[t].name, seq.size());
+		printf("  label : %8.0f ns/update, %6.0f px redrawn\n", label.nsPerUpdate, label.pxPerUpdate);
+		printf("  sprite: %8.0f ns/update, %6.0f px redrawn (%.1fx faster), %ld mismatches\n", sprite.nsPerUpdate,
+			   sprite.pxPerUpdate, label.nsPerUpdate / sprite.nsPerUpdate, bad);
+	}
+	return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,72 @@
+// Arduino tối thiểu để biên dịch LVGL_Display trên Linux (tools/display_sim).
+// Thời gian là đồng hồ ảo tính bằng ns: mock bus và mock LVGL tự tăng nó.
+#ifndef DISPLAY_SIM_ARDUINO_H
+#define DISPLAY_SIM_ARDUINO_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define HIGH 1
+#define LOW 0
+#define OUTPUT 1
+#define MALLOC_CAP_INTERNAL (1 << 0)
+#define MALLOC_CAP_8BIT (1 << 1)
+#define MALLOC_CAP_DMA (1 << 2)
+
+extern uint64_t simNowNs;
+
+inline void simAdvance(uint64_t ns) { simNowNs += ns; }
+inline unsigned long millis() { return (unsigned long)(simNowNs / 1000000ULL); }
+inline unsigned long micros() { return (unsigned long)(simNowNs / 1000ULL); }
+inline void delay(unsigned long ms) { simAdvance(ms * 1000000ULL); }
+inline void pinMode(int, int) {}
+inline void digitalWrite(int, int) {}
+// Heap ảo: display_sim đặt simHeapFree theo SRAM còn trống của bản build cần mô phỏng
+extern uint32_t simHeapFree;
+
+inline void *heap_caps_malloc(size_t size, uint32_t)
+{
+	if (size + sizeof(size_t) > simHeapFree)
+	{
+		return nullptr;
+	}
+	size_t *p = (size_t *)malloc(size + sizeof(size_t));
+	*p = size;
+	simHeapFree -= size + sizeof(size_t);
+	return p + 1;
+}
+
+inline void heap_caps_free(void *ptr)
+{
+	if (ptr == nullptr)
+	{
+		return;
+	}
+	size_t *p = (size_t *)ptr - 1;
+	simHeapFree += *p + sizeof(size_t);
+	free(p);
+}
+
+struct EspClass
+{
+	uint32_t getFreeHeap() { return simHeapFree; }
+};
+
+extern EspClass ESP;
+
+class Print
+{
+public:
+	bool enabled = false;
+
+	template <typename... A>
+	void printf(const char *f, A... a) { if (enabled) ::printf(f, a...); }
+	void print(const char *x) { if (enabled) fputs(x, stdout); }
+	void println(const char *x = "") { if (enabled) puts(x); }
+};
+
+extern Print Serial;
+
+#endif // DISPLAY_SIM_ARDUINO_H
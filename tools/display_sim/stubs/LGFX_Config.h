@@ -0,0 +1,150 @@
+// Mock LovyanGFX cho tools/display_sim: không vẽ gì, chỉ tính thời gian SPI.
+//
+// Lệnh đồng bộ (writePixels, setAddrWindow) làm CPU chờ hết thời gian truyền.
+// pushImageDMA trả về ngay, bus bận tới simNowNs + thời gian truyền; mọi lệnh
+// kế tiếp chờ DMA trước như Bus_SPI thật. Checksum buffer lúc bắt đầu và lúc
+// xong DMA phải khớp, nếu không nghĩa là LVGL đã vẽ vào buffer đang truyền.
+#ifndef LGFX_CONFIG_H
+#define LGFX_CONFIG_H
+
+#include <Arduino.h>
+
+namespace lgfx
+{
+	struct swap565_t
+	{
+		uint16_t raw;
+	};
+}
+
+struct MockBusStats
+{
+	uint32_t transfers;	  // số lần ghi pixel (đồng bộ + DMA)
+	uint64_t bytes;		  // byte pixel đã gửi
+	uint64_t busyNs;	  // tổng thời gian bus bận
+	uint64_t cpuWaitNs;	  // thời gian CPU đứng chờ bus
+	uint32_t corruptions; // buffer bị sửa trong lúc DMA đang đọc
+};
+
+class LGFX
+{
+public:
+	// Thông số bus, chỉnh được từ display_sim
+	static uint32_t spiHz;
+	static uint32_t commandNs; // CASET/RASET/RAMWR cho mỗi cửa sổ
+
+	void init() {}
+	void setRotation(int) {}
+	void setBrightness(int) {}
+	int width() const { return 240; }
+	int height() const { return 240; }
+
+	void startWrite() { _startCount++; }
+	void endWrite()
+	{
+		if (_startCount > 0 && --_startCount == 0)
+		{
+			waitDMA(); // Bus_SPI kết thúc transaction sau khi DMA xong
+		}
+	}
+	int getStartCount() const { return _startCount; }
+
+	void setAddrWindow(int32_t, int32_t, int32_t, int32_t)
+	{
+		waitDMA();
+		cpuBusy(commandNs);
+	}
+
+	void writePixels(const uint16_t *, int32_t len, bool = true)
+	{
+		waitDMA();
+		uint64_t ns = transferNs(len * 2);
+		cpuBusy(ns);
+		_stats.cpuWaitNs += ns;
+		count(len * 2, ns);
+	}
+
+	template <typename T>
+	void pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, const T *data)
+	{
+		startWrite();
+		setAddrWindow(x, y, w, h);
+		uint32_t bytes = (uint32_t)(w * h) * 2;
+		_dmaData = (const uint8_t *)data;
+		_dmaBytes = bytes;
+		_dmaChecksum = checksum(_dmaData, bytes);
+		uint64_t ns = transferNs(bytes);
+		_busyUntil = simNowNs + ns;
+		count(bytes, ns);
+		_startCount--; // không chờ DMA như endWrite thật khi transaction còn mở
+	}
+
+	// Mỗi lần hỏi tốn một chút thời gian CPU (vòng chờ của wait_cb)
+	bool dmaBusy()
+	{
+		if (simNowNs < _busyUntil)
+		{
+			cpuBusy(500);
+			_stats.cpuWaitNs += 500;
+			return true;
+		}
+		complete();
+		return false;
+	}
+
+	void waitDMA()
+	{
+		if (simNowNs < _busyUntil)
+		{
+			_stats.cpuWaitNs += _busyUntil - simNowNs;
+			simNowNs = _busyUntil;
+		}
+		complete();
+	}
+
+	const MockBusStats &stats() const { return _stats; }
+	void resetStats() { memset(&_stats, 0, sizeof(_stats)); }
+
+private:
+	int _startCount = 0;
+	uint64_t _busyUntil = 0;
+	const uint8_t *_dmaData = nullptr;
+	uint32_t _dmaBytes = 0;
+	uint32_t _dmaChecksum = 0;
+	MockBusStats _stats = {};
+
+	static uint64_t transferNs(uint64_t bytes) { return bytes * 8ULL * 1000000000ULL / spiHz; }
+
+	void cpuBusy(uint64_t ns) { simAdvance(ns); }
+
+	void count(uint32_t bytes, uint64_t ns)
+	{
+		_stats.transfers++;
+		_stats.bytes += bytes;
+		_stats.busyNs += ns;
+	}
+
+	static uint32_t checksum(const uint8_t *p, uint32_t n)
+	{
+		uint32_t h = 2166136261u;
+		for (uint32_t i = 0; i < n; i++)
+		{
+			h = (h ^ p[i]) * 16777619u;
+		}
+		return h;
+	}
+
+	void complete()
+	{
+		if (_dmaData != nullptr)
+		{
+			if (checksum(_dmaData, _dmaBytes) != _dmaChecksum)
+			{
+				_stats.corruptions++;
+			}
+			_dmaData = nullptr;
+		}
+	}
+};
+
+#endif // LGFX_CONFIG_H
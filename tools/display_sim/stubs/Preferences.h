@@ -0,0 +1,45 @@
+// Preferences (NVS) trong RAM cho tools/display_sim
+#ifndef DISPLAY_SIM_PREFERENCES_H
+#define DISPLAY_SIM_PREFERENCES_H
+
+#include <map>
+#include <string>
+
+class Preferences
+{
+public:
+	bool begin(const char *name, bool = false)
+	{
+		_ns = name;
+		return true;
+	}
+	void end() {}
+
+	uint8_t getUChar(const char *key, uint8_t fallback = 0) { return (uint8_t)get(key, fallback); }
+	uint64_t getULong64(const char *key, uint64_t fallback = 0) { return get(key, fallback); }
+	size_t putUChar(const char *key, uint8_t v) { return put(key, v, 1); }
+	size_t putULong64(const char *key, uint64_t v) { return put(key, v, 8); }
+
+private:
+	std::string _ns;
+
+	static std::map<std::string, uint64_t> &store()
+	{
+		static std::map<std::string, uint64_t> s;
+		return s;
+	}
+
+	uint64_t get(const char *key, uint64_t fallback)
+	{
+		std::map<std::string, uint64_t>::iterator it = store().find(_ns + "/" + key);
+		return it != store().end() ? it->second : fallback;
+	}
+
+	size_t put(const char *key, uint64_t v, size_t size)
+	{
+		store()[_ns + "/" + key] = v;
+		return size;
+	}
+};
+
+#endif // DISPLAY_SIM_PREFERENCES_H
@@ -0,0 +1,18 @@
+// esp_ota_ops.h tối thiểu cho tools/display_sim
+#ifndef DISPLAY_SIM_ESP_OTA_OPS_H
+#define DISPLAY_SIM_ESP_OTA_OPS_H
+
+#include <stdint.h>
+
+typedef struct
+{
+	uint8_t app_elf_sha256[32];
+} esp_app_desc_t;
+
+inline const esp_app_desc_t *esp_ota_get_app_description()
+{
+	static const esp_app_desc_t desc = {{0x5A, 0x1E, 0x2D, 0x3C, 0x4B, 0x5A, 0x69, 0x78}};
+	return &desc;
+}
+
+#endif // DISPLAY_SIM_ESP_OTA_OPS_H
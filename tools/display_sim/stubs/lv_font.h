@@ -0,0 +1,123 @@
+// Mock phần font của LVGL 8.3 (lv_font.h, lv_font_fmt_txt.h) cho tools/display_sim.
+//
+// Đủ để biên dịch nguyên file font trong include/fonts/ (bằng C, xem Makefile) và
+// đọc glyph qua lv_font_get_glyph_dsc()/lv_font_get_glyph_bitmap() như trên máy.
+// Chỉ hỗ trợ bitmap không nén và cmap FORMAT0_TINY/SPARSE_TINY, không kerning.
+#ifndef DISPLAY_SIM_LV_FONT_H
+#define DISPLAY_SIM_LV_FONT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LVGL_VERSION_MAJOR 8
+#define LVGL_VERSION_MINOR 3
+#define LVGL_VERSION_PATCH 9
+#define LV_VERSION_CHECK(x, y, z) \
+	(x == LVGL_VERSION_MAJOR && (y < LVGL_VERSION_MINOR || (y == LVGL_VERSION_MINOR && z <= LVGL_VERSION_PATCH)))
+
+#define LV_ATTRIBUTE_LARGE_CONST
+#define LV_FONT_SUBPX_NONE 0
+#define LV_USE_FONT_COMPRESSED 1
+
+typedef int16_t lv_coord_t;
+
+struct _lv_font_t;
+
+typedef struct
+{
+	const struct _lv_font_t *resolved_font;
+	uint16_t adv_w; // px
+	uint16_t box_w;
+	uint16_t box_h;
+	int16_t ofs_x;
+	int16_t ofs_y;
+	uint8_t bpp;
+} lv_font_glyph_dsc_t;
+
+typedef struct _lv_font_t
+{
+	bool (*get_glyph_dsc)(const struct _lv_font_t *, lv_font_glyph_dsc_t *, uint32_t letter, uint32_t letter_next);
+	const uint8_t *(*get_glyph_bitmap)(const struct _lv_font_t *, uint32_t);
+	lv_coord_t line_height;
+	lv_coord_t base_line;
+	uint8_t subpx : 2;
+	int8_t underline_position;
+	int8_t underline_thickness;
+	const void *dsc;
+	const struct _lv_font_t *fallback;
+	void *user_data;
+} lv_font_t;
+
+typedef struct
+{
+	uint32_t bitmap_index : 20;
+	uint32_t adv_w : 12; // 1/16 px
+	uint8_t box_w;
+	uint8_t box_h;
+	int8_t ofs_x;
+	int8_t ofs_y;
+} lv_font_fmt_txt_glyph_dsc_t;
+
+typedef enum
+{
+	LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL,
+	LV_FONT_FMT_TXT_CMAP_SPARSE_FULL,
+	LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY,
+	LV_FONT_FMT_TXT_CMAP_SPARSE_TINY,
+} lv_font_fmt_txt_cmap_type_t;
+
+typedef struct
+{
+	uint32_t range_start;
+	uint16_t range_length;
+	uint16_t glyph_id_start;
+	const uint16_t *unicode_list;
+	const void *glyph_id_ofs_list;
+	uint16_t list_length;
+	lv_font_fmt_txt_cmap_type_t type;
+} lv_font_fmt_txt_cmap_t;
+
+typedef struct
+{
+	uint32_t last_letter;
+	uint32_t last_glyph_id;
+} lv_font_fmt_txt_glyph_cache_t;
+
+enum
+{
+	LV_FONT_FMT_TXT_PLAIN = 0,
+	LV_FONT_FMT_TXT_COMPRESSED = 1,
+	LV_FONT_FMT_TXT_COMPRESSED_NO_PREFILTER = 1,
+};
+
+typedef struct
+{
+	const uint8_t *glyph_bitmap;
+	const lv_font_fmt_txt_glyph_dsc_t *glyph_dsc;
+	const lv_font_fmt_txt_cmap_t *cmaps;
+	const void *kern_dsc;
+	uint16_t kern_scale;
+	uint16_t cmap_num : 9;
+	uint16_t bpp : 4;
+	uint16_t kern_classes : 1;
+	uint16_t bitmap_format : 2;
+	lv_font_fmt_txt_glyph_cache_t *cache;
+} lv_font_fmt_txt_dsc_t;
+
+bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t *font, lv_font_glyph_dsc_t *dsc_out, uint32_t unicode_letter,
+								   uint32_t unicode_letter_next);
+const uint8_t *lv_font_get_bitmap_fmt_txt(const lv_font_t *font, uint32_t unicode_letter);
+
+bool lv_font_get_glyph_dsc(const lv_font_t *font, lv_font_glyph_dsc_t *dsc_out, uint32_t letter, uint32_t letter_next);
+const uint8_t *lv_font_get_glyph_bitmap(const lv_font_t *font, uint32_t letter);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DISPLAY_SIM_LV_FONT_H
@@ -0,0 +1,265 @@
+// Tra glyph của font định dạng lv_font_fmt_txt như LVGL 8.3 (lv_font_fmt_txt.c),
+// bản rút gọn: cmap *_TINY, bitmap 4 bpp không nén hoặc nén RLE + prefilter
+// (LV_USE_FONT_COMPRESSED), có cache glyph cuối như trên máy.
+#include <stdlib.h>
+
+#include "lv_font.h"
+
+/* Giải nén: chép rle_next/decompress của LVGL 8.3, chỉ giữ nhánh 4 bpp */
+enum
+{
+	RLE_STATE_SINGLE = 0,
+	RLE_STATE_REPEATE,
+	RLE_STATE_COUNTER,
+};
+
+static uint32_t rle_rdp;
+static const uint8_t *rle_in;
+static uint8_t rle_bpp;
+static uint8_t rle_prev_v;
+static uint8_t rle_cnt;
+static int rle_state;
+
+static inline uint8_t get_bits(const uint8_t *in, uint32_t bit_pos, uint8_t len)
+{
+	uint8_t bit_mask = (uint8_t)((1 << len) - 1);
+	uint32_t byte_pos = bit_pos >> 3;
+	bit_pos = bit_pos & 0x7;
+	if (bit_pos + len >= 8)
+	{
+		uint16_t in16 = (uint16_t)((in[byte_pos] << 8) + in[byte_pos + 1]);
+		return (uint8_t)((in16 >> (16 - bit_pos - len)) & bit_mask);
+	}
+	return (uint8_t)((in[byte_pos] >> (8 - bit_pos - len)) & bit_mask);
+}
+
+static inline uint8_t rle_next(void)
+{
+	uint8_t ret = 0;
+	if (rle_state == RLE_STATE_SINGLE)
+	{
+		ret = get_bits(rle_in, rle_rdp, rle_bpp);
+		if (rle_rdp != 0 && rle_prev_v == ret)
+		{
+			rle_cnt = 0;
+			rle_state = RLE_STATE_REPEATE;
+		}
+		rle_prev_v = ret;
+		rle_rdp += rle_bpp;
+	}
+	else if (rle_state == RLE_STATE_REPEATE)
+	{
+		uint8_t v = get_bits(rle_in, rle_rdp, 1);
+		rle_cnt++;
+		rle_rdp += 1;
+		if (v == 1)
+		{
+			ret = rle_prev_v;
+			if (rle_cnt == 11)
+			{
+				rle_cnt = get_bits(rle_in, rle_rdp, 6);
+				rle_rdp += 6;
+				if (rle_cnt != 0)
+				{
+					rle_state = RLE_STATE_COUNTER;
+				}
+				else
+				{
+					ret = get_bits(rle_in, rle_rdp, rle_bpp);
+					rle_prev_v = ret;
+					rle_rdp += rle_bpp;
+					rle_state = RLE_STATE_SINGLE;
+				}
+			}
+		}
+		else
+		{
+			ret = get_bits(rle_in, rle_rdp, rle_bpp);
+			rle_prev_v = ret;
+			rle_rdp += rle_bpp;
+			rle_state = RLE_STATE_SINGLE;
+		}
+	}
+	else
+	{
+		ret = rle_prev_v;
+		rle_cnt--;
+		if (rle_cnt == 0)
+		{
+			ret = get_bits(rle_in, rle_rdp, rle_bpp);
+			rle_prev_v = ret;
+			rle_rdp += rle_bpp;
+			rle_state = RLE_STATE_SINGLE;
+		}
+	}
+	return ret;
+}
+
+static inline void bits_write(uint8_t *out, uint32_t bit_pos, uint8_t val, uint8_t len)
+{
+	uint32_t byte_pos = bit_pos >> 3;
+	bit_pos = bit_pos & 0x7;
+	bit_pos = 8 - bit_pos - len;
+	uint8_t bit_mask = (uint8_t)((1 << len) - 1);
+	out[byte_pos] &= (uint8_t)((~bit_mask) << bit_pos);
+	out[byte_pos] |= (uint8_t)(val << bit_pos);
+}
+
+static void decompress(const uint8_t *in, uint8_t *out, int w, int h, uint8_t bpp, bool prefilter)
+{
+	static uint8_t line_buf1[256];
+	static uint8_t line_buf2[256];
+	uint32_t wrp = 0;
+	rle_in = in;
+	rle_bpp = bpp;
+	rle_state = RLE_STATE_SINGLE;
+	rle_rdp = 0;
+	rle_prev_v = 0;
+	rle_cnt = 0;
+
+	for (int x = 0; x < w; x++)
+	{
+		line_buf1[x] = rle_next();
+		bits_write(out, wrp, line_buf1[x], bpp);
+		wrp += bpp;
+	}
+	for (int y = 1; y < h; y++)
+	{
+		for (int x = 0; x < w; x++)
+		{
+			line_buf2[x] = rle_next();
+			line_buf1[x] = prefilter ? (uint8_t)(line_buf2[x] ^ line_buf1[x]) : line_buf2[x];
+			bits_write(out, wrp, line_buf1[x], bpp);
+			wrp += bpp;
+		}
+	}
+}
+
+static uint32_t get_glyph_dsc_id(const lv_font_t *font, uint32_t letter)
+{
+	const lv_font_fmt_txt_dsc_t *fdsc = (const lv_font_fmt_txt_dsc_t *)font->dsc;
+	if (letter == '\0')
+	{
+		return 0;
+	}
+	if (fdsc->cache && fdsc->cache->last_letter == letter)
+	{
+		return fdsc->cache->last_glyph_id;
+	}
+
+	uint32_t glyph_id = 0;
+	for (uint16_t i = 0; i < fdsc->cmap_num; i++)
+	{
+		const lv_font_fmt_txt_cmap_t *cmap = &fdsc->cmaps[i];
+		uint32_t rcp = letter - cmap->range_start;
+		if (letter < cmap->range_start || rcp >= cmap->range_length)
+		{
+			continue;
+		}
+		if (cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY)
+		{
+			glyph_id = cmap->glyph_id_start + rcp;
+		}
+		else if (cmap->type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY)
+		{
+			// Danh sách đã sắp xếp: tìm nhị phân như _lv_utils_bsearch
+			uint16_t lo = 0;
+			uint16_t hi = cmap->list_length;
+			while (lo < hi)
+			{
+				uint16_t mid = (uint16_t)((lo + hi) / 2);
+				if (cmap->unicode_list[mid] < rcp)
+				{
+					lo = (uint16_t)(mid + 1);
+				}
+				else
+				{
+					hi = mid;
+				}
+			}
+			if (lo < cmap->list_length && cmap->unicode_list[lo] == rcp)
+			{
+				glyph_id = cmap->glyph_id_start + lo;
+			}
+		}
+		if (glyph_id != 0)
+		{
+			break;
+		}
+	}
+
+	if (fdsc->cache)
+	{
+		fdsc->cache->last_letter = letter;
+		fdsc->cache->last_glyph_id = glyph_id;
+	}
+	return glyph_id;
+}
+
+bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t *font, lv_font_glyph_dsc_t *dsc_out, uint32_t unicode_letter,
+								   uint32_t unicode_letter_next)
+{
+	(void)unicode_letter_next;
+	const lv_font_fmt_txt_dsc_t *fdsc = (const lv_font_fmt_txt_dsc_t *)font->dsc;
+	uint32_t gid = get_glyph_dsc_id(font, unicode_letter);
+	if (gid == 0)
+	{
+		return false;
+	}
+	const lv_font_fmt_txt_glyph_dsc_t *gdsc = &fdsc->glyph_dsc[gid];
+	dsc_out->resolved_font = font;
+	dsc_out->adv_w = (uint16_t)((gdsc->adv_w + (1 << 3)) >> 4);
+	dsc_out->box_w = gdsc->box_w;
+	dsc_out->box_h = gdsc->box_h;
+	dsc_out->ofs_x = gdsc->ofs_x;
+	dsc_out->ofs_y = gdsc->ofs_y;
+	dsc_out->bpp = (uint8_t)fdsc->bpp;
+	return true;
+}
+
+const uint8_t *lv_font_get_bitmap_fmt_txt(const lv_font_t *font, uint32_t unicode_letter)
+{
+	const lv_font_fmt_txt_dsc_t *fdsc = (const lv_font_fmt_txt_dsc_t *)font->dsc;
+	uint32_t gid = get_glyph_dsc_id(font, unicode_letter);
+	if (gid == 0)
+	{
+		return NULL;
+	}
+	const lv_font_fmt_txt_glyph_dsc_t *gdsc = &fdsc->glyph_dsc[gid];
+	if (fdsc->bitmap_format == LV_FONT_FMT_TXT_PLAIN)
+	{
+		return &fdsc->glyph_bitmap[gdsc->bitmap_index];
+	}
+
+	// Như _lv_font_decompr_buf: một buffer dùng chung, nới ra khi gặp glyph lớn hơn
+	static uint8_t *decompr_buf = NULL;
+	static size_t last_buf_size = 0;
+	size_t buf_size = ((size_t)gdsc->box_w * gdsc->box_h + 1) >> 1;
+	if (buf_size == 0 || fdsc->bpp != 4 || gdsc->box_w > 256)
+	{
+		return NULL;
+	}
+	if (last_buf_size < buf_size)
+	{
+		uint8_t *tmp = (uint8_t *)realloc(decompr_buf, buf_size);
+		if (tmp == NULL)
+		{
+			return NULL;
+		}
+		decompr_buf = tmp;
+		last_buf_size = buf_size;
+	}
+	decompress(&fdsc->glyph_bitmap[gdsc->bitmap_index], decompr_buf, gdsc->box_w, gdsc->box_h, (uint8_t)fdsc->bpp,
+			   fdsc->bitmap_format == LV_FONT_FMT_TXT_COMPRESSED);
+	return decompr_buf;
+}
+
+bool lv_font_get_glyph_dsc(const lv_font_t *font, lv_font_glyph_dsc_t *dsc_out, uint32_t letter, uint32_t letter_next)
+{
+	return font->get_glyph_dsc(font, dsc_out, letter, letter_next);
+}
+
+const uint8_t *lv_font_get_glyph_bitmap(const lv_font_t *font, uint32_t letter)
+{
+	return font->get_glyph_bitmap(font, letter);
+}
@@ -0,0 +1,271 @@
+// Mock LVGL 8.3 cho tools/display_sim: chỉ phần hiển thị mà LVGL_Display dùng.
+//
+// Việc vẽ các vùng invalid tốn renderNsPerPixel thời gian ảo mỗi pixel và flush
+// theo đúng giao ước của lv_refr.c:
+//  - chế độ dải: vùng được chia theo kích thước buffer; với một buffer thì chờ
+//    flush trước xong rồi mới vẽ đè, với hai buffer thì chờ trong draw_buf_flush
+//    (gọi wait_cb) trước khi flush buffer kia, sau đó đổi buffer;
+//  - direct mode: vẽ vào đúng tọa độ trong buffer toàn màn hình, flush một lần
+//    với vùng toàn màn hình, inv_areas vẫn còn hợp lệ trong flush_cb.
+#ifndef DISPLAY_SIM_LVGL_H
+#define DISPLAY_SIM_LVGL_H
+
+#include <Arduino.h>
+#include "lv_font.h"
+
+#define LV_INV_BUF_SIZE 32
+
+// Như include/lv_conf.h; make SWAP=0 để thử đường flush tự đổi byte
+#ifndef LV_COLOR_16_SWAP
+#define LV_COLOR_16_SWAP 1
+#endif
+
+typedef union
+{
+	uint16_t full;
+} lv_color_t;
+
+typedef struct
+{
+	lv_coord_t x1;
+	lv_coord_t y1;
+	lv_coord_t x2;
+	lv_coord_t y2;
+} lv_area_t;
+
+typedef struct
+{
+	void *buf1;
+	void *buf2;
+	void *buf_act;
+	uint32_t size; // số pixel
+	volatile int flushing;
+	volatile int flushing_last;
+} lv_disp_draw_buf_t;
+
+typedef struct _lv_disp_drv_t
+{
+	lv_coord_t hor_res;
+	lv_coord_t ver_res;
+	lv_disp_draw_buf_t *draw_buf;
+	uint32_t direct_mode : 1;
+	void (*flush_cb)(struct _lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p);
+	void (*wait_cb)(struct _lv_disp_drv_t *disp_drv);
+	void (*monitor_cb)(struct _lv_disp_drv_t *disp_drv, uint32_t time, uint32_t px);
+	void *user_data;
+} lv_disp_drv_t;
+
+typedef struct
+{
+	lv_disp_drv_t *driver;
+	lv_area_t inv_areas[LV_INV_BUF_SIZE];
+	uint8_t inv_area_joined[LV_INV_BUF_SIZE];
+	uint16_t inv_p;
+} lv_disp_t;
+
+typedef struct
+{
+	int unused;
+} lv_obj_t;
+
+// Trạng thái của mock, display_sim đọc/ghi trực tiếp
+struct SimLvgl
+{
+	lv_disp_t disp = {};
+	lv_obj_t screen = {};
+	uint32_t renderNsPerPixel = 250;
+	uint32_t frame = 0;
+	uint64_t renderNs = 0;	   // tổng thời gian CPU vẽ
+	uint32_t flushes = 0;	   // số lần gọi flush_cb
+	uint32_t timerRuns = 0;	   // số lần lv_timer_handler() chạy
+	uint16_t animations = 0;   // số animation đang chạy (lv_anim_count_running)
+	uint32_t staleBuffer = 0;  // direct mode: pixel trong buffer khác với những gì đã vẽ
+	uint16_t shadow[240 * 240]; // direct mode: nội dung buffer đúng ra phải có
+	const void *shadowBuf = nullptr; // buffer mà shadow đang phản ánh
+};
+
+extern SimLvgl simLvgl;
+
+inline void lv_init() {}
+inline void lv_tick_inc(uint32_t) {}
+
+inline void lv_disp_draw_buf_init(lv_disp_draw_buf_t *draw_buf, void *buf1, void *buf2, uint32_t size)
+{
+	memset(draw_buf, 0, sizeof(*draw_buf));
+	draw_buf->buf1 = buf1;
+	draw_buf->buf2 = buf2;
+	draw_buf->buf_act = buf1;
+	draw_buf->size = size;
+}
+
+inline void lv_disp_drv_init(lv_disp_drv_t *driver) { memset(driver, 0, sizeof(*driver)); }
+
+inline lv_disp_t *lv_disp_drv_register(lv_disp_drv_t *driver)
+{
+	simLvgl.disp.driver = driver;
+	return &simLvgl.disp;
+}
+
+inline void lv_disp_flush_ready(lv_disp_drv_t *driver)
+{
+	driver->draw_buf->flushing = 0;
+	driver->draw_buf->flushing_last = 0;
+}
+
+inline bool lv_disp_flush_is_last(lv_disp_drv_t *driver) { return driver->draw_buf->flushing_last; }
+
+inline lv_obj_t *lv_scr_act() { return &simLvgl.screen; }
+inline void lv_scr_load(lv_obj_t *) {}
+
+// Vùng invalid được gộp thành một hình chữ nhật bao (LVGL thật gộp các vùng chồng nhau)
+inline void lv_inv_area(lv_disp_t *disp, const lv_area_t *area)
+{
+	if (disp->inv_p == 0)
+	{
+		disp->inv_areas[0] = *area;
+		disp->inv_area_joined[0] = 0;
+		disp->inv_p = 1;
+		return;
+	}
+	lv_area_t &a = disp->inv_areas[0];
+	a.x1 = area->x1 < a.x1 ? area->x1 : a.x1;
+	a.y1 = area->y1 < a.y1 ? area->y1 : a.y1;
+	a.x2 = area->x2 > a.x2 ? area->x2 : a.x2;
+	a.y2 = area->y2 > a.y2 ? area->y2 : a.y2;
+}
+
+inline void lv_obj_invalidate(lv_obj_t *)
+{
+	lv_disp_drv_t *drv = simLvgl.disp.driver;
+	lv_area_t full = {0, 0, (lv_coord_t)(drv->hor_res - 1), (lv_coord_t)(drv->ver_res - 1)};
+	lv_inv_area(&simLvgl.disp, &full);
+}
+
+// Đổi buffer lúc chạy: LVGL vẽ lại toàn màn hình
+inline void lv_disp_drv_update(lv_disp_t *disp, lv_disp_drv_t *new_drv)
+{
+	disp->driver = new_drv;
+	simLvgl.shadowBuf = nullptr;
+	lv_obj_invalidate(&simLvgl.screen);
+}
+
+inline void simWaitFlushing(lv_disp_drv_t *drv)
+{
+	while (drv->draw_buf->flushing)
+	{
+		if (drv->wait_cb)
+		{
+			drv->wait_cb(drv);
+		}
+	}
+}
+
+inline void simDrawBufFlush(lv_disp_drv_t *drv, const lv_area_t &area, bool last)
+{
+	lv_disp_draw_buf_t *draw_buf = drv->draw_buf;
+	if (draw_buf->buf1 && draw_buf->buf2)
+	{
+		simWaitFlushing(drv);
+	}
+	draw_buf->flushing = 1;
+	draw_buf->flushing_last = last ? 1 : 0;
+	simLvgl.flushes++;
+	drv->flush_cb(drv, &area, (lv_color_t *)draw_buf->buf_act);
+	if (draw_buf->buf1 && draw_buf->buf2)
+	{
+		draw_buf->buf_act = draw_buf->buf_act == draw_buf->buf1 ? draw_buf->buf2 : draw_buf->buf1;
+	}
+}
+
+inline void simRender(uint16_t *px, uint32_t pixels, lv_coord_t y)
+{
+	for (uint32_t i = 0; i < pixels; i++)
+	{
+		px[i] = (uint16_t)(simLvgl.frame * 31 + y + i);
+	}
+	uint64_t ns = (uint64_t)pixels * simLvgl.renderNsPerPixel;
+	simAdvance(ns);
+	simLvgl.renderNs += ns;
+}
+
+inline void simMonitor(lv_disp_drv_t *drv, uint64_t startNs, uint32_t px)
+{
+	if (drv->monitor_cb)
+	{
+		drv->monitor_cb(drv, (uint32_t)((simNowNs - startNs) / 1000000ULL), px);
+	}
+}
+
+inline void lv_refr_now(lv_disp_t *disp)
+{
+	lv_disp_drv_t *drv = disp->driver;
+	if (drv == nullptr || disp->inv_p == 0)
+	{
+		return;
+	}
+	simLvgl.frame++;
+
+	lv_disp_draw_buf_t *draw_buf = drv->draw_buf;
+	lv_area_t area = disp->inv_areas[0];
+	lv_coord_t w = area.x2 - area.x1 + 1;
+	uint32_t px = (uint32_t)w * (area.y2 - area.y1 + 1);
+	uint64_t start = simNowNs;
+
+	if (drv->direct_mode)
+	{
+		// Một buffer: chờ DMA trả buffer, kiểm tra vùng ngoài phần vẽ lại còn nguyên
+		simWaitFlushing(drv);
+		uint16_t *fb = (uint16_t *)draw_buf->buf1;
+		uint32_t total = (uint32_t)drv->hor_res * drv->ver_res;
+		if (simLvgl.shadowBuf != fb)
+		{
+			// Buffer mới cấp phát: chưa có gì để kiểm tra
+			memcpy(simLvgl.shadow, fb, total * 2);
+			simLvgl.shadowBuf = fb;
+		}
+		for (uint32_t i = 0; i < total; i++)
+		{
+			simLvgl.staleBuffer += fb[i] != simLvgl.shadow[i];
+		}
+		for (lv_coord_t y = area.y1; y <= area.y2; y++)
+		{
+			uint16_t *row = fb + y * drv->hor_res + area.x1;
+			simRender(row, w, y);
+			memcpy(simLvgl.shadow + y * drv->hor_res + area.x1, row, w * 2);
+		}
+		lv_area_t full = {0, 0, (lv_coord_t)(drv->hor_res - 1), (lv_coord_t)(drv->ver_res - 1)};
+		simDrawBufFlush(drv, full, true);
+		simMonitor(drv, start, px);
+		disp->inv_p = 0;
+		return;
+	}
+
+	lv_coord_t maxRows = (lv_coord_t)(draw_buf->size / w);
+	for (lv_coord_t y = area.y1; y <= area.y2; y += maxRows)
+	{
+		lv_area_t band = {area.x1, y, area.x2, (lv_coord_t)(y + maxRows - 1 > area.y2 ? area.y2 : y + maxRows - 1)};
+		uint32_t pixels = (uint32_t)w * (band.y2 - band.y1 + 1);
+
+		// Một buffer: chờ DMA trả buffer trước khi vẽ đè
+		if (draw_buf->buf1 && !draw_buf->buf2)
+		{
+			simWaitFlushing(drv);
+		}
+		simRender((uint16_t *)draw_buf->buf_act, pixels, y);
+		simDrawBufFlush(drv, band, band.y2 == area.y2);
+	}
+	simMonitor(drv, start, px);
+	disp->inv_p = 0;
+}
+
+inline uint16_t lv_anim_count_running() { return simLvgl.animations; }
+
+// Timer refresh với chu kỳ LV_DEF_REFR_PERIOD (33 ms) là timer duy nhất
+inline uint32_t lv_timer_handler()
+{
+	simLvgl.timerRuns++;
+	lv_refr_now(&simLvgl.disp);
+	return 33;
+}
+
+#endif // DISPLAY_SIM_LVGL_H
@@ -0,0 +1,553 @@
+#!/usr/bin/env python3
+"""Cắt font LVGL theo tập ký tự widget thật sự dùng và/hoặc nén bitmap.
+
+include/fonts/*.c là font gốc (lv_font_conv, 4 bpp, không nén, đủ ASCII và tiếng
+Việt). Công cụ này đọc các mảng bitmap/glyph_dsc/cmap của font gốc; với font có
+tập ký tự riêng trong bảng FONTS thì chỉ giữ các glyph đó, đánh lại glyph id và
+dựng lại cmap; font chữ tự do giữ nguyên mọi glyph. Font đánh dấu nén được mã hóa
+lại theo định dạng RLE + prefilter của lv_font_conv (bitmap_format = 1, cần
+LV_USE_FONT_COMPRESSED 1 trong lv_conf.h). Kết quả ghi vào include/fonts/subset/,
+được src/font_*.c biên dịch thay cho font gốc.
+
+    python3 tools/font_subset.py                  # ghi lại font nếu đầu vào đổi
+    python3 tools/font_subset.py --check          # báo lỗi nếu font đã cũ
+    python3 tools/font_subset.py --report         # bảng flash: gốc / cắt / nén
+    python3 tools/font_subset.py --bench-dir DIR  # cả ba biến thể cho tools/display_sim
+
+Thời gian tra glyph và vẽ của từng biến thể: make -C tools/display_sim bench-fonts.
+Tập ký tự của DistanceReadout đọc từ DIGIT_ATLAS_CHARS trong src/DigitAtlas.h.
+PlatformIO chạy file này trước mỗi lần build (extra_scripts = pre:...).
+"""
+import argparse
+import os
+import re
+import sys
+
+BYTES_PER_LINE = 16
+
+ASCII = "".join(chr(c) for c in range(0x20, 0x7F))
+VI_LOWER = ("áàảãạăắằẳẵặâấầẩẫậéèẻẽẹêếềểễệíìỉĩịóòỏõọôốồổỗộơớờởỡợ"
+            "úùủũụưứừửữựýỳỷỹỵđ")
+VI_UPPER = VI_LOWER.upper()
+TEXT = ASCII + VI_LOWER + VI_UPPER
+
+
+def digit_atlas_chars(root):
+    with open(os.path.join(root, "src", "DigitAtlas.h"), encoding="utf-8") as f:
+        m = re.search(r'#define\s+DIGIT_ATLAS_CHARS\s+"([^"]*)"', f.read())
+    if not m:
+        raise SystemExit("src/DigitAtlas.h: DIGIT_ATLAS_CHARS not found")
+    return m.group(1)
+
+
+class Font:
+    def __init__(self, name, users, charset, compress, corpus):
+        self.name = name          # tên file/biến trong include/fonts
+        self.users = users        # widget dùng font, chỉ để báo cáo
+        self.charset = charset    # hàm root -> chuỗi ký tự cần giữ, None: giữ mọi glyph
+        self.compress = compress  # bản đưa vào build có nén không
+        self.corpus = corpus      # text mẫu cho bench-fonts
+
+
+# Font nào, widget nào, giữ ký tự nào. Font gốc chữ đã chỉ có ASCII + tiếng Việt, và
+# mỗi font chữ đều có ít nhất một widget hiện text tự do từ điện thoại (tên đường,
+# thời gian hành trình, tiêu đề) nên không cắt được: chỉ nén. Tách riêng font số cho
+# _timeLabel/_speedLabel sẽ thêm một font chứ không bớt được glyph nào của font chữ.
+# Không có trong bảng (src/font_*.c dùng thẳng font gốc): montserrat_semibold_28
+# (_titleLabel, _speedLabel; _speedLabel đổi theo từng gói nên giữ bitmap thường) và
+# montserrat_semibold_24 (không được tham chiếu, --gc-sections đã bỏ).
+FONTS = (
+    # Giờ "4:04" và thời gian hành trình do điện thoại gửi; hai nhãn chỉ vẽ lại khi
+    # đổi phút hoặc đổi text nên nén được
+    Font("montserrat_24", "_timeLabel, _durationLabel", None, True,
+         "4:04 12 phút 1 giờ 5 phút Đến nơi lúc 17:45"),
+    # Chữ chạy chỉ raster khi đổi text (MarqueeLabel) nên giải nén không nằm trên đường frame
+    Font("montserrat_bold_32", "_directionLabel, _defaultMessageLabel, _distanceLabel", None, True,
+         "Rẽ trái vào Đường Nguyễn Văn Linh. Tiếp tục đi thẳng trên Quốc lộ 1A về phía Biên Hòa"),
+    # Chỉ được raster một lần vào atlas của DistanceReadout
+    Font("montserrat_number_bold_48", "DistanceReadout", digit_atlas_chars, True,
+         "1,2 km 850 m 0.3 mi 1,200 ft"),
+)
+
+GLYPH_DSC_SIZE = 8   # lv_font_fmt_txt_glyph_dsc_t (LV_FONT_FMT_TXT_LARGE 0)
+CMAP_SIZE = 24       # lv_font_fmt_txt_cmap_t trên ESP32 (con trỏ 32 bit)
+FIXED_SIZE = 24 + 36  # lv_font_fmt_txt_dsc_t + lv_font_t
+
+
+# ---------------------------------------------------------------------------
+# Đọc font lv_font_conv
+
+class Glyph:
+    def __init__(self, adv_w, box_w, box_h, ofs_x, ofs_y, bitmap):
+        self.adv_w = adv_w
+        self.box_w = box_w
+        self.box_h = box_h
+        self.ofs_x = ofs_x
+        self.ofs_y = ofs_y
+        self.bitmap = bitmap  # 4 bpp, liên tục, không nén
+
+    def pixels(self):
+        n = self.box_w * self.box_h
+        return [(self.bitmap[i >> 1] >> (0 if i & 1 else 4)) & 0x0F for i in range(n)]
+
+
+class SourceFont:
+    pass
+
+
+def c_int(text, field):
+    m = re.search(r"\.%s\s*=\s*(-?\d+)" % field, text)
+    if not m:
+        raise SystemExit("font: .%s not found" % field)
+    return int(m.group(1))
+
+
+def read_font(path):
+    with open(path, encoding="utf-8") as f:
+        text = f.read()
+    font = SourceFont()
+
+    start = text.index("{", text.index("glyph_bitmap[]"))
+    bitmap = bytes(int(x, 16) for x in re.findall(r"0x[0-9a-fA-F]+", text[start:text.index("};", start)]))
+
+    start = text.index("glyph_dsc[]")
+    dsc = re.findall(r"\{\.bitmap_index = (\d+), \.adv_w = (\d+), \.box_w = (\d+), \.box_h = (\d+), "
+                     r"\.ofs_x = (-?\d+), \.ofs_y = (-?\d+)\}", text[start:text.index("};", start)])
+    lists = {}
+    for name, body in re.findall(r"static const uint16_t (\w+)\[\] = \{([^}]*)\}", text):
+        lists[name] = [int(x, 16) for x in re.findall(r"0x[0-9a-fA-F]+", body)]
+
+    if c_int(text, "bpp") != 4 or c_int(text, "bitmap_format") != 0 or "kern_dsc = NULL" not in text:
+        raise SystemExit("%s: only uncompressed 4 bpp fonts without kerning are supported" % path)
+
+    font.line_height = c_int(text, "line_height")
+    font.base_line = c_int(text, "base_line")
+    font.underline_position = c_int(text, "underline_position")
+    font.underline_thickness = c_int(text, "underline_thickness")
+    font.glyphs = {}
+    for m in re.finditer(r"\.range_start = (\d+), \.range_length = (\d+), \.glyph_id_start = (\d+),\s*"
+                         r"\.unicode_list = (\w+), \.glyph_id_ofs_list = NULL, \.list_length = (\d+), "
+                         r"\.type = LV_FONT_FMT_TXT_CMAP_(\w+)", text):
+        range_start, range_length, id_start = int(m.group(1)), int(m.group(2)), int(m.group(3))
+        if m.group(6) == "FORMAT0_TINY":
+            offsets = range(range_length)
+        elif m.group(6) == "SPARSE_TINY":
+            offsets = lists[m.group(4)]
+        else:
+            raise SystemExit("%s: cmap type %s not supported" % (path, m.group(6)))
+        for i, ofs in enumerate(offsets):
+            index, adv_w, box_w, box_h, ofs_x, ofs_y = (int(x) for x in dsc[id_start + i])
+            size = (box_w * box_h + 1) // 2
+            font.glyphs[range_start + ofs] = Glyph(adv_w, box_w, box_h, ofs_x, ofs_y, bitmap[index:index + size])
+    return font
+
+
+# ---------------------------------------------------------------------------
+# Nén như lv_font_conv: prefilter (XOR với dòng trên) + RLE, giải được bằng
+# decompress() trong lv_font_fmt_txt.c của LVGL 8.3
+
+class BitWriter:
+    def __init__(self):
+        self.out = bytearray()
+        self.acc = 0
+        self.n = 0
+
+    def write(self, value, bits):
+        for i in range(bits - 1, -1, -1):
+            self.acc = (self.acc << 1) | ((value >> i) & 1)
+            self.n += 1
+            if self.n == 8:
+                self.out.append(self.acc)
+                self.acc = 0
+                self.n = 0
+
+    def data(self):
+        return bytes(self.out) + (bytes([self.acc << (8 - self.n)]) if self.n else b"")
+
+
+def prefilter(glyph):
+    px = glyph.pixels()
+    w = glyph.box_w
+    return [px[i] ^ px[i - w] if i >= w else px[i] for i in range(len(px))]
+
+
+def rle_encode(values, bpp=4):
+    """Mã hóa theo đúng máy trạng thái rle_next(): SINGLE -> REPEATE -> COUNTER."""
+    bits = BitWriter()
+    n = len(values)
+    i = 0
+    prev = 0
+    repeat = False
+    while i < n:
+        if not repeat:
+            bits.write(values[i], bpp)
+            repeat = i > 0 and values[i] == prev
+            prev = values[i]
+            i += 1
+            count = 0
+            continue
+        if values[i] != prev:
+            bits.write(0, 1)
+            bits.write(values[i], bpp)
+            prev = values[i]
+            repeat = False
+            i += 1
+            continue
+        bits.write(1, 1)
+        count += 1
+        i += 1
+        if count == 11:
+            # Bộ đếm 6 bit c: c - 1 pixel lặp nữa rồi một giá trị mới
+            more = 0
+            while i + more < n and values[i + more] == prev and more < 62:
+                more += 1
+            bits.write(more + 1, 6)
+            i += more
+            if i < n:
+                bits.write(values[i], bpp)
+                prev = values[i]
+                i += 1
+            repeat = False
+    return bits.data()
+
+
+def rle_decode(data, count, bpp=4):
+    """Bản Python của rle_next() để tự kiểm tra bộ mã hóa."""
+    def get(pos, length):
+        v = 0
+        for k in range(length):
+            byte = data[(pos + k) >> 3] if (pos + k) >> 3 < len(data) else 0
+            v = (v << 1) | ((byte >> (7 - ((pos + k) & 7))) & 1)
+        return v
+
+    out = []
+    rdp = 0
+    state = "single"
+    prev = 0
+    cnt = 0
+    for _ in range(count):
+        if state == "single":
+            ret = get(rdp, bpp)
+            if rdp != 0 and prev == ret:
+                cnt = 0
+                state = "repeat"
+            prev = ret
+            rdp += bpp
+        elif state == "repeat":
+            v = get(rdp, 1)
+            cnt += 1
+            rdp += 1
+            if v == 1:
+                ret = prev
+                if cnt == 11:
+                    cnt = get(rdp, 6)
+                    rdp += 6
+                    if cnt != 0:
+                        state = "counter"
+                    else:
+                        ret = get(rdp, bpp)
+                        prev = ret
+                        rdp += bpp
+                        state = "single"
+            else:
+                ret = get(rdp, bpp)
+                prev = ret
+                rdp += bpp
+                state = "single"
+        else:
+            ret = prev
+            cnt -= 1
+            if cnt == 0:
+                ret = get(rdp, bpp)
+                prev = ret
+                rdp += bpp
+                state = "single"
+        out.append(ret)
+    return out
+
+
+def compress(glyph):
+    values = prefilter(glyph)
+    data = rle_encode(values)
+    if rle_decode(data, len(values)) != values:
+        raise SystemExit("font_subset: RLE round trip failed")
+    return data
+
+
+# ---------------------------------------------------------------------------
+# Ghi font
+
+def build_cmaps(codepoints):
+    """Dãy liên tiếp dài -> FORMAT0_TINY, phần lẻ tẻ gom vào SPARSE_TINY."""
+    runs = []
+    for cp in codepoints:
+        if runs and cp == runs[-1][-1] + 1:
+            runs[-1].append(cp)
+        else:
+            runs.append([cp])
+    cmaps = []
+    sparse = []
+    glyph_id = 1
+
+    def flush_sparse():
+        nonlocal glyph_id
+        if sparse:
+            cmaps.append((sparse[0], sparse[-1] - sparse[0] + 1, glyph_id, [cp - sparse[0] for cp in sparse]))
+            glyph_id += len(sparse)
+            del sparse[:]
+
+    for run in runs:
+        if len(run) >= 8:
+            flush_sparse()
+            cmaps.append((run[0], len(run), glyph_id, None))
+            glyph_id += len(run)
+        else:
+            if sparse and run[-1] - sparse[0] > 0xFFFF:
+                flush_sparse()
+            sparse.extend(run)
+    flush_sparse()
+    return cmaps
+
+
+class Variant:
+    def __init__(self, font, spec, codepoints, compressed, symbol):
+        self.font = font
+        self.spec = spec
+        self.codepoints = codepoints
+        self.compressed = compressed
+        self.symbol = symbol
+        self.cmaps = build_cmaps(codepoints)
+        self.bitmaps = [compress(font.glyphs[cp]) if compressed else font.glyphs[cp].bitmap for cp in codepoints]
+        if compressed:
+            # get_bits() có thể đọc quá một byte ở cuối dòng bit
+            self.bitmaps[-1] += b"\0"
+
+    def flash_bytes(self):
+        lists = sum(2 * len(c[3]) for c in self.cmaps if c[3] is not None)
+        return (sum(len(b) for b in self.bitmaps) + GLYPH_DSC_SIZE * (len(self.codepoints) + 1) +
+                CMAP_SIZE * len(self.cmaps) + lists + FIXED_SIZE)
+
+    def render(self, header):
+        guard = self.symbol.upper()
+        lines = [
+            "/*******************************************************************************",
+            " * Sinh bởi tools/font_subset.py từ include/fonts/%s.c, không sửa tay." % self.spec.name,
+            " * Dùng bởi: %s" % self.spec.users,
+            " * Glyph: %d, bitmap: %s" % (len(self.codepoints), "nén RLE + prefilter" if self.compressed else "4 bpp"),
+            " ******************************************************************************/",
+            "",
+            header,
+            "",
+            "#ifndef %s" % guard,
+            "#define %s 1" % guard,
+            "#endif",
+            "",
+            "#if %s" % guard,
+            "",
+        ]
+        if self.compressed:
+            lines += [
+                "#if !LV_USE_FONT_COMPRESSED",
+                "#error \"%s.c là font nén: bật LV_USE_FONT_COMPRESSED trong lv_conf.h\"" % self.symbol,
+                "#endif",
+                "",
+            ]
+        lines.append("static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {")
+        index = []
+        pos = 0
+        for cp, data in zip(self.codepoints, self.bitmaps):
+            index.append(pos)
+            pos += len(data)
+            lines.append("    /* U+%04X \"%s\" */" % (cp, chr(cp) if chr(cp) not in "\\\"" else "\\" + chr(cp)))
+            for i in range(0, len(data), BYTES_PER_LINE):
+                lines.append("    " + ", ".join("0x%x" % b for b in data[i:i + BYTES_PER_LINE]) + ",")
+            lines.append("")
+        lines += [
+            "};",
+            "",
+            "static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {",
+            "    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,",
+        ]
+        for cp, pos in zip(self.codepoints, index):
+            g = self.font.glyphs[cp]
+            lines.append("    {.bitmap_index = %d, .adv_w = %d, .box_w = %d, .box_h = %d, .ofs_x = %d, .ofs_y = %d},"
+                         % (pos, g.adv_w, g.box_w, g.box_h, g.ofs_x, g.ofs_y))
+        lines += ["};", ""]
+
+        entries = []
+        for k, (start, length, glyph_id, offsets) in enumerate(self.cmaps):
+            if offsets is None:
+                entries.append("        .range_start = %d, .range_length = %d, .glyph_id_start = %d,\n"
+                               "        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, "
+                               ".type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY" % (start, length, glyph_id))
+                continue
+            lines.append("static const uint16_t unicode_list_%d[] = {" % k)
+            for i in range(0, len(offsets), 8):
+                lines.append("    " + ", ".join("0x%x" % o for o in offsets[i:i + 8]) + ",")
+            lines += ["};", ""]
+            entries.append("        .range_start = %d, .range_length = %d, .glyph_id_start = %d,\n"
+                           "        .unicode_list = unicode_list_%d, .glyph_id_ofs_list = NULL, .list_length = %d, "
+                           ".type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY" % (start, length, glyph_id, k, len(offsets)))
+        lines.append("static const lv_font_fmt_txt_cmap_t cmaps[] = {")
+        lines.append(",\n".join("    {\n%s\n    }" % e for e in entries))
+        lines += [
+            "};",
+            "",
+            "#if LVGL_VERSION_MAJOR == 8",
+            "static lv_font_fmt_txt_glyph_cache_t cache;",
+            "#endif",
+            "",
+            "static const lv_font_fmt_txt_dsc_t font_dsc = {",
+            "    .glyph_bitmap = glyph_bitmap,",
+            "    .glyph_dsc = glyph_dsc,",
+            "    .cmaps = cmaps,",
+            "    .kern_dsc = NULL,",
+            "    .kern_scale = 0,",
+            "    .cmap_num = %d," % len(self.cmaps),
+            "    .bpp = 4,",
+            "    .kern_classes = 0,",
+            "    .bitmap_format = %d," % (1 if self.compressed else 0),
+            "#if LVGL_VERSION_MAJOR == 8",
+            "    .cache = &cache",
+            "#endif",
+            "};",
+            "",
+            "const lv_font_t %s = {" % self.symbol,
+            "    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,",
+            "    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,",
+            "    .line_height = %d," % self.font.line_height,
+            "    .base_line = %d," % self.font.base_line,
+            "    .subpx = LV_FONT_SUBPX_NONE,",
+            "    .underline_position = %d," % self.font.underline_position,
+            "    .underline_thickness = %d," % self.font.underline_thickness,
+            "    .dsc = &font_dsc,",
+            "    .fallback = NULL,",
+            "    .user_data = NULL,",
+            "};",
+            "",
+            "lv_font_t* get_%s()" % self.symbol,
+            "{",
+            "    return (lv_font_t*)&%s;" % self.symbol,
+            "}",
+            "",
+            "#endif /*#if %s*/" % guard,
+            "",
+        ]
+        return "\n".join(lines)
+
+
+def variants(root, spec):
+    """{"full", "subset" (nếu có tập ký tự riêng), "rle"} của một font."""
+    font = read_font(os.path.join(root, "include", "fonts", spec.name + ".c"))
+    full = sorted(font.glyphs)
+    result = {"full": Variant(font, spec, full, False, spec.name + "_full")}
+    wanted = full
+    if spec.charset is not None:
+        wanted = sorted(set(ord(c) for c in spec.charset(root)))
+        missing = [cp for cp in wanted if cp not in font.glyphs]
+        if missing:
+            raise SystemExit("%s: no glyph for %s" % (spec.name, ", ".join("U+%04X" % cp for cp in missing)))
+        result["subset"] = Variant(font, spec, wanted, False, spec.name + "_subset")
+    result["rle"] = Variant(font, spec, wanted, True, spec.name + "_rle")
+    return result
+
+
+def shipped_variant(vs, spec):
+    if not spec.compress and "subset" not in vs:
+        raise SystemExit("%s: neither subset nor compressed, use include/fonts/%s.c directly"
+                         % (spec.name, spec.name))
+    return vs["rle"] if spec.compress else vs["subset"]
+
+
+def lv_conf_compressed(root):
+    with open(os.path.join(root, "include", "lv_conf.h"), encoding="utf-8-sig") as f:
+        m = re.search(r"#define\s+LV_USE_FONT_COMPRESSED\s+(\d+)", f.read())
+    return bool(m and int(m.group(1)))
+
+
+def write_if_changed(path, text, check):
+    if os.path.exists(path):
+        with open(path, encoding="utf-8") as f:
+            if f.read() == text:
+                return 0
+    if check:
+        print("%s is stale: run tools/font_subset.py" % os.path.relpath(path), file=sys.stderr)
+        return 1
+    os.makedirs(os.path.dirname(path), exist_ok=True)
+    with open(path, "w", encoding="utf-8") as f:
+        f.write(text)
+    print("font_subset: wrote %s" % os.path.relpath(path))
+    return 0
+
+
+def update(root, check=False):
+    """Ghi include/fonts/subset/*.c (tên biến như font gốc để VietnameseFonts không đổi)."""
+    if any(spec.compress for spec in FONTS) and not lv_conf_compressed(root):
+        raise SystemExit("font_subset: compressed fonts need LV_USE_FONT_COMPRESSED 1 in include/lv_conf.h")
+    status = 0
+    for spec in FONTS:
+        shipped = shipped_variant(variants(root, spec), spec)
+        shipped.symbol = spec.name
+        path = os.path.join(root, "include", "fonts", "subset", spec.name + ".c")
+        status |= write_if_changed(path, shipped.render('#include "../local_fonts.h"'), check)
+    return status
+
+
+def report(root):
+    print("%-26s %9s %9s %9s  %s" % ("font", "full", "subset", "rle", "glyphs (full -> subset)"))
+    totals = [0, 0, 0]
+    shipped = 0
+    for spec in FONTS:
+        vs = variants(root, spec)
+        # Không có tập ký tự riêng: cột subset là chính font gốc
+        sizes = [vs[k].flash_bytes() for k in ("full", "subset" if "subset" in vs else "full", "rle")]
+        totals = [t + s for t, s in zip(totals, sizes)]
+        shipped += shipped_variant(vs, spec).flash_bytes()
+        print("%-26s %9d %9s %9d  %d -> %d%s" % (spec.name, sizes[0], sizes[1] if "subset" in vs else "-", sizes[2],
+                                                 len(vs["full"].codepoints), len(vs["rle"].codepoints),
+                                                 "  [rle]" if spec.compress else ""))
+    print("%-26s %9d %9d %9d  shipped %d (%d saved)" % ("total", totals[0], totals[1], totals[2], shipped,
+                                                      totals[0] - shipped))
+
+
+def c_string(text):
+    # Bát phân thay vì \x: chữ a-f đứng ngay sau không bị nuốt vào escape
+    return "".join(c if " " <= c < "\x7f" and c not in "\\\"" else "".join("\\%03o" % b for b in c.encode("utf-8"))
+                   for c in text)
+
+
+def write_bench(root, out):
+    """Mọi biến thể với tên riêng + variants.inc cho tools/display_sim/font_bench.cpp."""
+    rows = []
+    for spec in FONTS:
+        vs = variants(root, spec)
+        for v in (vs[k] for k in ("full", "subset", "rle") if k in vs):
+            write_if_changed(os.path.join(out, v.symbol + ".c"), v.render('#include "lv_font.h"'), False)
+            rows.append('FONT_VARIANT(%s, "%s", "%s", %d, %d, "%s")'
+                        % (v.symbol, spec.name, v.symbol[len(spec.name) + 1:], v.flash_bytes(), len(v.codepoints),
+                           c_string(spec.corpus)))
+    write_if_changed(os.path.join(out, "variants.inc"), "\n".join(rows) + "\n", False)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--check", action="store_true", help="chỉ kiểm tra include/fonts/subset, không ghi")
+    parser.add_argument("--report", action="store_true", help="in bảng flash của các biến thể")
+    parser.add_argument("--bench-dir", help="ghi mọi biến thể cho bench-fonts vào thư mục này")
+    args = parser.parse_args()
+    root = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
+    if args.report:
+        report(root)
+        return 0
+    if args.bench_dir:
+        write_bench(root, args.bench_dir)
+        return 0
+    return update(root, args.check)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
+else:
+    # Chạy như extra_script của PlatformIO
+    Import("env")  # noqa: F821
+    update(env.subst("$PROJECT_DIR"))  # noqa: F821
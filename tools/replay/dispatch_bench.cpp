@@ -0,0 +1,230 @@
+/*
+ * So sánh tra bảng lệnh (findCommand: chỉ mục (family, command) + vài mục cùng lệnh)
+ * với switch lồng nhau theo byte 0, 4, 5, 3 như dataReceived() cũ.
+ * Chạy: make -C tools/replay bench-dispatch
+ *
+ * Hai cách phải chọn cùng handler cho mọi gói trong bộ mẫu (kể cả gói ngắn và lệnh lạ)
+ * trước khi đo. Bộ mẫu nghiêng về điều hướng như khi đang dẫn đường. Số đo trên host
+ * chỉ để so sánh hai cách, không phải thời gian trên ESP32-C3.
+ */
+#include <Arduino.h>
+#include <chrono>
+#include <stdio.h>
+#include <vector>
+
+#include "ChronosESP32Patched.h"
+
+uint32_t replayMillis = 0;
+Print Serial;
+EspClass ESP;
+uint32_t EspClass::getFreeHeap() { return 0; }
+
+static const int ROUNDS = 200000;
+
+struct Sample
+{
+	uint8_t data[16];
+	int length;
+	int weight; // số lần xuất hiện trong bộ mẫu
+};
+
+// family, len_hi, len_lo, frame, command, sub...
+static const Sample SAMPLES[] = {
+	{{0xAB, 0x00, 0x20, 0xFE, 0xEF, 0x80, 0x01, 0x01, 0x12, 0x34, 0x56, 0x78, 'A', 0}, 14, 40},
+	{{0xAB, 0x00, 0x70, 0xFE, 0xEE, 0x00, 0x00, 0x12, 0x34, 0x56, 0x78, 0xFF}, 12, 12},
+	{{0xAB, 0x00, 0x03, 0xFE, 0xEF, 0x00}, 6, 2},
+	{{0xAB, 0x00, 0x03, 0xFE, 0xEF, 0xFF}, 6, 1},
+	{{0xAB, 0x00, 0x03, 0xFE, 0xEF, 0x42}, 6, 1},
+	{{0xAB, 0x00, 0x0B, 0xFF, 0x93, 0x80, 0x00, 0x07, 0xEA, 0x0A, 0x11, 0x0C, 0x1E, 0x00}, 14, 2},
+	{{0xAB, 0x00, 0x05, 0xFF, 0x91, 0x80, 0x01, 0x55}, 8, 2},
+	{{0xAB, 0x00, 0x05, 0xFE, 0xCA, 0x00, 0x00, 0x24}, 8, 1},
+	{{0xAB, 0x00, 0x04, 0xFF, 0x7C, 0x80, 0x01}, 7, 1},
+	{{0xAB, 0x00, 0x04, 0xFF, 0x79, 0x80, 0x01}, 7, 1},
+	{{0xAB, 0x00, 0x02, 0xFF, 0x71, 0x80}, 6, 1},
+	{{0xAB, 0x00, 0x02, 0xFF, 0x23, 0x80}, 6, 1},
+	{{0xAB, 0x00, 0x08, 0xFF, 0x72, 0x01, 0x02, 0x00, 'H', 'i'}, 10, 4},
+	{{0xAB, 0x00, 0x08, 0xFF, 0x73, 0x00, 0x01, 0x07, 0x1E, 0x7F, 0x00}, 11, 1},
+	{{0xAB, 0x00, 0x04, 0xFF, 0x31, 0x0A, 0x01}, 7, 1},
+	{{0xAB, 0x00, 0x04, 0xFF, 0x32, 0x80, 0x01}, 7, 1},
+	{{0xAB, 0x00, 0x03, 0xFF, 0x51, 0x80}, 6, 1},
+	{{0xAB, 0x00, 0x03, 0xFF, 0xA8, 0x00, 'q'}, 7, 1},
+	{{0xAB, 0x00, 0x03, 0xFE, 0xA8, 0x01}, 6, 1},
+	{{0xAB, 0x00, 0x06, 0xFF, 0x59, 0x00, 'A', 0, '1'}, 9, 1}, // danh bạ: chưa có capture, không xử lý
+	{{0xAB, 0x00, 0x04, 0xFE, 0x59, 0x01, 0x00}, 7, 1},
+	{{0xEA, 0x00, 0x06, 0xFF, 0x7E, 0x01, 0x00, 'H', 'N'}, 9, 2},
+	{{0xEA, 0x00, 0x0B, 0xFF, 0x7E, 0x02, 0x01, 0x08, 0, 0, 0, 0, 0, 0}, 14, 2},
+	{{0xAB, 0x00, 0x03, 0xFF, 0x99, 0x00}, 6, 2},  // lệnh lạ
+	{{0xAB, 0x00, 0x03, 0xFE, 0xEF, 0x80}, 6, 1},  // điều hướng bị cắt ngắn
+	{{0x12, 0x00, 0x03, 0xFF, 0x23, 0x00}, 6, 1},  // family lạ
+};
+
+struct DispatchBench
+{
+	typedef ChronosESP32Patched::CommandHandler Handler;
+	typedef ChronosESP32Patched C;
+
+	static Handler table(const uint8_t *data, int length)
+	{
+		const C::CommandEntry *e = C::findCommand(data, length);
+		return e != nullptr ? e->handler : nullptr;
+	}
+
+	// Cùng ngữ nghĩa với bảng lệnh, viết theo kiểu switch của dataReceived() trước đây
+	static Handler nestedSwitch(const uint8_t *data, int length)
+	{
+		if (length < 5)
+		{
+			return nullptr;
+		}
+		uint8_t sub = length >= 6 ? data[5] : 0;
+		if (data[0] == 0xAB)
+		{
+			switch (data[4])
+			{
+			case 0x23:
+				return &C::onReset;
+#if CHRONOS_HAS(HEALTH)
+			case 0x31:
+				if (length >= 6 && (sub == 0x0A || sub == 0x12 || sub == 0x22))
+				{
+					return length >= 7 ? &C::onHealthMeasure : nullptr;
+				}
+				return nullptr;
+			case 0x32:
+				return length >= 7 ? &C::onHealthMeasureAll : nullptr;
+			case 0x51:
+				return length >= 6 && sub == 0x80 ? &C::onStepsRequest : nullptr;
+			case 0x52:
+				return length >= 6 && sub == 0x80 ? &C::onSleepRequest : nullptr;
+#endif
+			case 0x71:
+				return &C::onFindWatch;
+#if CHRONOS_HAS(NOTIFICATIONS)
+			case 0x72:
+				return length >= 8 ? &C::onNotification : nullptr;
+#endif
+#if CHRONOS_HAS(ALARMS)
+			case 0x73:
+				return length >= 11 ? &C::onAlarm : nullptr;
+#endif
+			case 0x79:
+				return length >= 7 ? &C::onCamera : nullptr;
+			case 0x7C:
+				return length >= 7 ? &C::onHour24 : nullptr;
+			case 0x91:
+				return length >= 8 ? &C::onPhoneBattery : nullptr;
+			case 0x93:
+				return length >= 14 ? &C::onTime : nullptr;
+#if CHRONOS_HAS(QR)
+			case 0xA8:
+				if (data[3] == 0xFF)
+				{
+					return length >= 6 ? &C::onQrLink : nullptr;
+				}
+				if (data[3] == 0xFE)
+				{
+					return length >= 6 ? &C::onQrEnd : nullptr;
+				}
+				return nullptr;
+#endif
+			case 0xCA:
+				return data[3] == 0xFE && length >= 8 ? &C::onAppInfo : nullptr;
+			case 0xEE:
+				return data[3] == 0xFE && length >= 11 ? &C::onNavIcon : nullptr;
+			case 0xEF:
+				if (data[3] != 0xFE || length < 6)
+				{
+					return nullptr;
+				}
+				switch (sub)
+				{
+				case 0x00:
+					return &C::onNavInactive;
+				case 0xFF:
+					return &C::onNavDisabled;
+				case 0x80:
+					return length >= 12 ? &C::onNavData : nullptr;
+				default:
+					return &C::onNavOther;
+				}
+			default:
+				return nullptr;
+			}
+		}
+#if CHRONOS_HAS(WEATHER)
+		if (data[0] == 0xEA && data[4] == 0x7E && length >= 6)
+		{
+			switch (sub)
+			{
+			case 0x01:
+				return length >= 7 ? &C::onWeatherCity : nullptr;
+			case 0x02:
+				return length >= 8 ? &C::onHourlyForecast : nullptr;
+			}
+		}
+#endif
+		return nullptr;
+	}
+};
+
+template <typename F>
+static double measure(const std::vector<const Sample *> &mix, F dispatch, volatile uint32_t &sink)
+{
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (int r = 0; r < ROUNDS; r++)
+	{
+		for (size_t i = 0; i < mix.size(); i++)
+		{
+			sink += dispatch(mix[i]->data, mix[i]->length) != nullptr;
+		}
+	}
+	std::chrono::duration<double, std::nano> ns = std::chrono::steady_clock::now() - start;
+	return ns.count() / ((double)ROUNDS * mix.size());
+}
+
+int main()
+{
+	// begin() xây chỉ mục lệnh như trên thiết bị
+	ChronosESP32Patched chronos;
+	chronos.begin();
+
+	int failures = 0;
+	std::vector<const Sample *> mix;
+	for (size_t i = 0; i < sizeof(SAMPLES) / sizeof(SAMPLES[0]); i++)
+	{
+		const Sample &s = SAMPLES[i];
+		// Mọi độ dài cắt ngắn cũng phải chọn cùng handler
+		for (int length = 0; length <= s.length; length++)
+		{
+			if (DispatchBench::table(s.data, length) != DispatchBench::nestedSwitch(s.data, length))
+			{
+				printf("FAIL sample %zu (%02X %02X) length %d: table and switch disagree\n", i, s.data[0], s.data[4],
+					   length);
+				failures++;
+			}
+		}
+		for (int w = 0; w < s.weight; w++)
+		{
+			mix.push_back(&s);
+		}
+	}
+	printf("dispatch : %zu samples, %d failed\n", sizeof(SAMPLES) / sizeof(SAMPLES[0]), failures);
+
+	// Trộn đều để bộ dự đoán nhánh không học được thứ tự
+	uint32_t seed = 12345;
+	for (size_t i = mix.size() - 1; i > 0; i--)
+	{
+		seed = seed * 1103515245u + 12345u;
+		size_t j = (seed >> 8) % (i + 1);
+		const Sample *t = mix[i];
+		mix[i] = mix[j];
+		mix[j] = t;
+	}
+
+	volatile uint32_t sink = 0;
+	double tableNs = measure(mix, DispatchBench::table, sink);
+	double switchNs = measure(mix, DispatchBench::nestedSwitch, sink);
+	printf("table    : %6.2f ns/packet\n", tableNs);
+	printf("switch   : %6.2f ns/packet\n", switchNs);
+	return failures == 0 ? 0 : 1;
+}
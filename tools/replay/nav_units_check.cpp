@@ -0,0 +1,90 @@
+/*
+ * Kiểm tra src/NavUnits.h với các chuỗi thật Google Maps gửi qua Chronos
+ * (tiếng Việt và tiếng Anh). Chạy: make -C tools/replay check-units
+ */
+#include <stdio.h>
+#include "NavUnits.h"
+
+struct Case
+{
+	const char *text;
+	int32_t expected;
+};
+
+static const Case distances[] = {
+	{"300 m", 300},
+	{"50 m", 50},
+	{"1,2 km", 1200},
+	{"1.2 km", 1200},
+	{"12 km", 12000},
+	{"0,5 km", 500},
+	{"1,25 km", 1250},
+	{"0.3 mi", 483},
+	{"1.5 mi", 2414},
+	{"500 ft", 152},
+	{"1,200 ft", 366},
+	{"1.200 m", 1200},
+	{"Còn 850 m", 850},
+	{"", NAV_VALUE_UNKNOWN},
+	{"Navigation", NAV_VALUE_UNKNOWN},
+	{"12", NAV_VALUE_UNKNOWN},
+};
+
+static const Case durations[] = {
+	{"12 phút", 720},
+	{"1 giờ 5 phút", 3900},
+	{"2 giờ", 7200},
+	{"1 ngày 3 giờ", 97200},
+	{"45 min", 2700},
+	{"1 min", 60},
+	{"1 hr 5 min", 3900},
+	{"2 hours 10 mins", 7800},
+	{"1 h 20 min", 4800},
+	{"3 days", 259200},
+	{"30 giây", 30},
+	{"Inactive", NAV_VALUE_UNKNOWN},
+	{"", NAV_VALUE_UNKNOWN},
+};
+
+static const Case etas[] = {
+	{"10:45", 645},
+	{"07:05", 425},
+	{"2:05 PM", 845},
+	{"12:30 AM", 30},
+	{"12:30 PM", 750},
+	{"10:45 SA", 645},
+	{"7:30 CH", 1170},
+	{"8:15 chiều", 1215},
+	{"Đến lúc 18:20", 1100},
+	{"ETA 9:41 am", 581},
+	{"Navigation", NAV_VALUE_UNKNOWN},
+	{"25:00", NAV_VALUE_UNKNOWN},
+	{"", NAV_VALUE_UNKNOWN},
+};
+
+template <typename F, size_t N>
+static int run(const char *name, const Case (&cases)[N], F parse)
+{
+	int failures = 0;
+	for (size_t i = 0; i < N; i++)
+	{
+		int32_t got = parse(cases[i].text);
+		if (got != cases[i].expected)
+		{
+			printf("FAIL %s(\"%s\") = %d, expected %d\n", name, cases[i].text, got, cases[i].expected);
+			failures++;
+		}
+	}
+	printf("%-9s: %zu cases, %d failed\n", name, N, failures);
+	return failures;
+}
+
+static int32_t distance(const char *s) { return navParseDistanceMeters(s); }
+static int32_t duration(const char *s) { return navParseDurationSeconds(s); }
+static int32_t eta(const char *s) { return navParseEtaMinutes(s); }
+
+int main()
+{
+	int failures = run("distance", distances, distance) + run("duration", durations, duration) + run("eta", etas, eta);
+	return failures == 0 ? 0 : 1;
+}
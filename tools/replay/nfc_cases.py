@@ -0,0 +1,77 @@
+#!/usr/bin/env python3
+"""Sinh các ca kiểm tra cho src/VietNfc.h từ một corpus chữ tiếng Việt (mỗi dòng một chuỗi).
+
+Mỗi dòng của corpus được viết lại theo những cách điện thoại có thể gửi:
+
+    nfc       nguyên dạng dựng sẵn
+    nfd       tách hết: chữ gốc + dấu rời theo thứ tự chuẩn
+    split     chữ có mũ/trăng/móc dựng sẵn + dấu thanh rời (kiểu "Unicode tổ hợp" của bộ gõ)
+    reorder   như nfd nhưng dấu trong mỗi cụm đảo ngược (sai thứ tự chuẩn)
+    legacy    như nfd nhưng huyền/sắc là U+0340/U+0341
+
+Kết quả mong đợi là unicodedata.normalize("NFC", ...) của chính chuỗi đã viết lại.
+Đầu ra: mỗi dòng "dạng<TAB>đầu vào<TAB>mong đợi", cho make -C tools/replay check-nfc.
+
+    python3 tools/replay/nfc_cases.py tools/replay/captures/vi_corpus.txt > cases.tsv
+"""
+import argparse
+import sys
+import unicodedata
+
+SHAPE_MARKS = "\u031b\u0302\u0306"  # móc, mũ, trăng: thuộc về chữ cái
+LEGACY = {"\u0300": "\u0340", "\u0301": "\u0341"}
+
+
+def clusters(text):
+    """Chia chuỗi NFD thành các cụm chữ gốc + dấu."""
+    out = []
+    for c in text:
+        if out and unicodedata.combining(c):
+            out[-1] += c
+        else:
+            out.append(c)
+    return out
+
+
+def split_tones(text):
+    result = []
+    for cluster in clusters(unicodedata.normalize("NFD", text)):
+        shape = "".join(c for c in cluster[1:] if c in SHAPE_MARKS)
+        tones = "".join(c for c in cluster[1:] if c not in SHAPE_MARKS)
+        result.append(unicodedata.normalize("NFC", cluster[0] + shape) + tones)
+    return "".join(result)
+
+
+def reorder(text):
+    return "".join(c[0] + c[1:][::-1] for c in clusters(unicodedata.normalize("NFD", text)))
+
+
+def legacy(text):
+    return "".join(LEGACY.get(c, c) for c in unicodedata.normalize("NFD", text))
+
+
+FORMS = (
+    ("nfc", lambda text: unicodedata.normalize("NFC", text)),
+    ("nfd", lambda text: unicodedata.normalize("NFD", text)),
+    ("split", split_tones),
+    ("reorder", reorder),
+    ("legacy", legacy),
+)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("corpus", help="file UTF-8, mỗi dòng một chuỗi")
+    args = parser.parse_args()
+    with open(args.corpus, encoding="utf-8") as f:
+        lines = [line.rstrip("\n") for line in f if line.strip()]
+    out = sys.stdout
+    for name, form in FORMS:
+        for line in lines:
+            text = form(line)
+            out.write("%s\t%s\t%s\n" % (name, text, unicodedata.normalize("NFC", text)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
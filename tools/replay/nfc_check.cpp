@@ -0,0 +1,147 @@
+/*
+ * Kiểm tra và đo src/VietNfc.h với corpus chữ tiếng Việt viết lại ở nhiều dạng
+ * (nfc_cases.py, kết quả mong đợi do unicodedata của Python tính).
+ * Chạy: make -C tools/replay check-nfc
+ *
+ * Với mỗi ca: normalize() phải ra đúng NFC, và khi buffer đích nhỏ dần thì kết quả
+ * phải là tiền tố của kết quả đầy đủ, không cắt đôi ký tự UTF-8. Sau đó đo thời gian
+ * cho từng dạng theo đúng đường của readNavField: quét hasCombiningMarks(), chỉ chuẩn
+ * hóa khi có dấu rời. Số đo trên host chỉ để so sánh giữa các dạng.
+ */
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "VietNfc.h"
+
+struct Case
+{
+	std::string form;
+	std::string input;
+	std::string expected;
+};
+
+static const int ROUNDS = 2000;
+
+static bool readCases(const char *path, std::vector<Case> &cases)
+{
+	FILE *f = fopen(path, "rb");
+	if (f == nullptr)
+	{
+		return false;
+	}
+	char line[1024];
+	while (fgets(line, sizeof(line), f) != nullptr)
+	{
+		std::string s(line);
+		while (!s.empty() && (s.back() == '\n' || s.back() == '\r'))
+		{
+			s.pop_back();
+		}
+		size_t a = s.find('\t');
+		size_t b = a == std::string::npos ? a : s.find('\t', a + 1);
+		if (b == std::string::npos)
+		{
+			continue;
+		}
+		Case c;
+		c.form = s.substr(0, a);
+		c.input = s.substr(a + 1, b - a - 1);
+		c.expected = s.substr(b + 1);
+		cases.push_back(c);
+	}
+	fclose(f);
+	return true;
+}
+
+// Như readNavField: chỉ chuẩn hóa khi có dấu rời
+static size_t ingest(const std::string &in, char *out, size_t outSize)
+{
+	if (!VietNfc::hasCombiningMarks(in.data(), in.size()))
+	{
+		size_t n = in.size() < outSize ? in.size() : outSize;
+		memcpy(out, in.data(), n);
+		return n;
+	}
+	return VietNfc::normalize(in.data(), in.size(), out, outSize);
+}
+
+int main(int argc, char **argv)
+{
+	std::vector<Case> cases;
+	if (argc < 2 || !readCases(argv[1], cases) || cases.empty())
+	{
+		fprintf(stderr, "usage: %s cases.tsv (from nfc_cases.py)\n", argv[0]);
+		return 2;
+	}
+
+	int failures = 0;
+	char out[1024];
+	for (size_t i = 0; i < cases.size(); i++)
+	{
+		const Case &c = cases[i];
+		size_t n = ingest(c.input, out, sizeof(out));
+		if (std::string(out, n) != c.expected)
+		{
+			printf("FAIL %s \"%s\" -> \"%.*s\", expected \"%s\"\n", c.form.c_str(), c.input.c_str(), (int)n, out,
+				   c.expected.c_str());
+			failures++;
+			continue;
+		}
+		// Buffer đích ngắn hơn: tiền tố của kết quả đầy đủ, dừng ở ranh giới ký tự
+		for (size_t size = 0; size < n; size++)
+		{
+			char part[1024];
+			size_t m = VietNfc::normalize(c.input.data(), c.input.size(), part, size);
+			if (m > size || memcmp(part, out, m) != 0 || ((uint8_t)out[m] & 0xC0) == 0x80)
+			{
+				printf("FAIL %s \"%s\" truncated to %zu bytes -> \"%.*s\"\n", c.form.c_str(), c.input.c_str(), size,
+					   (int)m, part);
+				failures++;
+				break;
+			}
+		}
+	}
+
+	// Byte lỗi và dấu không có chữ gốc phải đi qua nguyên vẹn
+	const char *raw[] = {"\xff\xcc", "\xcc\x81" "abc", "a\xcc", "\xc3\xcc\x81", "x\xcc\x81\xcc\xa3"};
+	const char *rawExpected[] = {"\xff\xcc", "\xcc\x81" "abc", "a\xcc", "\xc3\xcc\x81", "x\xcc\xa3\xcc\x81"};
+	for (size_t i = 0; i < sizeof(raw) / sizeof(raw[0]); i++)
+	{
+		size_t n = VietNfc::normalize(raw[i], strlen(raw[i]), out, sizeof(out));
+		if (std::string(out, n) != rawExpected[i])
+		{
+			printf("FAIL raw case %zu\n", i);
+			failures++;
+		}
+	}
+	printf("nfc      : %zu cases, %d failed\n", cases.size(), failures);
+
+	// Thông lượng theo dạng
+	volatile size_t sink = 0;
+	for (size_t first = 0; first < cases.size();)
+	{
+		size_t last = first;
+		size_t bytes = 0;
+		while (last < cases.size() && cases[last].form == cases[first].form)
+		{
+			bytes += cases[last].input.size();
+			last++;
+		}
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		for (int r = 0; r < ROUNDS; r++)
+		{
+			for (size_t i = first; i < last; i++)
+			{
+				sink += ingest(cases[i].input, out, sizeof(out));
+			}
+		}
+		std::chrono::duration<double, std::nano> ns = std::chrono::steady_clock::now() - start;
+		double fields = (double)ROUNDS * (last - first);
+		printf("%-9s: %7.1f ns/field, %7.1f MB/s\n", cases[first].form.c_str(), ns.count() / fields,
+			   (double)ROUNDS * bytes / ns.count() * 1e3);
+		first = last;
+	}
+	return failures == 0 ? 0 : 1;
+}
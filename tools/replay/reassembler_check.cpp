@@ -0,0 +1,263 @@
+/*
+ * Kiểm tra src/ChronosReassembler.h với các phân đoạn mất, đảo thứ tự, lặp lại và quá hạn,
+ * ở MTU 23 (khung cũ 20/19 byte) và MTU 185. Chạy: make -C tools/replay check-reassembler
+ *
+ * Gói mẫu có byte dữ liệu theo vị trí nên mọi phân đoạn chép sai chỗ đều bị phát hiện.
+ */
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include "ChronosReassembler.h"
+
+typedef std::vector<uint8_t> Bytes;
+
+static int failures = 0;
+static int cases = 0;
+
+static void expect(bool ok, const char *name, const char *what)
+{
+	if (!ok)
+	{
+		printf("FAIL %s: %s\n", name, what);
+		failures++;
+	}
+}
+
+// Gói 0xAB dài length byte, byte i = (seed + i * 7) trừ header
+static Bytes makePacket(int length, uint8_t seed)
+{
+	Bytes p(length);
+	for (int i = 0; i < length; i++)
+	{
+		p[i] = (uint8_t)(seed + i * 7);
+	}
+	p[0] = 0xAB;
+	p[1] = (uint8_t)((length - 3) >> 8);
+	p[2] = (uint8_t)(length - 3);
+	p[3] = 0xFE;
+	return p;
+}
+
+// Cắt như điện thoại: phân đoạn đầu MTU - 3 byte, sau đó [chỉ số] + MTU - 4 byte
+static std::vector<Bytes> fragment(const Bytes &packet, int mtu)
+{
+	std::vector<Bytes> out;
+	size_t first = mtu - 3;
+	size_t next = mtu - 4;
+	out.push_back(Bytes(packet.begin(), packet.begin() + (packet.size() < first ? packet.size() : first)));
+	for (size_t offset = first, index = 0; offset < packet.size(); offset += next, index++)
+	{
+		size_t end = offset + next < packet.size() ? offset + next : packet.size();
+		Bytes f(end - offset + 1);
+		f[0] = (uint8_t)index;
+		memcpy(&f[1], &packet[offset], end - offset);
+		out.push_back(f);
+	}
+	return out;
+}
+
+static ChronosData *feed(ChronosReassembler &r, const Bytes &f, uint32_t now)
+{
+	return r.push(f.data(), (int)f.size(), now);
+}
+
+static bool same(const ChronosData *d, const Bytes &packet)
+{
+	return d != nullptr && d->length == (int)packet.size() && memcmp(d->data, packet.data(), packet.size()) == 0;
+}
+
+// Đưa các phân đoạn theo thứ tự order, gói chỉ được hoàn tất ở phân đoạn cuối cùng
+static void checkOrder(const char *name, int mtu, const std::vector<int> &order, const std::vector<int> &repeat)
+{
+	cases++;
+	ChronosReassembler r;
+	Bytes packet = makePacket(200, (uint8_t)mtu);
+	std::vector<Bytes> frags = fragment(packet, mtu);
+	ChronosData *done = nullptr;
+	int early = 0;
+	for (size_t i = 0; i < order.size(); i++)
+	{
+		for (int k = 0; k < repeat[i]; k++)
+		{
+			ChronosData *d = feed(r, frags[order[i]], 10);
+			if (d != nullptr && done != nullptr)
+			{
+				early++;
+			}
+			done = d != nullptr ? d : done;
+		}
+		if (done != nullptr && i + 1 < order.size())
+		{
+			early++;
+		}
+	}
+	expect(early == 0, name, "packet completed before its last fragment");
+	expect(same(done, packet), name, "reassembled bytes differ");
+	int extra = 0;
+	for (size_t i = 0; i < repeat.size(); i++)
+	{
+		extra += repeat[i] - 1;
+	}
+	expect(r.stats().duplicates + r.stats().orphans == (uint32_t)extra, name, "duplicate fragments not counted");
+	expect(r.stats().completed == 1, name, "completed != 1");
+}
+
+static void checkMtu(int mtu)
+{
+	char name[64];
+	size_t count = fragment(makePacket(200, 0), mtu).size();
+	std::vector<int> inOrder;
+	std::vector<int> once(count, 1);
+	for (size_t i = 0; i < count; i++)
+	{
+		inOrder.push_back((int)i);
+	}
+	snprintf(name, sizeof(name), "mtu %d in order", mtu);
+	checkOrder(name, mtu, inOrder, once);
+
+	// Header trước, phần còn lại đảo ngược / xen kẽ chẵn lẻ
+	std::vector<int> reversed(1, 0);
+	for (size_t i = count - 1; i > 0; i--)
+	{
+		reversed.push_back((int)i);
+	}
+	snprintf(name, sizeof(name), "mtu %d reversed", mtu);
+	checkOrder(name, mtu, reversed, once);
+
+	std::vector<int> interleaved(1, 0);
+	for (size_t i = 2; i < count; i += 2)
+	{
+		interleaved.push_back((int)i);
+	}
+	for (size_t i = 1; i < count; i += 2)
+	{
+		interleaved.push_back((int)i);
+	}
+	snprintf(name, sizeof(name), "mtu %d interleaved", mtu);
+	checkOrder(name, mtu, interleaved, once);
+
+	// Mỗi phân đoạn tiếp theo tới hai lần (trước khi gói xong nên là bản lặp)
+	if (count > 2)
+	{
+		std::vector<int> twice(count, 2);
+		twice[0] = 1;
+		twice[count - 1] = 1;
+		snprintf(name, sizeof(name), "mtu %d duplicated", mtu);
+		checkOrder(name, mtu, inOrder, twice);
+	}
+}
+
+// Mất một phân đoạn: tới muộn trong hạn vẫn ghép được; mất hẳn thì gói bị loại khi quá hạn
+// và gói sau vẫn ghép đúng
+static void checkLost()
+{
+	cases++;
+	const char *name = "lost fragment";
+	ChronosReassembler r;
+	Bytes a = makePacket(120, 1);
+	Bytes b = makePacket(90, 2);
+	std::vector<Bytes> fa = fragment(a, 23);
+	ChronosData *d = nullptr;
+	for (size_t i = 0; i < fa.size(); i++)
+	{
+		if (i != 3)
+		{
+			d = feed(r, fa[i], 100);
+			expect(d == nullptr, name, "incomplete packet delivered");
+		}
+	}
+	// Chưa quá hạn: gói dở dang vẫn giữ slot, phân đoạn mất tới muộn vẫn hoàn tất được
+	d = feed(r, fa[3], 100 + CHRONOS_RX_TIMEOUT_MS);
+	expect(same(d, a), name, "late fragment within timeout not accepted");
+	r.release(d);
+
+	for (size_t i = 0; i < fa.size(); i++)
+	{
+		if (i != 2)
+		{
+			feed(r, fa[i], 5000);
+		}
+	}
+	std::vector<Bytes> fb = fragment(b, 23);
+	d = nullptr;
+	for (size_t i = 0; i < fb.size(); i++)
+	{
+		d = feed(r, fb[i], 5000 + CHRONOS_RX_TIMEOUT_MS + 1);
+	}
+	expect(same(d, b), name, "next packet after a lost fragment");
+	expect(r.stats().evicted == 1, name, "stale packet not evicted");
+	expect(r.stats().completed == 2, name, "completed != 2");
+}
+
+// Phân đoạn của gói đã quá hạn tới muộn: không được ghép vào đâu cả
+static void checkStale()
+{
+	cases++;
+	const char *name = "stale fragment";
+	ChronosReassembler r;
+	Bytes a = makePacket(80, 3);
+	std::vector<Bytes> fa = fragment(a, 23);
+	feed(r, fa[0], 0);
+	feed(r, fa[1], 10);
+	ChronosData *d = feed(r, fa[2], CHRONOS_RX_TIMEOUT_MS + 1);
+	expect(d == nullptr, name, "fragment joined an expired packet");
+	for (size_t i = 3; i < fa.size(); i++)
+	{
+		d = feed(r, fa[i], CHRONOS_RX_TIMEOUT_MS + 2);
+		expect(d == nullptr, name, "expired packet delivered");
+	}
+	expect(r.stats().evicted == 1, name, "evicted != 1");
+	expect(r.stats().orphans == fa.size() - 2, name, "late fragments not counted as orphans");
+	expect(r.stats().completed == 0, name, "completed != 0");
+
+	// Phân đoạn tiếp theo tới trước header: bỏ, gói gửi lại đầy đủ vẫn ghép đúng
+	feed(r, fa[1], 4000);
+	d = nullptr;
+	for (size_t i = 0; i < fa.size(); i++)
+	{
+		d = feed(r, fa[i], 4000);
+	}
+	expect(same(d, a), name, "resent packet after orphan fragment");
+}
+
+// Hết slot: gói đang ghép cũ nhất bị hy sinh, gói đã xong chờ release() không bị đụng tới
+static void checkSlots()
+{
+	cases++;
+	const char *name = "slot pressure";
+	ChronosReassembler r;
+	Bytes ready = makePacket(10, 4);
+	ChronosData *held = feed(r, ready, 0);
+	expect(same(held, ready), name, "single-fragment packet");
+
+	std::vector<std::vector<Bytes> > partial;
+	for (int i = 0; i < CHRONOS_RX_SLOTS; i++)
+	{
+		partial.push_back(fragment(makePacket(60, (uint8_t)(10 + i)), 23));
+		feed(r, partial.back()[0], 1);
+	}
+	expect(r.stats().evicted == 1, name, "oldest partial packet not evicted");
+	expect(same(held, ready), name, "ready packet overwritten before release()");
+
+	// Gói mới nhất hoàn tất: phân đoạn tiếp theo thuộc gói mới nhất còn thiếu nó
+	ChronosData *d = nullptr;
+	const std::vector<Bytes> &last = partial.back();
+	for (size_t i = 1; i < last.size(); i++)
+	{
+		d = feed(r, last[i], 2);
+	}
+	expect(same(d, makePacket(60, (uint8_t)(10 + CHRONOS_RX_SLOTS - 1))), name, "newest packet");
+	r.release(held);
+	r.release(d);
+}
+
+int main()
+{
+	checkMtu(23);
+	checkMtu(185);
+	checkLost();
+	checkStale();
+	checkSlots();
+	printf("reassembler : %d cases, %d failed\n", cases, failures);
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,313 @@
+/*
+ * Phát lại file capture .chcap qua mã phân tích thật của ChronosESP32Patched
+ * trên Linux (NimBLE/Arduino được thay bằng stubs/).
+ *
+ *   ./chronos_replay capture.chcap              # nhanh nhất có thể, đo gói/giây
+ *   ./chronos_replay --realtime capture.chcap   # giữ nguyên nhịp thời gian gốc
+ *   ./chronos_replay --repeat 1000 -v capture.chcap
+ *   ./chronos_replay --mtu 185 capture.chcap    # cắt lại gói như điện thoại với MTU 185
+ *
+ * Mỗi lần ghi được đưa vào onWrite() như callback của NimBLE, sau đó
+ * processPackets() chạy như ChronosManager::update() trên task chính.
+ */
+#include <Arduino.h>
+#include <NimBLEDevice.h>
+#include <chrono>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ChronosESP32Patched.h"
+#include "ChronosCapture.h"
+#include "BinLog.h"
+
+uint32_t replayMillis = 0;
+Print Serial;
+
+// Đếm cấp phát heap trên đường phân tích (onWrite + processPackets), không tính stub NimBLE
+static bool countAllocations = false;
+static uint64_t allocationCount = 0;
+static uint64_t allocationBytes = 0;
+static uint32_t heapAllocations = 0; // luôn đếm, làm free heap ảo cho ESP.getFreeHeap()
+
+EspClass ESP;
+uint32_t EspClass::getFreeHeap() { return 0xFFFFFFFF - heapAllocations; }
+
+void *operator new(size_t size)
+{
+	heapAllocations++;
+	if (countAllocations)
+	{
+		allocationCount++;
+		allocationBytes += size;
+	}
+	void *p = malloc(size != 0 ? size : 1);
+	if (p == nullptr)
+	{
+		throw std::bad_alloc();
+	}
+	return p;
+}
+
+void operator delete(void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+
+struct CaptureEntry
+{
+	ChronosCaptureRecord header;
+	std::vector<uint8_t> data;
+};
+
+static uint32_t parsedPackets = 0;
+static uint32_t configEvents = 0;
+static uint32_t notificationEvents = 0;
+static uint32_t navFieldChanges[8] = {0}; // số lần mỗi bit NAV_FIELD_* được bật
+static const char *const navFieldNames[8] = {"title", "duration", "distance", "eta", "directions", "speed", "icon", "state"};
+
+static void onData(uint8_t *, int) { parsedPackets++; }
+
+static void onConfig(ConfigType type, uint32_t, uint32_t value2)
+{
+	configEvents++;
+	if (type == CF_NAV_DATA)
+	{
+		for (int bit = 0; bit < 8; bit++)
+		{
+			if (value2 & (1u << bit))
+			{
+				navFieldChanges[bit]++;
+			}
+		}
+	}
+}
+#if CHRONOS_HAS(NOTIFICATIONS)
+static void onNotification(const Notification &) { notificationEvents++; }
+#endif
+
+static bool loadCapture(const char *path, std::vector<CaptureEntry> &entries)
+{
+	FILE *f = fopen(path, "rb");
+	if (f == nullptr)
+	{
+		perror(path);
+		return false;
+	}
+
+	uint8_t header[8];
+	if (fread(header, 1, sizeof(header), f) != sizeof(header) ||
+		memcmp(header, CHRONOS_CAPTURE_FILE_MAGIC, 4) != 0)
+	{
+		fprintf(stderr, "%s: not a .chcap file\n", path);
+		fclose(f);
+		return false;
+	}
+	if (header[4] != CHRONOS_CAPTURE_VERSION)
+	{
+		fprintf(stderr, "%s: unsupported capture version %u\n", path, header[4]);
+		fclose(f);
+		return false;
+	}
+
+	CaptureEntry entry;
+	while (fread(&entry.header, 1, sizeof(entry.header), f) == sizeof(entry.header))
+	{
+		entry.data.resize(entry.header.length);
+		if (fread(entry.data.data(), 1, entry.header.length, f) != entry.header.length)
+		{
+			fprintf(stderr, "%s: truncated record %zu\n", path, entries.size());
+			break;
+		}
+		entries.push_back(entry);
+	}
+	fclose(f);
+	return true;
+}
+
+// Ghép lại các gói trong capture rồi cắt chúng như điện thoại làm với ATT MTU
+// cho trước: phân đoạn đầu MTU - 3 byte, các phân đoạn sau [chỉ số][MTU - 4 byte]
+static std::vector<CaptureEntry> refragment(const std::vector<CaptureEntry> &entries, int mtu)
+{
+	std::vector<CaptureEntry> out;
+	ChronosReassembler reassembler;
+	int first = mtu - 3;
+	int next = first - 1;
+	for (size_t i = 0; i < entries.size(); i++)
+	{
+		const CaptureEntry &entry = entries[i];
+		ChronosData *packet = reassembler.push(entry.data.data(), entry.data.size(), entry.header.timestamp);
+		if (packet == nullptr)
+		{
+			continue;
+		}
+		CaptureEntry part;
+		part.header = entry.header;
+		int n = packet->length < first ? packet->length : first;
+		part.data.assign(packet->data, packet->data + n);
+		part.header.length = n;
+		out.push_back(part);
+		for (int offset = n, index = 0; offset < packet->length; offset += next, index++)
+		{
+			n = packet->length - offset < next ? packet->length - offset : next;
+			part.data.assign(1, (uint8_t)index);
+			part.data.insert(part.data.end(), packet->data + offset, packet->data + offset + n);
+			part.header.length = n + 1;
+			out.push_back(part);
+		}
+		reassembler.release(packet);
+	}
+	return out;
+}
+
+static void usage(const char *argv0)
+{
+	fprintf(stderr, "usage: %s [--realtime] [--repeat N] [--mtu N] [-v] capture.chcap\n", argv0);
+}
+
+int main(int argc, char **argv)
+{
+	bool realtime = false;
+	bool verbose = false;
+	long repeat = 1;
+	int mtu = 0; // 0: phát lại nguyên các lần ghi trong capture
+	const char *path = nullptr;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "--realtime") == 0)
+		{
+			realtime = true;
+		}
+		else if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc)
+		{
+			repeat = atol(argv[++i]);
+		}
+		else if (strcmp(argv[i], "--mtu") == 0 && i + 1 < argc)
+		{
+			mtu = atoi(argv[++i]);
+		}
+		else if (strcmp(argv[i], "-v") == 0 || strcmp(argv[i], "--verbose") == 0)
+		{
+			verbose = true;
+		}
+		else if (argv[i][0] != '-' && path == nullptr)
+		{
+			path = argv[i];
+		}
+		else
+		{
+			usage(argv[0]);
+			return 2;
+		}
+	}
+	if (path == nullptr || repeat < 1 || (mtu != 0 && (mtu < CHRONOS_DEFAULT_MTU || mtu > CHRONOS_PREFERRED_MTU)))
+	{
+		usage(argv[0]);
+		return 2;
+	}
+
+	std::vector<CaptureEntry> entries;
+	if (!loadCapture(path, entries) || entries.empty())
+	{
+		fprintf(stderr, "%s: no records\n", path);
+		return 1;
+	}
+	if (mtu != 0)
+	{
+		entries = refragment(entries, mtu);
+	}
+
+	Serial.out = verbose ? stderr : nullptr;
+
+	ChronosESP32Patched chronos;
+	chronos.setDataCallback(onData);
+	chronos.setConfigurationCallback(onConfig);
+#if CHRONOS_HAS(NOTIFICATIONS)
+	chronos.setNotificationCallback(onNotification);
+#endif
+	chronos.begin();
+
+	// Giả lập kết nối + subscribe để các phản hồi gửi đi cũng được chạy
+	NimBLEConnInfo conn;
+	NimBLECharacteristic &rx = *NimBLECharacteristic::lastAdded();
+	NimBLEServerCallbacks &server = chronos;
+	NimBLECharacteristicCallbacks &callbacks = chronos;
+	server.onConnect(NimBLEDevice::createServer(), conn);
+	if (mtu != 0)
+	{
+		conn.mtu = mtu;
+		server.onMTUChange(mtu, conn);
+	}
+	callbacks.onSubscribe(&rx, conn, 1);
+
+	uint32_t span = entries.back().header.timestamp;
+	uint64_t fragments = 0;
+	uint64_t bytes = 0;
+
+	std::chrono::steady_clock::time_point started = std::chrono::steady_clock::now();
+
+	for (long pass = 0; pass < repeat; pass++)
+	{
+		// Mỗi vòng lệch thêm một khoảng > CHRONOS_RX_TIMEOUT_MS để gói dở dang
+		// của vòng trước hết hạn như trên thiết bị
+		uint32_t base = (uint32_t)pass * (span + CHRONOS_RX_TIMEOUT_MS + 1);
+		std::chrono::steady_clock::time_point passStart = std::chrono::steady_clock::now();
+
+		for (size_t i = 0; i < entries.size(); i++)
+		{
+			const CaptureEntry &entry = entries[i];
+			if (realtime)
+			{
+				std::this_thread::sleep_until(passStart + std::chrono::milliseconds(entry.header.timestamp));
+			}
+			replayMillis = base + entry.header.timestamp;
+
+			rx.setValue(entry.data.data(), entry.data.size()); // bộ đệm của NimBLE, ngoài đường phân tích
+			countAllocations = true;
+			callbacks.onWrite(&rx, conn);
+			chronos.processPackets();
+			countAllocations = false;
+
+			fragments++;
+			bytes += entry.data.size();
+		}
+		if (verbose)
+		{
+			BinLog::drain();
+		}
+	}
+
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+
+	const ChronosReassemblerStats &stats = chronos.getReassemblerStats();
+	const ChronosWriteStats &writes = chronos.getWriteStats();
+	printf("capture     : %s (%zu writes, %.3f s)\n", path, entries.size(), span / 1000.0);
+	printf("state       : %zu bytes inline in ChronosESP32Patched (no heap strings)\n", sizeof(ChronosESP32Patched));
+	printf("mode        : %s x%ld, mtu %s\n", realtime ? "realtime" : "fast", repeat,
+		   mtu != 0 ? std::to_string(mtu).c_str() : "as captured");
+	printf("elapsed     : %.6f s\n", seconds);
+	printf("throughput  : %.0f writes/s, %.0f packets/s, %.2f MB/s\n",
+		   fragments / seconds, parsedPackets / seconds, bytes / seconds / 1e6);
+	printf("allocations : %llu (%.2f per write, %.1f bytes per write)\n",
+		   (unsigned long long)allocationCount, (double)allocationCount / fragments,
+		   (double)allocationBytes / fragments);
+	printf("packets     : %u parsed, %u config events, %u notifications, %u notifies sent\n",
+		   parsedPackets, configEvents, notificationEvents, NimBLECharacteristic::sentNotifications());
+	printf("onWrite     : %u writes, %u bytes, %u heap-changed writes, %.2f bytes copied per byte\n",
+		   writes.writes, writes.bytes, writes.heapChangedWrites,
+		   writes.bytes != 0 ? (double)stats.bytesCopied / writes.bytes : 0.0);
+	printf("reassembler : frag=%u done=%u evicted=%u dropped=%u orphans=%u dup=%u\n",
+		   stats.fragments, stats.completed, stats.evicted, stats.dropped, stats.orphans, stats.duplicates);
+	printf("rx queue    : overflows=%u highWater=%u\n",
+		   chronos.getRxQueueOverflows(), chronos.getRxQueueHighWater());
+	const NavIconStats &icons = chronos.getNavIconStats();
+	printf("nav icons   : parts=%u committed=%u crcMismatch=%u unchecked=%u cacheHit=%u cacheMiss=%u\n",
+		   icons.parts, icons.committed, icons.crcMismatches, icons.crcUnchecked, icons.cacheHits, icons.cacheMisses);
+	printf("nav changes :");
+	for (int bit = 0; bit < 8; bit++)
+	{
+		printf(" %s=%u", navFieldNames[bit], navFieldChanges[bit]);
+	}
+	printf("\n");
+	return 0;
+}
@@ -0,0 +1,106 @@
+/*
+ * Thử src/SpscQueue.h với hai thread thật: một producer (vai callback NimBLE) và
+ * một consumer (vai loop chính) chạy song song trên hàng đợi cùng dung lượng _rxQueue.
+ * Chạy: make -C tools/replay check-spsc
+ *
+ *  - lossless: producer chờ khi đầy, consumer phải nhận đủ mọi phần tử, đúng thứ tự;
+ *  - overflow: producer không chờ, phần tử bị bỏ chỉ là những lần push() trả về false,
+ *    overflows() phải đếm đúng số đó, phần còn lại vẫn đúng thứ tự.
+ * Mỗi phần tử mang seq và ~seq để phát hiện phần tử bị đọc khi chưa ghi xong.
+ */
+#include <stdio.h>
+#include <atomic>
+#include <thread>
+#include "ChronosReassembler.h"
+#include "SpscQueue.h"
+
+struct Item
+{
+	uint32_t seq;
+	uint32_t check;
+};
+
+static const size_t CAPACITY = CHRONOS_RX_SLOTS; // = CHRONOS_RX_QUEUE_SIZE của _rxQueue
+static const uint32_t ITEMS = 200000;
+
+struct Result
+{
+	uint32_t received;
+	uint32_t outOfOrder;
+	uint32_t torn;
+	uint32_t dropped; // khoảng trống giữa hai seq liên tiếp nhận được
+};
+
+static void consume(SpscQueue<Item, CAPACITY> &queue, const std::atomic<bool> &done, Result &r)
+{
+	uint32_t next = 0;
+	Item item;
+	for (;;)
+	{
+		if (!queue.pop(item))
+		{
+			// done chỉ được đọc lại sau khi pop thất bại: phần tử cuối đã vào hàng đợi trước done
+			if (done.load(std::memory_order_acquire) && queue.empty())
+			{
+				break;
+			}
+			std::this_thread::yield(); // máy một nhân: nhường cho producer
+			continue;
+		}
+		r.received++;
+		if (item.check != ~item.seq)
+		{
+			r.torn++;
+		}
+		if (item.seq < next)
+		{
+			r.outOfOrder++;
+			continue;
+		}
+		r.dropped += item.seq - next;
+		next = item.seq + 1;
+	}
+	r.dropped += ITEMS - next;
+}
+
+static int run(const char *name, bool lossless)
+{
+	SpscQueue<Item, CAPACITY> queue;
+	std::atomic<bool> done(false);
+	Result r = {0, 0, 0, 0};
+	uint32_t rejected = 0;
+
+	std::thread consumer(consume, std::ref(queue), std::cref(done), std::ref(r));
+	for (uint32_t seq = 0; seq < ITEMS; seq++)
+	{
+		Item item = {seq, ~seq};
+		while (!queue.push(item))
+		{
+			rejected++;
+			std::this_thread::yield();
+			if (!lossless)
+			{
+				break;
+			}
+		}
+	}
+	done.store(true, std::memory_order_release);
+	consumer.join();
+
+	int failures = 0;
+	failures += r.torn != 0;
+	failures += r.outOfOrder != 0;
+	failures += queue.overflows() != rejected;
+	failures += queue.pushed() != r.received;
+	failures += queue.highWater() > CAPACITY;
+	failures += lossless ? (r.received != ITEMS || r.dropped != 0) : (r.received + rejected != ITEMS || r.dropped != rejected);
+	printf("%-8s : %u items, %u received, %u rejected, high water %u/%zu, %u torn, %u out of order -> %s\n", name, ITEMS,
+		   r.received, rejected, queue.highWater(), CAPACITY, r.torn, r.outOfOrder, failures == 0 ? "ok" : "FAILED");
+	return failures;
+}
+
+int main()
+{
+	int failures = run("lossless", true) + run("overflow", false);
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,126 @@
+// Arduino/FreeRTOS tối thiểu để biên dịch mã phân tích gói trên Linux.
+// Chỉ cài đặt những gì ChronosESP32Patched và BinLog dùng tới.
+#ifndef REPLAY_ARDUINO_H
+#define REPLAY_ARDUINO_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+
+typedef bool boolean;
+
+#define F(x) x
+#define PROGMEM
+#define HEX 16
+#define HIGH 1
+#define LOW 0
+
+// Đồng hồ ảo: tools/replay điều khiển millis() theo timestamp của capture
+extern uint32_t replayMillis;
+inline unsigned long millis() { return replayMillis; }
+inline unsigned long micros() { return replayMillis * 1000UL; }
+inline void delay(unsigned long) {}
+// Heap ảo: replay.cpp trả về giá trị giảm theo mỗi lần operator new
+struct EspClass
+{
+	uint32_t getFreeHeap();
+};
+extern EspClass ESP;
+
+inline bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+class String
+{
+public:
+	String() {}
+	String(const char *c) : s(c != nullptr ? c : "") {}
+	String(const std::string &x) : s(x) {}
+	String(char c) : s(1, c) {}
+	String(int v, int base = 10) { format(base == 16 ? "%x" : "%d", v); }
+	String(unsigned v, int base = 10) { format(base == 16 ? "%x" : "%u", v); }
+	String(long v, int base = 10) { format(base == 16 ? "%lx" : "%ld", v); }
+	String(unsigned long v, int base = 10) { format(base == 16 ? "%lx" : "%lu", v); }
+	String(float f) { format("%.2f", f); }
+
+	const char *c_str() const { return s.c_str(); }
+	unsigned length() const { return s.size(); }
+	void reserve(unsigned n) { s.reserve(n); }
+	char charAt(unsigned i) const { return i < s.size() ? s[i] : 0; }
+	float toFloat() const { return atof(s.c_str()); }
+	int toInt() const { return atoi(s.c_str()); }
+	int indexOf(char c) const { size_t p = s.find(c); return p == std::string::npos ? -1 : (int)p; }
+	String substring(unsigned a) const { return a < s.size() ? String(s.substr(a)) : String(); }
+	String substring(unsigned a, unsigned b) const { return a < s.size() && b > a ? String(s.substr(a, b - a)) : String(); }
+	bool startsWith(const String &o) const { return s.compare(0, o.s.size(), o.s) == 0; }
+	void trim() {}
+
+	String &operator+=(char c) { s += c; return *this; }
+	String &operator+=(const char *o) { s += o; return *this; }
+	String &operator+=(const String &o) { s += o.s; return *this; }
+	bool operator==(const String &o) const { return s == o.s; }
+	bool operator!=(const String &o) const { return s != o.s; }
+	bool operator==(const char *o) const { return s == o; }
+
+	std::string s;
+
+private:
+	template <typename T>
+	void format(const char *fmt, T v)
+	{
+		char b[32];
+		snprintf(b, sizeof(b), fmt, v);
+		s = b;
+	}
+};
+
+inline String operator+(const String &a, const String &b) { return String(a.s + b.s); }
+inline String operator+(const char *a, const String &b) { return String(std::string(a) + b.s); }
+inline String operator+(const String &a, const char *b) { return String(a.s + b); }
+
+// Serial ghi ra một FILE* (mặc định /dev/null, --verbose để xem log)
+class Print
+{
+public:
+	FILE *out = nullptr;
+
+	void begin(long) {}
+	void flush() {}
+	int available() { return 0; }
+	int read() { return -1; }
+
+	template <typename... A>
+	void printf(const char *f, A... a) { if (out) fprintf(out, f, a...); }
+	void print(const String &x) { print(x.c_str()); }
+	void print(const char *x) { if (out) fputs(x, out); }
+	void print(int x) { printf("%d", x); }
+	void print(unsigned x) { printf("%u", x); }
+	void print(unsigned long x) { printf("%lu", x); }
+	void println() { print("\n"); }
+	void println(const String &x) { print(x); println(); }
+	void println(const char *x) { print(x); println(); }
+	void println(int x) { print(x); println(); }
+	void println(unsigned x) { print(x); println(); }
+	void println(unsigned long x) { print(x); println(); }
+	size_t write(const uint8_t *b, size_t n) { return out ? fwrite(b, 1, n, out) : n; }
+	size_t write(uint8_t b) { return write(&b, 1); }
+};
+
+extern Print Serial;
+
+// Esp.h
+typedef int FlashMode_t;
+
+// FreeRTOS: replay chạy một luồng nên critical section không cần làm gì
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED 0
+#define portENTER_CRITICAL(x) (void)(x)
+#define portEXIT_CRITICAL(x) (void)(x)
+#define tskIDLE_PRIORITY 0
+#define pdMS_TO_TICKS(x) (x)
+inline int xTaskCreate(void (*)(void *), const char *, int, void *, int, void *) { return 1; }
+inline void vTaskDelay(int) {}
+
+#endif // REPLAY_ARDUINO_H
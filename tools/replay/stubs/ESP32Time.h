@@ -0,0 +1,20 @@
+#ifndef REPLAY_ESP32TIME_H
+#define REPLAY_ESP32TIME_H
+
+#include <Arduino.h>
+
+class ESP32Time
+{
+public:
+	ESP32Time(long offset = 0) { (void)offset; }
+	void setTime(int, int, int, int, int, int, int ms = 0) { (void)ms; }
+	int getHour(bool mode = false) { (void)mode; return 0; }
+	int getMinute() { return 0; }
+	int getSecond() { return 0; }
+	int getDay() { return 0; }
+	int getDayofYear() { return 0; }
+	int getMonth() { return 0; }
+	int getYear() { return 0; }
+};
+
+#endif // REPLAY_ESP32TIME_H
@@ -0,0 +1,174 @@
+// NimBLE tối thiểu cho replay: characteristic chỉ giữ giá trị, notify() đếm
+// số gói gửi đi; không có radio, không có host task.
+#ifndef REPLAY_NIMBLE_DEVICE_H
+#define REPLAY_NIMBLE_DEVICE_H
+
+#include <Arduino.h>
+#include <string>
+
+class NimBLEUUID
+{
+public:
+	NimBLEUUID(const char *uuid = "") : _uuid(uuid) {}
+	std::string toString() const { return _uuid; }
+	bool operator==(const NimBLEUUID &o) const { return _uuid == o._uuid; }
+
+private:
+	std::string _uuid;
+};
+
+class NimBLEAddress
+{
+public:
+	std::string toString() const { return "00:00:00:00:00:00"; }
+};
+
+class NimBLEConnInfo
+{
+public:
+	uint16_t getConnHandle() const { return 0; }
+	uint16_t getMTU() const { return mtu; }
+	uint16_t mtu = 23;
+};
+
+// Thủ tục GATT client của NimBLE host, replay báo MTU qua onMTUChange()
+typedef int ble_gatt_mtu_fn(uint16_t, const void *, uint16_t, void *);
+inline int ble_gattc_exchange_mtu(uint16_t, ble_gatt_mtu_fn *, void *) { return 0; }
+
+class NimBLEAttValue
+{
+public:
+	NimBLEAttValue() {}
+	NimBLEAttValue(const uint8_t *d, size_t n) : _value((const char *)d, n) {}
+	const uint8_t *data() const { return (const uint8_t *)_value.data(); }
+	size_t size() const { return _value.size(); }
+	size_t length() const { return _value.size(); }
+	operator std::string() const { return _value; }
+
+private:
+	std::string _value;
+};
+
+namespace NIMBLE_PROPERTY
+{
+	enum
+	{
+		READ = 0x02,
+		WRITE_NR = 0x04,
+		WRITE = 0x08,
+		NOTIFY = 0x10
+	};
+}
+
+class NimBLECharacteristic;
+class NimBLEServer;
+
+class NimBLECharacteristicCallbacks
+{
+public:
+	virtual ~NimBLECharacteristicCallbacks() {}
+	virtual void onWrite(NimBLECharacteristic *, NimBLEConnInfo &) {}
+	virtual void onSubscribe(NimBLECharacteristic *, NimBLEConnInfo &, uint16_t) {}
+};
+
+class NimBLEServerCallbacks
+{
+public:
+	virtual ~NimBLEServerCallbacks() {}
+	virtual void onConnect(NimBLEServer *, NimBLEConnInfo &) {}
+	virtual void onDisconnect(NimBLEServer *, NimBLEConnInfo &, int) {}
+	virtual void onMTUChange(uint16_t, NimBLEConnInfo &) {}
+};
+
+class NimBLEService;
+
+#define BLE_ATT_ATTR_MAX_LEN 512
+
+class NimBLECharacteristic
+{
+public:
+	NimBLECharacteristic(const char *uuid = "", uint16_t = 0, uint16_t = BLE_ATT_ATTR_MAX_LEN, NimBLEService * = nullptr)
+		: _uuid(uuid) {}
+	virtual ~NimBLECharacteristic() {}
+	NimBLEUUID getUUID() const { return _uuid; }
+	NimBLEAttValue getValue() const { return m_value; }
+	void setValue(const uint8_t *d, size_t n) { m_value = NimBLEAttValue(d, n); }
+	void setCallbacks(NimBLECharacteristicCallbacks *) {}
+	uint16_t getHandle() const { return 0; }
+	bool notify() { sentNotifications()++; return true; }
+	bool notify(const uint8_t *, size_t, uint16_t = 0xFFFF) { sentNotifications()++; return true; }
+
+	// Tổng số notify() của mọi characteristic
+	static uint32_t &sentNotifications()
+	{
+		static uint32_t count = 0;
+		return count;
+	}
+
+	// Characteristic cuối cùng được addCharacteristic(), để replay ghi vào đúng đối tượng
+	static NimBLECharacteristic *&lastAdded()
+	{
+		static NimBLECharacteristic *c = nullptr;
+		return c;
+	}
+
+protected:
+	NimBLEAttValue m_value;
+
+private:
+	NimBLEUUID _uuid;
+};
+
+class NimBLEService
+{
+public:
+	NimBLECharacteristic *createCharacteristic(const char *uuid, uint32_t) { return new NimBLECharacteristic(uuid); }
+	void addCharacteristic(NimBLECharacteristic *c) { NimBLECharacteristic::lastAdded() = c; }
+	bool start() { return true; }
+};
+
+class NimBLEAdvertising
+{
+public:
+	bool addServiceUUID(const char *) { return true; }
+	bool enableScanResponse(bool) { return true; }
+	bool setPreferredParams(uint16_t, uint16_t) { return true; }
+	bool setName(const char *) { return true; }
+	bool start() { return true; }
+	bool stop() { return true; }
+};
+
+class NimBLEServer
+{
+public:
+	void setCallbacks(NimBLEServerCallbacks *) {}
+	NimBLEService *createService(const char *) { return new NimBLEService(); }
+	NimBLEAdvertising *getAdvertising() { return &_advertising; }
+	uint16_t getPeerMTU(uint16_t) const { return 23; }
+
+private:
+	NimBLEAdvertising _advertising;
+};
+
+class NimBLEDevice
+{
+public:
+	static bool init(const std::string &) { return true; }
+	static bool deinit(bool = false) { return true; }
+	static NimBLEServer *createServer()
+	{
+		static NimBLEServer server;
+		return &server;
+	}
+	static bool setMTU(uint16_t) { return true; }
+	static uint16_t getMTU() { return 517; }
+	static NimBLEAddress getAddress() { return NimBLEAddress(); }
+	static bool startAdvertising() { return true; }
+};
+
+typedef NimBLEDevice BLEDevice;
+typedef NimBLECharacteristic BLECharacteristic;
+typedef NimBLEServerCallbacks BLEServerCallbacks;
+typedef NimBLECharacteristicCallbacks BLECharacteristicCallbacks;
+
+#endif // REPLAY_NIMBLE_DEVICE_H